@@ -1,6 +1,6 @@
 # lal.m4 - lal specific macros
 #
-# serial 20
+# serial 21
 
 AC_DEFUN([LAL_WITH_DEFAULT_DEBUG_LEVEL],[
   AC_ARG_WITH(
@@ -25,6 +25,17 @@ AC_DEFUN([LAL_ENABLE_FFTW3_MEMALIGN],
   ),[fftw3_memalign=false])
 ])
 
+AC_DEFUN([LAL_ENABLE_FFTW3_THREADS],
+[AC_ARG_ENABLE(
+  [fftw3_threads],
+  AC_HELP_STRING([--enable-fftw3-threads],[allow multi-threaded fftw3 plans [default=no]]),
+  AS_CASE(["${enableval}"],
+    [yes],[fftw3_threads=true],
+    [no],[fftw3_threads=false],
+    AC_MSG_ERROR([bad value for ${enableval} for --enable-fftw3-threads])
+  ),[fftw3_threads=false])
+])
+
 AC_DEFUN([LAL_ENABLE_INTELFFT],
 [AC_ARG_ENABLE(
   [intelfft],
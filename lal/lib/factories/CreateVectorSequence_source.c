@@ -21,7 +21,11 @@ STYPE * XFUNC ( UINT4 length, UINT4 veclen )
   if ( ! length || ! veclen )
     XLAL_ERROR_NULL( XLAL_EBADLEN );
 
-  seq = LALMalloc( sizeof( *seq ) );
+  LALArena * arena = XLALGetCurrentArena();
+  if ( arena ) /* allocate from the current arena of this thread */
+    seq = XLALArenaAlloc( arena, sizeof( *seq ) );
+  else
+    seq = LALMalloc( sizeof( *seq ) );
   if ( ! seq )
     XLAL_ERROR_NULL( XLAL_ENOMEM );
 
@@ -30,6 +34,12 @@ STYPE * XFUNC ( UINT4 length, UINT4 veclen )
 
   if ( ! length || ! veclen )
     seq->data = NULL;
+  else if ( arena )
+  {
+    seq->data = XLALArenaAlloc( arena, length * veclen * sizeof( *seq->data ) );
+    if ( ! seq->data )
+      XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
   else
   {
     seq->data = LALMalloc( length * veclen * sizeof( *seq->data ) );
@@ -17,12 +17,22 @@
 VTYPE * XFUNC ( UINT4 length )
 {
   VTYPE * vector;
-  vector = LALMalloc( sizeof( *vector ) );
+  LALArena * arena = XLALGetCurrentArena();
+  if ( arena ) /* allocate from the current arena of this thread */
+    vector = XLALArenaAlloc( arena, sizeof( *vector ) );
+  else
+    vector = LALMalloc( sizeof( *vector ) );
   if ( ! vector )
     XLAL_ERROR_NULL( XLAL_ENOMEM );
   vector->length = length;
   if ( ! length ) /* zero length: set data pointer to be NULL */
     vector->data = NULL;
+  else if ( arena )
+  {
+    vector->data = XLALArenaAlloc( arena, length * sizeof( *vector->data ) );
+    if ( ! vector->data )
+      XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
   else /* non-zero length: allocate memory for data */
   {
 #ifdef USE_ALIGNED_MEMORY_ROUTINES
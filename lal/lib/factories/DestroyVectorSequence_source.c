@@ -22,10 +22,12 @@ void XFUNC ( STYPE *vseq )
     XLAL_ERROR_VOID( XLAL_EINVAL );
   if ( ! vseq->data && ( vseq->length || vseq->vectorLength ) )
     XLAL_ERROR_VOID( XLAL_EINVAL );
-  if ( vseq->data )
+  /* memory owned by an arena is released by XLALArenaReset() */
+  if ( vseq->data && ! XLALArenaOwner( vseq->data ) )
     LALFree( vseq->data );
   vseq->data = NULL; /* leave lengths as they are to indicate freed vector */
-  LALFree( vseq );
+  if ( ! XLALArenaOwner( vseq ) )
+    LALFree( vseq );
   return;
 }
 
@@ -20,15 +20,17 @@ void XFUNC ( VTYPE *vector )
     return;
   if ( ( ! vector->length || ! vector->data ) && ( vector->length || vector->data  ) )
     XLAL_ERROR_VOID( XLAL_EINVAL );
+  /* memory owned by an arena is released by XLALArenaReset() */
 #ifdef USE_ALIGNED_MEMORY_ROUTINES
-  if ( vector->data )
+  if ( vector->data && ! XLALArenaOwner( vector->data ) )
     XLALFreeAligned( vector->data );
 #else
-  if ( vector->data )
+  if ( vector->data && ! XLALArenaOwner( vector->data ) )
     XLALFree( vector->data );
 #endif
   vector->data = NULL; /* leave length non-zero to detect repeated frees */
-  LALFree( vector );
+  if ( ! XLALArenaOwner( vector ) )
+    LALFree( vector );
   return;
 }
 
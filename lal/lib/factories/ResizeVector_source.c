@@ -27,6 +27,21 @@ VTYPE * XFUNC ( VTYPE * vector, UINT4 length )
     XDFUNC ( vector );
     return NULL;
   }
+  LALArena * arena = XLALArenaOwner( vector->data );
+  if ( arena && arena == XLALGetCurrentArena() )
+    vector->data = XLALArenaRealloc( arena, vector->data, vector->length * sizeof( *vector->data ), length * sizeof( *vector->data ) );
+  else if ( arena ) /* arena is not in use by this thread: move data to the heap */
+  {
+#ifdef USE_ALIGNED_MEMORY_ROUTINES
+    void * data = XLALMallocAligned( length * sizeof( *vector->data ) );
+#else
+    void * data = LALMalloc( length * sizeof( *vector->data ) );
+#endif
+    if ( data )
+      memcpy( data, vector->data, ( length < vector->length ? length : vector->length ) * sizeof( *vector->data ) );
+    vector->data = data;
+  }
+  else
 #ifdef USE_ALIGNED_MEMORY_ROUTINES
   vector->data = XLALReallocAligned( vector->data, length * sizeof( *vector->data ) );
 #else
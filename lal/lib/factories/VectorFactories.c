@@ -4,7 +4,9 @@ File Name: VectorFactories.c
 
 -------------------------------------------------------------------------*/
 
+#include <string.h>
 #include <lal/LALStdlib.h>
+#include <lal/LALArena.h>
 #include <lal/AVFactories.h>
 
 #define TYPECODE Z
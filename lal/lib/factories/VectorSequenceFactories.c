@@ -1,4 +1,5 @@
 #include <lal/LALStdlib.h>
+#include <lal/LALArena.h>
 #include <lal/SeqFactories.h>
 
 #define TYPECODE Z
@@ -21,6 +21,7 @@
 
 #include <complex.h>
 #include <fftw3.h>
+#include <limits.h>
 #include <string.h>
 
 #include <lal/AVFactories.h>
@@ -30,6 +31,14 @@
 #include <lal/LALMalloc.h>
 #include <lal/XLALError.h>
 
+#include "FFTWPlanCache.h"
+
+#ifdef __GNUC__
+#define UNUSED __attribute__ ((unused))
+#else
+#define UNUSED
+#endif
+
 /**
  * \addtogroup ComplexFFT_h
  *
@@ -127,6 +136,9 @@ tagCOMPLEX8FFTPlan
   INT4       sign; /**< sign in transform exponential, -1 for forward, +1 for reverse */
   UINT4      size; /**< length of the complex data vector for this plan */
   fftwf_plan plan; /**< the FFTW plan */
+  unsigned   flags; /**< the FFTW planner flags */
+  UINT4      nthreads; /**< number of threads used by the FFTW plan */
+  LALFFTWPlanCacheEntry *cache; /**< plan cache entry holding the shared FFTW plan */
 };
 
 /**
@@ -138,6 +150,9 @@ tagCOMPLEX16FFTPlan
   INT4       sign; /**< sign in transform exponential, -1 for forward, +1 for reverse */
   UINT4      size; /**< length of the complex data vector for this plan */
   fftw_plan  plan; /**< the FFTW plan */
+  unsigned   flags; /**< the FFTW planner flags */
+  UINT4      nthreads; /**< number of threads used by the FFTW plan */
+  LALFFTWPlanCacheEntry *cache; /**< plan cache entry holding the shared FFTW plan */
 };
 
 /* single- and double-precision routines */
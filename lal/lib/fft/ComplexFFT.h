@@ -40,8 +40,8 @@ extern "C" {
  * #include <lal/ComplexFFT.h>
  * \endcode
  *
- * Perform complex-to-complex fast Fourier transforms of vectors using the
- * package FFTW \cite fj_1998 .
+ * Perform complex-to-complex fast Fourier transforms of vectors, and
+ * sequences of vectors, using the package FFTW \cite fj_1998 .
  *
  */
 /** @{ */
@@ -195,6 +195,28 @@ COMPLEX8FFTPlan * XLALCreateReverseCOMPLEX8FFTPlan( UINT4 size, int measurelvl )
  */
 void XLALDestroyCOMPLEX8FFTPlan( COMPLEX8FFTPlan *plan );
 
+/**
+ * Sets the number of threads used by a COMPLEX8FFTPlan
+ *
+ * The FFTs performed with the plan are executed using \c nthreads
+ * threads.  By default, plans of at least 32768 points use the number of
+ * threads set by XLALFFTWSetNumThreads(), and smaller plans use a single
+ * thread.  Multi-threaded transforms are only worthwhile for large sizes.
+ *
+ * @param[in,out] plan A pointer to the COMPLEX8FFTPlan to be modified.
+ * @param[in] nthreads The number of threads.
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALSetCOMPLEX8FFTPlanNumThreads() function shall fail if:
+ * - [\c XLAL_EFAULT] The plan is a \c NULL pointer.
+ * - [\c XLAL_EINVAL] The plan is invalid, or \c nthreads is 0, or more
+ * than one thread is requested and LAL was not configured with
+ * <tt>--enable-fftw3-threads</tt>.
+ * - [\c XLAL_EFAILED] The call to the underlying FFTW routine failed.
+ * .
+ */
+int XLALSetCOMPLEX8FFTPlanNumThreads( COMPLEX8FFTPlan *plan, UINT4 nthreads );
+
 /**
  * Perform a COMPLEX8Vector to COMPLEX8Vector FFT
  *
@@ -222,6 +244,34 @@ void XLALDestroyCOMPLEX8FFTPlan( COMPLEX8FFTPlan *plan );
  */
 int XLALCOMPLEX8VectorFFT( COMPLEX8Vector * _LAL_RESTRICT_ output, const COMPLEX8Vector * _LAL_RESTRICT_ input, const COMPLEX8FFTPlan *plan );
 
+/**
+ * Perform COMPLEX8Vector to COMPLEX8Vector FFTs of a sequence of vectors
+ *
+ * This routine performs the same transformation as XLALCOMPLEX8VectorFFT()
+ * on each of the vectors of the input sequence, using a single batched
+ * FFTW plan for all of the vectors.  The batched plan is created, with
+ * the measurement level of \c plan, the first time a sequence with a
+ * given number of vectors is transformed, and is then kept in the plan
+ * cache (see XLALFFTWClearPlanCache()).
+ *
+ * @param[out] output The sequence of complex output data vectors Z of length N
+ * @param[in] input The sequence of complex input data vectors z of length N
+ * @param[in] plan The FFT plan of size N to use for the transforms
+ * @note
+ * The input and output sequences must be distinct.
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALCOMPLEX8VectorSequenceFFT() function shall fail if:
+ * - [\c XLAL_EFAULT] A \c NULL pointer is provided as one of the arguments.
+ * - [\c XLAL_EINVAL] A argument is invalid or the input and output data
+ * sequences are the same.
+ * - [\c XLAL_EBADLEN] The input sequence, output sequence, and plan size are
+ * incompatible.
+ * - [\c XLAL_ENOMEM] Insufficient storage space is available.
+ * .
+ */
+int XLALCOMPLEX8VectorSequenceFFT( COMPLEX8VectorSequence * _LAL_RESTRICT_ output, const COMPLEX8VectorSequence * _LAL_RESTRICT_ input, const COMPLEX8FFTPlan *plan );
+
 /*
  *
  * XLAL COMPLEX16 functions
@@ -331,6 +381,28 @@ COMPLEX16FFTPlan * XLALCreateReverseCOMPLEX16FFTPlan( UINT4 size, int measurelvl
  */
 void XLALDestroyCOMPLEX16FFTPlan( COMPLEX16FFTPlan *plan );
 
+/**
+ * Sets the number of threads used by a COMPLEX16FFTPlan
+ *
+ * The FFTs performed with the plan are executed using \c nthreads
+ * threads.  By default, plans of at least 32768 points use the number of
+ * threads set by XLALFFTWSetNumThreads(), and smaller plans use a single
+ * thread.  Multi-threaded transforms are only worthwhile for large sizes.
+ *
+ * @param[in,out] plan A pointer to the COMPLEX16FFTPlan to be modified.
+ * @param[in] nthreads The number of threads.
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALSetCOMPLEX16FFTPlanNumThreads() function shall fail if:
+ * - [\c XLAL_EFAULT] The plan is a \c NULL pointer.
+ * - [\c XLAL_EINVAL] The plan is invalid, or \c nthreads is 0, or more
+ * than one thread is requested and LAL was not configured with
+ * <tt>--enable-fftw3-threads</tt>.
+ * - [\c XLAL_EFAILED] The call to the underlying FFTW routine failed.
+ * .
+ */
+int XLALSetCOMPLEX16FFTPlanNumThreads( COMPLEX16FFTPlan *plan, UINT4 nthreads );
+
 /**
  * Perform a COMPLEX16Vector to COMPLEX16Vector FFT
  *
@@ -358,6 +430,34 @@ void XLALDestroyCOMPLEX16FFTPlan( COMPLEX16FFTPlan *plan );
  */
 int XLALCOMPLEX16VectorFFT( COMPLEX16Vector * _LAL_RESTRICT_ output, const COMPLEX16Vector * _LAL_RESTRICT_ input, const COMPLEX16FFTPlan *plan );
 
+/**
+ * Perform COMPLEX16Vector to COMPLEX16Vector FFTs of a sequence of vectors
+ *
+ * This routine performs the same transformation as XLALCOMPLEX16VectorFFT()
+ * on each of the vectors of the input sequence, using a single batched
+ * FFTW plan for all of the vectors.  The batched plan is created, with
+ * the measurement level of \c plan, the first time a sequence with a
+ * given number of vectors is transformed, and is then kept in the plan
+ * cache (see XLALFFTWClearPlanCache()).
+ *
+ * @param[out] output The sequence of complex output data vectors Z of length N
+ * @param[in] input The sequence of complex input data vectors z of length N
+ * @param[in] plan The FFT plan of size N to use for the transforms
+ * @note
+ * The input and output sequences must be distinct.
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALCOMPLEX16VectorSequenceFFT() function shall fail if:
+ * - [\c XLAL_EFAULT] A \c NULL pointer is provided as one of the arguments.
+ * - [\c XLAL_EINVAL] A argument is invalid or the input and output data
+ * sequences are the same.
+ * - [\c XLAL_EBADLEN] The input sequence, output sequence, and plan size are
+ * incompatible.
+ * - [\c XLAL_ENOMEM] Insufficient storage space is available.
+ * .
+ */
+int XLALCOMPLEX16VectorSequenceFFT( COMPLEX16VectorSequence * _LAL_RESTRICT_ output, const COMPLEX16VectorSequence * _LAL_RESTRICT_ input, const COMPLEX16FFTPlan *plan );
+
 /** @} */
 
 #if 0
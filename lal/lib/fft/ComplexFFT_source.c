@@ -7,39 +7,100 @@
 #ifdef SINGLE_PRECISION
 #define COMPLEX_TYPE COMPLEX8
 #define TYPESUFFIX f
+#define PLAN_KIND LAL_FFTW_PLAN_KIND_DFT_FLOAT
+#define MANY_PLAN_KIND LAL_FFTW_PLAN_KIND_MANY_DFT_FLOAT
 #else
 #define COMPLEX_TYPE COMPLEX16
 #define TYPESUFFIX
+#define PLAN_KIND LAL_FFTW_PLAN_KIND_DFT_DOUBLE
+#define MANY_PLAN_KIND LAL_FFTW_PLAN_KIND_MANY_DFT_DOUBLE
 #endif
 
 #define PLAN_TYPE			CONCAT2(COMPLEX_TYPE,FFTPlan)
 #define COMPLEX_VECTOR_TYPE		CONCAT2(COMPLEX_TYPE,Vector)
+#define COMPLEX_SEQUENCE_TYPE		CONCAT2(COMPLEX_TYPE,VectorSequence)
 
 #define CREATE_PLAN_FUNCTION		CONCAT2(XLALCreate,PLAN_TYPE)
 #define CREATE_FORWARD_PLAN_FUNCTION	CONCAT2(XLALCreateForward,PLAN_TYPE)
 #define CREATE_REVERSE_PLAN_FUNCTION	CONCAT2(XLALCreateReverse,PLAN_TYPE)
 #define DESTROY_PLAN_FUNCTION		CONCAT2(XLALDestroy,PLAN_TYPE)
+#define SET_NUM_THREADS_FUNCTION	CONCAT3(XLALSet,PLAN_TYPE,NumThreads)
+#define CREATE_FFTW_PLAN_FUNCTION	CONCAT2(CreateFFTWPlan,PLAN_TYPE)
+#define DESTROY_FFTW_PLAN_FUNCTION	CONCAT2(DestroyFFTWPlan,PLAN_TYPE)
+#define CREATE_FFTW_MANY_PLAN_FUNCTION	CONCAT2(CreateFFTWManyPlan,PLAN_TYPE)
 #define VECTOR_FFT_FUNCTION		CONCAT3(XLAL,COMPLEX_VECTOR_TYPE,FFT)
+#define SEQUENCE_FFT_FUNCTION		CONCAT3(XLAL,COMPLEX_SEQUENCE_TYPE,FFT)
 
 #define FFTWX				CONCAT2(fftw,TYPESUFFIX)
 #define FFTWX_COMPLEX			CONCAT2(FFTWX,_complex)
+#define FFTWX_PLAN			CONCAT2(FFTWX,_plan)
 #define FFTWX_PLAN_DFT_1D		CONCAT2(FFTWX,_plan_dft_1d)
+#define FFTWX_PLAN_MANY_DFT		CONCAT2(FFTWX,_plan_many_dft)
 #define FFTWX_DESTROY_PLAN		CONCAT2(FFTWX,_destroy_plan)
 #define FFTWX_EXECUTE_DFT		CONCAT2(FFTWX,_execute_dft)
 
-PLAN_TYPE *CREATE_PLAN_FUNCTION(UINT4 size, int fwdflg, int measurelvl)
+/* create the FFTW plan; called by the plan cache with the wisdom lock held */
+static void *CREATE_FFTW_PLAN_FUNCTION(UINT4 size, UINT4 UNUSED howmany, int fwdflg, unsigned flags)
 {
-    PLAN_TYPE *plan;
+    FFTWX_PLAN fftwplan;
     COMPLEX_TYPE *tmp1;
     COMPLEX_TYPE *tmp2;
-    size_t nbytes;
-    int flags;
+    size_t nbytes = size * sizeof(COMPLEX_TYPE);
+
+    /* allocate memory for the temporary arrays */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    tmp1 = XLALMallocAligned(nbytes);
+    tmp2 = XLALMallocAligned(nbytes);
+    if (!tmp1 || !tmp2) {
+        XLALFreeAligned(tmp1);
+        XLALFreeAligned(tmp2);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+#   else
+    tmp1 = XLALMalloc(nbytes);
+    tmp2 = XLALMalloc(nbytes);
+    if (!tmp1 || !tmp2) {
+        XLALFree(tmp1);
+        XLALFree(tmp2);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+#   endif
+
+    /* create plan */
+
+    fftwplan =
+        FFTWX_PLAN_DFT_1D(size, (FFTWX_COMPLEX *) tmp1, (FFTWX_COMPLEX *) tmp2, fwdflg ? FFTW_FORWARD : FFTW_BACKWARD, flags);
+
+    /* free the temporary arrays */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    XLALFreeAligned(tmp1);
+    XLALFreeAligned(tmp2);
+#   else
+    XLALFree(tmp1);
+    XLALFree(tmp2);
+#   endif
+
+    return fftwplan;
+}
+
+/* destroy the FFTW plan; called by the plan cache with the wisdom lock held */
+static void DESTROY_FFTW_PLAN_FUNCTION(void *fftwplan)
+{
+    FFTWX_DESTROY_PLAN((FFTWX_PLAN) fftwplan);
+}
+
+PLAN_TYPE *CREATE_PLAN_FUNCTION(UINT4 size, int fwdflg, int measurelvl)
+{
+    PLAN_TYPE *plan;
+    void *fftwplan = NULL;
+    unsigned flags;
+    UINT4 nthreads;
 
     if (!size)
         XLAL_ERROR_NULL(XLAL_EBADLEN);
 
-    nbytes = size * sizeof(COMPLEX_TYPE);
-
     /* set fftw3 flags to perform requested degree of measurement */
 
 #   ifdef LAL_FFTW3_MEMALIGN_ENABLED
@@ -63,56 +124,30 @@ PLAN_TYPE *CREATE_PLAN_FUNCTION(UINT4 size, int fwdflg, int measurelvl)
         break;
     }
 
-    /* allocate memory for the plan and the temporary arrays */
+    /* allocate memory for the plan */
 
     plan = XLALMalloc(sizeof(*plan));
     if (!plan)
         XLAL_ERROR_NULL(XLAL_ENOMEM);
 
-#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
-    tmp1 = XLALMallocAligned(nbytes);
-    tmp2 = XLALMallocAligned(nbytes);
-    if (!tmp1 || !tmp2) {
-        XLALFreeAligned(tmp1);
-        XLALFreeAligned(tmp2);
-        XLAL_ERROR_NULL(XLAL_ENOMEM);
-    }
-#   else
-    tmp1 = XLALMalloc(nbytes);
-    tmp2 = XLALMalloc(nbytes);
-    if (!tmp1 || !tmp2) {
-        XLALFree(tmp1);
-        XLALFree(tmp2);
-        XLAL_ERROR_NULL(XLAL_ENOMEM);
-    }
-#   endif
-
-    /* establish fftw mutex lock and create plan */
+    /* look up the fftw plan in the plan cache, creating it if needed;
+     * large transforms use the default number of threads */
 
-    LAL_FFTW_WISDOM_LOCK;
-    plan->plan =
-        FFTWX_PLAN_DFT_1D(size, (FFTWX_COMPLEX *) tmp1, (FFTWX_COMPLEX *) tmp2, fwdflg ? FFTW_FORWARD : FFTW_BACKWARD, flags);
-    LAL_FFTW_WISDOM_UNLOCK;
-
-    /* free the temporary arrays */
-
-#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
-    XLALFreeAligned(tmp1);
-    XLALFreeAligned(tmp2);
-#   else
-    XLALFree(tmp1);
-    XLALFree(tmp2);
-#   endif
+    nthreads = XLALFFTWDefaultPlanNumThreads(size);
+    plan->cache = XLALFFTWAcquireCachedPlan(PLAN_KIND, size, 1, fwdflg, flags, nthreads, CREATE_FFTW_PLAN_FUNCTION, DESTROY_FFTW_PLAN_FUNCTION, &fftwplan);
 
     /* check to see success of plan creation */
 
-    if (!plan->plan) {
+    if (!plan->cache) {
         XLALFree(plan);
-        XLAL_ERROR_NULL(XLAL_EFAILED);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
     }
 
     /* set remaining plan fields */
 
+    plan->plan = (FFTWX_PLAN) fftwplan;
+    plan->flags = flags;
+    plan->nthreads = nthreads;
     plan->size = size;
     plan->sign = (fwdflg ? -1 : 1);
 
@@ -140,16 +175,42 @@ PLAN_TYPE *CREATE_REVERSE_PLAN_FUNCTION(UINT4 size, int measurelvl)
 void DESTROY_PLAN_FUNCTION(PLAN_TYPE * plan)
 {
     if (plan) {
-        if (plan->plan) {
-            LAL_FFTW_WISDOM_LOCK;
-            FFTWX_DESTROY_PLAN(plan->plan);
-            LAL_FFTW_WISDOM_UNLOCK;
-        }
+        /* the fftw plan itself is retained by the plan cache */
+        XLALFFTWReleaseCachedPlan(plan->cache);
         memset(plan, 0, sizeof(*plan));
         XLALFree(plan);
     }
 }
 
+int SET_NUM_THREADS_FUNCTION(PLAN_TYPE * plan, UINT4 nthreads)
+{
+    LALFFTWPlanCacheEntry *cache;
+    void *fftwplan = NULL;
+
+    if (!plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!nthreads)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (nthreads == plan->nthreads)
+        return 0;
+
+    /* look up the fftw plan for the new number of threads in the plan
+     * cache, creating it if needed, then release the old fftw plan */
+
+    cache = XLALFFTWAcquireCachedPlan(PLAN_KIND, plan->size, 1, plan->sign == -1, plan->flags, nthreads, CREATE_FFTW_PLAN_FUNCTION, DESTROY_FFTW_PLAN_FUNCTION, &fftwplan);
+    if (!cache)
+        XLAL_ERROR(XLAL_EFUNC);
+    XLALFFTWReleaseCachedPlan(plan->cache);
+
+    plan->cache = cache;
+    plan->plan = (FFTWX_PLAN) fftwplan;
+    plan->nthreads = nthreads;
+
+    return 0;
+}
+
 int VECTOR_FFT_FUNCTION(COMPLEX_VECTOR_TYPE * _LAL_RESTRICT_ output, const COMPLEX_VECTOR_TYPE * _LAL_RESTRICT_ input,
     const PLAN_TYPE * plan)
 {
@@ -209,6 +270,130 @@ int VECTOR_FFT_FUNCTION(COMPLEX_VECTOR_TYPE * _LAL_RESTRICT_ output, const COMPL
     return 0;
 }
 
+/* create a batched fftw plan; called by the plan cache with the wisdom lock held */
+static void *CREATE_FFTW_MANY_PLAN_FUNCTION(UINT4 size, UINT4 howmany, int fwdflg, unsigned flags)
+{
+    FFTWX_PLAN fftwplan;
+    COMPLEX_TYPE *tmp1;
+    COMPLEX_TYPE *tmp2;
+    int n = size;
+    size_t nbytes = (size_t) howmany * size * sizeof(COMPLEX_TYPE);
+
+    /* allocate memory for the temporary arrays */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    tmp1 = XLALMallocAligned(nbytes);
+    tmp2 = XLALMallocAligned(nbytes);
+    if (!tmp1 || !tmp2) {
+        XLALFreeAligned(tmp1);
+        XLALFreeAligned(tmp2);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+#   else
+    tmp1 = XLALMalloc(nbytes);
+    tmp2 = XLALMalloc(nbytes);
+    if (!tmp1 || !tmp2) {
+        XLALFree(tmp1);
+        XLALFree(tmp2);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+#   endif
+
+    /* create plan */
+
+    fftwplan =
+        FFTWX_PLAN_MANY_DFT(1, &n, howmany, (FFTWX_COMPLEX *) tmp1, NULL, 1, n, (FFTWX_COMPLEX *) tmp2, NULL, 1, n, fwdflg ? FFTW_FORWARD : FFTW_BACKWARD, flags);
+
+    /* free the temporary arrays */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    XLALFreeAligned(tmp1);
+    XLALFreeAligned(tmp2);
+#   else
+    XLALFree(tmp1);
+    XLALFree(tmp2);
+#   endif
+
+    return fftwplan;
+}
+
+int SEQUENCE_FFT_FUNCTION(COMPLEX_SEQUENCE_TYPE * _LAL_RESTRICT_ output, const COMPLEX_SEQUENCE_TYPE * _LAL_RESTRICT_ input,
+    const PLAN_TYPE * plan)
+{
+    LALFFTWPlanCacheEntry *cache;
+    void *fftwplan = NULL;
+    COMPLEX_TYPE *input_data;
+    COMPLEX_TYPE *output_data;
+
+    /* sanity check on arguments */
+
+    if (!output || !input || !plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!output->data || !input->data || output->data == input->data)
+        XLAL_ERROR(XLAL_EINVAL);        /* note: must be out-of-place */
+    if (output->vectorLength != plan->size || input->vectorLength != plan->size || output->length != input->length)
+        XLAL_ERROR(XLAL_EBADLEN);
+    if (input->length > INT_MAX)
+        XLAL_ERROR(XLAL_EBADLEN, "Number of transforms %u exceeds the FFTW limit %i", input->length, INT_MAX);
+    if (!input->length)
+        return 0;
+
+    /* look up the batched fftw plan in the plan cache, creating it if needed */
+
+    cache = XLALFFTWAcquireCachedPlan(MANY_PLAN_KIND, plan->size, input->length, plan->sign == -1, plan->flags, plan->nthreads, CREATE_FFTW_MANY_PLAN_FUNCTION, DESTROY_FFTW_PLAN_FUNCTION, &fftwplan);
+    if (!cache)
+        XLAL_ERROR(XLAL_EFUNC);
+
+    input_data = input->data;
+    output_data = output->data;
+
+    /* if memory alignment is required, check memory alignment and create
+     * temporary space if necessary */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    size_t nbytes = (size_t) input->length * plan->size * sizeof(COMPLEX_TYPE);
+    if (!LAL_IS_MEMORY_ALIGNED(input_data)) {
+        input_data = XLALMallocAligned(nbytes);
+        if (!input_data) {
+            XLALFFTWReleaseCachedPlan(cache);
+            XLAL_ERROR(XLAL_ENOMEM);
+        }
+        memcpy(input_data, input->data, nbytes);
+    }
+    if (!LAL_IS_MEMORY_ALIGNED(output_data)) {
+        output_data = XLALMallocAligned(nbytes);
+        if (!output_data) {
+            if (input_data != input->data)
+                XLALFreeAligned(input_data);
+            XLALFFTWReleaseCachedPlan(cache);
+            XLAL_ERROR(XLAL_ENOMEM);
+        }
+    }
+#   endif
+
+    /* perform all the ffts */
+
+    FFTWX_EXECUTE_DFT((FFTWX_PLAN) fftwplan, (FFTWX_COMPLEX *)input_data, (FFTWX_COMPLEX *)output_data);
+
+    /* cleanup aligned memory space if memory alignment is required;
+     * copy data from temporary space to output sequence */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    if (input_data != input->data)
+        XLALFreeAligned(input_data);
+    if (output_data != output->data) {
+        memcpy(output->data, output_data, nbytes);
+        XLALFreeAligned(output_data);
+    }
+#   endif
+
+    XLALFFTWReleaseCachedPlan(cache);
+
+    return 0;
+}
+
 #undef CONCAT2x
 #undef CONCAT2
 #undef CONCAT3x
@@ -217,18 +402,28 @@ int VECTOR_FFT_FUNCTION(COMPLEX_VECTOR_TYPE * _LAL_RESTRICT_ output, const COMPL
 
 #undef COMPLEX_TYPE
 #undef TYPESUFFIX
+#undef PLAN_KIND
+#undef MANY_PLAN_KIND
 
 #undef PLAN_TYPE
 #undef COMPLEX_VECTOR_TYPE
+#undef COMPLEX_SEQUENCE_TYPE
 
 #undef CREATE_PLAN_FUNCTION
 #undef CREATE_FORWARD_PLAN_FUNCTION
 #undef CREATE_REVERSE_PLAN_FUNCTION
 #undef DESTROY_PLAN_FUNCTION
+#undef SET_NUM_THREADS_FUNCTION
+#undef CREATE_FFTW_PLAN_FUNCTION
+#undef DESTROY_FFTW_PLAN_FUNCTION
+#undef CREATE_FFTW_MANY_PLAN_FUNCTION
 #undef VECTOR_FFT_FUNCTION
+#undef SEQUENCE_FFT_FUNCTION
 
 #undef FFTWX
 #undef FFTWX_COMPLEX
+#undef FFTWX_PLAN
 #undef FFTWX_PLAN_DFT_1D
+#undef FFTWX_PLAN_MANY_DFT
 #undef FFTWX_DESTROY_PLAN
 #undef FFTWX_EXECUTE_DFT
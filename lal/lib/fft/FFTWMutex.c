@@ -17,13 +17,305 @@
 *  MA  02111-1307  USA
 */
 
+#include <config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <limits.h>
+
 #include <lal/FFTWMutex.h>
+#include <lal/RealFFT.h>
+#include <lal/ComplexFFT.h>
+#include <lal/XLALError.h>
+#include <lal/LALError.h>
 
 #if defined(LAL_PTHREAD_LOCK) && defined(LAL_FFTW3_ENABLED)
 #include <pthread.h>
 static pthread_mutex_t lalFFTWMutex = PTHREAD_MUTEX_INITIALIZER;
 #endif
 
+#if defined(LAL_FFTW3_ENABLED)
+#include <fftw3.h>
+#include "FFTWPlanCache.h"
+
+/*
+ * Plan cache entries are looked up without taking any lock, using atomic
+ * loads of the hash bucket heads and atomic reference counts.  If the
+ * compiler does not provide atomic builtins, lookups and releases fall back
+ * to taking the FFTW wisdom lock.
+ */
+#if !defined(LAL_PTHREAD_LOCK)
+#define PLAN_CACHE_LOCKFREE 1
+#define PLAN_CACHE_LOAD(p)		(*(p))
+#define PLAN_CACHE_STORE(p,v)		(*(p) = (v))
+#define PLAN_CACHE_ADD(p,v)		(*(p) += (v))
+#define PLAN_CACHE_SUB(p,v)		(*(p) -= (v))
+#define PLAN_CACHE_CAS(p,e,v)		(*(p) == *(e) ? (*(p) = (v), 1) : (*(e) = *(p), 0))
+#elif defined(__GNUC__)
+#define PLAN_CACHE_LOCKFREE 1
+#define PLAN_CACHE_LOAD(p)		__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define PLAN_CACHE_STORE(p,v)		__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define PLAN_CACHE_ADD(p,v)		__atomic_add_fetch((p), (v), __ATOMIC_RELAXED)
+#define PLAN_CACHE_SUB(p,v)		__atomic_sub_fetch((p), (v), __ATOMIC_ACQ_REL)
+#define PLAN_CACHE_CAS(p,e,v)		__atomic_compare_exchange_n((p), (e), (v), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#else
+#define PLAN_CACHE_LOCKFREE 0
+#define PLAN_CACHE_LOAD(p)		(*(p))
+#define PLAN_CACHE_STORE(p,v)		(*(p) = (v))
+#define PLAN_CACHE_ADD(p,v)		(*(p) += (v))
+#define PLAN_CACHE_SUB(p,v)		(*(p) -= (v))
+#define PLAN_CACHE_CAS(p,e,v)		(*(p) == *(e) ? (*(p) = (v), 1) : (*(e) = *(p), 0))
+#endif
+
+/* number of hash buckets in the plan cache */
+#define PLAN_CACHE_NBUCKETS 256
+
+/* maximum number of cached FFTW plans not referenced by any LAL plan */
+#define PLAN_CACHE_MAX_IDLE 64
+
+/* smallest transform size to which the default number of threads applies */
+#define PLAN_THREADS_MIN_SIZE 32768
+
+/*
+ * An entry in the plan cache.  The key fields and the next pointer are
+ * written once, with the wisdom lock held, before the entry is published in
+ * its hash bucket; they are immutable afterwards until the entry is removed
+ * by XLALFFTWClearPlanCache().  When the least recently used unreferenced
+ * FFTW plans are evicted, the entry stays in its bucket with a reference
+ * count of -1 and no FFTW plan, and a later acquire creates the plan again.
+ * The FFTW plan is only written with the wisdom lock held while the
+ * reference count is -1.
+ */
+struct tagLALFFTWPlanCacheEntry {
+  LALFFTWPlanCacheEntry *next;		/* next entry in the same hash bucket */
+  int kind;				/* kind of FFTW plan */
+  UINT4 size;				/* size of the transform */
+  UINT4 howmany;			/* number of transforms */
+  int fwdflg;				/* non-zero for forward plans */
+  unsigned flags;			/* FFTW planner flags */
+  UINT4 nthreads;			/* number of threads used by the FFTW plan */
+  void *fftwplan;			/* the shared FFTW plan */
+  LALFFTWPlanDestroyFunc destroy;	/* function which destroys the FFTW plan */
+  int refcount;				/* number of LAL plans referencing this entry, or -1 if the FFTW plan has been evicted */
+  UINT8 lastuse;			/* value of lalFFTWPlanCacheClock when the entry was last released */
+};
+
+/* hash buckets of the plan cache; only modified with the wisdom lock held */
+static LALFFTWPlanCacheEntry *lalFFTWPlanCache[PLAN_CACHE_NBUCKETS];
+
+/* counter used to order releases of cache entries, for evicting the least recently used */
+static UINT8 lalFFTWPlanCacheClock = 0;
+
+#if defined(LAL_FFTW3_THREADS_ENABLED)
+/* default number of threads for large transforms; zero until initialised from LAL_FFTW_NUM_THREADS */
+static UINT4 lalFFTWNumThreads = 0;
+
+/*
+ * whether the FFTW threads libraries have been initialised: 0 if not yet,
+ * 1 if successfully, -1 if initialisation failed; only accessed with the
+ * wisdom lock held
+ */
+static int lalFFTWThreadsInitialised = 0;
+#endif
+
+/*
+ * initialise the FFTW threads libraries, if needed; must be called with the
+ * wisdom lock held.  Returns whether multi-threaded plans can be created;
+ * if the libraries cannot be initialised, all plans are single-threaded.
+ */
+static int PlanCacheInitThreads(void)
+{
+#if defined(LAL_FFTW3_THREADS_ENABLED)
+  if (lalFFTWThreadsInitialised == 0) {
+    if (fftw_init_threads() && fftwf_init_threads()) {
+      lalFFTWThreadsInitialised = 1;
+    } else {
+      XLAL_PRINT_WARNING("Could not initialise the FFTW threads libraries; FFT plans will use 1 thread");
+      lalFFTWThreadsInitialised = -1;
+    }
+  }
+  return lalFFTWThreadsInitialised > 0;
+#else
+  return 0;
+#endif
+}
+
+static UINT4 PlanCacheBucket(int kind, UINT4 size, UINT4 howmany, int fwdflg, unsigned flags, UINT4 nthreads)
+{
+  UINT4 h = size * 2654435761u;
+  h ^= howmany * 0xc2b2ae35u;
+  h ^= nthreads * 0x27d4eb2fu;
+  h ^= ((((UINT4)kind) << 1) | (fwdflg ? 1u : 0u)) * 0x9e3779b9u;
+  h ^= ((UINT4)flags) * 0x85ebca6bu;
+  h ^= h >> 16;
+  return h % PLAN_CACHE_NBUCKETS;
+}
+
+/* add a reference to an entry, unless its FFTW plan has been evicted */
+static int PlanCacheTryRef(LALFFTWPlanCacheEntry *entry)
+{
+  int refcount = PLAN_CACHE_LOAD(&entry->refcount);
+  while (refcount >= 0) {
+    if (PLAN_CACHE_CAS(&entry->refcount, &refcount, refcount + 1)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/*
+ * Destroy the least recently released unreferenced FFTW plans, until fewer
+ * than PLAN_CACHE_MAX_IDLE remain; must be called with the wisdom lock held.
+ * An entry is only evicted if its reference count can be changed from 0 to
+ * -1, so that a concurrent lock-free acquire either references the entry
+ * first, or sees that its FFTW plan has been evicted.
+ */
+static void PlanCacheEvictIdle(void)
+{
+  while (1) {
+    UINT4 nidle = 0;
+    LALFFTWPlanCacheEntry *oldest = NULL;
+    UINT8 oldest_lastuse = 0;
+    for (int i = 0; i < PLAN_CACHE_NBUCKETS; ++i) {
+      for (LALFFTWPlanCacheEntry *entry = lalFFTWPlanCache[i]; entry != NULL; entry = entry->next) {
+        if (PLAN_CACHE_LOAD(&entry->refcount) == 0) {
+          const UINT8 lastuse = PLAN_CACHE_LOAD(&entry->lastuse);
+          if (oldest == NULL || lastuse < oldest_lastuse) {
+            oldest = entry;
+            oldest_lastuse = lastuse;
+          }
+          ++nidle;
+        }
+      }
+    }
+    if (nidle < PLAN_CACHE_MAX_IDLE) {
+      return;
+    }
+    int refcount = 0;
+    if (PLAN_CACHE_CAS(&oldest->refcount, &refcount, -1)) {
+      oldest->destroy(oldest->fftwplan);
+      oldest->fftwplan = NULL;
+    }
+  }
+}
+
+static LALFFTWPlanCacheEntry *PlanCacheFind(UINT4 bucket, int kind, UINT4 size, UINT4 howmany, int fwdflg, unsigned flags, UINT4 nthreads)
+{
+  for (LALFFTWPlanCacheEntry *entry = PLAN_CACHE_LOAD(&lalFFTWPlanCache[bucket]); entry != NULL; entry = entry->next) {
+    if (entry->kind == kind && entry->size == size && entry->howmany == howmany && entry->fwdflg == fwdflg && entry->flags == flags && entry->nthreads == nthreads) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+LALFFTWPlanCacheEntry *XLALFFTWAcquireCachedPlan(int kind, UINT4 size, UINT4 howmany, int fwdflg, unsigned flags, UINT4 nthreads,
+                                                 LALFFTWPlanCreateFunc create, LALFFTWPlanDestroyFunc destroy,
+                                                 void **fftwplan)
+{
+  XLAL_CHECK_NULL(size > 0 && howmany > 0, XLAL_EBADLEN);
+  XLAL_CHECK_NULL(create != NULL && destroy != NULL && fftwplan != NULL, XLAL_EFAULT);
+#if defined(LAL_FFTW3_THREADS_ENABLED)
+  XLAL_CHECK_NULL(nthreads > 0, XLAL_EINVAL);
+#else
+  XLAL_CHECK_NULL(nthreads == 1, XLAL_EINVAL, "Multi-threaded FFTW plans require LAL to be configured with --enable-fftw3-threads");
+#endif
+  fwdflg = fwdflg ? 1 : 0;
+  const UINT4 bucket = PlanCacheBucket(kind, size, howmany, fwdflg, flags, nthreads);
+  LALFFTWPlanCacheEntry *entry;
+
+#if PLAN_CACHE_LOCKFREE
+  /* fast path: plan is already cached */
+  entry = PlanCacheFind(bucket, kind, size, howmany, fwdflg, flags, nthreads);
+  if (entry != NULL && PlanCacheTryRef(entry)) {
+    *fftwplan = entry->fftwplan;
+    return entry;
+  }
+#endif
+
+  /* slow path: look again with the lock held, and create the plan if another thread has not */
+  LAL_FFTW_WISDOM_LOCK;
+  entry = PlanCacheFind(bucket, kind, size, howmany, fwdflg, flags, nthreads);
+  if (entry != NULL && PlanCacheTryRef(entry)) {
+    *fftwplan = entry->fftwplan;
+    LAL_FFTW_WISDOM_UNLOCK;
+    return entry;
+  }
+  PlanCacheEvictIdle();
+  int isnew = 0;
+  if (entry == NULL) {
+    entry = calloc(1, sizeof(*entry));
+    if (entry == NULL) {
+      LAL_FFTW_WISDOM_UNLOCK;
+      XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+    entry->kind = kind;
+    entry->size = size;
+    entry->howmany = howmany;
+    entry->fwdflg = fwdflg;
+    entry->flags = flags;
+    entry->nthreads = nthreads;
+    entry->destroy = destroy;
+    isnew = 1;
+  }
+
+  /* create the FFTW plan of a new entry, or of an entry whose plan has been evicted */
+#if defined(LAL_FFTW3_THREADS_ENABLED)
+  /* the number of threads is global planner state, protected by the wisdom lock */
+  const int threaded = PlanCacheInitThreads();
+  if (threaded) {
+    fftw_plan_with_nthreads(nthreads);
+    fftwf_plan_with_nthreads(nthreads);
+  }
+#endif
+  entry->fftwplan = create(size, howmany, fwdflg, flags);
+#if defined(LAL_FFTW3_THREADS_ENABLED)
+  if (threaded) {
+    fftw_plan_with_nthreads(1);
+    fftwf_plan_with_nthreads(1);
+  }
+#endif
+  if (entry->fftwplan == NULL) {
+    LAL_FFTW_WISDOM_UNLOCK;
+    if (isnew) {
+      free(entry);
+    }
+    XLAL_ERROR_NULL(XLAL_EFAILED, "Could not create FFTW plan of %u transforms of size %u", howmany, size);
+  }
+  *fftwplan = entry->fftwplan;
+  PLAN_CACHE_STORE(&entry->refcount, 1);
+  if (isnew) {
+    entry->next = lalFFTWPlanCache[bucket];
+    PLAN_CACHE_STORE(&lalFFTWPlanCache[bucket], entry);
+  }
+  LAL_FFTW_WISDOM_UNLOCK;
+
+  return entry;
+}
+
+void XLALFFTWReleaseCachedPlan(LALFFTWPlanCacheEntry *entry)
+{
+  if (entry != NULL) {
+#if !PLAN_CACHE_LOCKFREE
+    LAL_FFTW_WISDOM_LOCK;
+#endif
+    if (PLAN_CACHE_SUB(&entry->refcount, 1) == 0) {
+      PLAN_CACHE_STORE(&entry->lastuse, PLAN_CACHE_ADD(&lalFFTWPlanCacheClock, 1));
+    }
+#if !PLAN_CACHE_LOCKFREE
+    LAL_FFTW_WISDOM_UNLOCK;
+#endif
+  }
+}
+
+UINT4 XLALFFTWDefaultPlanNumThreads(UINT4 size)
+{
+  return (size >= PLAN_THREADS_MIN_SIZE) ? XLALFFTWGetNumThreads() : 1;
+}
+
+#endif /* defined(LAL_FFTW3_ENABLED) */
+
 
 /**
  * Aquire LAL's FFTW wisdom lock.  This lock must be held when creating or
@@ -55,3 +347,230 @@ void XLALFFTWWisdomUnlock(void)
     pthread_mutex_unlock( &lalFFTWMutex );
 #endif
 }
+
+
+/**
+ * \brief Destroy all cached FFTW plans which are not referenced by any LAL
+ * FFT plan.
+ *
+ * The FFTW implementations of the REAL4, REAL8, COMPLEX8 and COMPLEX16 FFT
+ * plan functions share FFTW plans through a process-wide cache, keyed on
+ * the type, size, direction, measurement level and number of threads of the
+ * plan. Up to 64 cached plans
+ * are retained after the last LAL plan using them is destroyed, so that
+ * creating a plan of a previously used size does not replan, nor take any
+ * lock; beyond that, the least recently used unreferenced plans are
+ * destroyed when new plans are created. This function releases the memory
+ * held by all unused cached plans.
+ *
+ * This function must not be called while other threads are creating or
+ * destroying FFT plans. It is a no-op if LAL has been compiled with an FFT
+ * backend other than FFTW.
+ */
+void XLALFFTWClearPlanCache(void)
+{
+#if defined(LAL_FFTW3_ENABLED)
+    LAL_FFTW_WISDOM_LOCK;
+    for (int i = 0; i < PLAN_CACHE_NBUCKETS; ++i) {
+        LALFFTWPlanCacheEntry **link = &lalFFTWPlanCache[i];
+        while (*link != NULL) {
+            LALFFTWPlanCacheEntry *entry = *link;
+            const int refcount = PLAN_CACHE_LOAD(&entry->refcount);
+            if (refcount > 0) {
+                link = &entry->next;
+                continue;
+            }
+            *link = entry->next;
+            if (refcount == 0) {
+                entry->destroy(entry->fftwplan);
+            }
+            free(entry);
+        }
+    }
+    LAL_FFTW_WISDOM_UNLOCK;
+#endif
+}
+
+
+/**
+ * \brief Set the number of threads with which new FFT plans of large
+ * transforms are created.
+ *
+ * FFT plans of at least 32768 points created after this call execute each
+ * transform using \a nthreads threads; smaller transforms seldom benefit
+ * from threads and remain single-threaded.  The number of threads of an
+ * individual plan can be changed with e.g. XLALSetREAL4FFTPlanNumThreads().
+ * The initial value is read from the environment variable
+ * <tt>LAL_FFTW_NUM_THREADS</tt>, and is 1 if it is not set
+ * or cannot be parsed.
+ *
+ * It is an error to request more than one thread unless LAL has been
+ * configured with <tt>--enable-fftw3-threads</tt>.  If the FFTW threads
+ * libraries cannot be initialised, a warning is printed and all plans are
+ * single-threaded.
+ */
+int XLALFFTWSetNumThreads(UINT4 nthreads)
+{
+    XLAL_CHECK(nthreads > 0, XLAL_EINVAL);
+#if defined(LAL_FFTW3_THREADS_ENABLED)
+    LAL_FFTW_WISDOM_LOCK;
+    PLAN_CACHE_STORE(&lalFFTWNumThreads, nthreads);
+    LAL_FFTW_WISDOM_UNLOCK;
+#else
+    XLAL_CHECK(nthreads == 1, XLAL_EINVAL, "Multi-threaded FFTW plans require LAL to be configured with --enable-fftw3-threads");
+#endif
+    return XLAL_SUCCESS;
+}
+
+
+/**
+ * \brief Return the number of threads with which new FFT plans of large
+ * transforms are created; see XLALFFTWSetNumThreads().
+ */
+UINT4 XLALFFTWGetNumThreads(void)
+{
+#if defined(LAL_FFTW3_THREADS_ENABLED)
+    UINT4 nthreads = PLAN_CACHE_LOAD(&lalFFTWNumThreads);
+    if (nthreads == 0) {
+        LAL_FFTW_WISDOM_LOCK;
+        nthreads = lalFFTWNumThreads;
+        if (nthreads == 0) {
+            nthreads = 1;
+            const char *env = getenv("LAL_FFTW_NUM_THREADS");
+            if (env != NULL && *env != '\0') {
+                char *end;
+                const long n = strtol(env, &end, 10);
+                if (*end != '\0' || n <= 0 || n > INT_MAX) {
+                    XLAL_PRINT_WARNING("Could not parse LAL_FFTW_NUM_THREADS='%s'; using 1 thread", env);
+                } else {
+                    nthreads = (UINT4) n;
+                }
+            }
+            PLAN_CACHE_STORE(&lalFFTWNumThreads, nthreads);
+        }
+        LAL_FFTW_WISDOM_UNLOCK;
+    }
+    return nthreads;
+#else
+    return 1;
+#endif
+}
+
+
+/**
+ * \brief Create forward and reverse FFT plans for the given sizes, so that
+ * later calls to the plan creation functions find them in the plan cache.
+ *
+ * \param [in] sizes Sizes of the FFT plans to create
+ * \param [in] types Bitwise-or of ::LALFFTWPlanType values selecting which
+ * types of FFT plans to create
+ * \param [in] measurelvl Measurement level for plan creation, as for e.g.
+ * XLALCreateREAL4FFTPlan()
+ *
+ * Typically called once at startup, after XLALFFTWImportWisdomFromFilename(),
+ * with the sizes which a multi-threaded analysis will need. With an FFT
+ * backend other than FFTW, plans are created and destroyed but not cached.
+ */
+int XLALFFTWPrewarmPlanCache(const UINT4Vector *sizes, int types, int measurelvl)
+{
+    XLAL_CHECK(sizes != NULL && (sizes->length == 0 || sizes->data != NULL), XLAL_EFAULT);
+    XLAL_CHECK((types & ~LAL_FFTW_PLAN_ALL) == 0, XLAL_EINVAL, "Invalid plan types %i", types);
+    for (UINT4 i = 0; i < sizes->length; ++i) {
+        for (int fwdflg = 0; fwdflg < 2; ++fwdflg) {
+            if (types & LAL_FFTW_PLAN_REAL4) {
+                REAL4FFTPlan *plan = XLALCreateREAL4FFTPlan(sizes->data[i], fwdflg, measurelvl);
+                XLAL_CHECK(plan != NULL, XLAL_EFUNC);
+                XLALDestroyREAL4FFTPlan(plan);
+            }
+            if (types & LAL_FFTW_PLAN_REAL8) {
+                REAL8FFTPlan *plan = XLALCreateREAL8FFTPlan(sizes->data[i], fwdflg, measurelvl);
+                XLAL_CHECK(plan != NULL, XLAL_EFUNC);
+                XLALDestroyREAL8FFTPlan(plan);
+            }
+            if (types & LAL_FFTW_PLAN_COMPLEX8) {
+                COMPLEX8FFTPlan *plan = XLALCreateCOMPLEX8FFTPlan(sizes->data[i], fwdflg, measurelvl);
+                XLAL_CHECK(plan != NULL, XLAL_EFUNC);
+                XLALDestroyCOMPLEX8FFTPlan(plan);
+            }
+            if (types & LAL_FFTW_PLAN_COMPLEX16) {
+                COMPLEX16FFTPlan *plan = XLALCreateCOMPLEX16FFTPlan(sizes->data[i], fwdflg, measurelvl);
+                XLAL_CHECK(plan != NULL, XLAL_EFUNC);
+                XLALDestroyCOMPLEX16FFTPlan(plan);
+            }
+        }
+    }
+    return XLAL_SUCCESS;
+}
+
+
+/**
+ * \brief Import single- and double-precision FFTW wisdom from a file.
+ *
+ * The file may contain double-precision wisdom, single-precision wisdom,
+ * or double- followed by single-precision wisdom, as written by
+ * XLALFFTWExportWisdomToFilename() or by the \c fftw-wisdom and
+ * \c fftwf-wisdom utilities. Importing wisdom before creating plans with a
+ * measurement level greater than zero avoids repeating the measurements.
+ *
+ * It is an error if no wisdom could be imported, or if LAL has been
+ * compiled with an FFT backend other than FFTW.
+ */
+int XLALFFTWImportWisdomFromFilename(const char *filename)
+{
+    XLAL_CHECK(filename != NULL, XLAL_EFAULT);
+#if defined(LAL_FFTW3_ENABLED)
+    FILE *fp = fopen(filename, "r");
+    XLAL_CHECK(fp != NULL, XLAL_EIO, "Could not open FFTW wisdom file '%s'", filename);
+    int have_double, have_single = 0;
+    LAL_FFTW_WISDOM_LOCK;
+    PlanCacheInitThreads();
+    have_double = fftw_import_wisdom_from_file(fp);
+    if (!have_double) {
+        /* file may contain only single-precision wisdom */
+        rewind(fp);
+        have_single = fftwf_import_wisdom_from_file(fp);
+    } else {
+        /* import any single-precision wisdom which follows */
+        int c;
+        while ((c = fgetc(fp)) != EOF && isspace(c))
+            ;
+        if (c != EOF) {
+            ungetc(c, fp);
+            have_single = fftwf_import_wisdom_from_file(fp);
+        }
+    }
+    LAL_FFTW_WISDOM_UNLOCK;
+    fclose(fp);
+    XLAL_CHECK(have_double || have_single, XLAL_EFAILED, "Could not import FFTW wisdom from file '%s'", filename);
+    return XLAL_SUCCESS;
+#else
+    XLAL_ERROR(XLAL_EFAILED, "FFTW wisdom requires LAL to be compiled with the FFTW backend");
+#endif
+}
+
+
+/**
+ * \brief Export double- followed by single-precision FFTW wisdom to a file,
+ * for later use with XLALFFTWImportWisdomFromFilename().
+ *
+ * It is an error if LAL has been compiled with an FFT backend other than
+ * FFTW.
+ */
+int XLALFFTWExportWisdomToFilename(const char *filename)
+{
+    XLAL_CHECK(filename != NULL, XLAL_EFAULT);
+#if defined(LAL_FFTW3_ENABLED)
+    FILE *fp = fopen(filename, "w");
+    XLAL_CHECK(fp != NULL, XLAL_EIO, "Could not open FFTW wisdom file '%s'", filename);
+    LAL_FFTW_WISDOM_LOCK;
+    PlanCacheInitThreads();
+    fftw_export_wisdom_to_file(fp);
+    fftwf_export_wisdom_to_file(fp);
+    LAL_FFTW_WISDOM_UNLOCK;
+    int errnum = ferror(fp);
+    XLAL_CHECK(fclose(fp) == 0 && errnum == 0, XLAL_EIO, "Could not write FFTW wisdom file '%s'", filename);
+    return XLAL_SUCCESS;
+#else
+    XLAL_ERROR(XLAL_EFAILED, "FFTW wisdom requires LAL to be compiled with the FFTW backend");
+#endif
+}
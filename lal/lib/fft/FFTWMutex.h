@@ -21,6 +21,7 @@
 #define _FFTWMUTEX_H
 
 #include <lal/LALConfig.h>
+#include <lal/LALDatatypes.h>
 
 #ifdef  __cplusplus
 extern "C" {
@@ -29,6 +30,22 @@ extern "C" {
 void XLALFFTWWisdomLock(void);
 void XLALFFTWWisdomUnlock(void);
 
+/** Types of FFT plan, for XLALFFTWPrewarmPlanCache() */
+typedef enum tagLALFFTWPlanType {
+  LAL_FFTW_PLAN_REAL4     = 0x1,	/**< #REAL4FFTPlan */
+  LAL_FFTW_PLAN_REAL8     = 0x2,	/**< #REAL8FFTPlan */
+  LAL_FFTW_PLAN_COMPLEX8  = 0x4,	/**< #COMPLEX8FFTPlan */
+  LAL_FFTW_PLAN_COMPLEX16 = 0x8,	/**< #COMPLEX16FFTPlan */
+  LAL_FFTW_PLAN_ALL       = 0xF		/**< All types of FFT plan */
+} LALFFTWPlanType;
+
+void XLALFFTWClearPlanCache(void);
+int XLALFFTWSetNumThreads(UINT4 nthreads);
+UINT4 XLALFFTWGetNumThreads(void);
+int XLALFFTWPrewarmPlanCache(const UINT4Vector *sizes, int types, int measurelvl);
+int XLALFFTWImportWisdomFromFilename(const char *filename);
+int XLALFFTWExportWisdomToFilename(const char *filename);
+
 #if defined(LAL_PTHREAD_LOCK) && defined(LAL_FFTW3_ENABLED)
 # define LAL_FFTW_WISDOM_LOCK XLALFFTWWisdomLock()
 # define LAL_FFTW_WISDOM_UNLOCK XLALFFTWWisdomUnlock()
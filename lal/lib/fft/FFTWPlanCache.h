@@ -0,0 +1,84 @@
+// Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with with program; see the file COPYING. If not, write to the
+//  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+//  MA  02111-1307  USA
+
+#ifndef _FFTWPLANCACHE_H
+#define _FFTWPLANCACHE_H
+
+/*
+ * Internal interface to the process-wide FFTW plan cache implemented in
+ * FFTWMutex.c; used by the FFTW implementations of RealFFT and ComplexFFT.
+ * Not installed.
+ */
+
+#include <lal/LALDatatypes.h>
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/* kinds of FFTW plan held in the cache; part of the cache key */
+enum tagLALFFTWPlanKind {
+  LAL_FFTW_PLAN_KIND_R2R_FLOAT,
+  LAL_FFTW_PLAN_KIND_R2R_DOUBLE,
+  LAL_FFTW_PLAN_KIND_DFT_FLOAT,
+  LAL_FFTW_PLAN_KIND_DFT_DOUBLE,
+  LAL_FFTW_PLAN_KIND_MANY_R2C_FLOAT,
+  LAL_FFTW_PLAN_KIND_MANY_R2C_DOUBLE,
+  LAL_FFTW_PLAN_KIND_MANY_DFT_FLOAT,
+  LAL_FFTW_PLAN_KIND_MANY_DFT_DOUBLE,
+};
+
+/* create an FFTW plan of howmany transforms; called with the FFTW wisdom lock held */
+typedef void *(*LALFFTWPlanCreateFunc)(UINT4 size, UINT4 howmany, int fwdflg, unsigned flags);
+
+/* destroy an FFTW plan; called with the FFTW wisdom lock held */
+typedef void (*LALFFTWPlanDestroyFunc)(void *fftwplan);
+
+/* opaque cache entry; holds one shared FFTW plan and its reference count */
+typedef struct tagLALFFTWPlanCacheEntry LALFFTWPlanCacheEntry;
+
+/*
+ * Return a reference to the cached FFTW plan for (kind, size, howmany,
+ * fwdflg, flags, nthreads), creating it with create() if it is not cached;
+ * create() is called with FFTW set up to plan for nthreads threads.  The
+ * plan is returned in *fftwplan.  Looking up a plan which is already cached
+ * does not take any lock.
+ */
+LALFFTWPlanCacheEntry *XLALFFTWAcquireCachedPlan(int kind, UINT4 size, UINT4 howmany, int fwdflg, unsigned flags, UINT4 nthreads,
+                                                 LALFFTWPlanCreateFunc create, LALFFTWPlanDestroyFunc destroy,
+                                                 void **fftwplan);
+
+/*
+ * Return the number of threads with which a new FFT plan of the given size
+ * is created: the value set by XLALFFTWSetNumThreads() for large transforms,
+ * and 1 otherwise.
+ */
+UINT4 XLALFFTWDefaultPlanNumThreads(UINT4 size);
+
+/*
+ * Release a reference returned by XLALFFTWAcquireCachedPlan(); the FFTW
+ * plan stays in the cache until it is among the least recently used of more
+ * than 64 unreferenced plans when a new plan is created, or until
+ * XLALFFTWClearPlanCache() is called.
+ */
+void XLALFFTWReleaseCachedPlan(LALFFTWPlanCacheEntry *entry);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* _FFTWPLANCACHE_H */
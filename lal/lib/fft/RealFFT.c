@@ -21,6 +21,7 @@
 
 #include <complex.h>
 #include <fftw3.h>
+#include <limits.h>
 #include <string.h>
 
 #include <lal/LALDatatypes.h>
@@ -31,6 +32,14 @@
 #include <lal/SeqFactories.h>
 #include <lal/XLALError.h>
 
+#include "FFTWPlanCache.h"
+
+#ifdef __GNUC__
+#define UNUSED __attribute__ ((unused))
+#else
+#define UNUSED
+#endif
+
 /**
  * \addtogroup RealFFT_h
  *
@@ -155,6 +164,9 @@ tagREAL4FFTPlan
   INT4       sign; /**< sign in transform exponential, -1 for forward, +1 for reverse */
   UINT4      size; /**< length of the real data vector for this plan */
   fftwf_plan plan; /**< the FFTW plan */
+  unsigned   flags; /**< the FFTW planner flags */
+  UINT4      nthreads; /**< number of threads used by the FFTW plan */
+  LALFFTWPlanCacheEntry *cache; /**< plan cache entry holding the shared FFTW plan */
 };
 
 /**
@@ -166,6 +178,9 @@ tagREAL8FFTPlan
   INT4       sign; /**< sign in transform exponential, -1 for forward, +1 for reverse */
   UINT4      size; /**< length of the real data vector for this plan */
   fftw_plan  plan; /**< the FFTW plan */
+  unsigned   flags; /**< the FFTW planner flags */
+  UINT4      nthreads; /**< number of threads used by the FFTW plan */
+  LALFFTWPlanCacheEntry *cache; /**< plan cache entry holding the shared FFTW plan */
 };
 
 
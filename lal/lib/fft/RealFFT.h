@@ -54,21 +54,29 @@ extern "C" {
  * REAL4FFTPlan * XLALCreateForwardREAL4FFTPlan( UINT4 size, int measurelvl );
  * REAL4FFTPlan * XLALCreateReverseREAL4FFTPlan( UINT4 size, int measurelvl );
  * void XLALDestroyREAL4FFTPlan( REAL4FFTPlan *plan );
+ * int XLALSetREAL4FFTPlanNumThreads( REAL4FFTPlan *plan, UINT4 nthreads );
  *
  * int XLALREAL4ForwardFFT( COMPLEX8Vector *output, REAL4Vector *input, REAL4FFTPlan *plan );
  * int XLALREAL4ReverseFFT( REAL4Vector *output, COMPLEX8Vector *input, REAL4FFTPlan *plan );
  * int XLALREAL4VectorFFT( REAL4Vector *output, REAL4Vector *input, REAL4FFTPlan *plan );
  * int XLALREAL4PowerSpectrum( REAL4Vector *spec, REAL4Vector *data, REAL4FFTPlan *plan );
  *
+ * int XLALREAL4ForwardFFTSequence( COMPLEX8VectorSequence *output, REAL4VectorSequence *input, REAL4FFTPlan *plan );
+ * int XLALREAL4ReverseFFTSequence( REAL4VectorSequence *output, COMPLEX8VectorSequence *input, REAL4FFTPlan *plan );
+ *
  * REAL8FFTPlan * XLALCreateREAL8FFTPlan( UINT4 size, int fwdflg, int measurelvl );
  * REAL8FFTPlan * XLALCreateForwardREAL8FFTPlan( UINT4 size, int measurelvl );
  * REAL8FFTPlan * XLALCreateReverseREAL8FFTPlan( UINT4 size, int measurelvl );
  * void XLALDestroyREAL8FFTPlan( REAL8FFTPlan *plan );
+ * int XLALSetREAL8FFTPlanNumThreads( REAL8FFTPlan *plan, UINT4 nthreads );
  *
  * int XLALREAL8ForwardFFT( COMPLEX16Vector *output, REAL8Vector *input, REAL8FFTPlan *plan );
  * int XLALREAL8ReverseFFT( REAL8Vector *output, COMPLEX16Vector *input, REAL8FFTPlan *plan );
  * int XLALREAL8VectorFFT( REAL8Vector *output, REAL8Vector *input, REAL8FFTPlan *plan );
  * int XLALREAL8PowerSpectrum( REAL8Vector *spec, REAL8Vector *data, REAL8FFTPlan *plan );
+ *
+ * int XLALREAL8ForwardFFTSequence( COMPLEX16VectorSequence *output, REAL8VectorSequence *input, REAL8FFTPlan *plan );
+ * int XLALREAL8ReverseFFTSequence( REAL8VectorSequence *output, COMPLEX16VectorSequence *input, REAL8FFTPlan *plan );
  * \endcode
  *
  * ### Description ###
@@ -309,6 +317,28 @@ REAL4FFTPlan * XLALCreateReverseREAL4FFTPlan( UINT4 size, int measurelvl );
  */
 void XLALDestroyREAL4FFTPlan( REAL4FFTPlan *plan );
 
+/**
+ * Sets the number of threads used by a REAL4FFTPlan
+ *
+ * The FFTs performed with the plan are executed using \c nthreads
+ * threads.  By default, plans of at least 32768 points use the number of
+ * threads set by XLALFFTWSetNumThreads(), and smaller plans use a single
+ * thread.  Multi-threaded transforms are only worthwhile for large sizes.
+ *
+ * @param[in,out] plan A pointer to the REAL4FFTPlan to be modified.
+ * @param[in] nthreads The number of threads.
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALSetREAL4FFTPlanNumThreads() function shall fail if:
+ * - [\c XLAL_EFAULT] The plan is a \c NULL pointer.
+ * - [\c XLAL_EINVAL] The plan is invalid, or \c nthreads is 0, or more
+ * than one thread is requested and LAL was not configured with
+ * <tt>--enable-fftw3-threads</tt>.
+ * - [\c XLAL_EFAILED] The call to the underlying FFTW routine failed.
+ * .
+ */
+int XLALSetREAL4FFTPlanNumThreads( REAL4FFTPlan *plan, UINT4 nthreads );
+
 /**
  * Performs a forward FFT of REAL4 data
  *
@@ -428,6 +458,61 @@ int XLALREAL4VectorFFT( REAL4Vector * _LAL_RESTRICT_ output, const REAL4Vector *
  */
 int XLALREAL4PowerSpectrum( REAL4Vector * _LAL_RESTRICT_ spec, const REAL4Vector * _LAL_RESTRICT_ data, const REAL4FFTPlan *plan );
 
+/**
+ * Performs forward FFTs of a sequence of REAL4 data vectors
+ *
+ * This routine performs the same transformation as XLALREAL4ForwardFFT()
+ * on each of the vectors of the input sequence, using a single batched
+ * FFTW plan for all of the vectors.  The batched plan is created, with
+ * the measurement level of \c plan, the first time a sequence with a
+ * given number of vectors is transformed, and is then kept in the plan
+ * cache (see XLALFFTWClearPlanCache()).
+ *
+ * @param[out] output The sequence of complex data vectors z of length [N/2] + 1
+ * that results from the transforms
+ * @param[in] input The sequence of real data vectors x of length N to be transformed
+ * @param[in] plan The forward FFT plan of size N to use for the transforms
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALREAL4ForwardFFTSequence() function shall fail if:
+ * - [\c XLAL_EFAULT] A \c NULL pointer is provided as one of the arguments.
+ * - [\c XLAL_EINVAL] A argument is invalid or the plan is for a
+ * reverse transform.
+ * - [\c XLAL_EBADLEN] The input sequence, output sequence, and plan size are
+ * incompatible.
+ * - [\c XLAL_ENOMEM] Insufficient storage space is available.
+ * .
+ */
+int XLALREAL4ForwardFFTSequence( COMPLEX8VectorSequence *output, const REAL4VectorSequence *input, const REAL4FFTPlan *plan );
+
+/**
+ * Performs reverse FFTs of a sequence of REAL4 data vectors
+ *
+ * This routine performs the same transformation as XLALREAL4ReverseFFT()
+ * on each of the vectors of the input sequence, using a single batched
+ * FFTW plan for all of the vectors, as for XLALREAL4ForwardFFTSequence().
+ *
+ * @param[out] output The sequence of real data vectors y of length N
+ * that results from the transforms
+ * @param[in] input The sequence of complex data vectors z of length [N/2] + 1
+ * to be transformed
+ * @param[in] plan The reverse FFT plan of size N to use for the transforms
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALREAL4ReverseFFTSequence() function shall fail if:
+ * - [\c XLAL_EFAULT] A \c NULL pointer is provided as one of the arguments.
+ * - [\c XLAL_EINVAL] A argument is invalid or the plan is for a
+ * forward transform.
+ * - [\c XLAL_EBADLEN] The input sequence, output sequence, and plan size are
+ * incompatible.
+ * - [\c XLAL_ENOMEM] Insufficient storage space is available.
+ * - [\c XLAL_EDOM] Domain error if the DC component of any input vector
+ * is not purely real, or if N is even and the Nyquist component of any input
+ * vector is not purely real.
+ * .
+ */
+int XLALREAL4ReverseFFTSequence( REAL4VectorSequence *output, const COMPLEX8VectorSequence *input, const REAL4FFTPlan *plan );
+
 /*
  *
  * XLAL REAL8 functions
@@ -537,6 +622,28 @@ REAL8FFTPlan * XLALCreateReverseREAL8FFTPlan( UINT4 size, int measurelvl );
  */
 void XLALDestroyREAL8FFTPlan( REAL8FFTPlan *plan );
 
+/**
+ * Sets the number of threads used by a REAL8FFTPlan
+ *
+ * The FFTs performed with the plan are executed using \c nthreads
+ * threads.  By default, plans of at least 32768 points use the number of
+ * threads set by XLALFFTWSetNumThreads(), and smaller plans use a single
+ * thread.  Multi-threaded transforms are only worthwhile for large sizes.
+ *
+ * @param[in,out] plan A pointer to the REAL8FFTPlan to be modified.
+ * @param[in] nthreads The number of threads.
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALSetREAL8FFTPlanNumThreads() function shall fail if:
+ * - [\c XLAL_EFAULT] The plan is a \c NULL pointer.
+ * - [\c XLAL_EINVAL] The plan is invalid, or \c nthreads is 0, or more
+ * than one thread is requested and LAL was not configured with
+ * <tt>--enable-fftw3-threads</tt>.
+ * - [\c XLAL_EFAILED] The call to the underlying FFTW routine failed.
+ * .
+ */
+int XLALSetREAL8FFTPlanNumThreads( REAL8FFTPlan *plan, UINT4 nthreads );
+
 /**
  * Performs a forward FFT of REAL8 data
  *
@@ -660,6 +767,61 @@ int XLALREAL8VectorFFT( REAL8Vector *output, const REAL8Vector *input,
 int XLALREAL8PowerSpectrum( REAL8Vector *spec, const REAL8Vector *data,
     const REAL8FFTPlan *plan );
 
+/**
+ * Performs forward FFTs of a sequence of REAL8 data vectors
+ *
+ * This routine performs the same transformation as XLALREAL8ForwardFFT()
+ * on each of the vectors of the input sequence, using a single batched
+ * FFTW plan for all of the vectors.  The batched plan is created, with
+ * the measurement level of \c plan, the first time a sequence with a
+ * given number of vectors is transformed, and is then kept in the plan
+ * cache (see XLALFFTWClearPlanCache()).
+ *
+ * @param[out] output The sequence of complex data vectors z of length [N/2] + 1
+ * that results from the transforms
+ * @param[in] input The sequence of real data vectors x of length N to be transformed
+ * @param[in] plan The forward FFT plan of size N to use for the transforms
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALREAL8ForwardFFTSequence() function shall fail if:
+ * - [\c XLAL_EFAULT] A \c NULL pointer is provided as one of the arguments.
+ * - [\c XLAL_EINVAL] A argument is invalid or the plan is for a
+ * reverse transform.
+ * - [\c XLAL_EBADLEN] The input sequence, output sequence, and plan size are
+ * incompatible.
+ * - [\c XLAL_ENOMEM] Insufficient storage space is available.
+ * .
+ */
+int XLALREAL8ForwardFFTSequence( COMPLEX16VectorSequence *output, const REAL8VectorSequence *input, const REAL8FFTPlan *plan );
+
+/**
+ * Performs reverse FFTs of a sequence of REAL8 data vectors
+ *
+ * This routine performs the same transformation as XLALREAL8ReverseFFT()
+ * on each of the vectors of the input sequence, using a single batched
+ * FFTW plan for all of the vectors, as for XLALREAL8ForwardFFTSequence().
+ *
+ * @param[out] output The sequence of real data vectors y of length N
+ * that results from the transforms
+ * @param[in] input The sequence of complex data vectors z of length [N/2] + 1
+ * to be transformed
+ * @param[in] plan The reverse FFT plan of size N to use for the transforms
+ * @return 0 upon successful completion or non-zero upon failure.
+ * @par Errors:
+ * The \c XLALREAL8ReverseFFTSequence() function shall fail if:
+ * - [\c XLAL_EFAULT] A \c NULL pointer is provided as one of the arguments.
+ * - [\c XLAL_EINVAL] A argument is invalid or the plan is for a
+ * forward transform.
+ * - [\c XLAL_EBADLEN] The input sequence, output sequence, and plan size are
+ * incompatible.
+ * - [\c XLAL_ENOMEM] Insufficient storage space is available.
+ * - [\c XLAL_EDOM] Domain error if the DC component of any input vector
+ * is not purely real, or if N is even and the Nyquist component of any input
+ * vector is not purely real.
+ * .
+ */
+int XLALREAL8ReverseFFTSequence( REAL8VectorSequence *output, const COMPLEX16VectorSequence *input, const REAL8FFTPlan *plan );
+
 /** @} */
 
 #if 0
@@ -8,45 +8,114 @@
 #define REAL_TYPE REAL4
 #define COMPLEX_TYPE COMPLEX8
 #define TYPESUFFIX f
+#define PLAN_KIND LAL_FFTW_PLAN_KIND_R2R_FLOAT
+#define MANY_PLAN_KIND LAL_FFTW_PLAN_KIND_MANY_R2C_FLOAT
 #else
 #define REAL_TYPE REAL8
 #define COMPLEX_TYPE COMPLEX16
 #define TYPESUFFIX
+#define PLAN_KIND LAL_FFTW_PLAN_KIND_R2R_DOUBLE
+#define MANY_PLAN_KIND LAL_FFTW_PLAN_KIND_MANY_R2C_DOUBLE
 #endif
 
 #define PLAN_TYPE			CONCAT2(REAL_TYPE,FFTPlan)
 #define REAL_VECTOR_TYPE		CONCAT2(REAL_TYPE,Vector)
 #define COMPLEX_VECTOR_TYPE		CONCAT2(COMPLEX_TYPE,Vector)
+#define REAL_SEQUENCE_TYPE		CONCAT2(REAL_TYPE,VectorSequence)
+#define COMPLEX_SEQUENCE_TYPE		CONCAT2(COMPLEX_TYPE,VectorSequence)
 
 #define CREATE_PLAN_FUNCTION		CONCAT2(XLALCreate,PLAN_TYPE)
 #define CREATE_FORWARD_PLAN_FUNCTION	CONCAT2(XLALCreateForward,PLAN_TYPE)
 #define CREATE_REVERSE_PLAN_FUNCTION	CONCAT2(XLALCreateReverse,PLAN_TYPE)
 #define DESTROY_PLAN_FUNCTION		CONCAT2(XLALDestroy,PLAN_TYPE)
+#define SET_NUM_THREADS_FUNCTION	CONCAT3(XLALSet,PLAN_TYPE,NumThreads)
+#define CREATE_FFTW_PLAN_FUNCTION	CONCAT2(CreateFFTWPlan,PLAN_TYPE)
+#define DESTROY_FFTW_PLAN_FUNCTION	CONCAT2(DestroyFFTWPlan,PLAN_TYPE)
+#define CREATE_FFTW_MANY_PLAN_FUNCTION	CONCAT2(CreateFFTWManyPlan,PLAN_TYPE)
 #define FORWARD_FFT_FUNCTION		CONCAT3(XLAL,REAL_TYPE,ForwardFFT)
 #define REVERSE_FFT_FUNCTION		CONCAT3(XLAL,REAL_TYPE,ReverseFFT)
+#define FORWARD_FFT_SEQUENCE_FUNCTION	CONCAT3(XLAL,REAL_TYPE,ForwardFFTSequence)
+#define REVERSE_FFT_SEQUENCE_FUNCTION	CONCAT3(XLAL,REAL_TYPE,ReverseFFTSequence)
 #define VECTOR_FFT_FUNCTION		CONCAT3(XLAL,REAL_VECTOR_TYPE,FFT)
 #define POWER_SPECTRUM_FUNCTION		CONCAT3(XLAL,REAL_TYPE,PowerSpectrum)
 
 #define CREALX				CONCAT2(creal,TYPESUFFIX)
 #define CIMAGX				CONCAT2(cimag,TYPESUFFIX)
 #define FFTWX				CONCAT2(fftw,TYPESUFFIX)
+#define FFTWX_PLAN			CONCAT2(FFTWX,_plan)
 #define FFTWX_PLAN_R2R_1D		CONCAT2(FFTWX,_plan_r2r_1d)
 #define FFTWX_DESTROY_PLAN		CONCAT2(FFTWX,_destroy_plan)
 #define FFTWX_EXECUTE_R2R		CONCAT2(FFTWX,_execute_r2r)
+#define FFTWX_COMPLEX			CONCAT2(FFTWX,_complex)
+#define FFTWX_PLAN_MANY_DFT_R2C		CONCAT2(FFTWX,_plan_many_dft_r2c)
+#define FFTWX_PLAN_MANY_DFT_C2R		CONCAT2(FFTWX,_plan_many_dft_c2r)
+#define FFTWX_EXECUTE_DFT_R2C		CONCAT2(FFTWX,_execute_dft_r2c)
+#define FFTWX_EXECUTE_DFT_C2R		CONCAT2(FFTWX,_execute_dft_c2r)
+
+/* create the FFTW plan; called by the plan cache with the wisdom lock held */
+static void *CREATE_FFTW_PLAN_FUNCTION(UINT4 size, UINT4 UNUSED howmany, int fwdflg, unsigned flags)
+{
+    FFTWX_PLAN fftwplan;
+    REAL_TYPE *tmp1;
+    REAL_TYPE *tmp2;
+    size_t nbytes = size * sizeof(REAL_TYPE);
+
+    /* allocate memory for the temporary arrays */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    tmp1 = XLALMallocAligned(nbytes);
+    tmp2 = XLALMallocAligned(nbytes);
+    if (!tmp1 || !tmp2) {
+        XLALFreeAligned(tmp1);
+        XLALFreeAligned(tmp2);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+#   else
+    tmp1 = XLALMalloc(nbytes);
+    tmp2 = XLALMalloc(nbytes);
+    if (!tmp1 || !tmp2) {
+        XLALFree(tmp1);
+        XLALFree(tmp2);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+#   endif
+
+    /* create plan */
+
+    if (fwdflg) /* forward */
+        fftwplan = FFTWX_PLAN_R2R_1D(size, tmp1, tmp2, FFTW_R2HC, flags);
+    else        /* reverse */
+        fftwplan = FFTWX_PLAN_R2R_1D(size, tmp1, tmp2, FFTW_HC2R, flags);
+
+    /* free the temporary arrays */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    XLALFreeAligned(tmp1);
+    XLALFreeAligned(tmp2);
+#   else
+    XLALFree(tmp1);
+    XLALFree(tmp2);
+#   endif
+
+    return fftwplan;
+}
+
+/* destroy the FFTW plan; called by the plan cache with the wisdom lock held */
+static void DESTROY_FFTW_PLAN_FUNCTION(void *fftwplan)
+{
+    FFTWX_DESTROY_PLAN((FFTWX_PLAN) fftwplan);
+}
 
 PLAN_TYPE *CREATE_PLAN_FUNCTION(UINT4 size, int fwdflg, int measurelvl)
 {
     PLAN_TYPE *plan;
-    REAL_TYPE *tmp1;
-    REAL_TYPE *tmp2;
-    size_t nbytes;
-    int flags;
+    void *fftwplan = NULL;
+    unsigned flags;
+    UINT4 nthreads;
 
     if (!size)
         XLAL_ERROR_NULL(XLAL_EBADLEN);
 
-    nbytes = size * sizeof(REAL_TYPE);
-
     /* set fftw3 flags to perform requested degree of measurement */
 
 #   ifdef LAL_FFTW3_MEMALIGN_ENABLED
@@ -70,58 +139,30 @@ PLAN_TYPE *CREATE_PLAN_FUNCTION(UINT4 size, int fwdflg, int measurelvl)
         break;
     }
 
-    /* allocate memory for the plan and the temporary arrays */
+    /* allocate memory for the plan */
 
     plan = XLALMalloc(sizeof(*plan));
     if (!plan)
         XLAL_ERROR_NULL(XLAL_ENOMEM);
 
-#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
-    tmp1 = XLALMallocAligned(nbytes);
-    tmp2 = XLALMallocAligned(nbytes);
-    if (!tmp1 || !tmp2) {
-        XLALFreeAligned(tmp1);
-        XLALFreeAligned(tmp2);
-        XLAL_ERROR_NULL(XLAL_ENOMEM);
-    }
-#   else
-    tmp1 = XLALMalloc(nbytes);
-    tmp2 = XLALMalloc(nbytes);
-    if (!tmp1 || !tmp2) {
-        XLALFree(tmp1);
-        XLALFree(tmp2);
-        XLAL_ERROR_NULL(XLAL_ENOMEM);
-    }
-#   endif
-
-    /* establish fftw mutex lock and create plan */
-
-    LAL_FFTW_WISDOM_LOCK;
-    if (fwdflg) /* forward */
-        plan->plan = FFTWX_PLAN_R2R_1D(size, tmp1, tmp2, FFTW_R2HC, flags);
-    else        /* reverse */
-        plan->plan = FFTWX_PLAN_R2R_1D(size, tmp1, tmp2, FFTW_HC2R, flags);
-    LAL_FFTW_WISDOM_UNLOCK;
+    /* look up the fftw plan in the plan cache, creating it if needed;
+     * large transforms use the default number of threads */
 
-    /* free the temporary arrays */
-
-#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
-    XLALFreeAligned(tmp1);
-    XLALFreeAligned(tmp2);
-#   else
-    XLALFree(tmp1);
-    XLALFree(tmp2);
-#   endif
+    nthreads = XLALFFTWDefaultPlanNumThreads(size);
+    plan->cache = XLALFFTWAcquireCachedPlan(PLAN_KIND, size, 1, fwdflg, flags, nthreads, CREATE_FFTW_PLAN_FUNCTION, DESTROY_FFTW_PLAN_FUNCTION, &fftwplan);
 
     /* check to see success of plan creation */
 
-    if (!plan->plan) {
+    if (!plan->cache) {
         XLALFree(plan);
-        XLAL_ERROR_NULL(XLAL_EFAILED);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
     }
 
     /* set remaining plan fields */
 
+    plan->plan = (FFTWX_PLAN) fftwplan;
+    plan->flags = flags;
+    plan->nthreads = nthreads;
     plan->size = size;
     plan->sign = (fwdflg ? -1 : 1);
 
@@ -149,16 +190,42 @@ PLAN_TYPE *CREATE_REVERSE_PLAN_FUNCTION(UINT4 size, int measurelvl)
 void DESTROY_PLAN_FUNCTION(PLAN_TYPE * plan)
 {
     if (plan) {
-        if (plan->plan) {
-            LAL_FFTW_WISDOM_LOCK;
-            FFTWX_DESTROY_PLAN(plan->plan);
-            LAL_FFTW_WISDOM_UNLOCK;
-        }
+        /* the fftw plan itself is retained by the plan cache */
+        XLALFFTWReleaseCachedPlan(plan->cache);
         memset(plan, 0, sizeof(*plan));
         XLALFree(plan);
     }
 }
 
+int SET_NUM_THREADS_FUNCTION(PLAN_TYPE * plan, UINT4 nthreads)
+{
+    LALFFTWPlanCacheEntry *cache;
+    void *fftwplan = NULL;
+
+    if (!plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!nthreads)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (nthreads == plan->nthreads)
+        return 0;
+
+    /* look up the fftw plan for the new number of threads in the plan
+     * cache, creating it if needed, then release the old fftw plan */
+
+    cache = XLALFFTWAcquireCachedPlan(PLAN_KIND, plan->size, 1, plan->sign == -1, plan->flags, nthreads, CREATE_FFTW_PLAN_FUNCTION, DESTROY_FFTW_PLAN_FUNCTION, &fftwplan);
+    if (!cache)
+        XLAL_ERROR(XLAL_EFUNC);
+    XLALFFTWReleaseCachedPlan(plan->cache);
+
+    plan->cache = cache;
+    plan->plan = (FFTWX_PLAN) fftwplan;
+    plan->nthreads = nthreads;
+
+    return 0;
+}
+
 int FORWARD_FFT_FUNCTION(COMPLEX_VECTOR_TYPE * output, const REAL_VECTOR_TYPE * input, const PLAN_TYPE * plan)
 {
     REAL_TYPE *input_data;
@@ -453,6 +520,216 @@ int POWER_SPECTRUM_FUNCTION(REAL_VECTOR_TYPE * spec, const REAL_VECTOR_TYPE * da
     return 0;
 }
 
+/* create a batched fftw plan; called by the plan cache with the wisdom lock held */
+static void *CREATE_FFTW_MANY_PLAN_FUNCTION(UINT4 size, UINT4 howmany, int fwdflg, unsigned flags)
+{
+    FFTWX_PLAN fftwplan;
+    REAL_TYPE *tmpr;
+    COMPLEX_TYPE *tmpc;
+    int n = size;
+    int nc = size / 2 + 1;
+    size_t nbytesr = (size_t) howmany * size * sizeof(REAL_TYPE);
+    size_t nbytesc = (size_t) howmany * nc * sizeof(COMPLEX_TYPE);
+
+    /* allocate memory for the temporary arrays */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    tmpr = XLALMallocAligned(nbytesr);
+    tmpc = XLALMallocAligned(nbytesc);
+    if (!tmpr || !tmpc) {
+        XLALFreeAligned(tmpr);
+        XLALFreeAligned(tmpc);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+#   else
+    tmpr = XLALMalloc(nbytesr);
+    tmpc = XLALMalloc(nbytesc);
+    if (!tmpr || !tmpc) {
+        XLALFree(tmpr);
+        XLALFree(tmpc);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+#   endif
+
+    /* create plan; the complex-to-real transform must not overwrite its input */
+
+    if (fwdflg) /* forward */
+        fftwplan = FFTWX_PLAN_MANY_DFT_R2C(1, &n, howmany, tmpr, NULL, 1, n, (FFTWX_COMPLEX *) tmpc, NULL, 1, nc, flags);
+    else        /* reverse */
+        fftwplan = FFTWX_PLAN_MANY_DFT_C2R(1, &n, howmany, (FFTWX_COMPLEX *) tmpc, NULL, 1, nc, tmpr, NULL, 1, n, flags | FFTW_PRESERVE_INPUT);
+
+    /* free the temporary arrays */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    XLALFreeAligned(tmpr);
+    XLALFreeAligned(tmpc);
+#   else
+    XLALFree(tmpr);
+    XLALFree(tmpc);
+#   endif
+
+    return fftwplan;
+}
+
+int FORWARD_FFT_SEQUENCE_FUNCTION(COMPLEX_SEQUENCE_TYPE * output, const REAL_SEQUENCE_TYPE * input, const PLAN_TYPE * plan)
+{
+    LALFFTWPlanCacheEntry *cache;
+    void *fftwplan = NULL;
+    REAL_TYPE *input_data;
+    COMPLEX_TYPE *output_data;
+
+    /* sanity checks on arguments */
+
+    if (!output || !input || !plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size || plan->sign != -1)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!output->data || !input->data)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (input->vectorLength != plan->size || output->vectorLength != plan->size / 2 + 1 || output->length != input->length)
+        XLAL_ERROR(XLAL_EBADLEN);
+    if (input->length > INT_MAX)
+        XLAL_ERROR(XLAL_EBADLEN, "Number of transforms %u exceeds the FFTW limit %i", input->length, INT_MAX);
+    if (!input->length)
+        return 0;
+
+    /* look up the batched fftw plan in the plan cache, creating it if needed */
+
+    cache = XLALFFTWAcquireCachedPlan(MANY_PLAN_KIND, plan->size, input->length, 1, plan->flags, plan->nthreads, CREATE_FFTW_MANY_PLAN_FUNCTION, DESTROY_FFTW_PLAN_FUNCTION, &fftwplan);
+    if (!cache)
+        XLAL_ERROR(XLAL_EFUNC);
+
+    input_data = input->data;
+    output_data = output->data;
+
+    /* if memory alignment is required, check memory alignment and create
+     * temporary space if necessary */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    if (!LAL_IS_MEMORY_ALIGNED(input_data)) {
+        input_data = XLALMallocAligned((size_t) input->length * input->vectorLength * sizeof(REAL_TYPE));
+        if (!input_data) {
+            XLALFFTWReleaseCachedPlan(cache);
+            XLAL_ERROR(XLAL_ENOMEM);
+        }
+        memcpy(input_data, input->data, (size_t) input->length * input->vectorLength * sizeof(REAL_TYPE));
+    }
+    if (!LAL_IS_MEMORY_ALIGNED(output_data)) {
+        output_data = XLALMallocAligned((size_t) output->length * output->vectorLength * sizeof(COMPLEX_TYPE));
+        if (!output_data) {
+            if (input_data != input->data)
+                XLALFreeAligned(input_data);
+            XLALFFTWReleaseCachedPlan(cache);
+            XLAL_ERROR(XLAL_ENOMEM);
+        }
+    }
+#   endif
+
+    /* perform all the ffts; the output is already in the packing of the
+     * output vectors */
+
+    FFTWX_EXECUTE_DFT_R2C((FFTWX_PLAN) fftwplan, input_data, (FFTWX_COMPLEX *) output_data);
+
+    /* cleanup aligned memory space if memory alignment is required;
+     * copy data from temporary space to output sequence */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    if (input_data != input->data)
+        XLALFreeAligned(input_data);
+    if (output_data != output->data) {
+        memcpy(output->data, output_data, (size_t) output->length * output->vectorLength * sizeof(COMPLEX_TYPE));
+        XLALFreeAligned(output_data);
+    }
+#   endif
+
+    XLALFFTWReleaseCachedPlan(cache);
+
+    return 0;
+}
+
+int REVERSE_FFT_SEQUENCE_FUNCTION(REAL_SEQUENCE_TYPE * output, const COMPLEX_SEQUENCE_TYPE * input, const PLAN_TYPE * plan)
+{
+    LALFFTWPlanCacheEntry *cache;
+    void *fftwplan = NULL;
+    COMPLEX_TYPE *input_data;
+    REAL_TYPE *output_data;
+    UINT4 j;
+
+    /* sanity checks on arguments */
+
+    if (!output || !input || !plan)
+        XLAL_ERROR(XLAL_EFAULT);
+    if (!plan->plan || !plan->size || plan->sign != 1)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (!output->data || !input->data)
+        XLAL_ERROR(XLAL_EINVAL);
+    if (output->vectorLength != plan->size || input->vectorLength != plan->size / 2 + 1 || output->length != input->length)
+        XLAL_ERROR(XLAL_EBADLEN);
+    if (input->length > INT_MAX)
+        XLAL_ERROR(XLAL_EBADLEN, "Number of transforms %u exceeds the FFTW limit %i", input->length, INT_MAX);
+    for (j = 0; j < input->length; ++j) {
+        const COMPLEX_TYPE *z = input->data + (size_t) j * input->vectorLength;
+        if (CIMAGX(z[0]) != 0.0)
+            XLAL_ERROR(XLAL_EDOM);      /* imaginary part of DC must be zero */
+        if (plan->size % 2 == 0 && CIMAGX(z[plan->size / 2]) != 0.0)
+            XLAL_ERROR(XLAL_EDOM);      /* imaginary part of Nyquist must be zero */
+    }
+    if (!input->length)
+        return 0;
+
+    /* look up the batched fftw plan in the plan cache, creating it if needed */
+
+    cache = XLALFFTWAcquireCachedPlan(MANY_PLAN_KIND, plan->size, input->length, 0, plan->flags, plan->nthreads, CREATE_FFTW_MANY_PLAN_FUNCTION, DESTROY_FFTW_PLAN_FUNCTION, &fftwplan);
+    if (!cache)
+        XLAL_ERROR(XLAL_EFUNC);
+
+    input_data = input->data;
+    output_data = output->data;
+
+    /* if memory alignment is required, check memory alignment and create
+     * temporary space if necessary */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    if (!LAL_IS_MEMORY_ALIGNED(input_data)) {
+        input_data = XLALMallocAligned((size_t) input->length * input->vectorLength * sizeof(COMPLEX_TYPE));
+        if (!input_data) {
+            XLALFFTWReleaseCachedPlan(cache);
+            XLAL_ERROR(XLAL_ENOMEM);
+        }
+        memcpy(input_data, input->data, (size_t) input->length * input->vectorLength * sizeof(COMPLEX_TYPE));
+    }
+    if (!LAL_IS_MEMORY_ALIGNED(output_data)) {
+        output_data = XLALMallocAligned((size_t) output->length * output->vectorLength * sizeof(REAL_TYPE));
+        if (!output_data) {
+            if (input_data != input->data)
+                XLALFreeAligned(input_data);
+            XLALFFTWReleaseCachedPlan(cache);
+            XLAL_ERROR(XLAL_ENOMEM);
+        }
+    }
+#   endif
+
+    /* perform all the ffts; the plan preserves the input data */
+
+    FFTWX_EXECUTE_DFT_C2R((FFTWX_PLAN) fftwplan, (FFTWX_COMPLEX *) input_data, output_data);
+
+    /* cleanup aligned memory space if memory alignment is required;
+     * copy data from temporary space to output sequence */
+
+#   ifdef LAL_FFTW3_MEMALIGN_ENABLED
+    if (input_data != input->data)
+        XLALFreeAligned(input_data);
+    if (output_data != output->data) {
+        memcpy(output->data, output_data, (size_t) output->length * output->vectorLength * sizeof(REAL_TYPE));
+        XLALFreeAligned(output_data);
+    }
+#   endif
+
+    XLALFFTWReleaseCachedPlan(cache);
+
+    return 0;
+}
+
 #undef CONCAT2x
 #undef CONCAT2
 #undef CONCAT3x
@@ -462,23 +739,39 @@ int POWER_SPECTRUM_FUNCTION(REAL_VECTOR_TYPE * spec, const REAL_VECTOR_TYPE * da
 #undef REAL_TYPE
 #undef COMPLEX_TYPE
 #undef TYPESUFFIX
+#undef PLAN_KIND
+#undef MANY_PLAN_KIND
 
 #undef PLAN_TYPE
 #undef REAL_VECTOR_TYPE
 #undef COMPLEX_VECTOR_TYPE
+#undef REAL_SEQUENCE_TYPE
+#undef COMPLEX_SEQUENCE_TYPE
 
 #undef CREATE_PLAN_FUNCTION
 #undef CREATE_FORWARD_PLAN_FUNCTION
 #undef CREATE_REVERSE_PLAN_FUNCTION
 #undef DESTROY_PLAN_FUNCTION
+#undef SET_NUM_THREADS_FUNCTION
+#undef CREATE_FFTW_PLAN_FUNCTION
+#undef DESTROY_FFTW_PLAN_FUNCTION
+#undef CREATE_FFTW_MANY_PLAN_FUNCTION
 #undef FORWARD_FFT_FUNCTION
 #undef REVERSE_FFT_FUNCTION
+#undef FORWARD_FFT_SEQUENCE_FUNCTION
+#undef REVERSE_FFT_SEQUENCE_FUNCTION
 #undef VECTOR_FFT_FUNCTION
 #undef POWER_SPECTRUM_FUNCTION
 
 #undef CREALX
 #undef CIMAGX
 #undef FFTWX
+#undef FFTWX_PLAN
 #undef FFTWX_PLAN_R2R_1D
 #undef FFTWX_DESTROY_PLAN
 #undef FFTWX_EXECUTE_R2R
+#undef FFTWX_COMPLEX
+#undef FFTWX_PLAN_MANY_DFT_R2C
+#undef FFTWX_PLAN_MANY_DFT_C2R
+#undef FFTWX_EXECUTE_DFT_R2C
+#undef FFTWX_EXECUTE_DFT_C2R
@@ -0,0 +1,513 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with with program; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include <config.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALArena.h>
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#endif
+
+/* alignment of arena allocations; suitable for SIMD and FFTW */
+#define ARENA_ALIGN 64
+
+/* default minimum size of an arena block */
+#define ARENA_DEFAULT_BLOCKSIZE (1 << 20)
+
+/* maximum depth of the arena stack of a thread */
+#define ARENA_STACK_MAX 16
+
+#define ARENA_ROUNDUP(n) (((n) + ARENA_ALIGN - 1) & ~((size_t) ARENA_ALIGN - 1))
+
+/* A block of arena memory; blocks form a list, most recent first */
+typedef struct tagLALArenaBlock {
+  struct tagLALArenaBlock *next;
+  char *base;			/* aligned start of usable memory */
+  size_t size;			/* size of usable memory */
+  size_t used;			/* bytes handed out from this block */
+  size_t last;			/* offset of the most recent allocation */
+} LALArenaBlock;
+
+struct tagLALArena {
+  LALArenaBlock *blocks;	/* list of blocks; allocations are made from the head */
+  size_t blocksize;		/* minimum size of a new block */
+  size_t used;			/* bytes handed out since the last reset */
+  size_t nblockallocs;		/* number of blocks allocated over the lifetime of the arena */
+};
+
+/* The arena stack of a thread, and the thread's own arena */
+typedef struct tagLALArenaStack {
+  LALArena *stack[ARENA_STACK_MAX];
+  int depth;
+  LALArena *own;
+} LALArenaStack;
+
+/*
+ * The arena stacks are kept in thread-specific data if LAL is thread-safe.
+ * Note: malloc and free are used here rather than LALMalloc and LALFree,
+ * as in XLALError.c, so that thread arenas are not reported as leaks.
+ */
+
+#ifdef LAL_PTHREAD_LOCK
+
+static pthread_key_t arenaStackKey;
+static pthread_once_t arenaStackKeyOnce = PTHREAD_ONCE_INIT;
+
+static void DestroyArenaStack(void *ptr)
+{
+  LALArenaStack *as = (LALArenaStack *) ptr;
+  XLALDestroyArena(as->own);
+  free(as);
+}
+
+static void CreateArenaStackKey(void)
+{
+  pthread_key_create(&arenaStackKey, DestroyArenaStack);
+}
+
+static LALArenaStack *GetArenaStack(int create)
+{
+  pthread_once(&arenaStackKeyOnce, CreateArenaStackKey);
+  LALArenaStack *as = (LALArenaStack *) pthread_getspecific(arenaStackKey);
+  if (as == NULL && create) {
+    as = calloc(1, sizeof(*as));
+    if (as == NULL) {
+      return NULL;
+    }
+    if (pthread_setspecific(arenaStackKey, as) != 0) {
+      free(as);
+      return NULL;
+    }
+  }
+  return as;
+}
+
+#else
+
+static LALArenaStack arenaStackGlobal;
+
+static LALArenaStack *GetArenaStack(int create)
+{
+  (void) create;
+  return &arenaStackGlobal;
+}
+
+#endif
+
+/*
+ * The owner of memory is found by address, from any thread and whether or
+ * not the arena is pushed, in a map of the address ranges of the blocks of
+ * all arenas.  The map is an array of ranges sorted by address, which is
+ * replaced by a new array whenever a block is added; replacing the array
+ * and removing blocks take a lock, but XLALArenaOwner() does not.  Blocks
+ * are removed by clearing their owner in place, and are dropped from the
+ * map when it is next replaced.  A replaced array is freed only once no
+ * thread is searching the map.  The number of blocks in all arenas lets
+ * XLALArenaOwner() return at once when no arena holds any memory.
+ */
+
+typedef struct tagArenaRange {
+  const char *base;		/* start of the usable memory of a block */
+  const char *end;		/* end of the usable memory of a block */
+  LALArena *arena;		/* owner of the block, or NULL if the block has been freed */
+} ArenaRange;
+
+typedef struct tagArenaMap {
+  struct tagArenaMap *retired;	/* replaced maps which have not yet been freed */
+  size_t n;
+  ArenaRange ranges[];
+} ArenaMap;
+
+static ArenaMap *arenaMap = NULL;
+static int arenaMapReaders = 0;
+static size_t arenaMapBlocks = 0;
+
+#if !defined(LAL_PTHREAD_LOCK)
+#define ARENA_ATOMIC 1
+#elif defined(__GNUC__)
+#define ARENA_ATOMIC 1
+#define ARENA_LOAD(p)		__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define ARENA_STORE(p,v)	__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define ARENA_LOAD_SC(p)	__atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define ARENA_STORE_SC(p,v)	__atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#define ARENA_ADD_SC(p,v)	__atomic_add_fetch((p), (v), __ATOMIC_SEQ_CST)
+#define ARENA_SUB_RELEASE(p,v)	__atomic_sub_fetch((p), (v), __ATOMIC_RELEASE)
+#else
+#define ARENA_ATOMIC 0
+#endif
+#if !defined(ARENA_LOAD)
+#define ARENA_LOAD(p)		(*(p))
+#define ARENA_STORE(p,v)	(*(p) = (v))
+#define ARENA_LOAD_SC(p)	(*(p))
+#define ARENA_STORE_SC(p,v)	(*(p) = (v))
+#define ARENA_ADD_SC(p,v)	(*(p) += (v))
+#define ARENA_SUB_RELEASE(p,v)	(*(p) -= (v))
+#endif
+
+/* changes to the map are serialised by a lock; without atomic builtins, searches also take it */
+#ifdef LAL_PTHREAD_LOCK
+static pthread_mutex_t arenaMapLock = PTHREAD_MUTEX_INITIALIZER;
+#define ARENA_MAP_LOCK()	pthread_mutex_lock(&arenaMapLock)
+#define ARENA_MAP_UNLOCK()	pthread_mutex_unlock(&arenaMapLock)
+#else
+#define ARENA_MAP_LOCK()
+#define ARENA_MAP_UNLOCK()
+#endif
+#if ARENA_ATOMIC
+#define ARENA_MAP_EMPTY()	(ARENA_LOAD(&arenaMapBlocks) == 0)
+#define ARENA_MAP_RDLOCK()
+#define ARENA_MAP_RDUNLOCK()
+#else
+#define ARENA_MAP_EMPTY()	0
+#define ARENA_MAP_RDLOCK()	ARENA_MAP_LOCK()
+#define ARENA_MAP_RDUNLOCK()	ARENA_MAP_UNLOCK()
+#endif
+
+/* Free a list of replaced maps */
+static void ArenaMapFree(ArenaMap *map)
+{
+  while (map != NULL) {
+    ArenaMap *retired = map->retired;
+    free(map);
+    map = retired;
+  }
+}
+
+/* Add a block of an arena to the map, replacing the map; must be called with the lock held */
+static int ArenaMapAdd(LALArena *arena, const LALArenaBlock *block)
+{
+  ArenaMap *old = arenaMap;
+  const size_t oldn = (old != NULL) ? old->n : 0;
+  ArenaMap *map = malloc(sizeof(*map) + (oldn + 1) * sizeof(map->ranges[0]));
+  if (map == NULL) {
+    return 0;
+  }
+
+  /* copy the ranges of blocks which have not been freed, inserting the new block in order */
+  size_t n = 0;
+  int added = 0;
+  for (size_t i = 0; i < oldn; ++i) {
+    if (old->ranges[i].arena == NULL) {
+      continue;
+    }
+    if (!added && block->base < old->ranges[i].base) {
+      map->ranges[n++] = (ArenaRange) { block->base, block->base + block->size, arena };
+      added = 1;
+    }
+    map->ranges[n++] = old->ranges[i];
+  }
+  if (!added) {
+    map->ranges[n++] = (ArenaRange) { block->base, block->base + block->size, arena };
+  }
+  map->n = n;
+  map->retired = old;
+  ARENA_STORE_SC(&arenaMap, map);
+
+  /* free the replaced maps if no thread can still be searching them */
+  if (ARENA_LOAD_SC(&arenaMapReaders) == 0) {
+    ArenaMapFree(map->retired);
+    map->retired = NULL;
+  }
+
+  return 1;
+}
+
+/* Remove a block from the map; must be called with the lock held */
+static void ArenaMapRemove(const LALArenaBlock *block)
+{
+  ArenaMap *map = arenaMap;
+  size_t lo = 0, hi = (map != NULL) ? map->n : 0;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (map->ranges[mid].base < block->base) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (map != NULL && lo < map->n && map->ranges[lo].base == block->base) {
+    ARENA_STORE(&map->ranges[lo].arena, NULL);
+  }
+}
+
+/* Free all blocks of an arena; must be called with the lock held */
+static void ArenaFreeBlocks(LALArena *arena)
+{
+  while (arena->blocks != NULL) {
+    LALArenaBlock *next = arena->blocks->next;
+    ArenaMapRemove(arena->blocks);
+    free(arena->blocks);
+    arena->blocks = next;
+    ARENA_STORE(&arenaMapBlocks, ARENA_LOAD(&arenaMapBlocks) - 1);
+  }
+}
+
+/* Return whether the memory at p lies in a block of an arena */
+static int ArenaContains(const LALArena *arena, const void *p)
+{
+  const char *c = (const char *) p;
+  for (const LALArenaBlock *block = arena->blocks; block != NULL; block = block->next) {
+    if (block->base <= c && c < block->base + block->size) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/*
+ * Allocate a new block of at least n usable bytes and make it the head of
+ * the list; must be called with the lock held
+ */
+static LALArenaBlock *ArenaNewBlock(LALArena *arena, size_t n)
+{
+  size_t size = (n > arena->blocksize) ? n : arena->blocksize;
+  LALArenaBlock *block = malloc(sizeof(*block) + size + ARENA_ALIGN);
+  if (block == NULL) {
+    return NULL;
+  }
+  block->base = (char *) ARENA_ROUNDUP((uintptr_t) (block + 1));
+  block->size = size;
+  block->used = 0;
+  block->last = 0;
+  if (!ArenaMapAdd(arena, block)) {
+    free(block);
+    return NULL;
+  }
+  block->next = arena->blocks;
+  arena->blocks = block;
+  ++arena->nblockallocs;
+  ARENA_STORE(&arenaMapBlocks, ARENA_LOAD(&arenaMapBlocks) + 1);
+  return block;
+}
+
+/**
+ * Create an arena whose blocks hold at least \c blocksize bytes; if
+ * \c blocksize is zero, a default of 1 MiB is used.
+ */
+LALArena *XLALCreateArena(size_t blocksize)
+{
+  LALArena *arena = calloc(1, sizeof(*arena));
+  XLAL_CHECK_NULL(arena != NULL, XLAL_ENOMEM);
+  arena->blocksize = ARENA_ROUNDUP(blocksize > 0 ? blocksize : ARENA_DEFAULT_BLOCKSIZE);
+  return arena;
+}
+
+/**
+ * Destroy an arena and all memory allocated from it.  The arena must not
+ * be on the arena stack of any thread.
+ */
+void XLALDestroyArena(LALArena *arena)
+{
+  if (arena == NULL) {
+    return;
+  }
+  ARENA_MAP_LOCK();
+  ArenaFreeBlocks(arena);
+  ARENA_MAP_UNLOCK();
+  free(arena);
+}
+
+/**
+ * Release all memory allocated from an arena for reuse.  If the arena
+ * holds more than one block, they are replaced by a single block large
+ * enough for all of them.
+ */
+void XLALArenaReset(LALArena *arena)
+{
+  if (arena == NULL || arena->blocks == NULL) {
+    return;
+  }
+  if (arena->blocks->next != NULL) {
+    size_t total = 0;
+    for (const LALArenaBlock *block = arena->blocks; block != NULL; block = block->next) {
+      total += block->size;
+    }
+    ARENA_MAP_LOCK();
+    ArenaFreeBlocks(arena);
+    /* if this fails, the next allocation will try again */
+    ArenaNewBlock(arena, total);
+    ARENA_MAP_UNLOCK();
+  } else {
+    arena->blocks->used = 0;
+    arena->blocks->last = 0;
+  }
+  arena->used = 0;
+}
+
+/**
+ * Return the arena of the calling thread, creating it if needed.  The
+ * arena is destroyed when the thread exits.
+ */
+LALArena *XLALGetThreadArena(void)
+{
+  LALArenaStack *as = GetArenaStack(1);
+  XLAL_CHECK_NULL(as != NULL, XLAL_ENOMEM);
+  if (as->own == NULL) {
+    as->own = XLALCreateArena(0);
+    XLAL_CHECK_NULL(as->own != NULL, XLAL_EFUNC);
+  }
+  return as->own;
+}
+
+/**
+ * Push an arena onto the arena stack of the calling thread, so that
+ * factory functions called from this thread allocate from it.
+ */
+int XLALArenaPush(LALArena *arena)
+{
+  XLAL_CHECK(arena != NULL, XLAL_EFAULT);
+  LALArenaStack *as = GetArenaStack(1);
+  XLAL_CHECK(as != NULL, XLAL_ENOMEM);
+  XLAL_CHECK(as->depth < ARENA_STACK_MAX, XLAL_ESIZE, "Arena stack is full (maximum depth %i)", ARENA_STACK_MAX);
+  as->stack[as->depth++] = arena;
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Pop an arena, which must be the most recently pushed arena, from the
+ * arena stack of the calling thread.
+ */
+int XLALArenaPop(LALArena *arena)
+{
+  LALArenaStack *as = GetArenaStack(0);
+  XLAL_CHECK(as != NULL && as->depth > 0, XLAL_EINVAL, "Arena stack is empty");
+  XLAL_CHECK(as->stack[as->depth - 1] == arena, XLAL_EINVAL, "Arena is not at the top of the arena stack");
+  as->stack[--as->depth] = NULL;
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Return the arena at the top of the arena stack of the calling thread,
+ * or NULL if the stack is empty.
+ */
+LALArena *XLALGetCurrentArena(void)
+{
+  LALArenaStack *as = GetArenaStack(0);
+  return (as != NULL && as->depth > 0) ? as->stack[as->depth - 1] : NULL;
+}
+
+/** Return the number of bytes allocated from an arena since it was last reset. */
+size_t XLALArenaGetBytesUsed(const LALArena *arena)
+{
+  return arena ? arena->used : 0;
+}
+
+/** Return the number of blocks allocated by an arena with malloc() over its lifetime. */
+size_t XLALArenaGetNumBlockAllocs(const LALArena *arena)
+{
+  return arena ? arena->nblockallocs : 0;
+}
+
+/** Allocate \c n bytes, aligned to 64 bytes, from an arena. */
+void *XLALArenaAlloc(LALArena *arena, size_t n)
+{
+  XLAL_CHECK_NULL(arena != NULL, XLAL_EFAULT);
+  const size_t m = ARENA_ROUNDUP(n > 0 ? n : 1);
+  LALArenaBlock *block = arena->blocks;
+  if (block == NULL || block->size - block->used < m) {
+    ARENA_MAP_LOCK();
+    block = ArenaNewBlock(arena, m);
+    ARENA_MAP_UNLOCK();
+    XLAL_CHECK_NULL(block != NULL, XLAL_ENOMEM);
+  }
+  void *p = block->base + block->used;
+  block->last = block->used;
+  block->used += m;
+  arena->used += m;
+  return p;
+}
+
+/**
+ * Resize an allocation of \c oldn bytes at \c p, made from an arena, to
+ * \c n bytes.  The most recent allocation from an arena is resized in
+ * place if possible; otherwise a new allocation is made and the contents
+ * copied.
+ */
+void *XLALArenaRealloc(LALArena *arena, void *p, size_t oldn, size_t n)
+{
+  XLAL_CHECK_NULL(arena != NULL, XLAL_EFAULT);
+  if (p == NULL) {
+    return XLALArenaAlloc(arena, n);
+  }
+  LALArenaBlock *block = arena->blocks;
+  if (block != NULL && p == block->base + block->last) {
+    const size_t m = ARENA_ROUNDUP(n > 0 ? n : 1);
+    if (m <= block->size - block->last) {
+      arena->used += m;
+      arena->used -= block->used - block->last;
+      block->used = block->last + m;
+      return p;
+    }
+  }
+  void *q = XLALArenaAlloc(arena, n);
+  XLAL_CHECK_NULL(q != NULL, XLAL_EFUNC);
+  memcpy(q, p, (oldn < n) ? oldn : n);
+  return q;
+}
+
+/**
+ * Return the arena which owns the memory at \c p, or NULL if \c p was not
+ * allocated from any arena.  The owner is found whether or not it is pushed,
+ * and from any thread.
+ */
+LALArena *XLALArenaOwner(const void *p)
+{
+  if (p == NULL || ARENA_MAP_EMPTY()) {
+    return NULL;
+  }
+
+  /* arenas pushed by the calling thread are the likely owners, and their
+     blocks are changed only by this thread, so they are searched first
+     without touching the shared map */
+  LALArenaStack *as = GetArenaStack(0);
+  if (as != NULL) {
+    for (int i = as->depth - 1; i >= 0; --i) {
+      if (ArenaContains(as->stack[i], p)) {
+        return as->stack[i];
+      }
+    }
+  }
+
+  /* search the map; the map is not freed while arenaMapReaders is non-zero */
+  LALArena *owner = NULL;
+  const char *c = (const char *) p;
+  ARENA_MAP_RDLOCK();
+  ARENA_ADD_SC(&arenaMapReaders, 1);
+  const ArenaMap *map = ARENA_LOAD_SC(&arenaMap);
+  size_t lo = 0, hi = (map != NULL) ? map->n : 0;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (map->ranges[mid].end <= c) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (map != NULL && lo < map->n && map->ranges[lo].base <= c) {
+    owner = ARENA_LOAD(&map->ranges[lo].arena);
+  }
+  ARENA_SUB_RELEASE(&arenaMapReaders, 1);
+  ARENA_MAP_RDUNLOCK();
+  return owner;
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with with program; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ * MA  02111-1307  USA
+ */
+
+#ifndef _LALARENA_H
+#define _LALARENA_H
+
+#include <stddef.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#elif 0
+}       /* so that editors will match preceding brace */
+#endif
+
+/**
+ * \defgroup LALArena_h Header LALArena.h
+ * \ingroup lal_std
+ * \brief Arena (bump pointer) memory allocation for short-lived LAL objects
+ *
+ * ### Synopsis ###
+ * \code
+ * #include <lal/LALArena.h>
+ *
+ * LALArena *arena = XLALGetThreadArena();
+ * for (...) {
+ *   XLALArenaPush(arena);
+ *   COMPLEX16FrequencySeries *htilde = XLALCreateCOMPLEX16FrequencySeries(...);
+ *   ...
+ *   XLALDestroyCOMPLEX16FrequencySeries(htilde);
+ *   XLALArenaPop(arena);
+ *   XLALArenaReset(arena);
+ * }
+ * \endcode
+ *
+ * ### Description ###
+ *
+ * An arena hands out memory by advancing a pointer through large blocks,
+ * and releases all of it at once with XLALArenaReset().  After a reset,
+ * an arena which needed more than one block is rebuilt as a single block
+ * large enough for everything allocated before the reset, so that a loop
+ * which allocates the same objects on every iteration stops calling
+ * malloc() after its first iteration.
+ *
+ * While an arena is pushed onto the arena stack of a thread with
+ * XLALArenaPush(), the vector, vector sequence, sequence, time series and
+ * frequency series factory functions called from that thread allocate
+ * from the arena instead of the heap, and the corresponding destroy
+ * functions do not free memory owned by an arena; that memory is reused
+ * after the next XLALArenaReset().  The owner of memory is found by
+ * address among all arenas, so objects allocated from an arena may also
+ * be destroyed after the arena is popped, or from another thread.  Resize
+ * functions grow objects in place only if their arena is the current arena
+ * of the calling thread; otherwise the data are moved to the heap.
+ * Objects allocated from an arena must not be used after the arena is
+ * reset or destroyed.  For the same reason, functions which keep objects
+ * they create beyond the call, e.g. in a cache, should not be called while
+ * an arena is pushed.
+ *
+ * Each thread has its own arena, returned by XLALGetThreadArena(), which
+ * is destroyed when the thread exits.  Arena memory is obtained directly
+ * from malloc(), and is not tracked by LAL memory debugging.
+ */
+/** @{ */
+
+/** Opaque type of an arena */
+typedef struct tagLALArena LALArena;
+
+LALArena *XLALCreateArena(size_t blocksize);
+void XLALDestroyArena(LALArena *arena);
+void XLALArenaReset(LALArena *arena);
+LALArena *XLALGetThreadArena(void);
+
+int XLALArenaPush(LALArena *arena);
+int XLALArenaPop(LALArena *arena);
+LALArena *XLALGetCurrentArena(void);
+
+size_t XLALArenaGetBytesUsed(const LALArena *arena);
+size_t XLALArenaGetNumBlockAllocs(const LALArena *arena);
+
+#ifndef SWIG    /* exclude from SWIG interface */
+void *XLALArenaAlloc(LALArena *arena, size_t n);
+void *XLALArenaRealloc(LALArena *arena, void *p, size_t oldn, size_t n);
+LALArena *XLALArenaOwner(const void *p);
+#endif /* SWIG */
+
+/** @} */
+
+#if 0
+{       /* so that editors will match succeeding brace */
+#elif defined(__cplusplus)
+}
+#endif
+
+#endif /* _LALARENA_H */
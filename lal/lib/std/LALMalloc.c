@@ -31,6 +31,7 @@
 /* global variables */
 size_t lalMallocTotal = 0;	/**< current amount of memory allocated by process */
 size_t lalMallocTotalPeak = 0;	/**< peak amount of memory allocated so far */
+size_t lalMallocCount = 0;	/**< number of memory allocations made so far */
 
 /*
  *
@@ -219,12 +220,14 @@ void XLALFreeAligned(void *ptr)
 
 #ifdef LAL_PTHREAD_LOCK
 #include <pthread.h>
-static pthread_mutex_t mut = PTHREAD_MUTEX_INITIALIZER;
 #else
 #define pthread_mutex_lock( pmut )
 #define pthread_mutex_unlock( pmut )
 #endif
 
+#include <stdint.h>
+#include <sys/time.h>
+
 #include <lal/LALStdlib.h>
 
 /* global variables to assist in memory debugging */
@@ -248,157 +251,567 @@ static const size_t magic = 0xABadCafe;
 
 #define allocsz(n) ((lalDebugLevel & LALMEMPADBIT) ? (padFactor * (n) + prefix) : (n))
 
-/* Hash table implementation taken from src/utilities/LALHashTbl.c */
+/*
+ * Memory counters and allocation trackers (see below) are updated with
+ * atomic operations where the compiler provides them, so that allocations
+ * from different threads never take a lock.  If the compiler does not
+ * provide atomic builtins, they are updated under a global lock, which is
+ * taken by MEM_LOCK().
+ */
+#if !defined(LAL_PTHREAD_LOCK)
+#define MEM_ATOMIC 1
+#elif defined(__GNUC__)
+#define MEM_ATOMIC 1
+#define MEM_LOAD(p)		__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define MEM_STORE(p,v)		__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define MEM_ADD(p,v)		__atomic_add_fetch((p), (v), __ATOMIC_RELAXED)
+#define MEM_SUB(p,v)		__atomic_sub_fetch((p), (v), __ATOMIC_RELAXED)
+#define MEM_CAS(p,e,v)		__atomic_compare_exchange_n((p), (e), (v), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#define MEM_XCHG(p,v)		__atomic_exchange_n((p), (v), __ATOMIC_ACQ_REL)
+#define MEM_SUB_RELEASE(p,v)	__atomic_sub_fetch((p), (v), __ATOMIC_RELEASE)
+#define MEM_LOAD_SC(p)		__atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define MEM_STORE_SC(p,v)	__atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#define MEM_ADD_SC(p,v)		__atomic_add_fetch((p), (v), __ATOMIC_SEQ_CST)
+#else
+#define MEM_ATOMIC 0
+static pthread_mutex_t mem_counter_mut = PTHREAD_MUTEX_INITIALIZER;
+#endif
+#if !defined(MEM_LOAD)
+#define MEM_LOAD(p)		(*(p))
+#define MEM_STORE(p,v)		(*(p) = (v))
+#define MEM_ADD(p,v)		(*(p) += (v))
+#define MEM_SUB(p,v)		(*(p) -= (v))
+#define MEM_CAS(p,e,v)		((*(p) == *(e)) ? (*(p) = (v), 1) : (*(e) = *(p), 0))
+#define MEM_XCHG(p,v)		MemExchange((void **)(p), (v))
+#define MEM_SUB_RELEASE(p,v)	(*(p) -= (v))
+#define MEM_LOAD_SC(p)		(*(p))
+#define MEM_STORE_SC(p,v)	(*(p) = (v))
+#define MEM_ADD_SC(p,v)		(*(p) += (v))
+static void *MemExchange(void **p, void *v)
+{
+    void *old = *p;
+    *p = v;
+    return old;
+}
+#endif
+#if MEM_ATOMIC
+#define MEM_LOCK()		do { } while(0)
+#define MEM_UNLOCK()		do { } while(0)
+#else
+#define MEM_LOCK()		pthread_mutex_lock(&mem_counter_mut)
+#define MEM_UNLOCK()		pthread_mutex_unlock(&mem_counter_mut)
+#endif
 
-static struct allocNode {
-    void *addr;
-    size_t size;
+/* Add n bytes to the counter *total, and update the peak counter *peak */
+static void MemCounterAdd(size_t *total, size_t *peak, size_t n)
+{
+#if MEM_ATOMIC
+    size_t t = MEM_ADD(total, n);
+    size_t p = MEM_LOAD(peak);
+    while (p < t && !MEM_CAS(peak, &p, t)) {
+        /* p is updated to the current peak on failure */
+    }
+#else
+    pthread_mutex_lock(&mem_counter_mut);
+    *total += n;
+    *peak = (*peak > *total) ? *peak : *total;
+    pthread_mutex_unlock(&mem_counter_mut);
+#endif
+}
+
+/* Increment the counter *count */
+static void MemCounterIncr(size_t *count)
+{
+#if MEM_ATOMIC
+    MEM_ADD(count, 1);
+#else
+    pthread_mutex_lock(&mem_counter_mut);
+    *count += 1;
+    pthread_mutex_unlock(&mem_counter_mut);
+#endif
+}
+
+/* Subtract n bytes from the counter *total */
+static void MemCounterSub(size_t *total, size_t n)
+{
+#if MEM_ATOMIC
+    MEM_SUB(total, n);
+#else
+    pthread_mutex_lock(&mem_counter_mut);
+    *total -= n;
+    pthread_mutex_unlock(&mem_counter_mut);
+#endif
+}
+
+/*
+ * Allocation statistics for each call site, identified by the file name
+ * pointer and line number passed to LALMallocLong() etc.  Call sites are
+ * stored in a fixed-size hash table with open addressing; new call sites
+ * are inserted with a compare-and-swap, so lookups never take a lock.
+ * Call sites which do not fit into the table are accumulated together.
+ */
+
+struct allocSite {
     const char *file;
     int line;
-} **alloc_data = NULL;		/* Allocation hash table with open addressing and linear probing */
-static int alloc_data_len = 0;	/* Size of the memory block 'alloc_data', in number of elements */
-static int alloc_n = 0;		/* Number of valid elements in the hash */
-static int alloc_q = 0;		/* Number of non-NULL elements in the hash */
+    size_t count;		/* number of allocations */
+    size_t bytes;		/* total number of bytes allocated */
+    size_t live;		/* number of bytes currently allocated */
+    size_t peak;		/* peak number of bytes allocated */
+};
 
-/* Special allocation hash table element value to indicate elements that have been deleted */
-static const void *hash_del = 0;
-#define DEL   ((struct allocNode*) &hash_del)
+enum { alloc_sites_len = 4096 };
+static struct allocSite *alloc_sites[alloc_sites_len];
+static struct allocSite alloc_site_other = { .file = "(other call sites)", .line = -1 };
 
-/* Evaluates to the hash value of x, restricted to the length of the allocation hash table */
-#define HASHIDX(x)   ((int)( ((intptr_t)( (x)->addr )) % alloc_data_len ))
+static struct allocSite *AllocSiteGet(const char *file, int line)
+{
+    size_t i = ((((uintptr_t) file) >> 3) * 31 + (size_t) line) % alloc_sites_len;
+    struct allocSite *newsite = NULL;
+    for (int k = 0; k < alloc_sites_len; ++k) {
+#if MEM_ATOMIC
+        struct allocSite *site = MEM_LOAD(&alloc_sites[i]);
+        if (site == NULL) {
+            if (newsite == NULL) {
+                if (!(newsite = calloc(1, sizeof(*newsite)))) {
+                    return &alloc_site_other;
+                }
+                newsite->file = file;
+                newsite->line = line;
+            }
+            if (MEM_CAS(&alloc_sites[i], &site, newsite)) {
+                return newsite;
+            }
+            /* site now holds the call site inserted by another thread */
+        }
+#else
+        pthread_mutex_lock(&mem_counter_mut);
+        struct allocSite *site = alloc_sites[i];
+        if (site == NULL) {
+            if ((site = calloc(1, sizeof(*site)))) {
+                site->file = file;
+                site->line = line;
+                alloc_sites[i] = site;
+            }
+            pthread_mutex_unlock(&mem_counter_mut);
+            return site ? site : &alloc_site_other;
+        }
+        pthread_mutex_unlock(&mem_counter_mut);
+#endif
+        if (site->file == file && site->line == line) {
+            free(newsite);
+            return site;
+        }
+        i = (i + 1) % alloc_sites_len;
+    }
+    free(newsite);
+    return &alloc_site_other;
+}
 
-/* Increment the next hash index, restricted to the length of the allocation hash table */
-#define INCRIDX(i)   do { if (++(i) == alloc_data_len) { (i) = 0; } } while(0)
+/* Record an allocation of n bytes at a call site */
+static void AllocSiteAdd(struct allocSite *site, size_t n)
+{
+#if MEM_ATOMIC
+    MEM_ADD(&site->count, 1);
+    MEM_ADD(&site->bytes, n);
+#else
+    pthread_mutex_lock(&mem_counter_mut);
+    site->count += 1;
+    site->bytes += n;
+    pthread_mutex_unlock(&mem_counter_mut);
+#endif
+    MemCounterAdd(&site->live, &site->peak, n);
+}
 
-/* Evaluates true if the elements x and y are equal */
-#define EQUAL(x, y)   ((x)->addr == (y)->addr)
+/* Time of the first tracked allocation, used to compute allocation rates */
+static double alloc_start_time = 0;
 
-/* need this to turn off gcc warnings about unused functions */
-#ifdef __GNUC__
-#define UNUSED __attribute__ ((unused))
+static double AllocTimeOfDay(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+/*
+ * Allocations are tracked by allocation trackers, one per thread.  Each
+ * tracker keeps the nodes of the allocations made by its thread in a hash
+ * table keyed on the address of the allocation, which only that thread
+ * modifies, so that allocations never take a lock.  Memory passed to
+ * LALFree() etc. is looked up in the trackers before its padding prefix is
+ * read, so that memory not allocated by LALMalloc() is detected without
+ * reading outside it.
+ *
+ * Memory freed by its allocating thread is removed from the tracker
+ * directly.  Memory freed by another thread is found by searching the hash
+ * tables of the other trackers; its node is claimed by atomically clearing
+ * its address, and pushed onto a stack of the tracker, from which the
+ * allocating thread removes it on its next allocation or deallocation.  So
+ * that other threads can search a hash table while its owner modifies it,
+ * nodes are recycled but never freed, and a hash table which has been
+ * replaced by a larger one is only freed once no other thread is searching
+ * the tracker.
+ *
+ * Trackers are never destroyed, since memory may be freed after the thread
+ * that allocated it has exited; instead the tracker of an exited thread is
+ * taken over by the next new thread.
+ */
+
+struct allocTracker;
+
+struct allocNode {
+    void *addr;			/* Address of the allocation; NULL once freed */
+    void *key;			/* Address under which the node is stored in the hash table of its tracker */
+    size_t size;
+    const char *file;
+    int line;
+    struct allocSite *site;
+    struct allocTracker *owner;
+    struct allocNode *next;	/* Next node in the stack of nodes freed by other threads, or of spare nodes */
+};
+
+struct allocTable {
+    size_t len;			/* Number of slots, a power of 2 */
+    struct allocTable *retired;	/* Replaced hash tables which have not yet been freed */
+    struct allocNode *slots[];	/* Nodes, with open addressing and linear probing */
+};
+
+struct allocTracker {
+    struct allocTracker *next;	/* Next tracker in the list of all trackers */
+    int active;			/* Whether the tracker belongs to a running thread */
+    int readers;		/* Number of other threads searching the hash table */
+    struct allocTable *table;	/* Hash table of nodes; only modified by the owning thread */
+    size_t n;			/* Number of nodes in the hash table */
+    size_t q;			/* Number of used or deleted slots in the hash table */
+    struct allocNode *spare;	/* Stack of spare nodes; only used by the owning thread */
+    struct allocNode *freed;	/* Stack of nodes freed by other threads */
+};
+
+static struct allocTracker *alloc_trackers = NULL;
+
+/* Special hash table slot value to indicate nodes that have been removed; never matches any address */
+static struct allocNode alloc_node_del;
+#define DEL   (&alloc_node_del)
+
+/* Evaluates to the hash table index of the address x, in a hash table of length len */
+#define TBLIDX(x, len)   ((((size_t)(uintptr_t)(x) >> 4) * 2654435761u) & ((len) - 1))
+
+#ifdef LAL_PTHREAD_LOCK
+static pthread_once_t alloc_once = PTHREAD_ONCE_INIT;
+static pthread_key_t alloc_tracker_key;
 #else
-#define UNUSED
+static struct allocTracker *alloc_tracker = NULL;
 #endif
 
-/* Resize and rebuild the allocation allocation hash table */
-UNUSED static int AllocHashTblResize(void)
+#ifdef LAL_PTHREAD_LOCK
+/* Give up the tracker of an exiting thread */
+static void AllocTrackerRelease(void *t)
 {
-    struct allocNode **old_data = alloc_data;
-    int old_data_len = alloc_data_len;
-    alloc_data_len = 2;
-    while (alloc_data_len < 3*alloc_n) {
-        alloc_data_len *= 2;
+    MEM_LOCK();
+    MEM_STORE(&((struct allocTracker *) t)->active, 0);
+    MEM_UNLOCK();
+}
+#endif
+
+static void AllocInitOnce(void)
+{
+#ifdef LAL_PTHREAD_LOCK
+    pthread_key_create(&alloc_tracker_key, AllocTrackerRelease);
+#endif
+    alloc_start_time = AllocTimeOfDay();
+}
+
+static void AllocInit(void)
+{
+#ifdef LAL_PTHREAD_LOCK
+    pthread_once(&alloc_once, AllocInitOnce);
+#else
+    static int init = 0;
+    if (!init) {
+        AllocInitOnce();
+        init = 1;
     }
-    alloc_data = calloc(alloc_data_len, sizeof(alloc_data[0]));
-    if (alloc_data == NULL) {
-        return 0;
+#endif
+}
+
+/* Take over the tracker of an exited thread, or else create a new tracker */
+static struct allocTracker *AllocTrackerAcquire(void)
+{
+    struct allocTracker *t;
+    MEM_LOCK();
+    for (t = MEM_LOAD(&alloc_trackers); t != NULL; t = t->next) {
+        int active = 0;
+        if (MEM_CAS(&t->active, &active, 1)) {
+            MEM_UNLOCK();
+            return t;
+        }
     }
-    alloc_q = alloc_n;
-    for (int k = 0; k < old_data_len; ++k) {
-        if (old_data[k] != NULL && old_data[k] != DEL) {
-            int i = HASHIDX(old_data[k]);
-            while (alloc_data[i] != NULL) {
-                INCRIDX(i);
-            }
-            alloc_data[i] = old_data[k];
+    MEM_UNLOCK();
+    if (!(t = calloc(1, sizeof(*t)))) {
+        return NULL;
+    }
+    t->active = 1;
+    MEM_LOCK();
+    t->next = MEM_LOAD(&alloc_trackers);
+    while (!MEM_CAS(&alloc_trackers, &t->next, t)) {
+        /* t->next is updated to the current list on failure */
+    }
+    MEM_UNLOCK();
+    return t;
+}
+
+/* Return the tracker of this thread */
+static struct allocTracker *AllocTrackerGet(void)
+{
+    AllocInit();
+#ifdef LAL_PTHREAD_LOCK
+    struct allocTracker *t = pthread_getspecific(alloc_tracker_key);
+    if (t == NULL) {
+        if (!(t = AllocTrackerAcquire())) {
+            return NULL;
+        }
+        if (pthread_setspecific(alloc_tracker_key, t) != 0) {
+            AllocTrackerRelease(t);
+            return NULL;
         }
     }
-    free(old_data);
-    return 1;
+    return t;
+#else
+    if (alloc_tracker == NULL) {
+        alloc_tracker = AllocTrackerAcquire();
+    }
+    return alloc_tracker;
+#endif
 }
 
-/* Find node in allocation hash table */
-UNUSED static struct allocNode *AllocHashTblFind(struct allocNode *x)
+/*
+ * The following functions operate on the data structures of trackers.  If
+ * the compiler does not provide atomic builtins, they must be called with
+ * MEM_LOCK() held.
+ */
+
+/* Returns the node of the memory x in a hash table, or NULL if x is not found; may be called by any thread */
+static struct allocNode *AllocTableFind(struct allocTable *tbl, void *x)
 {
-    struct allocNode *y = NULL;
-    if (alloc_data_len > 0) {
-        int i = HASHIDX(x);
-        while (alloc_data[i] != NULL) {
-            y = alloc_data[i];
-            if (y != DEL && EQUAL(x, y)) {
-                return y;
+    if (tbl != NULL) {
+        size_t i = TBLIDX(x, tbl->len);
+        for (size_t k = 0; k < tbl->len; ++k) {
+            struct allocNode *node = MEM_LOAD(&tbl->slots[i]);
+            if (node == NULL) {
+                break;
             }
-            INCRIDX(i);
+            if (MEM_LOAD(&node->addr) == x) {
+                return node;
+            }
+            i = (i + 1) & (tbl->len - 1);
         }
     }
     return NULL;
 }
 
-/* Add node to allocation hash table */
-UNUSED static int AllocHashTblAdd(struct allocNode *x)
+/* Free a list of replaced hash tables */
+static void AllocTableFree(struct allocTable *tbl)
 {
-    if (2*(alloc_q + 1) > alloc_data_len) {
-        /* Resize allocation hash table to preserve maximum 50% occupancy */
-        if (!AllocHashTblResize()) {
+    while (tbl != NULL) {
+        struct allocTable *retired = tbl->retired;
+        free(tbl);
+        tbl = retired;
+    }
+}
+
+/* Make room in a tracker for one more node, and a spare node; must be called by the owning thread */
+static int AllocTrackerReserve(struct allocTracker *t)
+{
+    if (t->spare == NULL) {
+        if (!(t->spare = malloc(sizeof(*t->spare)))) {
             return 0;
         }
+        t->spare->next = NULL;
     }
-    int i = HASHIDX(x);
-    while (alloc_data[i] != NULL && alloc_data[i] != DEL) {
-        INCRIDX(i);
+    struct allocTable *old = t->table;
+    if (old != NULL && 2 * (t->q + 1) <= old->len) {
+        return 1;
     }
-    if (alloc_data[i] == NULL) {
-        ++alloc_q;
+
+    /* rebuild the hash table without deleted slots, at no more than 25% occupancy */
+    size_t len = 64;
+    while (len < 4 * (t->n + 1)) {
+        len *= 2;
     }
-    ++alloc_n;
-    alloc_data[i] = x;
+    struct allocTable *tbl = calloc(1, sizeof(*tbl) + len * sizeof(tbl->slots[0]));
+    if (tbl == NULL) {
+        return 0;
+    }
+    tbl->len = len;
+    if (old != NULL) {
+        for (size_t k = 0; k < old->len; ++k) {
+            struct allocNode *node = old->slots[k];
+            if (node != NULL && node != DEL) {
+                size_t i = TBLIDX(node->key, len);
+                while (tbl->slots[i] != NULL) {
+                    i = (i + 1) & (len - 1);
+                }
+                tbl->slots[i] = node;
+            }
+        }
+        tbl->retired = old;
+    }
+    t->q = t->n;
+    MEM_STORE_SC(&t->table, tbl);
+
+    /* free the replaced hash tables if no other thread can still be searching them */
+    if (MEM_LOAD_SC(&t->readers) == 0) {
+        AllocTableFree(tbl->retired);
+        tbl->retired = NULL;
+    }
+
     return 1;
 }
 
-/* Extract node from allocation hash table */
-UNUSED static struct allocNode *AllocHashTblExtract(struct allocNode *x)
-{
-    if (alloc_data_len > 0) {
-        int i = HASHIDX(x);
-        while (alloc_data[i] != NULL) {
-            struct allocNode *y = alloc_data[i];
-            if (y != DEL && EQUAL(x, y)) {
-                alloc_data[i] = DEL;
-                --alloc_n;
-                if (alloc_n == 0) {
-                    /* Free all hash table memory */
-                    free(alloc_data);
-                    alloc_data = NULL;
-                    alloc_data_len = 0;
-                    alloc_q = 0;
-                } else if (8*alloc_n < alloc_data_len) {
-                    /* Resize hash table to preserve minimum 50% occupancy */
-                    if (!AllocHashTblResize()) {
-                        return NULL;
-                    }
-                }
-                return y;
+/* Add a spare node to the hash table of a tracker, as the node of the memory x; AllocTrackerReserve() must have succeeded */
+static struct allocNode *AllocTrackerAdd(struct allocTracker *t, void *x, size_t n, const char *file, int line, struct allocSite *site)
+{
+    struct allocNode *node = t->spare;
+    struct allocTable *tbl = t->table;
+    size_t i = TBLIDX(x, tbl->len);
+    t->spare = node->next;
+    node->key = x;
+    node->size = n;
+    node->file = file;
+    node->line = line;
+    node->site = site;
+    node->owner = t;
+    node->next = NULL;
+    MEM_STORE(&node->addr, x);
+    while (tbl->slots[i] != NULL && tbl->slots[i] != DEL) {
+        i = (i + 1) & (tbl->len - 1);
+    }
+    if (tbl->slots[i] == NULL) {
+        ++t->q;
+    }
+    ++t->n;
+    MEM_STORE(&tbl->slots[i], node);
+    return node;
+}
+
+/* Remove a freed node from the hash table of a tracker, and keep it as a spare; must be called by the owning thread */
+static void AllocTrackerRemove(struct allocTracker *t, struct allocNode *node)
+{
+    struct allocTable *tbl = t->table;
+    size_t i = TBLIDX(node->key, tbl->len);
+    while (tbl->slots[i] != node) {
+        i = (i + 1) & (tbl->len - 1);
+    }
+    MEM_STORE(&tbl->slots[i], DEL);
+    --t->n;
+    node->next = t->spare;
+    t->spare = node;
+}
+
+/* Remove nodes freed by other threads from a tracker; must be called by the owning thread */
+static void AllocTrackerCollect(struct allocTracker *t)
+{
+    struct allocNode *node = (MEM_LOAD(&t->freed) != NULL) ? MEM_XCHG(&t->freed, NULL) : NULL;
+    while (node != NULL) {
+        struct allocNode *freed = node->next;
+        AllocTrackerRemove(t, node);
+        node = freed;
+    }
+}
+
+/*
+ * Returns the node of the memory x, or NULL if x is not tracked; the
+ * tracker t of this thread, if any, is searched first.  If claim is true,
+ * the node is claimed by clearing its address, so that it is only freed
+ * once, and must then be passed to AllocNodeFree().
+ */
+static struct allocNode *AllocNodeFind(struct allocTracker *t, void *x, int claim)
+{
+    struct allocNode *node;
+    void *addr;
+    if (t != NULL && (node = AllocTableFind(t->table, x)) != NULL) {
+        addr = x;
+        if (!claim || MEM_CAS(&node->addr, &addr, NULL)) {
+            return node;
+        }
+    }
+    for (struct allocTracker *u = MEM_LOAD(&alloc_trackers); u != NULL; u = u->next) {
+        if (u == t) {
+            continue;
+        }
+        /* the hash table of u is not freed while u->readers is non-zero */
+        MEM_ADD_SC(&u->readers, 1);
+        node = AllocTableFind(MEM_LOAD_SC(&u->table), x);
+        if (node != NULL && claim) {
+            addr = x;
+            if (!MEM_CAS(&node->addr, &addr, NULL)) {
+                node = NULL;
             }
-            INCRIDX(i);
+        }
+        MEM_SUB_RELEASE(&u->readers, 1);
+        if (node != NULL) {
+            return node;
         }
     }
     return NULL;
 }
 
+/* Return a node claimed by AllocNodeFind() to its tracker */
+static void AllocNodeFree(struct allocTracker *t, struct allocNode *node)
+{
+    struct allocTracker *owner = node->owner;
+    if (owner == t) {
+        AllocTrackerRemove(t, node);
+    } else {
+        /* node is removed by its owning thread */
+        node->next = MEM_LOAD(&owner->freed);
+        while (!MEM_CAS(&owner->freed, &node->next, node)) {
+            /* node->next is updated to the current stack on failure */
+        }
+    }
+}
+
+
+/* need this to turn off gcc warnings about unused functions */
+#ifdef __GNUC__
+#define UNUSED __attribute__ ((unused))
+#else
+#define UNUSED
+#endif
 
 /* Useful function for debugging */
 /* Checks to make sure alloc list is OK */
 /* Returns 0 if list is corrupted; 1 if list is OK */
 UNUSED static int CheckAllocList(void)
 {
-    int count = 0;
     size_t total = 0;
-    for (int k = 0; k < alloc_data_len; ++k) {
-        if (alloc_data[k] != NULL && alloc_data[k] != DEL) {
-            ++count;
-            total += alloc_data[k]->size;
+    for (struct allocTracker *t = MEM_LOAD(&alloc_trackers); t != NULL; t = t->next) {
+        struct allocTable *tbl = MEM_LOAD(&t->table);
+        for (size_t k = 0; tbl != NULL && k < tbl->len; ++k) {
+            struct allocNode *node = MEM_LOAD(&tbl->slots[k]);
+            if (node != NULL && node != DEL) {
+                if (node->owner != t) {
+                    return 0;
+                }
+                if (MEM_LOAD(&node->addr) != NULL) {
+                    total += node->size;
+                }
+            }
         }
     }
-    return count == alloc_n && total == lalMallocTotal;
+    return total == MEM_LOAD(&lalMallocTotal);
 }
 
 /* Useful function for debugging */
 /* Finds the node of the alloc list for the desired alloc */
 /* Returns NULL if not found  */
-UNUSED static struct allocNode *FindAlloc(void *p)
+static struct allocNode *FindAlloc(void *p)
 {
-    struct allocNode key = { .addr = p };
-    return AllocHashTblFind(&key);
+    struct allocTracker *t = AllocTrackerGet();
+    MEM_LOCK();
+    struct allocNode *node = AllocNodeFind(t, p, 0);
+    MEM_UNLOCK();
+    return node;
 }
 
 
@@ -428,10 +841,8 @@ static void *PadAlloc(size_t * p, size_t n, int keep, const char *func)
         ((char *) p)[i + prefix] = (char) (i ^ padding);
     }
 
-    pthread_mutex_lock(&mut);
-    lalMallocTotal += n;
-    lalMallocTotalPeak = (lalMallocTotalPeak > lalMallocTotal) ? lalMallocTotalPeak : lalMallocTotal;
-    pthread_mutex_unlock(&mut);
+    MemCounterAdd(&lalMallocTotal, &lalMallocTotalPeak, n);
+    MemCounterIncr(&lalMallocCount);
 
     return (void *) (((char *) p) + prefix);
 }
@@ -440,6 +851,7 @@ static void *PadAlloc(size_t * p, size_t n, int keep, const char *func)
 static void *UnPadAlloc(void *p, int keep, const char *func)
 {
     size_t n;
+    size_t total;
     size_t i;
     size_t *q;
     char *s;
@@ -495,7 +907,10 @@ static void *UnPadAlloc(void *p, int keep, const char *func)
     }
 
     /* see if there is enough allocated memory to be freed */
-    if (lalMallocTotal < n) {
+    MEM_LOCK();
+    total = MEM_LOAD(&lalMallocTotal);
+    MEM_UNLOCK();
+    if (total < n) {
         lalRaiseHook(SIGSEGV, "%s error: lalMallocTotal too small\n",
                      func);
         return NULL;
@@ -509,88 +924,127 @@ static void *UnPadAlloc(void *p, int keep, const char *func)
     q[0] = -1;  /* set negative to detect duplicate frees */
     q[1] = ~magic;
 
-    pthread_mutex_lock(&mut);
-    lalMallocTotal -= n;
-    pthread_mutex_unlock(&mut);
+    MemCounterSub(&lalMallocTotal, n);
 
     return q;
 }
 
 
-static void *PushAlloc(void *p, size_t n, const char *file, int line)
+/* Track the padded memory p; if it cannot be tracked, remove its padding and return NULL */
+static void *PushAlloc(void *p, size_t n, const char *func, const char *file, int line)
 {
-    struct allocNode *newnode;
+    struct allocTracker *t;
+    struct allocSite *site;
+    int ok;
     if (!(lalDebugLevel & LALMEMTRKBIT)) {
         return p;
     }
     if (!p) {
         return NULL;
     }
-    if (!(newnode = malloc(sizeof(*newnode)))) {
+    site = AllocSiteGet(file, line);
+    if (!(t = AllocTrackerGet())) {
+        UnPadAlloc(p, 0, func);
         return NULL;
     }
-    pthread_mutex_lock(&mut);
-    newnode->addr = p;
-    newnode->size = n;
-    newnode->file = file;
-    newnode->line = line;
-    if (!AllocHashTblAdd(newnode)) {
-        free(newnode);
+    MEM_LOCK();
+    AllocTrackerCollect(t);
+    ok = AllocTrackerReserve(t);
+    if (ok) {
+        AllocTrackerAdd(t, p, n, file, line, site);
+    }
+    MEM_UNLOCK();
+    if (!ok) {
+        UnPadAlloc(p, 0, func);
         return NULL;
     }
-    pthread_mutex_unlock(&mut);
+    AllocSiteAdd(site, n);
     return p;
 }
 
 
+/* Make room to track one more allocation by this thread */
+static int ReserveAlloc(void)
+{
+    struct allocTracker *t;
+    int ok;
+    if (!(lalDebugLevel & LALMEMTRKBIT)) {
+        return 1;
+    }
+    if (!(t = AllocTrackerGet())) {
+        return 0;
+    }
+    MEM_LOCK();
+    AllocTrackerCollect(t);
+    ok = AllocTrackerReserve(t);
+    MEM_UNLOCK();
+    return ok;
+}
+
+
 static void *PopAlloc(void *p, const char *func)
 {
+    struct allocTracker *t;
+    struct allocNode *node;
+    struct allocSite *site = NULL;
+    size_t n = 0;
     if (!(lalDebugLevel & LALMEMTRKBIT)) {
         return p;
     }
     if (!p) {
         return NULL;
     }
-    pthread_mutex_lock(&mut);
-    struct allocNode key = { .addr = p };
-    struct allocNode *node = AllocHashTblExtract(&key);
-    if (node == NULL) {
-        pthread_mutex_unlock(&mut);
+    t = AllocTrackerGet();
+    MEM_LOCK();
+    if (t != NULL) {
+        AllocTrackerCollect(t);
+    }
+    if ((node = AllocNodeFind(t, p, 1)) != NULL) {
+        site = node->site;
+        n = node->size;
+        AllocNodeFree(t, node);
+    }
+    MEM_UNLOCK();
+    if (!node) {
         lalRaiseHook(SIGSEGV, "%s error: alloc %p not found\n", func, p);
         return NULL;
     }
-    free(node);
-    pthread_mutex_unlock(&mut);
+    MemCounterSub(&site->live, n);
     return p;
 }
 
 
+/* Move the tracking of the memory p to the memory q; ReserveAlloc() must have succeeded */
 static void *ModAlloc(void *p, void *q, size_t n, const char *func,
                       const char *file, int line)
 {
+    struct allocTracker *t;
+    struct allocNode *node;
+    struct allocSite *site;
+    struct allocSite *oldsite = NULL;
+    size_t oldn = 0;
     if (!(lalDebugLevel & LALMEMTRKBIT)) {
         return q;
     }
     if (!p || !q) {
         return NULL;
     }
-    pthread_mutex_lock(&mut);
-    struct allocNode key = { .addr = p };
-    struct allocNode *node = AllocHashTblExtract(&key);
-    if (node == NULL) {
-        pthread_mutex_unlock(&mut);
-        lalRaiseHook(SIGSEGV, "%s error: alloc %p not found\n", func, p);
-        return NULL;
+    site = AllocSiteGet(file, line);
+    t = AllocTrackerGet();
+    MEM_LOCK();
+    if ((node = AllocNodeFind(t, p, 1)) != NULL) {
+        oldsite = node->site;
+        oldn = node->size;
+        AllocNodeFree(t, node);
+        AllocTrackerAdd(t, q, n, file, line, site);
     }
-    node->addr = q;
-    node->size = n;
-    node->file = file;
-    node->line = line;
-    if (!AllocHashTblAdd(node)) {
-        free(node);
+    MEM_UNLOCK();
+    if (!node) {
+        lalRaiseHook(SIGSEGV, "%s error: alloc %p not found\n", func, p);
         return NULL;
     }
-    pthread_mutex_unlock(&mut);
+    MemCounterSub(&oldsite->live, oldn);
+    AllocSiteAdd(site, n);
     return q;
 }
 
@@ -613,7 +1067,7 @@ void *LALMallocLong(size_t n, const char *file, int line)
     }
 
     p = malloc(allocsz(n));
-    q = PushAlloc(PadAlloc(p, n, 0, "LALMalloc"), n, file, line);
+    q = PushAlloc(PadAlloc(p, n, 0, "LALMalloc"), n, "LALMalloc", file, line);
     lalMemDbgPtr = lalMemDbgRetPtr = q;
     lalIsMemDbgPtr = lalIsMemDbgRetPtr = (lalMemDbgRetPtr == lalMemDbgUsrPtr);
     if (!q) {
@@ -651,7 +1105,7 @@ void *LALCallocLong(size_t m, size_t n, const char *file, int line)
 
     sz = m * n;
     p = malloc(allocsz(sz));
-    q = PushAlloc(PadAlloc(p, sz, 1, "LALCalloc"), sz, file, line);
+    q = PushAlloc(PadAlloc(p, sz, 1, "LALCalloc"), sz, "LALCalloc", file, line);
     lalMemDbgPtr = lalMemDbgRetPtr = q;
     lalIsMemDbgPtr = lalIsMemDbgRetPtr = (lalMemDbgRetPtr == lalMemDbgUsrPtr);
     if (!q) {
@@ -679,6 +1133,8 @@ void *LALReallocShort(void *p, size_t n)
 void *LALReallocLong(void *q, size_t n, const char *file, const int line)
 {
     void *p;
+    void *r;
+    size_t oldn = 0;
     if (!(lalDebugLevel & LALMEMDBGBIT)) {
         return realloc(q, n);
     }
@@ -687,7 +1143,7 @@ void *LALReallocLong(void *q, size_t n, const char *file, const int line)
     lalIsMemDbgPtr = lalIsMemDbgArgPtr = (lalMemDbgArgPtr == lalMemDbgUsrPtr);
     if (!q) {
         p = malloc(allocsz(n));
-        q = PushAlloc(PadAlloc(p, n, 0, "LALRealloc"), n, file, line);
+        q = PushAlloc(PadAlloc(p, n, 0, "LALRealloc"), n, "LALRealloc", file, line);
         if (!q) {
             XLALPrintError("LALMalloc: failed to allocate %zd bytes of memory\n", n);
             XLALPrintError("LALMalloc: %zd bytes of memory already allocated\n", lalMallocTotal);
@@ -709,16 +1165,45 @@ void *LALReallocLong(void *q, size_t n, const char *file, const int line)
         return NULL;
     }
 
+    /* check that q is tracked before its padding is read, and that its reallocation can be tracked */
+    if ((lalDebugLevel & LALMEMTRKBIT) && !FindAlloc(q)) {
+        lalRaiseHook(SIGSEGV, "LALRealloc error: alloc %p not found\n", q);
+        return NULL;
+    }
+    if (!ReserveAlloc()) {
+        goto failed;
+    }
+
+    if (lalDebugLevel & LALMEMPADBIT) {
+        oldn = ((size_t *) q)[-nprefix];
+    }
     p = UnPadAlloc(q, 1, "LALRealloc");
     if (!p) {
         return NULL;
     }
 
-    q = ModAlloc(q, PadAlloc(realloc(p, allocsz(n)), n, 1, "LALRealloc"), n, "LALRealloc", file, line);
+    r = realloc(p, allocsz(n));
+    if (!r) {
+        /* p is unchanged and still tracked as q, so restore its padding */
+        PadAlloc(p, oldn, 1, "LALRealloc");
+        goto failed;
+    }
+
+    q = ModAlloc(q, PadAlloc(r, n, 1, "LALRealloc"), n, "LALRealloc", file, line);
     lalMemDbgPtr = lalMemDbgRetPtr = q;
     lalIsMemDbgPtr = lalIsMemDbgRetPtr = (lalMemDbgRetPtr == lalMemDbgUsrPtr);
 
     return q;
+
+failed:
+    XLALPrintError("LALMalloc: failed to allocate %zd bytes of memory\n", n);
+    XLALPrintError("LALMalloc: %zd bytes of memory already allocated\n", lalMallocTotal);
+    if (lalDebugLevel & LALMEMINFOBIT) {
+        XLALPrintError("LALRealloc meminfo: out of memory\n");
+    }
+    lalMemDbgPtr = lalMemDbgRetPtr = NULL;
+    lalIsMemDbgPtr = lalIsMemDbgRetPtr = (lalMemDbgRetPtr == lalMemDbgUsrPtr);
+    return NULL;
 }
 
 
@@ -734,6 +1219,7 @@ void LALFree(void *q)
     }
     lalMemDbgPtr = lalMemDbgArgPtr = q;
     lalIsMemDbgPtr = lalIsMemDbgArgPtr = (lalMemDbgArgPtr == lalMemDbgUsrPtr);
+    /* q is looked up in the allocation trackers before its padding is read */
     p = UnPadAlloc(PopAlloc(q, "LALFree"), 0, "LALFree");
     if (p) {
         free(p);
@@ -746,18 +1232,32 @@ void LALFree(void *q)
 void LALCheckMemoryLeaks(void)
 {
     int leak = 0;
+    int alloc_n = 0;
     if (!(lalDebugLevel & LALMEMDBGBIT)) {
         return;
     }
 
-    /* alloc_data_len should be zero */
-    if ((lalDebugLevel & LALMEMTRKBIT) && alloc_data_len > 0) {
+    /* allocation trackers should be empty, apart from nodes freed by other threads */
+    /* other threads must not allocate or free memory while checking */
+    for (struct allocTracker *t = MEM_LOAD(&alloc_trackers); t != NULL; t = t->next) {
+        struct allocTable *tbl = MEM_LOAD(&t->table);
+        for (size_t k = 0; tbl != NULL && k < tbl->len; ++k) {
+            struct allocNode *node = MEM_LOAD(&tbl->slots[k]);
+            if (node != NULL && MEM_LOAD(&node->addr) != NULL) {
+                ++alloc_n;
+            }
+        }
+    }
+    if ((lalDebugLevel & LALMEMTRKBIT) && alloc_n > 0) {
         XLALPrintError("LALCheckMemoryLeaks: allocation list\n");
-        for (int k = 0; k < alloc_data_len; ++k) {
-            if (alloc_data[k] != NULL && alloc_data[k] != DEL) {
-                XLALPrintError("%p: %zu bytes (%s:%d)\n", alloc_data[k]->addr,
-                               alloc_data[k]->size, alloc_data[k]->file,
-                               alloc_data[k]->line);
+        for (struct allocTracker *t = MEM_LOAD(&alloc_trackers); t != NULL; t = t->next) {
+            struct allocTable *tbl = MEM_LOAD(&t->table);
+            for (size_t k = 0; tbl != NULL && k < tbl->len; ++k) {
+                struct allocNode *node = MEM_LOAD(&tbl->slots[k]);
+                if (node != NULL && MEM_LOAD(&node->addr) != NULL) {
+                    XLALPrintError("%p: %zu bytes (%s:%d)\n", node->addr,
+                                   node->size, node->file, node->line);
+                }
             }
         }
         leak = 1;
@@ -779,8 +1279,51 @@ void LALCheckMemoryLeaks(void)
     return;
 }
 
+
+
+static int AllocSiteCompare(const void *x, const void *y)
+{
+    const struct allocSite *a = *(const struct allocSite * const *) x;
+    const struct allocSite *b = *(const struct allocSite * const *) y;
+    return (a->peak < b->peak) - (a->peak > b->peak);
+}
+
+void LALPrintMemoryCallSites(size_t maxsites)
+{
+    struct allocSite *sites[alloc_sites_len + 1];
+    size_t nsites = 0;
+    if (!(lalDebugLevel & LALMEMTRKBIT)) {
+        return;
+    }
+
+    /* gather call sites and sort them by peak number of bytes allocated */
+    for (int k = 0; k < alloc_sites_len; ++k) {
+        struct allocSite *site = MEM_LOAD(&alloc_sites[k]);
+        if (site != NULL) {
+            sites[nsites++] = site;
+        }
+    }
+    if (alloc_site_other.count > 0) {
+        sites[nsites++] = &alloc_site_other;
+    }
+    qsort(sites, nsites, sizeof(sites[0]), AllocSiteCompare);
+
+    const double elapsed = AllocTimeOfDay() - alloc_start_time;
+    XLALPrintError("LALPrintMemoryCallSites: %zu call sites, peak %zu bytes, %zu bytes allocated\n",
+                   nsites, lalMallocTotalPeak, lalMallocTotal);
+    for (size_t k = 0; k < nsites && (maxsites == 0 || k < maxsites); ++k) {
+        const struct allocSite *site = sites[k];
+        XLALPrintError("%s:%d: %zu allocs (%.3g allocs/s), %zu bytes total, %zu bytes peak, %zu bytes allocated\n",
+                       site->file, site->line, site->count, elapsed > 0 ? site->count / elapsed : 0.0,
+                       site->bytes, site->peak, site->live);
+    }
+
+    return;
+}
+
 #else
 
 void (LALCheckMemoryLeaks)(void) { return; }
+void (LALPrintMemoryCallSites)(size_t maxsites) { (void)maxsites; return; }
 
 #endif /* ! defined NDEBUG */
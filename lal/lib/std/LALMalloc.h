@@ -32,6 +32,7 @@ extern "C" {
 /** \addtogroup LALMalloc_h */ /** @{ */
 extern size_t lalMallocTotal;
 extern size_t lalMallocTotalPeak;
+extern size_t lalMallocCount;
 void *XLALMalloc(size_t n);
 void *XLALMallocLong(size_t n, const char *file, int line);
 void *XLALCalloc(size_t m, size_t n);
@@ -81,6 +82,7 @@ void XLALFreeAligned(void *ptr);
 #define LALReallocLong( p, n, file, line ) realloc( p, n )
 #define LALFree                            free
 #define LALCheckMemoryLeaks()
+#define LALPrintMemoryCallSites( maxsites )
 #endif /* SWIG */
 
 #else
@@ -119,6 +121,17 @@ void *LALReallocLong(void *p, size_t n, const char *file, int line);
 
 void (LALCheckMemoryLeaks) (void);
 
+/**
+ * Print allocation statistics for the call sites of the LALMalloc-family,
+ * if memory tracking is enabled.  For each call site (file and line of the
+ * allocation), prints the number of allocations and the allocation rate
+ * since the first tracked allocation, the total number of bytes allocated,
+ * and the peak and current number of bytes allocated.  Call sites are
+ * sorted by peak number of bytes allocated; at most \c maxsites call sites
+ * are printed, or all call sites if \c maxsites is zero.
+ */
+void (LALPrintMemoryCallSites) (size_t maxsites);
+
 #if 0
 {       /* so that editors will match succeeding brace */
 #elif defined(__cplusplus)
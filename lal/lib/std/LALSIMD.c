@@ -87,6 +87,7 @@ static const char *const iset_names[LAL_SIMD_ISET_MAX] = {
   [LAL_SIMD_ISET_SSE4_2]	= "SSE4.2",
   [LAL_SIMD_ISET_AVX]		= "AVX",
   [LAL_SIMD_ISET_AVX2]		= "AVX2",
+  [LAL_SIMD_ISET_AVX512F]	= "AVX512F",
 };
 
 /* pthread locking to make SIMD detection thread-safe */
@@ -108,7 +109,15 @@ static inline UNUSED void cpuid( uint32_t output[4], UNUSED int functionnumber )
 
 #if HAVE_X86
 
-#if HAVE__GET_CPUID
+#if HAVE__GET_CPUID && defined(__cpuid_count)
+
+  /* __get_cpuid() leaves ECX undefined, so use __cpuid_count() to set ECX = 0, see https://gcc.gnu.org/bugzilla/show_bug.cgi?id=77756 */
+  output[0] = output[1] = output[2] = output[3] = 0;
+  if ((unsigned int) functionnumber <= __get_cpuid_max(0, NULL)) {
+    __cpuid_count(functionnumber, 0, output[0], output[1], output[2], output[3]);
+  }
+
+#elif HAVE__GET_CPUID
 
   __get_cpuid(functionnumber, &output[0], &output[1], &output[2], &output[3]);
 
@@ -233,6 +242,16 @@ static LAL_SIMD_ISET detect_instruction_set(void) {
 #endif
   iset = LAL_SIMD_ISET_AVX2;				/* AVX2 detected */
 
+  if ((xgetbv(0) & 0xe6) != 0xe6) return iset;		/* AVX-512 state not enabled in O.S. */
+#if HAVE_X86 && defined(__GNUC__) && __GNUC__ >= 5
+  /* GCC's __get_cpuid() fails to detect AVX512F for the same reason as AVX2 above */
+  if (!__builtin_cpu_supports("avx512f")) return iset;	/* no AVX512F */
+#else
+  cpuid(abcd, 7);					/* call cpuid function 7 for feature flags */
+  if ((abcd[1] & (1 << 16)) == 0) return iset;		/* no AVX512F */
+#endif
+  iset = LAL_SIMD_ISET_AVX512F;				/* AVX512F detected */
+
   return iset;
 
 }
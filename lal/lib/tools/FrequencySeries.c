@@ -23,6 +23,7 @@
 #include <lal/Date.h>
 #include <lal/LALDatatypes.h>
 #include <lal/LALStdlib.h>
+#include <lal/LALArena.h>
 #include <lal/FrequencySeries.h>
 #include <lal/Sequence.h>
 #include <lal/Units.h>
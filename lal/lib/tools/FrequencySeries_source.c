@@ -23,7 +23,8 @@ void DSERIES (
 {
 	if(series)
 		DSEQUENCE (series->data);
-	XLALFree(series);
+	if(!XLALArenaOwner(series))
+		XLALFree(series);
 }
 
 
@@ -39,10 +40,12 @@ SERIESTYPE *CSERIES (
 	SERIESTYPE *new;
 	SEQUENCETYPE *sequence;
 
-	new = XLALMalloc(sizeof(*new));
+	LALArena *arena = XLALGetCurrentArena();
+	new = arena ? XLALArenaAlloc(arena, sizeof(*new)) : XLALMalloc(sizeof(*new));
 	sequence = CSEQUENCE (length);
 	if(!new || !sequence) {
-		XLALFree(new);
+		if(!arena)
+			XLALFree(new);
 		DSEQUENCE (sequence);
 		XLAL_ERROR_NULL(XLAL_EFUNC);
 	}
@@ -81,10 +84,12 @@ SERIESTYPE *XSERIES (
 	SERIESTYPE *new;
 	SEQUENCETYPE *sequence;
 
-	new = XLALMalloc(sizeof(*new));
+	LALArena *arena = XLALGetCurrentArena();
+	new = arena ? XLALArenaAlloc(arena, sizeof(*new)) : XLALMalloc(sizeof(*new));
 	sequence = XSEQUENCE (series->data, first, length);
 	if(!new || !sequence) {
-		XLALFree(new);
+		if(!arena)
+			XLALFree(new);
 		DSEQUENCE (sequence);
 		XLAL_ERROR_NULL(XLAL_EFUNC);
 	}
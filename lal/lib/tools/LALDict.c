@@ -18,9 +18,11 @@
 */
 
 /*
- * Dictionary is implemented as a hash search with algorithm adopted
- * from "The C Programming Language" by Kernighan and Ritchie, 2nd ed.
- * section 6.6.
+ * Dictionary is implemented as an open-addressing hash table with linear
+ * probing and backward-shift deletion.  The table size is a power of two
+ * and is doubled whenever the load factor would exceed 3/4.  Each slot
+ * caches the 64-bit CityHash of its key, so that probing only touches an
+ * entry when the hashes agree.
  */
 
 #include <stdio.h>
@@ -31,27 +33,153 @@
 #include <lal/LALStdio.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALDict.h>
+#include <lal/LALHashFunc.h>
 #include "LALValue_private.h"
 
-#define LAL_DICT_HASHSIZE 101
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_mutex_t lalDictKeyMutex = PTHREAD_MUTEX_INITIALIZER;
+#else
+#define pthread_mutex_lock( pmut )
+#define pthread_mutex_unlock( pmut )
+#endif
+
+/* initial number of slots; must be a power of two */
+#define LAL_DICT_INIT_SIZE 16
 
 struct tagLALDictEntry {
         struct tagLALDictEntry *next;
+        UINT8 hash;
         char key[LAL_KEYNAME_MAX + 1];
 	LALValue value;
 };
 
+struct tagLALDictSlot {
+	UINT8 hash;
+	struct tagLALDictEntry *entry;	/* NULL if slot is empty */
+};
+
 struct tagLALDict {
-	size_t size;
-	struct tagLALDictEntry *hashes[];
+	size_t size;	/* number of slots */
+	size_t count;	/* number of entries */
+	struct tagLALDictSlot *slots;
 };
 
-static size_t hash(const char *s)
+struct tagLALDictKeyHandle {
+	UINT8 hash;
+	char key[LAL_KEYNAME_MAX + 1];
+};
+
+static UINT8 hash(const char *s)
+{
+	return XLALCityHash64(s, strlen(s));
+}
+
+/* returns the slot holding key, or the empty slot where it would go */
+static struct tagLALDictSlot * XLALDictProbe(const LALDict *dict, const char *key, UINT8 hashval)
+{
+	const size_t mask = dict->size - 1;
+	size_t i = hashval & mask;
+	while (dict->slots[i].entry) {
+		if (dict->slots[i].hash == hashval && strcmp(key, dict->slots[i].entry->key) == 0)
+			break;
+		i = (i + 1) & mask;
+	}
+	return &dict->slots[i];
+}
+
+static int XLALDictResize(LALDict *dict, size_t size)
 {
-	size_t hashval;
-	for (hashval = 0; *s != '\0'; ++s)
-		hashval = *s + 31 * hashval;
-	return hashval;
+	struct tagLALDictSlot *old = dict->slots;
+	size_t oldsize = dict->size;
+	size_t i;
+	dict->slots = XLALCalloc(size, sizeof(*dict->slots));
+	if (!dict->slots) {
+		dict->slots = old;
+		XLAL_ERROR(XLAL_ENOMEM);
+	}
+	dict->size = size;
+	for (i = 0; i < oldsize; ++i)
+		if (old[i].entry) {
+			size_t j = old[i].hash & (size - 1);
+			while (dict->slots[j].entry)
+				j = (j + 1) & (size - 1);
+			dict->slots[j] = old[i];
+		}
+	LALFree(old);
+	return 0;
+}
+
+/* DICT KEY HANDLE ROUTINES */
+
+/*
+ * Interned key handles are stored in a process-wide open-addressing table
+ * protected by a mutex.  Handles are allocated with the system malloc() and
+ * are never freed, so that they do not show up as LAL memory leaks.
+ */
+static struct tagLALDictKeyHandle **lalDictKeys = NULL;
+static size_t lalDictKeysSize = 0;
+static size_t lalDictKeysCount = 0;
+
+const LALDictKeyHandle * XLALDictInternKey(const char *key)
+{
+	struct tagLALDictKeyHandle *handle = NULL;
+	UINT8 hashval;
+	size_t i;
+
+	XLAL_CHECK_NULL(key != NULL, XLAL_EFAULT);
+	XLAL_CHECK_NULL(strlen(key) <= LAL_KEYNAME_MAX, XLAL_ENAME, "Key name `%s' too long (max %d characters)", key, LAL_KEYNAME_MAX);
+	hashval = hash(key);
+
+	pthread_mutex_lock(&lalDictKeyMutex);
+
+	/* grow the table if the load factor would exceed 1/2 */
+	if (2 * (lalDictKeysCount + 1) > lalDictKeysSize) {
+		size_t size = lalDictKeysSize ? 2 * lalDictKeysSize : 64;
+		struct tagLALDictKeyHandle **keys = calloc(size, sizeof(*keys));
+		if (!keys) {
+			pthread_mutex_unlock(&lalDictKeyMutex);
+			XLAL_ERROR_NULL(XLAL_ENOMEM);
+		}
+		for (i = 0; i < lalDictKeysSize; ++i)
+			if (lalDictKeys[i]) {
+				size_t j = lalDictKeys[i]->hash & (size - 1);
+				while (keys[j])
+					j = (j + 1) & (size - 1);
+				keys[j] = lalDictKeys[i];
+			}
+		free(lalDictKeys);
+		lalDictKeys = keys;
+		lalDictKeysSize = size;
+	}
+
+	for (i = hashval & (lalDictKeysSize - 1); lalDictKeys[i]; i = (i + 1) & (lalDictKeysSize - 1))
+		if (lalDictKeys[i]->hash == hashval && strcmp(key, lalDictKeys[i]->key) == 0) {
+			handle = lalDictKeys[i];
+			break;
+		}
+
+	if (!handle) {
+		handle = malloc(sizeof(*handle));
+		if (!handle) {
+			pthread_mutex_unlock(&lalDictKeyMutex);
+			XLAL_ERROR_NULL(XLAL_ENOMEM);
+		}
+		handle->hash = hashval;
+		strcpy(handle->key, key);
+		lalDictKeys[i] = handle;
+		++lalDictKeysCount;
+	}
+
+	pthread_mutex_unlock(&lalDictKeyMutex);
+
+	return handle;
+}
+
+/* warning: shallow pointer */
+const char * XLALDictKeyHandleGetKey(const LALDictKeyHandle *handle)
+{
+	return handle->key;
 }
 
 /* DICT ENTRY ROUTINES */
@@ -72,6 +200,7 @@ LALDictEntry * XLALDictEntryAlloc(size_t size)
 	entry = XLALMalloc(sizeof(*entry) + size);
 	if (!entry)
 		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	entry->next = NULL;
 	entry->value.size = size;
 	return entry;
 }
@@ -93,6 +222,7 @@ LALDictEntry * XLALDictEntrySetKey(LALDictEntry *entry, const char *key)
 {
 	if ((size_t)snprintf(entry->key, sizeof(entry->key), "%s", key) >= sizeof(entry->key))
 		XLAL_ERROR_NULL(XLAL_ENAME, "Key name `%s' too long (max %d characters)", key, LAL_KEYNAME_MAX);
+	entry->hash = hash(entry->key);
 	return entry;
 }
 
@@ -120,7 +250,8 @@ void XLALDestroyDict(LALDict *dict)
 	if (dict) {
 		size_t i;
 		for (i = 0; i < dict->size; ++i)
-			XLALDictEntryFree(dict->hashes[i]);
+			XLALDictEntryFree(dict->slots[i].entry);
+		LALFree(dict->slots);
 		LALFree(dict);
 	}
 	return;
@@ -131,10 +262,15 @@ void XLALDestroyDict(LALDict *dict)
 LALDict * XLALCreateDict(void)
 {
 	LALDict *dict;
-	dict = XLALCalloc(1, sizeof(dict) + LAL_DICT_HASHSIZE * sizeof(*dict->hashes));
+	dict = XLALCalloc(1, sizeof(*dict));
 	if (!dict)
 		XLAL_ERROR_NULL(XLAL_ENOMEM);
-	dict->size = LAL_DICT_HASHSIZE;
+	dict->slots = XLALCalloc(LAL_DICT_INIT_SIZE, sizeof(*dict->slots));
+	if (!dict->slots) {
+		LALFree(dict);
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	}
+	dict->size = LAL_DICT_INIT_SIZE;
 	return dict;
 }
 
@@ -142,8 +278,8 @@ void XLALDictForeach(LALDict *dict, void (*func)(char *, LALValue *, void *), vo
 {
 	size_t i;
 	for (i = 0; i < dict->size; ++i) {
-		LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next)
+		LALDictEntry *entry = dict->slots[i].entry;
+		if (entry)
 			func(entry->key, &entry->value, thunk);
 	}
 	return;
@@ -153,10 +289,9 @@ LALDictEntry * XLALDictFind(LALDict *dict, int (*func)(const char *, const LALVa
 {
 	size_t i;
 	for (i = 0; i < dict->size; ++i) {
-		LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next)
-			if (func(entry->key, &entry->value, thunk))
-				return entry;
+		LALDictEntry *entry = dict->slots[i].entry;
+		if (entry && func(entry->key, &entry->value, thunk))
+			return entry;
 	}
 	return NULL;
 }
@@ -171,19 +306,11 @@ void XLALDictIterInit(LALDictIter *iter, LALDict *dict)
 
 LALDictEntry * XLALDictIterNext(LALDictIter *iter)
 {
-	while (1) {
-
-		if (iter->next) {
-			LALDictEntry *entry = iter->next;
-			iter->next = entry->next;
+	/* iter->next is unused by the open-addressing table */
+	while (iter->pos < iter->dict->size) {
+		LALDictEntry *entry = iter->dict->slots[iter->pos++].entry;
+		if (entry)
 			return entry;
-		}
-
-		/* check end of iteration */
-		if (iter->pos >= iter->dict->size)
-			return NULL;
-
-		iter->next = iter->dict->hashes[iter->pos++];
 	}
 	return NULL;
 }
@@ -197,8 +324,8 @@ LALDict * XLALDictDuplicate(LALDict *old)
     if (!new)
         XLAL_ERROR_NULL(XLAL_ENOMEM);
     for (i = 0; i < old->size; ++i) {
-        const LALDictEntry *entry;
-        for (entry = old->hashes[i]; entry != NULL; entry = entry->next) {
+        const LALDictEntry *entry = old->slots[i].entry;
+        if (entry != NULL) {
             const char *key = XLALDictEntryGetKey(entry);
             XLAL_TRY(XLALDictInsertValue(new, key, XLALDictEntryGetValue(entry)), retcode);
             if(retcode!=XLAL_SUCCESS)
@@ -219,8 +346,8 @@ LALList * XLALDictKeys(const LALDict *dict)
 	if (!list)
 		XLAL_ERROR_NULL(XLAL_EFUNC);
 	for (i = 0; i < dict->size; ++i) {
-		const LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next) {
+		const LALDictEntry *entry = dict->slots[i].entry;
+		if (entry != NULL) {
 			const char *key = XLALDictEntryGetKey(entry);
 			if (XLALListAddStringValue(list, key) < 0) {
 				XLALDestroyList(list);
@@ -239,8 +366,8 @@ LALList * XLALDictValues(const LALDict *dict)
 	if (!list)
 		XLAL_ERROR_NULL(XLAL_EFUNC);
 	for (i = 0; i < dict->size; ++i) {
-		const LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next) {
+		const LALDictEntry *entry = dict->slots[i].entry;
+		if (entry != NULL) {
 			const LALValue *value = XLALDictEntryGetValue(entry);
 			if (XLALListAddValue(list, value) < 0) {
 				XLALDestroyList(list);
@@ -253,82 +380,73 @@ LALList * XLALDictValues(const LALDict *dict)
 
 int XLALDictContains(const LALDict *dict, const char *key)
 {
-	const LALDictEntry *entry;
-	for (entry = dict->hashes[hash(key) % dict->size]; entry != NULL; entry = entry->next)
-		if (strcmp(key, entry->key) == 0)
-			return 1;
-	return 0;
+	return XLALDictProbe(dict, key, hash(key))->entry != NULL;
 }
 
 size_t XLALDictSize(const LALDict *dict)
 {
-	size_t size = 0;
-	size_t i;
-	for (i = 0; i < dict->size; ++i) {
-		const LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next)
-			++size;
-	}
-	return size;
+	return dict->count;
 }
 
 LALDictEntry *XLALDictLookup(LALDict *dict, const char *key)
 {
-	LALDictEntry *entry;
-	for (entry = dict->hashes[hash(key) % dict->size]; entry != NULL; entry = entry->next)
-		if (strcmp(key, entry->key) == 0)
-			return entry;
-	return NULL;
+	return XLALDictProbe(dict, key, hash(key))->entry;
+}
+
+LALDictEntry *XLALDictLookupByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle)
+{
+	return XLALDictProbe(dict, handle->key, handle->hash)->entry;
+}
+
+int XLALDictContainsKeyHandle(const LALDict *dict, const LALDictKeyHandle *handle)
+{
+	return XLALDictProbe(dict, handle->key, handle->hash)->entry != NULL;
 }
 
 int XLALDictRemove(LALDict *dict, const char *key)
 {
-	size_t hashidx = hash(key) % dict->size;
-	LALDictEntry *this = dict->hashes[hashidx];
-	LALDictEntry *prev = this;
-	while (this) {
-		if (strcmp(this->key, key) == 0) { /* found it! */
-			if (prev == this) /* head is removed */
-				dict->hashes[hashidx] = this->next;
-			else
-				prev->next = this->next;
-			LALFree(this);
-			return 0;
+	const size_t mask = dict->size - 1;
+	struct tagLALDictSlot *slot = XLALDictProbe(dict, key, hash(key));
+	size_t i, j;
+	if (slot->entry == NULL)
+		return -1; /* not found */
+	LALFree(slot->entry);
+	--dict->count;
+
+	/* shift back any following entries whose probe sequence passes through the hole */
+	i = j = slot - dict->slots;
+	while (1) {
+		size_t k;
+		j = (j + 1) & mask;
+		if (dict->slots[j].entry == NULL)
+			break;
+		k = dict->slots[j].hash & mask;
+		if ((i <= j) ? (k <= i || k > j) : (k <= i && k > j)) {
+			dict->slots[i] = dict->slots[j];
+			i = j;
 		}
-		prev = this;
-		this = this->next;
 	}
-	return -1; /* not found */
+	dict->slots[i].entry = NULL;
+	dict->slots[i].hash = 0;
+	return 0;
 }
 
 int XLALDictInsert(LALDict *dict, const char *key, const void *data, size_t size, LALTYPECODE type)
 {
-	size_t hashidx = hash(key) % dict->size;
-	LALDictEntry *this = dict->hashes[hashidx];
-	LALDictEntry *prev = NULL;
+	UINT8 hashval = hash(key);
+	struct tagLALDictSlot *slot = XLALDictProbe(dict, key, hashval);
 	LALDictEntry *entry;
 
 	/* see if entry already exists */
-	while (this) {
-		if (strcmp(this->key, key) == 0) { /* found it! */
-			entry = XLALDictEntryRealloc(this, size);
-			if (entry == NULL)
-				XLAL_ERROR(XLAL_EFUNC);
-			if (entry != this) { /* relink */
-				if (prev == NULL) /* head is moved */
-					dict->hashes[hashidx] = entry;
-				else
-					prev->next = entry;
-			}
-			entry = XLALDictEntrySetValue(entry, data, size, type);
-
-			if (entry == NULL)
-				XLAL_ERROR(XLAL_EFUNC);
-
-			return 0;
-		}
-		prev = this;
-		this = this->next;
+	if (slot->entry) {
+		entry = XLALDictEntryRealloc(slot->entry, size);
+		if (entry == NULL)
+			XLAL_ERROR(XLAL_EFUNC);
+		slot->entry = entry;
+		entry = XLALDictEntrySetValue(entry, data, size, type);
+		if (entry == NULL)
+			XLAL_ERROR(XLAL_EFUNC);
+		return 0;
 	}
 
 	/* not found: create new entry */
@@ -336,20 +454,28 @@ int XLALDictInsert(LALDict *dict, const char *key, const void *data, size_t size
 	if (entry == NULL)
 		XLAL_ERROR(XLAL_EFUNC);
 
-	entry = XLALDictEntrySetKey(entry, key);
-	if (entry == NULL) {
+	if (XLALDictEntrySetKey(entry, key) == NULL) {
 		LALFree(entry);
 		XLAL_ERROR(XLAL_EFUNC);
 	}
 
-	entry = XLALDictEntrySetValue(entry, data, size, type);
-	if (entry == NULL) {
+	if (XLALDictEntrySetValue(entry, data, size, type) == NULL) {
 		LALFree(entry);
 		XLAL_ERROR(XLAL_EFUNC);
 	}
 
-	entry->next = dict->hashes[hashidx];
-	dict->hashes[hashidx] = entry;
+	/* grow the table if needed; the free slot must then be found again */
+	if (4 * (dict->count + 1) > 3 * dict->size) {
+		if (XLALDictResize(dict, 2 * dict->size) < 0) {
+			LALFree(entry);
+			XLAL_ERROR(XLAL_EFUNC);
+		}
+		slot = XLALDictProbe(dict, key, hashval);
+	}
+
+	slot->hash = hashval;
+	slot->entry = entry;
+	++dict->count;
 	return 0;
 }
 
@@ -405,6 +531,19 @@ const char * XLALDictLookupStringValue(LALDict *dict, const char *key)
 	return XLALValueGetString(value);
 }
 
+/* warning: shallow pointer */
+const char * XLALDictLookupStringValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle)
+{
+	LALDictEntry *entry = XLALDictLookupByKeyHandle(dict, handle);
+	const LALValue *value;
+	if (entry == NULL)
+		XLAL_ERROR_NULL(XLAL_ENAME, "Key `%s' not found", handle->key);
+	value = XLALDictEntryGetValue(entry);
+	if (value == NULL)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	return XLALValueGetString(value);
+}
+
 #define DEFINE_LOOKUP_FUNC(TYPE, FAILVAL) \
 	TYPE XLALDictLookup ## TYPE ## Value(LALDict *dict, const char *key) \
 	{ \
@@ -419,6 +558,20 @@ const char * XLALDictLookupStringValue(LALDict *dict, const char *key)
 		return XLALValueGet ## TYPE (value); \
 	}
 
+#define DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(TYPE, FAILVAL) \
+	TYPE XLALDictLookup ## TYPE ## ValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle) \
+	{ \
+		LALDictEntry *entry; \
+		const LALValue *value; \
+		entry = XLALDictLookupByKeyHandle(dict, handle); \
+		if (entry == NULL) \
+			XLAL_ERROR_VAL(FAILVAL, XLAL_ENAME, "Key `%s' not found", handle->key); \
+		value = XLALDictEntryGetValue(entry); \
+		if (value == NULL) \
+			XLAL_ERROR_VAL(FAILVAL, XLAL_EFUNC); \
+		return XLALValueGet ## TYPE (value); \
+	}
+
 DEFINE_LOOKUP_FUNC(CHAR, XLAL_FAILURE)
 DEFINE_LOOKUP_FUNC(INT2, XLAL_FAILURE)
 DEFINE_LOOKUP_FUNC(INT4, XLAL_FAILURE)
@@ -432,6 +585,22 @@ DEFINE_LOOKUP_FUNC(REAL8, XLAL_REAL8_FAIL_NAN)
 DEFINE_LOOKUP_FUNC(COMPLEX8, XLAL_REAL4_FAIL_NAN)
 DEFINE_LOOKUP_FUNC(COMPLEX16, XLAL_REAL8_FAIL_NAN)
 
+DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(CHAR, XLAL_FAILURE)
+DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(INT2, XLAL_FAILURE)
+DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(INT4, XLAL_FAILURE)
+DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(INT8, XLAL_FAILURE)
+DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(UCHAR, XLAL_FAILURE)
+DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(UINT2, XLAL_FAILURE)
+DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(UINT4, XLAL_FAILURE)
+DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(UINT8, XLAL_FAILURE)
+DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(REAL4, XLAL_REAL4_FAIL_NAN)
+DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(REAL8, XLAL_REAL8_FAIL_NAN)
+DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(COMPLEX8, XLAL_REAL4_FAIL_NAN)
+DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC(COMPLEX16, XLAL_REAL8_FAIL_NAN)
+
+#undef DEFINE_LOOKUP_BY_KEY_HANDLE_FUNC
+#undef DEFINE_LOOKUP_FUNC
+
 REAL8 XLALDictLookupValueAsREAL8(LALDict *dict, const char *key)
 {
 	LALDictEntry *entry;
@@ -47,6 +47,24 @@ struct tagLALDictIter {
 };
 typedef struct tagLALDictIter LALDictIter;
 
+/*
+ * Key handles hold an interned key name together with its precomputed hash,
+ * and are valid for the lifetime of the process.  Looking up an entry by key
+ * handle avoids rehashing the key name, e.g. when the same parameters are
+ * looked up in many dictionaries:
+ *
+ *   static const LALDictKeyHandle *key = NULL;
+ *   if (key == NULL)
+ *           key = XLALDictInternKey("mass1");
+ *   REAL8 m1 = XLALDictLookupREAL8ValueByKeyHandle(dict, key);
+ */
+struct tagLALDictKeyHandle;
+typedef struct tagLALDictKeyHandle LALDictKeyHandle;
+
+const LALDictKeyHandle * XLALDictInternKey(const char *key);
+/* warning: shallow pointer */
+const char * XLALDictKeyHandleGetKey(const LALDictKeyHandle *handle);
+
 void XLALDictEntryFree(LALDictEntry *list);
 LALDictEntry * XLALDictEntryAlloc(size_t size);
 LALDictEntry * XLALDictEntryRealloc(LALDictEntry *entry, size_t size);
@@ -71,6 +89,7 @@ LALList * XLALDictKeys(const LALDict *dict);
 LALList * XLALDictValues(const LALDict *dict);
 
 int XLALDictContains(const LALDict *dict, const char *key);
+int XLALDictContainsKeyHandle(const LALDict *dict, const LALDictKeyHandle *handle);
 size_t XLALDictSize(const LALDict *dict);
 int XLALDictRemove(LALDict *dict, const char *key);
 int XLALDictInsert(LALDict *dict, const char *key, const void *data, size_t size, LALTYPECODE type);
@@ -105,6 +124,22 @@ REAL8 XLALDictLookupREAL8Value(LALDict *dict, const char *key);
 COMPLEX8 XLALDictLookupCOMPLEX8Value(LALDict *dict, const char *key);
 COMPLEX16 XLALDictLookupCOMPLEX16Value(LALDict *dict, const char *key);
 
+LALDictEntry *XLALDictLookupByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+/* warning: shallow pointer */
+const char * XLALDictLookupStringValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+CHAR XLALDictLookupCHARValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+INT2 XLALDictLookupINT2ValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+INT4 XLALDictLookupINT4ValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+INT8 XLALDictLookupINT8ValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+UCHAR XLALDictLookupUCHARValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+UINT2 XLALDictLookupUINT2ValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+UINT4 XLALDictLookupUINT4ValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+UINT8 XLALDictLookupUINT8ValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+REAL4 XLALDictLookupREAL4ValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+REAL8 XLALDictLookupREAL8ValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+COMPLEX8 XLALDictLookupCOMPLEX8ValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+COMPLEX16 XLALDictLookupCOMPLEX16ValueByKeyHandle(LALDict *dict, const LALDictKeyHandle *handle);
+
 REAL8 XLALDictLookupValueAsREAL8(LALDict *dict, const char *key);
 
 void XLALDictPrint(LALDict *dict, int fd);
@@ -22,6 +22,7 @@
 #include <lal/Date.h>
 #include <lal/LALDatatypes.h>
 #include <lal/LALStdlib.h>
+#include <lal/LALArena.h>
 #include <lal/LALStatusMacros.h>
 #include <lal/LALError.h>
 #include <lal/Sequence.h>
@@ -24,14 +24,16 @@ void DFUNC (
 	SEQUENCETYPE *sequence
 )
 {
+	/* memory owned by an arena is released by XLALArenaReset() */
 #ifdef USE_ALIGNED_MEMORY_ROUTINES
-	if(sequence)
+	if(sequence && !XLALArenaOwner(sequence->data))
 		XLALFreeAligned(sequence->data);
 #else
-	if(sequence)
+	if(sequence && !XLALArenaOwner(sequence->data))
 		XLALFree(sequence->data);
 #endif
-	XLALFree(sequence);
+	if(!XLALArenaOwner(sequence))
+		XLALFree(sequence);
 }
 
 
@@ -41,20 +43,29 @@ SEQUENCETYPE *CFUNC (
 {
 	SEQUENCETYPE *new;
 	DATATYPE *data;
+	LALArena *arena = XLALGetCurrentArena();
 
-	new = XLALMalloc(sizeof(*new));
+	if(arena) {
+		/* allocate from the current arena of this thread */
+		new = XLALArenaAlloc(arena, sizeof(*new));
+		data = length ? XLALArenaAlloc(arena, length * sizeof(*data)) : NULL;
+		if(!new || (length && !data))
+			XLAL_ERROR_NULL(XLAL_EFUNC);
+	} else {
+		new = XLALMalloc(sizeof(*new));
 
 #ifdef USE_ALIGNED_MEMORY_ROUTINES
-	data = XLALMallocAligned(length * sizeof(*data));
+		data = XLALMallocAligned(length * sizeof(*data));
 #else
-	data = XLALMalloc(length * sizeof(*data));
+		data = XLALMalloc(length * sizeof(*data));
 #endif /*  USE_ALIGNED_MEMORY_ROUTINES */
 
-	/* data == NULL is OK if length == 0 */
-	if(!new || (length && !data)) {
-		XLALFree(new);
-		XLALFree(data);
-		XLAL_ERROR_NULL(XLAL_EFUNC);
+		/* data == NULL is OK if length == 0 */
+		if(!new || (length && !data)) {
+			XLALFree(new);
+			XLALFree(data);
+			XLAL_ERROR_NULL(XLAL_EFUNC);
+		}
 	}
 
 	new->data = data;
@@ -115,10 +126,23 @@ SEQUENCETYPE *RFUNC (
 )
 {
 	DATATYPE *new_data;
+	LALArena *arena = XLALArenaOwner(sequence->data);
 
 	if(length > sequence->length) {
 		/* need to increase memory */
 
+		if(arena && arena == XLALGetCurrentArena())
+			new_data = XLALArenaRealloc(arena, sequence->data, sequence->length * sizeof(*sequence->data), length * sizeof(*sequence->data));
+		else if(arena) {
+			/* arena is not in use by this thread: move data to the heap */
+#ifdef USE_ALIGNED_MEMORY_ROUTINES
+			new_data = XLALMallocAligned(length * sizeof(*sequence->data));
+#else
+			new_data = XLALMalloc(length * sizeof(*sequence->data));
+#endif /* USE_ALIGNED_MEMORY_ROUTINES */
+			if(new_data)
+				memcpy(new_data, sequence->data, sequence->length * sizeof(*sequence->data));
+		} else
 #ifdef USE_ALIGNED_MEMORY_ROUTINES
 		new_data = XLALReallocAligned(sequence->data, length * sizeof(*sequence->data));
 #else
@@ -133,12 +157,16 @@ SEQUENCETYPE *RFUNC (
 		} else
 			XLAL_ERROR_NULL(XLAL_EFUNC);
 	} else if (length == 0) {
-		XLALFree(sequence->data);
+		if(!arena)
+			XLALFree(sequence->data);
 		sequence->data = NULL;
 		sequence->length = 0;
 	} else {
 		/* do not need to increase memory */
 		SFUNC (sequence, -first);
+		if(arena)
+			new_data = sequence->data;
+		else
 #ifdef USE_ALIGNED_MEMORY_ROUTINES
 		new_data = XLALReallocAligned(sequence->data, length * sizeof(*sequence->data));
 #else
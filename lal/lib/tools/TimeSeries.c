@@ -24,6 +24,7 @@
 #include <lal/Date.h>
 #include <lal/LALDatatypes.h>
 #include <lal/LALStdlib.h>
+#include <lal/LALArena.h>
 #include <lal/Sequence.h>
 #include <lal/TimeSeries.h>
 #include <lal/Units.h>
@@ -1499,3 +1499,15 @@ void LALSRunningMedian2( LALStatus *status,
   DETATCHSTATUSPTR( status );
   RETURN( status );
 }
+
+
+/* flag marking positions in the 'hi' heap of the heap-based running median */
+#define RNGMED_HI_FLAG 0x80000000u
+
+/* number of series advanced in lockstep by the batched running median */
+#define RNGMED_BATCH_BLOCK 8
+
+#define SINGLE_PRECISION
+#include "LALRunningMedian_source.c"
+#undef SINGLE_PRECISION
+#include "LALRunningMedian_source.c"
@@ -54,6 +54,18 @@ extern "C" {
  * <tt>LALDRunningMedian()</tt>, but has proven to be a
  * little faster and more stable. Check if it works for you.
  *
+ * <tt>XLALREAL8RunningMedian()</tt> and <tt>XLALREAL4RunningMedian()</tt>
+ * compute the same running medians, bit-for-bit, with a different
+ * algorithm: the values of the block are kept in a max-heap holding the
+ * smaller half and a min-heap holding the larger half, so that replacing
+ * the oldest value costs \f$O(\log b)\f$ instead of \f$O(\sqrt{b})\f$
+ * operations. Any blocksize \f$1\le b\le n\f$ is accepted.
+ * <tt>XLALREAL8RunningMedianBatch()</tt> and
+ * <tt>XLALREAL4RunningMedianBatch()</tt> compute the running medians of
+ * every vector of a vector sequence, e.g. of the periodograms of many
+ * SFTs, advancing the blocks of several vectors in lockstep with a single
+ * workspace.
+ *
  * ### Algorithm ###
  *
  * For a detailed description of the algorithm see the
@@ -137,6 +149,18 @@ LALSRunningMedian2( LALStatus *status,
 		    const REAL4Sequence *input,
 		    LALRunningMedianPar param);
 
+/** See LALRunningMedian_h for documentation */
+int XLALREAL8RunningMedian( REAL8Sequence *medians, const REAL8Sequence *input, UINT4 blocksize );
+
+/** See LALRunningMedian_h for documentation */
+int XLALREAL4RunningMedian( REAL4Sequence *medians, const REAL4Sequence *input, UINT4 blocksize );
+
+/** See LALRunningMedian_h for documentation */
+int XLALREAL8RunningMedianBatch( REAL8VectorSequence *medians, const REAL8VectorSequence *input, UINT4 blocksize );
+
+/** See LALRunningMedian_h for documentation */
+int XLALREAL4RunningMedianBatch( REAL4VectorSequence *medians, const REAL4VectorSequence *input, UINT4 blocksize );
+
 /** @} */
 
 #ifdef  __cplusplus
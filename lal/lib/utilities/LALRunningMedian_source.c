@@ -0,0 +1,326 @@
+// Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with with program; see the file COPYING. If not, write to the
+//  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+//  MA  02111-1307  USA
+
+#define CONCAT2x(a,b) a##b
+#define CONCAT2(a,b) CONCAT2x(a,b)
+#define CONCAT3x(a,b,c) a##b##c
+#define CONCAT3(a,b,c) CONCAT3x(a,b,c)
+
+#ifdef SINGLE_PRECISION
+#define REAL_TYPE REAL4
+#else
+#define REAL_TYPE REAL8
+#endif
+
+#define SEQUENCE_TYPE			CONCAT2(REAL_TYPE,Sequence)
+#define VECTOR_SEQUENCE_TYPE		CONCAT2(REAL_TYPE,VectorSequence)
+#define HEAP_NODE			CONCAT2(RngMedHeapNode,REAL_TYPE)
+#define HEAP_STATE			CONCAT2(RngMedHeapState,REAL_TYPE)
+#define LO_SIFT_UP			CONCAT2(RngMedLoSiftUp,REAL_TYPE)
+#define LO_SIFT_DOWN			CONCAT2(RngMedLoSiftDown,REAL_TYPE)
+#define HI_SIFT_UP			CONCAT2(RngMedHiSiftUp,REAL_TYPE)
+#define HI_SIFT_DOWN			CONCAT2(RngMedHiSiftDown,REAL_TYPE)
+#define HEAP_INIT			CONCAT2(RngMedHeapInit,REAL_TYPE)
+#define HEAP_REPLACE			CONCAT2(RngMedHeapReplace,REAL_TYPE)
+#define HEAP_MEDIAN			CONCAT2(RngMedHeapMedian,REAL_TYPE)
+#define HEAP_BLOCK			CONCAT2(RngMedHeapBlock,REAL_TYPE)
+#define HEAP_NODE_COMPARE		CONCAT2(RngMedHeapNodeCompare,REAL_TYPE)
+#define RUNNING_MEDIAN_FUNCTION		CONCAT3(XLAL,REAL_TYPE,RunningMedian)
+#define RUNNING_MEDIAN_BATCH_FUNCTION	CONCAT3(XLAL,REAL_TYPE,RunningMedianBatch)
+
+/* a heap node: a value in the window, and its index in the window */
+typedef struct {
+  REAL_TYPE value;
+  UINT4 id;
+} HEAP_NODE;
+
+/*
+ * State of the running median of one series: a max-heap 'lo' holding the
+ * smaller (blocksize+1)/2 values of the window, a min-heap 'hi' holding the
+ * larger blocksize/2 values, and the position of each window element in
+ * the heaps, indexed by its position in the circular window.
+ */
+typedef struct {
+  HEAP_NODE *lo;
+  HEAP_NODE *hi;
+  UINT4 *pos;
+  UINT4 nlo;
+  UINT4 nhi;
+  UINT4 oldest;
+} HEAP_STATE;
+
+static void LO_SIFT_UP(HEAP_STATE *s, UINT4 i)
+{
+  HEAP_NODE *lo = s->lo;
+  const HEAP_NODE x = lo[i];
+  while (i > 0) {
+    const UINT4 p = (i - 1) / 2;
+    if (!(lo[p].value < x.value))
+      break;
+    lo[i] = lo[p];
+    s->pos[lo[i].id] = i;
+    i = p;
+  }
+  lo[i] = x;
+  s->pos[x.id] = i;
+}
+
+static void LO_SIFT_DOWN(HEAP_STATE *s, UINT4 i)
+{
+  HEAP_NODE *lo = s->lo;
+  const UINT4 n = s->nlo;
+  const HEAP_NODE x = lo[i];
+  for (;;) {
+    UINT4 c = 2 * i + 1;
+    if (c >= n)
+      break;
+    if (c + 1 < n && lo[c].value < lo[c + 1].value)
+      ++c;
+    if (!(x.value < lo[c].value))
+      break;
+    lo[i] = lo[c];
+    s->pos[lo[i].id] = i;
+    i = c;
+  }
+  lo[i] = x;
+  s->pos[x.id] = i;
+}
+
+static void HI_SIFT_UP(HEAP_STATE *s, UINT4 i)
+{
+  HEAP_NODE *hi = s->hi;
+  const HEAP_NODE x = hi[i];
+  while (i > 0) {
+    const UINT4 p = (i - 1) / 2;
+    if (!(x.value < hi[p].value))
+      break;
+    hi[i] = hi[p];
+    s->pos[hi[i].id] = i | RNGMED_HI_FLAG;
+    i = p;
+  }
+  hi[i] = x;
+  s->pos[x.id] = i | RNGMED_HI_FLAG;
+}
+
+static void HI_SIFT_DOWN(HEAP_STATE *s, UINT4 i)
+{
+  HEAP_NODE *hi = s->hi;
+  const UINT4 n = s->nhi;
+  const HEAP_NODE x = hi[i];
+  for (;;) {
+    UINT4 c = 2 * i + 1;
+    if (c >= n)
+      break;
+    if (c + 1 < n && hi[c + 1].value < hi[c].value)
+      ++c;
+    if (!(hi[c].value < x.value))
+      break;
+    hi[i] = hi[c];
+    s->pos[hi[i].id] = i | RNGMED_HI_FLAG;
+    i = c;
+  }
+  hi[i] = x;
+  s->pos[x.id] = i | RNGMED_HI_FLAG;
+}
+
+static int HEAP_NODE_COMPARE(const void *a, const void *b)
+{
+  const REAL_TYPE x = ((const HEAP_NODE *) a)->value;
+  const REAL_TYPE y = ((const HEAP_NODE *) b)->value;
+  return (x > y) - (x < y);
+}
+
+/* fill the heaps with the first window; 'sorted' is workspace of blocksize nodes */
+static void HEAP_INIT(HEAP_STATE *s, const REAL_TYPE *data, HEAP_NODE *sorted)
+{
+  const UINT4 n = s->nlo + s->nhi;
+  for (UINT4 i = 0; i < n; ++i) {
+    sorted[i].value = data[i];
+    sorted[i].id = i;
+  }
+  qsort(sorted, n, sizeof(sorted[0]), HEAP_NODE_COMPARE);
+
+  /* an array sorted in descending/ascending order is a max-/min-heap */
+  for (UINT4 i = 0; i < s->nlo; ++i) {
+    s->lo[i] = sorted[s->nlo - 1 - i];
+    s->pos[s->lo[i].id] = i;
+  }
+  for (UINT4 i = 0; i < s->nhi; ++i) {
+    s->hi[i] = sorted[s->nlo + i];
+    s->pos[s->hi[i].id] = i | RNGMED_HI_FLAG;
+  }
+  s->oldest = 0;
+}
+
+/* replace the oldest value in the window with 'value' */
+static inline void HEAP_REPLACE(HEAP_STATE *s, REAL_TYPE value)
+{
+  const UINT4 id = s->oldest;
+  const UINT4 p = s->pos[id];
+  if (++s->oldest == s->nlo + s->nhi)
+    s->oldest = 0;
+
+  /* update the value in place, and restore the heap it is in */
+  if (p & RNGMED_HI_FLAG) {
+    const UINT4 i = p & ~RNGMED_HI_FLAG;
+    const REAL_TYPE old = s->hi[i].value;
+    s->hi[i].value = value;
+    if (value < old)
+      HI_SIFT_UP(s, i);
+    else if (old < value)
+      HI_SIFT_DOWN(s, i);
+  } else {
+    const UINT4 i = p;
+    const REAL_TYPE old = s->lo[i].value;
+    s->lo[i].value = value;
+    if (old < value)
+      LO_SIFT_UP(s, i);
+    else if (value < old)
+      LO_SIFT_DOWN(s, i);
+  }
+
+  /* only the roots can now be out of order across the two heaps */
+  if (s->nhi > 0 && s->hi[0].value < s->lo[0].value) {
+    const HEAP_NODE x = s->lo[0];
+    s->lo[0] = s->hi[0];
+    s->hi[0] = x;
+    LO_SIFT_DOWN(s, 0);
+    HI_SIFT_DOWN(s, 0);
+  }
+}
+
+/* median of the window; the sum is rounded as in LALDRunningMedian2()/LALSRunningMedian2() */
+static inline REAL_TYPE HEAP_MEDIAN(const HEAP_STATE *s)
+{
+  if (s->nlo > s->nhi)
+    return s->lo[0].value;
+  return (s->lo[0].value + s->hi[0].value) / 2.0;
+}
+
+/*
+ * Compute the running medians of 'nseries' series at once, advancing all
+ * windows in lockstep; the heaps of independent series interleave, which
+ * hides the latency of their data-dependent branches and memory accesses.
+ */
+static void HEAP_BLOCK(HEAP_STATE *states, HEAP_NODE *sorted, UINT4 nseries, UINT4 blocksize, UINT4 nmedians,
+                       const REAL_TYPE *input, UINT4 instride, REAL_TYPE *medians, UINT4 outstride)
+{
+  for (UINT4 b = 0; b < nseries; ++b) {
+    HEAP_INIT(&states[b], input + b * instride, sorted);
+    medians[b * outstride] = HEAP_MEDIAN(&states[b]);
+  }
+  for (UINT4 k = 1; k < nmedians; ++k) {
+    for (UINT4 b = 0; b < nseries; ++b) {
+      HEAP_REPLACE(&states[b], input[b * instride + k + blocksize - 1]);
+      medians[b * outstride + k] = HEAP_MEDIAN(&states[b]);
+    }
+  }
+}
+
+int RUNNING_MEDIAN_FUNCTION(SEQUENCE_TYPE *medians, const SEQUENCE_TYPE *input, UINT4 blocksize)
+{
+  XLAL_CHECK(medians != NULL && input != NULL, XLAL_EFAULT);
+  XLAL_CHECK(medians->data != NULL && input->data != NULL, XLAL_EINVAL);
+  XLAL_CHECK(blocksize > 0 && blocksize < RNGMED_HI_FLAG, XLAL_EINVAL, "Invalid blocksize %u", blocksize);
+  XLAL_CHECK(blocksize <= input->length, XLAL_EBADLEN, "Blocksize %u is larger than input length %u", blocksize, input->length);
+  XLAL_CHECK(medians->length == input->length - blocksize + 1, XLAL_EBADLEN, "Medians length %u should be %u", medians->length, input->length - blocksize + 1);
+
+  HEAP_STATE state;
+  state.nlo = (blocksize + 1) / 2;
+  state.nhi = blocksize / 2;
+  HEAP_NODE *nodes = XLALMalloc(2 * blocksize * sizeof(*nodes));
+  state.pos = XLALMalloc(blocksize * sizeof(*state.pos));
+  if (nodes == NULL || state.pos == NULL) {
+    XLALFree(nodes);
+    XLALFree(state.pos);
+    XLAL_ERROR(XLAL_ENOMEM);
+  }
+  state.lo = nodes;
+  state.hi = nodes + state.nlo;
+
+  HEAP_BLOCK(&state, nodes + blocksize, 1, blocksize, medians->length, input->data, 0, medians->data, 0);
+
+  XLALFree(nodes);
+  XLALFree(state.pos);
+
+  return XLAL_SUCCESS;
+}
+
+int RUNNING_MEDIAN_BATCH_FUNCTION(VECTOR_SEQUENCE_TYPE *medians, const VECTOR_SEQUENCE_TYPE *input, UINT4 blocksize)
+{
+  XLAL_CHECK(medians != NULL && input != NULL, XLAL_EFAULT);
+  XLAL_CHECK(medians->data != NULL && input->data != NULL, XLAL_EINVAL);
+  XLAL_CHECK(blocksize > 0 && blocksize < RNGMED_HI_FLAG, XLAL_EINVAL, "Invalid blocksize %u", blocksize);
+  XLAL_CHECK(blocksize <= input->vectorLength, XLAL_EBADLEN, "Blocksize %u is larger than input vector length %u", blocksize, input->vectorLength);
+  XLAL_CHECK(medians->length == input->length, XLAL_EBADLEN, "Medians has %u vectors, input has %u", medians->length, input->length);
+  XLAL_CHECK(medians->vectorLength == input->vectorLength - blocksize + 1, XLAL_EBADLEN, "Medians vector length %u should be %u", medians->vectorLength, input->vectorLength - blocksize + 1);
+
+  /* allocate the states of one block of series in a single workspace */
+  const UINT4 nblock = (input->length < RNGMED_BATCH_BLOCK) ? input->length : RNGMED_BATCH_BLOCK;
+  if (nblock == 0)
+    return XLAL_SUCCESS;
+  HEAP_STATE states[RNGMED_BATCH_BLOCK];
+  HEAP_NODE *nodes = XLALMalloc((nblock + 1) * blocksize * sizeof(*nodes));
+  UINT4 *pos = XLALMalloc(nblock * blocksize * sizeof(*pos));
+  if (nodes == NULL || pos == NULL) {
+    XLALFree(nodes);
+    XLALFree(pos);
+    XLAL_ERROR(XLAL_ENOMEM);
+  }
+  for (UINT4 b = 0; b < nblock; ++b) {
+    states[b].nlo = (blocksize + 1) / 2;
+    states[b].nhi = blocksize / 2;
+    states[b].lo = nodes + b * blocksize;
+    states[b].hi = states[b].lo + states[b].nlo;
+    states[b].pos = pos + b * blocksize;
+  }
+
+  for (UINT4 j = 0; j < input->length; j += nblock) {
+    const UINT4 nseries = (input->length - j < nblock) ? input->length - j : nblock;
+    HEAP_BLOCK(states, nodes + nblock * blocksize, nseries, blocksize, medians->vectorLength,
+               input->data + j * input->vectorLength, input->vectorLength,
+               medians->data + j * medians->vectorLength, medians->vectorLength);
+  }
+
+  XLALFree(nodes);
+  XLALFree(pos);
+
+  return XLAL_SUCCESS;
+}
+
+#undef CONCAT2x
+#undef CONCAT2
+#undef CONCAT3x
+#undef CONCAT3
+
+#undef REAL_TYPE
+
+#undef SEQUENCE_TYPE
+#undef VECTOR_SEQUENCE_TYPE
+#undef HEAP_NODE
+#undef HEAP_STATE
+#undef LO_SIFT_UP
+#undef LO_SIFT_DOWN
+#undef HI_SIFT_UP
+#undef HI_SIFT_DOWN
+#undef HEAP_INIT
+#undef HEAP_REPLACE
+#undef HEAP_MEDIAN
+#undef HEAP_BLOCK
+#undef HEAP_NODE_COMPARE
+#undef RUNNING_MEDIAN_FUNCTION
+#undef RUNNING_MEDIAN_BATCH_FUNCTION
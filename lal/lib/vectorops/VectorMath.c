@@ -187,6 +187,7 @@ EXPORT_VECTORMATH_DD2D(Add, AVX2, AVX, SSE2, NONE)
 EXPORT_VECTORMATH_DD2D(Sub, AVX2, AVX, SSE2, NONE)
 EXPORT_VECTORMATH_DD2D(Multiply, AVX2, AVX, SSE2, NONE)
 EXPORT_VECTORMATH_DD2D(Max, AVX2, AVX, NONE, NONE)
+EXPORT_VECTORMATH_DD2D(Atan2, AVX512F, AVX2, AVX, SSE2)
 
 // ---------- define exported vector math functions with 2 COMPLEX8 vector inputs to 1 COMPLEX8 vector output (CC2C) ----------
 #define EXPORT_VECTORMATH_CC2C(NAME, ...)                                    \
@@ -207,4 +208,27 @@ EXPORT_VECTORMATH_cC2C(Shift, AVX2, AVX, SSE2, NONE)
   EXPORT_VECTORMATH_ANY( NAME ## REAL8, (REAL8 *out, const REAL8 *in, const UINT4 len), (out, in, len), __VA_ARGS__ )
 
 EXPORT_VECTORMATH_D2D(Round, AVX2, AVX, NONE, NONE)
+EXPORT_VECTORMATH_D2D(Sin, AVX512F, AVX2, AVX, SSE2)
+EXPORT_VECTORMATH_D2D(Cos, AVX512F, AVX2, AVX, SSE2)
+EXPORT_VECTORMATH_D2D(Exp, AVX512F, AVX2, AVX, SSE2)
+EXPORT_VECTORMATH_D2D(Log, AVX512F, AVX2, AVX, SSE2)
+
+// ---------- define exported vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+#define EXPORT_VECTORMATH_D2DD(NAME, ...)                                    \
+  EXPORT_VECTORMATH_ANY( NAME ## REAL8, (REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len), (out1, out2, in, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_D2DD(SinCos, AVX512F, AVX2, AVX, SSE2)
+EXPORT_VECTORMATH_D2DD(SinCos2Pi, AVX512F, AVX2, AVX, SSE2)
+
+// ---------- define exported vector math functions with 1 COMPLEX16 vector input to 1 COMPLEX16 vector output (Z2Z) ----------
+#define EXPORT_VECTORMATH_Z2Z(NAME, ...)                                     \
+  EXPORT_VECTORMATH_ANY( NAME ## COMPLEX16, (COMPLEX16 *out, const COMPLEX16 *in, const UINT4 len), (out, in, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_Z2Z(Exp, AVX512F, AVX2, AVX, SSE2)
+
+// ---------- define exported vector math functions with 2 REAL8 vector inputs to 1 COMPLEX16 vector output (DD2Z) ----------
+#define EXPORT_VECTORMATH_DD2Z(NAME, ...)                                    \
+  EXPORT_VECTORMATH_ANY( NAME ## COMPLEX16, (COMPLEX16 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len), (out, in1, in2, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_DD2Z(Polar, AVX512F, AVX2, AVX, SSE2)
 
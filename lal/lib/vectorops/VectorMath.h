@@ -43,7 +43,7 @@ extern "C" {
  * ### Alignment ###
  *
  * Neither input nor output vectors are \b required to have any particular memory alignment. Nevertheless, performance
- * \e may be improved if vectors are 16-byte aligned for SSE, and 32-byte aligned for AVX.
+ * \e may be improved if vectors are 16-byte aligned for SSE, 32-byte aligned for AVX, and 64-byte aligned for AVX-512.
  */
 /** @{ */
 
@@ -162,6 +162,33 @@ int XLALVectorSinCosREAL4 ( REAL4 *out1, REAL4 *out2, const REAL4 *in, const UIN
 /** Compute \f$\text{out1} = \sin(2\pi \text{in}), \text{out2} = \cos(2\pi \text{in})\f$ over REAL4 vectors \c out1, \c out2, \c in with \c len elements */
 int XLALVectorSinCos2PiREAL4 ( REAL4 *out1, REAL4 *out2, const REAL4 *in, const UINT4 len );
 
+/** Compute \f$\text{out} = \sin(\text{in})\f$ over REAL8 vectors \c out, \c in with \c len elements; absolute error \f$\le 2.3\times10^{-16}\f$ for \f$|\text{in}| \le 2^{30}\f$ */
+int XLALVectorSinREAL8 ( REAL8 *out, const REAL8 *in, const UINT4 len );
+
+/** Compute \f$\text{out} = \cos(\text{in})\f$ over REAL8 vectors \c out, \c in with \c len elements; absolute error \f$\le 2.3\times10^{-16}\f$ for \f$|\text{in}| \le 2^{30}\f$ */
+int XLALVectorCosREAL8 ( REAL8 *out, const REAL8 *in, const UINT4 len );
+
+/** Compute \f$\text{out} = \exp(\text{in})\f$ over REAL8 vectors \c out, \c in with \c len elements; relative error \f$\le 2\f$ ulp, results below \c DBL_MIN are flushed to zero */
+int XLALVectorExpREAL8 ( REAL8 *out, const REAL8 *in, const UINT4 len );
+
+/** Compute \f$\text{out} = \log(\text{in})\f$ over REAL8 vectors \c out, \c in with \c len elements; relative error \f$\le 1\f$ ulp */
+int XLALVectorLogREAL8 ( REAL8 *out, const REAL8 *in, const UINT4 len );
+
+/** Compute \f$\text{out1} = \sin(\text{in}), \text{out2} = \cos(\text{in})\f$ over REAL8 vectors \c out1, \c out2, \c in with \c len elements; absolute error \f$\le 2.3\times10^{-16}\f$ for \f$|\text{in}| \le 2^{30}\f$ */
+int XLALVectorSinCosREAL8 ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len );
+
+/** Compute \f$\text{out1} = \sin(2\pi \text{in}), \text{out2} = \cos(2\pi \text{in})\f$ over REAL8 vectors \c out1, \c out2, \c in with \c len elements; absolute error \f$\le 2.3\times10^{-16}\f$ for all finite \c in */
+int XLALVectorSinCos2PiREAL8 ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len );
+
+/** Compute \f$\text{out} = \operatorname{atan2}(\text{in1}, \text{in2})\f$ over REAL8 vectors \c out, \c in1, \c in2 with \c len elements; relative error \f$\le 2\f$ ulp */
+int XLALVectorAtan2REAL8 ( REAL8 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len );
+
+/** Compute \f$\text{out} = \exp(\text{in})\f$ over COMPLEX16 vectors \c out, \c in with \c len elements */
+int XLALVectorExpCOMPLEX16 ( COMPLEX16 *out, const COMPLEX16 *in, const UINT4 len );
+
+/** Compute \f$\text{out} = \text{in1} \exp(i\,\text{in2})\f$ over COMPLEX16 vector \c out and REAL8 vectors \c in1, \c in2 with \c len elements */
+int XLALVectorPolarCOMPLEX16 ( COMPLEX16 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len );
+
 /** @} */
 
 /** \name Vector by Vector Operations */
@@ -0,0 +1,255 @@
+//
+// Copyright (C) 2026
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+// MA  02111-1307  USA
+//
+
+// ---------- INCLUDES ----------
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <config.h>
+
+#include <lal/LALConstants.h>
+#include <lal/VectorMath.h>
+
+#include "VectorMath_internal.h"
+
+#ifndef __AVX512F__
+#error "VectorMath_AVX512F.c requires SIMD instruction set AVX512F"
+#endif
+
+#include <immintrin.h>
+
+// ---------- primitive operations for double-precision math functions ----------
+// AVX512F has no floating-point logical operations (these are in AVX512DQ) and returns
+// comparison results in mask registers, so both are expressed through 64-bit integer operations
+#define PD_I(a)                 _mm512_castpd_si512 ( a )
+#define PD_D(a)                 _mm512_castsi512_pd ( a )
+#define PD_MASK(k)              PD_D ( _mm512_maskz_set1_epi64 ( k, -1 ) )
+#define PD_T                    __m512d
+#define PD_SET1(x)              _mm512_set1_pd ( x )
+#define PD_ADD(a,b)             _mm512_add_pd ( a, b )
+#define PD_SUB(a,b)             _mm512_sub_pd ( a, b )
+#define PD_MUL(a,b)             _mm512_mul_pd ( a, b )
+#define PD_DIV(a,b)             _mm512_div_pd ( a, b )
+#define PD_MIN(a,b)             _mm512_min_pd ( a, b )
+#define PD_MAX(a,b)             _mm512_max_pd ( a, b )
+#define PD_AND(a,b)             PD_D ( _mm512_and_epi64 ( PD_I ( a ), PD_I ( b ) ) )
+#define PD_ANDNOT(a,b)          PD_D ( _mm512_andnot_epi64 ( PD_I ( a ), PD_I ( b ) ) )
+#define PD_OR(a,b)              PD_D ( _mm512_or_epi64 ( PD_I ( a ), PD_I ( b ) ) )
+#define PD_XOR(a,b)             PD_D ( _mm512_xor_epi64 ( PD_I ( a ), PD_I ( b ) ) )
+#define PD_CMPEQ(a,b)           PD_MASK ( _mm512_cmp_pd_mask ( a, b, _CMP_EQ_OQ ) )
+#define PD_CMPLT(a,b)           PD_MASK ( _mm512_cmp_pd_mask ( a, b, _CMP_LT_OQ ) )
+#define PD_CMPLE(a,b)           PD_MASK ( _mm512_cmp_pd_mask ( a, b, _CMP_LE_OQ ) )
+#define PD_CMPGT(a,b)           PD_MASK ( _mm512_cmp_pd_mask ( a, b, _CMP_GT_OQ ) )
+#define PD_CMPUNORD(a,b)        PD_MASK ( _mm512_cmp_pd_mask ( a, b, _CMP_UNORD_Q ) )
+#define PD_SELECT(m,a,b)        _mm512_mask_blend_pd ( _mm512_test_epi64_mask ( PD_I ( m ), PD_I ( m ) ), b, a )
+#define PD_SLLI64(a,n)          PD_D ( _mm512_slli_epi64 ( PD_I ( a ), n ) )
+#define PD_SRLI64(a,n)          PD_D ( _mm512_srli_epi64 ( PD_I ( a ), n ) )
+
+#include "VectorMath_pd_mathfun.h"
+
+// ---------- local operators and operator-wrappers ----------
+
+// permutation indices to de-interleave/interleave real and imaginary parts of 8 COMPLEX16 numbers
+#define LOCAL_IDX_RE            _mm512_setr_epi64 ( 0, 2, 4, 6, 8, 10, 12, 14 )
+#define LOCAL_IDX_IM            _mm512_setr_epi64 ( 1, 3, 5, 7, 9, 11, 13, 15 )
+#define LOCAL_IDX_LO            _mm512_setr_epi64 ( 0, 8, 1, 9, 2, 10, 3, 11 )
+#define LOCAL_IDX_HI            _mm512_setr_epi64 ( 4, 12, 5, 13, 6, 14, 7, 15 )
+
+// ========== internal generic AVX512F functions ==========
+
+// remaining (<=7) terms are handled with masked loads and stores
+#define LOCAL_TAIL_MASK(n)      ( (__mmask8) ( ( 1u << (n) ) - 1u ) )
+
+// ---------- generic AVX512F operator with 1 REAL8 vector input to 1 REAL8 vector output (D2D) ----------
+static inline int
+XLALVectorMath_D2D_AVX512F ( REAL8 *out, const REAL8 *in, const UINT4 len, __m512d (*f)(__m512d) )
+{
+
+  // walk through vector in blocks of 8
+  UINT4 i8Max = len - ( len % 8 );
+  for ( UINT4 i8 = 0; i8 < i8Max; i8 += 8 )
+    {
+      __m512d in8p = _mm512_loadu_pd(&in[i8]);
+      __m512d out8p = (*f)( in8p );
+      _mm512_storeu_pd(&out[i8], out8p);
+    }
+
+  // deal with the remaining (<=7) terms separately
+  if ( i8Max < len )
+    {
+      __mmask8 m = LOCAL_TAIL_MASK ( len - i8Max );
+      __m512d in8p = _mm512_maskz_loadu_pd(m, &in[i8Max]);
+      __m512d out8p = (*f)( in8p );
+      _mm512_mask_storeu_pd(&out[i8Max], m, out8p);
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_D2D_AVX512F()
+
+// ---------- generic AVX512F operator with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+static inline int
+XLALVectorMath_D2DD_AVX512F ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len, void (*f)(__m512d, __m512d*, __m512d*) )
+{
+
+  // walk through vector in blocks of 8
+  UINT4 i8Max = len - ( len % 8 );
+  for ( UINT4 i8 = 0; i8 < i8Max; i8 += 8 )
+    {
+      __m512d in8p = _mm512_loadu_pd(&in[i8]);
+      __m512d out8p_1, out8p_2;
+      (*f) ( in8p, &out8p_1, &out8p_2 );
+      _mm512_storeu_pd(&out1[i8], out8p_1);
+      _mm512_storeu_pd(&out2[i8], out8p_2);
+    }
+
+  // deal with the remaining (<=7) terms separately
+  if ( i8Max < len )
+    {
+      __mmask8 m = LOCAL_TAIL_MASK ( len - i8Max );
+      __m512d in8p = _mm512_maskz_loadu_pd(m, &in[i8Max]);
+      __m512d out8p_1, out8p_2;
+      (*f) ( in8p, &out8p_1, &out8p_2 );
+      _mm512_mask_storeu_pd(&out1[i8Max], m, out8p_1);
+      _mm512_mask_storeu_pd(&out2[i8Max], m, out8p_2);
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_D2DD_AVX512F()
+
+// ---------- generic AVX512F operator with 2 REAL8 vector inputs to 1 REAL8 vector output (DD2D) ----------
+static inline int
+XLALVectorMath_DD2D_AVX512F ( REAL8 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len, __m512d (*op)(__m512d, __m512d) )
+{
+
+  // walk through vector in blocks of 8
+  UINT4 i8Max = len - ( len % 8 );
+  for ( UINT4 i8 = 0; i8 < i8Max; i8 += 8 )
+    {
+      __m512d in8p_1 = _mm512_loadu_pd(&in1[i8]);
+      __m512d in8p_2 = _mm512_loadu_pd(&in2[i8]);
+      __m512d out8p = (*op) ( in8p_1, in8p_2 );
+      _mm512_storeu_pd(&out[i8], out8p);
+    }
+
+  // deal with the remaining (<=7) terms separately
+  if ( i8Max < len )
+    {
+      __mmask8 m = LOCAL_TAIL_MASK ( len - i8Max );
+      __m512d in8p_1 = _mm512_maskz_loadu_pd(m, &in1[i8Max]);
+      __m512d in8p_2 = _mm512_maskz_loadu_pd(m, &in2[i8Max]);
+      __m512d out8p = (*op) ( in8p_1, in8p_2 );
+      _mm512_mask_storeu_pd(&out[i8Max], m, out8p);
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_DD2D_AVX512F()
+
+// ---------- generic AVX512F operator with 1 COMPLEX16 vector input to 1 COMPLEX16 vector output (Z2Z) ----------
+static inline int
+XLALVectorMath_Z2Z_AVX512F ( COMPLEX16 *out, const COMPLEX16 *in, const UINT4 len, void (*f)(__m512d, __m512d, __m512d*, __m512d*) )
+{
+
+  // walk through vector in blocks of 8
+  for ( UINT4 i8 = 0; i8 < len; i8 += 8 )
+    {
+      // masks for the (up to) 16 doubles in this block; the final block may be partial
+      const UINT4 n = ( len - i8 < 8 ) ? ( len - i8 ) : 8;
+      const __mmask8 m1 = LOCAL_TAIL_MASK ( ( n < 4 ) ? 2*n : 8 );
+      const __mmask8 m2 = LOCAL_TAIL_MASK ( ( n > 4 ) ? 2*(n - 4) : 0 );
+
+      // de-interleave real and imaginary parts
+      __m512d in8p_1 = _mm512_maskz_loadu_pd(m1, (const REAL8*)&in[i8]);
+      __m512d in8p_2 = _mm512_maskz_loadu_pd(m2, (const REAL8*)&in[i8+4]);
+      __m512d in8p_re = _mm512_permutex2var_pd(in8p_1, LOCAL_IDX_RE, in8p_2);
+      __m512d in8p_im = _mm512_permutex2var_pd(in8p_1, LOCAL_IDX_IM, in8p_2);
+      __m512d out8p_re, out8p_im;
+      (*f) ( in8p_re, in8p_im, &out8p_re, &out8p_im );
+      _mm512_mask_storeu_pd( (REAL8*)&out[i8], m1, _mm512_permutex2var_pd(out8p_re, LOCAL_IDX_LO, out8p_im) );
+      _mm512_mask_storeu_pd( (REAL8*)&out[i8+4], m2, _mm512_permutex2var_pd(out8p_re, LOCAL_IDX_HI, out8p_im) );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_Z2Z_AVX512F()
+
+// ---------- generic AVX512F operator with 2 REAL8 vector inputs to 1 COMPLEX16 vector output (DD2Z) ----------
+static inline int
+XLALVectorMath_DD2Z_AVX512F ( COMPLEX16 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len, void (*f)(__m512d, __m512d, __m512d*, __m512d*) )
+{
+
+  // walk through vector in blocks of 8
+  for ( UINT4 i8 = 0; i8 < len; i8 += 8 )
+    {
+      // masks for the (up to) 8 inputs and 16 output doubles in this block; the final block may be partial
+      const UINT4 n = ( len - i8 < 8 ) ? ( len - i8 ) : 8;
+      const __mmask8 m = LOCAL_TAIL_MASK ( n );
+      const __mmask8 m1 = LOCAL_TAIL_MASK ( ( n < 4 ) ? 2*n : 8 );
+      const __mmask8 m2 = LOCAL_TAIL_MASK ( ( n > 4 ) ? 2*(n - 4) : 0 );
+
+      __m512d in8p_1 = _mm512_maskz_loadu_pd(m, &in1[i8]);
+      __m512d in8p_2 = _mm512_maskz_loadu_pd(m, &in2[i8]);
+      __m512d out8p_re, out8p_im;
+      (*f) ( in8p_1, in8p_2, &out8p_re, &out8p_im );
+      // interleave real and imaginary parts
+      _mm512_mask_storeu_pd( (REAL8*)&out[i8], m1, _mm512_permutex2var_pd(out8p_re, LOCAL_IDX_LO, out8p_im) );
+      _mm512_mask_storeu_pd( (REAL8*)&out[i8+4], m2, _mm512_permutex2var_pd(out8p_re, LOCAL_IDX_HI, out8p_im) );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_DD2Z_AVX512F()
+
+// ========== internal AVX512F vector math functions ==========
+
+// ---------- define vector math functions with 1 REAL8 vector input to 1 REAL8 vector output (D2D) ----------
+#define DEFINE_VECTORMATH_D2D(NAME, AVX512_OP)                          \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_D2D_AVX512F, NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, AVX512_OP ) )
+
+DEFINE_VECTORMATH_D2D(Sin, sin_pd)
+DEFINE_VECTORMATH_D2D(Cos, cos_pd)
+DEFINE_VECTORMATH_D2D(Exp, exp_pd)
+DEFINE_VECTORMATH_D2D(Log, log_pd)
+
+// ---------- define vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+#define DEFINE_VECTORMATH_D2DD(NAME, AVX512_OP)                         \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_D2DD_AVX512F, NAME ## REAL8, ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len ), ( (out1 != NULL) && (out2 != NULL) && (in != NULL) ), ( out1, out2, in, len, AVX512_OP ) )
+
+DEFINE_VECTORMATH_D2DD(SinCos, sincos_pd)
+DEFINE_VECTORMATH_D2DD(SinCos2Pi, sincos_pd_2pi)
+
+// ---------- define vector math functions with 2 REAL8 vector inputs to 1 REAL8 vector output (DD2D) ----------
+#define DEFINE_VECTORMATH_DD2D(NAME, AVX512_OP)                         \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_DD2D_AVX512F, NAME ## REAL8, ( REAL8 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, AVX512_OP ) )
+
+DEFINE_VECTORMATH_DD2D(Atan2, atan2_pd)
+
+// ---------- define vector math functions with 1 COMPLEX16 vector input to 1 COMPLEX16 vector output (Z2Z) ----------
+#define DEFINE_VECTORMATH_Z2Z(NAME, AVX512_OP)                          \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_Z2Z_AVX512F, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, AVX512_OP ) )
+
+DEFINE_VECTORMATH_Z2Z(Exp, cexp_pd)
+
+// ---------- define vector math functions with 2 REAL8 vector inputs to 1 COMPLEX16 vector output (DD2Z) ----------
+#define DEFINE_VECTORMATH_DD2Z(NAME, AVX512_OP)                         \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_DD2Z_AVX512F, NAME ## COMPLEX16, ( COMPLEX16 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, AVX512_OP ) )
+
+DEFINE_VECTORMATH_DD2Z(Polar, polar_pd)
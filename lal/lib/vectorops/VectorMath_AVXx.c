@@ -35,6 +35,50 @@
 
 #include "VectorMath_avx_mathfun.h"
 
+// ---------- primitive operations for double-precision math functions ----------
+#define PD_T                    __m256d
+#define PD_SET1(x)              _mm256_set1_pd ( x )
+#define PD_ADD(a,b)             _mm256_add_pd ( a, b )
+#define PD_SUB(a,b)             _mm256_sub_pd ( a, b )
+#define PD_MUL(a,b)             _mm256_mul_pd ( a, b )
+#define PD_DIV(a,b)             _mm256_div_pd ( a, b )
+#define PD_MIN(a,b)             _mm256_min_pd ( a, b )
+#define PD_MAX(a,b)             _mm256_max_pd ( a, b )
+#define PD_AND(a,b)             _mm256_and_pd ( a, b )
+#define PD_ANDNOT(a,b)          _mm256_andnot_pd ( a, b )
+#define PD_OR(a,b)              _mm256_or_pd ( a, b )
+#define PD_XOR(a,b)             _mm256_xor_pd ( a, b )
+#define PD_CMPEQ(a,b)           _mm256_cmp_pd ( a, b, _CMP_EQ_OQ )
+#define PD_CMPLT(a,b)           _mm256_cmp_pd ( a, b, _CMP_LT_OQ )
+#define PD_CMPLE(a,b)           _mm256_cmp_pd ( a, b, _CMP_LE_OQ )
+#define PD_CMPGT(a,b)           _mm256_cmp_pd ( a, b, _CMP_GT_OQ )
+#define PD_CMPUNORD(a,b)        _mm256_cmp_pd ( a, b, _CMP_UNORD_Q )
+#define PD_SELECT(m,a,b)        _mm256_blendv_pd ( b, a, m )
+#ifdef __AVX2__
+#define PD_SLLI64(a,n)          _mm256_castsi256_pd ( _mm256_slli_epi64 ( _mm256_castpd_si256 ( a ), n ) )
+#define PD_SRLI64(a,n)          _mm256_castsi256_pd ( _mm256_srli_epi64 ( _mm256_castpd_si256 ( a ), n ) )
+#else
+// AVX has no 256-bit integer shifts, so shift each 128-bit half with SSE2
+UNUSED static inline __m256d
+local_slli64_pd ( __m256d in, const int n )
+{
+  __m128i lo = _mm_slli_epi64 ( _mm_castpd_si128 ( _mm256_castpd256_pd128 ( in ) ), n );
+  __m128i hi = _mm_slli_epi64 ( _mm_castpd_si128 ( _mm256_extractf128_pd ( in, 1 ) ), n );
+  return _mm256_insertf128_pd ( _mm256_castpd128_pd256 ( _mm_castsi128_pd ( lo ) ), _mm_castsi128_pd ( hi ), 1 );
+}
+UNUSED static inline __m256d
+local_srli64_pd ( __m256d in, const int n )
+{
+  __m128i lo = _mm_srli_epi64 ( _mm_castpd_si128 ( _mm256_castpd256_pd128 ( in ) ), n );
+  __m128i hi = _mm_srli_epi64 ( _mm_castpd_si128 ( _mm256_extractf128_pd ( in, 1 ) ), n );
+  return _mm256_insertf128_pd ( _mm256_castpd128_pd256 ( _mm_castsi128_pd ( lo ) ), _mm_castsi128_pd ( hi ), 1 );
+}
+#define PD_SLLI64(a,n)          local_slli64_pd ( a, n )
+#define PD_SRLI64(a,n)          local_srli64_pd ( a, n )
+#endif
+
+#include "VectorMath_pd_mathfun.h"
+
 // ---------- local operators and operator-wrappers ----------
 UNUSED static inline __m256
 local_add_ps ( __m256 in1, __m256 in2 )
@@ -468,6 +512,111 @@ XLALVectorMath_D2D_AVXx ( REAL8 *out, const REAL8 *in, const UINT4 len, __m256d
 
 } // XLALVectorMath_D2D_AVXx()
 
+// ---------- generic AVXx operator with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+static inline int
+XLALVectorMath_D2DD_AVXx ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len, void (*f)(__m256d, __m256d*, __m256d*) )
+{
+
+  // walk through vector in blocks of 4
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      __m256d in4p = _mm256_loadu_pd(&in[i4]);
+      __m256d out4p_1, out4p_2;
+      (*f) ( in4p, &out4p_1, &out4p_2 );
+      _mm256_storeu_pd(&out1[i4], out4p_1);
+      _mm256_storeu_pd(&out2[i4], out4p_2);
+    }
+
+  // deal with the remaining (<=3) terms separately
+  V4SD in4 = {.f={0,0,0,0}}, out4_1, out4_2;
+  for ( UINT4 i = i4Max,j=0; i < len; i ++, j++ ) {
+    in4.f[j] = in[i];
+  }
+  (*f) ( in4.v, &out4_1.v, &out4_2.v );
+  for ( UINT4 i = i4Max,j=0; i < len; i ++, j++ ) {
+    out1[i] = out4_1.f[j];
+    out2[i] = out4_2.f[j];
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_D2DD_AVXx()
+
+// ---------- generic AVXx operator with 1 COMPLEX16 vector input to 1 COMPLEX16 vector output (Z2Z) ----------
+static inline int
+XLALVectorMath_Z2Z_AVXx ( COMPLEX16 *out, const COMPLEX16 *in, const UINT4 len, void (*f)(__m256d, __m256d, __m256d*, __m256d*) )
+{
+
+  // walk through vector in blocks of 4
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      // de-interleave real and imaginary parts: (re0,im0,re1,im1), (re2,im2,re3,im3) -> (re0,re1,re2,re3), (im0,im1,im2,im3)
+      __m256d in4p_1 = _mm256_loadu_pd( (const REAL8*)&in[i4] );
+      __m256d in4p_2 = _mm256_loadu_pd( (const REAL8*)&in[i4+2] );
+      __m256d tmp_1 = _mm256_permute2f128_pd(in4p_1, in4p_2, 0x20);
+      __m256d tmp_2 = _mm256_permute2f128_pd(in4p_1, in4p_2, 0x31);
+      __m256d in4p_re = _mm256_unpacklo_pd(tmp_1, tmp_2);
+      __m256d in4p_im = _mm256_unpackhi_pd(tmp_1, tmp_2);
+      __m256d out4p_re, out4p_im;
+      (*f) ( in4p_re, in4p_im, &out4p_re, &out4p_im );
+      tmp_1 = _mm256_unpacklo_pd(out4p_re, out4p_im);
+      tmp_2 = _mm256_unpackhi_pd(out4p_re, out4p_im);
+      _mm256_storeu_pd( (REAL8*)&out[i4], _mm256_permute2f128_pd(tmp_1, tmp_2, 0x20) );
+      _mm256_storeu_pd( (REAL8*)&out[i4+2], _mm256_permute2f128_pd(tmp_1, tmp_2, 0x31) );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  V4SD in4_re = {.f={0,0,0,0}}, in4_im = {.f={0,0,0,0}}, out4_re, out4_im;
+  for ( UINT4 i = i4Max,j=0; i < len; i ++, j++ ) {
+    in4_re.f[j] = creal ( in[i] );
+    in4_im.f[j] = cimag ( in[i] );
+  }
+  (*f) ( in4_re.v, in4_im.v, &out4_re.v, &out4_im.v );
+  for ( UINT4 i = i4Max,j=0; i < len; i ++, j++ ) {
+    out[i] = crect( out4_re.f[j], out4_im.f[j] );
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_Z2Z_AVXx()
+
+// ---------- generic AVXx operator with 2 REAL8 vector inputs to 1 COMPLEX16 vector output (DD2Z) ----------
+static inline int
+XLALVectorMath_DD2Z_AVXx ( COMPLEX16 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len, void (*f)(__m256d, __m256d, __m256d*, __m256d*) )
+{
+
+  // walk through vector in blocks of 4
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      __m256d in4p_1 = _mm256_loadu_pd(&in1[i4]);
+      __m256d in4p_2 = _mm256_loadu_pd(&in2[i4]);
+      __m256d out4p_re, out4p_im;
+      (*f) ( in4p_1, in4p_2, &out4p_re, &out4p_im );
+      // interleave real and imaginary parts
+      __m256d tmp_1 = _mm256_unpacklo_pd(out4p_re, out4p_im);
+      __m256d tmp_2 = _mm256_unpackhi_pd(out4p_re, out4p_im);
+      _mm256_storeu_pd( (REAL8*)&out[i4], _mm256_permute2f128_pd(tmp_1, tmp_2, 0x20) );
+      _mm256_storeu_pd( (REAL8*)&out[i4+2], _mm256_permute2f128_pd(tmp_1, tmp_2, 0x31) );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  V4SD in4_1 = {.f={0,0,0,0}}, in4_2 = {.f={0,0,0,0}}, out4_re, out4_im;
+  for ( UINT4 i = i4Max,j=0; i < len; i ++, j++ ) {
+    in4_1.f[j] = in1[i];
+    in4_2.f[j] = in2[i];
+  }
+  (*f) ( in4_1.v, in4_2.v, &out4_re.v, &out4_im.v );
+  for ( UINT4 i = i4Max,j=0; i < len; i ++, j++ ) {
+    out[i] = crect( out4_re.f[j], out4_im.f[j] );
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_DD2Z_AVXx()
+
 // ========== internal AVXx vector math functions ==========
 
 // ---------- define vector math functions with 1 REAL4 vector input to 1 REAL4 vector output (S2S) ----------
@@ -518,6 +667,7 @@ DEFINE_VECTORMATH_DD2D(Add, local_add_pd)
 DEFINE_VECTORMATH_DD2D(Sub, local_sub_pd)
 DEFINE_VECTORMATH_DD2D(Multiply, local_mul_pd)
 DEFINE_VECTORMATH_DD2D(Max, local_max_pd)
+DEFINE_VECTORMATH_DD2D(Atan2, atan2_pd)
 
 // ---------- define vector math functions with 2 COMPLEX8 vector inputs to 1 COMPLEX8 vector output (CC2C) ----------
 #define DEFINE_VECTORMATH_CC2C(NAME, AVX_OP)                            \
@@ -538,3 +688,26 @@ DEFINE_VECTORMATH_cC2C(Shift, local_add_ps)
   DEFINE_VECTORMATH_ANY( XLALVectorMath_D2D_AVXx, NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, AVX_OP ) )
 
 DEFINE_VECTORMATH_D2D(Round, local_round_pd)
+DEFINE_VECTORMATH_D2D(Sin, sin_pd)
+DEFINE_VECTORMATH_D2D(Cos, cos_pd)
+DEFINE_VECTORMATH_D2D(Exp, exp_pd)
+DEFINE_VECTORMATH_D2D(Log, log_pd)
+
+// ---------- define vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+#define DEFINE_VECTORMATH_D2DD(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_D2DD_AVXx, NAME ## REAL8, ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len ), ( (out1 != NULL) && (out2 != NULL) && (in != NULL) ), ( out1, out2, in, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_D2DD(SinCos, sincos_pd)
+DEFINE_VECTORMATH_D2DD(SinCos2Pi, sincos_pd_2pi)
+
+// ---------- define vector math functions with 1 COMPLEX16 vector input to 1 COMPLEX16 vector output (Z2Z) ----------
+#define DEFINE_VECTORMATH_Z2Z(NAME, AVX_OP)                             \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_Z2Z_AVXx, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_Z2Z(Exp, cexp_pd)
+
+// ---------- define vector math functions with 2 REAL8 vector inputs to 1 COMPLEX16 vector output (DD2Z) ----------
+#define DEFINE_VECTORMATH_DD2Z(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_DD2Z_AVXx, NAME ## COMPLEX16, ( COMPLEX16 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_DD2Z(Polar, polar_pd)
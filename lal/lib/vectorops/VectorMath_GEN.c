@@ -46,6 +46,22 @@ static inline void local_sincosf_2pi(REAL4 in, REAL4 *out1, REAL4 *out2) {
   *out2 = cosf ( (REAL4)LAL_TWOPI * in );
 }
 
+static inline void local_sincos(REAL8 in, REAL8 *out1, REAL8 *out2) {
+  *out1 = sin ( in );
+  *out2 = cos ( in );
+}
+
+static inline void local_sincos_2pi(REAL8 in, REAL8 *out1, REAL8 *out2) {
+  // remove integer part of 'in' exactly before scaling by 2*pi
+  REAL8 f = in - round ( in );
+  *out1 = sin ( LAL_TWOPI * f );
+  *out2 = cos ( LAL_TWOPI * f );
+}
+
+static inline COMPLEX16 local_polar ( REAL8 r, REAL8 phi ) {
+  return crect ( r * cos ( phi ), r * sin ( phi ) );
+}
+
 static inline REAL4 local_addf ( REAL4 x, REAL4 y ) {
   return x + y;
 }
@@ -196,6 +212,39 @@ XLALVectorMath_D2D_GEN ( REAL8 *out, const REAL8 *in, const UINT4 len, REAL8 (*o
   return XLAL_SUCCESS;
 }
 
+// ---------- generic operator with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+static inline int
+XLALVectorMath_D2DD_GEN ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len, void (*op)(REAL8, REAL8*, REAL8*) )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      (*op) ( in[i], &(out1[i]), &(out2[i]) );
+    }
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 1 COMPLEX16 vector input to 1 COMPLEX16 vector output (Z2Z) ----------
+static inline int
+XLALVectorMath_Z2Z_GEN ( COMPLEX16 *out, const COMPLEX16 *in, const UINT4 len, COMPLEX16 (*op)(COMPLEX16) )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      out[i] = (*op) ( in[i] );
+    }
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 2 REAL8 vector inputs to 1 COMPLEX16 vector output (DD2Z) ----------
+static inline int
+XLALVectorMath_DD2Z_GEN ( COMPLEX16 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len, COMPLEX16 (*op)(REAL8, REAL8) )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      out[i] = (*op) ( in1[i], in2[i] );
+    }
+  return XLAL_SUCCESS;
+}
+
 // ========== internal vector math functions ==========
 
 // ---------- define vector math functions with 1 REAL4 vector input to 1 INT4 vector output (S2I) ----------
@@ -252,6 +301,7 @@ DEFINE_VECTORMATH_DD2D(Add, local_add)
 DEFINE_VECTORMATH_DD2D(Sub, local_sub)
 DEFINE_VECTORMATH_DD2D(Multiply, local_mul)
 DEFINE_VECTORMATH_DD2D(Max, fmax)
+DEFINE_VECTORMATH_DD2D(Atan2, atan2)
 
 // ---------- define vector math functions with 2 COMPLEX8 vector inputs to 1 COMPLEX8 vector output (CC2C) ----------
 #define DEFINE_VECTORMATH_CC2C(NAME, GEN_OP)                            \
@@ -272,3 +322,26 @@ DEFINE_VECTORMATH_cC2C(Shift, local_caddf)
   DEFINE_VECTORMATH_ANY( XLALVectorMath_D2D_GEN, NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, GEN_OP ) )
 
 DEFINE_VECTORMATH_D2D(Round, round)
+DEFINE_VECTORMATH_D2D(Sin, sin)
+DEFINE_VECTORMATH_D2D(Cos, cos)
+DEFINE_VECTORMATH_D2D(Exp, exp)
+DEFINE_VECTORMATH_D2D(Log, log)
+
+// ---------- define vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+#define DEFINE_VECTORMATH_D2DD(NAME, GEN_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_D2DD_GEN, NAME ## REAL8, ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len ), ( (out1 != NULL) && (out2 != NULL) && (in != NULL) ), ( out1, out2, in, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_D2DD(SinCos, local_sincos)
+DEFINE_VECTORMATH_D2DD(SinCos2Pi, local_sincos_2pi)
+
+// ---------- define vector math functions with 1 COMPLEX16 vector input to 1 COMPLEX16 vector output (Z2Z) ----------
+#define DEFINE_VECTORMATH_Z2Z(NAME, GEN_OP)                             \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_Z2Z_GEN, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_Z2Z(Exp, cexp)
+
+// ---------- define vector math functions with 2 REAL8 vector inputs to 1 COMPLEX16 vector output (DD2Z) ----------
+#define DEFINE_VECTORMATH_DD2Z(NAME, GEN_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_DD2Z_GEN, NAME ## COMPLEX16, ( COMPLEX16 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_DD2Z(Polar, local_polar)
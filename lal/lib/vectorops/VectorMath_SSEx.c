@@ -36,6 +36,29 @@
 
 #include "VectorMath_sse_mathfun.h"
 
+// ---------- primitive operations for double-precision math functions ----------
+#define PD_T                    __m128d
+#define PD_SET1(x)              _mm_set1_pd ( x )
+#define PD_ADD(a,b)             _mm_add_pd ( a, b )
+#define PD_SUB(a,b)             _mm_sub_pd ( a, b )
+#define PD_MUL(a,b)             _mm_mul_pd ( a, b )
+#define PD_DIV(a,b)             _mm_div_pd ( a, b )
+#define PD_MIN(a,b)             _mm_min_pd ( a, b )
+#define PD_MAX(a,b)             _mm_max_pd ( a, b )
+#define PD_AND(a,b)             _mm_and_pd ( a, b )
+#define PD_ANDNOT(a,b)          _mm_andnot_pd ( a, b )
+#define PD_OR(a,b)              _mm_or_pd ( a, b )
+#define PD_XOR(a,b)             _mm_xor_pd ( a, b )
+#define PD_CMPEQ(a,b)           _mm_cmpeq_pd ( a, b )
+#define PD_CMPLT(a,b)           _mm_cmplt_pd ( a, b )
+#define PD_CMPLE(a,b)           _mm_cmple_pd ( a, b )
+#define PD_CMPGT(a,b)           _mm_cmpgt_pd ( a, b )
+#define PD_CMPUNORD(a,b)        _mm_cmpunord_pd ( a, b )
+#define PD_SLLI64(a,n)          _mm_castsi128_pd ( _mm_slli_epi64 ( _mm_castpd_si128 ( a ), n ) )
+#define PD_SRLI64(a,n)          _mm_castsi128_pd ( _mm_srli_epi64 ( _mm_castpd_si128 ( a ), n ) )
+
+#include "VectorMath_pd_mathfun.h"
+
 // ---------- local operators and operator-wrappers ----------
 UNUSED static inline __m128i
 local_cast_to_INT4 ( __m128 in1 )
@@ -401,6 +424,132 @@ XLALVectorMath_cC2C_SSEx ( COMPLEX8 *out, COMPLEX8 scalar, const COMPLEX8 *in, c
 
 } // XLALVectorMath_cC2C_SSEx()
 
+// ---------- generic SSEx operator with 1 REAL8 vector input to 1 REAL8 vector output (D2D) ----------
+static inline int
+XLALVectorMath_D2D_SSEx ( REAL8 *out, const REAL8 *in, const UINT4 len, __m128d (*f)(__m128d) )
+{
+
+  // walk through vector in blocks of 2
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      __m128d in2p = _mm_loadu_pd(&in[i2]);
+      __m128d out2p = (*f)( in2p );
+      _mm_storeu_pd(&out[i2], out2p);
+    }
+
+  // deal with the remaining (<=1) terms separately
+  V2SF in2 = {.f={0,0}}, out2;
+  for ( UINT4 i = i2Max,j=0; i < len; i ++, j++ ) {
+    in2.f[j] = in[i];
+  }
+  out2.v = (*f)( in2.v );
+  for ( UINT4 i = i2Max,j=0; i < len; i ++, j++ ) {
+    out[i] = out2.f[j];
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_D2D_SSEx()
+
+// ---------- generic SSEx operator with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+static inline int
+XLALVectorMath_D2DD_SSEx ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len, void (*f)(__m128d, __m128d*, __m128d*) )
+{
+
+  // walk through vector in blocks of 2
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      __m128d in2p = _mm_loadu_pd(&in[i2]);
+      __m128d out2p_1, out2p_2;
+      (*f) ( in2p, &out2p_1, &out2p_2 );
+      _mm_storeu_pd(&out1[i2], out2p_1);
+      _mm_storeu_pd(&out2[i2], out2p_2);
+    }
+
+  // deal with the remaining (<=1) terms separately
+  V2SF in2 = {.f={0,0}}, out2_1, out2_2;
+  for ( UINT4 i = i2Max,j=0; i < len; i ++, j++ ) {
+    in2.f[j] = in[i];
+  }
+  (*f) ( in2.v, &out2_1.v, &out2_2.v );
+  for ( UINT4 i = i2Max,j=0; i < len; i ++, j++ ) {
+    out1[i] = out2_1.f[j];
+    out2[i] = out2_2.f[j];
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_D2DD_SSEx()
+
+// ---------- generic SSEx operator with 1 COMPLEX16 vector input to 1 COMPLEX16 vector output (Z2Z) ----------
+static inline int
+XLALVectorMath_Z2Z_SSEx ( COMPLEX16 *out, const COMPLEX16 *in, const UINT4 len, void (*f)(__m128d, __m128d, __m128d*, __m128d*) )
+{
+
+  // walk through vector in blocks of 2
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      // de-interleave real and imaginary parts: (re0,im0), (re1,im1) -> (re0,re1), (im0,im1)
+      __m128d in2p_1 = _mm_loadu_pd( (const REAL8*)&in[i2] );
+      __m128d in2p_2 = _mm_loadu_pd( (const REAL8*)&in[i2+1] );
+      __m128d in2p_re = _mm_unpacklo_pd(in2p_1, in2p_2);
+      __m128d in2p_im = _mm_unpackhi_pd(in2p_1, in2p_2);
+      __m128d out2p_re, out2p_im;
+      (*f) ( in2p_re, in2p_im, &out2p_re, &out2p_im );
+      _mm_storeu_pd( (REAL8*)&out[i2], _mm_unpacklo_pd(out2p_re, out2p_im) );
+      _mm_storeu_pd( (REAL8*)&out[i2+1], _mm_unpackhi_pd(out2p_re, out2p_im) );
+    }
+
+  // deal with the remaining (<=1) terms separately
+  V2SF in2_re = {.f={0,0}}, in2_im = {.f={0,0}}, out2_re, out2_im;
+  for ( UINT4 i = i2Max,j=0; i < len; i ++, j++ ) {
+    in2_re.f[j] = creal ( in[i] );
+    in2_im.f[j] = cimag ( in[i] );
+  }
+  (*f) ( in2_re.v, in2_im.v, &out2_re.v, &out2_im.v );
+  for ( UINT4 i = i2Max,j=0; i < len; i ++, j++ ) {
+    out[i] = crect( out2_re.f[j], out2_im.f[j] );
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_Z2Z_SSEx()
+
+// ---------- generic SSEx operator with 2 REAL8 vector inputs to 1 COMPLEX16 vector output (DD2Z) ----------
+static inline int
+XLALVectorMath_DD2Z_SSEx ( COMPLEX16 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len, void (*f)(__m128d, __m128d, __m128d*, __m128d*) )
+{
+
+  // walk through vector in blocks of 2
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      __m128d in2p_1 = _mm_loadu_pd(&in1[i2]);
+      __m128d in2p_2 = _mm_loadu_pd(&in2[i2]);
+      __m128d out2p_re, out2p_im;
+      (*f) ( in2p_1, in2p_2, &out2p_re, &out2p_im );
+      _mm_storeu_pd( (REAL8*)&out[i2], _mm_unpacklo_pd(out2p_re, out2p_im) );
+      _mm_storeu_pd( (REAL8*)&out[i2+1], _mm_unpackhi_pd(out2p_re, out2p_im) );
+    }
+
+  // deal with the remaining (<=1) terms separately
+  V2SF in2_1 = {.f={0,0}}, in2_2 = {.f={0,0}}, out2_re, out2_im;
+  for ( UINT4 i = i2Max,j=0; i < len; i ++, j++ ) {
+    in2_1.f[j] = in1[i];
+    in2_2.f[j] = in2[i];
+  }
+  (*f) ( in2_1.v, in2_2.v, &out2_re.v, &out2_im.v );
+  for ( UINT4 i = i2Max,j=0; i < len; i ++, j++ ) {
+    out[i] = crect( out2_re.f[j], out2_im.f[j] );
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_DD2Z_SSEx()
+
 // ========== internal SSEx vector math functions ==========
 
 // ---------- define vector math functions with 1 REAL4 vector input to 1 INT4 vector output (S2I) ----------
@@ -455,6 +604,7 @@ DEFINE_VECTORMATH_dD2D(Shift, local_add_pd)
 DEFINE_VECTORMATH_DD2D(Add, local_add_pd)
 DEFINE_VECTORMATH_DD2D(Sub, local_sub_pd)
 DEFINE_VECTORMATH_DD2D(Multiply, local_mul_pd)
+DEFINE_VECTORMATH_DD2D(Atan2, atan2_pd)
 
 // ---------- define vector math functions with 2 COMPLEX8 vector inputs to 1 COMPLEX8 vector output (CC2C) ----------
 #define DEFINE_VECTORMATH_CC2C(NAME, SSE_OP)                            \
@@ -469,3 +619,31 @@ DEFINE_VECTORMATH_CC2C(Add, local_add_ps)
 
 DEFINE_VECTORMATH_cC2C(Scale, local_cmul_ps)
 DEFINE_VECTORMATH_cC2C(Shift, local_add_ps)
+
+// ---------- define vector math functions with 1 REAL8 vector input to 1 REAL8 vector output (D2D) ----------
+#define DEFINE_VECTORMATH_D2D(NAME, SSE_OP)                             \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_D2D_SSEx, NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_D2D(Sin, sin_pd)
+DEFINE_VECTORMATH_D2D(Cos, cos_pd)
+DEFINE_VECTORMATH_D2D(Exp, exp_pd)
+DEFINE_VECTORMATH_D2D(Log, log_pd)
+
+// ---------- define vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+#define DEFINE_VECTORMATH_D2DD(NAME, SSE_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_D2DD_SSEx, NAME ## REAL8, ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len ), ( (out1 != NULL) && (out2 != NULL) && (in != NULL) ), ( out1, out2, in, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_D2DD(SinCos, sincos_pd)
+DEFINE_VECTORMATH_D2DD(SinCos2Pi, sincos_pd_2pi)
+
+// ---------- define vector math functions with 1 COMPLEX16 vector input to 1 COMPLEX16 vector output (Z2Z) ----------
+#define DEFINE_VECTORMATH_Z2Z(NAME, SSE_OP)                             \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_Z2Z_SSEx, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_Z2Z(Exp, cexp_pd)
+
+// ---------- define vector math functions with 2 REAL8 vector inputs to 1 COMPLEX16 vector output (DD2Z) ----------
+#define DEFINE_VECTORMATH_DD2Z(NAME, SSE_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_DD2Z_SSEx, NAME ## COMPLEX16, ( COMPLEX16 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_DD2Z(Polar, polar_pd)
@@ -116,6 +116,7 @@ DECLARE_VECTORMATH_DD2D(Add, AVX2, AVX, SSE2, NONE)
 DECLARE_VECTORMATH_DD2D(Sub, AVX2, AVX, SSE2, NONE)
 DECLARE_VECTORMATH_DD2D(Multiply, AVX2, AVX, SSE2, NONE)
 DECLARE_VECTORMATH_DD2D(Max, AVX2, AVX, NONE, NONE)
+DECLARE_VECTORMATH_DD2D(Atan2, AVX512F, AVX2, AVX, SSE2)
 
 /* declare internal prototypes of SIMD-specific vector math functions with 2 COMPLEX8 vector inputs to 1 COMPLEX8 vector output (CC2C) */
 #define DECLARE_VECTORMATH_CC2C(NAME, ...)                                   \
@@ -136,3 +137,26 @@ DECLARE_VECTORMATH_cC2C(Shift, AVX2, AVX, SSE2, NONE)
   DECLARE_VECTORMATH_ANY( NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), __VA_ARGS__ )
 
 DECLARE_VECTORMATH_D2D(Round, AVX2, AVX, NONE, NONE)
+DECLARE_VECTORMATH_D2D(Sin, AVX512F, AVX2, AVX, SSE2)
+DECLARE_VECTORMATH_D2D(Cos, AVX512F, AVX2, AVX, SSE2)
+DECLARE_VECTORMATH_D2D(Exp, AVX512F, AVX2, AVX, SSE2)
+DECLARE_VECTORMATH_D2D(Log, AVX512F, AVX2, AVX, SSE2)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) */
+#define DECLARE_VECTORMATH_D2DD(NAME, ...)                                   \
+  DECLARE_VECTORMATH_ANY( NAME ## REAL8, ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_D2DD(SinCos, AVX512F, AVX2, AVX, SSE2)
+DECLARE_VECTORMATH_D2DD(SinCos2Pi, AVX512F, AVX2, AVX, SSE2)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 1 COMPLEX16 vector input to 1 COMPLEX16 vector output (Z2Z) */
+#define DECLARE_VECTORMATH_Z2Z(NAME, ...)                                    \
+  DECLARE_VECTORMATH_ANY( NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_Z2Z(Exp, AVX512F, AVX2, AVX, SSE2)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 2 REAL8 vector inputs to 1 COMPLEX16 vector output (DD2Z) */
+#define DECLARE_VECTORMATH_DD2Z(NAME, ...)                                   \
+  DECLARE_VECTORMATH_ANY( NAME ## COMPLEX16, ( COMPLEX16 *out, const REAL8 *in1, const REAL8 *in2, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_DD2Z(Polar, AVX512F, AVX2, AVX, SSE2)
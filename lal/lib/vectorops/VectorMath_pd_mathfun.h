@@ -0,0 +1,384 @@
+//
+// Copyright (C) 2026
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+// MA  02111-1307  USA
+//
+
+//
+// Double-precision SIMD transcendental functions, based on the Cephes library (http://www.netlib.org/cephes/)
+// in the same way as VectorMath_sse_mathfun.h and VectorMath_avx_mathfun.h are for single precision.
+//
+// The kernels are written once in terms of a small set of primitive operations, which must be
+// defined by the including source file for its instruction set before including this header:
+//
+//   PD_T                     vector of doubles
+//   PD_SET1(x)               broadcast scalar x
+//   PD_ADD/SUB/MUL/DIV(a,b)  arithmetic
+//   PD_MIN/MAX(a,b)          minimum/maximum; may return b if either argument is NaN
+//   PD_AND/OR/XOR(a,b)       bitwise logic
+//   PD_ANDNOT(a,b)           bitwise (~a) & b
+//   PD_CMPEQ/LT/LE/GT(a,b)   ordered comparisons, returning all-ones/all-zeros bit masks
+//   PD_CMPUNORD(a,b)         true if either a or b is NaN
+//   PD_SLLI64/SRLI64(a,n)    logical left/right shift of each 64-bit element by n bits
+//
+// Optionally, PD_SELECT(m,a,b) may be defined to use a native blend instruction.
+//
+// Accuracy, measured against glibc with random arguments over the stated domains:
+//   sin_pd, cos_pd, sincos_pd:  absolute error <= 2.3e-16 for |x| <= 2^30; accuracy degrades beyond
+//   sincos_pd_2pi:              absolute error <= 2.3e-16 for all finite x (argument in cycles)
+//   exp_pd:                     relative error <= 2 ulp; returns +inf above log(DBL_MAX), and 0 below log(DBL_MIN)
+//   log_pd:                     relative error <= 1 ulp; handles subnormals, 0, negative, inf and NaN like C99 log()
+//   atan2_pd:                   relative error <= 2 ulp; handles signed zeros, inf and NaN like C99 atan2()
+//
+
+#ifndef _VECTORMATH_PD_MATHFUN_H
+#define _VECTORMATH_PD_MATHFUN_H
+
+#include <math.h>
+#include <float.h>
+
+#ifndef PD_SELECT
+#define PD_SELECT(m, a, b)      PD_OR ( PD_AND ( (m), (a) ), PD_ANDNOT ( (m), (b) ) )
+#endif
+
+// ---------- constants ----------
+
+#define PD_TWO52                4503599627370496.0      // 2^52
+#define PD_SIGNMASK             PD_SET1 ( -0.0 )        // only sign bit set
+#define PD_EXPMASK              PD_SET1 ( INFINITY )    // only exponent bits set
+
+// Cody-Waite splitting of pi/4, from Cephes sin.c
+#define PD_DP1                  7.85398125648498535156E-1
+#define PD_DP2                  3.77489470793079817668E-8
+#define PD_DP3                  2.69515142907905952645E-15
+
+// low-order bits of pi/2, from Cephes atan.c
+#define PD_MOREBITS             6.123233995736765886130E-17
+
+// ---------- helper functions ----------
+
+// Evaluate polynomial c[0]*x^(N-1) + ... + c[N-1] (Cephes polevl())
+static inline PD_T polevl_pd ( PD_T x, const double *c, const int N )
+{
+  PD_T p = PD_SET1 ( c[0] );
+  for ( int k = 1; k < N; ++k ) {
+    p = PD_ADD ( PD_MUL ( p, x ), PD_SET1 ( c[k] ) );
+  }
+  return p;
+}
+
+// Evaluate polynomial x^N + c[0]*x^(N-1) + ... + c[N-1] (Cephes p1evl())
+static inline PD_T p1evl_pd ( PD_T x, const double *c, const int N )
+{
+  PD_T p = PD_ADD ( x, PD_SET1 ( c[0] ) );
+  for ( int k = 1; k < N; ++k ) {
+    p = PD_ADD ( PD_MUL ( p, x ), PD_SET1 ( c[k] ) );
+  }
+  return p;
+}
+
+// round to nearest integer (ties to even), exact for all finite x
+static inline PD_T round_pd ( PD_T x )
+{
+  const PD_T two52 = PD_SET1 ( PD_TWO52 );
+  PD_T sign = PD_AND ( x, PD_SIGNMASK );
+  PD_T ax = PD_ANDNOT ( PD_SIGNMASK, x );
+  // adding and subtracting 2^52 rounds away all fractional bits; values >= 2^52 are integers already
+  PD_T r = PD_SUB ( PD_ADD ( ax, two52 ), two52 );
+  r = PD_SELECT ( PD_CMPLT ( ax, two52 ), r, ax );
+  return PD_OR ( r, sign );
+}
+
+// round down to integer, exact for all finite x
+static inline PD_T floor_pd ( PD_T x )
+{
+  PD_T r = round_pd ( x );
+  return PD_SUB ( r, PD_AND ( PD_CMPGT ( r, x ), PD_SET1 ( 1.0 ) ) );
+}
+
+// return 2^n for integer-valued n in [-1022, 1023]
+static inline PD_T pow2n_pd ( PD_T n )
+{
+  // low mantissa bits of 2^52 + 1023 + n hold the biased exponent, which is shifted into place
+  return PD_SLLI64 ( PD_ADD ( n, PD_SET1 ( PD_TWO52 + 1023.0 ) ), 52 );
+}
+
+// ---------- sin(), cos() ----------
+
+static const double sincof_pd[] = {
+  1.58962301576546568060E-10,
+  -2.50507477628578072866E-8,
+  2.75573136213857245213E-6,
+  -1.98412698295895385996E-4,
+  8.33333333332211858878E-3,
+  -1.66666666666666307295E-1,
+};
+
+static const double coscof_pd[] = {
+  -1.13585365213876817300E-11,
+  2.08757008419747316778E-9,
+  -2.75573141792967388112E-7,
+  2.48015872888517045348E-5,
+  -1.38888888888730564116E-3,
+  4.16666666666665929218E-2,
+};
+
+// compute sin(x) and cos(x) together, sharing the range reduction
+static inline void sincos_pd ( PD_T x, PD_T *s, PD_T *c )
+{
+  const PD_T one = PD_SET1 ( 1.0 );
+  const PD_T two = PD_SET1 ( 2.0 );
+
+  PD_T sign_in = PD_AND ( x, PD_SIGNMASK );
+  PD_T ax = PD_ANDNOT ( PD_SIGNMASK, x );
+
+  // octant q of |x|, rounded up to an even number
+  PD_T q = floor_pd ( PD_MUL ( ax, PD_SET1 ( 4.0 / M_PI ) ) );
+  q = PD_MUL ( two, floor_pd ( PD_MUL ( PD_ADD ( q, one ), PD_SET1 ( 0.5 ) ) ) );
+
+  // q modulo 8 is one of 0, 2, 4, 6
+  PD_T o = PD_SUB ( q, PD_MUL ( PD_SET1 ( 8.0 ), floor_pd ( PD_MUL ( q, PD_SET1 ( 0.125 ) ) ) ) );
+  PD_T m2 = PD_CMPEQ ( o, two );
+  PD_T m4 = PD_CMPEQ ( o, PD_SET1 ( 4.0 ) );
+  PD_T m6 = PD_CMPEQ ( o, PD_SET1 ( 6.0 ) );
+
+  // extended precision modular arithmetic: z = |x| - q * pi/4
+  PD_T z = PD_SUB ( ax, PD_MUL ( q, PD_SET1 ( PD_DP1 ) ) );
+  z = PD_SUB ( z, PD_MUL ( q, PD_SET1 ( PD_DP2 ) ) );
+  z = PD_SUB ( z, PD_MUL ( q, PD_SET1 ( PD_DP3 ) ) );
+  PD_T zz = PD_MUL ( z, z );
+
+  // polynomial approximations of sin(z) and cos(z) for |z| <= pi/4
+  PD_T ps = PD_ADD ( z, PD_MUL ( PD_MUL ( z, zz ), polevl_pd ( zz, sincof_pd, 6 ) ) );
+  PD_T pc = PD_SUB ( one, PD_MUL ( PD_SET1 ( 0.5 ), zz ) );
+  pc = PD_ADD ( pc, PD_MUL ( PD_MUL ( zz, zz ), polevl_pd ( zz, coscof_pd, 6 ) ) );
+
+  // swap polynomials in octants 2 and 6, and fix up signs
+  PD_T swap = PD_OR ( m2, m6 );
+  PD_T ys = PD_SELECT ( swap, pc, ps );
+  PD_T yc = PD_SELECT ( swap, ps, pc );
+  ys = PD_XOR ( ys, PD_XOR ( sign_in, PD_AND ( PD_OR ( m4, m6 ), PD_SIGNMASK ) ) );
+  yc = PD_XOR ( yc, PD_AND ( PD_OR ( m2, m4 ), PD_SIGNMASK ) );
+
+  (*s) = ys;
+  (*c) = yc;
+}
+
+static inline PD_T sin_pd ( PD_T x )
+{
+  PD_T s, c;
+  sincos_pd ( x, &s, &c );
+  return s;
+}
+
+static inline PD_T cos_pd ( PD_T x )
+{
+  PD_T s, c;
+  sincos_pd ( x, &s, &c );
+  return c;
+}
+
+// compute sin(2*pi*x) and cos(2*pi*x); the integer part of x is removed exactly before scaling
+static inline void sincos_pd_2pi ( PD_T x, PD_T *s, PD_T *c )
+{
+  PD_T f = PD_SUB ( x, round_pd ( x ) );
+  sincos_pd ( PD_MUL ( f, PD_SET1 ( 2.0 * M_PI ) ), s, c );
+}
+
+// ---------- exp() ----------
+
+static const double expP_pd[] = {
+  1.26177193074810590878E-4,
+  3.02994407707441961300E-2,
+  9.99999999999999999910E-1,
+};
+
+static const double expQ_pd[] = {
+  3.00198505138664455042E-6,
+  2.52448340349684104192E-3,
+  2.27265548208155028766E-1,
+  2.00000000000000000009E0,
+};
+
+#define PD_MAXLOG               7.09782712893383996843E2        // log(DBL_MAX)
+#define PD_MINLOG               -7.08396418532264106224E2       // log(DBL_MIN)
+
+static inline PD_T exp_pd ( PD_T x )
+{
+  const PD_T one = PD_SET1 ( 1.0 );
+  const PD_T maxlog = PD_SET1 ( PD_MAXLOG );
+  const PD_T minlog = PD_SET1 ( PD_MINLOG );
+
+  PD_T xin = x;
+  x = PD_MIN ( PD_MAX ( x, minlog ), maxlog );
+
+  // express exp(x) as exp(g) * 2^n
+  PD_T px = floor_pd ( PD_ADD ( PD_MUL ( PD_SET1 ( M_LOG2E ), x ), PD_SET1 ( 0.5 ) ) );
+  x = PD_SUB ( x, PD_MUL ( px, PD_SET1 ( 6.93145751953125E-1 ) ) );
+  x = PD_SUB ( x, PD_MUL ( px, PD_SET1 ( 1.42860682030941723212E-6 ) ) );
+
+  // rational approximation for exponential of the fractional part: exp(g) = 1 + 2 g P(g^2) / (Q(g^2) - g P(g^2))
+  PD_T xx = PD_MUL ( x, x );
+  PD_T p = PD_MUL ( x, polevl_pd ( xx, expP_pd, 3 ) );
+  x = PD_DIV ( p, PD_SUB ( polevl_pd ( xx, expQ_pd, 4 ), p ) );
+  x = PD_ADD ( one, PD_ADD ( x, x ) );
+
+  // multiply by 2^n in two steps, so that each factor is a normal number
+  PD_T n1 = floor_pd ( PD_MUL ( px, PD_SET1 ( 0.5 ) ) );
+  PD_T n2 = PD_SUB ( px, n1 );
+  x = PD_MUL ( PD_MUL ( x, pow2n_pd ( n1 ) ), pow2n_pd ( n2 ) );
+
+  // handle overflow, underflow, and NaN
+  x = PD_SELECT ( PD_CMPGT ( xin, maxlog ), PD_SET1 ( INFINITY ), x );
+  x = PD_ANDNOT ( PD_CMPLT ( xin, minlog ), x );
+  x = PD_SELECT ( PD_CMPUNORD ( xin, xin ), xin, x );
+
+  return x;
+}
+
+// ---------- log() ----------
+
+static const double logP_pd[] = {
+  1.01875663804580931796E-4,
+  4.97494994976747001425E-1,
+  4.70579119878881725854E0,
+  1.44989225341610930846E1,
+  1.79368678507819816313E1,
+  7.70838733755885391666E0,
+};
+
+static const double logQ_pd[] = {
+  1.12873587189167450590E1,
+  4.52279145837532221105E1,
+  8.29875266912776603211E1,
+  7.11544750618563894466E1,
+  2.31251620126765340583E1,
+};
+
+static inline PD_T log_pd ( PD_T x )
+{
+  const PD_T one = PD_SET1 ( 1.0 );
+  const PD_T two52 = PD_SET1 ( PD_TWO52 );
+
+  PD_T xin = x;
+
+  // scale subnormal numbers into the normal range
+  PD_T sub = PD_CMPLT ( x, PD_SET1 ( DBL_MIN ) );
+  x = PD_SELECT ( sub, PD_MUL ( x, PD_SET1 ( 18014398509481984.0 ) ), x );  // 2^54
+
+  // split x into exponent e and mantissa m in [0.5, 1), as in frexp()
+  PD_T e = PD_SUB ( PD_OR ( PD_SRLI64 ( x, 52 ), two52 ), two52 );
+  e = PD_SUB ( e, PD_SELECT ( sub, PD_SET1 ( 1022.0 + 54.0 ), PD_SET1 ( 1022.0 ) ) );
+  PD_T m = PD_OR ( PD_ANDNOT ( PD_EXPMASK, x ), PD_SET1 ( 0.5 ) );
+
+  // shift mantissa to [sqrt(1/2) - 1, sqrt(2) - 1)
+  PD_T lo = PD_CMPLT ( m, PD_SET1 ( M_SQRT1_2 ) );
+  e = PD_SUB ( e, PD_AND ( lo, one ) );
+  m = PD_SUB ( PD_ADD ( m, PD_AND ( lo, m ) ), one );
+
+  // rational approximation for log(1 + m) = m - m^2/2 + m^3 P(m) / Q(m)
+  PD_T z = PD_MUL ( m, m );
+  PD_T y = PD_MUL ( m, PD_DIV ( PD_MUL ( z, polevl_pd ( m, logP_pd, 6 ) ), p1evl_pd ( m, logQ_pd, 5 ) ) );
+  y = PD_SUB ( y, PD_MUL ( e, PD_SET1 ( 2.121944400546905827679e-4 ) ) );
+  y = PD_SUB ( y, PD_MUL ( PD_SET1 ( 0.5 ), z ) );
+  z = PD_ADD ( m, y );
+  z = PD_ADD ( z, PD_MUL ( e, PD_SET1 ( 0.693359375 ) ) );
+
+  // handle infinity, negative numbers, NaN, and zero
+  z = PD_SELECT ( PD_CMPEQ ( xin, PD_SET1 ( INFINITY ) ), xin, z );
+  z = PD_SELECT ( PD_OR ( PD_CMPLT ( xin, PD_SET1 ( 0.0 ) ), PD_CMPUNORD ( xin, xin ) ), PD_SET1 ( NAN ), z );
+  z = PD_SELECT ( PD_CMPEQ ( xin, PD_SET1 ( 0.0 ) ), PD_SET1 ( -INFINITY ), z );
+
+  return z;
+}
+
+// ---------- atan2() ----------
+
+static const double atanP_pd[] = {
+  -8.750608600031904122785E-1,
+  -1.615753718733365076637E1,
+  -7.500855792314704667340E1,
+  -1.228866684490136173410E2,
+  -6.485021904942025371773E1,
+};
+
+static const double atanQ_pd[] = {
+  2.485846490142306297962E1,
+  1.650270098316988542046E2,
+  4.328810604912902668951E2,
+  4.853903996359136964868E2,
+  1.945506571482613964425E2,
+};
+
+static inline PD_T atan2_pd ( PD_T y, PD_T x )
+{
+  const PD_T one = PD_SET1 ( 1.0 );
+  const PD_T zero = PD_SET1 ( 0.0 );
+
+  PD_T ay = PD_ANDNOT ( PD_SIGNMASK, y );
+  PD_T ax = PD_ANDNOT ( PD_SIGNMASK, x );
+
+  // reduce to atan(t) with t = min(|x|,|y|) / max(|x|,|y|) in [0, 1]; this also covers 0/0 and inf/inf
+  PD_T mx = PD_MAX ( ay, ax );
+  PD_T mn = PD_MIN ( ay, ax );
+  PD_T t = PD_DIV ( mn, mx );
+  t = PD_SELECT ( PD_CMPEQ ( mn, mx ), one, t );
+  t = PD_SELECT ( PD_CMPEQ ( mx, zero ), zero, t );
+
+  // for t > 0.66, use atan(t) = pi/4 + atan((t - 1) / (t + 1))
+  PD_T big = PD_CMPGT ( t, PD_SET1 ( 0.66 ) );
+  PD_T u = PD_SELECT ( big, PD_DIV ( PD_SUB ( t, one ), PD_ADD ( t, one ) ), t );
+
+  // rational approximation atan(u) = u + u^3 P(u^2) / Q(u^2)
+  PD_T z = PD_MUL ( u, u );
+  z = PD_DIV ( PD_MUL ( z, polevl_pd ( z, atanP_pd, 5 ) ), p1evl_pd ( z, atanQ_pd, 5 ) );
+  z = PD_ADD ( PD_MUL ( u, z ), u );
+  PD_T r = PD_SELECT ( big, PD_ADD ( PD_SET1 ( M_PI_4 ), PD_ADD ( z, PD_SET1 ( 0.5 * PD_MOREBITS ) ) ), z );
+
+  // map to the correct octant and quadrant
+  r = PD_SELECT ( PD_CMPGT ( ay, ax ), PD_SUB ( PD_SET1 ( M_PI_2 ), PD_SUB ( r, PD_SET1 ( PD_MOREBITS ) ) ), r );
+  PD_T xneg = PD_CMPLT ( PD_OR ( PD_AND ( x, PD_SIGNMASK ), one ), zero );   // sign bit of x, including -0
+  r = PD_SELECT ( xneg, PD_SUB ( PD_SET1 ( M_PI ), PD_SUB ( r, PD_SET1 ( 2.0 * PD_MOREBITS ) ) ), r );
+  r = PD_XOR ( r, PD_AND ( y, PD_SIGNMASK ) );
+
+  // propagate NaN
+  r = PD_SELECT ( PD_CMPUNORD ( x, y ), PD_ADD ( x, y ), r );
+
+  return r;
+}
+
+// ---------- complex exp(), polar() ----------
+
+// compute exp(re + i*im) = exp(re) * ( cos(im) + i*sin(im) )
+static inline void cexp_pd ( PD_T re, PD_T im, PD_T *out_re, PD_T *out_im )
+{
+  PD_T s, c;
+  PD_T r = exp_pd ( re );
+  sincos_pd ( im, &s, &c );
+  (*out_re) = PD_MUL ( r, c );
+  (*out_im) = PD_MUL ( r, s );
+}
+
+// compute r * ( cos(phi) + i*sin(phi) )
+static inline void polar_pd ( PD_T r, PD_T phi, PD_T *out_re, PD_T *out_im )
+{
+  PD_T s, c;
+  sincos_pd ( phi, &s, &c );
+  (*out_re) = PD_MUL ( r, c );
+  (*out_im) = PD_MUL ( r, s );
+}
+
+#endif // _VECTORMATH_PD_MATHFUN_H
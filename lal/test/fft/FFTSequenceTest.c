@@ -0,0 +1,288 @@
+// Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with with program; see the file COPYING. If not, write to the
+//  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+//  MA  02111-1307  USA
+
+// Test batched FFTs of vector sequences against FFTs of the individual
+// vectors, and benchmark batched FFTs against the per-segment loops used
+// by the Welch and median-mean average spectrum estimators.
+
+#include <lal/LALConfig.h>
+
+#ifndef LAL_FFTW3_ENABLED
+int main(void) { return 77; /* don't do any testing */ }
+#else
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/SeqFactories.h>
+#include <lal/RealFFT.h>
+#include <lal/ComplexFFT.h>
+#include <lal/FFTWMutex.h>
+#include <lal/TimeFreqFFT.h>
+#include <lal/TimeSeries.h>
+#include <lal/FrequencySeries.h>
+#include <lal/Window.h>
+#include <lal/Units.h>
+#include <lal/LogPrintf.h>
+
+#define frand() (rand() / (RAND_MAX + 1.0))
+
+// ----- compare REAL4/REAL8 forward and reverse sequence FFTs with per-vector FFTs ----------
+#define DEFINE_TEST_REAL_SEQUENCE(R, C, TOL)                            \
+  static int test_##R##_sequence(UINT4 length, UINT4 n)                 \
+  {                                                                     \
+    R##VectorSequence *x = XLALCreate##R##VectorSequence(length, n);    \
+    R##VectorSequence *y = XLALCreate##R##VectorSequence(length, n);    \
+    C##VectorSequence *z = XLALCreate##C##VectorSequence(length, n / 2 + 1); \
+    R##Vector *xv = XLALCreate##R##Vector(n);                           \
+    C##Vector *zv = XLALCreate##C##Vector(n / 2 + 1);                   \
+    XLAL_CHECK(x && y && z && xv && zv, XLAL_EFUNC);                    \
+    for (UINT4 i = 0; i < length * n; ++i) {                            \
+      x->data[i] = frand() - 0.5;                                       \
+    }                                                                   \
+    R##FFTPlan *fwd = XLALCreateForward##R##FFTPlan(n, 0);              \
+    R##FFTPlan *rev = XLALCreateReverse##R##FFTPlan(n, 0);              \
+    XLAL_CHECK(fwd && rev, XLAL_EFUNC);                                 \
+    XLAL_CHECK(XLAL##R##ForwardFFTSequence(z, x, fwd) == XLAL_SUCCESS, XLAL_EFUNC); \
+    for (UINT4 j = 0; j < length; ++j) {                                \
+      memcpy(xv->data, x->data + j * n, n * sizeof(xv->data[0]));       \
+      XLAL_CHECK(XLAL##R##ForwardFFT(zv, xv, fwd) == XLAL_SUCCESS, XLAL_EFUNC); \
+      for (UINT4 k = 0; k < zv->length; ++k) {                          \
+        const REAL8 err = cabs(z->data[j * zv->length + k] - zv->data[k]); \
+        XLAL_CHECK(err <= (TOL) * n, XLAL_ETOL, "%s: vector %u, bin %u: error %g exceeds tolerance", #R "ForwardFFTSequence", j, k, err); \
+      }                                                                 \
+    }                                                                   \
+    XLAL_CHECK(XLAL##R##ReverseFFTSequence(y, z, rev) == XLAL_SUCCESS, XLAL_EFUNC); \
+    for (UINT4 i = 0; i < length * n; ++i) {                            \
+      const REAL8 err = fabs(y->data[i] / n - x->data[i]);              \
+      XLAL_CHECK(err <= (TOL) * n, XLAL_ETOL, "%s: element %u: error %g exceeds tolerance", #R "ReverseFFTSequence", i, err); \
+    }                                                                   \
+    XLAL_CHECK(XLAL##R##ForwardFFTSequence(z, x, rev) != XLAL_SUCCESS, XLAL_EFAILED, "Reverse plan accepted for forward transform"); \
+    XLALClearErrno();                                                   \
+    XLALDestroy##R##FFTPlan(fwd);                                       \
+    XLALDestroy##R##FFTPlan(rev);                                       \
+    XLALDestroy##R##VectorSequence(x);                                  \
+    XLALDestroy##R##VectorSequence(y);                                  \
+    XLALDestroy##C##VectorSequence(z);                                  \
+    XLALDestroy##R##Vector(xv);                                         \
+    XLALDestroy##C##Vector(zv);                                         \
+    return XLAL_SUCCESS;                                                \
+  }
+
+DEFINE_TEST_REAL_SEQUENCE(REAL4, COMPLEX8, 1e-6)
+DEFINE_TEST_REAL_SEQUENCE(REAL8, COMPLEX16, 1e-14)
+
+// ----- compare COMPLEX8/COMPLEX16 sequence FFTs with per-vector FFTs ----------
+#define DEFINE_TEST_COMPLEX_SEQUENCE(C, TOL)                            \
+  static int test_##C##_sequence(UINT4 length, UINT4 n, int fwdflg)     \
+  {                                                                     \
+    C##VectorSequence *x = XLALCreate##C##VectorSequence(length, n);    \
+    C##VectorSequence *z = XLALCreate##C##VectorSequence(length, n);    \
+    C##Vector *xv = XLALCreate##C##Vector(n);                           \
+    C##Vector *zv = XLALCreate##C##Vector(n);                           \
+    XLAL_CHECK(x && z && xv && zv, XLAL_EFUNC);                         \
+    for (UINT4 i = 0; i < length * n; ++i) {                            \
+      x->data[i] = (frand() - 0.5) + I * (frand() - 0.5);               \
+    }                                                                   \
+    C##FFTPlan *plan = XLALCreate##C##FFTPlan(n, fwdflg, 0);            \
+    XLAL_CHECK(plan, XLAL_EFUNC);                                       \
+    XLAL_CHECK(XLAL##C##VectorSequenceFFT(z, x, plan) == XLAL_SUCCESS, XLAL_EFUNC); \
+    for (UINT4 j = 0; j < length; ++j) {                                \
+      memcpy(xv->data, x->data + j * n, n * sizeof(xv->data[0]));       \
+      XLAL_CHECK(XLAL##C##VectorFFT(zv, xv, plan) == XLAL_SUCCESS, XLAL_EFUNC); \
+      for (UINT4 k = 0; k < n; ++k) {                                   \
+        const REAL8 err = cabs(z->data[j * n + k] - zv->data[k]);       \
+        XLAL_CHECK(err <= (TOL) * n, XLAL_ETOL, "%s: vector %u, bin %u: error %g exceeds tolerance", #C "VectorSequenceFFT", j, k, err); \
+      }                                                                 \
+    }                                                                   \
+    XLALDestroy##C##FFTPlan(plan);                                      \
+    XLALDestroy##C##VectorSequence(x);                                  \
+    XLALDestroy##C##VectorSequence(z);                                  \
+    XLALDestroy##C##Vector(xv);                                         \
+    XLALDestroy##C##Vector(zv);                                         \
+    return XLAL_SUCCESS;                                                \
+  }
+
+DEFINE_TEST_COMPLEX_SEQUENCE(COMPLEX8, 1e-6)
+DEFINE_TEST_COMPLEX_SEQUENCE(COMPLEX16, 1e-14)
+
+static int compare_REAL4(const void *a, const void *b)
+{
+  const REAL4 x = *(const REAL4 *)a;
+  const REAL4 y = *(const REAL4 *)b;
+  return (x > y) - (x < y);
+}
+
+// ----- compute the periodograms of all segments of a time series with one batched FFT ----------
+static int batched_periodograms(REAL4VectorSequence *pgram, REAL4VectorSequence *segs, COMPLEX8VectorSequence *fsegs,
+                                const REAL4TimeSeries *tseries, UINT4 seglen, UINT4 stride, const REAL4Window *window, const REAL4FFTPlan *plan)
+{
+  const REAL4 wnorm = sqrt(window->data->length / window->sumofsquares);
+  for (UINT4 j = 0; j < segs->length; ++j) {
+    const REAL4 *x = tseries->data->data + j * stride;
+    REAL4 *s = segs->data + j * seglen;
+    for (UINT4 i = 0; i < seglen; ++i) {
+      s[i] = x[i] * window->data->data[i] * wnorm;
+    }
+  }
+  XLAL_CHECK(XLALREAL4ForwardFFTSequence(fsegs, segs, plan) == XLAL_SUCCESS, XLAL_EFUNC);
+  const REAL4 normfac = tseries->deltaT / seglen;
+  const UINT4 nbins = fsegs->vectorLength;
+  for (UINT4 j = 0; j < fsegs->length; ++j) {
+    const COMPLEX8 *z = fsegs->data + j * nbins;
+    REAL4 *p = pgram->data + j * nbins;
+    for (UINT4 k = 0; k < nbins; ++k) {
+      const REAL4 fac = (k == 0 || (seglen % 2 == 0 && k == seglen / 2)) ? 1 : 2;
+      p[k] = fac * normfac * (crealf(z[k]) * crealf(z[k]) + cimagf(z[k]) * cimagf(z[k]));
+    }
+  }
+  return XLAL_SUCCESS;
+}
+
+// ----- benchmark batched FFTs against the Welch and median-mean estimators ----------
+static int benchmark_average_spectrum(UINT4 seglen, UINT4 numseg, UINT4 Nruns)
+{
+  const UINT4 stride = seglen / 2;
+  const UINT4 reclen = (numseg - 1) * stride + seglen;
+  const UINT4 nbins = seglen / 2 + 1;
+  LIGOTimeGPS epoch = LIGOTIMEGPSZERO;
+  REAL8 tic, toc, tloop, tbatch, maxRelerr;
+
+  REAL4TimeSeries *tseries = XLALCreateREAL4TimeSeries("x", &epoch, 0, 1.0 / 4096, &lalDimensionlessUnit, reclen);
+  XLAL_CHECK(tseries != NULL, XLAL_EFUNC);
+  for (UINT4 i = 0; i < reclen; ++i) {
+    tseries->data->data[i] = frand() - 0.5;
+  }
+  REAL4FrequencySeries *spectrum = XLALCreateREAL4FrequencySeries("S", &epoch, 0, 0, &lalDimensionlessUnit, nbins);
+  XLAL_CHECK(spectrum != NULL, XLAL_EFUNC);
+  REAL4Window *window = XLALCreateHannREAL4Window(seglen);
+  XLAL_CHECK(window != NULL, XLAL_EFUNC);
+  REAL4FFTPlan *plan = XLALCreateForwardREAL4FFTPlan(seglen, 0);
+  XLAL_CHECK(plan != NULL, XLAL_EFUNC);
+
+  REAL4VectorSequence *segs = XLALCreateREAL4VectorSequence(numseg, seglen);
+  COMPLEX8VectorSequence *fsegs = XLALCreateCOMPLEX8VectorSequence(numseg, nbins);
+  REAL4VectorSequence *pgram = XLALCreateREAL4VectorSequence(numseg, nbins);
+  REAL4Vector *ref = XLALCreateREAL4Vector(nbins);
+  REAL4Vector *bin = XLALCreateREAL4Vector(numseg);
+  XLAL_CHECK(segs && fsegs && pgram && ref && bin, XLAL_EFUNC);
+
+  // batched plan is created on first use
+  XLAL_CHECK(batched_periodograms(pgram, segs, fsegs, tseries, seglen, stride, window, plan) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  // ----- Welch -----
+  tic = XLALGetCPUTime();
+  for (UINT4 l = 0; l < Nruns; ++l) {
+    XLAL_CHECK(XLALREAL4AverageSpectrumWelch(spectrum, tseries, seglen, stride, window, plan) == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+  toc = XLALGetCPUTime();
+  tloop = (toc - tic) / Nruns;
+  memcpy(ref->data, spectrum->data->data, nbins * sizeof(ref->data[0]));
+  tic = XLALGetCPUTime();
+  for (UINT4 l = 0; l < Nruns; ++l) {
+    XLAL_CHECK(batched_periodograms(pgram, segs, fsegs, tseries, seglen, stride, window, plan) == XLAL_SUCCESS, XLAL_EFUNC);
+    for (UINT4 k = 0; k < nbins; ++k) {
+      REAL4 sum = 0;
+      for (UINT4 j = 0; j < numseg; ++j) {
+        sum += pgram->data[j * nbins + k];
+      }
+      spectrum->data->data[k] = sum / numseg;
+    }
+  }
+  toc = XLALGetCPUTime();
+  tbatch = (toc - tic) / Nruns;
+  maxRelerr = 0;
+  for (UINT4 k = 0; k < nbins; ++k) {
+    maxRelerr = fmax(maxRelerr, fabs(spectrum->data->data[k] - ref->data[k]) / ref->data[k]);
+  }
+  XLALPrintInfo("Welch  seglen=%-7u numseg=%-5u: per-segment loop %8.3g s, batched FFT %8.3g s, speedup %5.2f [maxRelerr = %7.2g]\n",
+                seglen, numseg, tloop, tbatch, tloop / tbatch, maxRelerr);
+  XLAL_CHECK(maxRelerr < 1e-4, XLAL_ETOL, "Welch spectra differ by %g", maxRelerr);
+
+  // ----- median-mean -----
+  tic = XLALGetCPUTime();
+  for (UINT4 l = 0; l < Nruns; ++l) {
+    XLAL_CHECK(XLALREAL4AverageSpectrumMedian(spectrum, tseries, seglen, stride, window, plan) == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+  toc = XLALGetCPUTime();
+  tloop = (toc - tic) / Nruns;
+  memcpy(ref->data, spectrum->data->data, nbins * sizeof(ref->data[0]));
+  const REAL4 normfac = 1.0 / XLALMedianBias(numseg);
+  tic = XLALGetCPUTime();
+  for (UINT4 l = 0; l < Nruns; ++l) {
+    XLAL_CHECK(batched_periodograms(pgram, segs, fsegs, tseries, seglen, stride, window, plan) == XLAL_SUCCESS, XLAL_EFUNC);
+    for (UINT4 k = 0; k < nbins; ++k) {
+      for (UINT4 j = 0; j < numseg; ++j) {
+        bin->data[j] = pgram->data[j * nbins + k];
+      }
+      qsort(bin->data, numseg, sizeof(bin->data[0]), compare_REAL4);
+      const REAL4 median = (numseg % 2) ? bin->data[numseg / 2] : 0.5 * (bin->data[numseg / 2 - 1] + bin->data[numseg / 2]);
+      spectrum->data->data[k] = median * normfac;
+    }
+  }
+  toc = XLALGetCPUTime();
+  tbatch = (toc - tic) / Nruns;
+  maxRelerr = 0;
+  for (UINT4 k = 0; k < nbins; ++k) {
+    maxRelerr = fmax(maxRelerr, fabs(spectrum->data->data[k] - ref->data[k]) / ref->data[k]);
+  }
+  XLALPrintInfo("Median seglen=%-7u numseg=%-5u: per-segment loop %8.3g s, batched FFT %8.3g s, speedup %5.2f [maxRelerr = %7.2g]\n",
+                seglen, numseg, tloop, tbatch, tloop / tbatch, maxRelerr);
+  XLAL_CHECK(maxRelerr < 1e-4, XLAL_ETOL, "Median spectra differ by %g", maxRelerr);
+
+  XLALDestroyREAL4TimeSeries(tseries);
+  XLALDestroyREAL4FrequencySeries(spectrum);
+  XLALDestroyREAL4Window(window);
+  XLALDestroyREAL4FFTPlan(plan);
+  XLALDestroyREAL4VectorSequence(segs);
+  XLALDestroyCOMPLEX8VectorSequence(fsegs);
+  XLALDestroyREAL4VectorSequence(pgram);
+  XLALDestroyREAL4Vector(ref);
+  XLALDestroyREAL4Vector(bin);
+
+  return XLAL_SUCCESS;
+}
+
+int main(void)
+{
+  srand(1);
+
+  const UINT4 sizes[] = { 1, 7, 64, 100, 1024 };
+  for (size_t i = 0; i < XLAL_NUM_ELEM(sizes); ++i) {
+    XLAL_CHECK_MAIN(test_REAL4_sequence(13, sizes[i]) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(test_REAL8_sequence(13, sizes[i]) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(test_COMPLEX8_sequence(13, sizes[i], 1) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(test_COMPLEX8_sequence(13, sizes[i], 0) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(test_COMPLEX16_sequence(13, sizes[i], 1) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(test_COMPLEX16_sequence(13, sizes[i], 0) == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+
+  XLAL_CHECK_MAIN(benchmark_average_spectrum(256, 511, 10) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(benchmark_average_spectrum(4096, 63, 10) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(benchmark_average_spectrum(65536, 15, 4) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  XLALFFTWClearPlanCache();
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
+
+#endif
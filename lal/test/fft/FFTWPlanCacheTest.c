@@ -0,0 +1,170 @@
+// Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with with program; see the file COPYING. If not, write to the
+//  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+//  MA  02111-1307  USA
+
+#include <lal/LALConfig.h>
+
+#ifndef LAL_FFTW3_ENABLED
+int main(void) { return 77; /* don't do any testing */ }
+#else
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/LALConstants.h>
+#include <lal/RealFFT.h>
+#include <lal/ComplexFFT.h>
+#include <lal/FFTWMutex.h>
+
+#define WISDOM_FNAME "FFTWPlanCacheTest.wisdom"
+
+// check that plans created and destroyed repeatedly, possibly sharing a cached FFTW plan, give identical results
+static int test_shared_plans(UINT4 n)
+{
+  REAL4Vector *x = XLALCreateREAL4Vector(n);
+  XLAL_CHECK(x != NULL, XLAL_EFUNC);
+  COMPLEX8Vector *y1 = XLALCreateCOMPLEX8Vector(n / 2 + 1);
+  COMPLEX8Vector *y2 = XLALCreateCOMPLEX8Vector(n / 2 + 1);
+  XLAL_CHECK(y1 != NULL && y2 != NULL, XLAL_EFUNC);
+  for (UINT4 i = 0; i < n; ++i) {
+    x->data[i] = rand() / (RAND_MAX + 1.0) - 0.5;
+  }
+
+  REAL4FFTPlan *plan1 = XLALCreateForwardREAL4FFTPlan(n, 0);
+  REAL4FFTPlan *plan2 = XLALCreateForwardREAL4FFTPlan(n, 0);
+  XLAL_CHECK(plan1 != NULL && plan2 != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALREAL4ForwardFFT(y1, x, plan1) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLALDestroyREAL4FFTPlan(plan1);
+  XLAL_CHECK(XLALREAL4ForwardFFT(y2, x, plan2) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(memcmp(y1->data, y2->data, y1->length * sizeof(y1->data[0])) == 0, XLAL_EFAILED, "Shared plans of size %u give different results", n);
+  XLALDestroyREAL4FFTPlan(plan2);
+
+  // plan should now be found in the cache
+  plan1 = XLALCreateForwardREAL4FFTPlan(n, 0);
+  XLAL_CHECK(plan1 != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALREAL4ForwardFFT(y2, x, plan1) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(memcmp(y1->data, y2->data, y1->length * sizeof(y1->data[0])) == 0, XLAL_EFAILED, "Cached plan of size %u gives different results", n);
+  XLALDestroyREAL4FFTPlan(plan1);
+
+  XLALDestroyREAL4Vector(x);
+  XLALDestroyCOMPLEX8Vector(y1);
+  XLALDestroyCOMPLEX8Vector(y2);
+
+  return XLAL_SUCCESS;
+}
+
+// check that plans evicted from the cache, when more plans are released than it retains, are recreated correctly
+static int test_evicted_plans(void)
+{
+  const UINT4 nsizes = 200;
+  for (UINT4 n = 16; n < 16 + nsizes; ++n) {
+    COMPLEX8FFTPlan *plan = XLALCreateForwardCOMPLEX8FFTPlan(n, 0);
+    XLAL_CHECK(plan != NULL, XLAL_EFUNC);
+    XLALDestroyCOMPLEX8FFTPlan(plan);
+  }
+  for (UINT4 n = 16; n < 16 + nsizes; n += 37) {
+    COMPLEX8Vector *z = XLALCreateCOMPLEX8Vector(n);
+    COMPLEX8Vector *w = XLALCreateCOMPLEX8Vector(n);
+    XLAL_CHECK(z != NULL && w != NULL, XLAL_EFUNC);
+    for (UINT4 i = 0; i < n; ++i) {
+      z->data[i] = (i == 1) ? 1.0 : 0.0;
+    }
+    COMPLEX8FFTPlan *plan = XLALCreateForwardCOMPLEX8FFTPlan(n, 0);
+    XLAL_CHECK(plan != NULL, XLAL_EFUNC);
+    XLAL_CHECK(XLALCOMPLEX8VectorFFT(w, z, plan) == XLAL_SUCCESS, XLAL_EFUNC);
+    for (UINT4 i = 0; i < n; ++i) {
+      const COMPLEX8 expect = cexpf(-2.0 * LAL_PI * I * i / n);
+      XLAL_CHECK(cabsf(w->data[i] - expect) < 1e-5, XLAL_ETOL, "Recreated FFT of size %u is wrong at index %u", n, i);
+    }
+    XLALDestroyCOMPLEX8FFTPlan(plan);
+    XLALDestroyCOMPLEX8Vector(z);
+    XLALDestroyCOMPLEX8Vector(w);
+  }
+  return XLAL_SUCCESS;
+}
+
+// check that pre-warmed plans of all types can be used
+static int test_prewarm(void)
+{
+  UINT4Vector *sizes = XLALCreateUINT4Vector(3);
+  XLAL_CHECK(sizes != NULL, XLAL_EFUNC);
+  sizes->data[0] = 16;
+  sizes->data[1] = 100;
+  sizes->data[2] = 1024;
+  XLAL_CHECK(XLALFFTWPrewarmPlanCache(sizes, LAL_FFTW_PLAN_ALL, 0) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  for (UINT4 k = 0; k < sizes->length; ++k) {
+    const UINT4 n = sizes->data[k];
+    COMPLEX16Vector *z = XLALCreateCOMPLEX16Vector(n);
+    COMPLEX16Vector *w = XLALCreateCOMPLEX16Vector(n);
+    XLAL_CHECK(z != NULL && w != NULL, XLAL_EFUNC);
+    for (UINT4 i = 0; i < n; ++i) {
+      z->data[i] = (i == 1) ? 1.0 : 0.0;
+    }
+    COMPLEX16FFTPlan *plan = XLALCreateForwardCOMPLEX16FFTPlan(n, 0);
+    XLAL_CHECK(plan != NULL, XLAL_EFUNC);
+    XLAL_CHECK(XLALCOMPLEX16VectorFFT(w, z, plan) == XLAL_SUCCESS, XLAL_EFUNC);
+    for (UINT4 i = 0; i < n; ++i) {
+      const COMPLEX16 expect = cexp(-2.0 * LAL_PI * I * i / n);
+      XLAL_CHECK(cabs(w->data[i] - expect) < 1e-12, XLAL_ETOL, "FFT of size %u is wrong at index %u", n, i);
+    }
+    XLALDestroyCOMPLEX16FFTPlan(plan);
+    XLALDestroyCOMPLEX16Vector(z);
+    XLALDestroyCOMPLEX16Vector(w);
+  }
+
+  XLAL_CHECK(XLALFFTWPrewarmPlanCache(sizes, 0x10, 0) != XLAL_SUCCESS, XLAL_EFAILED, "Invalid plan types were accepted");
+  XLALClearErrno();
+
+  XLALDestroyUINT4Vector(sizes);
+
+  return XLAL_SUCCESS;
+}
+
+// check that wisdom can be written and read back
+static int test_wisdom(void)
+{
+  REAL8FFTPlan *plan = XLALCreateForwardREAL8FFTPlan(64, 1);
+  XLAL_CHECK(plan != NULL, XLAL_EFUNC);
+  XLALDestroyREAL8FFTPlan(plan);
+  XLAL_CHECK(XLALFFTWExportWisdomToFilename(WISDOM_FNAME) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALFFTWImportWisdomFromFilename(WISDOM_FNAME) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALFFTWImportWisdomFromFilename("/nonexistent/" WISDOM_FNAME) != XLAL_SUCCESS, XLAL_EFAILED, "Missing wisdom file was accepted");
+  XLALClearErrno();
+  return XLAL_SUCCESS;
+}
+
+int main(void)
+{
+  srand(1);
+
+  XLAL_CHECK_MAIN(test_shared_plans(1024) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(test_shared_plans(1000) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(test_evicted_plans() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(test_prewarm() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(test_wisdom() == XLAL_SUCCESS, XLAL_EFUNC);
+
+  XLALFFTWClearPlanCache();
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
+
+#endif
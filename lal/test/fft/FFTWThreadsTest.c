@@ -0,0 +1,177 @@
+// Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with with program; see the file COPYING. If not, write to the
+//  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+//  MA  02111-1307  USA
+
+// Test multi-threaded FFT plans against single-threaded plans, and
+// benchmark the scaling of large transforms with the number of threads.
+
+#include <lal/LALConfig.h>
+
+#ifndef LAL_FFTW3_THREADS_ENABLED
+int main(void) { return 77; /* don't do any testing */ }
+#else
+
+#include <stdlib.h>
+#include <math.h>
+#include <complex.h>
+#include <unistd.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/RealFFT.h>
+#include <lal/ComplexFFT.h>
+#include <lal/FFTWMutex.h>
+#include <lal/LogPrintf.h>
+
+#define frand() (rand() / (RAND_MAX + 1.0))
+
+// check that a threaded plan gives the same transform as a single-threaded plan
+static int test_threaded_plans(UINT4 n, UINT4 nthreads)
+{
+  REAL8Vector *x = XLALCreateREAL8Vector(n);
+  COMPLEX16Vector *y1 = XLALCreateCOMPLEX16Vector(n / 2 + 1);
+  COMPLEX16Vector *y2 = XLALCreateCOMPLEX16Vector(n / 2 + 1);
+  COMPLEX8Vector *z = XLALCreateCOMPLEX8Vector(n);
+  COMPLEX8Vector *w1 = XLALCreateCOMPLEX8Vector(n);
+  COMPLEX8Vector *w2 = XLALCreateCOMPLEX8Vector(n);
+  XLAL_CHECK(x && y1 && y2 && z && w1 && w2, XLAL_EFUNC);
+  for (UINT4 i = 0; i < n; ++i) {
+    x->data[i] = frand() - 0.5;
+    z->data[i] = (frand() - 0.5) + I * (frand() - 0.5);
+  }
+
+  REAL8FFTPlan *rplan = XLALCreateForwardREAL8FFTPlan(n, 0);
+  XLAL_CHECK(rplan != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALSetREAL8FFTPlanNumThreads(rplan, 1) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALREAL8ForwardFFT(y1, x, rplan) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALSetREAL8FFTPlanNumThreads(rplan, nthreads) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALREAL8ForwardFFT(y2, x, rplan) == XLAL_SUCCESS, XLAL_EFUNC);
+  for (UINT4 k = 0; k < y1->length; ++k) {
+    const REAL8 err = cabs(y2->data[k] - y1->data[k]);
+    XLAL_CHECK(err <= 1e-14 * n, XLAL_ETOL, "REAL8 FFT of size %u with %u threads: bin %u: error %g exceeds tolerance", n, nthreads, k, err);
+  }
+  XLALDestroyREAL8FFTPlan(rplan);
+
+  COMPLEX8FFTPlan *cplan = XLALCreateReverseCOMPLEX8FFTPlan(n, 0);
+  XLAL_CHECK(cplan != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALSetCOMPLEX8FFTPlanNumThreads(cplan, 1) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALCOMPLEX8VectorFFT(w1, z, cplan) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALSetCOMPLEX8FFTPlanNumThreads(cplan, nthreads) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALCOMPLEX8VectorFFT(w2, z, cplan) == XLAL_SUCCESS, XLAL_EFUNC);
+  for (UINT4 k = 0; k < n; ++k) {
+    const REAL8 err = cabs(w2->data[k] - w1->data[k]);
+    XLAL_CHECK(err <= 1e-6 * n, XLAL_ETOL, "COMPLEX8 FFT of size %u with %u threads: bin %u: error %g exceeds tolerance", n, nthreads, k, err);
+  }
+  XLAL_CHECK(XLALSetCOMPLEX8FFTPlanNumThreads(cplan, 0) != XLAL_SUCCESS, XLAL_EFAILED, "Zero threads were accepted");
+  XLALClearErrno();
+  XLALDestroyCOMPLEX8FFTPlan(cplan);
+
+  XLALDestroyREAL8Vector(x);
+  XLALDestroyCOMPLEX16Vector(y1);
+  XLALDestroyCOMPLEX16Vector(y2);
+  XLALDestroyCOMPLEX8Vector(z);
+  XLALDestroyCOMPLEX8Vector(w1);
+  XLALDestroyCOMPLEX8Vector(w2);
+
+  return XLAL_SUCCESS;
+}
+
+// benchmark a COMPLEX8 and a REAL4 transform of size n with 1 to maxthreads threads
+static int benchmark_threads(UINT4 n, UINT4 maxthreads, UINT4 Nruns)
+{
+  COMPLEX8Vector *z = XLALCreateCOMPLEX8Vector(n);
+  COMPLEX8Vector *w = XLALCreateCOMPLEX8Vector(n);
+  REAL4Vector *x = XLALCreateREAL4Vector(n);
+  COMPLEX8Vector *y = XLALCreateCOMPLEX8Vector(n / 2 + 1);
+  XLAL_CHECK(z && w && x && y, XLAL_EFUNC);
+  for (UINT4 i = 0; i < n; ++i) {
+    z->data[i] = (frand() - 0.5) + I * (frand() - 0.5);
+    x->data[i] = frand() - 0.5;
+  }
+
+  COMPLEX8FFTPlan *cplan = XLALCreateForwardCOMPLEX8FFTPlan(n, 0);
+  REAL4FFTPlan *rplan = XLALCreateForwardREAL4FFTPlan(n, 0);
+  XLAL_CHECK(cplan != NULL && rplan != NULL, XLAL_EFUNC);
+
+  REAL8 tc1 = 0, tr1 = 0;
+  for (UINT4 nthreads = 1; nthreads <= maxthreads; ++nthreads) {
+    XLAL_CHECK(XLALSetCOMPLEX8FFTPlanNumThreads(cplan, nthreads) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK(XLALSetREAL4FFTPlanNumThreads(rplan, nthreads) == XLAL_SUCCESS, XLAL_EFUNC);
+    REAL8 tic, toc;
+
+    // measure wall-clock time, since CPU time sums over threads
+    tic = XLALGetTimeOfDay();
+    for (UINT4 l = 0; l < Nruns; ++l) {
+      XLAL_CHECK(XLALCOMPLEX8VectorFFT(w, z, cplan) == XLAL_SUCCESS, XLAL_EFUNC);
+    }
+    toc = XLALGetTimeOfDay();
+    const REAL8 tc = (toc - tic) / Nruns;
+
+    tic = XLALGetTimeOfDay();
+    for (UINT4 l = 0; l < Nruns; ++l) {
+      XLAL_CHECK(XLALREAL4ForwardFFT(y, x, rplan) == XLAL_SUCCESS, XLAL_EFUNC);
+    }
+    toc = XLALGetTimeOfDay();
+    const REAL8 tr = (toc - tic) / Nruns;
+
+    if (nthreads == 1) {
+      tc1 = tc;
+      tr1 = tr;
+    }
+    XLALPrintInfo("n=%-9u nthreads=%-3u: COMPLEX8 FFT %8.3g s (speedup %5.2f), REAL4 FFT %8.3g s (speedup %5.2f)\n",
+                  n, nthreads, tc, tc1 / tc, tr, tr1 / tr);
+  }
+
+  XLALDestroyCOMPLEX8FFTPlan(cplan);
+  XLALDestroyREAL4FFTPlan(rplan);
+  XLALDestroyCOMPLEX8Vector(z);
+  XLALDestroyCOMPLEX8Vector(w);
+  XLALDestroyREAL4Vector(x);
+  XLALDestroyCOMPLEX8Vector(y);
+
+  return XLAL_SUCCESS;
+}
+
+int main(void)
+{
+  srand(1);
+
+  XLAL_CHECK_MAIN(XLALFFTWGetNumThreads() >= 1, XLAL_EFAILED);
+  XLAL_CHECK_MAIN(XLALFFTWSetNumThreads(0) != XLAL_SUCCESS, XLAL_EFAILED, "Zero threads were accepted");
+  XLALClearErrno();
+
+  // small and large transforms, with the default number of threads set
+  XLAL_CHECK_MAIN(XLALFFTWSetNumThreads(2) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(XLALFFTWGetNumThreads() == 2, XLAL_EFAILED);
+  XLAL_CHECK_MAIN(test_threaded_plans(1000, 3) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(test_threaded_plans(65536, 4) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(XLALFFTWSetNumThreads(1) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(test_threaded_plans(65536, 2) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  // scaling benchmark from 1 to the number of available processors, at most 8
+  long nproc = sysconf(_SC_NPROCESSORS_ONLN);
+  const UINT4 maxthreads = (nproc < 1) ? 1 : (nproc > 8) ? 8 : (UINT4) nproc;
+  XLAL_CHECK_MAIN(benchmark_threads(1u << 16, maxthreads, 100) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(benchmark_threads(1u << 20, maxthreads, 10) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(benchmark_threads(1u << 22, maxthreads, 4) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  XLALFFTWClearPlanCache();
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,278 @@
+// Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with with program; see the file COPYING. If not, write to the
+//  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+//  MA  02111-1307  USA
+
+// Test allocation from arenas, both directly and through the vector,
+// sequence and frequency series factory functions.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALArena.h>
+#include <lal/AVFactories.h>
+#include <lal/SeqFactories.h>
+#include <lal/Sequence.h>
+#include <lal/FrequencySeries.h>
+#include <lal/Units.h>
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#endif
+
+static int test_arena_alloc(void)
+{
+  LALArena *arena = XLALCreateArena(4096);
+  XLAL_CHECK(arena != NULL, XLAL_EFUNC);
+
+  // allocations are aligned and do not overlap
+  char *p = XLALArenaAlloc(arena, 100);
+  char *q = XLALArenaAlloc(arena, 1);
+  XLAL_CHECK(p != NULL && q != NULL, XLAL_EFUNC);
+  XLAL_CHECK(((uintptr_t) p) % 64 == 0 && ((uintptr_t) q) % 64 == 0, XLAL_EFAILED, "Arena allocations are not aligned");
+  XLAL_CHECK(q >= p + 100, XLAL_EFAILED, "Arena allocations overlap");
+  memset(p, 0xab, 100);
+
+  // the most recent allocation grows in place, others are copied
+  char *q2 = XLALArenaRealloc(arena, q, 1, 200);
+  XLAL_CHECK(q2 == q, XLAL_EFAILED, "Most recent allocation was not resized in place");
+  char *p2 = XLALArenaRealloc(arena, p, 100, 300);
+  XLAL_CHECK(p2 != NULL && p2 != p, XLAL_EFAILED);
+  for (int i = 0; i < 100; ++i) {
+    XLAL_CHECK((unsigned char) p2[i] == 0xab, XLAL_EFAILED, "Arena reallocation did not copy contents");
+  }
+
+  // allocations larger than the block size get their own block
+  XLAL_CHECK(XLALArenaAlloc(arena, 10000) != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALArenaGetNumBlockAllocs(arena) == 2, XLAL_EFAILED);
+  XLAL_CHECK(XLALArenaGetBytesUsed(arena) >= 10600, XLAL_EFAILED);
+
+  // after a reset, the same allocations fit into a single block
+  XLALArenaReset(arena);
+  XLAL_CHECK(XLALArenaGetBytesUsed(arena) == 0, XLAL_EFAILED);
+  const size_t nblockallocs = XLALArenaGetNumBlockAllocs(arena);
+  for (int k = 0; k < 10; ++k) {
+    XLAL_CHECK(XLALArenaAlloc(arena, 100) != NULL, XLAL_EFUNC);
+    XLAL_CHECK(XLALArenaAlloc(arena, 300) != NULL, XLAL_EFUNC);
+    XLAL_CHECK(XLALArenaAlloc(arena, 10000) != NULL, XLAL_EFUNC);
+    XLAL_CHECK(XLALArenaGetBytesUsed(arena) >= 10400, XLAL_EFAILED);
+    XLALArenaReset(arena);
+  }
+  XLAL_CHECK(XLALArenaGetNumBlockAllocs(arena) == nblockallocs, XLAL_EFAILED, "Arena allocated blocks after warm-up");
+
+  XLALDestroyArena(arena);
+
+  return XLAL_SUCCESS;
+}
+
+static int test_arena_factories(void)
+{
+  LALArena *arena = XLALGetThreadArena();
+  XLAL_CHECK(arena != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALGetThreadArena() == arena, XLAL_EFAILED);
+  XLAL_CHECK(XLALGetCurrentArena() == NULL, XLAL_EFAILED);
+
+  // objects created outside an arena are not owned by it
+  REAL8Vector *heapvec = XLALCreateREAL8Vector(16);
+  XLAL_CHECK(heapvec != NULL, XLAL_EFUNC);
+
+  const size_t nmalloc = lalMallocCount;
+  for (int iter = 0; iter < 3; ++iter) {
+    XLAL_CHECK(XLALArenaPush(arena) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK(XLALGetCurrentArena() == arena, XLAL_EFAILED);
+
+    REAL8Vector *vec = XLALCreateREAL8Vector(1000);
+    COMPLEX8VectorSequence *vseq = XLALCreateCOMPLEX8VectorSequence(4, 100);
+    REAL4Sequence *seq = XLALCreateREAL4Sequence(50);
+    COMPLEX16FrequencySeries *series = XLALCreateCOMPLEX16FrequencySeries("test", &(LIGOTimeGPS) {0, 0}, 0, 1, &lalDimensionlessUnit, 500);
+    XLAL_CHECK(vec && vseq && seq && series, XLAL_EFUNC);
+    XLAL_CHECK(XLALArenaOwner(vec) == arena && XLALArenaOwner(vec->data) == arena, XLAL_EFAILED);
+    XLAL_CHECK(XLALArenaOwner(series) == arena && XLALArenaOwner(series->data->data) == arena, XLAL_EFAILED);
+    XLAL_CHECK(XLALArenaOwner(heapvec) == NULL, XLAL_EFAILED);
+    for (UINT4 i = 0; i < vec->length; ++i) {
+      vec->data[i] = i;
+    }
+
+    // resizing keeps the contents
+    vec = XLALResizeREAL8Vector(vec, 2000);
+    XLAL_CHECK(vec != NULL && vec->length == 2000, XLAL_EFUNC);
+    XLAL_CHECK(vec->data[999] == 999, XLAL_EFAILED);
+    XLAL_CHECK(XLALResizeREAL4Sequence(seq, 10, 100) != NULL, XLAL_EFUNC);
+    XLAL_CHECK(XLALShrinkCOMPLEX16FrequencySeries(series, 100, 200) != NULL, XLAL_EFUNC);
+
+    // heap objects can be resized and destroyed as usual
+    heapvec = XLALResizeREAL8Vector(heapvec, 32 + iter);
+    XLAL_CHECK(heapvec != NULL, XLAL_EFUNC);
+
+    XLALDestroyREAL8Vector(vec);
+    XLALDestroyCOMPLEX8VectorSequence(vseq);
+    XLALDestroyREAL4Sequence(seq);
+    XLALDestroyCOMPLEX16FrequencySeries(series);
+    XLAL_CHECK(XLALArenaPop(arena) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLALArenaReset(arena);
+  }
+  XLAL_CHECK(XLALGetCurrentArena() == NULL, XLAL_EFAILED);
+
+  // only the heap vector should have been reallocated with LALMalloc()
+  XLAL_CHECK(lalMallocCount - nmalloc <= 3, XLAL_EFAILED, "Factories called LALMalloc() %zu times while an arena was pushed", lalMallocCount - nmalloc);
+
+  // popping an empty arena stack fails
+  int errnum;
+  XLAL_TRY_SILENT(XLALArenaPop(arena), errnum);
+  XLAL_CHECK(errnum == XLAL_EINVAL, XLAL_EFAILED, "Popped an empty arena stack");
+
+  XLALDestroyREAL8Vector(heapvec);
+
+  return XLAL_SUCCESS;
+}
+
+static int test_arena_pop(void)
+{
+  LALArena *arena = XLALGetThreadArena();
+  XLAL_CHECK(arena != NULL, XLAL_EFUNC);
+
+  XLAL_CHECK(XLALArenaPush(arena) == XLAL_SUCCESS, XLAL_EFUNC);
+  REAL8Vector *vec = XLALCreateREAL8Vector(100);
+  REAL8Vector *vec2 = XLALCreateREAL8Vector(10);
+  REAL4Sequence *seq = XLALCreateREAL4Sequence(50);
+  COMPLEX16FrequencySeries *series = XLALCreateCOMPLEX16FrequencySeries("test", &(LIGOTimeGPS) {0, 0}, 0, 1, &lalDimensionlessUnit, 500);
+  XLAL_CHECK(vec && vec2 && seq && series, XLAL_EFUNC);
+  for (UINT4 i = 0; i < vec->length; ++i) {
+    vec->data[i] = i;
+  }
+  for (UINT4 i = 0; i < seq->length; ++i) {
+    seq->data[i] = i;
+  }
+  XLAL_CHECK(XLALArenaPop(arena) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALGetCurrentArena() == NULL, XLAL_EFAILED);
+
+  // the arena still owns the objects after it is popped
+  XLAL_CHECK(XLALArenaOwner(vec) == arena && XLALArenaOwner(vec->data) == arena, XLAL_EFAILED);
+  XLAL_CHECK(XLALArenaOwner(series) == arena && XLALArenaOwner(series->data->data) == arena, XLAL_EFAILED);
+
+  // growing an object after its arena is popped moves its data to the heap
+  vec = XLALResizeREAL8Vector(vec, 200);
+  XLAL_CHECK(vec != NULL && vec->length == 200, XLAL_EFUNC);
+  XLAL_CHECK(XLALArenaOwner(vec) == arena && XLALArenaOwner(vec->data) == NULL, XLAL_EFAILED);
+  XLAL_CHECK(vec->data[99] == 99, XLAL_EFAILED);
+  XLAL_CHECK(XLALResizeREAL4Sequence(seq, 0, 100) != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALArenaOwner(seq) == arena && XLALArenaOwner(seq->data) == NULL, XLAL_EFAILED);
+  XLAL_CHECK(seq->data[49] == 49 && seq->data[50] == 0, XLAL_EFAILED);
+
+  // shrinking keeps the data in the arena
+  XLAL_CHECK(XLALShrinkCOMPLEX16FrequencySeries(series, 100, 200) != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALArenaOwner(series->data->data) == arena, XLAL_EFAILED);
+
+  // objects are destroyed after their arena is popped, freeing only the
+  // data moved to the heap; anything else freed here would be reported by
+  // LAL memory debugging, or leaked at LALCheckMemoryLeaks()
+  XLALDestroyREAL8Vector(vec);
+  XLALDestroyREAL8Vector(vec2);
+  XLALDestroyREAL4Sequence(seq);
+  XLALDestroyCOMPLEX16FrequencySeries(series);
+  XLALArenaReset(arena);
+
+  return XLAL_SUCCESS;
+}
+
+#ifdef LAL_PTHREAD_LOCK
+enum { NOWNER = 4, NOWNERPTRS = 64 };
+static LALArena *owner_arenas[NOWNER];
+static void *owner_ptrs[NOWNER][NOWNERPTRS];
+static int owner_done = 0;
+static int owner_errors = 0;
+static void *owner_thread(void *arg)
+{
+  (void) arg;
+  while (!__atomic_load_n(&owner_done, __ATOMIC_ACQUIRE)) {
+    for (int k = 0; k < NOWNER; ++k) {
+      for (int i = 0; i < NOWNERPTRS; ++i) {
+        if (XLALArenaOwner(owner_ptrs[k][i]) != owner_arenas[k]) {
+          __atomic_add_fetch(&owner_errors, 1, __ATOMIC_RELAXED);
+        }
+      }
+    }
+  }
+  return NULL;
+}
+#endif
+
+static int test_arena_owner(void)
+{
+#ifdef LAL_PTHREAD_LOCK
+
+  // the owners of memory in several arenas are found from other threads,
+  // while another arena adds and frees blocks
+  for (int k = 0; k < NOWNER; ++k) {
+    owner_arenas[k] = XLALCreateArena(1024);
+    XLAL_CHECK(owner_arenas[k] != NULL, XLAL_EFUNC);
+    for (int i = 0; i < NOWNERPTRS; ++i) {
+      owner_ptrs[k][i] = XLALArenaAlloc(owner_arenas[k], 100 + 10 * i);
+      XLAL_CHECK(owner_ptrs[k][i] != NULL, XLAL_EFUNC);
+    }
+  }
+  pthread_t threads[2];
+  for (int t = 0; t < 2; ++t) {
+    XLAL_CHECK(pthread_create(&threads[t], NULL, owner_thread, NULL) == 0, XLAL_ESYS);
+  }
+  LALArena *churn = XLALCreateArena(1024);
+  XLAL_CHECK(churn != NULL, XLAL_EFUNC);
+  for (int iter = 0; iter < 200; ++iter) {
+    for (int i = 0; i < 16; ++i) {
+      char *p = XLALArenaAlloc(churn, 1000);
+      XLAL_CHECK(p != NULL, XLAL_EFUNC);
+      XLAL_CHECK(XLALArenaOwner(p) == churn, XLAL_EFAILED);
+    }
+    if (iter % 2 == 0) {
+      XLALDestroyArena(churn);
+      churn = XLALCreateArena(1024);
+      XLAL_CHECK(churn != NULL, XLAL_EFUNC);
+    } else {
+      XLALArenaReset(churn);
+    }
+  }
+  __atomic_store_n(&owner_done, 1, __ATOMIC_RELEASE);
+  for (int t = 0; t < 2; ++t) {
+    pthread_join(threads[t], NULL);
+  }
+  XLAL_CHECK(owner_errors == 0, XLAL_EFAILED, "XLALArenaOwner() returned the wrong arena %i times", owner_errors);
+  XLALDestroyArena(churn);
+
+  // memory of a destroyed arena is no longer owned
+  void *p = owner_ptrs[0][0];
+  XLALDestroyArena(owner_arenas[0]);
+  XLAL_CHECK(XLALArenaOwner(p) == NULL, XLAL_EFAILED);
+  XLAL_CHECK(XLALArenaOwner(owner_ptrs[1][0]) == owner_arenas[1], XLAL_EFAILED);
+  for (int k = 1; k < NOWNER; ++k) {
+    XLALDestroyArena(owner_arenas[k]);
+  }
+
+#endif
+  return XLAL_SUCCESS;
+}
+
+int main(void)
+{
+  XLAL_CHECK_MAIN(test_arena_alloc() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(test_arena_factories() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(test_arena_pop() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(test_arena_owner() == XLAL_SUCCESS, XLAL_EFUNC);
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
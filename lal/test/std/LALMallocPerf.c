@@ -27,6 +27,11 @@
 
 #include <stdio.h>
 
+#include <lal/LALConfig.h>
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#endif
+
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
 
@@ -34,6 +39,29 @@
 #include <lal/LALMalloc.h>
 #include <lal/LogPrintf.h>
 
+#ifdef LAL_PTHREAD_LOCK
+static void *thread_allocs(void *arg) {
+  const int n = *(const int *) arg;
+  void *x[256];
+  for (int i = 0; i < n; i += 256) {
+    for (int j = 0; j < 256; ++j) {
+      x[j] = XLALMalloc(sizeof(int) * (1 + j));
+    }
+    for (int j = 0; j < 256; ++j) {
+      XLALFree(x[j]);
+    }
+  }
+  return NULL;
+}
+static void *thread_frees(void *arg) {
+  void **x = (void **) arg;
+  for (int i = 0; x[i] != NULL; ++i) {
+    XLALFree(x[i]);
+  }
+  return NULL;
+}
+#endif
+
 int main(void) {
 
   setvbuf(stdout, NULL, _IONBF, 0);
@@ -91,6 +119,49 @@ int main(void) {
     printf("%g sec (%e sec/deallocate)\n", t, t/n);
   }
 
+#ifdef LAL_PTHREAD_LOCK
+  {
+    enum { nthreads_max = 8 };
+    pthread_t threads[nthreads_max];
+    REAL8 t1 = 0;
+    for (int nthreads = 1; nthreads <= nthreads_max; nthreads *= 2) {
+      printf("LALMallocPerf: Allocate and deallocate in %i threads:\t", nthreads);
+      const REAL8 t0 = XLALGetTimeOfDay();
+      for (int k = 0; k < nthreads; ++k) {
+        if (pthread_create(&threads[k], NULL, thread_allocs, (void *) &n) != 0) {
+          return EXIT_FAILURE;
+        }
+      }
+      for (int k = 0; k < nthreads; ++k) {
+        pthread_join(threads[k], NULL);
+      }
+      const REAL8 t = XLALGetTimeOfDay() - t0;
+      if (nthreads == 1) {
+        t1 = t;
+      }
+      printf("%g sec (%e sec/allocate, throughput %.2f x 1 thread)\n", t, t/n/nthreads, nthreads * t1 / t);
+    }
+  }
+  {
+    void **x = XLALCalloc(n + 1, sizeof(*x));
+    for (int i = 0; i < n; ++i) {
+      x[i] = XLALMalloc(sizeof(int));
+    }
+    printf("LALMallocPerf: Deallocate in another thread:\t\t");
+    pthread_t thread;
+    const REAL8 t0 = XLALGetTimeOfDay();
+    if (pthread_create(&thread, NULL, thread_frees, (void *) x) != 0) {
+      return EXIT_FAILURE;
+    }
+    pthread_join(thread, NULL);
+    const REAL8 t = XLALGetTimeOfDay() - t0;
+    printf("%g sec (%e sec/deallocate)\n", t, t/n);
+    XLALFree(x);
+  }
+#endif
+
+  LALPrintMemoryCallSites(5);
+
   LALCheckMemoryLeaks();
 
   return EXIT_SUCCESS;
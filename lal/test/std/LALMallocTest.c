@@ -281,14 +281,22 @@ static int testAllocList( void )
   trial( LALFree( q ), 0, "" );
   trial( LALCheckMemoryLeaks(), 0, "" );
 
-  /* can't find allocation in ModAlloc */
-  /* For some reason this next test fails on Snow Leopard... */
-  /* trial( s = LALRealloc( s, 1024 ), SIGSEGV, "not found" ); */
+  /* can't find allocation in LALRealloc */
+  trial( s = LALRealloc( s, 1024 ), SIGSEGV, "not found" );
   trial( p = LALRealloc( NULL, 2 * sizeof( *p ) ), 0, "" );
-  /* trial( s = LALRealloc( s, 1024 ), SIGSEGV, "not found" ); */
+  trial( s = LALRealloc( s, 1024 ), SIGSEGV, "not found" );
   trial( LALFree( p ), 0, "" );
   trial( LALCheckMemoryLeaks(), 0, "" );
 
+  /* allocation is looked up before its padding is read */
+  XLALClobberDebugLevel(lalDebugLevel | LALMEMPADBIT);
+  trial( p = LALMalloc( 2 * sizeof( *p ) ), 0, "" );
+  trial( LALFree( s ), SIGSEGV, "not found" );
+  trial( s = LALRealloc( s, 1024 ), SIGSEGV, "not found" );
+  trial( LALFree( p ), 0, "" );
+  trial( LALFree( p ), SIGSEGV, "not found" );
+  trial( LALCheckMemoryLeaks(), 0, "" );
+
   free( s );
   XLALClobberDebugLevel(keep);
   return 0;
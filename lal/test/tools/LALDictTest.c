@@ -0,0 +1,180 @@
+// Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with with program; see the file COPYING. If not, write to the
+//  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+//  MA  02111-1307  USA
+
+// Test insertion, lookup, removal and iteration of LALDict entries across
+// resizes of the hash table, and lookups by interned key handles.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALDict.h>
+#include <lal/LogPrintf.h>
+
+#define NKEYS 5000
+
+static int test_insert_remove(void)
+{
+  char key[LAL_KEYNAME_MAX + 1];
+
+  LALDict *dict = XLALCreateDict();
+  XLAL_CHECK(dict != NULL, XLAL_EFUNC);
+
+  // insert enough keys to resize the table several times
+  for (INT4 i = 0; i < NKEYS; ++i) {
+    snprintf(key, sizeof(key), "key%d", i);
+    XLAL_CHECK(XLALDictInsertINT4Value(dict, key, i) == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+  XLAL_CHECK(XLALDictSize(dict) == NKEYS, XLAL_EFAILED);
+
+  // overwriting an entry with a larger value keeps the dictionary size
+  XLAL_CHECK(XLALDictInsertStringValue(dict, "key1", "a string longer than an INT4") == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(strcmp(XLALDictLookupStringValue(dict, "key1"), "a string longer than an INT4") == 0, XLAL_EFAILED);
+  XLAL_CHECK(XLALDictInsertINT4Value(dict, "key1", 1) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALDictSize(dict) == NKEYS, XLAL_EFAILED);
+
+  // remove every other key
+  for (INT4 i = 0; i < NKEYS; i += 2) {
+    snprintf(key, sizeof(key), "key%d", i);
+    XLAL_CHECK(XLALDictRemove(dict, key) == 0, XLAL_EFAILED, "Failed to remove `%s'", key);
+  }
+  XLAL_CHECK(XLALDictRemove(dict, "key0") != 0, XLAL_EFAILED, "Removed `key0' twice");
+  XLAL_CHECK(XLALDictSize(dict) == NKEYS / 2, XLAL_EFAILED);
+
+  // remaining keys are found with the right values, removed keys are not
+  for (INT4 i = 0; i < NKEYS; ++i) {
+    snprintf(key, sizeof(key), "key%d", i);
+    const int contains = XLALDictContains(dict, key);
+    XLAL_CHECK(contains == (i % 2), XLAL_EFAILED, "XLALDictContains(`%s') returned %i", key, contains);
+    if (contains) {
+      XLAL_CHECK(XLALDictLookupINT4Value(dict, key) == i, XLAL_EFAILED);
+    }
+  }
+
+  // iteration visits each entry once
+  {
+    LALDictIter iter;
+    LALDictEntry *entry;
+    INT8 sum = 0;
+    size_t n = 0;
+    XLALDictIterInit(&iter, dict);
+    while ((entry = XLALDictIterNext(&iter)) != NULL) {
+      sum += XLALValueGetINT4(XLALDictEntryGetValue(entry));
+      ++n;
+    }
+    XLAL_CHECK(n == NKEYS / 2, XLAL_EFAILED);
+    XLAL_CHECK(sum == ((INT8) NKEYS / 2) * ((INT8) NKEYS / 2), XLAL_EFAILED);
+  }
+
+  // duplicated dictionaries hold the same entries
+  LALDict *copy = XLALDictDuplicate(dict);
+  XLAL_CHECK(copy != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALDictSize(copy) == NKEYS / 2, XLAL_EFAILED);
+  XLAL_CHECK(XLALDictLookupINT4Value(copy, "key4999") == 4999, XLAL_EFAILED);
+
+  // keys which are too long are rejected
+  XLAL_CHECK(XLALDictInsertINT4Value(dict, "a_key_name_which_is_far_too_long_to_fit", 0) != XLAL_SUCCESS, XLAL_EFAILED);
+  XLALClearErrno();
+
+  XLALDestroyDict(copy);
+  XLALDestroyDict(dict);
+
+  return XLAL_SUCCESS;
+}
+
+static int test_key_handles(void)
+{
+  const LALDictKeyHandle *mass1 = XLALDictInternKey("mass1");
+  const LALDictKeyHandle *mass2 = XLALDictInternKey("mass2");
+  XLAL_CHECK(mass1 != NULL && mass2 != NULL, XLAL_EFUNC);
+
+  // interned keys are unique
+  XLAL_CHECK(XLALDictInternKey("mass1") == mass1, XLAL_EFAILED);
+  XLAL_CHECK(mass1 != mass2, XLAL_EFAILED);
+  XLAL_CHECK(strcmp(XLALDictKeyHandleGetKey(mass2), "mass2") == 0, XLAL_EFAILED);
+
+  LALDict *dict = XLALCreateDict();
+  XLAL_CHECK(dict != NULL, XLAL_EFUNC);
+  XLAL_CHECK(XLALDictInsertREAL8Value(dict, "mass1", 1.4) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALDictContainsKeyHandle(dict, mass1), XLAL_EFAILED);
+  XLAL_CHECK(!XLALDictContainsKeyHandle(dict, mass2), XLAL_EFAILED);
+  XLAL_CHECK(XLALDictLookupByKeyHandle(dict, mass1) == XLALDictLookup(dict, "mass1"), XLAL_EFAILED);
+  XLAL_CHECK(XLALDictLookupREAL8ValueByKeyHandle(dict, mass1) == 1.4, XLAL_EFAILED);
+  XLAL_CHECK(XLALDictLookupByKeyHandle(dict, mass2) == NULL, XLAL_EFAILED);
+  XLAL_CHECK(XLAL_IS_REAL8_FAIL_NAN(XLALDictLookupREAL8ValueByKeyHandle(dict, mass2)), XLAL_EFAILED);
+  XLALClearErrno();
+
+  XLALDestroyDict(dict);
+
+  return XLAL_SUCCESS;
+}
+
+// time lookups of a typical set of waveform parameters by key name and by key handle
+static int benchmark_lookups(UINT4 Nruns)
+{
+  const char *keys[] = {
+    "lambda1", "lambda2", "dQuadMon1", "dQuadMon2", "phaseO", "ampO", "spinO", "tideO",
+    "frameAxis", "modesChoice", "sideband", "numreldata", "ModeArray", "dchi0", "dchi1", "dchi2",
+  };
+  const LALDictKeyHandle *handles[XLAL_NUM_ELEM(keys)];
+  REAL8 tic, toc, sum = 0;
+
+  LALDict *dict = XLALCreateDict();
+  XLAL_CHECK(dict != NULL, XLAL_EFUNC);
+  for (size_t i = 0; i < XLAL_NUM_ELEM(keys); ++i) {
+    XLAL_CHECK(XLALDictInsertREAL8Value(dict, keys[i], i) == XLAL_SUCCESS, XLAL_EFUNC);
+    handles[i] = XLALDictInternKey(keys[i]);
+    XLAL_CHECK(handles[i] != NULL, XLAL_EFUNC);
+  }
+
+  tic = XLALGetCPUTime();
+  for (UINT4 l = 0; l < Nruns; ++l) {
+    for (size_t i = 0; i < XLAL_NUM_ELEM(keys); ++i) {
+      sum += XLALDictLookupREAL8Value(dict, keys[i]);
+    }
+  }
+  toc = XLALGetCPUTime();
+  const REAL8 tkey = (toc - tic) / (Nruns * XLAL_NUM_ELEM(keys));
+
+  tic = XLALGetCPUTime();
+  for (UINT4 l = 0; l < Nruns; ++l) {
+    for (size_t i = 0; i < XLAL_NUM_ELEM(keys); ++i) {
+      sum += XLALDictLookupREAL8ValueByKeyHandle(dict, handles[i]);
+    }
+  }
+  toc = XLALGetCPUTime();
+  const REAL8 thandle = (toc - tic) / (Nruns * XLAL_NUM_ELEM(keys));
+
+  XLAL_CHECK(sum == 2.0 * Nruns * (XLAL_NUM_ELEM(keys) * (XLAL_NUM_ELEM(keys) - 1) / 2), XLAL_EFAILED);
+  XLALPrintInfo("lookup by key name %8.3g s, by key handle %8.3g s (speedup %5.2f)\n", tkey, thandle, tkey / thandle);
+
+  XLALDestroyDict(dict);
+
+  return XLAL_SUCCESS;
+}
+
+int main(void)
+{
+  XLAL_CHECK_MAIN(test_insert_remove() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(test_key_handles() == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(benchmark_lookups(100000) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
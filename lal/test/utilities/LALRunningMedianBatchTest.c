@@ -0,0 +1,191 @@
+// Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with with program; see the file COPYING. If not, write to the
+//  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+//  MA  02111-1307  USA
+
+// Test the heap-based running median functions against LALDRunningMedian2()
+// and LALSRunningMedian2(), and benchmark them for a range of blocksizes.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/SeqFactories.h>
+#include <lal/LALRunningMedian.h>
+#include <lal/LogPrintf.h>
+
+#define frand() (rand() / (RAND_MAX + 1.0))
+
+// check that the REAL8 and REAL4 running medians are identical to LAL{D,S}RunningMedian2()
+static int test_running_median(UINT4 length, UINT4 blocksize)
+{
+  LALStatus status;
+  memset(&status, 0, sizeof(status));
+  LALRunningMedianPar param = { .blocksize = blocksize };
+  const UINT4 nmed = length - blocksize + 1;
+
+  REAL8Sequence *input8 = XLALCreateREAL8Vector(length);
+  REAL8Sequence *medians8 = XLALCreateREAL8Vector(nmed);
+  REAL8Sequence *ref8 = XLALCreateREAL8Vector(nmed);
+  REAL4Sequence *input4 = XLALCreateREAL4Vector(length);
+  REAL4Sequence *medians4 = XLALCreateREAL4Vector(nmed);
+  REAL4Sequence *ref4 = XLALCreateREAL4Vector(nmed);
+  XLAL_CHECK(input8 && medians8 && ref8 && input4 && medians4 && ref4, XLAL_EFUNC);
+
+  // include repeated values, which exercise ties in the heaps
+  for (UINT4 i = 0; i < length; ++i) {
+    input8->data[i] = (rand() % 4 == 0) ? (REAL8)(rand() % 3) : frand();
+    input4->data[i] = input8->data[i];
+  }
+
+  LALDRunningMedian2(&status, ref8, input8, param);
+  XLAL_CHECK(status.statusCode == 0, XLAL_EFAILED, "LALDRunningMedian2() failed with status %d", status.statusCode);
+  XLAL_CHECK(XLALREAL8RunningMedian(medians8, input8, blocksize) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(memcmp(medians8->data, ref8->data, nmed * sizeof(REAL8)) == 0, XLAL_EFAILED,
+             "XLALREAL8RunningMedian() differs from LALDRunningMedian2() for length=%u, blocksize=%u", length, blocksize);
+
+  LALSRunningMedian2(&status, ref4, input4, param);
+  XLAL_CHECK(status.statusCode == 0, XLAL_EFAILED, "LALSRunningMedian2() failed with status %d", status.statusCode);
+  XLAL_CHECK(XLALREAL4RunningMedian(medians4, input4, blocksize) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(memcmp(medians4->data, ref4->data, nmed * sizeof(REAL4)) == 0, XLAL_EFAILED,
+             "XLALREAL4RunningMedian() differs from LALSRunningMedian2() for length=%u, blocksize=%u", length, blocksize);
+
+  XLALDestroyREAL8Vector(input8);
+  XLALDestroyREAL8Vector(medians8);
+  XLALDestroyREAL8Vector(ref8);
+  XLALDestroyREAL4Vector(input4);
+  XLALDestroyREAL4Vector(medians4);
+  XLALDestroyREAL4Vector(ref4);
+
+  return XLAL_SUCCESS;
+}
+
+// check that the batched running medians are identical to those of the individual series
+static int test_running_median_batch(UINT4 nseries, UINT4 length, UINT4 blocksize)
+{
+  const UINT4 nmed = length - blocksize + 1;
+
+  REAL4VectorSequence *input = XLALCreateREAL4VectorSequence(nseries, length);
+  REAL4VectorSequence *medians = XLALCreateREAL4VectorSequence(nseries, nmed);
+  REAL4Sequence *ref = XLALCreateREAL4Vector(nmed);
+  XLAL_CHECK(input && medians && ref, XLAL_EFUNC);
+  for (UINT4 i = 0; i < nseries * length; ++i) {
+    input->data[i] = frand();
+  }
+
+  XLAL_CHECK(XLALREAL4RunningMedianBatch(medians, input, blocksize) == XLAL_SUCCESS, XLAL_EFUNC);
+  for (UINT4 j = 0; j < nseries; ++j) {
+    REAL4Sequence series = { .length = length, .data = input->data + j * length };
+    XLAL_CHECK(XLALREAL4RunningMedian(ref, &series, blocksize) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK(memcmp(medians->data + j * nmed, ref->data, nmed * sizeof(REAL4)) == 0, XLAL_EFAILED,
+               "XLALREAL4RunningMedianBatch() differs for series %u of %u, blocksize=%u", j, nseries, blocksize);
+  }
+
+  XLALDestroyREAL4VectorSequence(input);
+  XLALDestroyREAL4VectorSequence(medians);
+  XLALDestroyREAL4Vector(ref);
+
+  return XLAL_SUCCESS;
+}
+
+// benchmark LALSRunningMedian2() against the single and batched heap-based running medians
+static int benchmark_running_median(UINT4 nseries, UINT4 length, UINT4 blocksize)
+{
+  LALStatus status;
+  memset(&status, 0, sizeof(status));
+  LALRunningMedianPar param = { .blocksize = blocksize };
+  const UINT4 nmed = length - blocksize + 1;
+  REAL8 tic, toc;
+
+  REAL4VectorSequence *input = XLALCreateREAL4VectorSequence(nseries, length);
+  REAL4VectorSequence *medians = XLALCreateREAL4VectorSequence(nseries, nmed);
+  XLAL_CHECK(input && medians, XLAL_EFUNC);
+  for (UINT4 i = 0; i < nseries * length; ++i) {
+    input->data[i] = frand();
+  }
+
+  tic = XLALGetCPUTime();
+  for (UINT4 j = 0; j < nseries; ++j) {
+    REAL4Sequence in = { .length = length, .data = input->data + j * length };
+    REAL4Sequence out = { .length = nmed, .data = medians->data + j * nmed };
+    LALSRunningMedian2(&status, &out, &in, param);
+    XLAL_CHECK(status.statusCode == 0, XLAL_EFAILED, "LALSRunningMedian2() failed with status %d", status.statusCode);
+  }
+  toc = XLALGetCPUTime();
+  const REAL8 tlist = toc - tic;
+
+  tic = XLALGetCPUTime();
+  for (UINT4 j = 0; j < nseries; ++j) {
+    REAL4Sequence in = { .length = length, .data = input->data + j * length };
+    REAL4Sequence out = { .length = nmed, .data = medians->data + j * nmed };
+    XLAL_CHECK(XLALREAL4RunningMedian(&out, &in, blocksize) == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+  toc = XLALGetCPUTime();
+  const REAL8 theap = toc - tic;
+
+  tic = XLALGetCPUTime();
+  XLAL_CHECK(XLALREAL4RunningMedianBatch(medians, input, blocksize) == XLAL_SUCCESS, XLAL_EFUNC);
+  toc = XLALGetCPUTime();
+  const REAL8 tbatch = toc - tic;
+
+  XLALPrintInfo("blocksize=%-5u: LALSRunningMedian2 %8.3g s, XLALREAL4RunningMedian %8.3g s (speedup %5.2f), XLALREAL4RunningMedianBatch %8.3g s (speedup %5.2f)\n",
+                blocksize, tlist, theap, tlist / theap, tbatch, tlist / tbatch);
+
+  XLALDestroyREAL4VectorSequence(input);
+  XLALDestroyREAL4VectorSequence(medians);
+
+  return XLAL_SUCCESS;
+}
+
+int main(void)
+{
+  srand(1);
+
+  // even and odd blocksizes, including a block covering the whole input
+  const UINT4 blocksizes[] = { 3, 4, 5, 16, 50, 51, 100, 333, 1000 };
+  for (size_t i = 0; i < XLAL_NUM_ELEM(blocksizes); ++i) {
+    XLAL_CHECK_MAIN(test_running_median(2000, blocksizes[i]) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(test_running_median(blocksizes[i], blocksizes[i]) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(test_running_median_batch(13, 1500, blocksizes[i]) == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+
+  // blocksizes smaller than 3 are accepted
+  XLAL_CHECK_MAIN(test_running_median_batch(3, 10, 1) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(test_running_median_batch(3, 10, 2) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  // invalid blocksizes are rejected
+  {
+    REAL8Sequence *input = XLALCreateREAL8Vector(10);
+    REAL8Sequence *medians = XLALCreateREAL8Vector(10);
+    XLAL_CHECK_MAIN(input && medians, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(XLALREAL8RunningMedian(medians, input, 0) != XLAL_SUCCESS, XLAL_EFAILED, "Zero blocksize was accepted");
+    XLAL_CHECK_MAIN(XLALREAL8RunningMedian(medians, input, 3) != XLAL_SUCCESS, XLAL_EFAILED, "Wrong medians length was accepted");
+    XLAL_CHECK_MAIN(XLALREAL8RunningMedian(medians, input, 11) != XLAL_SUCCESS, XLAL_EFAILED, "Too large blocksize was accepted");
+    XLALClearErrno();
+    XLALDestroyREAL8Vector(input);
+    XLALDestroyREAL8Vector(medians);
+  }
+
+  // benchmark over typical blocksizes of SFT normalisation and median PSD estimation
+  const UINT4 benchsizes[] = { 50, 101, 200, 500, 1000 };
+  for (size_t i = 0; i < XLAL_NUM_ELEM(benchsizes); ++i) {
+    XLAL_CHECK_MAIN(benchmark_running_median(64, 20000, benchsizes[i]) == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
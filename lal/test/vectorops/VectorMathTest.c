@@ -38,6 +38,9 @@
 #define Relerr(dx,x) (fabsf(x)>0 ? fabsf((dx)/(x)) : fabsf(dx) )
 #define Relerrd(dx,x) (fabs(x)>0 ? fabs((dx)/(x)) : fabs(dx) )
 #define cRelerr(dx,x) (cabsf(x)>0 ? cabsf((dx)/(x)) : fabsf(dx) )
+// error in units of the ULP of max(|x|, floor); the floor keeps ULPs meaningful near zeros of the function
+#define ULPerr(dx,x,floor) ( (dx) / ( nextafterf ( fmaxf ( fabsf(x), (floor) ), INFINITY ) - fmaxf ( fabsf(x), (floor) ) ) )
+#define zRelerr(dx,x) (cabs(x)>0 ? cabs((dx)/(x)) : fabs(dx) )
 
 // ----- test and benchmark operators with 1 REAL4 vector input and 1 INT4 vector output (S2I) ----------
 #define TESTBENCH_VECTORMATH_S2I(name,in)                               \
@@ -64,18 +67,19 @@
       XLAL_CHECK ( XLALVector##name##REAL4( xOut, in, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
     }                                                                   \
     toc = XLALGetCPUTime();                                           \
-    maxErr = maxRelerr = 0;                                             \
+    maxErr = maxRelerr = maxULPerr = 0;                                 \
     for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
     {                                                                   \
       REAL4 err = fabsf ( xOut[i] - xOutRef[i] );                      \
       REAL4 relerr = Relerr ( err, xOutRef[i] );                       \
+      REAL4 ulperr = ULPerr ( err, xOutRef[i], ulpfloor );              \
       maxErr    = fmaxf ( err, maxErr );                                \
       maxRelerr = fmaxf ( relerr, maxRelerr );                          \
+      maxULPerr = fmaxf ( ulperr, maxULPerr );                          \
     }                                                                   \
-    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
-                    XLALVector##name##REAL4_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
-    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "REAL4", maxErr, abstol ); \
-    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "REAL4", maxRelerr, reltol ); \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g, maxRelerr = %7.2g, maxULPerr = %4.2f (tol=%4.2f)]\n", \
+                    XLALVector##name##REAL4_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, maxRelerr, maxULPerr, (ulptol) ); \
+    XLAL_CHECK ( (maxULPerr <= (ulptol)), XLAL_ETOL, "%s: error in ULPs (%g) exceeds tolerance (%g)\n", #name "REAL4", maxULPerr, ulptol ); \
   }
 
 #define TESTBENCH_VECTORMATH_S2SS(name,in)                              \
@@ -86,21 +90,24 @@
       XLAL_CHECK ( XLALVector##name##REAL4( xOut, xOut2, xIn, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
     }                                                                   \
     toc = XLALGetCPUTime();                                           \
-    maxErr = maxRelerr = 0;                                             \
+    maxErr = maxRelerr = maxULPerr = 0;                                 \
     for ( UINT4 i = 0; i < Ntrials; i ++ ) {                            \
       REAL4 err1 = fabsf ( xOut[i] - xOutRef[i] );                     \
       REAL4 err2 = fabsf ( xOut2[i] - xOutRef2[i] );                   \
       REAL4 relerr1 = Relerr ( err1, xOutRef[i] );                      \
       REAL4 relerr2 = Relerr ( err2, xOutRef2[i] );                    \
+      REAL4 ulperr1 = ULPerr ( err1, xOutRef[i], ulpfloor );            \
+      REAL4 ulperr2 = ULPerr ( err2, xOutRef2[i], ulpfloor );           \
       maxErr    = fmaxf ( err1, maxErr );                                \
       maxErr    = fmaxf ( err2, maxErr );                               \
       maxRelerr = fmaxf ( relerr1, maxRelerr );                          \
       maxRelerr = fmaxf ( relerr2, maxRelerr );                         \
+      maxULPerr = fmaxf ( ulperr1, maxULPerr );                         \
+      maxULPerr = fmaxf ( ulperr2, maxULPerr );                         \
     }                                                                   \
-    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
-                    XLALVector##name##REAL4_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, reltol ); \
-    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "REAL4", maxErr, abstol ); \
-    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "REAL4", maxRelerr, reltol ); \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g, maxRelerr = %7.2g, maxULPerr = %4.2f (tol=%4.2f)]\n", \
+                    XLALVector##name##REAL4_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, maxRelerr, maxULPerr, (ulptol) ); \
+    XLAL_CHECK ( (maxULPerr <= (ulptol)), XLAL_ETOL, "%s: error in ULPs (%g) exceeds tolerance (%g)\n", #name "REAL4", maxULPerr, ulptol ); \
   }
 
 
@@ -112,18 +119,19 @@
       XLAL_CHECK ( XLALVector##name##REAL4( xOut, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
     }                                                                   \
     toc = XLALGetCPUTime();                                             \
-    maxErr = maxRelerr = 0;                                             \
+    maxErr = maxRelerr = maxULPerr = 0;                                 \
     for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
     {                                                                   \
       REAL4 err = fabsf ( xOut[i] - xOutRef[i] );                      \
       REAL4 relerr = Relerr ( err, xOutRef[i] );                       \
+      REAL4 ulperr = ULPerr ( err, xOutRef[i], ulpfloor );              \
       maxErr    = fmaxf ( err, maxErr );                                \
       maxRelerr = fmaxf ( relerr, maxRelerr );                          \
+      maxULPerr = fmaxf ( ulperr, maxULPerr );                          \
     }                                                                   \
-    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
-                    XLALVector##name##REAL4_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
-    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "REAL4", maxErr, abstol ); \
-    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "REAL4", maxRelerr, reltol ); \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g, maxRelerr = %7.2g, maxULPerr = %4.2f (tol=%4.2f)]\n", \
+                    XLALVector##name##REAL4_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, maxRelerr, maxULPerr, (ulptol) ); \
+    XLAL_CHECK ( (maxULPerr <= (ulptol)), XLAL_ETOL, "%s: error in ULPs (%g) exceeds tolerance (%g)\n", #name "REAL4", maxULPerr, ulptol ); \
   }
 
 
@@ -200,8 +208,8 @@
     maxErr = maxRelerr = 0;                                             \
     for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
     {                                                                   \
-      REAL8 err = fabs ( xOut[i] - xOutRef[i] );                      \
-      REAL8 relerr = Relerrd ( err, xOutRef[i] );                       \
+      REAL8 err = fabs ( xOutD[i] - xOutRefD[i] );                    \
+      REAL8 relerr = Relerrd ( err, xOutRefD[i] );                     \
       maxErr    = fmax ( err, maxErr );                                \
       maxRelerr = fmax ( relerr, maxRelerr );                          \
     }                                                                   \
@@ -211,6 +219,78 @@
     XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "REAL8", maxRelerr, reltol ); \
   }
 
+// ----- test and benchmark operators with 1 REAL8 vector input and 2 REAL8 vector outputs (D2DD) ----------
+#define TESTBENCH_VECTORMATH_D2DD(name,in)                              \
+  {                                                                     \
+    XLAL_CHECK ( XLALVector##name##REAL8_GEN( xOutRefD, xOutRef2D, in, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##REAL8( xOutD, xOut2D, in, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    maxErr = maxRelerr = 0;                                             \
+    for ( UINT4 i = 0; i < Ntrials; i ++ ) {                            \
+      REAL8 err1 = fabs ( xOutD[i] - xOutRefD[i] );                     \
+      REAL8 err2 = fabs ( xOut2D[i] - xOutRef2D[i] );                   \
+      REAL8 relerr1 = Relerrd ( err1, xOutRefD[i] );                    \
+      REAL8 relerr2 = Relerrd ( err2, xOutRef2D[i] );                   \
+      maxErr    = fmax ( err1, maxErr );                                \
+      maxErr    = fmax ( err2, maxErr );                                \
+      maxRelerr = fmax ( relerr1, maxRelerr );                          \
+      maxRelerr = fmax ( relerr2, maxRelerr );                          \
+    }                                                                   \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##REAL8_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "REAL8", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "REAL8", maxRelerr, reltol ); \
+  }
+
+// ----- test and benchmark operators with 1 COMPLEX16 vector input and 1 COMPLEX16 vector output (Z2Z) ----------
+#define TESTBENCH_VECTORMATH_Z2Z(name,in)                               \
+  {                                                                     \
+    XLAL_CHECK ( XLALVector##name##COMPLEX16_GEN( xOutRefZ, in, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##COMPLEX16( xOutZ, in, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    maxErr = maxRelerr = 0;                                             \
+    for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
+    {                                                                   \
+      REAL8 err = cabs ( xOutZ[i] - xOutRefZ[i] );                      \
+      REAL8 relerr = zRelerr ( err, xOutRefZ[i] );                      \
+      maxErr    = fmax ( err, maxErr );                                 \
+      maxRelerr = fmax ( relerr, maxRelerr );                           \
+    }                                                                   \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##COMPLEX16_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxRelerr, reltol ); \
+  }
+
+// ----- test and benchmark operators with 2 REAL8 vector inputs and 1 COMPLEX16 vector output (DD2Z) ----------
+#define TESTBENCH_VECTORMATH_DD2Z(name,in1,in2)                         \
+  {                                                                     \
+    XLAL_CHECK ( XLALVector##name##COMPLEX16_GEN( xOutRefZ, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##COMPLEX16( xOutZ, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    maxErr = maxRelerr = 0;                                             \
+    for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
+    {                                                                   \
+      REAL8 err = cabs ( xOutZ[i] - xOutRefZ[i] );                      \
+      REAL8 relerr = zRelerr ( err, xOutRefZ[i] );                      \
+      maxErr    = fmax ( err, maxErr );                                 \
+      maxRelerr = fmax ( relerr, maxRelerr );                           \
+    }                                                                   \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##COMPLEX16_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxRelerr, reltol ); \
+  }
+
 // local types
 typedef struct
 {
@@ -276,17 +356,21 @@ main ( int argc, char *argv[] )
   REAL4 *xOutRef  = xOutRef_a->data;
   REAL4 *xOutRef2 = xOutRef2_a->data;
 
-  REAL8VectorAligned *xInD_a, *xIn2D_a, *xOutD_a, *xOutRefD_a;
+  REAL8VectorAligned *xInD_a, *xIn2D_a, *xOutD_a, *xOut2D_a, *xOutRefD_a, *xOutRef2D_a;
   XLAL_CHECK ( ( xInD_a   = XLALCreateREAL8VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
   XLAL_CHECK ( ( xIn2D_a  = XLALCreateREAL8VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
   XLAL_CHECK ( ( xOutD_a  = XLALCreateREAL8VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( ( xOut2D_a = XLALCreateREAL8VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
   XLAL_CHECK ( (xOutRefD_a= XLALCreateREAL8VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( (xOutRef2D_a= XLALCreateREAL8VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
 
   // extract aligned REAL8 vectors from these
   REAL8 *xInD      = xInD_a->data;
   REAL8 *xIn2D     = xIn2D_a->data;
   REAL8 *xOutD     = xOutD_a->data;
+  REAL8 *xOut2D    = xOut2D_a->data;
   REAL8 *xOutRefD  = xOutRefD_a->data;
+  REAL8 *xOutRef2D = xOutRef2D_a->data;
 
   COMPLEX8VectorAligned *xInC_a, *xIn2C_a, *xOutC_a, *xOutRefC_a;
   XLAL_CHECK ( ( xInC_a   = XLALCreateCOMPLEX8VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
@@ -300,14 +384,26 @@ main ( int argc, char *argv[] )
   COMPLEX8 *xOutC     = xOutC_a->data;
   COMPLEX8 *xOutRefC  = xOutRefC_a->data;
 
+  COMPLEX16VectorAligned *xInZ_a, *xOutZ_a, *xOutRefZ_a;
+  XLAL_CHECK ( ( xInZ_a   = XLALCreateCOMPLEX16VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( ( xOutZ_a  = XLALCreateCOMPLEX16VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( (xOutRefZ_a  = XLALCreateCOMPLEX16VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
+
+  // extract aligned COMPLEX16 vectors from these
+  COMPLEX16 *xInZ      = xInZ_a->data;
+  COMPLEX16 *xOutZ     = xOutZ_a->data;
+  COMPLEX16 *xOutRefZ  = xOutRefZ_a->data;
+
   REAL8 tic, toc;
-  REAL4 maxErr = 0, maxRelerr = 0;
+  REAL4 maxErr = 0, maxRelerr = 0, maxULPerr = 0;
   REAL4 abstol, reltol;
+  REAL4 ulptol, ulpfloor;
 
   for ( UINT4 i = 0; i < Ntrials; i ++ ) {
     xIn[i] = 2000 * ( frand() - 0.5 );
   }
-  abstol = 2e-7, reltol = 1e-5;
+  // errors near the zeros of sin/cos are measured in ULPs of 0.5
+  ulptol = 2, ulpfloor = 0.5;
 
   XLALPrintInfo ("Testing (INT4) for x in [-1000, 1000]\n");
   // ==================== (INT4) ====================
@@ -333,7 +429,7 @@ main ( int argc, char *argv[] )
     xIn[i] = 20 * ( frand() - 0.5 );
   }
 
-  abstol = 4e-3, reltol = 3e-7;
+  ulptol = 2, ulpfloor = 0;
   TESTBENCH_VECTORMATH_S2S(Exp,xIn);
 
   // ==================== LOG() ====================
@@ -341,10 +437,68 @@ main ( int argc, char *argv[] )
   for ( UINT4 i = 0; i < Ntrials; i ++ ) {
     xIn[i] = 10000.0f * frand() + 1e-6;
   } // for i < Ntrials
-  abstol = 2e-6, reltol = 2e-7;
+  ulptol = 2, ulpfloor = 0;
 
   TESTBENCH_VECTORMATH_S2S(Log,xIn);
 
+  // ==================== REAL8 SIN(),COS(),SINCOS() ====================
+  XLALPrintInfo ("\nTesting REAL8 sin(x), cos(x) for x in [-1000, 1000]\n");
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i] = 2000 * ( rand() / (REAL8)RAND_MAX - 0.5 );
+  }
+  abstol = 4e-16, reltol = 2e-15;
+
+  TESTBENCH_VECTORMATH_D2D(Sin,xInD);
+  TESTBENCH_VECTORMATH_D2D(Cos,xInD);
+  TESTBENCH_VECTORMATH_D2DD(SinCos,xInD);
+  TESTBENCH_VECTORMATH_D2DD(SinCos2Pi,xInD);
+
+  // ==================== REAL8 EXP() ====================
+  XLALPrintInfo ("\nTesting REAL8 exp(x) for x in [-10, 10]\n");
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i] = 20 * ( rand() / (REAL8)RAND_MAX - 0.5 );
+  }
+  abstol = 2e-11, reltol = 5e-16;
+
+  TESTBENCH_VECTORMATH_D2D(Exp,xInD);
+
+  // ==================== REAL8 LOG() ====================
+  XLALPrintInfo ("\nTesting REAL8 log(x) for x in (0, 10000]\n");
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i] = 10000.0 * ( rand() / (REAL8)RAND_MAX ) + 1e-6;
+  }
+  abstol = 4e-15, reltol = 5e-16;
+
+  TESTBENCH_VECTORMATH_D2D(Log,xInD);
+
+  // ==================== REAL8 ATAN2() ====================
+  XLALPrintInfo ("\nTesting REAL8 atan2(y,x) for x,y in [-1000, 1000]\n");
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i]  = 2000 * ( rand() / (REAL8)RAND_MAX - 0.5 );
+    xIn2D[i] = 2000 * ( rand() / (REAL8)RAND_MAX - 0.5 );
+  }
+  abstol = 1e-15, reltol = 5e-16;
+
+  TESTBENCH_VECTORMATH_DD2D(Atan2,xInD,xIn2D);
+
+  // ==================== COMPLEX16 EXP(),POLAR() ====================
+  XLALPrintInfo ("\nTesting COMPLEX16 exp(z) for re(z) in [-10, 10], im(z) in [-1000, 1000]\n");
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInZ[i] = 20 * ( rand() / (REAL8)RAND_MAX - 0.5 ) + 2000 * ( rand() / (REAL8)RAND_MAX - 0.5 ) * _Complex_I;
+  }
+  abstol = 4e-11, reltol = 1e-15;
+
+  TESTBENCH_VECTORMATH_Z2Z(Exp,xInZ);
+
+  XLALPrintInfo ("\nTesting COMPLEX16 polar(r,phi) for r in [0, 100], phi in [-1000, 1000]\n");
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i]  = 100 * ( rand() / (REAL8)RAND_MAX );
+    xIn2D[i] = 2000 * ( rand() / (REAL8)RAND_MAX - 0.5 );
+  }
+  abstol = 1e-13, reltol = 1e-15;
+
+  TESTBENCH_VECTORMATH_DD2Z(Polar,xInD,xIn2D);
+
   // ==================== ADD,MUL,ROUND ====================
   for ( UINT4 i = 0; i < Ntrials; i ++ ) {
     xIn[i]  = -10000.0f + 20000.0f * frand() + 1e-6;
@@ -354,6 +508,7 @@ main ( int argc, char *argv[] )
     xInC[i] = -10000.0f + 20000.0f * frand() + 1e-6 + ( -10000.0f + 20000.0f * frand() + 1e-6 ) * _Complex_I;
     xIn2C[i]= -10000.0f + 20000.0f * frand() + 1e-6 + ( -10000.0f + 20000.0f * frand() + 1e-6 ) * _Complex_I;
   } // for i < Ntrials
+  ulptol = 0, ulpfloor = 0;
   abstol = 2e-7, reltol = 2e-7;
 
   XLALPrintInfo ("\nTesting round(x) for x in (-10000, 10000]\n");
@@ -414,13 +569,19 @@ main ( int argc, char *argv[] )
   XLALDestroyREAL8VectorAligned ( xInD_a );
   XLALDestroyREAL8VectorAligned ( xIn2D_a );
   XLALDestroyREAL8VectorAligned ( xOutD_a );
+  XLALDestroyREAL8VectorAligned ( xOut2D_a );
   XLALDestroyREAL8VectorAligned ( xOutRefD_a );
+  XLALDestroyREAL8VectorAligned ( xOutRef2D_a );
 
   XLALDestroyCOMPLEX8VectorAligned ( xInC_a );
   XLALDestroyCOMPLEX8VectorAligned ( xIn2C_a );
   XLALDestroyCOMPLEX8VectorAligned ( xOutC_a );
   XLALDestroyCOMPLEX8VectorAligned ( xOutRefC_a );
 
+  XLALDestroyCOMPLEX16VectorAligned ( xInZ_a );
+  XLALDestroyCOMPLEX16VectorAligned ( xOutZ_a );
+  XLALDestroyCOMPLEX16VectorAligned ( xOutRefZ_a );
+
   XLALDestroyUserVars();
 
   LALCheckMemoryLeaks();
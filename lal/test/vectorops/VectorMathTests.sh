@@ -23,7 +23,7 @@ simd_machine=`${lal_simd_detect} | sed -n 4p`
 echo "$0: machine supports ${simd_machine}"
 
 # try to test these instruction sets
-simd_test="SSE AVX"
+simd_test="SSE SSE2 AVX AVX2 AVX512F"
 
 for simd in ${simd_test}; do
 
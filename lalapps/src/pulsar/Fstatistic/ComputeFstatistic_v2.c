@@ -1159,7 +1159,7 @@ InitFstat ( ConfigVariables *cfg, const UserInput_t *uvar )
   XLAL_CHECK ( chdir ( uvar->workingDir ) == 0, XLAL_EINVAL, "Unable to change directory to workinDir '%s'\n", uvar->workingDir );
 
   /* ----- set computational parameters for F-statistic from User-input ----- */
-  cfg->useResamp = ( uvar->FstatMethod >= FMETHOD_RESAMP_GENERIC ); // use resampling;
+  cfg->useResamp = ( uvar->FstatMethod == FMETHOD_RESAMP_GENERIC || uvar->FstatMethod == FMETHOD_RESAMP_BEST ); // use resampling;
 
   /* if IFO string vector was passed by user, parse it for later use */
   if ( uvar->IFOs != NULL ) {
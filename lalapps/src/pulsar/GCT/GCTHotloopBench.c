@@ -0,0 +1,254 @@
+/*
+ *  Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+/*
+ * Microbenchmark of the GCT fine-grid/coarse-grid summation hotloops.
+ *
+ * Replays a fine-grid/coarse-grid workload, either recorded by
+ * lalapps_HierarchSearchGCT --recordHotloopWorkload=<file>, or generated to
+ * resemble a typical search if no file is given, with each variant of the
+ * hotloops supported by this CPU (see gc_hotloop_select()). Coarse-grid 2F
+ * values are drawn from a chi^2 distribution with 4 degrees of freedom.
+ * Checks that all variants give results identical to the SSE2 hotloops, and
+ * prints the time taken and speedup of each variant.
+ *
+ * Usage: GCTHotloopBench [workload file]
+ */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LogPrintf.h>
+
+#include <gc_hotloop_sse2.h>
+
+#define NUM_SEGMENTS 44
+#define NUM_FINEGRID_POINTS 2000
+#define FREQLENGTH 1003
+#define NUM_FREQBINS 1200
+#define TWOF_THRESHOLD 5.2
+#define NUM_REPEATS 5
+
+/* one call of the hotloops: segment, coarse-grid frequency offset, coarse-grid and fine-grid lengths */
+typedef struct {
+  UINT4 k;
+  UINT4 U1idx;
+  UINT4 numFreqBins;
+  UINT4 freqlength;
+} WorkloadCall;
+
+typedef struct {
+  size_t length;
+  WorkloadCall *calls;
+  UINT4 numSegments;
+  UINT4 maxFreqBins;
+  UINT4 maxFreqlength;
+  REAL4 TwoFthreshold;
+} Workload;
+
+static int append_call ( Workload *workload, const WorkloadCall *call ) {
+  if ( ( workload->length & ( workload->length - 1 ) ) == 0 ) {
+    const size_t newLength = ( workload->length > 0 ) ? 2 * workload->length : 1024;
+    XLAL_CHECK ( ( workload->calls = XLALRealloc ( workload->calls, newLength * sizeof ( workload->calls[0] ) ) ) != NULL, XLAL_ENOMEM );
+  }
+  XLAL_CHECK ( call->U1idx + call->freqlength <= call->numFreqBins, XLAL_EINVAL, "Fine grid steps outside coarse grid" );
+  workload->calls[workload->length++] = *call;
+  if ( call->k + 1 > workload->numSegments ) {
+    workload->numSegments = call->k + 1;
+  }
+  if ( call->numFreqBins > workload->maxFreqBins ) {
+    workload->maxFreqBins = call->numFreqBins;
+  }
+  if ( call->freqlength > workload->maxFreqlength ) {
+    workload->maxFreqlength = call->freqlength;
+  }
+  return XLAL_SUCCESS;
+}
+
+/* read a workload recorded by lalapps_HierarchSearchGCT --recordHotloopWorkload */
+static int read_workload ( Workload *workload, const char *fname ) {
+  FILE *fp = fopen ( fname, "rb" );
+  XLAL_CHECK ( fp != NULL, XLAL_EIO, "Unable to open workload file '%s'", fname );
+  char line[256];
+  while ( fgets ( line, sizeof ( line ), fp ) != NULL ) {
+    if ( line[0] == '%' ) {
+      const char *thresh = strstr ( line, "TwoFthreshold=" );
+      if ( thresh != NULL ) {
+        workload->TwoFthreshold = atof ( thresh + strlen ( "TwoFthreshold=" ) );
+      }
+      continue;
+    }
+    WorkloadCall call;
+    if ( sscanf ( line, "%u %u %u %u", &call.k, &call.U1idx, &call.numFreqBins, &call.freqlength ) != 4 ) {
+      fclose ( fp );
+      XLAL_ERROR ( XLAL_EIO, "Invalid line in workload file '%s': %s", fname, line );
+    }
+    XLAL_CHECK ( append_call ( workload, &call ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+  fclose ( fp );
+  XLAL_CHECK ( workload->length > 0, XLAL_EIO, "Empty workload file '%s'", fname );
+  return XLAL_SUCCESS;
+}
+
+/* generate a workload like that of a search: for each fine-grid point, loop over segments, */
+/* with the fine grid mapped to a drifting offset into the coarse grid of each segment */
+static int generate_workload ( Workload *workload ) {
+  workload->TwoFthreshold = TWOF_THRESHOLD;
+  for ( UINT4 i = 0; i < NUM_FINEGRID_POINTS; i ++ ) {
+    for ( UINT4 k = 0; k < NUM_SEGMENTS; k ++ ) {
+      const INT4 drift = ( ( (INT4) ( i % 21 ) - 10 ) * ( (INT4) k - NUM_SEGMENTS / 2 ) ) / 8;
+      WorkloadCall call = { k, (UINT4) ( ( NUM_FREQBINS - FREQLENGTH ) / 2 + drift ), NUM_FREQBINS, FREQLENGTH };
+      XLAL_CHECK ( append_call ( workload, &call ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+  }
+  return XLAL_SUCCESS;
+}
+
+/* fine-grid output of the hotloops */
+typedef struct {
+  REAL4 *sumTwoF;
+  UCHAR *nc;
+  REAL4 *sumTwoFnonc;
+  REAL4 *sumTwoFmax;
+  REAL4 *maxTwoF;
+  UINT4 *maxTwoFIdx;
+} FineGridOutput;
+
+/* replay the workload with the given hotloops */
+static REAL8 replay_workload ( FineGridOutput *out, const GCHotloops *hotloops, const Workload *workload, REAL4 **cgrid2F ) {
+  const size_t len = workload->maxFreqlength;
+  const REAL8 tic = XLALGetTimeOfDay();
+  for ( UINT4 r = 0; r < NUM_REPEATS; r ++ ) {
+    for ( size_t i = 0; i < workload->length; i ++ ) {
+      const WorkloadCall *call = &workload->calls[i];
+      if ( call->k == 0 ) {
+        memset ( out->sumTwoF, 0, len * sizeof ( out->sumTwoF[0] ) );
+        memset ( out->nc, 0, len * sizeof ( out->nc[0] ) );
+        memset ( out->sumTwoFnonc, 0, len * sizeof ( out->sumTwoFnonc[0] ) );
+      }
+      REAL4 *cg2F = cgrid2F[call->k] + call->U1idx;
+      hotloops->hotloop ( out->sumTwoF, cg2F, out->nc, workload->TwoFthreshold, call->freqlength );
+      hotloops->hotloop_no_nc ( out->sumTwoFnonc, cg2F, call->freqlength );
+      hotloops->hotloop_2Fmax_tracking ( out->sumTwoFmax, out->maxTwoF, out->maxTwoFIdx, cg2F, call->k, call->freqlength );
+    }
+  }
+  return ( XLALGetTimeOfDay() - tic ) / NUM_REPEATS;
+}
+
+static int alloc_output ( FineGridOutput *out, const size_t len ) {
+  XLAL_CHECK ( ( out->sumTwoF = ALRealloc ( NULL, len * sizeof ( REAL4 ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK ( ( out->nc = ALRealloc ( NULL, len * sizeof ( UCHAR ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK ( ( out->sumTwoFnonc = ALRealloc ( NULL, len * sizeof ( REAL4 ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK ( ( out->sumTwoFmax = ALRealloc ( NULL, len * sizeof ( REAL4 ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK ( ( out->maxTwoF = ALRealloc ( NULL, len * sizeof ( REAL4 ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK ( ( out->maxTwoFIdx = ALRealloc ( NULL, len * sizeof ( UINT4 ) ) ) != NULL, XLAL_ENOMEM );
+  memset ( out->sumTwoF, 0, len * sizeof ( REAL4 ) );
+  memset ( out->nc, 0, len * sizeof ( UCHAR ) );
+  memset ( out->sumTwoFnonc, 0, len * sizeof ( REAL4 ) );
+  memset ( out->sumTwoFmax, 0, len * sizeof ( REAL4 ) );
+  memset ( out->maxTwoF, 0, len * sizeof ( REAL4 ) );
+  memset ( out->maxTwoFIdx, 0, len * sizeof ( UINT4 ) );
+  return XLAL_SUCCESS;
+}
+
+static void free_output ( FineGridOutput *out ) {
+  ALFree ( out->sumTwoF );
+  ALFree ( out->nc );
+  ALFree ( out->sumTwoFnonc );
+  ALFree ( out->sumTwoFmax );
+  ALFree ( out->maxTwoF );
+  ALFree ( out->maxTwoFIdx );
+}
+
+int main ( int argc, char *argv[] ) {
+
+  /* read or generate workload */
+  Workload workload;
+  memset ( &workload, 0, sizeof ( workload ) );
+  if ( argc > 1 ) {
+    XLAL_CHECK_MAIN ( read_workload ( &workload, argv[1] ) == XLAL_SUCCESS, XLAL_EFUNC );
+  } else {
+    XLAL_CHECK_MAIN ( generate_workload ( &workload ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+  XLAL_CHECK_MAIN ( workload.numSegments < 256, XLAL_EINVAL, "Number of segments %u would overflow number counts", workload.numSegments );
+  XLALPrintInfo ( "Workload: %zu calls over %u segments, up to %u fine-grid frequencies\n", workload.length, workload.numSegments, workload.maxFreqlength );
+
+  /* coarse-grid 2F values for each segment, chi^2-distributed with 4 degrees of freedom */
+  REAL4 **cgrid2F = XLALCalloc ( workload.numSegments, sizeof ( cgrid2F[0] ) );
+  XLAL_CHECK_MAIN ( cgrid2F != NULL, XLAL_ENOMEM );
+  srand ( 1 );
+  for ( UINT4 k = 0; k < workload.numSegments; k ++ ) {
+    XLAL_CHECK_MAIN ( ( cgrid2F[k] = XLALMalloc ( workload.maxFreqBins * sizeof ( cgrid2F[k][0] ) ) ) != NULL, XLAL_ENOMEM );
+    for ( UINT4 i = 0; i < workload.maxFreqBins; i ++ ) {
+      const REAL8 u1 = ( rand() + 1.0 ) / ( RAND_MAX + 2.0 ), u2 = ( rand() + 1.0 ) / ( RAND_MAX + 2.0 );
+      cgrid2F[k][i] = -2.0 * log ( u1 * u2 );
+    }
+  }
+
+  /* replay with each variant of the hotloops supported by this CPU */
+  const GCHotloops *variants[3];
+  size_t numVariants = 0;
+  variants[numVariants++] = &gc_hotloops_sse2;
+#ifdef HAVE_AVX2_COMPILER
+  if ( LAL_HAVE_AVX2_RUNTIME() ) {
+    variants[numVariants++] = &gc_hotloops_avx2;
+  }
+#endif
+#ifdef HAVE_AVX512F_COMPILER
+  if ( LAL_HAVE_AVX512F_RUNTIME() ) {
+    variants[numVariants++] = &gc_hotloops_avx512;
+  }
+#endif
+  XLALPrintInfo ( "Selected hotloops: %s\n", gc_hotloop_select()->name );
+
+  FineGridOutput ref, out;
+  XLAL_CHECK_MAIN ( alloc_output ( &ref, workload.maxFreqlength ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN ( alloc_output ( &out, workload.maxFreqlength ) == XLAL_SUCCESS, XLAL_EFUNC );
+  const REAL8 timeRef = replay_workload ( &ref, variants[0], &workload, cgrid2F );
+  XLALPrintInfo ( "%-8s hotloops: %8.3g s\n", variants[0]->name, timeRef );
+  for ( size_t v = 1; v < numVariants; v ++ ) {
+    const REAL8 time = replay_workload ( &out, variants[v], &workload, cgrid2F );
+    XLALPrintInfo ( "%-8s hotloops: %8.3g s, speedup %5.2f\n", variants[v]->name, time, timeRef / time );
+    const size_t len = workload.maxFreqlength;
+    XLAL_CHECK_MAIN ( memcmp ( out.sumTwoF, ref.sumTwoF, len * sizeof ( REAL4 ) ) == 0, XLAL_EFAILED, "%s: summed 2F differ from SSE2", variants[v]->name );
+    XLAL_CHECK_MAIN ( memcmp ( out.nc, ref.nc, len * sizeof ( UCHAR ) ) == 0, XLAL_EFAILED, "%s: number counts differ from SSE2", variants[v]->name );
+    XLAL_CHECK_MAIN ( memcmp ( out.sumTwoFnonc, ref.sumTwoFnonc, len * sizeof ( REAL4 ) ) == 0, XLAL_EFAILED, "%s: summed 2F (no number count) differ from SSE2", variants[v]->name );
+    XLAL_CHECK_MAIN ( memcmp ( out.sumTwoFmax, ref.sumTwoFmax, len * sizeof ( REAL4 ) ) == 0, XLAL_EFAILED, "%s: summed 2F (max tracking) differ from SSE2", variants[v]->name );
+    XLAL_CHECK_MAIN ( memcmp ( out.maxTwoF, ref.maxTwoF, len * sizeof ( REAL4 ) ) == 0, XLAL_EFAILED, "%s: maximum 2F differ from SSE2", variants[v]->name );
+    XLAL_CHECK_MAIN ( memcmp ( out.maxTwoFIdx, ref.maxTwoFIdx, len * sizeof ( UINT4 ) ) == 0, XLAL_EFAILED, "%s: segment of maximum 2F differ from SSE2", variants[v]->name );
+  }
+
+  free_output ( &ref );
+  free_output ( &out );
+  for ( UINT4 k = 0; k < workload.numSegments; k ++ ) {
+    XLALFree ( cgrid2F[k] );
+  }
+  XLALFree ( cgrid2F );
+  XLALFree ( workload.calls );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
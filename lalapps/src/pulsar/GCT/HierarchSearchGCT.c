@@ -355,6 +355,10 @@ int main( int argc, char *argv[]) {
   CHAR *fnameFstatVec1=NULL;
   FILE *fpFstat1=NULL;
 
+  /* file to record the fine-grid/coarse-grid summation workload into */
+  CHAR *uvar_recordHotloopWorkload = NULL;
+  FILE *fpHotloopWorkload=NULL;
+
   /* checkpoint filename */
   CHAR *uvar_fnameChkPoint = NULL;
 
@@ -537,6 +541,7 @@ int main( int argc, char *argv[]) {
   XLAL_CHECK_MAIN( XLALRegisterNamedUvar( &uvar_outputTimingDetails, "outputTimingDetails", STRING,       0,   DEVELOPER,  "Append detailed averaged F-stat timing information to this file") == XLAL_SUCCESS, XLAL_EFUNC);
 
   XLAL_CHECK_MAIN( XLALRegisterNamedUvar( &uvar_loudestTwoFPerSeg,   "loudestTwoFPerSeg",   BOOLEAN,      0, DEVELOPER, "Output loudest per-segment Fstat values into file '_loudestTwoFPerSeg'" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( XLALRegisterNamedUvar( &uvar_recordHotloopWorkload, "recordHotloopWorkload", STRING,   0, DEVELOPER, "Record the fine-grid/coarse-grid summation workload into this file, for replay by GCTHotloopBench" ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   /* inject signals into the data being analyzed */
   XLAL_CHECK_MAIN( XLALRegisterNamedUvar ( &uvar_injectionSources, "injectionSources",      STRINGVector, 0, DEVELOPER, "%s", InjectionSourcesHelpString) == XLAL_SUCCESS, XLAL_EFUNC );
@@ -726,6 +731,23 @@ int main( int argc, char *argv[]) {
       }
     }
 
+  if ( uvar_recordHotloopWorkload )
+    {
+      if ( !(fpHotloopWorkload = fopen( uvar_recordHotloopWorkload, "wb")))  {
+        fprintf ( stderr, "Unable to open hotloop workload file %s for writing.\n", uvar_recordHotloopWorkload );
+        return (HIERARCHICALSEARCH_EFILE);
+      }
+      fprintf ( fpHotloopWorkload, "%%%% GCT hotloop workload: one line per segment and fine-grid point\n" );
+      fprintf ( fpHotloopWorkload, "%%%% getMaxFperSeg=%d computeBSGL=%d TwoFthreshold=%.9g\n", uvar_getMaxFperSeg, uvar_computeBSGL, 2.0 * uvar_ThrF );
+      fprintf ( fpHotloopWorkload, "%%%% segment U1idx numFreqBins freqlength\n" );
+    }
+
+#ifdef GC_SSE2_OPT
+  /* select the fine-grid/coarse-grid summation hotloops for this CPU */
+  const GCHotloops *gcHotloops = gc_hotloop_select();
+  LogPrintf( LOG_DEBUG, "Using %s fine-grid summation hotloops\n", gcHotloops->name );
+#endif
+
   /*------------ Set up stacks, detector states etc. */
   /* initialize spin range vectors */
   XLAL_INIT_MEM( spinRange_Temp );
@@ -1610,6 +1632,10 @@ int main( int argc, char *argv[]) {
                 /* coarse grid over frequency for this stack */
                 REAL4 * cgrid2F = coarsegrid.TwoF + CG_INDEX(coarsegrid, k, U1idx);
 
+                if ( fpHotloopWorkload ) {
+                  fprintf ( fpHotloopWorkload, "%u %d %u %u\n", k, U1idx, Fstat_res->numFreqBins, finegrid.freqlength );
+                }
+
                 /* fine grid over frequency */
                 REAL4 * fgrid2F = finegrid.sumTwoF + FG_INDEX(finegrid, 0);
 #ifndef EXP_NO_NUM_COUNT
@@ -1622,12 +1648,12 @@ int main( int argc, char *argv[]) {
                   REAL4 * fgrid2Fmax = finegrid.maxTwoFl + FG_INDEX(finegrid, 0);
                   UINT4 * fgrid2FmaxIdx = finegrid.maxTwoFlIdx + FG_INDEX(finegrid, 0);
 
-                  gc_hotloop_2Fmax_tracking (fgrid2F, fgrid2Fmax, fgrid2FmaxIdx, cgrid2F, k, finegrid.freqlength);
+                  gcHotloops->hotloop_2Fmax_tracking (fgrid2F, fgrid2Fmax, fgrid2FmaxIdx, cgrid2F, k, finegrid.freqlength);
                 } else {
 #ifndef EXP_NO_NUM_COUNT
-                  gc_hotloop( fgrid2F, cgrid2F, fgridnc, TwoFthreshold, finegrid.freqlength );
+                  gcHotloops->hotloop( fgrid2F, cgrid2F, fgridnc, TwoFthreshold, finegrid.freqlength );
 #else
-                  gc_hotloop_no_nc ( fgrid2F, cgrid2F, finegrid.freqlength );
+                  gcHotloops->hotloop_no_nc ( fgrid2F, cgrid2F, finegrid.freqlength );
 #endif
 		}
                 if ( uvar_computeBSGL ) {
@@ -1639,9 +1665,9 @@ int main( int argc, char *argv[]) {
                       REAL4 * fgrid2FXmax = finegrid.maxTwoFXl + FG_FX_INDEX(finegrid,X, 0);
                       UINT4 * fgrid2FXmaxIdx = finegrid.maxTwoFXlIdx + FG_FX_INDEX(finegrid,X, 0);
 
-                      gc_hotloop_2Fmax_tracking (fgrid2FX, fgrid2FXmax, fgrid2FXmaxIdx, cgrid2FX, k, finegrid.freqlength  );
+                      gcHotloops->hotloop_2Fmax_tracking (fgrid2FX, fgrid2FXmax, fgrid2FXmaxIdx, cgrid2FX, k, finegrid.freqlength  );
                     } else {
-                      gc_hotloop_no_nc( fgrid2FX, cgrid2FX, finegrid.freqlength );
+                      gcHotloops->hotloop_no_nc( fgrid2FX, cgrid2FX, finegrid.freqlength );
                     }
                   } /* for  X  */
                 }
@@ -1945,6 +1971,10 @@ int main( int argc, char *argv[]) {
     LALFree( fnameFstatVec1 );
   }
 
+  if ( fpHotloopWorkload ) {
+    fclose(fpHotloopWorkload);
+  }
+
   if ( usefulParams.injectionSources ) {
     XLALDestroyPulsarParamsVector ( usefulParams.injectionSources );
   }
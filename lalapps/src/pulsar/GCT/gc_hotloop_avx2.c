@@ -0,0 +1,124 @@
+/*
+ *  Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+/*
+ * AVX2 versions of the fine-grid/coarse-grid hotloops in gc_hotloop_sse2.h,
+ * selected at runtime by gc_hotloop_select(). They compute exactly the same
+ * results as the SSE2 hotloops, but 8 coarse-grid points at a time, and use
+ * unaligned loads and stores throughout.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <math.h>
+#include <immintrin.h>
+
+#include <lal/LALDatatypes.h>
+
+void gc_hotloop_2Fmax_tracking_avx2 (REAL4 * fgrid2F, REAL4 * fgrid2Fmax, UINT4 * fgrid2FmaxIdx, REAL4 * cgrid2F, UINT4 k, UINT4 length );
+void gc_hotloop_avx2 (REAL4 * fgrid2F, REAL4 * cgrid2F, UCHAR * fgridnc, REAL4 TwoFthreshold, UINT4 length );
+void gc_hotloop_no_nc_avx2 (REAL4 * fgrid2F, REAL4 * cgrid2F, UINT4 length );
+
+void gc_hotloop_2Fmax_tracking_avx2 (REAL4 * fgrid2F, REAL4 * fgrid2Fmax, UINT4 * fgrid2FmaxIdx, REAL4 * cgrid2F, UINT4 k, UINT4 length ) {
+
+  UINT4 ifreq_fg = 0;
+  int newMax;
+
+  /* first segment: copy the coarse grid into the fine grid, see gc_hotloop_2Fmax_tracking() */
+  if(k==0) {
+    memcpy(fgrid2F,cgrid2F,sizeof(REAL4)*length);
+    memcpy(fgrid2Fmax,cgrid2F,sizeof(REAL4)*length);
+    memset(fgrid2FmaxIdx,0,sizeof(UINT4)*length);
+    return;
+  }
+
+  const __m256i Vk = _mm256_set1_epi32(k);
+
+  for( ; ifreq_fg + 8 <= length; ifreq_fg += 8 ) {
+    const __m256 cg2F = _mm256_loadu_ps(cgrid2F + ifreq_fg);
+    const __m256 fg2Fmax = _mm256_loadu_ps(fgrid2Fmax + ifreq_fg);
+
+    /* -1 if previous 2Fmax is <= coarse grid value */
+    const __m256 mask = _mm256_cmp_ps(fg2Fmax, cg2F, _CMP_LE_OS);
+
+    _mm256_storeu_ps(fgrid2F + ifreq_fg, _mm256_add_ps(_mm256_loadu_ps(fgrid2F + ifreq_fg), cg2F));
+    _mm256_storeu_ps(fgrid2Fmax + ifreq_fg, _mm256_blendv_ps(fg2Fmax, cg2F, mask));
+    const __m256i fg2FmaxIdx = _mm256_loadu_si256((const __m256i *)(fgrid2FmaxIdx + ifreq_fg));
+    _mm256_storeu_si256((__m256i *)(fgrid2FmaxIdx + ifreq_fg), _mm256_blendv_epi8(fg2FmaxIdx, Vk, _mm256_castps_si256(mask)));
+  }
+
+  /* take care of remaining iterations, length modulo 8 */
+  for( ; ifreq_fg < length; ifreq_fg++ ) {
+    fgrid2F[ifreq_fg] += cgrid2F[ifreq_fg];
+    newMax=(cgrid2F[ifreq_fg] >= fgrid2Fmax[ifreq_fg]);
+    fgrid2Fmax[ifreq_fg]=fmaxf(fgrid2Fmax[ifreq_fg],cgrid2F[ifreq_fg]);
+    fgrid2FmaxIdx[ifreq_fg]=fgrid2FmaxIdx[ifreq_fg]*(1-newMax)+k*newMax;
+  }
+
+}
+
+void gc_hotloop_avx2 (REAL4 * fgrid2F, REAL4 * cgrid2F, UCHAR * fgridnc, REAL4 TwoFthreshold, UINT4 length ) {
+
+  UINT4 ifreq_fg = 0;
+
+  const __m256 Vthresh2F = _mm256_set1_ps(TwoFthreshold);
+
+  for( ; ifreq_fg + 16 <= length; ifreq_fg += 16 ) {
+    const __m256 cg2F0 = _mm256_loadu_ps(cgrid2F + ifreq_fg);
+    const __m256 cg2F1 = _mm256_loadu_ps(cgrid2F + ifreq_fg + 8);
+
+    _mm256_storeu_ps(fgrid2F + ifreq_fg, _mm256_add_ps(_mm256_loadu_ps(fgrid2F + ifreq_fg), cg2F0));
+    _mm256_storeu_ps(fgrid2F + ifreq_fg + 8, _mm256_add_ps(_mm256_loadu_ps(fgrid2F + ifreq_fg + 8), cg2F1));
+
+    /* compare the coarse grid 2F values to the threshold, as in the SSE2 hotloop: 16 x (0/-1) */
+    const __m256i mask0 = _mm256_castps_si256(_mm256_cmp_ps(Vthresh2F, cg2F0, _CMP_LE_OS));
+    const __m256i mask1 = _mm256_castps_si256(_mm256_cmp_ps(Vthresh2F, cg2F1, _CMP_LE_OS));
+
+    /* pack to 16 bytes of 0/-1; PACKSSDW works within 128-bit lanes, so restore the order of the quadwords */
+    const __m256i mask01 = _mm256_permute4x64_epi64(_mm256_packs_epi32(mask0, mask1), 0xD8);
+    const __m128i mask = _mm_packs_epi16(_mm256_castsi256_si128(mask01), _mm256_extracti128_si256(mask01, 1));
+
+    /* subtract from the number counts to increment them where the threshold was reached */
+    const __m128i fgnc = _mm_loadu_si128((const __m128i *)(fgridnc + ifreq_fg));
+    _mm_storeu_si128((__m128i *)(fgridnc + ifreq_fg), _mm_sub_epi8(fgnc, mask));
+  }
+
+  /* take care of remaining iterations, length modulo 16 */
+  for( ; ifreq_fg < length; ifreq_fg++ ) {
+    fgrid2F[ifreq_fg] += cgrid2F[ifreq_fg];
+    fgridnc[ifreq_fg] += (TwoFthreshold < cgrid2F[ifreq_fg]);
+  }
+
+}
+
+void gc_hotloop_no_nc_avx2 (REAL4 * fgrid2F, REAL4 * cgrid2F, UINT4 length ) {
+
+  UINT4 ifreq_fg = 0;
+
+  for( ; ifreq_fg + 8 <= length; ifreq_fg += 8 ) {
+    _mm256_storeu_ps(fgrid2F + ifreq_fg, _mm256_add_ps(_mm256_loadu_ps(fgrid2F + ifreq_fg), _mm256_loadu_ps(cgrid2F + ifreq_fg)));
+  }
+
+  /* take care of remaining iterations, length modulo 8 */
+  for( ; ifreq_fg < length; ifreq_fg++ ) {
+    fgrid2F[ifreq_fg] += cgrid2F[ifreq_fg];
+  }
+
+}
@@ -0,0 +1,119 @@
+/*
+ *  Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+/*
+ * AVX-512 versions of the fine-grid/coarse-grid hotloops in gc_hotloop_sse2.h,
+ * selected at runtime by gc_hotloop_select(). They compute exactly the same
+ * results as the SSE2 hotloops, but 16 coarse-grid points at a time using
+ * comparison masks; only AVX-512F instructions are used.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <math.h>
+#include <immintrin.h>
+
+#include <lal/LALDatatypes.h>
+
+void gc_hotloop_2Fmax_tracking_avx512 (REAL4 * fgrid2F, REAL4 * fgrid2Fmax, UINT4 * fgrid2FmaxIdx, REAL4 * cgrid2F, UINT4 k, UINT4 length );
+void gc_hotloop_avx512 (REAL4 * fgrid2F, REAL4 * cgrid2F, UCHAR * fgridnc, REAL4 TwoFthreshold, UINT4 length );
+void gc_hotloop_no_nc_avx512 (REAL4 * fgrid2F, REAL4 * cgrid2F, UINT4 length );
+
+void gc_hotloop_2Fmax_tracking_avx512 (REAL4 * fgrid2F, REAL4 * fgrid2Fmax, UINT4 * fgrid2FmaxIdx, REAL4 * cgrid2F, UINT4 k, UINT4 length ) {
+
+  UINT4 ifreq_fg = 0;
+  int newMax;
+
+  /* first segment: copy the coarse grid into the fine grid, see gc_hotloop_2Fmax_tracking() */
+  if(k==0) {
+    memcpy(fgrid2F,cgrid2F,sizeof(REAL4)*length);
+    memcpy(fgrid2Fmax,cgrid2F,sizeof(REAL4)*length);
+    memset(fgrid2FmaxIdx,0,sizeof(UINT4)*length);
+    return;
+  }
+
+  const __m512i Vk = _mm512_set1_epi32(k);
+
+  for( ; ifreq_fg + 16 <= length; ifreq_fg += 16 ) {
+    const __m512 cg2F = _mm512_loadu_ps(cgrid2F + ifreq_fg);
+    const __m512 fg2Fmax = _mm512_loadu_ps(fgrid2Fmax + ifreq_fg);
+
+    /* set if previous 2Fmax is <= coarse grid value */
+    const __mmask16 mask = _mm512_cmp_ps_mask(fg2Fmax, cg2F, _CMP_LE_OS);
+
+    _mm512_storeu_ps(fgrid2F + ifreq_fg, _mm512_add_ps(_mm512_loadu_ps(fgrid2F + ifreq_fg), cg2F));
+    _mm512_storeu_ps(fgrid2Fmax + ifreq_fg, _mm512_mask_blend_ps(mask, fg2Fmax, cg2F));
+    const __m512i fg2FmaxIdx = _mm512_loadu_si512(fgrid2FmaxIdx + ifreq_fg);
+    _mm512_storeu_si512(fgrid2FmaxIdx + ifreq_fg, _mm512_mask_blend_epi32(mask, fg2FmaxIdx, Vk));
+  }
+
+  /* take care of remaining iterations, length modulo 16 */
+  for( ; ifreq_fg < length; ifreq_fg++ ) {
+    fgrid2F[ifreq_fg] += cgrid2F[ifreq_fg];
+    newMax=(cgrid2F[ifreq_fg] >= fgrid2Fmax[ifreq_fg]);
+    fgrid2Fmax[ifreq_fg]=fmaxf(fgrid2Fmax[ifreq_fg],cgrid2F[ifreq_fg]);
+    fgrid2FmaxIdx[ifreq_fg]=fgrid2FmaxIdx[ifreq_fg]*(1-newMax)+k*newMax;
+  }
+
+}
+
+void gc_hotloop_avx512 (REAL4 * fgrid2F, REAL4 * cgrid2F, UCHAR * fgridnc, REAL4 TwoFthreshold, UINT4 length ) {
+
+  UINT4 ifreq_fg = 0;
+
+  const __m512 Vthresh2F = _mm512_set1_ps(TwoFthreshold);
+  const __m512i V1 = _mm512_set1_epi32(1);
+
+  for( ; ifreq_fg + 16 <= length; ifreq_fg += 16 ) {
+    const __m512 cg2F = _mm512_loadu_ps(cgrid2F + ifreq_fg);
+
+    _mm512_storeu_ps(fgrid2F + ifreq_fg, _mm512_add_ps(_mm512_loadu_ps(fgrid2F + ifreq_fg), cg2F));
+
+    /* compare the coarse grid 2F values to the threshold, as in the SSE2 hotloop, */
+    /* and narrow the 16 increments of 0/1 to bytes */
+    const __mmask16 mask = _mm512_cmp_ps_mask(Vthresh2F, cg2F, _CMP_LE_OS);
+    const __m128i incr = _mm512_cvtepi32_epi8(_mm512_maskz_mov_epi32(mask, V1));
+
+    const __m128i fgnc = _mm_loadu_si128((const __m128i *)(fgridnc + ifreq_fg));
+    _mm_storeu_si128((__m128i *)(fgridnc + ifreq_fg), _mm_add_epi8(fgnc, incr));
+  }
+
+  /* take care of remaining iterations, length modulo 16 */
+  for( ; ifreq_fg < length; ifreq_fg++ ) {
+    fgrid2F[ifreq_fg] += cgrid2F[ifreq_fg];
+    fgridnc[ifreq_fg] += (TwoFthreshold < cgrid2F[ifreq_fg]);
+  }
+
+}
+
+void gc_hotloop_no_nc_avx512 (REAL4 * fgrid2F, REAL4 * cgrid2F, UINT4 length ) {
+
+  UINT4 ifreq_fg = 0;
+
+  for( ; ifreq_fg + 16 <= length; ifreq_fg += 16 ) {
+    _mm512_storeu_ps(fgrid2F + ifreq_fg, _mm512_add_ps(_mm512_loadu_ps(fgrid2F + ifreq_fg), _mm512_loadu_ps(cgrid2F + ifreq_fg)));
+  }
+
+  /* take care of remaining iterations, length modulo 16 */
+  for( ; ifreq_fg < length; ifreq_fg++ ) {
+    fgrid2F[ifreq_fg] += cgrid2F[ifreq_fg];
+  }
+
+}
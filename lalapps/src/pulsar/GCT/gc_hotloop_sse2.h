@@ -450,3 +450,53 @@ for( ifreq_fg=0 ; ifreq_fg +16 < length; ifreq_fg+=16 ) {
   } /* for( ifreq_fg = 0; ifreq_fg < finegrid.freqlength; ifreq_fg++ ) { */
 
 }
+
+
+
+/* ---------- runtime selection of the hotloops ---------- */
+
+/* AVX2 and AVX-512 versions of the hotloops above, in gc_hotloop_avx2.c and gc_hotloop_avx512.c */
+#include <lal/LALSIMD.h>
+
+#ifdef HAVE_AVX2_COMPILER
+void gc_hotloop_2Fmax_tracking_avx2 (REAL4 * fgrid2F, REAL4 * fgrid2Fmax, UINT4 * fgrid2FmaxIdx, REAL4 * cgrid2F, UINT4 k, UINT4 length );
+void gc_hotloop_avx2 (REAL4 * fgrid2F, REAL4 * cgrid2F, UCHAR * fgridnc, REAL4 TwoFthreshold, UINT4 length );
+void gc_hotloop_no_nc_avx2 (REAL4 * fgrid2F, REAL4 * cgrid2F, UINT4 length );
+#endif
+#ifdef HAVE_AVX512F_COMPILER
+void gc_hotloop_2Fmax_tracking_avx512 (REAL4 * fgrid2F, REAL4 * fgrid2Fmax, UINT4 * fgrid2FmaxIdx, REAL4 * cgrid2F, UINT4 k, UINT4 length );
+void gc_hotloop_avx512 (REAL4 * fgrid2F, REAL4 * cgrid2F, UCHAR * fgridnc, REAL4 TwoFthreshold, UINT4 length );
+void gc_hotloop_no_nc_avx512 (REAL4 * fgrid2F, REAL4 * cgrid2F, UINT4 length );
+#endif
+
+/* set of hotloops for one instruction set */
+typedef struct tagGCHotloops {
+  const char *name;
+  void (*hotloop_2Fmax_tracking) (REAL4 * fgrid2F, REAL4 * fgrid2Fmax, UINT4 * fgrid2FmaxIdx, REAL4 * cgrid2F, UINT4 k, UINT4 length );
+  void (*hotloop) (REAL4 * fgrid2F, REAL4 * cgrid2F, UCHAR * fgridnc, REAL4 TwoFthreshold, UINT4 length );
+  void (*hotloop_no_nc) (REAL4 * fgrid2F, REAL4 * cgrid2F, UINT4 length );
+} GCHotloops;
+
+static const GCHotloops gc_hotloops_sse2 = { "SSE2", gc_hotloop_2Fmax_tracking, gc_hotloop, gc_hotloop_no_nc };
+#ifdef HAVE_AVX2_COMPILER
+static const GCHotloops gc_hotloops_avx2 = { "AVX2", gc_hotloop_2Fmax_tracking_avx2, gc_hotloop_avx2, gc_hotloop_no_nc_avx2 };
+#endif
+#ifdef HAVE_AVX512F_COMPILER
+static const GCHotloops gc_hotloops_avx512 = { "AVX-512", gc_hotloop_2Fmax_tracking_avx512, gc_hotloop_avx512, gc_hotloop_no_nc_avx512 };
+#endif
+
+/* select the hotloops for the widest instruction set supported by both compiler and CPU;
+   all variants compute identical results */
+static inline const GCHotloops *gc_hotloop_select ( void ) {
+#ifdef HAVE_AVX512F_COMPILER
+  if ( LAL_HAVE_AVX512F_RUNTIME() ) {
+    return &gc_hotloops_avx512;
+  }
+#endif
+#ifdef HAVE_AVX2_COMPILER
+  if ( LAL_HAVE_AVX2_RUNTIME() ) {
+    return &gc_hotloops_avx2;
+  }
+#endif
+  return &gc_hotloops_sse2;
+}
@@ -150,6 +150,7 @@ void initialise_algorithm( LALInferenceRunState *runState )
   runState->proposalArgs = XLALCalloc( 1, sizeof(LALInferenceVariables) );
   /* Initialise threads - single thread */
   runState->threads = LALInferenceInitThreads(1);
+  runState->nthreads = 1;
 
   ppt = LALInferenceGetProcParamVal( commandLine, "--verbose" );
   if( ppt ) {
@@ -28,6 +28,15 @@
 #include <lal/LALHashTbl.h>
 #include <lal/LALBitset.h>
 
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#define CACHE_LOCK( cache )   pthread_mutex_lock( &( cache )->lock )
+#define CACHE_UNLOCK( cache ) pthread_mutex_unlock( &( cache )->lock )
+#else
+#define CACHE_LOCK( cache )   do { } while(0)
+#define CACHE_UNLOCK( cache ) do { } while(0)
+#endif
+
 // Compare two quantities, and return a sort order value if they are unequal
 #define COMPARE_BY( x, y ) do { if ( (x) < (y) ) return -1; if ( (x) > (y) ) return +1; } while(0)
 
@@ -97,8 +106,24 @@ struct tagWeaveCacheQueries {
   double semi_relevance_offset;
   /// Number of semicoherent templates (over all queries)
   UINT8 semi_ntmpl;
+  /// Index of the worker thread making the queries
+  UINT4 worker;
 };
 
+///
+/// State of a worker thread using a cache
+///
+typedef struct {
+  /// Generation of cache items computed for the partition being searched by the worker thread
+  UINT4 generation;
+  /// Relevance of the worker thread's current semicoherent point, below which its items may be discarded
+  REAL4 relevance;
+  /// Cache item whose results the worker thread is currently using
+  cache_item *pinned;
+  /// Whether the pinned item has been removed from the cache, and must be destroyed once unpinned
+  BOOLEAN orphaned;
+} cache_worker;
+
 ///
 /// Cache used to store coherent results
 ///
@@ -117,7 +142,7 @@ struct tagWeaveCache {
   LatticeTilingLocator *coh_locator;
   /// Maximum value of index from coherent locator
   UINT8 coh_max_index;
-  /// Current generation of cache items
+  /// Next generation of cache items
   UINT4 generation;
   /// Heap which ranks cache items by relevance
   LALHeap *relevance_heap;
@@ -125,6 +150,12 @@ struct tagWeaveCache {
   UINT4 heap_max_size;
   /// Hash table which looks up cache items by index
   LALHashTbl *coh_index_hash;
+  /// Save an no-longer-used cache item for re-use
+  cache_item *saved_item;
+  /// Number of worker threads using the cache
+  UINT4 nworkers;
+  /// State of each worker thread using the cache
+  cache_worker *workers;
   /// Bitset which records whether an item has ever been computed
   LALBitset *coh_computed_bitset;
   /// Offset used in computation of coherent point relevance
@@ -133,8 +164,10 @@ struct tagWeaveCache {
   BOOLEAN any_gc;
   /// Whether garbage collection should remove as many results as possible
   BOOLEAN all_gc;
-  /// Save an no-longer-used cache item for re-use
-  cache_item *saved_item;
+#ifdef LAL_PTHREAD_LOCK
+  /// Lock which serialises use of the cache by worker threads
+  pthread_mutex_t lock;
+#endif
 };
 
 ///
@@ -148,6 +181,10 @@ static UINT8 cache_item_hash( const void *x );
 static int cache_item_compare_by_coh_index( const void *x, const void *y );
 static int cache_item_compare_by_relevance( const void *x, const void *y );
 static void cache_item_destroy( void *x );
+static BOOLEAN cache_item_is_irrelevant( const WeaveCache *cache, const cache_item *item );
+static cache_item *cache_item_release( WeaveCache *cache, cache_item *item );
+static void cache_item_recycle( WeaveCache *cache, cache_item *item );
+static int cache_add_item( WeaveCache *cache, cache_worker *worker, cache_item *new_item, const UINT8 coh_bitset_index );
 
 /// @}
 
@@ -165,6 +202,58 @@ void cache_item_destroy(
   }
 }
 
+///
+/// Decide whether a cache item can be discarded: either the worker thread which computed it has moved
+/// on to another partition, or its relevance has fallen below that of the worker thread's current point
+///
+BOOLEAN cache_item_is_irrelevant(
+  const WeaveCache *cache,
+  const cache_item *item
+  )
+{
+  for ( size_t w = 0; w < cache->nworkers; ++w ) {
+    if ( cache->workers[w].generation == item->generation ) {
+      return item->relevance < cache->workers[w].relevance;
+    }
+  }
+  return 1;
+}
+
+///
+/// Release a cache item which has been removed from the cache; if a worker thread is still using its
+/// results, it is destroyed when the worker thread unpins it, otherwise it is returned for re-use
+///
+cache_item *cache_item_release(
+  WeaveCache *cache,
+  cache_item *item
+  )
+{
+  for ( size_t w = 0; w < cache->nworkers; ++w ) {
+    if ( cache->workers[w].pinned == item ) {
+      cache->workers[w].orphaned = 1;
+      return NULL;
+    }
+  }
+  return item;
+}
+
+///
+/// Save a no-longer-used cache item for re-use, or destroy it
+///
+void cache_item_recycle(
+  WeaveCache *cache,
+  cache_item *item
+  )
+{
+  if ( item != NULL ) {
+    if ( cache->saved_item == NULL ) {
+      cache->saved_item = item;
+    } else {
+      cache_item_destroy( item );
+    }
+  }
+}
+
 ///
 /// Compare cache items by generation, then relevance
 ///
@@ -307,7 +396,8 @@ WeaveCacheQueries *XLALWeaveCacheQueriesCreate(
   const SuperskyTransformData *semi_rssky_transf,
   const double dfreq,
   const UINT4 nqueries,
-  const UINT4 nfreq_partitions
+  const UINT4 nfreq_partitions,
+  const UINT4 worker
   )
 {
 
@@ -344,6 +434,7 @@ WeaveCacheQueries *XLALWeaveCacheQueriesCreate(
   queries->dfreq = dfreq;
   queries->nqueries = nqueries;
   queries->nfreq_partitions = nfreq_partitions;
+  queries->worker = worker;
 
   // Get number of parameter-space dimensions
   queries->ndim = XLALTotalLatticeTilingDimensions( semi_tiling );
@@ -610,6 +701,32 @@ int XLALWeaveCacheQueriesGetCounts(
 
 }
 
+///
+/// Add number of computed coherent results, and number of coherent and semicoherent templates,
+/// from a series of cache queries made by another worker thread
+///
+int XLALWeaveCacheQueriesAddCounts(
+  WeaveCacheQueries *queries,
+  const WeaveCacheQueries *worker_queries
+  )
+{
+
+  // Check input
+  XLAL_CHECK( queries != NULL, XLAL_EFAULT );
+  XLAL_CHECK( worker_queries != NULL, XLAL_EFAULT );
+  XLAL_CHECK( queries->nqueries == worker_queries->nqueries, XLAL_ESIZE );
+
+  // Add number of computed coherent results, and number of coherent and semicoherent templates
+  for ( size_t i = 0; i < queries->nqueries; ++i ) {
+    queries->coh_nres[i] += worker_queries->coh_nres[i];
+    queries->coh_ntmpl[i] += worker_queries->coh_ntmpl[i];
+  }
+  queries->semi_ntmpl += worker_queries->semi_ntmpl;
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Create a cache
 ///
@@ -620,23 +737,37 @@ WeaveCache *XLALWeaveCacheCreate(
   const SuperskyTransformData *semi_rssky_transf,
   WeaveCohInput *coh_input,
   const UINT4 max_size,
-  const BOOLEAN all_gc
+  const BOOLEAN all_gc,
+  const UINT4 nworkers
   )
 {
 
   // Check input
   XLAL_CHECK_NULL( coh_tiling != NULL, XLAL_EFAULT );
   XLAL_CHECK_NULL( coh_input != NULL, XLAL_EFAULT );
+  XLAL_CHECK_NULL( nworkers > 0, XLAL_EINVAL );
+#ifndef LAL_PTHREAD_LOCK
+  XLAL_CHECK_NULL( nworkers == 1, XLAL_EINVAL, "LAL was not compiled with thread support" );
+#endif
 
   // Allocate memory
   WeaveCache *cache = XLALCalloc( 1, sizeof( *cache ) );
   XLAL_CHECK_NULL( cache != NULL, XLAL_ENOMEM );
+  cache->workers = XLALCalloc( nworkers, sizeof( *cache->workers ) );
+  XLAL_CHECK_NULL( cache->workers != NULL, XLAL_ENOMEM );
+#ifdef LAL_PTHREAD_LOCK
+  XLAL_CHECK_NULL( pthread_mutex_init( &cache->lock, NULL ) == 0, XLAL_ESYS );
+#endif
 
   // Set fields
   cache->coh_rssky_transf = coh_rssky_transf;
   cache->semi_rssky_transf = semi_rssky_transf;
   cache->coh_input = coh_input;
-  cache->generation = 0;
+  cache->nworkers = nworkers;
+  for ( size_t w = 0; w < nworkers; ++w ) {
+    cache->workers[w].generation = cache->generation++;
+    cache->workers[w].relevance = GSL_NEGINF;
+  }
 
   // Set garbage collection mode:
   // - Garbage collection is not performed for a fixed-size cache (i.e. 'max_size > 0'),
@@ -744,6 +875,13 @@ WeaveCache *XLALWeaveCacheCreate(
   // by the current point semicoherent in the semicoherent parameter-space tiling.
   //
   // Items removed from the heap are destroyed by calling cache_item_destroy().
+  //
+  // Worker threads search different partitions of the semicoherent parameter space concurrently,
+  // and share the relevance heap and index hash table. Since cache items are expired whenever a worker
+  // thread moves to a new partition, each partition is given its own generation of cache items, and
+  // an item is only compared against the relevance of the current point of the worker thread searching
+  // its partition; see cache_item_is_irrelevant(). Items whose results are still being used by a worker
+  // thread are never re-used or destroyed, even if they are removed from the cache by another thread.
   cache->relevance_heap = XLALHeapCreate( cache_item_destroy, max_size, -1, cache_item_compare_by_relevance );
   XLAL_CHECK_NULL( cache->relevance_heap != NULL, XLAL_EFUNC );
 
@@ -772,6 +910,17 @@ void XLALWeaveCacheDestroy(
     XLALHeapDestroy( cache->relevance_heap );
     XLALHashTblDestroy( cache->coh_index_hash );
     cache_item_destroy( cache->saved_item );
+    if ( cache->workers != NULL ) {
+      for ( size_t w = 0; w < cache->nworkers; ++w ) {
+        if ( cache->workers[w].orphaned ) {
+          cache_item_destroy( cache->workers[w].pinned );
+        }
+      }
+      XLALFree( cache->workers );
+#ifdef LAL_PTHREAD_LOCK
+      pthread_mutex_destroy( &cache->lock );
+#endif
+    }
     XLALBitsetDestroy( cache->coh_computed_bitset );
     XLALFree( cache );
   }
@@ -806,19 +955,24 @@ int XLALWeaveCacheWriteInfo(
 }
 
 ///
-/// Expire all items in the cache
+/// Expire all items in the cache computed by a worker thread, when it moves to a new partition
 ///
 int XLALWeaveCacheExpire(
-  WeaveCache *cache
+  WeaveCache *cache,
+  const UINT4 worker
   )
 {
 
   // Check input
   XLAL_CHECK( cache != NULL, XLAL_EFAULT );
+  XLAL_CHECK( worker < cache->nworkers, XLAL_EINVAL );
 
-  // Advance current generation of cache items
+  // Give the worker thread a new generation of cache items
   // - Existing items will no longer be accessible, but are still kept for reuse
-  ++cache->generation;
+  CACHE_LOCK( cache );
+  cache->workers[worker].generation = cache->generation++;
+  cache->workers[worker].relevance = GSL_NEGINF;
+  CACHE_UNLOCK( cache );
 
   return XLAL_SUCCESS;
 
@@ -835,17 +989,122 @@ int XLALWeaveCacheClear(
   // Check input
   XLAL_CHECK( cache != NULL, XLAL_EFAULT );
 
+  // Unpin items used by worker threads, destroying any already removed from the cache
+  for ( size_t w = 0; w < cache->nworkers; ++w ) {
+    if ( cache->workers[w].orphaned ) {
+      cache_item_destroy( cache->workers[w].pinned );
+    }
+    cache->workers[w].pinned = NULL;
+    cache->workers[w].orphaned = 0;
+  }
+
   // Clear items in the relevance heap and hash table from memory
   XLAL_CHECK( XLALHeapClear( cache->relevance_heap ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK( XLALHashTblClear( cache->coh_index_hash ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   // Reset current generation of cache items
   cache->generation = 0;
+  for ( size_t w = 0; w < cache->nworkers; ++w ) {
+    cache->workers[w].generation = cache->generation++;
+    cache->workers[w].relevance = GSL_NEGINF;
+  }
 
   return XLAL_SUCCESS;
 
 }
 
+///
+/// Add a newly-computed item to the cache, pin it for use by the worker thread, and discard items which
+/// are no longer relevant. Returns whether results with the given bitset index were previously computed,
+/// or a negative value on error. Must be called with the cache locked.
+///
+int cache_add_item(
+  WeaveCache *cache,
+  cache_worker *worker,
+  cache_item *new_item,
+  const UINT8 coh_bitset_index
+  )
+{
+
+  // Pin the new cache item while the worker thread uses its results
+  worker->pinned = new_item;
+  worker->orphaned = 0;
+
+  // Add new cache item to the index hash table
+  XLAL_CHECK_VAL( -1, XLALHashTblAdd( cache->coh_index_hash, new_item ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Get the item in the cache with the smallest relevance
+  const cache_item *least_relevant_item = ( const cache_item * ) XLALHeapRoot( cache->relevance_heap );
+  XLAL_CHECK_VAL( -1, xlalErrno == 0, XLAL_EFUNC );
+
+  // If garbage collection is enabled, and item's relevance has fallen below the threshold relevance, it can be removed from the cache
+  cache_item *item = new_item;
+  if ( cache->any_gc && least_relevant_item != NULL && least_relevant_item != new_item && cache_item_is_irrelevant( cache, least_relevant_item ) ) {
+
+    // Remove least relevant item from index hash table
+    XLAL_CHECK_VAL( -1, XLALHashTblRemove( cache->coh_index_hash, least_relevant_item ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    // Exchange the new cache item with the least relevant item in the relevance heap
+    XLAL_CHECK_VAL( -1, XLALHeapExchangeRoot( cache->relevance_heap, ( void ** ) &item ) == XLAL_SUCCESS, XLAL_EFUNC );
+    cache_item_recycle( cache, cache_item_release( cache, item ) );
+
+    // If maximal garbage collection is enabled, remove as many results as possible
+    while ( cache->all_gc ) {
+
+      // Get the item in the cache with the smallest relevance
+      least_relevant_item = ( const cache_item * ) XLALHeapRoot( cache->relevance_heap );
+      XLAL_CHECK_VAL( -1, xlalErrno == 0, XLAL_EFUNC );
+
+      // If item's relevance has fallen below the threshold relevance, it can be removed from the cache
+      if ( least_relevant_item != NULL && least_relevant_item != new_item && cache_item_is_irrelevant( cache, least_relevant_item ) ) {
+
+        // Remove least relevant item from index hash table
+        XLAL_CHECK_VAL( -1, XLALHashTblRemove( cache->coh_index_hash, least_relevant_item ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+        // Remove least relevant item from the relevance heap, and destroy it unless still in use
+        item = ( cache_item * ) XLALHeapExtractRoot( cache->relevance_heap );
+        XLAL_CHECK_VAL( -1, item != NULL, XLAL_EFUNC );
+        cache_item_destroy( cache_item_release( cache, item ) );
+
+      } else {
+
+        // All cache items are still relevant
+        break;
+
+      }
+
+    }
+
+  } else {
+
+    // Add new cache item to the relevance heap; 'item' many now contains an item removed from the heap
+    XLAL_CHECK_VAL( -1, XLALHeapAdd( cache->relevance_heap, ( void ** ) &item ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    // If 'item' contains an item removed from the heap, also remove it from the index hash table
+    if ( item != NULL ) {
+      XLAL_CHECK_VAL( -1, XLALHashTblRemove( cache->coh_index_hash, item ) == XLAL_SUCCESS, XLAL_EFUNC );
+      cache_item_recycle( cache, cache_item_release( cache, item ) );
+    }
+
+  }
+
+  // Update maximum size obtained by relevance heap
+  const UINT4 heap_size = XLALHeapSize( cache->relevance_heap );
+  if ( cache->heap_max_size < heap_size ) {
+    cache->heap_max_size = heap_size;
+  }
+
+  // Check if coherent results have been computed previously, and record that this coherent result has now been computed
+  BOOLEAN computed = 0;
+  XLAL_CHECK_VAL( -1, XLALBitsetGet( cache->coh_computed_bitset, coh_bitset_index, &computed ) == XLAL_SUCCESS, XLAL_EFUNC );
+  if ( !computed ) {
+    XLAL_CHECK_VAL( -1, XLALBitsetSet( cache->coh_computed_bitset, coh_bitset_index, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  return computed ? 1 : 0;
+
+}
+
 ///
 /// Retrieve coherent results for a given query, or compute new coherent results if not found
 ///
@@ -867,19 +1126,52 @@ int XLALWeaveCacheRetrieve(
   XLAL_CHECK( coh_res != NULL, XLAL_EFAULT );
   XLAL_CHECK( coh_offset != NULL, XLAL_EFAULT );
   XLAL_CHECK( tim != NULL, XLAL_EFAULT );
+  XLAL_CHECK( queries->worker < cache->nworkers, XLAL_EINVAL );
+
+  // Get state of the worker thread making the queries
+  cache_worker *worker = &cache->workers[queries->worker];
+
+  CACHE_LOCK( cache );
+
+  // The worker thread has finished with the results of its previous query, so unpin its item
+  if ( worker->orphaned ) {
+    cache_item_destroy( worker->pinned );
+  }
+  worker->pinned = NULL;
+  worker->orphaned = 0;
+
+  // Record the relevance of the worker thread's current semicoherent point
+  worker->relevance = queries->semi_relevance;
 
   // See if coherent results are already cached
-  const cache_item find_key = { .generation = cache->generation, .coh_index = queries->coh_index[query_index] };
+  const cache_item find_key = { .generation = worker->generation, .coh_index = queries->coh_index[query_index] };
   const cache_item *find_item = NULL;
-  XLAL_CHECK( XLALHashTblFind( cache->coh_index_hash, &find_key, ( const void ** ) &find_item ) == XLAL_SUCCESS, XLAL_EFUNC );
+  int retn = XLALHashTblFind( cache->coh_index_hash, &find_key, ( const void ** ) &find_item );
+  cache_item *new_item = NULL;
+  if ( retn == XLAL_SUCCESS && find_item == NULL ) {
+
+    // Reuse 'saved_item' if possible
+    new_item = cache->saved_item;
+    cache->saved_item = NULL;
+
+  }
+  if ( retn == XLAL_SUCCESS && find_item != NULL ) {
+
+    // Pin the cache item while the worker thread uses its results
+    worker->pinned = ( cache_item * ) find_item;
+
+  }
+
+  CACHE_UNLOCK( cache );
+  XLAL_CHECK( retn == XLAL_SUCCESS, XLAL_EFUNC );
+
   if ( find_item == NULL ) {
 
-    // Reuse 'saved_item' if possible, otherwise allocate memory for a new cache item
-    if ( cache->saved_item == NULL ) {
-      cache->saved_item = XLALCalloc( 1, sizeof( *cache->saved_item ) );
-      XLAL_CHECK( cache->saved_item != NULL, XLAL_EINVAL );
+    // Allocate memory for a new cache item if no item could be reused
+    if ( new_item == NULL ) {
+      new_item = XLALCalloc( 1, sizeof( *new_item ) );
+      XLAL_CHECK( new_item != NULL, XLAL_EINVAL );
     }
-    cache_item *new_item = cache->saved_item;
     find_item = new_item;
 
     // Set the key of the new cache item for future lookups
@@ -893,85 +1185,25 @@ int XLALWeaveCacheRetrieve(
     const UINT4 coh_nfreqs = queries->coh_right[query_index] - queries->coh_left[query_index] + 1;
 
     // Compute coherent results for the new cache item
-    XLAL_CHECK( XLALWeaveCohResultsCompute( &new_item->coh_res, cache->coh_input, &queries->coh_phys[query_index], coh_nfreqs, tim ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-    // Add new cache item to the index hash table
-    XLAL_CHECK( XLALHashTblAdd( cache->coh_index_hash, new_item ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-    // Get the item in the cache with the smallest relevance
-    const cache_item *least_relevant_item = ( const cache_item * ) XLALHeapRoot( cache->relevance_heap );
-    XLAL_CHECK( xlalErrno == 0, XLAL_EFUNC );
-
-    // Create a 'fake' item specifying thresholds for cache item relevance, for comparison with 'least_relevant_item'
-    const cache_item relevance_threshold = { .generation = cache->generation, .relevance = queries->semi_relevance };
-
-    // If garbage collection is enabled, and item's relevance has fallen below the threshold relevance, it can be removed from the cache
-    if ( cache->any_gc && least_relevant_item != NULL && least_relevant_item != new_item && cache_item_compare_by_relevance( least_relevant_item, &relevance_threshold ) < 0 ) {
-
-      // Remove least relevant item from index hash table
-      XLAL_CHECK( XLALHashTblRemove( cache->coh_index_hash, least_relevant_item ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-      // Exchange 'saved_item' with the least relevant item in the relevance heap
-      XLAL_CHECK( XLALHeapExchangeRoot( cache->relevance_heap, ( void ** ) &cache->saved_item ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-      // If maximal garbage collection is enabled, remove as many results as possible
-      while ( cache->all_gc ) {
-
-        // Get the item in the cache with the smallest relevance
-        least_relevant_item = ( const cache_item * ) XLALHeapRoot( cache->relevance_heap );
-        XLAL_CHECK( xlalErrno == 0, XLAL_EFUNC );
-
-        // If item's relevance has fallen below the threshold relevance, it can be removed from the cache
-        if ( least_relevant_item != NULL && least_relevant_item != new_item && cache_item_compare_by_relevance( least_relevant_item, &relevance_threshold ) < 0 ) {
-
-          // Remove least relevant item from index hash table
-          XLAL_CHECK( XLALHashTblRemove( cache->coh_index_hash, least_relevant_item ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-          // Remove and destroy least relevant item from the relevance heap
-          XLAL_CHECK( XLALHeapRemoveRoot( cache->relevance_heap ) == XLAL_SUCCESS, XLAL_EINVAL );
-
-        } else {
-
-          // All cache items are still relevant
-          break;
-
-        }
-
-      }
-
-    } else {
-
-      // Add new cache item to the relevance heap; 'saved_item' many now contains an item removed from the heap
-      XLAL_CHECK( XLALHeapAdd( cache->relevance_heap, ( void ** ) &cache->saved_item ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-      // If 'saved_item' contains an item removed from the heap, also remove it from the index hash table
-      if ( cache->saved_item != NULL ) {
-        XLAL_CHECK( XLALHashTblRemove( cache->coh_index_hash, cache->saved_item ) == XLAL_SUCCESS, XLAL_EFUNC );
-      }
-
-    }
-
-    // Update maximum size obtained by relevance heap
-    const UINT4 heap_size = XLALHeapSize( cache->relevance_heap );
-    if ( cache->heap_max_size < heap_size ) {
-      cache->heap_max_size = heap_size;
+    // - Worker threads compute in parallel, outside the lock, using their own F-statistic workers
+    // - No other worker thread can compute the same item, since it has a different generation
+    if ( XLALWeaveCohResultsCompute( &new_item->coh_res, cache->coh_input, queries->worker, &queries->coh_phys[query_index], coh_nfreqs, tim ) != XLAL_SUCCESS ) {
+      cache_item_destroy( new_item );
+      XLAL_ERROR( XLAL_EFUNC );
     }
 
     // Increment number of computed coherent results
     queries->coh_nres[query_index] += coh_nfreqs;
 
-    // Check if coherent results have been computed previously
-    const UINT8 coh_bitset_index = queries->freq_partition_index * cache->coh_max_index + find_key.coh_index;
-    BOOLEAN computed = 0;
-    XLAL_CHECK( XLALBitsetGet( cache->coh_computed_bitset, coh_bitset_index, &computed ) == XLAL_SUCCESS, XLAL_EFUNC );
-    if ( !computed ) {
+    CACHE_LOCK( cache );
+    retn = cache_add_item( cache, worker, new_item, queries->freq_partition_index * cache->coh_max_index + find_key.coh_index );
+    CACHE_UNLOCK( cache );
+    XLAL_CHECK( retn >= 0, XLAL_EFUNC );
+    if ( retn == 0 ) {
 
       // Coherent results have not been computed before: increment the number of coherent templates
       queries->coh_ntmpl[query_index] += coh_nfreqs;
 
-      // This coherent result has now been computed
-      XLAL_CHECK( XLALBitsetSet( cache->coh_computed_bitset, coh_bitset_index, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
-
     }
 
   }
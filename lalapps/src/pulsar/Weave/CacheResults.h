@@ -42,7 +42,8 @@ WeaveCacheQueries *XLALWeaveCacheQueriesCreate(
   const SuperskyTransformData *semi_rssky_transf,
   const double dfreq,
   const UINT4 nqueries,
-  const UINT4 nfreq_partitions
+  const UINT4 nfreq_partitions,
+  const UINT4 worker
   );
 void XLALWeaveCacheQueriesDestroy(
   WeaveCacheQueries *queries
@@ -71,6 +72,10 @@ int XLALWeaveCacheQueriesGetCounts(
   UINT8 *coh_ntmpl,
   UINT8 *semi_ntmpl
   );
+int XLALWeaveCacheQueriesAddCounts(
+  WeaveCacheQueries *queries,
+  const WeaveCacheQueries *worker_queries
+  );
 WeaveCache *XLALWeaveCacheCreate(
   const LatticeTiling *coh_tiling,
   const BOOLEAN interpolation,
@@ -78,7 +83,8 @@ WeaveCache *XLALWeaveCacheCreate(
   const SuperskyTransformData *semi_rssky_transf,
   WeaveCohInput *coh_input,
   const UINT4 max_size,
-  const BOOLEAN all_gc
+  const BOOLEAN all_gc,
+  const UINT4 nworkers
   );
 void XLALWeaveCacheDestroy(
   WeaveCache *cache
@@ -89,7 +95,8 @@ int XLALWeaveCacheWriteInfo(
   WeaveCache *const *cache
   );
 int XLALWeaveCacheExpire(
-  WeaveCache *cache
+  WeaveCache *cache,
+  const UINT4 worker
   );
 int XLALWeaveCacheClear(
   WeaveCache *cache
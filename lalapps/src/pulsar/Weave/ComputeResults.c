@@ -66,6 +66,10 @@ struct tagWeaveCohInput {
   BOOLEAN seg_info_have_sft_info;
   /// F-statistic input data
   FstatInput *Fstat_input;
+  /// Number of worker threads computing F-statistics
+  UINT4 Fstat_nworkers;
+  /// F-statistic workers used by each worker thread; the first is 'Fstat_input' itself
+  FstatInput **Fstat_workers;
   /// What F-statistic quantities to compute
   FstatQuantities Fstat_what_to_compute;
   /// Number of detectors in F-statistic data
@@ -257,11 +261,63 @@ void XLALWeaveCohInputDestroy(
   )
 {
   if ( coh_input != NULL ) {
+    if ( coh_input->Fstat_workers != NULL ) {
+      for ( size_t w = 1; w < coh_input->Fstat_nworkers; ++w ) {
+        XLALDestroyFstatInput( coh_input->Fstat_workers[w] );
+      }
+      XLALFree( coh_input->Fstat_workers );
+    }
     XLALDestroyFstatInput( coh_input->Fstat_input );
     XLALFree( coh_input );
   }
 }
 
+///
+/// Create F-statistic workers so that coherent results can be computed from several worker threads.
+/// Each worker thread shares the (read-only) F-statistic input data of each segment, but has its own
+/// F-statistic buffers and workspace, the latter being shared across segments within the worker thread.
+///
+int XLALWeaveCohInputCreateWorkers(
+  const size_t ncoh_input,
+  WeaveCohInput *const *coh_input,
+  const UINT4 nworkers
+  )
+{
+
+  // Check input
+  XLAL_CHECK( ncoh_input > 0, XLAL_ESIZE );
+  XLAL_CHECK( coh_input != NULL, XLAL_EFAULT );
+  XLAL_CHECK( nworkers > 0, XLAL_EINVAL );
+
+  for ( size_t i = 0; i < ncoh_input; ++i ) {
+    XLAL_CHECK( coh_input[i] != NULL, XLAL_EFAULT );
+    XLAL_CHECK( coh_input[i]->Fstat_workers == NULL, XLAL_EINVAL );
+
+    // Allocate memory
+    coh_input[i]->Fstat_workers = XLALCalloc( nworkers, sizeof( *coh_input[i]->Fstat_workers ) );
+    XLAL_CHECK( coh_input[i]->Fstat_workers != NULL, XLAL_ENOMEM );
+    coh_input[i]->Fstat_nworkers = nworkers;
+
+    // The first worker thread uses the F-statistic input data directly
+    coh_input[i]->Fstat_workers[0] = coh_input[i]->Fstat_input;
+
+    // No F-statistic input data to share if simulating search
+    if ( coh_input[i]->simulation_level & WEAVE_SIMULATE ) {
+      continue;
+    }
+
+    // Create F-statistic workers for the remaining worker threads, re-using the workspace of the previous segment
+    for ( size_t w = 1; w < nworkers; ++w ) {
+      const FstatInput *prev_worker = ( i > 0 ) ? coh_input[i - 1]->Fstat_workers[w] : NULL;
+      XLAL_CHECK( XLALFstatInputWorker( &coh_input[i]->Fstat_workers[w], coh_input[i]->Fstat_input, prev_worker ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Write various information from coherent input data to a FITS file
 ///
@@ -310,10 +366,34 @@ int XLALWeaveCohInputWriteInfo(
     REAL4 XLAL_INIT_DECL( model_values, [TIMING_MODEL_MAX_VARS] );
     for ( size_t i = 0; i < ncoh_input; ++i ) {
 
-      // Get timing data
+      // Get timing data, averaged over the F-statistic workers of all worker threads
       FstatTimingGeneric XLAL_INIT_DECL( timing_generic );
       FstatTimingModel XLAL_INIT_DECL( timing_model );
-      XLAL_CHECK( XLALGetFstatTiming( coh_input[i]->Fstat_input, &timing_generic, &timing_model ) == XLAL_SUCCESS, XLAL_EFUNC );
+      const size_t nworkers = GSL_MAX( 1, coh_input[i]->Fstat_nworkers );
+      for ( size_t w = 0; w < nworkers; ++w ) {
+        const FstatInput *Fstat_input = ( w > 0 ) ? coh_input[i]->Fstat_workers[w] : coh_input[i]->Fstat_input;
+        FstatTimingGeneric XLAL_INIT_DECL( worker_timing_generic );
+        FstatTimingModel XLAL_INIT_DECL( worker_timing_model );
+        XLAL_CHECK( XLALGetFstatTiming( Fstat_input, &worker_timing_generic, &worker_timing_model ) == XLAL_SUCCESS, XLAL_EFUNC );
+        if ( worker_timing_generic.NCalls == 0 ) {
+          continue;
+        }
+        if ( timing_generic.NCalls == 0 ) {
+          timing_model = worker_timing_model;
+        } else {
+          XLAL_CHECK( timing_model.numVariables == worker_timing_model.numVariables, XLAL_EFAILED );
+        }
+        const REAL4 NCalls = timing_generic.NCalls + worker_timing_generic.NCalls;
+        const REAL4 wt = worker_timing_generic.NCalls / NCalls;
+        timing_generic.tauF_eff += wt * ( worker_timing_generic.tauF_eff - timing_generic.tauF_eff );
+        timing_generic.tauF_core += wt * ( worker_timing_generic.tauF_core - timing_generic.tauF_core );
+        timing_generic.tauF_buffer += wt * ( worker_timing_generic.tauF_buffer - timing_generic.tauF_buffer );
+        for ( size_t j = 0; j < timing_model.numVariables; ++j ) {
+          timing_model.values[j] += wt * ( worker_timing_model.values[j] - timing_model.values[j] );
+        }
+        timing_generic.NCalls = NCalls;
+        timing_generic.NBufferMisses += worker_timing_generic.NBufferMisses;
+      }
       XLAL_CHECK( timing_generic.NCalls > 0, XLAL_EFAILED );
 
       // Accumulate generic timing constants
@@ -413,6 +493,7 @@ int XLALWeaveCohInputWriteSegInfo(
 int XLALWeaveCohResultsCompute(
   WeaveCohResults **coh_res,
   WeaveCohInput *coh_input,
+  const UINT4 worker,
   const PulsarDopplerParams *coh_phys,
   const UINT4 coh_nfreqs,
   WeaveSearchTiming *tim
@@ -422,6 +503,7 @@ int XLALWeaveCohResultsCompute(
   // Check input
   XLAL_CHECK( coh_res != NULL, XLAL_EFAULT );
   XLAL_CHECK( coh_input != NULL, XLAL_EFAULT );
+  XLAL_CHECK( worker == 0 || worker < coh_input->Fstat_nworkers, XLAL_EINVAL );
   XLAL_CHECK( coh_phys != NULL, XLAL_EFAULT );
   XLAL_CHECK( coh_nfreqs > 0, XLAL_EINVAL );
 
@@ -481,7 +563,8 @@ int XLALWeaveCohResultsCompute(
   }
 
   // Compute the F-statistic starting at the point 'coh_phys', with 'nfreqs' frequency bins
-  XLAL_CHECK( XLALComputeFstat( &Fstat_res, coh_input->Fstat_input, coh_phys, ( *coh_res )->nfreqs, coh_input->Fstat_what_to_compute ) == XLAL_SUCCESS, XLAL_EFUNC );
+  FstatInput *Fstat_input = ( worker > 0 ) ? coh_input->Fstat_workers[worker] : coh_input->Fstat_input;
+  XLAL_CHECK( XLALComputeFstat( &Fstat_res, Fstat_input, coh_phys, ( *coh_res )->nfreqs, coh_input->Fstat_what_to_compute ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   // Sanity check the F-statistic results structure
   XLAL_CHECK( Fstat_res->internalalloclen == ( *coh_res )->nfreqs, XLAL_EFAILED );
@@ -112,6 +112,11 @@ WeaveCohInput *XLALWeaveCohInputCreate(
 void XLALWeaveCohInputDestroy(
   WeaveCohInput *coh_input
   );
+int XLALWeaveCohInputCreateWorkers(
+  const size_t ncoh_input,
+  WeaveCohInput *const *coh_input,
+  const UINT4 nworkers
+  );
 int XLALWeaveCohInputWriteInfo(
   FITSFile *file,
   const size_t ncoh_input,
@@ -125,6 +130,7 @@ int XLALWeaveCohInputWriteSegInfo(
 int XLALWeaveCohResultsCompute(
   WeaveCohResults **coh_res,
   WeaveCohInput *coh_input,
+  const UINT4 worker,
   const PulsarDopplerParams *coh_phys,
   const UINT4 coh_nfreqs,
   WeaveSearchTiming *tim
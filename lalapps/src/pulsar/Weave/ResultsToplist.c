@@ -356,7 +356,7 @@ int toplist_fill_completionloop_stats(
 
       const UINT4 nfreqs = 1;
       for ( size_t l = 0; l < nsegments; ++l ) {
-        XLAL_CHECK( XLALWeaveCohResultsCompute( &( stats_params->coh_res ), stats_params->coh_input_recalc[l], &semi_phys, nfreqs, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK( XLALWeaveCohResultsCompute( &( stats_params->coh_res ), stats_params->coh_input_recalc[l], 0, &semi_phys, nfreqs, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
         REAL4Vector *coh2F = NULL;
         REAL4Vector *XLAL_INIT_DECL( coh2F_det, [PULSAR_MAX_DETECTORS] );
         BOOLEAN have_coh2F_det;
@@ -48,6 +48,8 @@ struct tagWeaveSearchIterator {
   UINT4 repetition_count;
   /// Index of the current repetition
   UINT4 repetition_index;
+  /// Whether to iterate over only the current partition and repetition
+  BOOLEAN single_partition;
   /// Progress count for iteration
   UINT8 prog_count;
   /// Progress index for iteration
@@ -218,6 +220,12 @@ int XLALWeaveSearchIteratorNext(
     XLAL_CHECK( itr_retn >= 0, XLAL_EFUNC );
     if ( itr_retn == 0 ) {
 
+      // Iteration is complete if iterating over a single partition
+      if ( itr->single_partition ) {
+        *iteration_complete = 1;
+        return XLAL_SUCCESS;
+      }
+
       // Move to the next partition
       ++itr->partition_index;
       if ( itr->partition_index == itr->partition_count ) {
@@ -275,6 +283,75 @@ int XLALWeaveSearchIteratorNext(
 
 }
 
+///
+/// Return the number of partitions of the search parameter space, counting each partition
+/// of iterator output in each repetition separately
+///
+UINT4 XLALWeaveSearchIteratorPartitionCount(
+  const WeaveSearchIterator *itr
+  )
+{
+
+  // Check input
+  XLAL_CHECK_VAL( 0, itr != NULL, XLAL_EFAULT );
+
+  // Return number of partitions
+  return itr->partition_count * itr->repetition_count;
+
+}
+
+///
+/// Restrict iterator to a single partition of the search parameter space, with index in the
+/// range given by XLALWeaveSearchIteratorPartitionCount(); the iterator is reset to the start
+/// of the partition, and iteration is complete at the end of the partition
+///
+int XLALWeaveSearchIteratorSelectPartition(
+  WeaveSearchIterator *itr,
+  const UINT4 partition
+  )
+{
+
+  // Check input
+  XLAL_CHECK( itr != NULL, XLAL_EFAULT );
+  XLAL_CHECK( partition < itr->partition_count * itr->repetition_count, XLAL_EINVAL );
+
+  // Select partition and repetition
+  // - Partitions of iterator output vary fastest, as in XLALWeaveSearchIteratorNext()
+  itr->single_partition = 1;
+  itr->partition_index = partition % itr->partition_count;
+  itr->repetition_index = partition / itr->partition_count;
+
+  // Reset iterator over semicoherent tiling
+  XLAL_CHECK( XLALResetLatticeTilingIterator( itr->semi_itr ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Add the progress made by an iterator over a single partition to the progress of
+/// an iterator over the whole search parameter space, and reset the former
+///
+int XLALWeaveSearchIteratorTransferProgress(
+  WeaveSearchIterator *itr,
+  WeaveSearchIterator *part_itr
+  )
+{
+
+  // Check input
+  XLAL_CHECK( itr != NULL, XLAL_EFAULT );
+  XLAL_CHECK( part_itr != NULL, XLAL_EFAULT );
+  XLAL_CHECK( part_itr->single_partition, XLAL_EINVAL );
+  XLAL_CHECK( !itr->single_partition, XLAL_EINVAL );
+
+  // Transfer progress index
+  itr->prog_index += part_itr->prog_index;
+  part_itr->prog_index = 0;
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Return progress of iterator as a percentage
 ///
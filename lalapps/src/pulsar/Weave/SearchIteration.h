@@ -60,6 +60,17 @@ int XLALWeaveSearchIteratorNext(
   INT4 *semi_right,
   UINT4 *repetition_index
   );
+UINT4 XLALWeaveSearchIteratorPartitionCount(
+  const WeaveSearchIterator *itr
+  );
+int XLALWeaveSearchIteratorSelectPartition(
+  WeaveSearchIterator *itr,
+  const UINT4 partition
+  );
+int XLALWeaveSearchIteratorTransferProgress(
+  WeaveSearchIterator *itr,
+  WeaveSearchIterator *part_itr
+  );
 REAL8 XLALWeaveSearchIteratorProgress(
   const WeaveSearchIterator *itr
   );
@@ -24,6 +24,8 @@
 
 #include "SearchTiming.h"
 
+#include <time.h>
+
 #include <lal/LogPrintf.h>
 #include <lal/UserInputParse.h>
 
@@ -33,6 +35,8 @@
 struct tagWeaveSearchTiming {
   /// Whether to record detailed timing information
   BOOLEAN detailed_timing;
+  /// Whether to record the CPU time of the calling thread only, instead of the whole process
+  BOOLEAN thread_timing;
   /// Struct holding all parameters for which statistics to output and compute, when, and how
   const WeaveStatisticsParams *statistics_params;
   /// Number of output results toplists
@@ -111,7 +115,7 @@ const struct {
 /// @{
 
 static inline double wall_time( void );
-static inline double cpu_time( void );
+static inline double cpu_time( const WeaveSearchTiming *tim );
 
 /// @}
 
@@ -126,11 +130,17 @@ double wall_time(
 }
 
 ///
-/// Return CPU time in seconds
+/// Return CPU time in seconds, of the calling thread if supported and requested, otherwise of the whole process
 double cpu_time(
-  void
+  const WeaveSearchTiming *tim
   )
 {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+  struct timespec ts;
+  if ( tim->thread_timing && clock_gettime( CLOCK_THREAD_CPUTIME_ID, &ts ) == 0 ) {
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+  }
+#endif
   return XLALGetCPUTime();
 }
 
@@ -157,6 +167,61 @@ WeaveSearchTiming *XLALWeaveSearchTimingCreate(
 
 }
 
+///
+/// Create a search timing structure for a worker thread, with the same settings as 'tim', which
+/// records the CPU time of the worker thread only; see XLALWeaveSearchTimingAddWorker()
+///
+WeaveSearchTiming *XLALWeaveSearchTimingCreateWorker(
+  const WeaveSearchTiming *tim
+  )
+{
+
+  // Check input
+  XLAL_CHECK_NULL( tim != NULL, XLAL_EFAULT );
+
+  // Create search timing structure
+  WeaveSearchTiming *worker_tim = XLALWeaveSearchTimingCreate( tim->detailed_timing, tim->statistics_params );
+  XLAL_CHECK_NULL( worker_tim != NULL, XLAL_EFUNC );
+  worker_tim->thread_timing = 1;
+
+  return worker_tim;
+
+}
+
+///
+/// Add the CPU times taken by sections and statistics, as recorded by a (stopped) search timing structure
+/// of a worker thread, to a search timing structure which is being timed
+///
+int XLALWeaveSearchTimingAddWorker(
+  WeaveSearchTiming *tim,
+  const WeaveSearchTiming *worker_tim
+  )
+{
+
+  // Check input
+  XLAL_CHECK( tim != NULL, XLAL_EFAULT );
+  XLAL_CHECK( tim->curr_section < WEAVE_SEARCH_TIMING_MAX, XLAL_EINVAL );
+  XLAL_CHECK( worker_tim != NULL, XLAL_EFAULT );
+  XLAL_CHECK( worker_tim->curr_section == WEAVE_SEARCH_TIMING_MAX, XLAL_EINVAL );
+
+  // Add CPU times taken by sections; unaccounted CPU time is computed when timing is stopped
+  for ( int i = 0; i < WEAVE_SEARCH_TIMING_OTHER; ++i ) {
+    tim->section_cpu_times[i] += worker_tim->section_cpu_times[i];
+  }
+
+  // Add CPU times taken by statistics
+  for ( size_t i = 0; i < XLAL_BIT2IDX( WEAVE_STATISTIC_MAX ); ++i ) {
+    if ( worker_tim->statistic_section[i] < WEAVE_SEARCH_TIMING_MAX ) {
+      XLAL_CHECK( tim->statistic_section[i] == WEAVE_SEARCH_TIMING_MAX || tim->statistic_section[i] == worker_tim->statistic_section[i], XLAL_EINVAL );
+      tim->statistic_section[i] = worker_tim->statistic_section[i];
+      tim->statistic_cpu_times[i] += worker_tim->statistic_cpu_times[i];
+    }
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Destroy a search timing structure
 ///
@@ -185,7 +250,7 @@ int XLALWeaveSearchTimingStart(
   const double wall_now = wall_time();
 
   // Get current CPU time
-  const double cpu_now = cpu_time();
+  const double cpu_now = cpu_time( tim );
 
   // Start timing
   tim->wall_total = wall_now;
@@ -226,7 +291,7 @@ int XLALWeaveSearchTimingElapsed(
   const double wall_now = wall_time();
 
   // Get current CPU time
-  const double cpu_now = cpu_time();
+  const double cpu_now = cpu_time( tim );
 
   // Return elapsed wall and CPU times
   *wall_elapsed = wall_now - tim->wall_total;
@@ -256,7 +321,7 @@ int XLALWeaveSearchTimingStop(
   const double wall_now = wall_time();
 
   // Get current CPU time
-  const double cpu_now = cpu_time();
+  const double cpu_now = cpu_time( tim );
 
   // Stop timing previous section
   tim->section_cpu_times[tim->curr_section] += cpu_now - tim->curr_section_cpu_time;
@@ -297,7 +362,7 @@ int XLALWeaveSearchTimingSection(
   XLAL_CHECK( tim->curr_section == prev_section, XLAL_EINVAL );
 
   // Get current CPU time
-  const double cpu_now = cpu_time();
+  const double cpu_now = cpu_time( tim );
 
   // Stop timing previous section
   if ( prev_section != WEAVE_SEARCH_TIMING_OTHER ) {
@@ -333,7 +398,7 @@ int XLALWeaveSearchTimingStatistic(
   XLAL_CHECK( tim->curr_statistic == prev_statistic, XLAL_EINVAL );
 
   // Get current CPU time
-  const double cpu_now = cpu_time();
+  const double cpu_now = cpu_time( tim );
 
   // Stop timing previous statistic
   if ( prev_statistic & tim->statistics_params->all_statistics_to_compute ) {
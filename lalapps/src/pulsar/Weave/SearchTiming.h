@@ -63,6 +63,13 @@ WeaveSearchTiming *XLALWeaveSearchTimingCreate(
   const BOOLEAN detailed_timing,
   const WeaveStatisticsParams *statistics_params
   );
+WeaveSearchTiming *XLALWeaveSearchTimingCreateWorker(
+  const WeaveSearchTiming *tim
+  );
+int XLALWeaveSearchTimingAddWorker(
+  WeaveSearchTiming *tim,
+  const WeaveSearchTiming *worker_tim
+  );
 void XLALWeaveSearchTimingDestroy(
   WeaveSearchTiming *tim
   );
@@ -34,6 +34,324 @@
 #include <lal/UserInput.h>
 #include <lal/Random.h>
 
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+///
+/// Data shared by all worker threads in the main search loop
+///
+typedef struct {
+  /// Number of segments
+  size_t nsegments;
+  /// Number of detectors
+  UINT4 ndetectors;
+  /// Frequency spacing used by lattices
+  double dfreq;
+  /// Bitflag representing search simulation level
+  WeaveSimulationLevel simulation_level;
+  /// Struct holding all parameters for which statistics to output and compute, when, and how
+  const WeaveStatisticsParams *statistics_params;
+  /// Caches of coherent results for each segment
+  WeaveCache *const *coh_cache;
+  /// Output results
+  WeaveOutputResults *out;
+  /// Iterator over the main loop search parameter space, used to record progress
+  WeaveSearchIterator *main_loop_itr;
+  /// Search timing, used to record elapsed time
+  WeaveSearchTiming *tim;
+  /// Elapsed wall time at which progress was last printed, and interval at which to print progress
+  double wall_prog_elapsed;
+  double wall_prog_period;
+  /// Whether to print predicted remaining time, and previous prediction for total elapsed time
+  BOOLEAN wall_prog_remain_print;
+  double wall_prog_total_prev;
+#ifdef LAL_PTHREAD_LOCK
+  /// Number of partitions of the main loop search parameter space
+  UINT4 npartitions;
+  /// Index of the next partition to be searched by a worker thread
+  UINT4 next_partition;
+  /// Whether any worker thread has failed
+  int failed;
+  /// Lock which serialises taking partitions from the queue, addition to output results, and progress printing, by worker threads
+  pthread_mutex_t lock;
+#endif
+} main_loop_shared;
+
+#ifdef LAL_PTHREAD_LOCK
+
+///
+/// Data belonging to a single worker thread in the main search loop
+///
+typedef struct {
+  /// Data shared by all worker threads
+  main_loop_shared *ml;
+  /// Index of this worker thread
+  UINT4 worker;
+  /// Iterator over a single partition of the main loop search parameter space
+  WeaveSearchIterator *itr;
+  /// Storage for cache queries for coherent results in each segment
+  WeaveCacheQueries *queries;
+  /// Semicoherent results
+  WeaveSemiResults *semi_res;
+  /// Search timing
+  WeaveSearchTiming *tim;
+  /// Return value of worker thread
+  int retn;
+} main_loop_worker;
+
+#endif // LAL_PTHREAD_LOCK
+
+///
+/// Compute semicoherent results for a semicoherent frequency block in the main search loop.
+/// On return, the current timing section is WEAVE_SEARCH_TIMING_SEMI, or WEAVE_SEARCH_TIMING_OTHER
+/// if '*semi_nfreqs' is zero, i.e. the block should be skipped for this frequency partition
+///
+static int main_loop_block(
+  main_loop_shared *ml,
+  WeaveCacheQueries *queries,
+  WeaveSemiResults **semi_res,
+  WeaveSearchTiming *tim,
+  const UINT8 semi_index,
+  const gsl_vector *semi_rssky,
+  const INT4 semi_left,
+  const INT4 semi_right,
+  const UINT4 freq_partition_index,
+  UINT4 *semi_nfreqs
+  )
+{
+
+  const size_t nsegments = ml->nsegments;
+
+  // Switch timing section
+  XLAL_CHECK( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_ITER, WEAVE_SEARCH_TIMING_QUERY ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Initialise cache queries
+  XLAL_CHECK( XLALWeaveCacheQueriesInit( queries, semi_index, semi_rssky, semi_left, semi_right, freq_partition_index ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Query for coherent results for each segment
+  for ( size_t i = 0; i < nsegments; ++i ) {
+    XLAL_CHECK( XLALWeaveCacheQuery( ml->coh_cache[i], queries, i ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  // Finalise cache queries
+  PulsarDopplerParams XLAL_INIT_DECL( semi_phys );
+  *semi_nfreqs = 0;
+  XLAL_CHECK( XLALWeaveCacheQueriesFinal( queries, &semi_phys, semi_nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
+  if ( *semi_nfreqs == 0 ) {
+    XLAL_CHECK( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_QUERY, WEAVE_SEARCH_TIMING_OTHER ) == XLAL_SUCCESS, XLAL_EFUNC );
+    return XLAL_SUCCESS;
+  }
+
+  // Switch timing section
+  XLAL_CHECK( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_QUERY, WEAVE_SEARCH_TIMING_COH ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Retrieve coherent results from each segment
+  const WeaveCohResults *XLAL_INIT_DECL( coh_res, [nsegments] );
+  UINT8 XLAL_INIT_DECL( coh_index, [nsegments] );
+  UINT4 XLAL_INIT_DECL( coh_offset, [nsegments] );
+  for ( size_t i = 0; i < nsegments; ++i ) {
+    XLAL_CHECK( XLALWeaveCacheRetrieve( ml->coh_cache[i], queries, i, &coh_res[i], &coh_index[i], &coh_offset[i], tim ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( coh_res[i] != NULL, XLAL_EFUNC );
+  }
+
+  // Switch timing section
+  XLAL_CHECK( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_COH, WEAVE_SEARCH_TIMING_SEMISEG ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Initialise semicoherent results
+  XLAL_CHECK( XLALWeaveSemiResultsInit( semi_res, ml->simulation_level, ml->ndetectors, nsegments, semi_index, &semi_phys, ml->dfreq, *semi_nfreqs, ml->statistics_params ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Add coherent results to semicoherent results
+  for ( size_t i = 0; i < nsegments; ++i ) {
+    XLAL_CHECK( XLALWeaveSemiResultsAdd( *semi_res, coh_res[i], coh_index[i], coh_offset[i], tim ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  // Switch timing section
+  XLAL_CHECK( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_SEMISEG, WEAVE_SEARCH_TIMING_SEMI ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Compute all toplist-ranking semicoherent results
+  XLAL_CHECK( XLALWeaveSemiResultsComputeMain( *semi_res, tim ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Print progress of the main search loop, if required, and return the
+/// percentage of the search completed and the elapsed wall time
+///
+static int main_loop_progress(
+  main_loop_shared *ml,
+  REAL4 *prog_per_cent,
+  double *wall_elapsed
+  )
+{
+
+  // Main iterator percentage complete
+  *prog_per_cent = XLALWeaveSearchIteratorProgress( ml->main_loop_itr );
+
+  // Current elapsed wall and CPU times
+  double cpu_elapsed = 0;
+  XLAL_CHECK( XLALWeaveSearchTimingElapsed( ml->tim, wall_elapsed, &cpu_elapsed ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Print iteration progress, if required
+  if ( *wall_elapsed - ml->wall_prog_elapsed >= ml->wall_prog_period ) {
+
+    // Print progress
+    LogPrintf( LOG_NORMAL, "%s at %.3g%% complete", ml->simulation_level & WEAVE_SIMULATE ? "Simulation" : "Search", *prog_per_cent );
+
+    // Print elapsed time
+    LogPrintfVerbatim( LOG_NORMAL, ", elapsed %.1f sec", *wall_elapsed );
+
+    // Print remaining time, if it can be reliably predicted
+    const double wall_prog_remain = XLALWeaveSearchIteratorRemainingTime( ml->main_loop_itr, *wall_elapsed );
+    const double wall_prog_total = *wall_elapsed + wall_prog_remain;
+    if ( ml->wall_prog_remain_print || fabs( wall_prog_total - ml->wall_prog_total_prev ) <= 0.1 * ml->wall_prog_total_prev ) {
+      LogPrintfVerbatim( LOG_NORMAL, ", remaining ~%.1f sec", wall_prog_remain );
+      ml->wall_prog_remain_print = 1;   // Always print remaining time once it can be reliably predicted
+    } else {
+      ml->wall_prog_total_prev = wall_prog_total;
+    }
+
+    // Print CPU usage
+    LogPrintfVerbatim( LOG_NORMAL, ", CPU %.1f%%", 100.0 * cpu_elapsed / *wall_elapsed );
+
+    // Print memory usage
+    LogPrintfVerbatim( LOG_NORMAL, ", peak memory %.1fMB", XLALGetPeakHeapUsageMB() );
+
+    // Finish progress printing
+    LogPrintfVerbatim( LOG_NORMAL, "\n" );
+
+    // Update elapsed wall time at which progress was last printed, and increase interval at which to print progress
+    ml->wall_prog_elapsed = *wall_elapsed;
+    ml->wall_prog_period = GSL_MIN( 1200, ml->wall_prog_period * 1.5 );
+
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
+#ifdef LAL_PTHREAD_LOCK
+
+///
+/// Search partitions of the main loop search parameter space, taken from a shared queue, until
+/// the queue is empty
+///
+static int main_loop_worker_search(
+  main_loop_worker *wkr
+  )
+{
+
+  main_loop_shared *ml = wkr->ml;
+
+  // Start timing of this worker thread
+  XLAL_CHECK( XLALWeaveSearchTimingStart( wkr->tim ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  while ( 1 ) {
+
+    // Take the next partition from the queue; stop if any other worker thread has failed
+    // - Partitions are taken in the order in which they would be searched by a single thread, so
+    //   that the partitions remaining at the end of the search are spread evenly over threads
+    pthread_mutex_lock( &ml->lock );
+    const BOOLEAN stop = ml->failed || ml->next_partition >= ml->npartitions;
+    const UINT4 partition = stop ? 0 : ml->next_partition++;
+    pthread_mutex_unlock( &ml->lock );
+    if ( stop ) {
+      break;
+    }
+
+    // Restrict iterator to this partition, and expire cache items from previous partitions
+    XLAL_CHECK( XLALWeaveSearchIteratorSelectPartition( wkr->itr, partition ) == XLAL_SUCCESS, XLAL_EFUNC );
+    for ( size_t i = 0; i < ml->nsegments; ++i ) {
+      XLAL_CHECK( XLALWeaveCacheExpire( ml->coh_cache[i], wkr->worker ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+
+    while ( 1 ) {
+
+      // Switch timing section
+      XLAL_CHECK( XLALWeaveSearchTimingSection( wkr->tim, WEAVE_SEARCH_TIMING_OTHER, WEAVE_SEARCH_TIMING_ITER ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      // Get next semicoherent frequency block in this partition
+      BOOLEAN partition_complete = 0;
+      BOOLEAN expire_cache = 0;
+      UINT8 semi_index = 0;
+      const gsl_vector *semi_rssky = NULL;
+      INT4 semi_left = 0;
+      INT4 semi_right = 0;
+      UINT4 freq_partition_index = 0;
+      XLAL_CHECK( XLALWeaveSearchIteratorNext( wkr->itr, &partition_complete, &expire_cache, &semi_index, &semi_rssky, &semi_left, &semi_right, &freq_partition_index ) == XLAL_SUCCESS, XLAL_EFUNC );
+      if ( partition_complete ) {
+        XLAL_CHECK( XLALWeaveSearchTimingSection( wkr->tim, WEAVE_SEARCH_TIMING_ITER, WEAVE_SEARCH_TIMING_OTHER ) == XLAL_SUCCESS, XLAL_EFUNC );
+        pthread_mutex_lock( &ml->lock );
+        const int retn = XLALWeaveSearchIteratorTransferProgress( ml->main_loop_itr, wkr->itr );
+        pthread_mutex_unlock( &ml->lock );
+        XLAL_CHECK( retn == XLAL_SUCCESS, XLAL_EFUNC );
+        break;
+      }
+
+      // Compute semicoherent results for the semicoherent frequency block
+      UINT4 semi_nfreqs = 0;
+      XLAL_CHECK( main_loop_block( ml, wkr->queries, &wkr->semi_res, wkr->tim, semi_index, semi_rssky, semi_left, semi_right, freq_partition_index, &semi_nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
+      if ( semi_nfreqs == 0 ) {
+        continue;
+      }
+
+      // Switch timing section
+      XLAL_CHECK( XLALWeaveSearchTimingSection( wkr->tim, WEAVE_SEARCH_TIMING_SEMI, WEAVE_SEARCH_TIMING_OUTPUT ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      // Add semicoherent results to output, and record and print progress
+      int retn = XLAL_SUCCESS;
+      pthread_mutex_lock( &ml->lock );
+      {
+        REAL4 prog_per_cent = 0;
+        double wall_elapsed = 0;
+        retn = XLALWeaveOutputResultsAdd( ml->out, wkr->semi_res, semi_nfreqs );
+        if ( retn == XLAL_SUCCESS ) {
+          retn = XLALWeaveSearchIteratorTransferProgress( ml->main_loop_itr, wkr->itr );
+        }
+        if ( retn == XLAL_SUCCESS ) {
+          retn = main_loop_progress( ml, &prog_per_cent, &wall_elapsed );
+        }
+      }
+      pthread_mutex_unlock( &ml->lock );
+      XLAL_CHECK( retn == XLAL_SUCCESS, XLAL_EFUNC );
+
+      // Switch timing section
+      XLAL_CHECK( XLALWeaveSearchTimingSection( wkr->tim, WEAVE_SEARCH_TIMING_OUTPUT, WEAVE_SEARCH_TIMING_OTHER ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    }
+
+  }
+
+  // Stop timing of this worker thread
+  double wall_total = 0, cpu_total = 0;
+  XLAL_CHECK( XLALWeaveSearchTimingStop( wkr->tim, &wall_total, &cpu_total ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Entry point of a worker thread in the main search loop
+///
+static void *main_loop_worker_thread(
+  void *arg
+  )
+{
+  main_loop_worker *wkr = ( main_loop_worker * ) arg;
+  wkr->retn = main_loop_worker_search( wkr );
+  if ( wkr->retn != XLAL_SUCCESS ) {
+    pthread_mutex_lock( &wkr->ml->lock );
+    wkr->ml->failed = 1;
+    pthread_mutex_unlock( &wkr->ml->lock );
+  }
+  return NULL;
+}
+
+#endif // LAL_PTHREAD_LOCK
+
 int main( int argc, char *argv[] )
 {
 
@@ -50,9 +368,9 @@ int main( int argc, char *argv[] )
     BOOLEAN validate_sft_files, interpolation, lattice_rand_offset, toplist_tmpl_idx, segment_info, simulate_search, time_search, cache_all_gc;
     CHAR *setup_file, *sft_files, *output_file, *ckpt_output_file;
     LALStringVector *sft_timestamps_files, *sft_noise_sqrtSX, *injections, *Fstat_assume_sqrtSX, *lrs_oLGX;
-    REAL8 sft_timebase, semi_max_mismatch, coh_max_mismatch, ckpt_output_period, ckpt_output_exit, lrs_Fstar0sc, nc_2Fth;
+    REAL8 sft_timebase, semi_max_mismatch, coh_max_mismatch, ckpt_output_period, ckpt_output_exit, lrs_Fstar0sc, nc_2Fth, Fstat_SRC_pool_max_mem;
     REAL8Range alpha, delta, freq, f1dot, f2dot, f3dot, f4dot;
-    UINT4 sky_patch_count, sky_patch_index, freq_partitions, f1dot_partitions, Fstat_run_med_window, Fstat_Dterms, toplist_limit, rand_seed, cache_max_size;
+    UINT4 sky_patch_count, sky_patch_index, freq_partitions, f1dot_partitions, Fstat_run_med_window, Fstat_Dterms, toplist_limit, rand_seed, cache_max_size, num_threads;
     int lattice, Fstat_method, Fstat_SSB_precision, toplists, extra_statistics, recalc_statistics;
   } uvar_struct = {
     .Fstat_Dterms = Fstat_opt_args.Dterms,
@@ -68,6 +386,7 @@ int main( int argc, char *argv[] )
     .toplist_limit = 1000,
     .toplists = WEAVE_STATISTIC_MEAN2F,
     .extra_statistics = WEAVE_STATISTIC_NONE,
+    .num_threads = 1,
     .recalc_statistics = WEAVE_STATISTIC_NONE,
     .nc_2Fth = 5.2,
   };
@@ -233,6 +552,12 @@ int main( int argc, char *argv[] )
     Fstat_SSB_precision, UserEnum, &SSBprecisionChoices, 0, DEVELOPER,
     "Precision in calculating the barycentric transformation. "
     );
+  XLALRegisterUvarMember(
+    Fstat_SRC_pool_max_mem, REAL8, 0, DEVELOPER,
+    "Limit the memory (in MB) used by the source-frame timeseries of all segments, when computing the F-statistic by resampling. "
+    "Timeseries are kept in a pool shared between segments; when the pool is full, the least-recently used timeseries are freed, and recomputed when next needed. "
+    "With multiple " UVAR_STR( num_threads ) ", each thread has its own pool of this size, shared between the segments it searches. "
+    );
   //
   // Various statistics input arguments
   //
@@ -329,6 +654,13 @@ int main( int argc, char *argv[] )
     "If FALSE, whenever an item is added to the internal caches, at most one item that may no longer be required is removed. "
     "Has no effect when performing a fully-coherent single-segment search, or a non-interpolating search. "
     );
+  XLALRegisterUvarMember(
+    num_threads, UINT4, 0, DEVELOPER,
+    "Search the partitions of the parameter space (see " UVAR_STR2AND( freq_partitions, f1dot_partitions ) ") in parallel using this number of threads. "
+    "The input data for computing coherent results, and the internal caches of coherent results, are shared between threads; each thread has its own F-statistic workspace. "
+    "Not supported with " UVAR_STR( ckpt_output_file ) ". "
+    "If zero, use as many threads as there are online processors. "
+    );
 
   // Parse user input
   XLAL_CHECK_MAIN( xlalErrno == 0, XLAL_EFUNC, "A call to XLALRegisterUvarMember() failed" );
@@ -403,6 +735,9 @@ int main( int argc, char *argv[] )
   XLALUserVarCheck( &should_exit,
                     uvar->Fstat_SSB_precision < SSBPREC_LAST,
                     UVAR_STR( Fstat_SSB_precision ) " must be in range [0,%u)", SSBPREC_LAST );
+  XLALUserVarCheck( &should_exit,
+                    !UVAR_SET( Fstat_SRC_pool_max_mem ) || uvar->Fstat_SRC_pool_max_mem > 0,
+                    UVAR_STR( Fstat_SRC_pool_max_mem ) " must be strictly positive" );
   //
   // - Output control
   //
@@ -428,6 +763,14 @@ int main( int argc, char *argv[] )
   XLALUserVarCheck( &should_exit,
                     !UVAR_ALLSET2( time_search, ckpt_output_file ),
                     UVAR_STR2AND( time_search, ckpt_output_file ) " are mutually exclusive" );
+  XLALUserVarCheck( &should_exit,
+                    uvar->num_threads == 1 || !UVAR_SET( ckpt_output_file ),
+                    UVAR_STR( ckpt_output_file ) " is not supported with " UVAR_STR( num_threads ) " other than 1" );
+#ifndef LAL_PTHREAD_LOCK
+  XLALUserVarCheck( &should_exit,
+                    uvar->num_threads == 1,
+                    UVAR_STR( num_threads ) " must be 1 when LAL is compiled without POSIX threads" );
+#endif
 
   // Exit if required
   if ( should_exit ) {
@@ -805,6 +1148,21 @@ int main( int argc, char *argv[] )
   Fstat_opt_args.injectSources = injections;
   Fstat_opt_args.prevInput = NULL;
   Fstat_opt_args.collectTiming = uvar->time_search;
+  Fstat_opt_args.resampSRCPoolMaxMB = uvar->Fstat_SRC_pool_max_mem;
+
+  // Determine number of threads used to search partitions in parallel
+  // - No more threads than partitions are useful
+  UINT4 nthreads = uvar->num_threads;
+#ifdef LAL_PTHREAD_LOCK
+  if ( nthreads == 0 ) {
+    const long nprocs = sysconf( _SC_NPROCESSORS_ONLN );
+    nthreads = ( nprocs > 0 ) ? ( UINT4 ) nprocs : 1;
+  }
+#endif
+  nthreads = GSL_MIN( nthreads, uvar->freq_partitions * uvar->f1dot_partitions );
+  if ( nthreads > 1 ) {
+    LogPrintf( LOG_NORMAL, "Searching %u partitions using %u threads\n", uvar->freq_partitions * uvar->f1dot_partitions, nthreads );
+  }
 
   // Load input data required for computing coherent results
   const LALStringVector *sft_noise_sqrtSX = UVAR_SET( sft_noise_sqrtSX ) ? uvar->sft_noise_sqrtSX : NULL;
@@ -816,6 +1174,11 @@ int main( int argc, char *argv[] )
   }
   statistics_params->ref_time = setup.ref_time;
 
+  // Create F-statistic workers so that worker threads compute coherent results in parallel
+  // - Input data for each segment is shared between worker threads; each worker thread has its own
+  //   F-statistic workspace, which is shared between segments
+  XLAL_CHECK_MAIN( XLALWeaveCohInputCreateWorkers( nsegments, statistics_params->coh_input, nthreads ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   LogPrintf( LOG_NORMAL, "Finished loading input data for coherent results\n" );
 
   // Create caches to store intermediate results from coherent parameter-space tilings
@@ -824,7 +1187,7 @@ int main( int argc, char *argv[] )
   for ( size_t i = 0; i < nsegments; ++i ) {
     const size_t cache_max_size = interpolation ? uvar->cache_max_size : 1;
     const BOOLEAN cache_all_gc = interpolation ? uvar->cache_all_gc : 0;
-    coh_cache[i] = XLALWeaveCacheCreate( tiling[i], interpolation, rssky_transf[i], rssky_transf[isemi], statistics_params->coh_input[i], cache_max_size, cache_all_gc );
+    coh_cache[i] = XLALWeaveCacheCreate( tiling[i], interpolation, rssky_transf[i], rssky_transf[isemi], statistics_params->coh_input[i], cache_max_size, cache_all_gc, nthreads );
     XLAL_CHECK_MAIN( coh_cache[i] != NULL, XLAL_EFUNC );
   }
 
@@ -835,7 +1198,7 @@ int main( int argc, char *argv[] )
   XLAL_CHECK_MAIN( main_loop_itr != NULL, XLAL_EFUNC );
 
   // Create storage for cache queries for coherent results in each segment
-  WeaveCacheQueries *queries = XLALWeaveCacheQueriesCreate( tiling[isemi], rssky_transf[isemi], dfreq, nsegments, uvar->freq_partitions );
+  WeaveCacheQueries *queries = XLALWeaveCacheQueriesCreate( tiling[isemi], rssky_transf[isemi], dfreq, nsegments, uvar->freq_partitions, 0 );
   XLAL_CHECK_MAIN( queries != NULL, XLAL_EFUNC );
 
   // Pointer to final semicoherent results
@@ -890,19 +1253,79 @@ int main( int argc, char *argv[] )
   // Elapsed wall time at which search was last checkpointed
   double wall_ckpt_elapsed = 0;
 
-  // Elapsed wall time at which progress was last printed, and interval at which to print progress
-  double wall_prog_elapsed = 0;
-  double wall_prog_period = 5.0;
-
-  // Whether to print predicted remaining time, and previous prediction for total elapsed time
-  BOOLEAN wall_prog_remain_print = 0;
-  double wall_prog_total_prev = 0;
+  // Initialise data shared by main search loop
+  main_loop_shared XLAL_INIT_DECL( ml );
+  ml.nsegments = nsegments;
+  ml.ndetectors = ndetectors;
+  ml.dfreq = dfreq;
+  ml.simulation_level = simulation_level;
+  ml.statistics_params = statistics_params;
+  ml.coh_cache = coh_cache;
+  ml.out = out;
+  ml.main_loop_itr = main_loop_itr;
+  ml.tim = tim;
+  ml.wall_prog_period = 5.0;
 
   // Print initial progress
   LogPrintf( LOG_NORMAL, "Starting main loop at %.3g%% complete, peak memory %.1fMB\n", XLALWeaveSearchIteratorProgress( main_loop_itr ), XLALGetPeakHeapUsageMB() );
 
   // Begin main loop
   BOOLEAN search_complete = 0;
+#ifdef LAL_PTHREAD_LOCK
+  if ( nthreads > 1 ) {
+
+    // Initialise queue of partitions of the main loop search parameter space
+    ml.npartitions = XLALWeaveSearchIteratorPartitionCount( main_loop_itr );
+    XLAL_CHECK_MAIN( ml.npartitions > 0, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( pthread_mutex_init( &ml.lock, NULL ) == 0, XLAL_ESYS );
+
+    // Create data for each worker thread
+    // - Worker thread 0 runs in this thread, and uses the main cache queries
+    main_loop_worker XLAL_INIT_DECL( wkr, [nthreads] );
+    for ( size_t j = 0; j < nthreads; ++j ) {
+      wkr[j].ml = &ml;
+      wkr[j].worker = j;
+      wkr[j].itr = XLALWeaveMainLoopSearchIteratorCreate( tiling[isemi], uvar->freq_partitions, uvar->f1dot_partitions );
+      XLAL_CHECK_MAIN( wkr[j].itr != NULL, XLAL_EFUNC );
+      if ( j == 0 ) {
+        wkr[j].queries = queries;
+      } else {
+        wkr[j].queries = XLALWeaveCacheQueriesCreate( tiling[isemi], rssky_transf[isemi], dfreq, nsegments, uvar->freq_partitions, j );
+        XLAL_CHECK_MAIN( wkr[j].queries != NULL, XLAL_EFUNC );
+      }
+      wkr[j].tim = XLALWeaveSearchTimingCreateWorker( tim );
+      XLAL_CHECK_MAIN( wkr[j].tim != NULL, XLAL_EFUNC );
+    }
+
+    // Start worker threads, search partitions in this thread, then wait for worker threads to finish
+    pthread_t XLAL_INIT_DECL( threads, [nthreads] );
+    for ( size_t j = 1; j < nthreads; ++j ) {
+      XLAL_CHECK_MAIN( pthread_create( &threads[j], NULL, main_loop_worker_thread, &wkr[j] ) == 0, XLAL_ESYS );
+    }
+    main_loop_worker_thread( &wkr[0] );
+    for ( size_t j = 1; j < nthreads; ++j ) {
+      XLAL_CHECK_MAIN( pthread_join( threads[j], NULL ) == 0, XLAL_ESYS );
+    }
+    for ( size_t j = 0; j < nthreads; ++j ) {
+      XLAL_CHECK_MAIN( wkr[j].retn == XLAL_SUCCESS, XLAL_EFUNC, "Worker thread %zu failed", j );
+    }
+    search_complete = 1;
+
+    // Add cache query counts and timings from worker threads, and cleanup memory from worker threads
+    for ( size_t j = 0; j < nthreads; ++j ) {
+      XLAL_CHECK_MAIN( XLALWeaveSearchTimingAddWorker( tim, wkr[j].tim ) == XLAL_SUCCESS, XLAL_EFUNC );
+      if ( j > 0 ) {
+        XLAL_CHECK_MAIN( XLALWeaveCacheQueriesAddCounts( queries, wkr[j].queries ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLALWeaveCacheQueriesDestroy( wkr[j].queries );
+      }
+      XLALWeaveSearchIteratorDestroy( wkr[j].itr );
+      XLALWeaveSemiResultsDestroy( wkr[j].semi_res );
+      XLALWeaveSearchTimingDestroy( wkr[j].tim );
+    }
+    pthread_mutex_destroy( &ml.lock );
+
+  }
+#endif // LAL_PTHREAD_LOCK
   while ( !search_complete ) {
 
     // Switch timing section
@@ -923,59 +1346,17 @@ int main( int argc, char *argv[] )
       break;
     } else if ( expire_cache ) {
       for ( size_t i = 0; i < nsegments; ++i ) {
-        XLAL_CHECK_MAIN( XLALWeaveCacheExpire( coh_cache[i] ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_MAIN( XLALWeaveCacheExpire( coh_cache[i], 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
       }
     }
 
-    // Switch timing section
-    XLAL_CHECK_MAIN( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_ITER, WEAVE_SEARCH_TIMING_QUERY ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-    // Initialise cache queries
-    XLAL_CHECK_MAIN( XLALWeaveCacheQueriesInit( queries, semi_index, semi_rssky, semi_left, semi_right, freq_partition_index ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-    // Query for coherent results for each segment
-    for ( size_t i = 0; i < nsegments; ++i ) {
-      XLAL_CHECK_MAIN( XLALWeaveCacheQuery( coh_cache[i], queries, i ) == XLAL_SUCCESS, XLAL_EFUNC );
-    }
-
-    // Finalise cache queries
-    PulsarDopplerParams XLAL_INIT_DECL( semi_phys );
+    // Compute semicoherent results for the semicoherent frequency block
     UINT4 semi_nfreqs = 0;
-    XLAL_CHECK_MAIN( XLALWeaveCacheQueriesFinal( queries, &semi_phys, &semi_nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( main_loop_block( &ml, queries, &semi_res, tim, semi_index, semi_rssky, semi_left, semi_right, freq_partition_index, &semi_nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
     if ( semi_nfreqs == 0 ) {
-      XLAL_CHECK_MAIN( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_QUERY, WEAVE_SEARCH_TIMING_OTHER ) == XLAL_SUCCESS, XLAL_EFUNC );
       continue;
     }
 
-    // Switch timing section
-    XLAL_CHECK_MAIN( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_QUERY, WEAVE_SEARCH_TIMING_COH ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-    // Retrieve coherent results from each segment
-    const WeaveCohResults *XLAL_INIT_DECL( coh_res, [nsegments] );
-    UINT8 XLAL_INIT_DECL( coh_index, [nsegments] );
-    UINT4 XLAL_INIT_DECL( coh_offset, [nsegments] );
-    for ( size_t i = 0; i < nsegments; ++i ) {
-      XLAL_CHECK_MAIN( XLALWeaveCacheRetrieve( coh_cache[i], queries, i, &coh_res[i], &coh_index[i], &coh_offset[i], tim ) == XLAL_SUCCESS, XLAL_EFUNC );
-      XLAL_CHECK_MAIN( coh_res[i] != NULL, XLAL_EFUNC );
-    }
-
-    // Switch timing section
-    XLAL_CHECK_MAIN( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_COH, WEAVE_SEARCH_TIMING_SEMISEG ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-    // Initialise semicoherent results
-    XLAL_CHECK_MAIN( XLALWeaveSemiResultsInit( &semi_res, simulation_level, ndetectors, nsegments, semi_index, &semi_phys, dfreq, semi_nfreqs, statistics_params ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-    // Add coherent results to semicoherent results
-    for ( size_t i = 0; i < nsegments; ++i ) {
-      XLAL_CHECK_MAIN( XLALWeaveSemiResultsAdd( semi_res, coh_res[i], coh_index[i], coh_offset[i], tim ) == XLAL_SUCCESS, XLAL_EFUNC );
-    }
-
-    // Switch timing section
-    XLAL_CHECK_MAIN( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_SEMISEG, WEAVE_SEARCH_TIMING_SEMI ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-    // Compute all toplist-ranking semicoherent results
-    XLAL_CHECK_MAIN( XLALWeaveSemiResultsComputeMain( semi_res, tim ) == XLAL_SUCCESS, XLAL_EFUNC );
-
     // Switch timing section
     XLAL_CHECK_MAIN( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_SEMI, WEAVE_SEARCH_TIMING_OUTPUT ) == XLAL_SUCCESS, XLAL_EFUNC );
 
@@ -985,46 +1366,10 @@ int main( int argc, char *argv[] )
     // Switch timing section
     XLAL_CHECK_MAIN( XLALWeaveSearchTimingSection( tim, WEAVE_SEARCH_TIMING_OUTPUT, WEAVE_SEARCH_TIMING_OTHER ) == XLAL_SUCCESS, XLAL_EFUNC );
 
-    // Main iterator percentage complete
-    const REAL4 prog_per_cent = XLALWeaveSearchIteratorProgress( main_loop_itr );
-
-    // Current elapsed wall and CPU times
-    double wall_elapsed = 0, cpu_elapsed = 0;
-    XLAL_CHECK_MAIN( XLALWeaveSearchTimingElapsed( tim, &wall_elapsed, &cpu_elapsed ) == XLAL_SUCCESS, XLAL_EFUNC );
-
     // Print iteration progress, if required
-    if ( wall_elapsed - wall_prog_elapsed >= wall_prog_period ) {
-
-      // Print progress
-      LogPrintf( LOG_NORMAL, "%s at %.3g%% complete", simulation_level & WEAVE_SIMULATE ? "Simulation" : "Search", prog_per_cent );
-
-      // Print elapsed time
-      LogPrintfVerbatim( LOG_NORMAL, ", elapsed %.1f sec", wall_elapsed );
-
-      // Print remaining time, if it can be reliably predicted
-      const double wall_prog_remain = XLALWeaveSearchIteratorRemainingTime( main_loop_itr, wall_elapsed );
-      const double wall_prog_total = wall_elapsed + wall_prog_remain;
-      if ( wall_prog_remain_print || fabs( wall_prog_total - wall_prog_total_prev ) <= 0.1 * wall_prog_total_prev ) {
-        LogPrintfVerbatim( LOG_NORMAL, ", remaining ~%.1f sec", wall_prog_remain );
-        wall_prog_remain_print = 1;   // Always print remaining time once it can be reliably predicted
-      } else {
-        wall_prog_total_prev = wall_prog_total;
-      }
-
-      // Print CPU usage
-      LogPrintfVerbatim( LOG_NORMAL, ", CPU %.1f%%", 100.0 * cpu_elapsed / wall_elapsed );
-
-      // Print memory usage
-      LogPrintfVerbatim( LOG_NORMAL, ", peak memory %.1fMB", XLALGetPeakHeapUsageMB() );
-
-      // Finish progress printing
-      LogPrintfVerbatim( LOG_NORMAL, "\n" );
-
-      // Update elapsed wall time at which progress was last printed, and increase interval at which to print progress
-      wall_prog_elapsed = wall_elapsed;
-      wall_prog_period = GSL_MIN( 1200, wall_prog_period * 1.5 );
-
-    }
+    REAL4 prog_per_cent = 0;
+    double wall_elapsed = 0;
+    XLAL_CHECK_MAIN( main_loop_progress( &ml, &prog_per_cent, &wall_elapsed ) == XLAL_SUCCESS, XLAL_EFUNC );
 
     // Checkpoint output results, if required
     if ( UVAR_SET( ckpt_output_file ) ) {
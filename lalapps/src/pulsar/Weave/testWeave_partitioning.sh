@@ -110,4 +110,33 @@ for setup in onefreq short long; do
     set +x
     echo
 
+    echo "=== Setup '${setup}': Perform interpolating search with frequency/spindown partitions searched by multiple threads ==="
+    set -x
+    lalapps_Weave ${weave_part_options} --num-threads=3 --output-file=WeaveOutPartThr.fits \
+        --toplists=mean2F --toplist-limit=2321 --segment-info --setup-file=WeaveSetup.fits \
+        --rand-seed=3456 --sft-timebase=1800 --sft-noise-sqrtSX=1,1 \
+        --sft-timestamps-files=timestamps-1.txt,timestamps-2.txt \
+        ${weave_search_options}
+    lalapps_fits_overview WeaveOutPartThr.fits
+    set +x
+    echo
+
+    echo "=== Setup '${setup}': Check that number of coherent and semicoherent templates is the same with/without multiple threads ==="
+    set -x
+    for key in NCOHTPL NSEMITPL; do
+        ntmpl_part=`lalapps_fits_header_getval "WeaveOutPart.fits[0]" ${key} | tr '\n\r' '  ' | awk 'NF == 1 {printf "%d", $1}'`
+        ntmpl_part_thr=`lalapps_fits_header_getval "WeaveOutPartThr.fits[0]" ${key} | tr '\n\r' '  ' | awk 'NF == 1 {printf "%d", $1}'`
+        [ "${ntmpl_part}" -eq "${ntmpl_part_thr}" ]
+    done
+    coh_nres_part_thr=`lalapps_fits_header_getval "WeaveOutPartThr.fits[0]" 'NCOHRES' | tr '\n\r' '  ' | awk 'NF == 1 {printf "%d", $1}'`
+    awk "BEGIN { print recomp = ( ${coh_nres_part_thr} - ${coh_ntmpl_part} ) / ${coh_ntmpl_part}; exit ( recomp <= ${weave_recomp_threshold_part} ? 0 : 1 ) }"
+    set +x
+    echo
+
+    echo "=== Setup '${setup}': Compare F-statistics from lalapps_Weave without frequency/spindown partitions, and with partitions searched by multiple threads ==="
+    set -x
+    env LAL_DEBUG_LEVEL="${LAL_DEBUG_LEVEL},info" lalapps_WeaveCompare --setup-file=WeaveSetup.fits --result-file-1=WeaveOutNoPart.fits --result-file-2=WeaveOutPartThr.fits
+    set +x
+    echo
+
 done
@@ -21,13 +21,17 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <lal/LALInference.h>
 #include <lal/LALInferenceInit.h>
 #include <lal/LALInferenceReadData.h>
 #include <lal/LALInferenceCalibrationErrors.h>
 #include <lal/LALInferenceLikelihood.h>
 #include <lal/LALInferenceTemplate.h>
+#include <lal/LALInferencePrior.h>
 #include <sys/resource.h>
+#include <sys/time.h>
+#include <gsl/gsl_randist.h>
 
 #ifdef __GNUC__
 #define UNUSED __attribute__ ((unused))
@@ -42,6 +46,13 @@ const char HELPSTR[]=\
     --bench-template   : Only benchmark template function\n\
     --bench-likelihood : Only benchmark likelihood function\n\
                          (defaults to benchmarking both)\n\
+    --check-likelihood-plan : Check that the compiled likelihood plan gives\n\
+                         bitwise identical results to the general likelihood\n\
+                         at Niter random sky positions, and time both;\n\
+                         exits with non-zero status if any result differs\n\
+    --bench-proposal   : Benchmark a random-walk proposal and the prior,\n\
+                         accessing parameters by name and through a\n\
+                         LALInferenceREAL8View\n\
  Example (for 1.0-1.0 binary with seglen 8, srate 4096): \n\
  $ ./lalinference_bench --psdlength 1000 --psdstart 1 --seglen 8 --srate 4096 --trigtime 0 --ifo H1 --H1-channel LALSimAdLIGO --H1-cache LALSimAdLIGO --dataseed 1324 --Niter 10000 --fix-chirpmass 1.218 --fix-q 1.0\n\n\n\
 ";
@@ -59,6 +70,15 @@ void fprintf_bench(FILE *fp, struct rusage start, struct rusage end, UINT4 Niter
   fprintf(fp,"SYS Per iteration: %e s\n",stime / (double) Niter);
 }
 
+void fprintf_rate(FILE *fp, struct rusage start, struct rusage end, UINT4 Niter);
+void fprintf_rate(FILE *fp, struct rusage start, struct rusage end, UINT4 Niter)
+{
+  REAL8 utime = (end.ru_utime.tv_sec - start.ru_utime.tv_sec) + 1e-6 * (end.ru_utime.tv_usec - start.ru_utime.tv_usec);
+  REAL8 stime = (end.ru_stime.tv_sec - start.ru_stime.tv_sec) + 1e-6 * (end.ru_stime.tv_usec - start.ru_stime.tv_usec);
+
+  fprintf(fp,"Evaluations per second: %e\n",(double) Niter / (utime + stime));
+}
+
 void LALInferenceTemplateNoop(UNUSED LALInferenceModel *model);
 void LALInferenceTemplateNoop(UNUSED LALInferenceModel *model)
 {
@@ -89,6 +109,181 @@ void bench_likelihood(LALInferenceRunState *runState,UINT4 Niter)
   
 }
 
+/* Check that two sets of parameters have bitwise identical REAL8 outputs */
+static UINT4 compare_outputs(LALInferenceVariables *a, LALInferenceVariables *b);
+static UINT4 compare_outputs(LALInferenceVariables *a, LALInferenceVariables *b)
+{
+  UINT4 mismatches=0;
+  for(LALInferenceVariableItem *item=a->head;item;item=item->next)
+  {
+    if(item->type!=LALINFERENCE_REAL8_t || item->vary!=LALINFERENCE_PARAM_OUTPUT) continue;
+    if(!LALInferenceCheckVariable(b,item->name) || memcmp(item->value,LALInferenceGetVariable(b,item->name),sizeof(REAL8)))
+    {
+      fprintf(stdout,"Mismatch in %s: %.17g vs %.17g\n",item->name,*(REAL8 *)item->value,
+              LALInferenceCheckVariable(b,item->name)?LALInferenceGetREAL8Variable(b,item->name):NAN);
+      mismatches++;
+    }
+  }
+  return mismatches;
+}
+
+static REAL8 wall_time(void);
+static REAL8 wall_time(void)
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+/* Returns the number of likelihoods which differ, or -1 if there is no plan to check */
+INT4 bench_likelihood_plan(LALInferenceRunState *runState,UINT4 Niter);
+INT4 bench_likelihood_plan(LALInferenceRunState *runState,UINT4 Niter)
+{
+  UINT4 i=0,mismatches=0;
+  struct rusage r_usage_start,r_usage_end;
+  LALInferenceThreadState *thread=&(runState->threads[0]);
+  LALInferenceModel *model=thread->model;
+  LALInferenceLikelihoodPlan *plan=model->likelihoodPlan;
+  LALInferenceVariables planParams,refParams;
+  memset(&planParams,0,sizeof(planParams));
+  memset(&refParams,0,sizeof(refParams));
+
+  if(!plan)
+  {
+    fprintf(stdout,"No likelihood plan for this configuration\n");
+    return -1;
+  }
+
+  /* Generate the template once, then vary only the extrinsic parameters */
+  runState->likelihood(thread->currentParams,runState->data,model);
+  LALInferenceTemplateFunction old_templt=model->templt;
+  model->templt=LALInferenceTemplateNoop;
+
+  fprintf(stdout,"Checking likelihood plan:\n");
+  REAL8 time0=LALInferenceGetREAL8Variable(thread->currentParams,"time");
+  for(i=0;i<Niter;i++)
+  {
+    LALInferenceCopyVariables(thread->currentParams,&planParams);
+    LALInferenceSetREAL8Variable(&planParams,"rightascension",LAL_TWOPI*gsl_rng_uniform(thread->GSLrandom));
+    LALInferenceSetREAL8Variable(&planParams,"declination",asin(2.0*gsl_rng_uniform(thread->GSLrandom)-1.0));
+    LALInferenceSetREAL8Variable(&planParams,"polarisation",LAL_PI*gsl_rng_uniform(thread->GSLrandom));
+    LALInferenceSetREAL8Variable(&planParams,"time",time0+0.02*(gsl_rng_uniform(thread->GSLrandom)-0.5));
+    LALInferenceCopyVariables(&planParams,&refParams);
+
+    REAL8 planL=runState->likelihood(&planParams,runState->data,model);
+    model->likelihoodPlan=NULL;
+    REAL8 refL=runState->likelihood(&refParams,runState->data,model);
+    model->likelihoodPlan=plan;
+
+    UINT4 m=compare_outputs(&planParams,&refParams);
+    if(memcmp(&planL,&refL,sizeof(REAL8)))
+    {
+      fprintf(stdout,"Mismatch in logL: %.17g vs %.17g\n",planL,refL);
+      m++;
+    }
+    if(m) mismatches++;
+  }
+  fprintf(stdout,"%u of %u likelihoods differ from the general likelihood\n",mismatches,Niter);
+
+  /* CPU times add up over the threads of the plan, so the speedup is measured in wall-clock time */
+  fprintf(stdout,"Benchmarking likelihood plan:\n");
+  REAL8 wall_start=wall_time();
+  getrusage(RUSAGE_SELF, &r_usage_start);
+  for(i=0;i<Niter;i++)
+  {
+    runState->likelihood(&planParams,runState->data,model);
+  }
+  getrusage(RUSAGE_SELF, &r_usage_end);
+  REAL8 wall_plan=wall_time()-wall_start;
+  fprintf_bench(stdout, r_usage_start, r_usage_end, Niter);
+
+  fprintf(stdout,"Benchmarking general likelihood:\n");
+  model->likelihoodPlan=NULL;
+  wall_start=wall_time();
+  getrusage(RUSAGE_SELF, &r_usage_start);
+  for(i=0;i<Niter;i++)
+  {
+    runState->likelihood(&refParams,runState->data,model);
+  }
+  getrusage(RUSAGE_SELF, &r_usage_end);
+  REAL8 wall_ref=wall_time()-wall_start;
+  fprintf_bench(stdout, r_usage_start, r_usage_end, Niter);
+  model->likelihoodPlan=plan;
+
+  fprintf(stdout,"WALL likelihood plan: %e s, general likelihood: %e s per iteration, speedup %.2f\n",
+          wall_plan / (double) Niter, wall_ref / (double) Niter, wall_plan > 0 ? wall_ref / wall_plan : 0.0);
+
+  model->templt=old_templt;
+  LALInferenceClearVariables(&planParams);
+  LALInferenceClearVariables(&refParams);
+  return mismatches;
+}
+
+/*
+ * Time Niter evaluations of a random-walk proposal in all varying REAL8
+ * parameters, followed by the prior, as in a sampler: first with the
+ * proposed parameters rebuilt by every copy, and the parameters looked up
+ * by name, as before LALInferenceCopyVariables() copied in place; then with
+ * the parameters looked up by name; then through a LALInferenceREAL8View.
+ */
+void bench_proposal(LALInferenceRunState *runState, UINT4 Niter);
+void bench_proposal(LALInferenceRunState *runState, UINT4 Niter)
+{
+  UINT4 i=0,j=0,mode=0;
+  struct rusage r_usage_start,r_usage_end;
+  LALInferenceThreadState *thread=&(runState->threads[0]);
+  LALInferenceVariables proposed;
+  memset(&proposed,0,sizeof(proposed));
+  const char *modes[]={"names, rebuilding the proposed parameters","names","LALInferenceREAL8View"};
+  REAL8 logPrior=0.0;
+
+  if(!runState->prior) LALInferenceInitCBCPrior(runState);
+  LALInferenceREAL8View *view=LALInferenceCreateREAL8View(thread->currentParams);
+  if(!view)
+  {
+    fprintf(stdout,"Unable to create view of the parameters\n");
+    return;
+  }
+  REAL8 *step=XLALCalloc(view->length>0?view->length:1,sizeof(*step));
+  for(j=0;j<view->length;j++)
+    step[j]=1e-6*fabs(view->data[j]);
+
+  for(mode=0;mode<3;mode++)
+  {
+    fprintf(stdout,"Benchmarking proposal and prior, accessing parameters through %s:\n",modes[mode]);
+    getrusage(RUSAGE_SELF, &r_usage_start);
+    for(i=0;i<Niter;i++)
+    {
+      if(mode==0) LALInferenceClearVariables(&proposed);
+      LALInferenceCopyVariables(thread->currentParams,&proposed);
+      if(mode<2)
+      {
+        for(j=0;j<view->length;j++)
+        {
+          const char *name=view->names+j*VARNAME_MAX;
+          LALInferenceSetREAL8Variable(&proposed,name,LALInferenceGetREAL8Variable(&proposed,name)+step[j]*gsl_ran_ugaussian(thread->GSLrandom));
+        }
+      }
+      else
+      {
+        LALInferenceREAL8ViewGather(view,&proposed);
+        for(j=0;j<view->length;j++)
+          view->data[j]+=step[j]*gsl_ran_ugaussian(thread->GSLrandom);
+        LALInferenceREAL8ViewScatter(view,&proposed);
+      }
+      logPrior+=runState->prior(runState,&proposed,thread->model);
+    }
+    getrusage(RUSAGE_SELF, &r_usage_end);
+    fprintf_bench(stdout, r_usage_start, r_usage_end, Niter);
+    fprintf_rate(stdout, r_usage_start, r_usage_end, Niter);
+  }
+  fprintf(stdout,"Mean log prior: %lf\n",logPrior/(3.0*Niter));
+
+  XLALFree(step);
+  LALInferenceDestroyREAL8View(view);
+  LALInferenceClearVariables(&proposed);
+}
+
 void bench_template(LALInferenceRunState *runState, UINT4 Niter);
 void bench_template(LALInferenceRunState *runState, UINT4 Niter)
 {
@@ -110,7 +305,10 @@ int main(int argc, char *argv[]){
   UINT4 Niter=1000;
   UINT4 bench_L=1;
   UINT4 bench_T=1;
+  UINT4 check_plan=0;
+  UINT4 bench_P=0;
   int helpflag=0;
+  int status=0;
   procParams=LALInferenceParseCommandLine(argc,argv);
 
   if(LALInferenceGetProcParamVal(procParams,"--help"))
@@ -129,6 +327,14 @@ int main(int argc, char *argv[]){
   {
     bench_T=0; bench_L=1;
   }
+  if(LALInferenceGetProcParamVal(procParams,"--check-likelihood-plan"))
+  {
+    bench_T=bench_L=0; check_plan=!helpflag;
+  }
+  if(LALInferenceGetProcParamVal(procParams,"--bench-proposal"))
+  {
+    bench_T=bench_L=0; bench_P=!helpflag;
+  }
 
   
   runState = LALInferenceInitRunState(procParams);
@@ -161,6 +367,18 @@ int main(int argc, char *argv[]){
     bench_likelihood(runState,Niter);
     printf("\n");
   }
+  if(check_plan)
+  {
+    if(bench_likelihood_plan(runState,Niter)!=0) status=1;
+    printf("\n");
+  }
+  if(bench_P)
+  {
+    bench_proposal(runState,Niter);
+    printf("\n");
+  }
+
+  LALInferenceRemoveLikelihoodPlans(runState);
   
-  return(0);
+  return(status);
 }
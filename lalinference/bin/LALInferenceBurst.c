@@ -147,6 +147,8 @@ int main(int argc, char *argv[]){
   
   /* Call nested sampling algorithm */
   state->algorithm(state);
+
+  LALInferenceRemoveLikelihoodPlans(state);
   
   /* end */
   return(0);
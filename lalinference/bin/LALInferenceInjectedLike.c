@@ -125,6 +125,8 @@ int main(int argc, char *argv[]){
   /* write injection with noise evidence information from algorithm */
   LALInferencePrintInjectionSample(state);
 
+  LALInferenceRemoveLikelihoodPlans(state);
+
   /* end */
   return(0);
 }
@@ -124,8 +124,12 @@ int main(int argc, char *argv[]){
 
      }
 
-  /* Set up the threads */
-  LALInferenceInitCBCThreads(state,1);
+  /* Set up the threads, one for each live point replaced at once */
+  INT4 nthreads=1;
+  ProcessParamsTable *ppt=NULL;
+  if (state && (ppt=LALInferenceGetProcParamVal(state->commandLine,"--Nthreads")))
+    nthreads=atoi(ppt->value);
+  LALInferenceInitCBCThreads(state,nthreads>1?nthreads:1);
 
   /* Init the prior */
   LALInferenceInitCBCPrior(state);
@@ -159,6 +163,8 @@ int main(int argc, char *argv[]){
   /* Call nested sampling algorithm */
   state->algorithm(state);
 
+  LALInferenceRemoveLikelihoodPlans(state);
+
   /* end */
   return(0);
 }
@@ -185,13 +185,35 @@ INT4 on_your_marks(LALInferenceRunState *run_state) {
     }
 
     /* Set starting likelihood values (prior function hasn't changed) */
-    #pragma omp parallel for
-    for (walker = 0; walker < nwalkers_per_thread; walker++)
-        thread = &run_state->threads[walker];
+    LALInferenceModel *model = run_state->threads[0].model;
+    if (model->batch_likelihood) {
+        LALInferenceVariables **params = XLALCalloc(nwalkers_per_thread, sizeof(LALInferenceVariables *));
+        REAL8 *likelihoods = XLALCalloc(nwalkers_per_thread, sizeof(REAL8));
 
-        thread->currentLikelihood = run_state->likelihood(thread->currentParams,
-                                    run_state->data,
-                                    thread->model);
+        for (walker = 0; walker < nwalkers_per_thread; walker++)
+            params[walker] = run_state->threads[walker].currentParams;
+
+        if (model->batch_likelihood(params, nwalkers_per_thread, likelihoods,
+                                    run_state->data, model) != XLAL_SUCCESS) {
+            fprintf(stderr, "Failed to compute the starting likelihoods of the walkers!\n");
+            exit(1);
+        }
+
+        for (walker = 0; walker < nwalkers_per_thread; walker++)
+            run_state->threads[walker].currentLikelihood = likelihoods[walker];
+
+        XLALFree(params);
+        XLALFree(likelihoods);
+    } else {
+        #pragma omp parallel for
+        for (walker = 0; walker < nwalkers_per_thread; walker++) {
+            LALInferenceThreadState *walker_thread = &run_state->threads[walker];
+
+            walker_thread->currentLikelihood = run_state->likelihood(walker_thread->currentParams,
+                                                run_state->data,
+                                                walker_thread->model);
+        }
+    }
 
     return XLAL_SUCCESS;
 }
@@ -208,6 +230,8 @@ INT4 init_ensemble(LALInferenceRunState *run_state) {
     (--skip n)            Number of steps between writing samples to file (100).\n\
     (--update-interval n) Number of steps between ensemble updates (100).\n\
     (--randomseed seed)   Random seed of sampling distribution (random).\n\
+    (--no-batch-likelihood) Compute the likelihood of each walker with its own model,\n\
+                            instead of in batches.\n\
     \n\
     ----------------------------------------------\n\
     --- Output -----------------------------------\n\
@@ -358,15 +382,23 @@ INT4 sample_prior(LALInferenceRunState *run_state) {
     nprior_steps = 2 * update_interval - 1;
     LALInferenceSetVariable(algorithm_params, "nsteps", &nprior_steps);
 
-    /* Use the "null" likelihood function in order to sample the prior */
+    /* Use the "null" likelihood function in order to sample the prior,
+     *   without the batched form of the full likelihood */
     run_state->likelihood = &LALInferenceZeroLogLikelihood;
+    LALInferenceModel *model = run_state->threads[0].model;
+    LALInferenceBatchLikelihoodFunction batch_likelihood = model->batch_likelihood;
+    model->batch_likelihood = NULL;
 
     /* Run the sampler to completion */
     run_state->algorithm(run_state);
 
+    /* Free the likelihood plans, which are set up again with the full likelihood */
+    LALInferenceRemoveLikelihoodPlans(run_state);
+
     /* Restore algorithm parameters and likelihood function */
     LALInferenceSetVariable(algorithm_params, "nsteps", &nsteps);
     LALInferenceInitLikelihood(run_state);
+    model->batch_likelihood = batch_likelihood;
 
     return XLAL_SUCCESS;
 }
@@ -426,6 +458,22 @@ int main(int argc, char *argv[]){
     if (run_state == NULL)
         return XLAL_FAILURE;
 
+    /* Compute the likelihoods of the walkers on this MPI thread in batches,
+     *   shared between OpenMP threads, each walker with its own model */
+    if (!LALInferenceGetProcParamVal(proc_params, "--no-batch-likelihood")) {
+        LALInferenceModel **models = XLALCalloc(run_state->nthreads, sizeof(LALInferenceModel *));
+        INT4 walker;
+        for (walker = 0; walker < run_state->nthreads; walker++)
+            models[walker] = run_state->threads[walker].model;
+
+        if (LALInferenceInitBatchLikelihood(run_state->threads[0].model, run_state->likelihood,
+                                            models, run_state->nthreads) != XLAL_SUCCESS) {
+            fprintf(stderr, "Failed to set up the batched likelihood!\n");
+            exit(1);
+        }
+        XLALFree(models);
+    }
+
     /* Setup the initial state of the walkers */
     on_your_marks(run_state);
 
@@ -435,6 +483,10 @@ int main(int argc, char *argv[]){
     if (mpi_rank == 0)
         printf(" ==========  sampling complete ==========\n");
 
+    /* Free the batched likelihood and the compiled likelihood plans of the models */
+    LALInferenceRemoveBatchLikelihood(run_state->threads[0].model);
+    LALInferenceRemoveLikelihoodPlans(run_state);
+
     /* Close down MPI parallelization and return */
     MPI_Finalize();
 
@@ -48,10 +48,12 @@ void ensemble_sampler(struct tagLALInferenceRunState *run_state) {
     INT4 *acceptance_buffer;
     REAL8 *acceptance_rates;
     REAL8 acceptance_rate, min_acceptance_rate, max_acceptance_rate;
-    REAL8 *prop_priors, *prop_likelihoods, *prop_densities;
+    REAL8 *prop_priors, *prop_likelihoods, *prop_densities, *prop_ratios;
+    LALInferenceVariables **batch_params;
     INT4 update = 0;
     FILE *output = NULL;
     LALInferenceThreadState *thread;
+    LALInferenceModel *model = run_state->threads[0].model;
 
     /* Initialize LIGO status */
     LALStatus status;
@@ -88,6 +90,10 @@ void ensemble_sampler(struct tagLALInferenceRunState *run_state) {
     prop_likelihoods = XLALCalloc(nwalkers_per_thread, sizeof(REAL8));
     prop_densities = XLALCalloc(nwalkers_per_thread, sizeof(REAL8));
 
+    /* Arrays for computing the likelihoods of all proposals at once */
+    prop_ratios = XLALCalloc(nwalkers_per_thread, sizeof(REAL8));
+    batch_params = XLALCalloc(nwalkers_per_thread, sizeof(LALInferenceVariables *));
+
     /* Open output and print header */
     output = init_ensemble_output(run_state, verbose, mpi_rank);
 
@@ -109,13 +115,36 @@ void ensemble_sampler(struct tagLALInferenceRunState *run_state) {
             max_acceptance_rate = 0.0;
         }
 
+        /* Propose new positions for all walkers on this MPI-thread, and
+         *   compute the likelihoods of those within the prior in one batch */
+        if (model->batch_likelihood) {
+            #pragma omp parallel for private(thread)
+            for (walker=0; walker<nwalkers_per_thread; walker++) {
+                thread = &run_state->threads[walker];
+
+                prop_ratios[walker] = walker_propose(run_state, thread, &(prop_priors[walker]),
+                                                     &(prop_densities[walker]));
+                batch_params[walker] = isfinite(prop_priors[walker]) ? thread->proposedParams : NULL;
+            }
+
+            if (model->batch_likelihood(batch_params, nwalkers_per_thread, prop_likelihoods,
+                                        run_state->data, model) != XLAL_SUCCESS) {
+                fprintf(stderr, "Failed to compute the likelihoods of the proposals at step %i!\n", *step);
+                exit(1);
+            }
+        }
+
         /* Update all walkers on this MPI-thread */
         #pragma omp parallel for private(thread)
         for (walker=0; walker<nwalkers_per_thread; walker++) {
             thread = &run_state->threads[walker];
 
-            walker_step(run_state, thread, &(prop_priors[walker]),
-                        &(prop_likelihoods[walker]), &(prop_densities[walker]));
+            if (model->batch_likelihood)
+                walker_accept(thread, prop_ratios[walker], prop_priors[walker],
+                              prop_likelihoods[walker], prop_densities[walker]);
+            else
+                walker_step(run_state, thread, &(prop_priors[walker]),
+                            &(prop_likelihoods[walker]), &(prop_densities[walker]));
 
             /* Track acceptance rates */
             acceptance_buffer[walker + (*step % tracking_interval)] = thread->accepted;
@@ -155,19 +184,34 @@ void ensemble_sampler(struct tagLALInferenceRunState *run_state) {
     for (walker=0; walker<nwalkers_per_thread; walker++)
         run_state->threads[walker].currentPropDensity = -INFINITY;
 
+    XLALFree(prop_ratios);
+    XLALFree(batch_params);
+
     fclose(output);
     return;
 }
 
 void walker_step(LALInferenceRunState *run_state, LALInferenceThreadState *thread,
                  REAL8 *proposed_prior, REAL8 *proposed_likelihood, REAL8 *proposed_prop_density) {
-    REAL8 proposal_ratio, acceptance_probability;
-
-    thread->accepted = 0;
+    REAL8 proposal_ratio;
 
-    *proposed_prior = -INFINITY;
     *proposed_likelihood = -INFINITY;
 
+    proposal_ratio = walker_propose(run_state, thread, proposed_prior, proposed_prop_density);
+
+    /* Only bother calculating likelihood if within prior boundaries */
+    if (isfinite(*proposed_prior))
+        *proposed_likelihood = run_state->likelihood(thread->proposedParams,
+                                                     run_state->data, thread->model);
+
+    walker_accept(thread, proposal_ratio, *proposed_prior, *proposed_likelihood,
+                  *proposed_prop_density);
+}
+
+REAL8 walker_propose(LALInferenceRunState *run_state, LALInferenceThreadState *thread,
+                     REAL8 *proposed_prior, REAL8 *proposed_prop_density) {
+    REAL8 proposal_ratio;
+
     /* Get the probability of proposing the reverse jump */
     *proposed_prop_density = thread->currentPropDensity;
     proposal_ratio = LALInferenceStoredClusteredKDEProposal(thread,
@@ -175,14 +219,19 @@ void walker_step(LALInferenceRunState *run_state, LALInferenceThreadState *threa
                                                             thread->proposedParams,
                                                             proposed_prop_density);
 
-    /* Only bother calculating likelihood if within prior boundaries */
     *proposed_prior = run_state->prior(run_state, thread->proposedParams, thread->model);
-    if (isfinite(*proposed_prior))
-        *proposed_likelihood = run_state->likelihood(thread->proposedParams,
-                                                     run_state->data, thread->model);
+
+    return proposal_ratio;
+}
+
+void walker_accept(LALInferenceThreadState *thread, REAL8 proposal_ratio,
+                   REAL8 proposed_prior, REAL8 proposed_likelihood, REAL8 proposed_prop_density) {
+    REAL8 acceptance_probability;
+
+    thread->accepted = 0;
 
     /* Find jump acceptance probability */
-    acceptance_probability = (*proposed_prior + *proposed_likelihood)
+    acceptance_probability = (proposed_prior + proposed_likelihood)
                             - (thread->currentPrior + thread->currentLikelihood)
                             + proposal_ratio;
 
@@ -190,9 +239,9 @@ void walker_step(LALInferenceRunState *run_state, LALInferenceThreadState *threa
     if (acceptance_probability > 0
             || (log(gsl_rng_uniform(thread->GSLrandom)) < acceptance_probability)) {
         LALInferenceCopyVariables(thread->proposedParams, thread->currentParams);
-        thread->currentPrior = *proposed_prior;
-        thread->currentLikelihood = *proposed_likelihood;
-        thread->currentPropDensity = *proposed_prop_density;
+        thread->currentPrior = proposed_prior;
+        thread->currentLikelihood = proposed_likelihood;
+        thread->currentPropDensity = proposed_prop_density;
 
         thread->accepted = 1;
     }
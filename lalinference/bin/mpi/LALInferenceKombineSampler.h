@@ -41,6 +41,14 @@ void ensemble_sampler(LALInferenceRunState *run_state);
 void walker_step(LALInferenceRunState *run_state, LALInferenceThreadState *thread,
                  REAL8 *proposed_prior, REAL8 *proposed_likelihood, REAL8 *proposed_prop_density);
 
+/** Propose a new position for a walker, and return the log proposal ratio */
+REAL8 walker_propose(LALInferenceRunState *run_state, LALInferenceThreadState *thread,
+                     REAL8 *proposed_prior, REAL8 *proposed_prop_density);
+
+/** Accept or reject the proposed position of a walker */
+void walker_accept(LALInferenceThreadState *thread, REAL8 proposal_ratio,
+                   REAL8 proposed_prior, REAL8 proposed_likelihood, REAL8 proposed_prop_density);
+
 /** Update the ensemble proposal from the ensemble's current state */
 REAL8 get_acceptance_rate(LALInferenceRunState *run_state, REAL8 *local_acceptance_rates);
 
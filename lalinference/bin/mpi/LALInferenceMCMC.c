@@ -23,6 +23,7 @@
 
 
 #include <stdio.h>
+#include <lal/LALStdio.h>
 #include <lal/Date.h>
 #include <lal/GenerateInspiral.h>
 #include <lal/LALInference.h>
@@ -666,7 +667,7 @@ ProcessParamsTable *LALInferenceContinueMCMC(char *infileName) {
 
 
 int main(int argc, char *argv[]){
-    INT4 mpirank;
+    INT4 mpirank, i;
     ProcessParamsTable *procParams = NULL, *ppt = NULL;
     LALInferenceRunState *runState = NULL;
     LALInferenceIFOData *data = NULL;
@@ -732,6 +733,17 @@ int main(int argc, char *argv[]){
     if (mpirank == 0) printf("sampling...\n");
     runState->algorithm(runState);
 
+    /* Report how often each chain reused a cached waveform */
+    for (i=0; i<runState->nthreads; i++) {
+        LALSimInspiralWaveformCache *cache = runState->threads[i].model->waveformCache;
+        if (cache && cache->hits + cache->misses > 0)
+            printf("Chain %d: waveform cache hit rate %.1f%% (%" LAL_UINT8_FORMAT " hits, %" LAL_UINT8_FORMAT " misses)\n",
+                   runState->threads[i].id, 100.0 * cache->hits / (cache->hits + cache->misses),
+                   cache->hits, cache->misses);
+    }
+
+    LALInferenceRemoveLikelihoodPlans(runState);
+
     if (mpirank == 0) printf(" ========== main(): finished. ==========\n");
     MPI_Finalize();
 
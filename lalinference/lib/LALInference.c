@@ -82,6 +82,20 @@ static int LALInferenceElemCmp(const void *elem1, const void *elem2)
   return(strncmp(((const hash_elem *)elem1)->name,((const hash_elem *)elem2)->name,VARNAME_MAX));
 }
 
+/* Source of LALInferenceVariables generations, unique across all structures
+ * so that a structure re-used at the same address never repeats one */
+static UINT8 LALInferenceVariablesGenerationCounter = 0;
+
+/* Mark a change in the list nodes of vars, invalidating cached handles */
+static void LALInferenceNewVariablesGeneration(LALInferenceVariables *vars)
+{
+  UINT8 generation;
+  /* structures may be modified by several OpenMP threads */
+  #pragma omp atomic capture
+  generation = ++LALInferenceVariablesGenerationCounter;
+  vars->generation = generation;
+}
+
 
 size_t LALInferenceTypeSize[] = {sizeof(INT4),
                                    sizeof(INT8),
@@ -231,6 +245,7 @@ LALInferenceParamVaryType LALInferenceGetVariableVaryType(LALInferenceVariables
 void LALInferenceSetParamVaryType(LALInferenceVariables *vars, const char *name, LALInferenceParamVaryType vary)
 {
   LALInferenceVariableItem *item = LALInferenceGetItem(vars,name);
+  if(item->vary != vary) LALInferenceNewVariablesGeneration(vars);
   item->vary = vary;
   return;
 }
@@ -444,6 +459,7 @@ void LALInferenceAddVariable(LALInferenceVariables * vars, const char * name, co
   hash_elem *elem=new_elem(new->name,new);
   XLALHashTblAdd(vars->hash_table,(void *)elem);
   vars->dimension++;
+  LALInferenceNewVariablesGeneration(vars);
   return;
 }
 
@@ -497,6 +513,7 @@ void LALInferenceRemoveVariable(LALInferenceVariables *vars,const char *name)
   XLALFree(this);
   this=NULL;
   vars->dimension--;
+  LALInferenceNewVariablesGeneration(vars);
   return;
 }
 
@@ -551,10 +568,86 @@ void LALInferenceClearVariables(LALInferenceVariables *vars)
   vars->dimension=0;
   if(vars->hash_table) XLALHashTblDestroy(vars->hash_table);
   vars->hash_table=NULL;
+  LALInferenceNewVariablesGeneration(vars);
   
   return;
 }
 
+/* Copy a vector variable into an existing vector variable, reusing its memory if the lengths agree */
+#define COPY_VECTOR_IN_PLACE(TYPE) \
+  case LALINFERENCE_##TYPE##_t: \
+  { \
+    TYPE *old=*(TYPE **)optr->value; \
+    TYPE **new=(TYPE **)tptr->value; \
+    if(!*new || (*new)->length!=old->length) \
+    { \
+      XLALDestroy##TYPE(*new); \
+      *new=XLALCreate##TYPE(old->length); \
+      if(!*new) XLAL_ERROR(XLAL_ENOMEM,"Unable to copy vector!\n"); \
+    } \
+    memcpy((*new)->data,old->data,old->length*sizeof(old->data[0])); \
+    break; \
+  }
+
+/* Copy the values of "origin" into the list nodes of "target", if both have the
+ * same variables with the same types in the same order, as is the case for the
+ * current and proposed parameters of a sampler. This avoids reallocating every
+ * node, and rebuilding the hash table, on every proposal. Returns 1 if the values
+ * were copied, 0 if "target" has to be rebuilt. */
+static int LALInferenceCopyVariablesInPlace(LALInferenceVariables *origin, LALInferenceVariables *target)
+{
+  LALInferenceVariableItem *optr,*tptr;
+  int vary_changed=0;
+
+  if(target->dimension==0 || origin->dimension!=target->dimension) return 0;
+  for(optr=origin->head,tptr=target->head; optr && tptr; optr=optr->next,tptr=tptr->next)
+    if(optr->type!=tptr->type || strcmp(optr->name,tptr->name)) return 0;
+  if(optr || tptr) return 0;
+
+  for(optr=origin->head,tptr=target->head; optr; optr=optr->next,tptr=tptr->next)
+  {
+    if(!optr->value){
+      XLAL_ERROR(XLAL_EFAULT, "Badly formed LALInferenceVariableItem structure!");
+    }
+    switch (optr->type)
+    {
+      case LALINFERENCE_gslMatrix_t:
+      {
+        gsl_matrix *old=*(gsl_matrix **)optr->value;
+        gsl_matrix **new=(gsl_matrix **)tptr->value;
+        if(!*new || (*new)->size1!=old->size1 || (*new)->size2!=old->size2)
+        {
+          if(*new) gsl_matrix_free(*new);
+          *new=gsl_matrix_alloc(old->size1,old->size2);
+          if(!*new) XLAL_ERROR(XLAL_ENOMEM,"Unable to create %zux%zu matrix\n",old->size1,old->size2);
+        }
+        gsl_matrix_memcpy(*new,old);
+        break;
+      }
+      COPY_VECTOR_IN_PLACE(INT4Vector)
+      COPY_VECTOR_IN_PLACE(UINT4Vector)
+      COPY_VECTOR_IN_PLACE(REAL8Vector)
+      COPY_VECTOR_IN_PLACE(COMPLEX16Vector)
+      default:
+        /* Just memcpy */
+        memcpy(tptr->value,optr->value,LALInferenceTypeSize[optr->type]);
+        break;
+    }
+    if(tptr->vary!=optr->vary)
+    {
+      tptr->vary=optr->vary;
+      vary_changed=1;
+    }
+  }
+
+  /* The set of varying parameters has changed */
+  if(vary_changed) LALInferenceNewVariablesGeneration(target);
+
+  return 1;
+}
+
+#undef COPY_VECTOR_IN_PLACE
+
 void LALInferenceCopyVariables(LALInferenceVariables *origin, LALInferenceVariables *target)
 /*  copy contents of "origin" over to "target"  */
 {
@@ -572,6 +665,17 @@ void LALInferenceCopyVariables(LALInferenceVariables *origin, LALInferenceVariab
   /* Make sure the structure is initialised */
   if(!target) XLAL_ERROR_VOID(XLAL_EFAULT, "Unable to copy to uninitialised LALInferenceVariables structure.");
 
+  /* Copy values only if the target already has the same variables */
+  switch (LALInferenceCopyVariablesInPlace(origin, target))
+  {
+    case 0:
+      break;
+    case 1:
+      return;
+    default:
+      XLAL_ERROR_VOID(XLAL_EFUNC);
+  }
+
   /* First clear the target */
   LALInferenceClearVariables(target);
 
@@ -1756,6 +1860,181 @@ void LALInferenceCopyArrayToVariables(REAL8 *origin, LALInferenceVariables *targ
   return;
 }
 
+void LALInferenceInitVariableSlot(LALInferenceVariableSlot *slot, const char *name)
+{
+  if(!slot || !name) XLAL_ERROR_VOID(XLAL_EFAULT);
+  memset(slot,0,sizeof(*slot));
+  if(VARNAME_MAX <= snprintf(slot->name, VARNAME_MAX, "%s", name))
+    XLAL_ERROR_VOID(XLAL_EINVAL, "Variable name %s too long. Maximum length %i", name, VARNAME_MAX);
+}
+
+LALInferenceVariableItem *LALInferenceGetSlotItem(const LALInferenceVariables *vars, LALInferenceVariableSlot *slot)
+/* Returns the cached list node if vars has not changed since it was looked up,
+   otherwise looks it up by name */
+{
+  if(slot->item && slot->vars==vars && slot->generation==vars->generation)
+    return slot->item;
+  slot->item=LALInferenceGetItem(vars,slot->name);
+  slot->vars=vars;
+  slot->generation=vars?vars->generation:0;
+  return slot->item;
+}
+
+int LALInferenceCheckVariableSlot(const LALInferenceVariables *vars, LALInferenceVariableSlot *slot)
+{
+  if(LALInferenceGetSlotItem(vars,slot)) return 1;
+  else return 0;
+}
+
+void *LALInferenceGetVariableSlot(const LALInferenceVariables *vars, LALInferenceVariableSlot *slot)
+{
+  LALInferenceVariableItem *item=LALInferenceGetSlotItem(vars,slot);
+  if(!item) {
+    XLAL_ERROR_NULL(XLAL_EFAILED, "Entry \"%s\" not found.", slot->name);
+  }
+  return(item->value);
+}
+
+REAL8 LALInferenceGetREAL8Slot(const LALInferenceVariables *vars, LALInferenceVariableSlot *slot)
+{
+  LALInferenceVariableItem *item=LALInferenceGetSlotItem(vars,slot);
+  if(!item || item->type!=LALINFERENCE_REAL8_t) {
+    XLAL_ERROR_REAL8(XLAL_ETYPE, "Entry \"%s\" not found or of wrong type.", slot->name);
+  }
+  return *(REAL8 *)item->value;
+}
+
+void LALInferenceSetREAL8Slot(LALInferenceVariables *vars, LALInferenceVariableSlot *slot, REAL8 value)
+{
+  LALInferenceVariableItem *item=LALInferenceGetSlotItem(vars,slot);
+  if(!item) {
+    XLAL_ERROR_VOID(XLAL_EINVAL, "Entry \"%s\" not found.", slot->name);
+  }
+  if(item->type!=LALINFERENCE_REAL8_t) {
+    XLAL_ERROR_VOID(XLAL_ETYPE, "Entry \"%s\" is not of type REAL8.", slot->name);
+  }
+  if (item->vary==LALINFERENCE_PARAM_FIXED)
+  {
+    XLALPrintWarning("Warning! Attempting to set variable %s which is fixed\n",item->name);
+    return;
+  }
+  *(REAL8 *)item->value=value;
+}
+
+/* Variables which are in a LALInferenceREAL8View */
+static int LALInferenceIsREAL8ViewItem(const LALInferenceVariableItem *item)
+{
+  return item->type==LALINFERENCE_REAL8_t && (item->vary==LALINFERENCE_PARAM_LINEAR || item->vary==LALINFERENCE_PARAM_CIRCULAR);
+}
+
+/* Return the list nodes in vars of the variables of the view, binding the view to vars if
+   it is not one of the two structures the view was most recently used with */
+static LALInferenceVariableItem **LALInferenceBindREAL8View(LALInferenceREAL8View *view, const LALInferenceVariables *vars)
+{
+  LALInferenceREAL8ViewBinding *binding;
+  LALInferenceVariableItem *item;
+  UINT4 b,i;
+
+  for(b=0;b<2;b++)
+  {
+    binding=&view->bindings[b];
+    if(binding->vars==vars && binding->generation==vars->generation)
+    {
+      view->next=1-b;
+      return binding->items;
+    }
+  }
+
+  /* Walk the list, checking that it has the variables of the view in the same order */
+  binding=&view->bindings[view->next];
+  binding->vars=NULL;
+  for(i=0,item=vars->head;item;item=item->next)
+  {
+    if(!LALInferenceIsREAL8ViewItem(item)) continue;
+    if(i>=view->length || strncmp(item->name,view->names+i*VARNAME_MAX,VARNAME_MAX))
+      XLAL_ERROR_NULL(XLAL_EINVAL, "Varying REAL8 variable \"%s\" is not in the view.", item->name);
+    binding->items[i++]=item;
+  }
+  if(i!=view->length)
+    XLAL_ERROR_NULL(XLAL_EINVAL, "Only %u of %u variables of the view are varying REAL8 variables.", i, view->length);
+  binding->vars=vars;
+  binding->generation=vars->generation;
+  view->next=1-view->next;
+  return binding->items;
+}
+
+LALInferenceREAL8View *LALInferenceCreateREAL8View(const LALInferenceVariables *vars)
+{
+  LALInferenceVariableItem *item;
+  UINT4 b,i,length=0;
+
+  if(!vars) XLAL_ERROR_NULL(XLAL_EFAULT);
+  for(item=vars->head;item;item=item->next)
+    if(LALInferenceIsREAL8ViewItem(item)) length++;
+
+  LALInferenceREAL8View *view=XLALCalloc(1,sizeof(*view));
+  if(!view) XLAL_ERROR_NULL(XLAL_ENOMEM);
+  view->length=length;
+  view->data=XLALCalloc(length>0?length:1,sizeof(*view->data));
+  view->names=XLALCalloc(length>0?length:1,VARNAME_MAX);
+  for(b=0;b<2;b++) view->bindings[b].items=XLALCalloc(length>0?length:1,sizeof(*view->bindings[b].items));
+  if(!view->data || !view->names || !view->bindings[0].items || !view->bindings[1].items)
+  {
+    LALInferenceDestroyREAL8View(view);
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  }
+
+  for(i=0,item=vars->head;item;item=item->next)
+    if(LALInferenceIsREAL8ViewItem(item))
+      memcpy(view->names+(i++)*VARNAME_MAX,item->name,VARNAME_MAX);
+
+  if(LALInferenceREAL8ViewGather(view,vars)!=XLAL_SUCCESS)
+  {
+    LALInferenceDestroyREAL8View(view);
+    XLAL_ERROR_NULL(XLAL_EFUNC);
+  }
+
+  return view;
+}
+
+void LALInferenceDestroyREAL8View(LALInferenceREAL8View *view)
+{
+  if(!view) return;
+  XLALFree(view->data);
+  XLALFree(view->names);
+  XLALFree(view->bindings[0].items);
+  XLALFree(view->bindings[1].items);
+  XLALFree(view);
+}
+
+int LALInferenceREAL8ViewGather(LALInferenceREAL8View *view, const LALInferenceVariables *vars)
+{
+  if(!view || !vars) XLAL_ERROR(XLAL_EFAULT);
+  LALInferenceVariableItem **items=LALInferenceBindREAL8View(view,vars);
+  if(!items) XLAL_ERROR(XLAL_EFUNC);
+  for(UINT4 i=0;i<view->length;i++)
+    view->data[i]=*(REAL8 *)items[i]->value;
+  return XLAL_SUCCESS;
+}
+
+int LALInferenceREAL8ViewScatter(LALInferenceREAL8View *view, LALInferenceVariables *vars)
+{
+  if(!view || !vars) XLAL_ERROR(XLAL_EFAULT);
+  LALInferenceVariableItem **items=LALInferenceBindREAL8View(view,vars);
+  if(!items) XLAL_ERROR(XLAL_EFUNC);
+  for(UINT4 i=0;i<view->length;i++)
+    *(REAL8 *)items[i]->value=view->data[i];
+  return XLAL_SUCCESS;
+}
+
+INT4 LALInferenceREAL8ViewIndex(const LALInferenceREAL8View *view, const char *name)
+{
+  if(!view || !name) XLAL_ERROR(XLAL_EFAULT);
+  for(UINT4 i=0;i<view->length;i++)
+    if(!strncmp(view->names+i*VARNAME_MAX,name,VARNAME_MAX)) return (INT4)i;
+  return -1;
+}
+
 /* ============ Command line parsing functions etc.: ========== */
 
 
@@ -2200,6 +2479,7 @@ LALInferenceVariableItem *LALInferencePopVariableItem(LALInferenceVariables *var
   *prevPtr=thisPtr->next;
   thisPtr->next=NULL;
   vars->dimension--;
+  LALInferenceNewVariablesGeneration(vars);
   return thisPtr;
 }
 
@@ -2224,6 +2504,7 @@ void LALInferenceSortVariablesByName(LALInferenceVariables *vars)
 	vars->dimension++; /* Increase the dimension which was decreased by PopVariableItem */
   }
   vars->head=newHead;
+  LALInferenceNewVariablesGeneration(vars);
   return;
 }
 
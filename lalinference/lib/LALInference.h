@@ -177,8 +177,57 @@ tagLALInferenceVariables
   LALInferenceVariableItem	*head;
   INT4 				dimension;
   LALHashTbl        *hash_table;
+  UINT8             generation; /**< Changed whenever items are added, removed, reordered, or change vary type */
 } LALInferenceVariables;
 
+/**
+ * Handle to a variable, which caches the list node of a variable once it
+ * has been looked up by name, so that the variable can be read and written
+ * without hashing its name again. The cached node is used as long as the
+ * handle is used with the same LALInferenceVariables structure, and no
+ * variables have been added to or removed from it; otherwise the name is
+ * looked up again. Use one handle per LALInferenceVariables structure for
+ * O(1) access. Initialise with LALInferenceInitVariableSlot().
+ */
+typedef struct
+tagLALInferenceVariableSlot
+{
+  char                          name[VARNAME_MAX];
+  const LALInferenceVariables   *vars;       /**< Structure the node was looked up in */
+  UINT8                         generation;  /**< Generation of \c vars when the node was looked up */
+  LALInferenceVariableItem      *item;       /**< Cached list node */
+} LALInferenceVariableSlot;
+
+/**
+ * Binding of a LALInferenceREAL8View to the list nodes of one
+ * LALInferenceVariables structure. Internal to LALInferenceREAL8View.
+ */
+typedef struct
+tagLALInferenceREAL8ViewBinding
+{
+  const LALInferenceVariables   *vars;
+  UINT8                         generation;
+  LALInferenceVariableItem      **items;
+} LALInferenceREAL8ViewBinding;
+
+/**
+ * Contiguous array view of the varying (LINEAR or CIRCULAR) REAL8
+ * variables of a LALInferenceVariables structure, in list order, which is
+ * the order of LALInferenceCopyVariablesToArray(). The view can be used
+ * with any LALInferenceVariables with the same varying REAL8 variables,
+ * e.g. the current and proposed parameters of a sampler; it remembers the
+ * list nodes of the two structures it was used with most recently.
+ */
+typedef struct
+tagLALInferenceREAL8View
+{
+  UINT4                         length;      /**< Number of varying REAL8 variables */
+  REAL8                         *data;       /**< Values of the variables */
+  char                          *names;      /**< Names of the variables, \c VARNAME_MAX characters each */
+  LALInferenceREAL8ViewBinding  bindings[2]; /**< Most recently used structures */
+  UINT4                         next;        /**< Binding to replace next */
+} LALInferenceREAL8View;
+
 /**
  * Phase of MCMC run (depending on burn-in status, different actions
  * are performed during the run, and this tag controls the activity).
@@ -314,7 +363,11 @@ int LALInferenceCheckVariableToPrint(LALInferenceVariables *vars, const char *na
  */
 void LALInferenceClearVariables(LALInferenceVariables *vars);
 
-/** Deep copy the variables from one to another LALInferenceVariables structure */
+/**
+ * Deep copy the variables from one to another LALInferenceVariables structure.
+ * If \c target already has the same variables, with the same types and in the
+ * same order, as \c origin, the values are copied into the existing list nodes.
+ */
 void LALInferenceCopyVariables(LALInferenceVariables *origin, LALInferenceVariables *target);
 
 /*  Copy REAL8s from "origin" to "target" if they weren't set on the command line */
@@ -413,6 +466,15 @@ typedef REAL8 (*LALInferencePriorFunction) (struct tagLALInferenceRunState *runS
 typedef UINT4 (*LALInferenceCubeToPriorFunction) (struct tagLALInferenceRunState *runState,
   LALInferenceVariables *params, struct tagLALInferenceModel *model, double *cube, void *context);
 
+/**
+ * Type declaration for a batched likelihood function, which computes the
+ * likelihoods \c logL[i] of the \c n points \c params[i] together.
+ * A NULL \c params[i] is skipped and given \c logL[i] = -INFINITY.
+ * Returns XLAL_SUCCESS, or XLAL_FAILURE on error.
+ */
+typedef int (*LALInferenceBatchLikelihoodFunction) (LALInferenceVariables **params, UINT4 n, REAL8 *logL,
+        struct tagLALInferenceIFOData *data, struct tagLALInferenceModel *model);
+
 /**
  * Detector-dependent buffers and parameters
  * A linked list meant for parameters and buffers that are separately specified for
@@ -472,6 +534,9 @@ typedef struct tagLALInferenceModel
   struct tagLALInferenceROQModel *roq; /** ROQ data */
   int roq_flag;               /** Is ROQ enabled */
   LALSimNeutronStarFamily     *eos_fam; /** Neutron Star equation of state family */
+  struct tagLALInferenceLikelihoodPlan *likelihoodPlan; /** Compiled likelihood, see LALInferenceCreateLikelihoodPlan() */
+  LALInferenceBatchLikelihoodFunction batch_likelihood; /** Likelihood of many points at once, see LALInferenceInitBatchLikelihood() */
+  struct tagLALInferenceBatchLikelihood *batch; /** Models of batch_likelihood */
 
 } LALInferenceModel;
 
@@ -856,6 +921,45 @@ void LALInferenceCopyVariablesToArray(LALInferenceVariables *origin, REAL8 *targ
 
 void LALInferenceCopyArrayToVariables(REAL8 *origin, LALInferenceVariables *target);
 
+/** Initialise a handle to the variable \c name; see LALInferenceVariableSlot */
+void LALInferenceInitVariableSlot(LALInferenceVariableSlot *slot, const char *name);
+
+/** Return the list node of the variable \c slot in \c vars, or NULL if it is not present */
+LALInferenceVariableItem *LALInferenceGetSlotItem(const LALInferenceVariables *vars, LALInferenceVariableSlot *slot);
+
+/** Checks for the variable \c slot being present in \c vars; returns 1 or 0 */
+int LALInferenceCheckVariableSlot(const LALInferenceVariables *vars, LALInferenceVariableSlot *slot);
+
+/** As LALInferenceGetVariable(), for a variable handle */
+void *LALInferenceGetVariableSlot(const LALInferenceVariables *vars, LALInferenceVariableSlot *slot);
+
+/** As LALInferenceGetREAL8Variable(), for a variable handle */
+REAL8 LALInferenceGetREAL8Slot(const LALInferenceVariables *vars, LALInferenceVariableSlot *slot);
+
+/** As LALInferenceSetREAL8Variable(), for a variable handle */
+void LALInferenceSetREAL8Slot(LALInferenceVariables *vars, LALInferenceVariableSlot *slot, REAL8 value);
+
+/** Create a contiguous view of the varying REAL8 variables in \c vars; see LALInferenceREAL8View */
+LALInferenceREAL8View *LALInferenceCreateREAL8View(const LALInferenceVariables *vars);
+
+/** Free a LALInferenceREAL8View */
+void LALInferenceDestroyREAL8View(LALInferenceREAL8View *view);
+
+/**
+ * Copy the values of the variables of \c view from \c vars into \c view->data.
+ * Fails with XLAL_EINVAL if the varying REAL8 variables in \c vars are not those of the view.
+ */
+int LALInferenceREAL8ViewGather(LALInferenceREAL8View *view, const LALInferenceVariables *vars);
+
+/**
+ * Copy \c view->data into the values of the variables of \c view in \c vars.
+ * Fails with XLAL_EINVAL if the varying REAL8 variables in \c vars are not those of the view.
+ */
+int LALInferenceREAL8ViewScatter(LALInferenceREAL8View *view, LALInferenceVariables *vars);
+
+/** Return the index of the variable \c name in \c view->data, or -1 if it is not in the view */
+INT4 LALInferenceREAL8ViewIndex(const LALInferenceREAL8View *view, const char *name);
+
 /**
  * Append the sample to a file. file pointer is stored in state->algorithmParams as a
  * LALInferenceVariable called "outfile", as a void ptr.
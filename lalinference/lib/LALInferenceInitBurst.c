@@ -240,6 +240,9 @@ LALInferenceModel * LALInferenceInitBurstModel(LALInferenceRunState *state)
   LALInferenceModel *model = XLALMalloc(sizeof(LALInferenceModel));
   model->params = XLALCalloc(1, sizeof(LALInferenceVariables));
   memset(model->params, 0, sizeof(LALInferenceVariables));
+  model->likelihoodPlan = NULL;
+  model->batch_likelihood = NULL;
+  model->batch = NULL;
   LALInferenceVariables *currentParams=model->params;
 
   UINT4 signal_flag=1;
@@ -21,6 +21,8 @@
 
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
 #include <assert.h>
 #include <errno.h>
 #include <lal/Date.h>
@@ -768,6 +770,8 @@ LALInferenceModel *LALInferenceInitCBCModel(LALInferenceRunState *state) {
                                  Options and default values can be found in https://lscsoft.docs.ligo.org/lalsuite/lalsimulation/group___l_a_l_sim_i_m_r_phenom_x__c.html\n\
     (--phenomXPrecVersion int)   Change version of the Euler angles for the twisting-up of IMRPhenomXP/IMRPhenomXPHM.\n\
                                  Options and default values can be found in https://lscsoft.docs.ligo.org/lalsuite/lalsimulation/group___l_a_l_sim_i_m_r_phenom_x__c.html\n\
+    (--waveform-cache-size N)    Number of recently generated waveforms to keep for reuse when only extrinsic parameters change (default 1).\n\
+    (--waveform-cache-memory MB) Memory budget of the waveform cache in megabytes (default: no limit).\n\
 \n\
     ----------------------------------------------\n\
     --- Starting Parameters ----------------------\n\
@@ -930,6 +934,9 @@ LALInferenceModel *LALInferenceInitCBCModel(LALInferenceRunState *state) {
   model->params = XLALCalloc(1, sizeof(LALInferenceVariables));
   memset(model->params, 0, sizeof(LALInferenceVariables));
   model->eos_fam = NULL;
+  model->likelihoodPlan = NULL;
+  model->batch_likelihood = NULL;
+  model->batch = NULL;
 
   UINT4 signal_flag=1;
   ppt = LALInferenceGetProcParamVal(commandLine, "--noiseonly");
@@ -1640,7 +1647,27 @@ LALInferenceModel *LALInferenceInitCBCModel(LALInferenceRunState *state) {
   model->freqToTimeFFTPlan = state->data->freqToTimeFFTPlan;
 
   /* Initialize waveform cache */
-  model->waveformCache = XLALCreateSimInspiralWaveformCache();
+  UINT4 cacheSize = 1;
+  size_t cacheBytes = 0;
+  ppt=LALInferenceGetProcParamVal(commandLine,"--waveform-cache-size");
+  if(ppt) {
+    char *end = NULL;
+    errno = 0;
+    long n = strtol(ppt->value, &end, 10);
+    if(errno || end == ppt->value || *end != '\0' || n < 1 || n > UINT32_MAX)
+      XLAL_ERROR_NULL(XLAL_EINVAL, "--waveform-cache-size must be a positive integer, not '%s'", ppt->value);
+    cacheSize = (UINT4)n;
+  }
+  ppt=LALInferenceGetProcParamVal(commandLine,"--waveform-cache-memory");
+  if(ppt) {
+    char *end = NULL;
+    errno = 0;
+    double mb = strtod(ppt->value, &end);
+    if(errno || end == ppt->value || *end != '\0' || !(mb >= 0))
+      XLAL_ERROR_NULL(XLAL_EINVAL, "--waveform-cache-memory must be a non-negative number of MB, not '%s'", ppt->value);
+    cacheBytes = (size_t)(mb * 1024 * 1024);
+  }
+  model->waveformCache = XLALCreateSimInspiralWaveformCacheLRU(cacheSize, cacheBytes);
 
   return(model);
 }
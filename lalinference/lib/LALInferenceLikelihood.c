@@ -21,6 +21,7 @@
  *  MA  02111-1307  USA
  */
 
+#include <config.h>
 #include <complex.h>
 #include <assert.h>
 #include <lal/LALInferenceLikelihood.h>
@@ -41,7 +42,10 @@
 #include <gsl/gsl_complex_math.h>
 #include <lal/LALInferenceTemplate.h>
 
+#include <lal/LALSIMD.h>
+
 #include "logaddexp.h"
+#include "fused_likelihood.h"
 
 #include <lal/distance_integrator.h>
 
@@ -117,6 +121,7 @@ void LALInferenceInitLikelihood(LALInferenceRunState *runState)
     (--margtimephi)                  Using marginalised in time and phase likelihood\n\
     (--margdist)                     Using marginalisation in distance with d^2 prior (compatible with --margphi and --margtimephi)\n\
     (--margdist-comoving)            Using marginalisation in distance with uniform-in-comoving-volume prior (compatible with --margphi and --margtimephi)\n\
+    (--no-likelihood-plan)           Do not compile the Gaussian likelihood into a plan evaluated in parallel over detectors\n\
     \n";
 
     /* Print command line arguments if help requested */
@@ -223,12 +228,37 @@ void LALInferenceInitLikelihood(LALInferenceRunState *runState)
    for(t=0; t < runState->nthreads; t++)
        runState->threads[t].nullLikelihood = nullLikelihood;
 
+   /* Resolve the configuration of the Gaussian likelihood once for each thread;
+      configurations which cannot be compiled use the general function */
+   if (runState->likelihood==&LALInferenceUndecomposedFreqDomainLogLikelihood &&
+       !LALInferenceGetProcParamVal(commandLine, "--no-likelihood-plan")) {
+     for(t=0; t < runState->nthreads; t++) {
+       LALInferenceModel *model = runState->threads[t].model;
+       if (model == NULL || model->likelihoodPlan != NULL) continue;
+       model->likelihoodPlan = LALInferenceCreateLikelihoodPlan(runState->threads[t].currentParams, runState->data, model);
+     }
+     if (runState->nthreads > 0 && runState->threads[0].model && runState->threads[0].model->likelihoodPlan)
+       fprintf(stderr, "Using compiled likelihood plan.\n");
+   }
+
    LALInferenceAddVariable(runState->proposalArgs, "nullLikelihood", &nullLikelihood,
                            LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_OUTPUT);
 
     return;
 }
 
+void LALInferenceRemoveLikelihoodPlans(LALInferenceRunState *runState)
+{
+  if (runState == NULL)
+    return;
+  for (INT4 t = 0; t < runState->nthreads; t++) {
+    LALInferenceModel *model = runState->threads[t].model;
+    if (model == NULL) continue;
+    LALInferenceDestroyLikelihoodPlan(model->likelihoodPlan);
+    model->likelihoodPlan = NULL;
+  }
+}
+
 
 const char *non_intrinsic_params[] = {"rightascension", "declination", "polarisation", "time",
                                 "deltaLogL", "logL", "deltaloglH1", "deltaloglL1", "deltaloglV1",
@@ -311,16 +341,522 @@ REAL8 LALInferenceZeroLogLikelihood(LALInferenceVariables *currentParams,
 
 
 
+/* Output the tidal deformabilities of the BinaryLove model, and reject
+   the unphysical parts of its parameter space */
+static REAL8 check_binary_love(LALInferenceVariables *currentParams, LALInferenceModel *model, REAL8 loglikelihood)
+{
+  if(LALInferenceCheckVariable(model->params, "lambdaS")){
+
+     REAL8 lambda1 = 0.0;
+     REAL8 lambda2 = 0.0;
+     
+     /*
+     When using TimeMarginalised likelihood, the functions in LALInferenceTemplate.c appears not to be called
+     for the first likelihood evaluation.
+     This menas that the lambda1 and lambda2 parameters aren't added into model->params.
+     So, we check if they are here, and if not run model->params through LALInferenceBinaryLove to fill them in!
+     */
+
+     if (LALInferenceCheckVariable(model->params, "lambda1") && LALInferenceCheckVariable(model->params, "lambda2")){
+         lambda1 = *(REAL8 *)LALInferenceGetVariable(model->params,"lambda1");
+         lambda2 = *(REAL8 *)LALInferenceGetVariable(model->params,"lambda2");
+     } else {
+         LALInferenceBinaryLove(model->params, &lambda1, &lambda2);
+     }
+
+     LALInferenceAddVariable(currentParams,"lambda1",&lambda1,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+     LALInferenceAddVariable(currentParams,"lambda2",&lambda2,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+     // The BinaryLove model is only physically valid where lambda2 > lambda1 as it assumes m1 > m2
+     // It also assumes both lambda1 and lambda2 to be positive
+     // This is an explicit feature of the "raw" model fit, but since this implementation also incorporates
+     // marginalisation over the fit uncertainty, there can be instances where those assumptions are randomly broken
+     // for those cases, set logL = -inf.
+     if( (lambda1 > lambda2) || (lambda1 < 0.0) || (lambda2 < 0.0)){
+        loglikelihood = -INFINITY;
+     }
+  }
+
+  return(loglikelihood);
+}
+
+/* ============ Compiled likelihood plans: ========== */
+
+/* Per-detector part of a likelihood plan */
+typedef struct tagLALInferenceLikelihoodPlanIFO
+{
+  UINT4 lower;                              /* First frequency bin */
+  REAL8 deltaF;                             /* Frequency resolution */
+  FusedLikelihoodKernel kernel;             /* Inputs and outputs of the loop over frequency bins */
+  COMPLEX16FrequencySeries *calFactor;      /* Spline calibration factors */
+  REAL8Vector *logfreqs, *amps, *phases;    /* Spline calibration nodes */
+  char calamp_name[VARNAME_MAX], calpha_name[VARNAME_MAX];
+  char optimal_snr_name[VARNAME_MAX], cplx_snr_amp_name[VARNAME_MAX], cplx_snr_arg_name[VARNAME_MAX];
+} LALInferenceLikelihoodPlanIFO;
+
+struct tagLALInferenceLikelihoodPlan
+{
+  LALInferenceIFOData *data;                /* Data the plan was created for */
+  INT4 nifo;                                /* Number of detectors */
+  INT4 spcal_active;                        /* Spline calibration errors */
+  INT4 constantcal_active;                  /* Constant calibration errors */
+  LALInferenceLikelihoodPlanIFO *ifos;      /* Per-detector parts */
+};
+
+/* Flag stored in currentParams, or the default if it is not set */
+static INT4 get_flag(LALInferenceVariables *vars, const char *name, INT4 def)
+{
+  if (LALInferenceCheckVariable(vars, name))
+    return *(INT4 *)LALInferenceGetVariable(vars, name);
+  return def;
+}
+
+LALInferenceLikelihoodPlan *LALInferenceCreateLikelihoodPlan(LALInferenceVariables *currentParams,
+                                                             LALInferenceIFOData *data,
+                                                             LALInferenceModel *model)
+{
+  LALInferenceIFOData *dataPtr;
+  INT4 ifo;
+
+  if (currentParams == NULL || data == NULL || model == NULL)
+    XLAL_ERROR_NULL(XLAL_EFAULT);
+
+  /* Only the Gaussian likelihood of a signal model with the sky position
+     given in equatorial coordinates is compiled; anything else is left to
+     LALInferenceFusedFreqDomainLogLikelihood() */
+  if (model->roq_flag || model->freqhPlus == NULL || model->freqhCross == NULL)
+    return NULL;
+  if (LALInferenceCheckVariable(model->params, "MARGDIST"))
+    return NULL;
+  if (get_flag(currentParams, "psdScaleFlag", 0) || get_flag(currentParams, "glitchFitFlag", 0)
+      || !get_flag(currentParams, "signalModelFlag", 1) || get_flag(currentParams, "SKY_FRAME", 0))
+    return NULL;
+  INT4 spcal_active = get_flag(currentParams, "spcal_active", 0) ? 1 : 0;
+  INT4 constantcal_active = get_flag(currentParams, "constantcal_active", 0) ? 1 : 0;
+  if (spcal_active && constantcal_active)
+    return NULL;
+
+  LALInferenceLikelihoodPlan *plan = XLALCalloc(1, sizeof(*plan));
+  if (plan == NULL)
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  plan->data = data;
+  plan->spcal_active = spcal_active;
+  plan->constantcal_active = constantcal_active;
+  for (dataPtr = data; dataPtr; dataPtr = dataPtr->next)
+    plan->nifo++;
+  plan->ifos = XLALCalloc(plan->nifo, sizeof(*plan->ifos));
+  if (plan->ifos == NULL) {
+    LALInferenceDestroyLikelihoodPlan(plan);
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  }
+
+  for (dataPtr = data, ifo = 0; dataPtr; dataPtr = dataPtr->next, ifo++) {
+    LALInferenceLikelihoodPlanIFO *p = &plan->ifos[ifo];
+    FusedLikelihoodKernel *k = &p->kernel;
+
+    /* Frequency range, as in LALInferenceFusedFreqDomainLogLikelihood() */
+    REAL8 deltaT = dataPtr->timeData->deltaT;
+    REAL8 deltaF = 1.0 / (((double)dataPtr->timeData->data->length) * deltaT);
+    int lower = (UINT4)ceil(dataPtr->fLow / deltaF);
+    int upper = (UINT4)floor(dataPtr->fHigh / deltaF);
+    p->lower = lower;
+    p->deltaF = deltaF;
+    k->n = (upper >= lower) ? (UINT4)(upper - lower + 1) : 0;
+    k->deltaT = deltaT;
+    k->TwoDeltaToverN = 2.0 * deltaT / ((double) dataPtr->timeData->data->length);
+    if (k->n > 0 && ((UINT4)upper >= dataPtr->freqData->data->length
+                     || (UINT4)upper >= dataPtr->oneSidedNoisePowerSpectrum->data->length
+                     || (UINT4)upper >= model->freqhPlus->data->length)) {
+      LALInferenceDestroyLikelihoodPlan(plan);
+      return NULL;
+    }
+
+    if (VARNAME_MAX <= snprintf(p->calamp_name, VARNAME_MAX, "%s_%s", "calamp", dataPtr->name)
+        || VARNAME_MAX <= snprintf(p->calpha_name, VARNAME_MAX, "%s_%s", "calpha", dataPtr->name)
+        || VARNAME_MAX <= snprintf(p->optimal_snr_name, VARNAME_MAX, "%s_optimal_snr", dataPtr->name)
+        || VARNAME_MAX <= snprintf(p->cplx_snr_amp_name, VARNAME_MAX, "%s_cplx_snr_amp", dataPtr->name)
+        || VARNAME_MAX <= snprintf(p->cplx_snr_arg_name, VARNAME_MAX, "%s_cplx_snr_arg", dataPtr->name)) {
+      LALInferenceDestroyLikelihoodPlan(plan);
+      return NULL;
+    }
+
+    if (spcal_active) {
+      p->calFactor = XLALCreateCOMPLEX16FrequencySeries("calibration factors",
+                       &(dataPtr->freqData->epoch),
+                       0, dataPtr->freqData->deltaF,
+                       &lalDimensionlessUnit,
+                       dataPtr->freqData->data->length);
+      if (p->calFactor == NULL) {
+        LALInferenceDestroyLikelihoodPlan(plan);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+      }
+    }
+
+    /* The network (d|h) is summed over the bins of all detectors in turn,
+       so keep those of all but the first detector */
+    if (ifo > 0 && k->n > 0) {
+      k->dhre = XLALMalloc(k->n * sizeof(REAL8));
+      if (k->dhre == NULL) {
+        LALInferenceDestroyLikelihoodPlan(plan);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+      }
+    }
+  }
+
+  return plan;
+}
+
+void LALInferenceDestroyLikelihoodPlan(LALInferenceLikelihoodPlan *plan)
+{
+  if (plan == NULL)
+    return;
+  if (plan->ifos) {
+    for (INT4 ifo = 0; ifo < plan->nifo; ifo++) {
+      LALInferenceLikelihoodPlanIFO *p = &plan->ifos[ifo];
+      if (p->calFactor) XLALDestroyCOMPLEX16FrequencySeries(p->calFactor);
+      if (p->logfreqs) XLALDestroyREAL8Vector(p->logfreqs);
+      if (p->amps) XLALDestroyREAL8Vector(p->amps);
+      if (p->phases) XLALDestroyREAL8Vector(p->phases);
+      XLALFree(p->kernel.dhre);
+    }
+    XLALFree(plan->ifos);
+  }
+  XLALFree(plan);
+}
+
+/* Loop over the frequency bins of one detector in
+   LALInferenceFusedFreqDomainLogLikelihood(), for the Gaussian likelihood */
+static void LALInferenceFusedLikelihoodKernel(FusedLikelihoodKernel *k)
+{
+  const REAL8 *psd = k->psd;
+  const COMPLEX16 *dtilde = k->dtilde, *hptilde = k->hptilde, *hctilde = k->hctilde;
+  const REAL8 deltaT = k->deltaT, TwoDeltaToverN = k->TwoDeltaToverN;
+  const REAL8 Fplus = k->Fplus, Fcross = k->Fcross, dre = k->dre, dim = k->dim;
+  REAL8 re, im, newRe, newIm;
+  REAL8 loglikelihood = 0.0, this_ifo_S = 0.0;
+  COMPLEX16 this_ifo_Rcplx = 0.0;
+  UINT4 i;
+
+  for (i=0, re=k->re, im=k->im;
+       i<k->n;
+       i++,
+       newRe = re + re*dre - im*dim,
+       newIm = im + re*dim + im*dre,
+       re = newRe, im = newIm)
+  {
+    COMPLEX16 d=dtilde[i];
+    REAL8 sigmasq=psd[i]*deltaT*deltaT;
+
+    if (k->constantcal) {
+      REAL8 dre_tmp= creal(d)*k->cos_calpha - cimag(d)*k->sin_calpha;
+      REAL8 dim_tmp = creal(d)*k->sin_calpha + cimag(d)*k->cos_calpha;
+      dre_tmp/=(1.0+k->calamp);
+      dim_tmp/=(1.0+k->calamp);
+
+      d=crect(dre_tmp,dim_tmp);
+      sigmasq/=((1.0+k->calamp)*(1.0+k->calamp));
+    }
+
+    COMPLEX16 plainTemplate = Fplus*hptilde[i]+Fcross*hctilde[i];
+    COMPLEX16 template = plainTemplate * (re + I*im);
+    if (k->calF) {
+      template = template*k->calF[i];
+    }
+    COMPLEX16 diff = d - template;
+
+    REAL8 templatesq=creal(template)*creal(template) + cimag(template)*cimag(template);
+    this_ifo_S+=TwoDeltaToverN*templatesq/sigmasq;
+    COMPLEX16 dhstar = TwoDeltaToverN*d*conj(template)/sigmasq;
+    this_ifo_Rcplx+=dhstar;
+    if (k->dhre) k->dhre[i] = creal(dhstar);
+
+    REAL8 diffsq = creal(diff)*creal(diff)+cimag(diff)*cimag(diff);
+    loglikelihood -= TwoDeltaToverN*diffsq/sigmasq;
+  }
+
+  k->loglikelihood = loglikelihood;
+  k->S = this_ifo_S;
+  k->R = this_ifo_Rcplx;
+}
+
+/* LALInferenceFusedFreqDomainLogLikelihood() for the Gaussian likelihood,
+   with the configuration resolved in advance by LALInferenceCreateLikelihoodPlan().
+   The detectors are evaluated in parallel, and the per-bin terms with SIMD
+   instructions where available; the result is identical. */
+static REAL8 LALInferencePlannedFreqDomainLogLikelihood(LALInferenceVariables *currentParams,
+                                                        LALInferenceIFOData *data,
+                                                        LALInferenceModel *model,
+                                                        LALInferenceLikelihoodPlan *plan)
+{
+  double Fplus, Fcross;
+  int ifo;
+  LALInferenceIFOData *dataPtr;
+  double ra=0.0, dec=0.0, psi=0.0, gmst=0.0;
+  double GPSdouble=0.0;
+  LIGOTimeGPS GPSlal;
+  double timedelay;  /* time delay b/w iterferometer & geocenter w.r.t. sky location */
+  double timeshift=0;  /* time shift (not necessarily same as above)                   */
+  double twopit, timeTmp, mc;
+  /* Burst templates are generated at hrss=1, thus need to rescale amplitude */
+  double amp_prefactor=1.0;
+  REAL8 calamp=0.0, calpha=0.0;
+  INT4 errnum=0;
+
+  if(LALInferenceCheckVariable(currentParams,"logmc")){
+    mc=exp(*(REAL8 *)LALInferenceGetVariable(currentParams,"logmc"));
+    LALInferenceAddVariable(currentParams,"chirpmass",&mc,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+  }
+  if(LALInferenceCheckVariable(currentParams, "loghrss")){
+    amp_prefactor = exp(*(REAL8*)LALInferenceGetVariable(currentParams,"loghrss"));
+  }
+  else if (LALInferenceCheckVariable(currentParams, "hrss")){
+    amp_prefactor = (*(REAL8*)LALInferenceGetVariable(currentParams,"hrss"));
+  }
+
+  /* determine source's sky location & orientation parameters: */
+  ra        = *(REAL8*) LALInferenceGetVariable(currentParams, "rightascension"); /* radian      */
+  dec       = *(REAL8*) LALInferenceGetVariable(currentParams, "declination");    /* radian      */
+  psi       = *(REAL8*) LALInferenceGetVariable(currentParams, "polarisation");   /* radian      */
+  GPSdouble = *(REAL8*) LALInferenceGetVariable(currentParams, "time");           /* GPS seconds */
+
+  /* figure out GMST: */
+  XLALGPSSetREAL8(&GPSlal, GPSdouble);
+  gmst=XLALGreenwichMeanSiderealTime(&GPSlal);
+
+  /* Reset SNR */
+  model->SNR = 0.0;
+
+  /* Generate the template, which is shared by all detectors; ignore "time" variable */
+  if (LALInferenceCheckVariable(model->params, "time")) {
+    timeTmp = *(REAL8 *) LALInferenceGetVariable(model->params, "time");
+    LALInferenceRemoveVariable(model->params, "time");
+  }
+  else timeTmp = GPSdouble;
+
+  LALInferenceCopyVariables(currentParams, model->params);
+  // Remove time variable so it can be over-written (if it was pinned)
+  if(LALInferenceCheckVariable(model->params,"time")) LALInferenceRemoveVariable(model->params,"time");
+  LALInferenceAddVariable(model->params, "time", &timeTmp, LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_LINEAR);
+
+  XLAL_TRY(model->templt(model),errnum);
+  errnum&=~XLAL_EFUNC;
+  if(errnum!=XLAL_SUCCESS)
+  {
+    switch(errnum)
+    {
+      case XLAL_EUSR0: /* Template generation failed in a known way, set -Inf likelihood */
+        return (-INFINITY);
+        break;
+      default: /* Panic! */
+        fprintf(stderr,"Unhandled error in template generation - exiting!\n");
+        fprintf(stderr,"XLALError: %d, %s\n",errnum,XLALErrorString(errnum));
+        exit(1);
+        break;
+    }
+  }
+
+  if (model->domain == LAL_SIM_DOMAIN_TIME) {
+    /* TD --> FD. */
+    LALInferenceExecuteFT(model);
+  }
+
+  /* Set up the loop over frequency bins of each detector */
+  for(dataPtr=data,ifo=0; dataPtr; dataPtr=dataPtr->next,ifo++) {
+    LALInferenceLikelihoodPlanIFO *p = &plan->ifos[ifo];
+    FusedLikelihoodKernel *k = &p->kernel;
+
+    /* Reset log-likelihood */
+    model->ifo_loglikelihoods[ifo] = 0.0;
+    model->ifo_SNRs[ifo] = 0.0;
+
+    /* Calibration stuff if necessary */
+    if (plan->spcal_active) {
+      get_calib_spline(currentParams, dataPtr->name, &p->logfreqs, &p->amps, &p->phases);
+      LALInferenceSplineCalibrationFactor(p->logfreqs, p->amps, p->phases, p->calFactor);
+    }
+    if (plan->constantcal_active) {
+      if (LALInferenceCheckVariable(currentParams, p->calamp_name))
+        calamp=(*(REAL8*) LALInferenceGetVariable(currentParams, p->calamp_name));
+      else
+        calamp=0.0;
+      if (LALInferenceCheckVariable(currentParams, p->calpha_name))
+        calpha=(*(REAL8*) LALInferenceGetVariable(currentParams, p->calpha_name));
+      else
+        calpha=0.0;
+    }
+
+    /* determine beam pattern response (F_plus and F_cross) for given Ifo: */
+    XLALComputeDetAMResponse(&Fplus, &Fcross, (const REAL4(*)[3])dataPtr->detector->response, ra, dec, psi, gmst);
+
+    /* signal arrival time (relative to geocenter); */
+    timedelay = XLALTimeDelayFromEarthCenter(dataPtr->detector->location, ra, dec, &GPSlal);
+    /* amount by which to time-shift template (not necessarily same as above "timedelay"): */
+    timeshift =  (GPSdouble - (*(REAL8*) LALInferenceGetVariable(model->params, "time"))) + timedelay;
+    twopit    = LAL_TWOPI * timeshift;
+
+    /* For burst, add the right hrss in the amplitude. */
+    Fplus*=amp_prefactor;
+    Fcross*=amp_prefactor;
+
+    dataPtr->fPlus = Fplus;
+    dataPtr->fCross = Fcross;
+    dataPtr->timeshift = timeshift;
+
+    k->dtilde = &(dataPtr->freqData->data->data[p->lower]);
+    k->psd = &(dataPtr->oneSidedNoisePowerSpectrum->data->data[p->lower]);
+    k->hptilde = &(model->freqhPlus->data->data[p->lower]);
+    k->hctilde = &(model->freqhCross->data->data[p->lower]);
+    k->calF = plan->spcal_active ? &(p->calFactor->data->data[p->lower]) : NULL;
+    k->Fplus = Fplus;
+    k->Fcross = Fcross;
+    k->constantcal = plan->constantcal_active;
+    k->calamp = calamp;
+    k->cos_calpha = cos(calpha);
+    k->sin_calpha = -sin(calpha);
+
+    /* Time shift by the recurrence in LALInferenceFusedFreqDomainLogLikelihood() */
+    k->re = cos(twopit*p->deltaF*p->lower);
+    k->im = -sin(twopit*p->deltaF*p->lower);
+    k->dim = -sin(twopit*p->deltaF);
+    k->dre = -2.0*sin(0.5*twopit*p->deltaF)*sin(0.5*twopit*p->deltaF);
+  }
+
+  /* Loop over frequency bins, one detector per thread */
+  const INT4 nifo = plan->nifo;
+#ifdef HAVE_AVX2_COMPILER
+  const int have_avx2 = LAL_HAVE_AVX2_RUNTIME();
+#endif
+  #pragma omp parallel for if(nifo > 1)
+  for (INT4 j = 0; j < nifo; j++) {
+#ifdef HAVE_AVX2_COMPILER
+    if (have_avx2) {
+      LALInferenceFusedLikelihoodKernel_AVX2(&plan->ifos[j].kernel);
+      continue;
+    }
+#endif
+    LALInferenceFusedLikelihoodKernel(&plan->ifos[j].kernel);
+  }
+
+  /* Sum over detectors, in the same order as LALInferenceFusedFreqDomainLogLikelihood() */
+  REAL8 loglikelihood = 0.0, S = 0.0, d_inner_h = 0.0;
+  for(dataPtr=data,ifo=0; dataPtr; dataPtr=dataPtr->next,ifo++) {
+    LALInferenceLikelihoodPlanIFO *p = &plan->ifos[ifo];
+    const FusedLikelihoodKernel *k = &p->kernel;
+
+    model->ifo_loglikelihoods[ifo] = k->loglikelihood;
+    loglikelihood += model->ifo_loglikelihoods[ifo];
+    S += k->S;
+    if (ifo == 0) {
+      d_inner_h = creal(k->R);
+    } else {
+      for (UINT4 i = 0; i < k->n; i++) d_inner_h += k->dhre[i];
+    }
+
+    LALInferenceAddREAL8Variable(currentParams,p->optimal_snr_name,sqrt(2.0*k->S),LALINFERENCE_PARAM_OUTPUT);
+    REAL8 cplx_snr_amp=0.0;
+    REAL8 cplx_snr_phase=carg(k->R);
+    if(k->S > 0) cplx_snr_amp=2.0*cabs(k->R)/sqrt(2.0*k->S);
+    LALInferenceAddREAL8Variable(currentParams,p->cplx_snr_amp_name,cplx_snr_amp,LALINFERENCE_PARAM_OUTPUT);
+    LALInferenceAddREAL8Variable(currentParams,p->cplx_snr_arg_name,cplx_snr_phase,LALINFERENCE_PARAM_OUTPUT);
+  }
+
+  /* SNR variables */
+  REAL8 OptimalSNR=sqrt(2.0*S);
+  REAL8 MatchedFilterSNR = 0.;
+
+  /* Avoid nan's, since noise-only model has OptimalSNR == 0. */
+  if (OptimalSNR > 0.)
+      MatchedFilterSNR = 2.0*d_inner_h/OptimalSNR;
+
+  LALInferenceAddVariable(currentParams,"optimal_snr",&OptimalSNR,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+  LALInferenceAddVariable(currentParams,"matched_filter_snr",&MatchedFilterSNR,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+
+  return check_binary_love(currentParams, model, loglikelihood);
+}
+
 REAL8 LALInferenceUndecomposedFreqDomainLogLikelihood(LALInferenceVariables *currentParams,
                                                       LALInferenceIFOData *data,
                                                       LALInferenceModel *model)
 {
+  if (model->likelihoodPlan && model->likelihoodPlan->data == data)
+    return LALInferencePlannedFreqDomainLogLikelihood(currentParams, data, model, model->likelihoodPlan);
   return LALInferenceFusedFreqDomainLogLikelihood(currentParams,
                                                  data,
                                                  model,
                                                   GAUSSIAN);
 }
 
+/* ============ Batched likelihoods: ========== */
+
+struct tagLALInferenceBatchLikelihood
+{
+  LALInferenceLikelihoodFunction likelihood;  /* Likelihood of a single point */
+  UINT4 nmodels;                              /* Maximum number of points in a batch */
+  LALInferenceModel **models;                 /* Model with which each point is computed; not owned */
+};
+
+int LALInferenceInitBatchLikelihood(LALInferenceModel *model,
+                                    LALInferenceLikelihoodFunction likelihood,
+                                    LALInferenceModel **models,
+                                    UINT4 nmodels)
+{
+  XLAL_CHECK(model != NULL && likelihood != NULL && models != NULL, XLAL_EFAULT);
+  XLAL_CHECK(nmodels > 0, XLAL_EINVAL);
+  for (UINT4 i = 0; i < nmodels; i++) {
+    XLAL_CHECK(models[i] != NULL, XLAL_EFAULT);
+    for (UINT4 j = 0; j < i; j++)
+      XLAL_CHECK(models[j] != models[i], XLAL_EINVAL, "Models %u and %u of the batch are the same", j, i);
+  }
+
+  LALInferenceRemoveBatchLikelihood(model);
+
+  LALInferenceBatchLikelihood *batch = XLALCalloc(1, sizeof(*batch));
+  XLAL_CHECK(batch != NULL, XLAL_ENOMEM);
+  batch->models = XLALCalloc(nmodels, sizeof(*batch->models));
+  if (batch->models == NULL) {
+    XLALFree(batch);
+    XLAL_ERROR(XLAL_ENOMEM);
+  }
+  batch->likelihood = likelihood;
+  for (batch->nmodels = 0; batch->nmodels < nmodels; batch->nmodels++)
+    batch->models[batch->nmodels] = models[batch->nmodels];
+
+  model->batch = batch;
+  model->batch_likelihood = &LALInferenceBatchLogLikelihood;
+
+  return XLAL_SUCCESS;
+}
+
+void LALInferenceRemoveBatchLikelihood(LALInferenceModel *model)
+{
+  if (model == NULL || model->batch == NULL)
+    return;
+  XLALFree(model->batch->models);
+  XLALFree(model->batch);
+  model->batch = NULL;
+  model->batch_likelihood = NULL;
+}
+
+int LALInferenceBatchLogLikelihood(LALInferenceVariables **params,
+                                   UINT4 n,
+                                   REAL8 *logL,
+                                   LALInferenceIFOData *data,
+                                   LALInferenceModel *model)
+{
+  XLAL_CHECK(model != NULL && model->batch != NULL, XLAL_EFAULT);
+  XLAL_CHECK(n == 0 || (params != NULL && logL != NULL), XLAL_EFAULT);
+  LALInferenceBatchLikelihood *batch = model->batch;
+  XLAL_CHECK(n <= batch->nmodels, XLAL_EINVAL, "Batch of %u points is larger than its %u models", n, batch->nmodels);
+  INT4 i;
+
+  /* Points take very different times to compute (waveform length, points
+     outside the prior), so hand them out one at a time */
+  #pragma omp parallel for schedule(dynamic)
+  for (i = 0; i < (INT4)n; i++)
+    logL[i] = params[i] ? batch->likelihood(params[i], data, batch->models[i]) : -INFINITY;
+
+  return XLAL_SUCCESS;
+}
+
 
 static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *currentParams,
                                                         LALInferenceIFOData *data,
@@ -1372,38 +1908,7 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
 
   //loglikelihood = -1.0 * chisquared; // note (again): the log-likelihood is unnormalised!
 
-  if(LALInferenceCheckVariable(model->params, "lambdaS")){
-
-     REAL8 lambda1 = 0.0;
-     REAL8 lambda2 = 0.0;
-     
-     /*
-     When using TimeMarginalised likelihood, the functions in LALInferenceTemplate.c appears not to be called
-     for the first likelihood evaluation.
-     This menas that the lambda1 and lambda2 parameters aren't added into model->params.
-     So, we check if they are here, and if not run model->params through LALInferenceBinaryLove to fill them in!
-     */
-
-     if (LALInferenceCheckVariable(model->params, "lambda1") && LALInferenceCheckVariable(model->params, "lambda2")){
-         lambda1 = *(REAL8 *)LALInferenceGetVariable(model->params,"lambda1");
-         lambda2 = *(REAL8 *)LALInferenceGetVariable(model->params,"lambda2");
-     } else {
-         LALInferenceBinaryLove(model->params, &lambda1, &lambda2);
-     }
-
-     LALInferenceAddVariable(currentParams,"lambda1",&lambda1,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
-     LALInferenceAddVariable(currentParams,"lambda2",&lambda2,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
-     // The BinaryLove model is only physically valid where lambda2 > lambda1 as it assumes m1 > m2
-     // It also assumes both lambda1 and lambda2 to be positive
-     // This is an explicit feature of the "raw" model fit, but since this implementation also incorporates
-     // marginalisation over the fit uncertainty, there can be instances where those assumptions are randomly broken
-     // for those cases, set logL = -inf.
-     if( (lambda1 > lambda2) || (lambda1 < 0.0) || (lambda2 < 0.0)){
-        loglikelihood = -INFINITY;
-     }
-  }
-
-  return(loglikelihood);
+  return check_binary_love(currentParams, model, loglikelihood);
 }
 
 double LALInferenceMarginalDistanceLogLikelihood(double dist_min, double dist_max, double OptimalSNR, double d_inner_h, int cosmology, int margphi)
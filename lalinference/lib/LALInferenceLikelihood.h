@@ -99,6 +99,57 @@ extern const REAL8 CM[15][15];
  ***************************************************************/
 REAL8 LALInferenceUndecomposedFreqDomainLogLikelihood(LALInferenceVariables *currentParams, LALInferenceIFOData *data, LALInferenceModel *model);
 
+/**
+ * Compiled form of LALInferenceUndecomposedFreqDomainLogLikelihood() for a model and data,
+ * with the likelihood configuration (calibration, PSD and glitch fitting, sky frame,
+ * distance marginalisation) resolved once, instead of on every call.
+ */
+typedef struct tagLALInferenceLikelihoodPlan LALInferenceLikelihoodPlan;
+
+/**
+ * Compile the likelihood for the given parameters, data and model. Once stored in
+ * \c model->likelihoodPlan, LALInferenceUndecomposedFreqDomainLogLikelihood() evaluates
+ * the detectors in parallel with OpenMP, and the frequency bins with SIMD instructions
+ * where available; the result is identical. Returns NULL, without an error, for
+ * configurations which are not compiled: ROQ, PSD or glitch fitting, noise-only,
+ * detector-frame sky coordinates, and distance marginalisation.
+ */
+LALInferenceLikelihoodPlan *LALInferenceCreateLikelihoodPlan(LALInferenceVariables *currentParams, LALInferenceIFOData *data, LALInferenceModel *model);
+
+/**
+ * Free a likelihood plan.
+ */
+void LALInferenceDestroyLikelihoodPlan(LALInferenceLikelihoodPlan *plan);
+
+/**
+ * Models with which LALInferenceBatchLogLikelihood() computes many likelihoods at once.
+ */
+typedef struct tagLALInferenceBatchLikelihood LALInferenceBatchLikelihood;
+
+/**
+ * Set \c model->batch_likelihood to LALInferenceBatchLogLikelihood(), which computes
+ * the single-point \c likelihood of a batch of up to \c nmodels points in parallel
+ * OpenMP threads, point \c i with \c models[i]. The template and likelihood functions
+ * write to the model buffers, so the models must be distinct, as are the models of the
+ * threads of a run state. The models are not copied, and must outlive the batch.
+ */
+int LALInferenceInitBatchLikelihood(LALInferenceModel *model, LALInferenceLikelihoodFunction likelihood, LALInferenceModel **models, UINT4 nmodels);
+
+/**
+ * Free the batch likelihood of a model, but not its models, and unset \c model->batch_likelihood.
+ */
+void LALInferenceRemoveBatchLikelihood(LALInferenceModel *model);
+
+/**
+ * Batched likelihood set up by LALInferenceInitBatchLikelihood(): \c logL[i] is the
+ * likelihood of \c params[i] which the single-point function would return, or -INFINITY
+ * if \c params[i] is NULL. \c n must be at most the number of models of the batch.
+ * Any likelihood outputs written to \c params[i] and the buffers of model \c i are as
+ * for the single-point function. Must not be called by several threads at once for the
+ * same model.
+ */
+int LALInferenceBatchLogLikelihood(LALInferenceVariables **params, UINT4 n, REAL8 *logL, LALInferenceIFOData *data, LALInferenceModel *model);
+
 /**
  * For testing purposes (for instance sampling the prior),
  * likelihood that returns 0.0 = log(1) every
@@ -199,6 +250,12 @@ REAL8 LALInferenceMarginalisedTimeLogLikelihood(LALInferenceVariables *currentPa
  */
 void LALInferenceInitLikelihood(LALInferenceRunState *runState);
 
+/**
+ * Free the compiled likelihoods created by LALInferenceInitLikelihood() for the
+ * models of each thread.
+ */
+void LALInferenceRemoveLikelihoodPlans(LALInferenceRunState *runState);
+
 /** Get the intrinsic parameters from currentParams */
 LALInferenceVariables LALInferenceGetInstrinsicParams(LALInferenceVariables *currentParams);
 
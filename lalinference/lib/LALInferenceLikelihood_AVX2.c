@@ -0,0 +1,182 @@
+/*
+ *  LALInferenceLikelihood_AVX2.c: AVX2 kernel of the compiled Gaussian likelihood
+ *
+ *  Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+#include <config.h>
+
+#include <complex.h>
+#include <immintrin.h>
+
+#include <lal/LALStdlib.h>
+
+#include "fused_likelihood.h"
+
+/*
+ * Per-bin terms of the likelihood, written out in real arithmetic exactly as
+ * the compiler evaluates the complex expressions in
+ * LALInferenceFusedFreqDomainLogLikelihood(): real*complex products and
+ * complex/real quotients act on each component, and complex products are
+ * (ac - bd) + i(ad + bc).
+ */
+static inline void fused_likelihood_bin(const FusedLikelihoodKernel *k, const UINT4 i, const REAL8 re, const REAL8 im,
+                                        REAL8 *chisq, REAL8 *sterm, REAL8 *dhr, REAL8 *dhi)
+{
+  REAL8 dr = creal(k->dtilde[i]), di = cimag(k->dtilde[i]);
+  REAL8 sigmasq = k->psd[i]*k->deltaT*k->deltaT;
+  if (k->constantcal) {
+    REAL8 dre_tmp = dr*k->cos_calpha - di*k->sin_calpha;
+    REAL8 dim_tmp = dr*k->sin_calpha + di*k->cos_calpha;
+    dr = dre_tmp/(1.0+k->calamp);
+    di = dim_tmp/(1.0+k->calamp);
+    sigmasq /= ((1.0+k->calamp)*(1.0+k->calamp));
+  }
+  const REAL8 pr = k->Fplus*creal(k->hptilde[i]) + k->Fcross*creal(k->hctilde[i]);
+  const REAL8 pi = k->Fplus*cimag(k->hptilde[i]) + k->Fcross*cimag(k->hctilde[i]);
+  REAL8 tr = pr*re - pi*im;
+  REAL8 ti = pr*im + pi*re;
+  if (k->calF) {
+    const REAL8 cr = creal(k->calF[i]), ci = cimag(k->calF[i]);
+    const REAL8 t = tr*cr - ti*ci;
+    ti = tr*ci + ti*cr;
+    tr = t;
+  }
+  const REAL8 fr = dr - tr, fi = di - ti;
+  const REAL8 a = k->TwoDeltaToverN*dr, b = k->TwoDeltaToverN*di, nti = -ti;
+  *sterm = k->TwoDeltaToverN*(tr*tr + ti*ti)/sigmasq;
+  *dhr = (a*tr - b*nti)/sigmasq;
+  *dhi = (a*nti + b*tr)/sigmasq;
+  *chisq = k->TwoDeltaToverN*(fr*fr + fi*fi)/sigmasq;
+}
+
+/* Split 4 complex numbers at x into {re0, re1, re2, re3} and {im0, im1, im2, im3} */
+static inline void fused_likelihood_load(const COMPLEX16 *x, __m256d *re, __m256d *im)
+{
+  const __m256d x01 = _mm256_loadu_pd((const double *) x);
+  const __m256d x23 = _mm256_loadu_pd((const double *) x + 4);
+  *re = _mm256_permute4x64_pd(_mm256_unpacklo_pd(x01, x23), 0xD8);
+  *im = _mm256_permute4x64_pd(_mm256_unpackhi_pd(x01, x23), 0xD8);
+}
+
+/*
+ * Evaluate the per-bin terms of 4 frequency bins at a time. The time-shift
+ * phase recurrence is inherently sequential and stays scalar, as do the
+ * sums over bins, which are accumulated in order so that the results are
+ * identical to those of the scalar loop. There is no FMA contraction with
+ * AVX2_CFLAGS.
+ */
+void LALInferenceFusedLikelihoodKernel_AVX2(FusedLikelihoodKernel *k)
+{
+  const UINT4 n = k->n;
+  const REAL8 dre = k->dre, dim = k->dim;
+  REAL8 re = k->re, im = k->im, newRe, newIm;
+  REAL8 ll = 0.0, S = 0.0, Rre = 0.0, Rim = 0.0;
+
+  const __m256d vdeltaT = _mm256_set1_pd(k->deltaT);
+  const __m256d vT = _mm256_set1_pd(k->TwoDeltaToverN);
+  const __m256d vFp = _mm256_set1_pd(k->Fplus);
+  const __m256d vFc = _mm256_set1_pd(k->Fcross);
+  const __m256d vcos = _mm256_set1_pd(k->cos_calpha);
+  const __m256d vsin = _mm256_set1_pd(k->sin_calpha);
+  const __m256d va1 = _mm256_set1_pd(1.0+k->calamp);
+  const __m256d va2 = _mm256_set1_pd((1.0+k->calamp)*(1.0+k->calamp));
+  const __m256d vsign = _mm256_set1_pd(-0.0);
+
+  REAL8 rebuf[4], imbuf[4], chisq[4], sterm[4], dhr[4], dhi[4];
+  UINT4 i = 0, j;
+
+  for (; i + 4 <= n; i += 4) {
+    for (j = 0; j < 4; j++) {
+      rebuf[j] = re;
+      imbuf[j] = im;
+      newRe = re + re*dre - im*dim;
+      newIm = im + re*dim + im*dre;
+      re = newRe; im = newIm;
+    }
+    const __m256d vre = _mm256_loadu_pd(rebuf);
+    const __m256d vim = _mm256_loadu_pd(imbuf);
+
+    __m256d dr, di, hpr, hpi, hcr, hci;
+    fused_likelihood_load(k->dtilde + i, &dr, &di);
+    __m256d sig = _mm256_mul_pd(_mm256_mul_pd(_mm256_loadu_pd(k->psd + i), vdeltaT), vdeltaT);
+    if (k->constantcal) {
+      const __m256d dre_tmp = _mm256_sub_pd(_mm256_mul_pd(dr, vcos), _mm256_mul_pd(di, vsin));
+      const __m256d dim_tmp = _mm256_add_pd(_mm256_mul_pd(dr, vsin), _mm256_mul_pd(di, vcos));
+      dr = _mm256_div_pd(dre_tmp, va1);
+      di = _mm256_div_pd(dim_tmp, va1);
+      sig = _mm256_div_pd(sig, va2);
+    }
+
+    fused_likelihood_load(k->hptilde + i, &hpr, &hpi);
+    fused_likelihood_load(k->hctilde + i, &hcr, &hci);
+    const __m256d pr = _mm256_add_pd(_mm256_mul_pd(vFp, hpr), _mm256_mul_pd(vFc, hcr));
+    const __m256d pi = _mm256_add_pd(_mm256_mul_pd(vFp, hpi), _mm256_mul_pd(vFc, hci));
+    __m256d tr = _mm256_sub_pd(_mm256_mul_pd(pr, vre), _mm256_mul_pd(pi, vim));
+    __m256d ti = _mm256_add_pd(_mm256_mul_pd(pr, vim), _mm256_mul_pd(pi, vre));
+    if (k->calF) {
+      __m256d cr, ci;
+      fused_likelihood_load(k->calF + i, &cr, &ci);
+      const __m256d t = _mm256_sub_pd(_mm256_mul_pd(tr, cr), _mm256_mul_pd(ti, ci));
+      ti = _mm256_add_pd(_mm256_mul_pd(tr, ci), _mm256_mul_pd(ti, cr));
+      tr = t;
+    }
+
+    const __m256d fr = _mm256_sub_pd(dr, tr);
+    const __m256d fi = _mm256_sub_pd(di, ti);
+    const __m256d a = _mm256_mul_pd(vT, dr);
+    const __m256d b = _mm256_mul_pd(vT, di);
+    const __m256d nti = _mm256_xor_pd(ti, vsign);
+    const __m256d tsq = _mm256_add_pd(_mm256_mul_pd(tr, tr), _mm256_mul_pd(ti, ti));
+    const __m256d fsq = _mm256_add_pd(_mm256_mul_pd(fr, fr), _mm256_mul_pd(fi, fi));
+    _mm256_storeu_pd(sterm, _mm256_div_pd(_mm256_mul_pd(vT, tsq), sig));
+    const __m256d vdhr = _mm256_div_pd(_mm256_sub_pd(_mm256_mul_pd(a, tr), _mm256_mul_pd(b, nti)), sig);
+    _mm256_storeu_pd(dhr, vdhr);
+    _mm256_storeu_pd(dhi, _mm256_div_pd(_mm256_add_pd(_mm256_mul_pd(a, nti), _mm256_mul_pd(b, tr)), sig));
+    _mm256_storeu_pd(chisq, _mm256_div_pd(_mm256_mul_pd(vT, fsq), sig));
+
+    for (j = 0; j < 4; j++) {
+      S += sterm[j];
+      Rre += dhr[j];
+      Rim += dhi[j];
+      ll -= chisq[j];
+    }
+    if (k->dhre) {
+      _mm256_storeu_pd(k->dhre + i, vdhr);
+    }
+  }
+
+  /* take care of remaining bins, n modulo 4 */
+  for (; i < n; i++) {
+    fused_likelihood_bin(k, i, re, im, &chisq[0], &sterm[0], &dhr[0], &dhi[0]);
+    S += sterm[0];
+    Rre += dhr[0];
+    Rim += dhi[0];
+    ll -= chisq[0];
+    if (k->dhre) {
+      k->dhre[i] = dhr[0];
+    }
+    newRe = re + re*dre - im*dim;
+    newIm = im + re*dim + im*dre;
+    re = newRe; im = newIm;
+  }
+
+  k->loglikelihood = ll;
+  k->S = S;
+  k->R = crect(Rre, Rim);
+}
@@ -27,6 +27,10 @@
 
 #include "logaddexp.h"
 
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
 #define PROGRAM_NAME "LALInferenceNestedSampler.c"
 #define CVS_ID_STRING "$Id$"
 #define CVS_REVISION "$Revision$"
@@ -312,6 +316,20 @@ static double logsubexp(double a, double b)
 }
 
 static void SetupEigenProposals(LALInferenceRunState *runState);
+static void SetupEigenProposalsThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState);
+
+/* Outcome of the MCMC sub-chain which evolves one live point */
+typedef struct tagNSsubchainStats {
+  REAL8 sloppyfraction;  /* Fraction of steps whose likelihood is not checked, NAN for the default */
+  REAL8 accept_rate;     /* Acceptance rate of the steps whose likelihood is checked */
+  REAL8 sub_accept_rate; /* Acceptance rate of the steps in the prior */
+} NSsubchainStats;
+
+/* Thread-aware versions of LALInferenceMCMCSamplePrior and
+ LALInferenceNestedSamplingSloppySample, which evolve threadState->currentParams
+ and only read runState->algorithmParams, so that several threads can run them at once */
+static UINT4 MCMCSamplePriorThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState, gsl_rng *rng);
+static INT4 SloppySampleThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState, gsl_rng *rng, NSsubchainStats *stats);
 
 /**
  * Update the internal state of the integrator after receiving the lowest logL
@@ -395,7 +413,7 @@ static REAL8 mean(REAL8 *array,int N){
 static REAL8 LALInferenceNSSample_logt(int Nlive,gsl_rng *RNG){
 	REAL8 t=0.0;
 	REAL8 a=0.0;
-	while((Nlive--)>1) {a=gsl_rng_uniform(RNG); t = t>a ? t : a;}
+	while((Nlive--)>0) {a=gsl_rng_uniform(RNG); t = t>a ? t : a;}
 	return(log(t));
 }
 
@@ -435,9 +453,9 @@ static UINT4 UpdateNMCMC(LALInferenceRunState *runState){
         }
         LALInferenceSetVariable(runState->algorithmParams,"Nmcmc",&max);
     }
-    /* Single threaded here */
     if (LALInferenceGetProcParamVal(runState->commandLine,"--proposal-kde"))
-        LALInferenceSetupClusteredKDEProposalFromDEBuffer(&runState->threads[0]);
+        for(INT4 t=0;t<runState->nthreads;t++)
+            LALInferenceSetupClusteredKDEProposalFromDEBuffer(&runState->threads[t]);
     return(max);
 }
 
@@ -586,6 +604,8 @@ void LALInferenceNestedSamplingAlgorithmInit(LALInferenceRunState *runState)
     (--sloppyratio S)                Number of sub-samples of the prior for every sample from the\n\
                                      limited prior\n\
     (--Nruns R)                      Number of parallel samples from logt to use(1)\n\
+    (--Nthreads K)                   Replace the K lowest live points at each iteration, each evolved\n\
+                                     by its own thread (1)\n\
     (--tolerance dZ)                 Tolerance of nested sampling algorithm (0.1)\n\
     (--randomseed seed)              Random seed of sampling distribution\n\
     (--prior )                       Set the prior to use (InspiralNormalised,SkyLoc,malmquist)\n\
@@ -640,15 +660,13 @@ void LALInferenceNestedSamplingAlgorithmInit(LALInferenceRunState *runState)
   INT4 tmpi=0;
   REAL8 tmp=0;
 
-  /* Single thread only */
-  LALInferenceThreadState *threadState = &runState->threads[0];
-
   /* Set up the appropriate functions for the nested sampling algorithm */
   runState->algorithm=&LALInferenceNestedSamplingAlgorithm;
   runState->evolve=&LALInferenceNestedSamplingOneStep;
 
   /* use the ptmcmc proposal to sample prior */
-  threadState->proposal=&LALInferenceCyclicProposal;
+  for(INT4 t=0;t<runState->nthreads;t++)
+    runState->threads[t].proposal=&LALInferenceCyclicProposal;
   REAL8 temp=1.0;
   LALInferenceAddVariable(runState->proposalArgs,"temperature",&temp,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_FIXED);
 
@@ -697,6 +715,17 @@ void LALInferenceNestedSamplingAlgorithmInit(LALInferenceRunState *runState)
     LALInferenceAddVariable(runState->algorithmParams,"Nruns",&tmpi,LALINFERENCE_INT4_t,LALINFERENCE_PARAM_FIXED);
   }
 
+  /* Optionally replace several live points at once */
+  ppt=LALInferenceGetProcParamVal(commandLine,"--Nthreads");
+  if(ppt) {
+    tmpi=atoi(ppt->value);
+    if(tmpi<1 || tmpi>runState->nthreads) {
+      fprintf(stderr,"Error, --Nthreads must be between 1 and the number of threads set up (%i)\n",runState->nthreads);
+      exit(1);
+    }
+    LALInferenceAddVariable(runState->algorithmParams,"Nthreads",&tmpi,LALINFERENCE_INT4_t,LALINFERENCE_PARAM_FIXED);
+  }
+
   printf("set tolerance.\n");
   /* Tolerance of the Nested sampling integrator */
   ppt=LALInferenceGetProcParamVal(commandLine,"--tolerance");
@@ -713,6 +742,93 @@ void LALInferenceNestedSamplingAlgorithmInit(LALInferenceRunState *runState)
 }
 
 
+/* Replace the Nthreads live points with the lowest likelihoods in one
+ iteration, each by evolving a copy of one of the remaining live points with
+ the proposals and random number generator of its own thread. The removed
+ points are integrated as successive iterations with Nlive, Nlive-1, ...
+ live points, as in the final corrections, and the new points, drawn above
+ the highest removed likelihood, restore Nlive live points for the next
+ iteration.
+ Returns logZ, and the indices of the new points in replaced[] */
+static REAL8 NestedSamplingParallelIteration(LALInferenceRunState *runState, NSintegralState *s, UINT4 Nthreads, UINT4 samplePrior, UINT4 *replaced, REAL8 *logLmin, UINT4 *itercounter);
+static REAL8 NestedSamplingParallelIteration(LALInferenceRunState *runState, NSintegralState *s, UINT4 Nthreads, UINT4 samplePrior, UINT4 *replaced, REAL8 *logLmin, UINT4 *itercounter)
+{
+  UINT4 Nlive=*(UINT4 *)LALInferenceGetVariable(runState->algorithmParams,"Nlive");
+  REAL8 *logLikelihoods=(REAL8 *)(*(REAL8Vector **)LALInferenceGetVariable(runState->algorithmParams,"logLikelihoods"))->data;
+  UCHAR *removed=XLALCalloc(Nlive,sizeof(UCHAR));
+  NSsubchainStats *stats=XLALCalloc(Nthreads,sizeof(NSsubchainStats));
+  UINT4 *counters=XLALCalloc(Nthreads,sizeof(UINT4));
+  REAL8 logZ=-INFINITY;
+  UINT4 i,m;
+  INT4 t;
+
+  /* Find the Nthreads lowest likelihoods, in increasing order */
+  for(m=0;m<Nthreads;m++)
+  {
+    UINT4 minpos=Nlive;
+    for(i=0;i<Nlive;i++)
+      if(!removed[i] && (minpos==Nlive || logLikelihoods[i]<logLikelihoods[minpos]))
+        minpos=i;
+    replaced[m]=minpos;
+    removed[minpos]=1;
+  }
+
+  /* The shrinkage sampled after each removed point is that of the next
+   removal, from the Nlive-m-1 points that remain after it, or from Nlive
+   points again after the last one, once the new points are drawn */
+  for(m=0;m<Nthreads;m++)
+  {
+    logZ=incrementEvidenceSamples(runState->GSLrandom, m+1<Nthreads ? Nlive-m-1 : Nlive, logLikelihoods[replaced[m]], s);
+    if(runState->logsample) runState->logsample(runState->algorithmParams,runState->livePoints[replaced[m]]);
+  }
+  *logLmin=logLikelihoods[replaced[Nthreads-1]];
+  if(samplePrior) *logLmin=-INFINITY;
+  LALInferenceSetVariable(runState->algorithmParams,"logLmin",(void *)logLmin);
+  REAL8 sloppyfraction=*(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"sloppyfraction");
+
+  /* Generate the new live points, one per thread. The proposal cache of
+   LALInferenceNestedSamplingCachedSampler is not shared between threads */
+  #pragma omp parallel for num_threads(Nthreads) schedule(static,1)
+  for(t=0;t<(INT4)Nthreads;t++)
+  {
+    LALInferenceThreadState *thread=&runState->threads[t];
+    UINT4 j;
+    stats[t].sloppyfraction=sloppyfraction;
+    do{ /* This loop is here in case it is necessary to find a different sample */
+      /* Clone one of the remaining live points and evolve it */
+      while(removed[j=gsl_rng_uniform_int(thread->GSLrandom,Nlive)]){};
+      LALInferenceCopyVariables(runState->livePoints[j],thread->currentParams);
+      thread->currentLikelihood = logLikelihoods[j];
+      SloppySampleThread(runState,thread,thread->GSLrandom,&stats[t]);
+      counters[t]++;
+    }while( thread->currentLikelihood<=*logLmin || stats[t].accept_rate==0.0);
+  }
+
+  /* Insert the new points, and average the statistics of the sub-chains */
+  REAL8 accept_rate=0.0,sub_accept_rate=0.0;
+  UINT4 Ntries=0;
+  sloppyfraction=0.0;
+  for(m=0;m<Nthreads;m++)
+  {
+    LALInferenceCopyVariables(runState->threads[m].currentParams,runState->livePoints[replaced[m]]);
+    logLikelihoods[replaced[m]]=runState->threads[m].currentLikelihood;
+    accept_rate+=stats[m].accept_rate/(REAL8)Nthreads;
+    sub_accept_rate+=stats[m].sub_accept_rate/(REAL8)Nthreads;
+    sloppyfraction+=stats[m].sloppyfraction/(REAL8)Nthreads;
+    Ntries+=counters[m];
+  }
+  *itercounter=(Ntries+Nthreads-1)/Nthreads;
+  LALInferenceSetVariable(runState->algorithmParams,"accept_rate",&accept_rate);
+  LALInferenceSetVariable(runState->algorithmParams,"sub_accept_rate",&sub_accept_rate);
+  if(isfinite(*logLmin))
+    LALInferenceSetVariable(runState->algorithmParams,"sloppyfraction",&sloppyfraction);
+
+  XLALFree(counters);
+  XLALFree(stats);
+  XLALFree(removed);
+  return logZ;
+}
+
 /* NestedSamplingAlgorithm implements the nested sampling algorithm,
  see e.g. Sivia & Skilling "Data Analysis: A Bayesian Tutorial, 2nd edition.
  REQUIREMENTS:
@@ -731,9 +847,10 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
   UINT4 HDFOUTPUT=1;
   UINT4 Nlive=*(UINT4 *)LALInferenceGetVariable(runState->algorithmParams,"Nlive");
   UINT4 Nruns=100;
+  UINT4 Nthreads=1;
   REAL8 *logZarray,*Harray,*logwarray,*logtarray;
   REAL8 TOLERANCE=0.1;
-  REAL8 logZ,logZnew,logLmin,logLmax=-INFINITY,logLtmp,logw,H,logZnoise,dZ=0;
+  REAL8 logZ,logZnew,logLmin,logLmax=-INFINITY,logLtmp,logLnew,logw,H,logZnoise,dZ=0;
   LALInferenceVariables *temp;
   FILE *fpout=NULL;
   REAL8 neginfty=-INFINITY;
@@ -777,6 +894,16 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
   if(LALInferenceCheckVariable(runState->algorithmParams,"Nruns"))
     Nruns = *(UINT4 *) LALInferenceGetVariable(runState->algorithmParams,"Nruns");
 
+  /* Replace several live points at each iteration if requested */
+  if(LALInferenceCheckVariable(runState->algorithmParams,"Nthreads"))
+    Nthreads = *(UINT4 *) LALInferenceGetVariable(runState->algorithmParams,"Nthreads");
+  if(Nthreads>(UINT4)runState->nthreads || (Nthreads>1 && Nthreads>=Nlive/10))
+  {
+    fprintf(stderr,"Error, cannot replace %i live points at once with %i threads and %i live points\n",Nthreads,runState->nthreads,Nlive);
+    exit(1);
+  }
+  UINT4 *replaced=XLALCalloc(Nthreads,sizeof(UINT4));
+
   /* Create workspace for arrays */
   NSintegralState *s=NULL;
 
@@ -834,9 +961,11 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
   SetupEigenProposals(runState);
 
   /* Use the live points as differential evolution points */
-  /* Single thread here */
-  syncLivePointsDifferentialPoints(runState,threadState);
-  threadState->differentialPointsSkip=1;
+  for(INT4 t=0;t<runState->nthreads;t++)
+  {
+    syncLivePointsDifferentialPoints(runState,&runState->threads[t]);
+    runState->threads[t].differentialPointsSkip=1;
+  }
 
   if(!LALInferenceCheckVariable(runState->algorithmParams,"Nmcmc")){
     INT4 tmp=MAX_MCMC;
@@ -945,41 +1074,58 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
   }
   /* Iterate until termination condition is met */
   do {
-    /* Find minimum likelihood sample to replace */
-    minpos=0;
-    for(i=1;i<Nlive;i++){
-      if(logLikelihoods[i]<logLikelihoods[minpos])
-	minpos=i;
-    }
-    logLmin=logLikelihoods[minpos];
-    if(samplePrior) logLmin=-INFINITY;
-
-    logZnew=incrementEvidenceSamples(runState->GSLrandom, Nlive, logLikelihoods[minpos], s);
-    //deltaZ=logZnew-logZ; - set but not used
-    H=mean(Harray,Nruns);
-    logZ=logZnew;
-    if(runState->logsample) runState->logsample(runState->algorithmParams,runState->livePoints[minpos]);
     UINT4 itercounter=0;
-
-    /* Generate a new live point */
-    do{ /* This loop is here in case it is necessary to find a different sample */
-      /* Clone an old live point and evolve it */
-      while((j=gsl_rng_uniform_int(runState->GSLrandom,Nlive))==minpos){};
-      LALInferenceCopyVariables(runState->livePoints[j],threadState->currentParams);
-      threadState->currentLikelihood = logLikelihoods[j];
-      LALInferenceSetVariable(runState->algorithmParams,"logLmin",(void *)&logLmin);
-      runState->evolve(runState);
-      itercounter++;
-    }while( threadState->currentLikelihood<=logLmin ||  *(REAL8*)LALInferenceGetVariable(runState->algorithmParams,"accept_rate")==0.0);
-
-    LALInferenceCopyVariables(threadState->currentParams,runState->livePoints[minpos]);
-    logLikelihoods[minpos]=threadState->currentLikelihood;
-
-  if (threadState->currentLikelihood>logLmax)
-    logLmax=threadState->currentLikelihood;
+    if(Nthreads>1)
+    {
+      /* Replace the Nthreads lowest live points at once */
+      logZnew=NestedSamplingParallelIteration(runState, s, Nthreads, samplePrior, replaced, &logLmin, &itercounter);
+      H=mean(Harray,Nruns);
+      logZ=logZnew;
+    }
+    else
+    {
+      /* Find minimum likelihood sample to replace */
+      minpos=0;
+      for(i=1;i<Nlive;i++){
+        if(logLikelihoods[i]<logLikelihoods[minpos])
+	  minpos=i;
+      }
+      logLmin=logLikelihoods[minpos];
+      if(samplePrior) logLmin=-INFINITY;
+
+      logZnew=incrementEvidenceSamples(runState->GSLrandom, Nlive, logLikelihoods[minpos], s);
+      //deltaZ=logZnew-logZ; - set but not used
+      H=mean(Harray,Nruns);
+      logZ=logZnew;
+      if(runState->logsample) runState->logsample(runState->algorithmParams,runState->livePoints[minpos]);
+
+      /* Generate a new live point */
+      do{ /* This loop is here in case it is necessary to find a different sample */
+        /* Clone an old live point and evolve it */
+        while((j=gsl_rng_uniform_int(runState->GSLrandom,Nlive))==minpos){};
+        LALInferenceCopyVariables(runState->livePoints[j],threadState->currentParams);
+        threadState->currentLikelihood = logLikelihoods[j];
+        LALInferenceSetVariable(runState->algorithmParams,"logLmin",(void *)&logLmin);
+        runState->evolve(runState);
+        itercounter++;
+      }while( threadState->currentLikelihood<=logLmin ||  *(REAL8*)LALInferenceGetVariable(runState->algorithmParams,"accept_rate")==0.0);
+
+      LALInferenceCopyVariables(threadState->currentParams,runState->livePoints[minpos]);
+      logLikelihoods[minpos]=threadState->currentLikelihood;
+      replaced[0]=minpos;
+    }
 
   logw=mean(logwarray,Nruns);
-  LALInferenceAddVariable(runState->livePoints[minpos],"logw",&logw,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+  logLnew=INFINITY;
+  for(i=0;i<Nthreads;i++)
+  {
+    if (logLikelihoods[replaced[i]]>logLmax)
+      logLmax=logLikelihoods[replaced[i]];
+    if (logLikelihoods[replaced[i]]<logLnew)
+      logLnew=logLikelihoods[replaced[i]];
+    LALInferenceAddVariable(runState->livePoints[replaced[i]],"logw",&logw,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+  }
+  iter+=Nthreads-1;
   dZ=logaddexp(logZ,logLmax-((double) iter)/((double)Nlive))-logZ;
   sloppyfrac=*(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"sloppyfraction");
   if(displayprogress) fprintf(stderr,"%i: accpt: %1.3f Nmcmc: %i sub_accpt: %1.3f slpy: %2.1f%% H: %3.2lf nats logL:%.3lf ->%.3lf logZ: %.3lf deltalogLmax: %.2lf dZ: %.3lf Zratio: %.3lf \n",\
@@ -990,7 +1136,7 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
     100.0*sloppyfrac,\
     H,\
     logLmin,\
-    threadState->currentLikelihood,\
+    logLnew,\
     logZ,\
     (logLmax - LALInferenceGetREAL8Variable(runState->algorithmParams,"logZnoise")), \
     dZ,\
@@ -1012,7 +1158,7 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
   }
 
   /* Update the proposal */
-  if(!(iter%(Nlive/10))) {
+  if(iter/(Nlive/10)!=(iter-Nthreads)/(Nlive/10)) {
     /* Update the covariance matrix */
     if ( LALInferenceCheckVariable( threadState->proposalArgs,"covarianceMatrix" ) ){
       SetupEigenProposals(runState);
@@ -1022,7 +1168,8 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
     UpdateNMCMC(runState);
 
     /* Sync the live points to differential points */
-    syncLivePointsDifferentialPoints(runState,threadState);
+    for(INT4 t=0;t<runState->nthreads;t++)
+      syncLivePointsDifferentialPoints(runState,&runState->threads[t]);
 
     /* Output some information */
     if(verbose){
@@ -1053,9 +1200,10 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
     logLikelihoods[minpos]=logLikelihoods[i];
     logLikelihoods[i]=logLmin;
   }
-  /* final corrections */
+  /* final corrections, where the shrinkage sampled after each point is
+   that of the next one, from the Nlive-i-1 points that remain */
   for(i=0;i<Nlive;i++){
-    logZ=incrementEvidenceSamples(runState->GSLrandom, Nlive-i, logLikelihoods[i], s);
+    logZ=incrementEvidenceSamples(runState->GSLrandom, Nlive-i-1, logLikelihoods[i], s);
     if(runState->logsample) runState->logsample(runState->algorithmParams,runState->livePoints[i]);
   }
   
@@ -1149,6 +1297,7 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
     }
   
   /* Free memory */
+  XLALFree(replaced);
   XLALFree(logtarray); XLALFree(logwarray); XLALFree(logZarray);
 }
 
@@ -1338,7 +1487,11 @@ LALInferenceVariables *LALInferenceComputeAutoCorrelation(LALInferenceRunState *
 UINT4 LALInferenceMCMCSamplePrior(LALInferenceRunState *runState)
 {
     /* Single threaded here */
-    LALInferenceThreadState * threadState=&runState->threads[0];
+    return MCMCSamplePriorThread(runState,&runState->threads[0],runState->GSLrandom);
+}
+
+static UINT4 MCMCSamplePriorThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState, gsl_rng *rng)
+{
     UINT4 outOfBounds=0;
     UINT4 adaptProp=0;
     //LALInferenceVariables tempParams;
@@ -1360,7 +1513,7 @@ UINT4 LALInferenceMCMCSamplePrior(LALInferenceRunState *runState)
 
     logProposalRatio = threadState->proposal(threadState,threadState->currentParams,&proposedParams);
     REAL8 logPriorNew=runState->prior(runState, &proposedParams, threadState->model);
-    if(isinf(logPriorNew) || isnan(logPriorNew) || log(gsl_rng_uniform(runState->GSLrandom)) > (logPriorNew-logPriorOld) + logProposalRatio)
+    if(isinf(logPriorNew) || isnan(logPriorNew) || log(gsl_rng_uniform(rng)) > (logPriorNew-logPriorOld) + logProposalRatio)
     {
 	/* Reject - don't need to copy new params back to currentParams */
         /*LALInferenceCopyVariables(oldParams,runState->currentParams); */
@@ -1484,9 +1637,26 @@ INT4 LALInferenceNestedSamplingCachedSampler(LALInferenceRunState *runState)
 
 INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
 {
-    LALInferenceVariables oldParams;
+    NSsubchainStats stats;
+    REAL8 logLmin=*(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"logLmin");
+    stats.sloppyfraction=NAN;
+    if (LALInferenceCheckVariable(runState->algorithmParams,"sloppyfraction"))
+      stats.sloppyfraction=*(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"sloppyfraction");
+
     /* Single thread here */
-    LALInferenceThreadState *threadState = &runState->threads[0];
+    INT4 Naccepted=SloppySampleThread(runState,&runState->threads[0],runState->GSLrandom,&stats);
+
+    LALInferenceSetVariable(runState->algorithmParams,"accept_rate",&stats.accept_rate);
+    LALInferenceSetVariable(runState->algorithmParams,"sub_accept_rate",&stats.sub_accept_rate);
+    if(isfinite(logLmin))
+      LALInferenceSetVariable(runState->algorithmParams,"sloppyfraction",&stats.sloppyfraction);
+
+    return Naccepted;
+}
+
+static INT4 SloppySampleThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState, gsl_rng *rng, NSsubchainStats *stats)
+{
+    LALInferenceVariables oldParams;
     LALInferenceIFOData *data=runState->data;
     REAL8 tmp;
     REAL8 Target=0.3;
@@ -1500,8 +1670,8 @@ INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
     REAL8 sloppyfraction=maxsloppyfraction/2.0;
     REAL8 minsloppyfraction=0.;
     if(Nmcmc==1) maxsloppyfraction=minsloppyfraction=0.0;
-    if (LALInferenceCheckVariable(runState->algorithmParams,"sloppyfraction"))
-      sloppyfraction=*(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"sloppyfraction");
+    if (!isnan(stats->sloppyfraction))
+      sloppyfraction=stats->sloppyfraction;
     UINT4 mcmc_iter=0,Naccepted=0,sub_accepted=0;
     UINT4 sloppynumber=(UINT4) (sloppyfraction*(REAL8)Nmcmc);
     UINT4 testnumber=Nmcmc-sloppynumber;
@@ -1527,7 +1697,7 @@ INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
         /* Draw an independent sample from the prior */
         do{
 
-            sub_accepted+=LALInferenceMCMCSamplePrior(runState);
+            sub_accepted+=MCMCSamplePriorThread(runState,threadState,rng);
             subchain_length++;
             counter+=(1.-sloppyfraction);
         }while(counter<1);
@@ -1599,17 +1769,16 @@ INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
     /* Compute some statistics for information */
     REAL8 sub_accept_rate=(REAL8)sub_accepted/(REAL8)sub_iter;
     REAL8 accept_rate=(REAL8)Naccepted/(REAL8)testnumber;
-    LALInferenceSetVariable(runState->algorithmParams,"accept_rate",&accept_rate);
-    LALInferenceSetVariable(runState->algorithmParams,"sub_accept_rate",&sub_accept_rate);
+    stats->accept_rate=accept_rate;
+    stats->sub_accept_rate=sub_accept_rate;
     /* Adapt the sloppy fraction toward target acceptance of outer chain */
     if(isfinite(logLmin)){
         if((REAL8)accept_rate>Target) { sloppyfraction+=5.0/(REAL8)Nmcmc;}
         else { sloppyfraction-=5.0/(REAL8)Nmcmc;}
         if(sloppyfraction>maxsloppyfraction) sloppyfraction=maxsloppyfraction;
 	if(sloppyfraction<minsloppyfraction) sloppyfraction=minsloppyfraction;
-
-	LALInferenceSetVariable(runState->algorithmParams,"sloppyfraction",&sloppyfraction);
     }
+    stats->sloppyfraction=sloppyfraction;
     /* Cleanup */
     LALInferenceClearVariables(&oldParams);
 
@@ -1678,8 +1847,12 @@ void LALInferenceSetupLivePointsArray(LALInferenceRunState *runState){
 
 static void SetupEigenProposals(LALInferenceRunState *runState)
 {
-  /* Single thread here */
-  LALInferenceThreadState *threadState = &runState->threads[0];
+  for(INT4 t=0;t<runState->nthreads;t++)
+    SetupEigenProposalsThread(runState,&runState->threads[t]);
+}
+
+static void SetupEigenProposalsThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState)
+{
   gsl_matrix *eVectors=NULL;
   gsl_vector *eValues =NULL;
   REAL8Vector *eigenValues=NULL;
@@ -1741,7 +1914,17 @@ static void SetupEigenProposals(LALInferenceRunState *runState)
 static int syncLivePointsDifferentialPoints(LALInferenceRunState *state, LALInferenceThreadState *thread)
 {
     INT4 N = LALInferenceGetINT4Variable(state->algorithmParams,"Nlive");
-    if(!thread->differentialPoints) thread->differentialPoints=XLALCalloc(N,sizeof(LALInferenceVariables *));
+    if(thread->differentialPoints==state->livePoints)
+    {
+        thread->differentialPointsLength=N;
+        return(XLAL_SUCCESS);
+    }
+    if(thread->differentialPointsSize<(size_t)N)
+    {
+        thread->differentialPoints=XLALRealloc(thread->differentialPoints,N*sizeof(LALInferenceVariables *));
+        for(INT4 i=thread->differentialPointsSize;i<N;i++) thread->differentialPoints[i]=NULL;
+        thread->differentialPointsSize=N;
+    }
 
     for(INT4 i=0;i<N;i++)
     {
@@ -618,7 +618,7 @@ REAL8 LALInferenceSingleAdaptProposal(LALInferenceThreadState *thread,
         do {
             varNr = 1 + gsl_rng_uniform_int(rng, dim);
             param = LALInferenceGetItemNr(proposedParams, varNr);
-        } while (!LALInferenceCheckVariableNonFixed(proposedParams, param->name) || param->type != LALINFERENCE_REAL8_t);
+        } while ((param->vary != LALINFERENCE_PARAM_LINEAR && param->vary != LALINFERENCE_PARAM_CIRCULAR) || param->type != LALINFERENCE_REAL8_t);
 
         if (param->type != LALINFERENCE_REAL8_t) {
             fprintf(stderr, "Attempting to set non-REAL8 parameter with numerical sigma (in %s, %d)\n",
@@ -695,7 +695,7 @@ REAL8 LALInferenceSingleProposal(LALInferenceThreadState *thread,
     do {
         varNr = 1 + gsl_rng_uniform_int(GSLrandom, dim);
         param = LALInferenceGetItemNr(proposedParams, varNr);
-    } while (!LALInferenceCheckVariableNonFixed(proposedParams, param->name) || param->type != LALINFERENCE_REAL8_t);
+    } while ((param->vary != LALINFERENCE_PARAM_LINEAR && param->vary != LALINFERENCE_PARAM_CIRCULAR) || param->type != LALINFERENCE_REAL8_t);
 
     /* Scale jumps proposal appropriately for prior sampling */
     if (LALInferenceGetINT4Variable(args, "sampling_prior")) {
@@ -785,15 +785,16 @@ REAL8 LALInferenceCovarianceEigenvectorJump(LALInferenceThreadState *thread,
         exit(1);
     }
 
+    /* Update the values in the list nodes directly, rather than looking up each by name */
     do {
-        if (LALInferenceCheckVariableNonFixed(proposedParams, proposeIterator->name) &&
+        if ((proposeIterator->vary == LALINFERENCE_PARAM_LINEAR || proposeIterator->vary == LALINFERENCE_PARAM_CIRCULAR) &&
             proposeIterator->type==LALINFERENCE_REAL8_t) {
-            tmp = LALInferenceGetREAL8Variable(proposedParams, proposeIterator->name);
+            tmp = *(REAL8 *)proposeIterator->value;
             inc = jumpSize * gsl_matrix_get(eigenvectors, j, i);
 
             tmp += inc;
 
-            LALInferenceSetVariable(proposedParams, proposeIterator->name, &tmp);
+            *(REAL8 *)proposeIterator->value = tmp;
 
             j++;
         }
@@ -0,0 +1,59 @@
+/*
+ *  fused_likelihood.h: Per-detector kernel of the compiled Gaussian likelihood
+ *
+ *  Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+#ifndef FUSED_LIKELIHOOD_H
+#define FUSED_LIKELIHOOD_H
+
+#include <lal/LALDatatypes.h>
+
+/*
+ * Inputs and outputs of the loop over the frequency bins [lower,upper] of
+ * one detector in LALInferenceFusedFreqDomainLogLikelihood(), for the
+ * Gaussian likelihood without PSD or glitch fitting. All arrays start at
+ * bin 'lower'. The kernels evaluate exactly the same floating-point
+ * operations, in the same order, as that loop, so their results are
+ * identical to it.
+ */
+typedef struct tagFusedLikelihoodKernel {
+  /* Inputs */
+  const COMPLEX16 *dtilde;      /* Data */
+  const REAL8 *psd;             /* One-sided noise PSD */
+  const COMPLEX16 *hptilde;     /* Plus polarisation of the template */
+  const COMPLEX16 *hctilde;     /* Cross polarisation of the template */
+  const COMPLEX16 *calF;        /* Spline calibration factors, or NULL */
+  UINT4 n;                      /* Number of frequency bins */
+  REAL8 deltaT, TwoDeltaToverN;
+  REAL8 Fplus, Fcross;          /* Antenna response, including the amplitude prefactor */
+  REAL8 re, im, dre, dim;       /* Time-shift phase at bin 'lower', and its increments */
+  INT4 constantcal;             /* Apply constant calibration errors */
+  REAL8 calamp, cos_calpha, sin_calpha;
+  /* Outputs */
+  REAL8 loglikelihood;          /* Sum of -chi^2 over bins */
+  REAL8 S;                      /* Sum of (h|h) over bins */
+  COMPLEX16 R;                  /* Sum of (d|h) over bins */
+  REAL8 *dhre;                  /* If not NULL, real part of (d|h) in each bin */
+} FusedLikelihoodKernel;
+
+#ifdef HAVE_AVX2_COMPILER
+void LALInferenceFusedLikelihoodKernel_AVX2(FusedLikelihoodKernel *k);
+#endif
+
+#endif /* FUSED_LIKELIHOOD_H */
@@ -0,0 +1,157 @@
+/*
+ *  LALInferenceBatchLikelihoodTest.c: Testing the batched likelihood in LALInferenceLikelihood.c
+ *
+ *  Copyright (C) 2026
+ *
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_rng.h>
+#include <lal/LALInference.h>
+#include <lal/LALInferenceLikelihood.h>
+#include <lal/XLALError.h>
+#include "LALInferenceTest.h"
+
+#define NIFO 2
+#define NPOINTS 64
+
+int BatchLikelihoodTest(void);
+int BatchLikelihoodErrorTest(void);
+
+int main(void)
+{
+	int failureCount = 0;
+
+	failureCount += BatchLikelihoodTest();
+	printf("\n");
+	failureCount += BatchLikelihoodErrorTest();
+	printf("\n");
+
+	printf("Test results: %i failure(s).\n", failureCount);
+	return failureCount;
+}
+
+/* Model with the per-detector likelihood buffer, which the analytic
+ likelihoods write to like the template and likelihood functions write to
+ the waveform buffers of a model */
+static LALInferenceModel *createModel(void)
+{
+	LALInferenceModel *model = XLALCalloc(1, sizeof(LALInferenceModel));
+	model->ifo_loglikelihoods = XLALCalloc(NIFO, sizeof(REAL8));
+	return model;
+}
+
+static void destroyModel(LALInferenceModel *model)
+{
+	LALInferenceRemoveBatchLikelihood(model);
+	XLALFree(model->ifo_loglikelihoods);
+	XLALFree(model);
+}
+
+/* Compute the likelihoods of random points around the mean of the
+ correlated analytic likelihood in one batch, with one model per point, and
+ check they are identical to those computed one after the other with a
+ single model. Every fourth point is skipped. */
+int BatchLikelihoodTest(void)
+{
+	TEST_HEADER();
+
+	LALInferenceIFOData data[NIFO];
+	memset(data, 0, sizeof(data));
+	for (UINT4 i = 0; i + 1 < NIFO; i++)
+		data[i].next = &data[i + 1];
+
+	gsl_rng *rng = gsl_rng_alloc(gsl_rng_mt19937);
+	gsl_rng_set(rng, 1234);
+
+	LALInferenceVariables *params[NPOINTS];
+	LALInferenceModel *models[NPOINTS];
+	for (UINT4 i = 0; i < NPOINTS; i++) {
+		params[i] = XLALCalloc(1, sizeof(LALInferenceVariables));
+		for (UINT4 j = 0; j < 15; j++) {
+			REAL8 value = LALInferenceAnalyticMeansCBC[j] + 0.1 * (gsl_rng_uniform(rng) - 0.5);
+			LALInferenceAddVariable(params[i], LALInferenceAnalyticNamesCBC[j], &value, LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_LINEAR);
+		}
+		models[i] = createModel();
+	}
+
+	REAL8 serial[NPOINTS], batch[NPOINTS];
+	LALInferenceModel *model = createModel();
+	for (UINT4 i = 0; i < NPOINTS; i++)
+		serial[i] = (i % 4 == 3) ? -INFINITY : LALInferenceCorrelatedAnalyticLogLikelihood(params[i], data, model);
+
+	LALInferenceVariables *batch_params[NPOINTS];
+	for (UINT4 i = 0; i < NPOINTS; i++)
+		batch_params[i] = (i % 4 == 3) ? NULL : params[i];
+	int status = LALInferenceInitBatchLikelihood(model, &LALInferenceCorrelatedAnalyticLogLikelihood, models, NPOINTS);
+	if (status == XLAL_SUCCESS)
+		status = model->batch_likelihood(batch_params, NPOINTS, batch, data, model);
+	if (status != XLAL_SUCCESS)
+		TEST_FAIL("Batched likelihood failed.");
+	for (UINT4 i = 0; status == XLAL_SUCCESS && i < NPOINTS; i++)
+		if (!(batch[i] == serial[i]))
+			TEST_FAIL("Batched likelihood %.17g of point %u differs from serial likelihood %.17g.", batch[i], i, serial[i]);
+
+	/* The batch keeps the models, which are freed with their points */
+	LALInferenceRemoveBatchLikelihood(model);
+	if (model->batch_likelihood != NULL || model->batch != NULL)
+		TEST_FAIL("Batched likelihood was not removed.");
+
+	destroyModel(model);
+	for (UINT4 i = 0; i < NPOINTS; i++) {
+		LALInferenceClearVariables(params[i]);
+		XLALFree(params[i]);
+		destroyModel(models[i]);
+	}
+	gsl_rng_free(rng);
+
+	TEST_FOOTER();
+}
+
+/* A batch must not share models between points, or hold more points than
+ it has models */
+int BatchLikelihoodErrorTest(void)
+{
+	TEST_HEADER();
+
+	LALInferenceModel *model = createModel();
+	LALInferenceModel *models[2] = { createModel(), NULL };
+	LALInferenceVariables *params[3] = { NULL, NULL, NULL };
+	REAL8 logL[3];
+	int errnum;
+
+	models[1] = models[0];
+	XLAL_TRY(LALInferenceInitBatchLikelihood(model, &LALInferenceZeroLogLikelihood, models, 2), errnum);
+	if (errnum != XLAL_EINVAL || model->batch_likelihood != NULL)
+		TEST_FAIL("Batch with a shared model was accepted.");
+
+	models[1] = createModel();
+	if (LALInferenceInitBatchLikelihood(model, &LALInferenceZeroLogLikelihood, models, 2) != XLAL_SUCCESS)
+		TEST_FAIL("Could not set up the batched likelihood.");
+	XLAL_TRY(LALInferenceBatchLogLikelihood(params, 3, logL, NULL, model), errnum);
+	if (errnum != XLAL_EINVAL)
+		TEST_FAIL("Batch of 3 points with 2 models was accepted.");
+
+	destroyModel(model);
+	destroyModel(models[0]);
+	destroyModel(models[1]);
+
+	TEST_FOOTER();
+}
@@ -170,6 +170,8 @@ int main(int argc, char *argv[]){
   runState->threads[0].model->waveformCache=NULL;
   
   int result = compare_template(runState);
+
+  LALInferenceRemoveLikelihoodPlans(runState);
   
   return(result);
 }
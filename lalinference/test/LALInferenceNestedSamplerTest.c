@@ -0,0 +1,360 @@
+/*
+ *  LALInferenceNestedSamplerTest.c: Testing the Nested Sampling routines in LALInferenceNestedSampler.c
+ *
+ *  Copyright (C) 2026
+ *
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_linalg.h>
+#include <lal/LALConstants.h>
+#include <lal/StringVector.h>
+#include <lal/LALInference.h>
+#include <lal/LALInferenceNestedSampler.h>
+#include <lal/LALInferencePrior.h>
+#include <lal/LALInferenceLikelihood.h>
+#include <lal/LALInferenceProposal.h>
+#include <lal/XLALError.h>
+#include "LALInferenceTest.h"
+
+#ifdef __GNUC__
+#define UNUSED __attribute__ ((unused))
+#else
+#define UNUSED
+#endif
+
+#define NLIVE 50
+#define NRUNS 1000
+#define LAMBDA exp(12.0)
+
+#define ANALYTIC_NLIVE 200
+#define ANALYTIC_NMCMC 100
+#define DIM 15
+
+int SerialTest(void);
+int ParallelTest(void);
+int CorrelatedSerialTest(void);
+int CorrelatedParallelTest(void);
+int BimodalParallelTest(void);
+
+/* Run the nested sampling algorithm on the likelihood -LAMBDA*x, with a
+ flat prior on 0<x<1, replacing Nthreads live points at once. The new points
+ are drawn exactly from the prior above the likelihood bound, so the log
+ prior volume log(X) after each removal has the known distribution of the
+ nested sampling integrator.
+ Returns the estimated log evidence, and sets the logw of the last
+ iteration, averaged over the NRUNS parallel runs, and the number of removed
+ points. */
+static REAL8 runExactNestedSampling(UINT4 Nthreads, REAL8 *logw, UINT4 *Nremoved);
+
+/* Run the nested sampling algorithm on an analytic likelihood, with a flat
+ prior over a box of +/- halfwidth standard deviations around the means of
+ LALInferenceAnalyticMeansCBC, replacing Nthreads live points at once, with
+ the MCMC proposals used in practice.
+ Returns the estimated log evidence, and sets the exact log evidence and
+ information, and the number of removed points. */
+static REAL8 runAnalyticNestedSampling(LALInferenceLikelihoodFunction likelihood, REAL8 halfwidth, UINT4 Nthreads, REAL8 *logZtrue, REAL8 *H, UINT4 *Nremoved);
+
+int main(void)
+{
+	int failureCount = 0;
+
+	failureCount += SerialTest();
+	printf("\n");
+	failureCount += ParallelTest();
+	printf("\n");
+	failureCount += CorrelatedSerialTest();
+	printf("\n");
+	failureCount += CorrelatedParallelTest();
+	printf("\n");
+	failureCount += BimodalParallelTest();
+	printf("\n");
+
+	printf("Test results: %i failure(s).\n", failureCount);
+	return failureCount;
+}
+
+static REAL8 ExactLogLikelihood(LALInferenceVariables *currentParams, LALInferenceIFOData UNUSED *data, LALInferenceModel UNUSED *model)
+{
+	return -LAMBDA * *(REAL8 *)LALInferenceGetVariable(currentParams, "x");
+}
+
+/* Draw x uniformly from the region of the prior where the likelihood is
+ above the current bound */
+static REAL8 ExactConstrainedProposal(LALInferenceThreadState *thread, LALInferenceVariables UNUSED *currentParams, LALInferenceVariables *proposedParams)
+{
+	REAL8 logLmin = *(REAL8 *)LALInferenceGetVariable(thread->parent->algorithmParams, "logLmin");
+	REAL8 x = (isfinite(logLmin) ? fmin(1.0, -logLmin / LAMBDA) : 1.0) * gsl_rng_uniform(thread->GSLrandom);
+	LALInferenceSetVariable(proposedParams, "x", &x);
+	return 0.0;
+}
+
+static REAL8 runExactNestedSampling(UINT4 Nthreads, REAL8 *logw, UINT4 *Nremoved)
+{
+	char Nlive[16], Nruns[16], Nthreadsarg[16], outfile[64];
+	snprintf(Nlive, sizeof(Nlive), "%i", NLIVE);
+	snprintf(Nruns, sizeof(Nruns), "%i", NRUNS);
+	snprintf(Nthreadsarg, sizeof(Nthreadsarg), "%u", Nthreads);
+	snprintf(outfile, sizeof(outfile), "LALInferenceNestedSamplerTest_%u.dat", Nthreads);
+	remove(outfile);
+	LALStringVector *args = XLALCreateStringVector("LALInferenceNestedSamplerTest", "--Nlive", Nlive, "--Nmcmc", "1", "--Nruns", Nruns, "--Nthreads", Nthreadsarg, "--outfile", outfile, NULL);
+
+	LALInferenceRunState *runState = XLALCalloc(1, sizeof(LALInferenceRunState));
+	runState->commandLine = LALInferenceParseStringVector(args);
+	XLALDestroyStringVector(args);
+	runState->algorithmParams = XLALCalloc(1, sizeof(LALInferenceVariables));
+	runState->priorArgs = XLALCalloc(1, sizeof(LALInferenceVariables));
+	runState->proposalArgs = XLALCalloc(1, sizeof(LALInferenceVariables));
+	runState->GSLrandom = gsl_rng_alloc(gsl_rng_mt19937);
+	gsl_rng_set(runState->GSLrandom, 1234);
+	runState->prior = &LALInferenceAnalyticNullPrior;
+	runState->likelihood = &ExactLogLikelihood;
+	runState->data = NULL;
+
+	LALInferenceVariables params;
+	memset(&params, 0, sizeof(params));
+	REAL8 x = 0.5, min = 0.0, max = 1.0;
+	LALInferenceAddVariable(&params, "x", &x, LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_LINEAR);
+	LALInferenceAddMinMaxPrior(runState->priorArgs, "x", &min, &max, LALINFERENCE_REAL8_t);
+
+	/* One thread per live point replaced at once, each with its own
+	   proposal and random number generator */
+	runState->nthreads = Nthreads;
+	runState->threads = LALInferenceInitThreads(Nthreads);
+	for (UINT4 t = 0; t < Nthreads; t++) {
+		LALInferenceThreadState *thread = &runState->threads[t];
+		thread->parent = runState;
+		thread->model = XLALCalloc(1, sizeof(LALInferenceModel));
+		LALInferenceCopyVariables(&params, thread->currentParams);
+		XLALFree(thread->priorArgs);
+		thread->priorArgs = runState->priorArgs;
+		thread->GSLrandom = gsl_rng_alloc(gsl_rng_mt19937);
+		gsl_rng_set(thread->GSLrandom, gsl_rng_get(runState->GSLrandom));
+		thread->cycle = LALInferenceInitProposalCycle();
+		LALInferenceAddProposalToCycle(thread->cycle, LALInferenceInitProposal(&ExactConstrainedProposal, "ExactConstrainedProposal"), 1);
+	}
+	LALInferenceClearVariables(&params);
+
+	REAL8 logZnoise = 0.0;
+	LALInferenceAddVariable(runState->algorithmParams, "logZnoise", &logZnoise, LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_FIXED);
+
+	LALInferenceNestedSamplingAlgorithmInit(runState);
+	LALInferenceSetupLivePointsArray(runState);
+	runState->algorithm(runState);
+
+	/* logw decreases with every removal, so the live points replaced in the
+	   last iteration carry the lowest value */
+	*logw = INFINITY;
+	for (UINT4 i = 0; i < NLIVE; i++)
+		*logw = fmin(*logw, *(REAL8 *)LALInferenceGetVariable(runState->livePoints[i], "logw"));
+	*Nremoved = *(INT4 *)LALInferenceGetVariable(runState->algorithmParams, "N_outputarray") - NLIVE;
+	return *(REAL8 *)LALInferenceGetVariable(runState->algorithmParams, "logZ");
+}
+
+static REAL8 runAnalyticNestedSampling(LALInferenceLikelihoodFunction likelihood, REAL8 halfwidth, UINT4 Nthreads, REAL8 *logZtrue, REAL8 *H, UINT4 *Nremoved)
+{
+	char Nlive[16], Nmcmc[16], Nthreadsarg[16], outfile[64];
+	snprintf(Nlive, sizeof(Nlive), "%i", ANALYTIC_NLIVE);
+	snprintf(Nmcmc, sizeof(Nmcmc), "%i", ANALYTIC_NMCMC);
+	snprintf(Nthreadsarg, sizeof(Nthreadsarg), "%u", Nthreads);
+	snprintf(outfile, sizeof(outfile), "LALInferenceNestedSamplerTest_analytic_%u.dat", Nthreads);
+	remove(outfile);
+	LALStringVector *args = XLALCreateStringVector("LALInferenceNestedSamplerTest", "--Nlive", Nlive, "--Nmcmc", Nmcmc, "--Nthreads", Nthreadsarg, "--outfile", outfile, NULL);
+
+	LALInferenceRunState *runState = XLALCalloc(1, sizeof(LALInferenceRunState));
+	runState->commandLine = LALInferenceParseStringVector(args);
+	XLALDestroyStringVector(args);
+	runState->algorithmParams = XLALCalloc(1, sizeof(LALInferenceVariables));
+	runState->priorArgs = XLALCalloc(1, sizeof(LALInferenceVariables));
+	runState->proposalArgs = XLALCalloc(1, sizeof(LALInferenceVariables));
+	runState->GSLrandom = gsl_rng_alloc(gsl_rng_mt19937);
+	gsl_rng_set(runState->GSLrandom, 1234);
+	runState->prior = &LALInferenceAnalyticNullPrior;
+	runState->likelihood = likelihood;
+	runState->data = NULL;
+
+	/* Parameters at the means of the analytic likelihood */
+	LALInferenceVariables params;
+	memset(&params, 0, sizeof(params));
+	for (UINT4 i = 0; i < DIM; i++)
+		LALInferenceAddVariable(&params, LALInferenceAnalyticNamesCBC[i], (void *)&LALInferenceAnalyticMeansCBC[i], LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_LINEAR);
+	LALInferenceModel model;
+	memset(&model, 0, sizeof(model));
+
+	/* The correlated likelihood is quadratic, so central differences give
+	   its precision matrix A exactly, up to rounding */
+	const REAL8 h = 1e-2;
+	gsl_matrix *A = gsl_matrix_alloc(DIM, DIM);
+	for (UINT4 i = 0; i < DIM; i++)
+		for (UINT4 j = 0; j < DIM; j++) {
+			REAL8 f[4], x;
+			for (UINT4 n = 0; n < 4; n++) {
+				x = LALInferenceAnalyticMeansCBC[i] + (n < 2 ? h : -h);
+				LALInferenceSetVariable(&params, LALInferenceAnalyticNamesCBC[i], &x);
+				x = *(REAL8 *)LALInferenceGetVariable(&params, LALInferenceAnalyticNamesCBC[j]) + (n % 2 ? -h : h);
+				LALInferenceSetVariable(&params, LALInferenceAnalyticNamesCBC[j], &x);
+				f[n] = LALInferenceCorrelatedAnalyticLogLikelihood(&params, NULL, &model);
+				LALInferenceSetVariable(&params, LALInferenceAnalyticNamesCBC[i], (void *)&LALInferenceAnalyticMeansCBC[i]);
+				LALInferenceSetVariable(&params, LALInferenceAnalyticNamesCBC[j], (void *)&LALInferenceAnalyticMeansCBC[j]);
+			}
+			gsl_matrix_set(A, i, j, -(f[0] - f[1] - f[2] + f[3]) / (4.0 * h * h));
+		}
+	gsl_permutation *perm = gsl_permutation_alloc(DIM);
+	gsl_matrix *cov = gsl_matrix_alloc(DIM, DIM);
+	int signum;
+	gsl_linalg_LU_decomp(A, perm, &signum);
+	gsl_linalg_LU_invert(A, perm, cov);
+	const REAL8 logdetA = gsl_linalg_LU_lndet(A);
+
+	/* Flat prior over the box, and the exact evidence and information.
+	   The modes of the bimodal likelihood are 4 standard deviations either
+	   side of the means, and each contributes the evidence of one Gaussian */
+	REAL8 logV = 0.0;
+	for (UINT4 i = 0; i < DIM; i++) {
+		REAL8 sigma = sqrt(gsl_matrix_get(cov, i, i));
+		REAL8 min = LALInferenceAnalyticMeansCBC[i] - halfwidth * sigma;
+		REAL8 max = LALInferenceAnalyticMeansCBC[i] + halfwidth * sigma;
+		LALInferenceAddMinMaxPrior(runState->priorArgs, LALInferenceAnalyticNamesCBC[i], &min, &max, LALINFERENCE_REAL8_t);
+		logV += log(max - min);
+	}
+	REAL8 logNmodes = (likelihood == LALInferenceBimodalCorrelatedAnalyticLogLikelihood) ? log(2.0) : 0.0;
+	*logZtrue = 0.5 * DIM * log(2.0 * LAL_PI) - 0.5 * logdetA - logV + logNmodes;
+	*H = logV - 0.5 * DIM * (1.0 + log(2.0 * LAL_PI)) + 0.5 * logdetA - logNmodes;
+	gsl_matrix_free(cov);
+	gsl_matrix_free(A);
+	gsl_permutation_free(perm);
+
+	/* One thread per live point replaced at once, each with its own
+	   proposals and random number generator */
+	runState->nthreads = Nthreads;
+	runState->threads = LALInferenceInitThreads(Nthreads);
+	for (UINT4 t = 0; t < Nthreads; t++) {
+		LALInferenceThreadState *thread = &runState->threads[t];
+		thread->parent = runState;
+		thread->model = XLALCalloc(1, sizeof(LALInferenceModel));
+		LALInferenceCopyVariables(&params, thread->currentParams);
+		XLALFree(thread->priorArgs);
+		thread->priorArgs = runState->priorArgs;
+		thread->GSLrandom = gsl_rng_alloc(gsl_rng_mt19937);
+		gsl_rng_set(thread->GSLrandom, gsl_rng_get(runState->GSLrandom));
+		thread->cycle = LALInferenceInitProposalCycle();
+		LALInferenceAddProposalToCycle(thread->cycle, LALInferenceInitProposal(&LALInferenceCovarianceEigenvectorJump, "CovarianceEigenvectorJump"), 1);
+		LALInferenceAddProposalToCycle(thread->cycle, LALInferenceInitProposal(&LALInferenceDifferentialEvolutionFull, "DifferentialEvolutionFull"), 1);
+		LALInferenceRandomizeProposalCycle(thread->cycle, thread->GSLrandom);
+	}
+	LALInferenceClearVariables(&params);
+
+	REAL8 logZnoise = 0.0;
+	LALInferenceAddVariable(runState->algorithmParams, "logZnoise", &logZnoise, LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_FIXED);
+
+	LALInferenceNestedSamplingAlgorithmInit(runState);
+	LALInferenceSetupLivePointsArray(runState);
+	runState->algorithm(runState);
+
+	*Nremoved = *(INT4 *)LALInferenceGetVariable(runState->algorithmParams, "N_outputarray") - ANALYTIC_NLIVE;
+	return *(REAL8 *)LALInferenceGetVariable(runState->algorithmParams, "logZ");
+}
+
+/* Check the evidence estimate against the exact value, allowing 5 times its
+ expected statistical error sqrt(H/Nlive), with H=log(LAMBDA)-1. The
+ shrinkage t drawn after removal m of an iteration is the largest of the
+ n=Nlive-m-1 uniform deviates left, or of n=Nlive once the new points are
+ drawn after the last removal, so E[log t]=-1/n and Var[log t]=1/n^2. The
+ logw averaged over the parallel runs must match the sum of E[log t] to
+ within 5 times its standard error, which resolves a bias of order
+ Nthreads/Nlive in log(X) over the run. */
+#define CHECK_NESTED_SAMPLING(Nthreads) \
+{ \
+	REAL8 logw; \
+	UINT4 Nremoved; \
+	REAL8 logZ = runExactNestedSampling(Nthreads, &logw, &Nremoved); \
+	REAL8 logZtrue = log1p(-exp(-LAMBDA)) - log(LAMBDA); \
+	REAL8 tolerance = 5.0 * sqrt((log(LAMBDA) - 1.0) / NLIVE); \
+	printf("Nthreads=%u: logZ=%.3f, exact logZ=%.3f, tolerance %.3f\n", Nthreads, logZ, logZtrue, tolerance); \
+	if (!(fabs(logZ - logZtrue) < tolerance)) \
+		TEST_FAIL("Evidence %g differs from exact value %g by more than %g.", logZ, logZtrue, tolerance); \
+	REAL8 Elogw = 0.0, Varlogw = 0.0; \
+	for (UINT4 j = 0; j < Nremoved; j++) { \
+		UINT4 m = j % Nthreads, n = m + 1 < Nthreads ? NLIVE - m - 1 : NLIVE; \
+		Elogw -= 1.0 / n; \
+		Varlogw += 1.0 / ((REAL8) n * n); \
+	} \
+	tolerance = 5.0 * sqrt(Varlogw / NRUNS); \
+	printf("Nthreads=%u: %u points removed, logw=%.4f, expected %.4f, tolerance %.4f\n", Nthreads, Nremoved, logw, Elogw, tolerance); \
+	if (!(fabs(logw - Elogw) < tolerance)) \
+		TEST_FAIL("Log prior volume %g differs from expected value %g by more than %g.", logw, Elogw, tolerance); \
+	if (Nremoved % Nthreads != 0) \
+		TEST_FAIL("%u points removed, not a multiple of the %u replaced at once.", Nremoved, Nthreads); \
+}
+
+int SerialTest(void)
+{
+	TEST_HEADER();
+	CHECK_NESTED_SAMPLING(1);
+	TEST_FOOTER();
+}
+
+int ParallelTest(void)
+{
+	TEST_HEADER();
+	CHECK_NESTED_SAMPLING(4);
+	TEST_FOOTER();
+}
+
+/* Check the evidence estimate against the exact value, allowing 5 times its
+ expected statistical error sqrt(H/Nlive). With several points replaced at
+ once, the MCMC sub-chains start from fewer surviving points, so this also
+ checks that the new points are still drawn from the constrained prior. */
+#define CHECK_ANALYTIC_EVIDENCE(likelihood, halfwidth, Nthreads) \
+{ \
+	REAL8 logZtrue, H; \
+	UINT4 Nremoved; \
+	REAL8 logZ = runAnalyticNestedSampling(likelihood, halfwidth, Nthreads, &logZtrue, &H, &Nremoved); \
+	REAL8 tolerance = 5.0 * sqrt(H / ANALYTIC_NLIVE); \
+	printf("Nthreads=%u: logZ=%.3f, exact logZ=%.3f, H=%.2f nats, tolerance %.3f\n", Nthreads, logZ, logZtrue, H, tolerance); \
+	if (!(fabs(logZ - logZtrue) < tolerance)) \
+		TEST_FAIL("Evidence %g differs from exact value %g by more than %g.", logZ, logZtrue, tolerance); \
+	if (Nremoved % Nthreads != 0) \
+		TEST_FAIL("%u points removed, not a multiple of the %u replaced at once.", Nremoved, Nthreads); \
+}
+
+int CorrelatedSerialTest(void)
+{
+	TEST_HEADER();
+	CHECK_ANALYTIC_EVIDENCE(LALInferenceCorrelatedAnalyticLogLikelihood, 5.0, 1);
+	TEST_FOOTER();
+}
+
+int CorrelatedParallelTest(void)
+{
+	TEST_HEADER();
+	CHECK_ANALYTIC_EVIDENCE(LALInferenceCorrelatedAnalyticLogLikelihood, 5.0, 4);
+	TEST_FOOTER();
+}
+
+int BimodalParallelTest(void)
+{
+	TEST_HEADER();
+	CHECK_ANALYTIC_EVIDENCE(LALInferenceBimodalCorrelatedAnalyticLogLikelihood, 9.0, 4);
+	TEST_FOOTER();
+}
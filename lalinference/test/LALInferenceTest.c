@@ -59,6 +59,11 @@ int LALInferenceProcessParamLine_TEST_CHARFILE(void);
 /*  LALInferenceExecuteFT tests */
 int LALInferenceExecuteFTTEST_NULLPLAN(void);
 
+/*  LALInferenceVariables fast access tests */
+int LALInferenceCopyVariablesTEST_INPLACE(void);
+int LALInferenceVariableSlotTEST(void);
+int LALInferenceREAL8ViewTEST(void);
+
 int main(void){
     
 	int failureCount = 0;
@@ -77,6 +82,12 @@ int main(void){
 	printf("\n");
 	failureCount += LALInferenceExecuteFTTEST_NULLPLAN();
 	printf("\n");
+	failureCount += LALInferenceCopyVariablesTEST_INPLACE();
+	printf("\n");
+	failureCount += LALInferenceVariableSlotTEST();
+	printf("\n");
+	failureCount += LALInferenceREAL8ViewTEST();
+	printf("\n");
 	printf("Test results: %i failure(s).\n", failureCount);
 
 	return failureCount;
@@ -357,6 +368,147 @@ int LALInferenceExecuteFTTEST_NULLPLAN(void){
 }
 
 
+/*****************     TEST CODE for LALInferenceVariables fast access     *****************/
+
+/* Fill vars with some varying, fixed and output parameters, and a vector */
+static void FillTestVariables(LALInferenceVariables *vars)
+{
+    INT4 approx=1;
+    REAL8Vector *vec=XLALCreateREAL8Vector(3);
+    vec->data[0]=1.0; vec->data[1]=2.0; vec->data[2]=3.0;
+    LALInferenceAddREAL8Variable(vars,"distance",100.0,LALINFERENCE_PARAM_LINEAR);
+    LALInferenceAddREAL8Variable(vars,"phase",1.0,LALINFERENCE_PARAM_CIRCULAR);
+    LALInferenceAddREAL8Variable(vars,"f_ref",20.0,LALINFERENCE_PARAM_FIXED);
+    LALInferenceAddREAL8Variable(vars,"logL",-5.0,LALINFERENCE_PARAM_OUTPUT);
+    LALInferenceAddVariable(vars,"LAL_APPROXIMANT",&approx,LALINFERENCE_INT4_t,LALINFERENCE_PARAM_FIXED);
+    LALInferenceAddVariable(vars,"vector",&vec,LALINFERENCE_REAL8Vector_t,LALINFERENCE_PARAM_FIXED);
+    LALInferenceAddREAL8Variable(vars,"time",10.0,LALINFERENCE_PARAM_LINEAR);
+}
+
+/* Test that copying into variables with the same layout keeps the list nodes, and gives the same result */
+int LALInferenceCopyVariablesTEST_INPLACE(void){
+    TEST_HEADER();
+    LALInferenceVariables origin,target;
+    memset(&origin,0,sizeof(origin));
+    memset(&target,0,sizeof(target));
+    FillTestVariables(&origin);
+
+    LALInferenceCopyVariables(&origin,&target);
+    LALInferenceVariableItem *item=LALInferenceGetItem(&target,"time");
+    UINT8 generation=target.generation;
+
+    LALInferenceSetREAL8Variable(&origin,"time",11.0);
+    (*(REAL8Vector **)LALInferenceGetVariable(&origin,"vector"))->data[1]=-2.0;
+    LALInferenceCopyVariables(&origin,&target);
+
+    if (LALInferenceCompareVariables(&origin,&target))
+        TEST_FAIL("Copied variables differ from the original.");
+    if (item!=LALInferenceGetItem(&target,"time") || generation!=target.generation)
+        TEST_FAIL("Copy into variables with the same layout reallocated them.");
+    if (*(REAL8Vector **)LALInferenceGetVariable(&origin,"vector")==*(REAL8Vector **)LALInferenceGetVariable(&target,"vector"))
+        TEST_FAIL("Copy did not copy the vector.");
+
+    /* Changing the vary type of a parameter changes the layout */
+    LALInferenceSetParamVaryType(&origin,"time",LALINFERENCE_PARAM_FIXED);
+    LALInferenceCopyVariables(&origin,&target);
+    if (LALInferenceGetVariableVaryType(&target,"time")!=LALINFERENCE_PARAM_FIXED || generation==target.generation)
+        TEST_FAIL("Copy did not update the vary type.");
+
+    /* Copying variables with a different layout rebuilds the target */
+    LALInferenceRemoveVariable(&target,"phase");
+    LALInferenceAddREAL8Variable(&target,"phase",0.0,LALINFERENCE_PARAM_CIRCULAR);
+    LALInferenceCopyVariables(&origin,&target);
+    if (LALInferenceCompareVariables(&origin,&target))
+        TEST_FAIL("Copied variables with a different layout differ from the original.");
+
+    LALInferenceClearVariables(&origin);
+    LALInferenceClearVariables(&target);
+    TEST_FOOTER();
+}
+
+/* Test reading and writing variables through handles, as the variables change */
+int LALInferenceVariableSlotTEST(void){
+    TEST_HEADER();
+    int errnum;
+    REAL8 value;
+    LALInferenceVariables vars;
+    LALInferenceVariableSlot distance,f_ref;
+    memset(&vars,0,sizeof(vars));
+    FillTestVariables(&vars);
+    LALInferenceInitVariableSlot(&distance,"distance");
+    LALInferenceInitVariableSlot(&f_ref,"f_ref");
+
+    if (LALInferenceGetREAL8Slot(&vars,&distance)!=100.0)
+        TEST_FAIL("Wrong value read through handle.");
+    LALInferenceSetREAL8Slot(&vars,&distance,200.0);
+    if (LALInferenceGetREAL8Variable(&vars,"distance")!=200.0)
+        TEST_FAIL("Wrong value written through handle.");
+    LALInferenceSetREAL8Slot(&vars,&f_ref,30.0);
+    if (LALInferenceGetREAL8Slot(&vars,&f_ref)!=20.0)
+        TEST_FAIL("Fixed variable written through handle.");
+
+    /* The handle must follow the variable when it is removed and added again */
+    LALInferenceRemoveVariable(&vars,"distance");
+    if (LALInferenceCheckVariableSlot(&vars,&distance))
+        TEST_FAIL("Handle found removed variable.");
+    XLAL_TRY(value=LALInferenceGetREAL8Slot(&vars,&distance), errnum);
+    (void)value;
+    if (errnum==XLAL_SUCCESS)
+        TEST_FAIL("Reading removed variable through handle should fail.");
+    LALInferenceAddREAL8Variable(&vars,"distance",300.0,LALINFERENCE_PARAM_LINEAR);
+    if (LALInferenceGetREAL8Slot(&vars,&distance)!=300.0)
+        TEST_FAIL("Wrong value read through handle after adding variable again.");
+
+    LALInferenceClearVariables(&vars);
+    TEST_FOOTER();
+}
+
+/* Test gathering and scattering the varying REAL8 parameters through a view */
+int LALInferenceREAL8ViewTEST(void){
+    TEST_HEADER();
+    int errnum;
+    REAL8 array[3];
+    LALInferenceVariables current,proposed;
+    memset(&current,0,sizeof(current));
+    memset(&proposed,0,sizeof(proposed));
+    FillTestVariables(&current);
+    LALInferenceCopyVariables(&current,&proposed);
+
+    LALInferenceREAL8View *view=LALInferenceCreateREAL8View(&current);
+    if (view==NULL || view->length!=3) {
+        TEST_FAIL("View does not have the 3 varying REAL8 variables.");
+        TEST_FOOTER();
+    }
+
+    /* Same order as LALInferenceCopyVariablesToArray */
+    LALInferenceCopyVariablesToArray(&current,array);
+    if (memcmp(array,view->data,sizeof(array)))
+        TEST_FAIL("View is not in the order of LALInferenceCopyVariablesToArray.");
+    if (LALInferenceREAL8ViewIndex(view,"f_ref")!=-1 || LALInferenceREAL8ViewIndex(view,"time")<0)
+        TEST_FAIL("Wrong view indices.");
+
+    view->data[LALInferenceREAL8ViewIndex(view,"time")]=12.0;
+    if (LALInferenceREAL8ViewScatter(view,&proposed)!=XLAL_SUCCESS || LALInferenceGetREAL8Variable(&proposed,"time")!=12.0)
+        TEST_FAIL("Scatter into proposed variables failed.");
+    if (LALInferenceREAL8ViewGather(view,&current)!=XLAL_SUCCESS || view->data[LALInferenceREAL8ViewIndex(view,"time")]!=10.0)
+        TEST_FAIL("Gather from current variables failed.");
+
+    /* Variables with different varying parameters must be rejected */
+    LALInferenceSetParamVaryType(&proposed,"time",LALINFERENCE_PARAM_FIXED);
+    XLAL_TRY(LALInferenceREAL8ViewGather(view,&proposed), errnum);
+    if (errnum==XLAL_SUCCESS)
+        TEST_FAIL("Gather from variables with different varying parameters should fail.");
+    LALInferenceCopyVariables(&current,&proposed);
+    if (LALInferenceREAL8ViewGather(view,&proposed)!=XLAL_SUCCESS)
+        TEST_FAIL("Gather failed after copying variables.");
+
+    LALInferenceDestroyREAL8View(view);
+    LALInferenceClearVariables(&current);
+    LALInferenceClearVariables(&proposed);
+    TEST_FOOTER();
+}
+
+
 /******************************************
  * 
  * Old tests
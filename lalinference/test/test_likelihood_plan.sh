@@ -0,0 +1,12 @@
+#!/bin/sh
+
+# Check that the compiled likelihood plan gives bitwise identical results to the general likelihood
+# for a short two-detector run of lalinference_bench, which exits with non-zero status otherwise
+
+set -e
+
+"${LAL_TEST_BUILDDIR}/../bin/lalinference_bench" --check-likelihood-plan --Niter 20 \
+    --psdlength 32 --psdstart 1 --seglen 4 --srate 1024 --trigtime 0 \
+    --ifo H1 --H1-channel LALSimAdLIGO --H1-cache LALSimAdLIGO \
+    --ifo L1 --L1-channel LALSimAdLIGO --L1-cache LALSimAdLIGO \
+    --dataseed 1324 --randomseed 1324 --fix-chirpmass 1.218 --fix-q 1.0 --amporder 0
@@ -44,6 +44,7 @@ struct tagFstatInput {
   FstatMethodType method;				// Method to use for computing the F-statistic
   FstatCommon common;					// Common input data
   int *workspace_refcount;				// Reference counter for the shared workspace 'common.workspace'
+  BOOLEAN isWorker;					// Flag if this is a worker of another FstatInput struct, see XLALFstatInputWorker()
   FstatMethodFuncs method_funcs;			// Function pointers for F-statistic method
   void *method_data;					// F-statistic method data
 };
@@ -51,6 +52,7 @@ struct tagFstatInput {
 // ---------- Internal prototypes ---------- //
 
 static int XLALSelectBestFstatMethod ( FstatMethodType *method );
+static BOOLEAN XLALFstatMethodIsResamp ( FstatMethodType method );
 
 int XLALSetupFstatDemod  ( void **method_data, FstatCommon *common, FstatMethodFuncs* funcs, MultiSFTVector *multiSFTs, const FstatOptionalArgs *optArgs );
 int XLALSetupFstatResamp ( void **method_data, FstatCommon *common, FstatMethodFuncs* funcs, MultiSFTVector *multiSFTs, const FstatOptionalArgs *optArgs );
@@ -62,12 +64,22 @@ static const char *const FstatMethodNames[FMETHOD_END] = {
   [FMETHOD_DEMOD_OPTC]		= "DemodOptC",
   [FMETHOD_DEMOD_ALTIVEC]	= "DemodAltivec",
   [FMETHOD_DEMOD_SSE]		= "DemodSSE",
+  [FMETHOD_DEMOD_AVX2]		= "DemodAVX2",
+  [FMETHOD_DEMOD_AVX512]	= "DemodAVX512",
   [FMETHOD_DEMOD_BEST]		= "DemodBest",
 
   [FMETHOD_RESAMP_GENERIC]	= "ResampGeneric",
   [FMETHOD_RESAMP_BEST]		= "ResampBest",
 };
 
+// Available Fstat methods of each class, from fastest to slowest, for selecting the 'best' method
+static const FstatMethodType FstatMethodsDemodFastestFirst[] = {
+  FMETHOD_DEMOD_AVX512, FMETHOD_DEMOD_AVX2, FMETHOD_DEMOD_SSE, FMETHOD_DEMOD_ALTIVEC, FMETHOD_DEMOD_OPTC, FMETHOD_DEMOD_GENERIC
+};
+static const FstatMethodType FstatMethodsResampFastestFirst[] = {
+  FMETHOD_RESAMP_GENERIC
+};
+
 const FstatOptionalArgs FstatOptionalArgsDefaults = {
   .randSeed = 0,
   .SSBprec = SSBPREC_RELATIVISTICOPT,
@@ -79,7 +91,9 @@ const FstatOptionalArgs FstatOptionalArgsDefaults = {
   .assumeSqrtSX = NULL,
   .prevInput = NULL,
   .collectTiming = 0,
-  .resampFFTPowerOf2 = 1
+  .resampFFTPowerOf2 = 1,
+  .resampSRCPoolMaxMB = 0,
+  .runningMedianThreads = 1
 };
 
 static const char FstatTimingGenericHelp[] =
@@ -411,6 +425,13 @@ XLALCreateFstatInput ( const SFTCatalog *SFTcatalog,              ///< [in] Cata
     setupFuncMethod = XLALSetupFstatDemod;
     break;
 
+  case FMETHOD_DEMOD_AVX2:		// Demod: AVX2 hotloop
+  case FMETHOD_DEMOD_AVX512:		// Demod: AVX-512 hotloop
+    XLAL_CHECK_NULL ( optArgs.Dterms > 0, XLAL_EINVAL );
+    extraBinsMethod = optArgs.Dterms;
+    setupFuncMethod = XLALSetupFstatDemod;
+    break;
+
   case FMETHOD_RESAMP_GENERIC:		// Resamp: generic implementation
     extraBinsMethod = 8;   // use 8 extra bins to give better agreement with Demod(w Dterms=8) near the boundaries
     setupFuncMethod = XLALSetupFstatResamp;
@@ -569,7 +590,7 @@ XLALCreateFstatInput ( const SFTCatalog *SFTcatalog,              ///< [in] Cata
 
   // Normalise SFTs using either running median or assumed PSDs
   MultiPSDVector *runningMedian;
-  XLAL_CHECK_NULL ( (runningMedian = XLALNormalizeMultiSFTVect ( multiSFTs, optArgs.runningMedianWindow, optArgs.assumeSqrtSX )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK_NULL ( (runningMedian = XLALNormalizeMultiSFTVectParallel ( multiSFTs, optArgs.runningMedianWindow, optArgs.assumeSqrtSX, optArgs.runningMedianThreads )) != NULL, XLAL_EFUNC );
 
   // Calculate SFT noise weights from PSD
   XLAL_CHECK_NULL ( (common->multiNoiseWeights = XLALComputeMultiNoiseWeights ( runningMedian, optArgs.runningMedianWindow, 0 )) != NULL, XLAL_EFUNC );
@@ -723,15 +744,15 @@ XLALGetFstatInputDetectorStates ( const FstatInput* input       ///< [in] \c Fst
 } // XLALGetFstatInputDetectorStates()
 
 ///
-/// Compute the \f$\mathcal{F}\f$-statistic over a band of frequencies.
+/// Check input to, and initialise results structure for, XLALComputeFstat() and XLALComputeFstatBatch()
 ///
-int
-XLALComputeFstat ( FstatResults **Fstats,               ///< [in/out] Address of a pointer to a #FstatResults results structure; if \c NULL, allocate here.
-                   FstatInput *input,                   ///< [in] Input data structure created by one of the setup functions.
-                   const PulsarDopplerParams *doppler,  ///< [in] Doppler parameters, including starting frequency, at which to compute \f$2\mathcal{F}\f$
-                   const UINT4 numFreqBins,             ///< [in] Number of frequencies at which the \f$2\mathcal{F}\f$ are to be computed. Must be 1 if XLALCreateFstatInput() was passed zero \c dFreq.
-                   const FstatQuantities whatToCompute  ///< [in] Bit-field of which \f$\mathcal{F}\f$-statistic quantities to compute.
-                   )
+static int
+XLALPrepareFstatResults ( FstatResults **Fstats,               ///< [in/out] Address of a pointer to a #FstatResults results structure; if \c NULL, allocate here.
+                          const FstatInput *input,             ///< [in] Input data structure created by one of the setup functions.
+                          const PulsarDopplerParams *doppler,  ///< [in] Doppler parameters, including starting frequency, at which to compute \f$2\mathcal{F}\f$
+                          const UINT4 numFreqBins,             ///< [in] Number of frequencies at which the \f$2\mathcal{F}\f$ are to be computed.
+                          const FstatQuantities whatToCompute  ///< [in] Bit-field of which \f$\mathcal{F}\f$-statistic quantities to compute.
+                          )
 {
   // Check input
   XLAL_CHECK ( Fstats != NULL, XLAL_EINVAL);
@@ -841,17 +862,137 @@ XLALComputeFstat ( FstatResults **Fstats,               ///< [in/out] Address of
   }
   (*Fstats)->whatWasComputed = whatToCompute;
 
+  // Record the internal reference time used, which is required to compute a correct global signal phase
+  (*Fstats)->refTimePhase = midDoppler.refTime;
+
+  return XLAL_SUCCESS;
+
+} // XLALPrepareFstatResults()
+
+///
+/// Compute the \f$\mathcal{F}\f$-statistic over a band of frequencies.
+///
+int
+XLALComputeFstat ( FstatResults **Fstats,               ///< [in/out] Address of a pointer to a #FstatResults results structure; if \c NULL, allocate here.
+                   FstatInput *input,                   ///< [in] Input data structure created by one of the setup functions.
+                   const PulsarDopplerParams *doppler,  ///< [in] Doppler parameters, including starting frequency, at which to compute \f$2\mathcal{F}\f$
+                   const UINT4 numFreqBins,             ///< [in] Number of frequencies at which the \f$2\mathcal{F}\f$ are to be computed. Must be 1 if XLALCreateFstatInput() was passed zero \c dFreq.
+                   const FstatQuantities whatToCompute  ///< [in] Bit-field of which \f$\mathcal{F}\f$-statistic quantities to compute.
+                   )
+{
+  // Check input and initialise results structure
+  XLAL_CHECK ( XLALPrepareFstatResults ( Fstats, input, doppler, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Call the appropriate method function to compute the F-statistic
-  XLAL_CHECK ( (input->method_funcs.compute_func) ( *Fstats, common, input->method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK ( (input->method_funcs.compute_func) ( *Fstats, &input->common, input->method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   (*Fstats)->doppler = (*doppler);
-  // Record the internal reference time used, which is required to compute a correct global signal phase
-  (*Fstats)->refTimePhase = midDoppler.refTime;
 
   return XLAL_SUCCESS;
 
 } // XLALComputeFstat()
 
+// Compare Doppler parameters by sky position, reference time, and binary orbital parameters,
+// i.e. by the parameters which determine the quantities buffered by the F-statistic methods
+#define COMPARE_BY(a, b) do { if ( (a) < (b) ) return -1; if ( (a) > (b) ) return 1; } while(0)
+static int
+compare_FstatBuffered ( const PulsarDopplerParams *dx, const PulsarDopplerParams *dy )
+{
+  COMPARE_BY ( dx->Alpha, dy->Alpha );
+  COMPARE_BY ( dx->Delta, dy->Delta );
+  COMPARE_BY ( XLALGPSCmp ( &dx->refTime, &dy->refTime ), 0 );
+  COMPARE_BY ( dx->asini, dy->asini );
+  COMPARE_BY ( dx->period, dy->period );
+  COMPARE_BY ( dx->ecc, dy->ecc );
+  COMPARE_BY ( XLALGPSCmp ( &dx->tp, &dy->tp ), 0 );
+  COMPARE_BY ( dx->argp, dy->argp );
+  return 0;
+}
+
+// Sort pointers to Doppler parameters by buffered parameters, then by position in the input block
+static int
+compare_FstatBatchOrder ( const void *x, const void *y )
+{
+  const PulsarDopplerParams *dx = *( const PulsarDopplerParams *const * ) x;
+  const PulsarDopplerParams *dy = *( const PulsarDopplerParams *const * ) y;
+  COMPARE_BY ( compare_FstatBuffered ( dx, dy ), 0 );
+  COMPARE_BY ( dx, dy );
+  return 0;
+}
+#undef COMPARE_BY
+
+///
+/// Compute the \f$\mathcal{F}\f$-statistic over a band of frequencies, for a block of Doppler points.
+///
+/// This gives the same results as calling XLALComputeFstat() for each Doppler point in turn, but
+/// Doppler points are internally reordered so that points with the same sky position and binary
+/// orbital parameters are computed together, and can therefore reuse the quantities buffered by
+/// the F-statistic methods (e.g. the barycentred time series of the resampling method). Methods
+/// which support it may also compute several Doppler points at once, e.g. using batched FFTs.
+///
+/// The block of Doppler points may, for example, be generated from the points returned by
+/// XLALNextLatticeTilingPoints(), converted to physical coordinates.
+///
+int
+XLALComputeFstatBatch ( FstatResults **Fstats,                  ///< [in/out] Array of \c numDopplers pointers to #FstatResults results structures, one for each Doppler point; any \c NULL pointers are allocated here.
+                        FstatInput *input,                      ///< [in] Input data structure created by one of the setup functions.
+                        const PulsarDopplerParams *dopplers,    ///< [in] Array of \c numDopplers Doppler parameters, including starting frequency, at which to compute \f$2\mathcal{F}\f$
+                        const UINT4 numDopplers,                ///< [in] Number of Doppler points.
+                        const UINT4 numFreqBins,                ///< [in] Number of frequencies at which the \f$2\mathcal{F}\f$ are to be computed. Must be 1 if XLALCreateFstatInput() was passed zero \c dFreq.
+                        const FstatQuantities whatToCompute     ///< [in] Bit-field of which \f$\mathcal{F}\f$-statistic quantities to compute.
+                        )
+{
+  // Check input
+  XLAL_CHECK ( Fstats != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( input != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( dopplers != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( numDopplers > 0, XLAL_EINVAL );
+
+  // Check input and initialise results structure for each Doppler point
+  for ( UINT4 i = 0; i < numDopplers; ++i ) {
+    XLAL_CHECK ( XLALPrepareFstatResults ( &Fstats[i], input, &dopplers[i], numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  // Sort Doppler points by the parameters which determine buffered quantities
+  const PulsarDopplerParams **order = XLALMalloc ( numDopplers * sizeof ( order[0] ) );
+  XLAL_CHECK ( order != NULL, XLAL_ENOMEM );
+  for ( UINT4 i = 0; i < numDopplers; ++i ) {
+    order[i] = &dopplers[i];
+  }
+  qsort ( order, numDopplers, sizeof ( order[0] ), compare_FstatBatchOrder );
+
+  // Gather results structures for groups of Doppler points with the same buffered quantities,
+  // and compute the F-statistic for each group
+  FstatResults **group = XLALMalloc ( numDopplers * sizeof ( group[0] ) );
+  XLAL_CHECK ( group != NULL, XLAL_ENOMEM );
+  UINT4 i = 0;
+  while ( i < numDopplers ) {
+    UINT4 numGroup = 0;
+    do {
+      group[numGroup++] = Fstats[order[i] - dopplers];
+      ++i;
+    } while ( i < numDopplers && compare_FstatBuffered ( order[i-1], order[i] ) == 0 );
+    if ( input->method_funcs.compute_batch_func != NULL ) {
+      XLAL_CHECK ( (input->method_funcs.compute_batch_func) ( group, numGroup, &input->common, input->method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
+    } else {
+      for ( UINT4 j = 0; j < numGroup; ++j ) {
+        XLAL_CHECK ( (input->method_funcs.compute_func) ( group[j], &input->common, input->method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
+      }
+    }
+  }
+
+  // Restore Doppler parameters at the reference time in results structures
+  for ( UINT4 j = 0; j < numDopplers; ++j ) {
+    Fstats[j]->doppler = dopplers[j];
+  }
+
+  XLALFree ( group );
+  XLALFree ( order );
+
+  return XLAL_SUCCESS;
+
+} // XLALComputeFstatBatch()
+
 ///
 /// Free all memory associated with a \c FstatInput structure.
 ///
@@ -862,9 +1003,26 @@ XLALDestroyFstatInput ( FstatInput* input       ///< [in] \c FstatInput structur
   if ( input == NULL ) {
     return;
   }
+  if ( input->isWorker )
+    {
+      // Workers share 'common' data with their original input, and hold only their own method data and workspace
+      if ( input->method_data != NULL ) {
+        (input->method_funcs.worker_destroy_func) ( input->method_data );
+      }
+      if ( input->workspace_refcount != NULL ) {
+        if ( --(*input->workspace_refcount) == 0 ) {
+          if ( input->common.workspace != NULL ) {
+            (input->method_funcs.workspace_destroy_func) ( input->common.workspace );
+          }
+          XLALFree ( input->workspace_refcount );
+        }
+      }
+      XLALFree ( input );
+      return;
+    }
   if ( input->common.isTimeslice )
     {
-      XLAL_CHECK_VOID ( input->method < FMETHOD_RESAMP_GENERIC, XLAL_EINVAL,
+      XLAL_CHECK_VOID ( !XLALFstatMethodIsResamp ( input->method ), XLAL_EINVAL,
                         "Something is wrong: 'isTimeslice==TRUE' for non-LALDemod F-stat method '%s' is not supported!\n", XLALGetFstatInputMethodName(input));
       XLALDestroyFstatInputTimeslice_common ( &input->common );
       XLALDestroyFstatInputTimeslice_Demod ( input->method_data);
@@ -876,6 +1034,12 @@ XLALDestroyFstatInput ( FstatInput* input       ///< [in] \c FstatInput structur
   XLALDestroyMultiNoiseWeights ( input->common.multiNoiseWeights );
   XLALDestroyMultiDetectorStateSeries ( input->common.multiDetectorStates );
 
+  // Free method-specific data using destructor function; this is done before releasing 'common.workspace',
+  // which may hold data (e.g. the \a Resamp pool of SRC-frame timeseries) that refers to the method-specific data
+  if ( input->method_data != NULL ) {
+    (input->method_funcs.method_data_destroy_func) ( input->method_data );
+  }
+
   // Release a reference to 'common.workspace'; if there are no more outstanding references ...
   if ( --(*input->workspace_refcount) == 0 ) {
     XLALPrintInfo( "%s: workspace reference count = %i, freeing workspace\n", __func__, *input->workspace_refcount );
@@ -892,11 +1056,6 @@ XLALDestroyFstatInput ( FstatInput* input       ///< [in] \c FstatInput structur
     XLALPrintInfo( "%s: workspace reference count = %i\n", __func__, *input->workspace_refcount );
   }
 
-  if ( input->method_data != NULL ) {
-    // Free method-specific data using destructor function
-    (input->method_funcs.method_data_destroy_func) ( input->method_data );
-  }
-
   XLALFree ( input );
 
   return;
@@ -1066,20 +1225,24 @@ XLALSelectBestFstatMethod ( FstatMethodType *method )
   switch ( *method ) {
 
   case FMETHOD_DEMOD_BEST:
-  case FMETHOD_RESAMP_BEST:
+  case FMETHOD_RESAMP_BEST: {
     // If user asks for a 'best' method:
-    //   Decrement the current method, then check for the first available Fstat method. This assumes the FstatMethodType enum is ordered as follows:
-    //     FMETHOD_..._GENERIC,      (must **always** avaiable)
-    //     FMETHOD_..._OPTIMISED,    (always avaiable)
-    //     FMETHOD_..._SUPERFAST     (not always available; requires special hardware)
-    //     FMETHOD_..._BEST          (must **always** avaiable)
+    //   Select the first available Fstat method in the list of methods of the same class, ordered from fastest to slowest;
+    //   the last method in each list is FMETHOD_..._GENERIC, which must **always** be available
+    const BOOLEAN isResamp = XLALFstatMethodIsResamp ( *method );
+    const FstatMethodType *methods = isResamp ? FstatMethodsResampFastestFirst : FstatMethodsDemodFastestFirst;
+    const size_t numMethods = isResamp ? XLAL_NUM_ELEM(FstatMethodsResampFastestFirst) : XLAL_NUM_ELEM(FstatMethodsDemodFastestFirst);
     XLALPrintInfo( "%s: trying to find best available Fstat method for '%s'\n", __func__, FstatMethodNames[*method] );
-    while ( !XLALFstatMethodIsAvailable( --( *method ) ) ) {
-      XLAL_CHECK ( FMETHOD_START < *method, XLAL_EFAILED );
-      XLALPrintInfo( "%s: Fstat method '%s' is unavailable\n",  __func__, FstatMethodNames[*method] );
+    size_t i = 0;
+    while ( !XLALFstatMethodIsAvailable( methods[i] ) ) {
+      XLALPrintInfo( "%s: Fstat method '%s' is unavailable\n",  __func__, FstatMethodNames[methods[i]] );
+      ++i;
+      XLAL_CHECK ( i < numMethods, XLAL_EFAILED );
     }
+    *method = methods[i];
     XLALPrintInfo( "%s: Fstat method '%s' is available; selected as best method\n", __func__, FstatMethodNames[*method] );
     break;
+  }
 
   default:
     // If user asks for a specific method:
@@ -1090,6 +1253,15 @@ XLALSelectBestFstatMethod ( FstatMethodType *method )
   return XLAL_SUCCESS;
 }
 
+///
+/// Return true if given #FstatMethodType is a \a Resamp method, false if it is a \a Demod method
+///
+static BOOLEAN
+XLALFstatMethodIsResamp ( FstatMethodType method )
+{
+  return ( method == FMETHOD_RESAMP_GENERIC ) || ( method == FMETHOD_RESAMP_BEST );
+}
+
 ///
 /// Return true if given #FstatMethodType corresponds to a valid and *available* Fstat method, false otherwise
 ///
@@ -1126,6 +1298,24 @@ XLALFstatMethodIsAvailable ( FstatMethodType method )
     return 0;
 #endif
 
+  case FMETHOD_DEMOD_AVX2:
+    // This method is available only if compiled with AVX2 support,
+    // and AVX2 is available on the current execution machine
+#ifdef HAVE_AVX2_COMPILER
+    return LAL_HAVE_AVX2_RUNTIME();
+#else
+    return 0;
+#endif
+
+  case FMETHOD_DEMOD_AVX512:
+    // This method is available only if compiled with AVX-512 support,
+    // and AVX-512 is available on the current execution machine
+#ifdef HAVE_AVX512F_COMPILER
+    return LAL_HAVE_AVX512F_RUNTIME();
+#else
+    return 0;
+#endif
+
   default:
     return 0;
 
@@ -1199,17 +1389,13 @@ XLALGetFstatTiming ( const FstatInput* input, FstatTimingGeneric *timingGeneric,
   XLAL_CHECK ( timingGeneric != NULL, XLAL_EINVAL );
   XLAL_CHECK ( timingModel != NULL, XLAL_EINVAL );
 
-  if ( input->method >= FMETHOD_DEMOD_GENERIC && input->method <= FMETHOD_DEMOD_BEST)
-    {
-      XLAL_CHECK ( XLALGetFstatTiming_Demod ( input->method_data, timingGeneric, timingModel ) == XLAL_SUCCESS, XLAL_EFUNC );
-    }
-  else if ( input->method >= FMETHOD_RESAMP_GENERIC && input->method <= FMETHOD_RESAMP_BEST)
+  if ( XLALFstatMethodIsResamp ( input->method ) )
     {
       XLAL_CHECK ( XLALGetFstatTiming_Resamp ( input->method_data, timingGeneric, timingModel ) == XLAL_SUCCESS, XLAL_EFUNC );
     }
   else
     {
-      XLAL_ERROR ( XLAL_EINVAL, "Unsupported F-stat method '%s'\n", FstatMethodNames [ input->method ] );
+      XLAL_CHECK ( XLALGetFstatTiming_Demod ( input->method_data, timingGeneric, timingModel ) == XLAL_SUCCESS, XLAL_EFUNC );
     }
 
   timingGeneric->help = FstatTimingGenericHelp;	// set static help-string pointer (not used or set otherwise)
@@ -1263,6 +1449,9 @@ XLALAppendFstatTiming2File ( const FstatInput* input, FILE *fp, BOOLEAN printHea
 /// \note This function only returns a pointer to the time-series that are still part of the FstatInput structure, and will by managed by F-statistic API calls.
 /// Therefore do *not* free the resampled timeseries with XLALDestroyMultiCOMPLEX8TimeSeries(), only
 /// free the complete Fstat input structure with XLALDestroyFstatInputVector() at the end once its no longer needed.
+/// If the input uses a pool of SRC-frame timeseries (FstatOptionalArgs::resampSRCPoolMaxMB), the timeseries are only
+/// valid until XLALComputeFstat() is next called with another input sharing the pool; if they have been freed from the
+/// pool, they are recomputed for the last phase-evolution parameters passed to XLALComputeFstat() with this input.
 ///
 int
 XLALExtractResampledTimeseries ( MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_a, ///< [out] \c multi-detector SRC-frame timeseries, multiplied by AM function a(t).
@@ -1272,10 +1461,10 @@ XLALExtractResampledTimeseries ( MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_a
 {
   XLAL_CHECK ( input != NULL, XLAL_EINVAL );
   XLAL_CHECK ( ( multiTimeSeries_SRC_a != NULL ) && ( multiTimeSeries_SRC_b != NULL ) , XLAL_EINVAL );
-  XLAL_CHECK ( (input->method >= FMETHOD_RESAMP_GENERIC) && (input->method <= FMETHOD_RESAMP_BEST), XLAL_EINVAL,
+  XLAL_CHECK ( XLALFstatMethodIsResamp ( input->method ), XLAL_EINVAL,
                "%s() only works for resampling-Fstat methods, not with '%s'\n", __func__, XLALGetFstatInputMethodName ( input ) );
 
-  XLAL_CHECK ( XLALExtractResampledTimeseries_intern ( multiTimeSeries_SRC_a, multiTimeSeries_SRC_b, input->method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK ( XLALExtractResampledTimeseries_intern ( multiTimeSeries_SRC_a, multiTimeSeries_SRC_b, &input->common, input->method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   return XLAL_SUCCESS;
 } // XLALExtractResampledTimeseries()
@@ -1306,7 +1495,7 @@ XLALFstatInputTimeslice ( FstatInput ** slice,                ///< [out] Address
               LAL_GPS_PRINT(*minStartGPS), LAL_GPS_PRINT(*maxStartGPS) );
 
   // only supported for 'LALDemod' Fstat methods
-  XLAL_CHECK ( input->method < FMETHOD_RESAMP_GENERIC, XLAL_EINVAL, "This function is not avavible for the chosen FstatMethod '%s'!", XLALGetFstatInputMethodName ( input ) );
+  XLAL_CHECK ( !XLALFstatMethodIsResamp ( input->method ), XLAL_EINVAL, "This function is not avavible for the chosen FstatMethod '%s'!", XLALGetFstatInputMethodName ( input ) );
 
   const FstatCommon *common = &(input->common);
   UINT4 numIFOs = common->detectors.length;
@@ -1422,6 +1611,61 @@ XLALFstatInputTimeslice ( FstatInput ** slice,                ///< [out] Address
 
 } // XLALFstatInputTimeslice()
 
+///
+/// Create a 'worker' of an \c FstatInput structure, which can compute the F-statistic concurrently with the
+/// original input and with other workers of it, e.g. from different threads.
+///
+/// A worker references the (read-only) SFT data, timestamps, noise weights and detector states of the original
+/// input, and holds only the buffers which XLALComputeFstat() modifies: the buffered sky-position quantities,
+/// timing counters, and the method workspace. The workspace is shared with 'prevWorker' if given (which must use
+/// the same F-statistic method, and must not be used concurrently with the new worker), or allocated otherwise.
+///
+/// The worker must be destroyed with XLALDestroyFstatInput() before the original input.
+///
+int
+XLALFstatInputWorker ( FstatInput **worker,                  ///< [out] Address of a pointer to a \c FstatInput structure
+                       const FstatInput *input,              ///< [in] Input data structure
+                       const FstatInput *prevWorker          ///< [in] Worker whose workspace to share, or NULL
+                       )
+{
+  XLAL_CHECK ( input != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( worker != NULL && (*worker) == NULL, XLAL_EINVAL );
+  XLAL_CHECK ( !input->common.isTimeslice && !input->isWorker, XLAL_EINVAL, "Cannot create a worker of a timeslice or of another worker" );
+  XLAL_CHECK ( input->method_funcs.worker_func != NULL, XLAL_EINVAL, "Workers are not supported for the chosen FstatMethod '%s'!", XLALGetFstatInputMethodName ( input ) );
+  XLAL_CHECK ( prevWorker == NULL || prevWorker->method == input->method, XLAL_EINVAL, "Cannot use workspace from 'prevWorker' with different FstatMethod '%d'!='%d'", prevWorker->method, input->method );
+
+  // allocate memory and copy the orginal FstatInput struct
+  FstatInput *w = NULL;
+  XLAL_CHECK ( ( w = XLALCalloc ( 1, sizeof(*w) ) ) != NULL, XLAL_ENOMEM );
+  memcpy ( w, input, sizeof ( *input ) );
+  w->isWorker = (1==1); // This is a worker
+  w->method_data = NULL;
+
+  // Share workspace with 'prevWorker', or let the method worker function allocate one
+  if ( prevWorker != NULL ) {
+    w->common.workspace = prevWorker->common.workspace;
+    w->workspace_refcount = prevWorker->workspace_refcount;
+    ++(*w->workspace_refcount);
+  } else {
+    w->common.workspace = NULL;
+    if ( ( w->workspace_refcount = XLALCalloc ( 1, sizeof(*w->workspace_refcount) ) ) == NULL ) {
+      XLALFree ( w );
+      XLAL_ERROR ( XLAL_ENOMEM );
+    }
+    (*w->workspace_refcount) = 1;
+  }
+
+  // Create method data of worker
+  if ( (input->method_funcs.worker_func) ( &w->method_data, &w->common, input->method_data ) != XLAL_SUCCESS ) {
+    XLALDestroyFstatInput ( w );
+    XLAL_ERROR ( XLAL_EFUNC );
+  }
+
+  (*worker) = w;
+  return XLAL_SUCCESS;
+
+} // XLALFstatInputWorker()
+
 
 void
 XLALDestroyFstatInputTimeslice_common ( FstatCommon *common )
@@ -121,6 +121,10 @@ typedef enum tagFstatMethodType {
   FMETHOD_RESAMP_GENERIC,	///< \a Resamp: generic implementation
   FMETHOD_RESAMP_BEST,		///< \a Resamp: best guess of the fastest available implementation
 
+  // methods added later are appended here, so that the values of existing methods do not change
+  FMETHOD_DEMOD_AVX2,		///< \a Demod: AVX2 hotloop, sums 4 frequency bins per vector, works for any number of Dirichlet kernel terms \f$\text{Dterms}\f$
+  FMETHOD_DEMOD_AVX512,		///< \a Demod: AVX-512 hotloop, sums 8 frequency bins per vector, works for any number of Dirichlet kernel terms \f$\text{Dterms}\f$
+
   /// \cond DONT_DOXYGEN
   FMETHOD_END
   /// \endcond
@@ -144,6 +148,9 @@ typedef struct tagFstatOptionalArgs {
   BOOLEAN collectTiming;		///< a flag to turn on/off the collection of F-stat-method-specific timing-data
   BOOLEAN resampFFTPowerOf2;		///< \a Resamp: round up FFT lengths to next power of 2; see #FstatMethodType.
   REAL8 allowedMismatchFromSFTLength;      ///<  Optional override for XLALFstatCheckSFTLengthMismatch().
+  REAL8 resampSRCPoolMaxMB;		///< \a Resamp: if >0, allocate the SRC-frame timeseries of all inputs sharing a workspace via \c prevInput on demand from a pool limited to this many MB;
+					///< the least-recently used timeseries are freed when the pool is full, and recomputed when next needed.
+  UINT4 runningMedianThreads;		///< Number of threads used to normalize the SFTs by their running median (0 = OpenMP default); see XLALNormalizeMultiSFTVectParallel().
 } FstatOptionalArgs;
 
 ///
@@ -352,12 +359,17 @@ int  XLALExtractResampledTimeseries ( MultiCOMPLEX8TimeSeries **multiTimeSeries_
 int XLALGetFstatTiming ( const FstatInput* input, FstatTimingGeneric *timingGeneric, FstatTimingModel *timingModel );
 int XLALAppendFstatTiming2File ( const FstatInput* input, FILE *fp, BOOLEAN printHeader );
 int XLALFstatInputTimeslice ( FstatInput** slice, const FstatInput* input, const LIGOTimeGPS *minStartGPS, const LIGOTimeGPS *maxStartGPS);
+int XLALFstatInputWorker ( FstatInput **worker, const FstatInput *input, const FstatInput *prevWorker );
 
 #ifdef SWIG // SWIG interface directives
 SWIGLAL(INOUT_STRUCTS(FstatResults**, Fstats));
 #endif
 int XLALComputeFstat ( FstatResults **Fstats, FstatInput *input, const PulsarDopplerParams *doppler,
                        const UINT4 numFreqBins, const FstatQuantities whatToCompute );
+#ifndef SWIG // exclude from SWIG interface
+int XLALComputeFstatBatch ( FstatResults **Fstats, FstatInput *input, const PulsarDopplerParams *dopplers, const UINT4 numDopplers,
+                            const UINT4 numFreqBins, const FstatQuantities whatToCompute );
+#endif // SWIG
 
 void XLALDestroyFstatInput ( FstatInput* input );
 void XLALDestroyFstatResults ( FstatResults* Fstats );
@@ -104,6 +104,16 @@ int XLALComputeFaFb_SSE     ( COMPLEX8 *Fa, COMPLEX8 *Fb, FstatAtomVector **Fsta
                               const PulsarSpins fkdot, const SSBtimes *tSSB, const AMCoeffs *amcoe, const UINT4 Dterms );
 #endif
 
+#ifdef HAVE_AVX2_COMPILER
+int XLALComputeFaFb_AVX2    ( COMPLEX8 *Fa, COMPLEX8 *Fb, FstatAtomVector **FstatAtoms, const SFTVector *sfts,
+                              const PulsarSpins fkdot, const SSBtimes *tSSB, const AMCoeffs *amcoe, const UINT4 Dterms );
+#endif
+
+#ifdef HAVE_AVX512F_COMPILER
+int XLALComputeFaFb_AVX512  ( COMPLEX8 *Fa, COMPLEX8 *Fb, FstatAtomVector **FstatAtoms, const SFTVector *sfts,
+                              const PulsarSpins fkdot, const SSBtimes *tSSB, const AMCoeffs *amcoe, const UINT4 Dterms );
+#endif
+
 // ----- local function definitions ----------
 static int
 XLALComputeFstatDemod ( FstatResults* Fstats,
@@ -367,6 +377,56 @@ XLALDestroyDemodMethodData ( void* method_data )
 
 } // XLALDestroyDemodMethodData()
 
+static int
+XLALFstatInputWorker_Demod ( void **method_data,
+                             FstatCommon *common,
+                             const void *input_method_data
+                           )
+{
+  // Check input
+  XLAL_CHECK ( method_data != NULL && (*method_data) == NULL, XLAL_EFAULT );
+  XLAL_CHECK ( common != NULL, XLAL_EFAULT );
+  XLAL_CHECK ( input_method_data != NULL, XLAL_EFAULT );
+
+  const DemodMethodData *demod_input = (const DemodMethodData *) input_method_data;
+
+  // allocate memory and copy the input method_data struct; SFTs are shared with the input
+  DemodMethodData *demod = *method_data = XLALCalloc ( 1, sizeof(*demod) );
+  XLAL_CHECK ( demod != NULL, XLAL_ENOMEM );
+  memcpy ( demod, demod_input, sizeof(*demod) );
+
+  // empty all buffering quantities
+  demod->prevAlpha = 0;
+  demod->prevDelta = 0;
+  XLAL_INIT_MEM(demod->prevRefTime);
+  demod->prevMultiSSBtimes = NULL;
+  demod->prevMultiAMcoef = NULL;
+
+  // reset timing counters, keeping invariant 'meta' quantities about this setup
+  XLAL_INIT_MEM(demod->timingGeneric);
+  XLAL_INIT_MEM(demod->timingDemod);
+  demod->timingGeneric.Ndet = demod_input->timingGeneric.Ndet;
+  demod->timingDemod.Nsft = demod_input->timingDemod.Nsft;
+
+  // initialize sin/cos lookup table here, so that workers do not race to do so
+  XLALSinCosLUTInit();
+
+  return XLAL_SUCCESS;
+
+} // XLALFstatInputWorker_Demod()
+
+static void
+XLALDestroyFstatInputWorker_Demod ( void *method_data )
+{
+
+  DemodMethodData *demod = (DemodMethodData*) method_data;
+
+  XLALDestroyMultiSSBtimes  ( demod->prevMultiSSBtimes );
+  XLALDestroyMultiAMCoeffs  ( demod->prevMultiAMcoef );
+  XLALFree ( demod );
+
+} // XLALDestroyFstatInputWorker_Demod()
+
 int
 XLALSetupFstatDemod ( void **method_data,
                       FstatCommon *common,
@@ -390,6 +450,8 @@ XLALSetupFstatDemod ( void **method_data,
   funcs->compute_func = XLALComputeFstatDemod;
   funcs->method_data_destroy_func = XLALDestroyDemodMethodData;
   funcs->workspace_destroy_func = NULL;
+  funcs->worker_func = XLALFstatInputWorker_Demod;
+  funcs->worker_destroy_func = XLALDestroyFstatInputWorker_Demod;
 
   // Save pointer to SFTs
   demod->multiSFTs = multiSFTs;
@@ -431,6 +493,16 @@ XLALSetupFstatDemod ( void **method_data,
   case FMETHOD_DEMOD_SSE:
     demod->computefafb_func = XLALComputeFaFb_SSE;
     break;
+#endif
+#ifdef HAVE_AVX2_COMPILER
+  case FMETHOD_DEMOD_AVX2:
+    demod->computefafb_func = XLALComputeFaFb_AVX2;
+    break;
+#endif
+#ifdef HAVE_AVX512F_COMPILER
+  case FMETHOD_DEMOD_AVX512:
+    demod->computefafb_func = XLALComputeFaFb_AVX512;
+    break;
 #endif
   default:
     XLAL_ERROR ( XLAL_EINVAL, "Invalid Demod hotloop optArgs->FstatMethod='%d'", optArgs->FstatMethod );
@@ -0,0 +1,69 @@
+//
+// Copyright (C) 2026
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+// MA  02111-1307  USA
+//
+
+/// [hotloop]
+{
+  /* AVX2 version of the generic hotloop: as the numerators s_alpha and
+   * c_alpha are the same for all bins, sum X_alpha_k / x_k separately for
+   * the real and imaginary parts, 4 bins (8 interleaved floats) at a time,
+   * and multiply by s_alpha and c_alpha at the end. The divisors x_k are
+   * computed in double precision, as in the generic hotloop, since x_k is
+   * close to zero for the bins either side of kappa_star.
+   */
+  REAL4 s_alpha, c_alpha;   /* sin(2pi kappa_alpha) and (cos(2pi kappa_alpha)-1) */
+  XLALSinCos2PiLUTtrimmed ( &s_alpha, &c_alpha, kappa_star);
+  c_alpha -= 1.0f;
+
+  const REAL8 kappa_max = kappa_star + 1.0f * Dterms - 1.0f;
+  const REAL4 *Xa = (const REAL4 *) Xalpha_l;
+  const UINT4 numBins = 2 * Dterms;
+
+  __m256d x0 = _mm256_sub_pd ( _mm256_set1_pd ( kappa_max ), _mm256_setr_pd ( 0.0, 1.0, 2.0, 3.0 ) );
+  const __m256d four = _mm256_set1_pd ( 4.0 );
+  __m256 XPsum = _mm256_setzero_ps();
+  UINT4 l = 0;
+  for ( ; l + 4 <= numBins; l += 4 )
+    {
+      /* divisors {x0, x0, x1, x1, x2, x2, x3, x3} for interleaved {re, im} */
+      const __m128 x = _mm256_cvtpd_ps ( x0 );
+      const __m256 xx = _mm256_insertf128_ps ( _mm256_castps128_ps256 ( _mm_unpacklo_ps ( x, x ) ), _mm_unpackhi_ps ( x, x ), 1 );
+      XPsum = _mm256_add_ps ( XPsum, _mm256_div_ps ( _mm256_loadu_ps ( Xa + 2*l ), xx ) );
+      x0 = _mm256_sub_pd ( x0, four );
+    }
+
+  REAL4 XPsums[8] __attribute__ ((aligned (32)));
+  _mm256_store_ps ( XPsums, XPsum );
+  REAL4 realXPsum = ( XPsums[0] + XPsums[2] ) + ( XPsums[4] + XPsums[6] );
+  REAL4 imagXPsum = ( XPsums[1] + XPsums[3] ) + ( XPsums[5] + XPsums[7] );
+
+  /* remaining bins, if 2*Dterms is not a multiple of 4 */
+  for ( ; l < numBins; l ++ )
+    {
+      const REAL4 xinv = 1.0 / ( kappa_max - l );
+      realXPsum += Xa[2*l] * xinv;
+      imagXPsum += Xa[2*l + 1] * xinv;
+    }
+
+  realXP = s_alpha * realXPsum - c_alpha * imagXPsum;
+  imagXP = c_alpha * realXPsum + s_alpha * imagXPsum;
+
+  /* real- and imaginary part of e^{i 2 pi lambda_alpha } */
+  XLALSinCos2PiLUT ( &imagQ, &realQ, lambda_alpha );
+}
+/// [hotloop]
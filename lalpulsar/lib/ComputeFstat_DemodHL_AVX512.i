@@ -0,0 +1,70 @@
+//
+// Copyright (C) 2026
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+// MA  02111-1307  USA
+//
+
+/// [hotloop]
+{
+  /* AVX-512 version of the AVX2 hotloop, summing X_alpha_k / x_k over
+   * 8 bins (16 interleaved floats) at a time; for Dterms=8 the whole
+   * sum is computed in 2 iterations.
+   */
+  REAL4 s_alpha, c_alpha;   /* sin(2pi kappa_alpha) and (cos(2pi kappa_alpha)-1) */
+  XLALSinCos2PiLUTtrimmed ( &s_alpha, &c_alpha, kappa_star);
+  c_alpha -= 1.0f;
+
+  const REAL8 kappa_max = kappa_star + 1.0f * Dterms - 1.0f;
+  const REAL4 *Xa = (const REAL4 *) Xalpha_l;
+  const UINT4 numBins = 2 * Dterms;
+
+  __m512d x0 = _mm512_sub_pd ( _mm512_set1_pd ( kappa_max ), _mm512_setr_pd ( 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0 ) );
+  const __m512d eight = _mm512_set1_pd ( 8.0 );
+  const __m512i dup = _mm512_setr_epi32 ( 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7 );
+  __m512 XPsum = _mm512_setzero_ps();
+  UINT4 l = 0;
+  for ( ; l + 8 <= numBins; l += 8 )
+    {
+      /* divisors {x0, x0, x1, x1, ..., x7, x7} for interleaved {re, im} */
+      const __m512 xx = _mm512_permutexvar_ps ( dup, _mm512_castps256_ps512 ( _mm512_cvtpd_ps ( x0 ) ) );
+      XPsum = _mm512_add_ps ( XPsum, _mm512_div_ps ( _mm512_loadu_ps ( Xa + 2*l ), xx ) );
+      x0 = _mm512_sub_pd ( x0, eight );
+    }
+
+  REAL4 XPsums[16] __attribute__ ((aligned (64)));
+  _mm512_store_ps ( XPsums, XPsum );
+  REAL4 realXPsum = 0, imagXPsum = 0;
+  for ( UINT4 i = 0; i < 16; i += 2 )
+    {
+      realXPsum += XPsums[i];
+      imagXPsum += XPsums[i + 1];
+    }
+
+  /* remaining bins, if 2*Dterms is not a multiple of 8 */
+  for ( ; l < numBins; l ++ )
+    {
+      const REAL4 xinv = 1.0 / ( kappa_max - l );
+      realXPsum += Xa[2*l] * xinv;
+      imagXPsum += Xa[2*l + 1] * xinv;
+    }
+
+  realXP = s_alpha * realXPsum - c_alpha * imagXPsum;
+  imagXP = c_alpha * realXPsum + s_alpha * imagXPsum;
+
+  /* real- and imaginary part of e^{i 2 pi lambda_alpha } */
+  XLALSinCos2PiLUT ( &imagQ, &realQ, lambda_alpha );
+}
+/// [hotloop]
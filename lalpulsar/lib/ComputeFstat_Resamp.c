@@ -29,11 +29,15 @@
 
 #include <lal/FFTWMutex.h>
 #include <lal/Factorial.h>
+#include <lal/LALSIMD.h>
 #include <lal/LFTandTSutils.h>
 #include <lal/LogPrintf.h>
 #include <lal/SinCosLUT.h>
+#include <lal/Sequence.h>
 #include <lal/TimeSeries.h>
 #include <lal/Units.h>
+#include <lal/VectorMath.h>
+#include <lal/Window.h>
 
 ///
 /// \defgroup ComputeFstat_Resamp_c Module ComputeFstat_Resamp.c
@@ -50,6 +54,12 @@
 #define MYMAX(x,y) ( (x) > (y) ? (x) : (y) )
 #define MYMIN(x,y) ( (x) < (y) ? (x) : (y) )
 
+#ifdef __GNUC__
+#define UNUSED __attribute__ ((unused))
+#else
+#define UNUSED
+#endif
+
 // local macro versions of library functions to avoid calling external functions in GPU-ready code
 #define GPSDIFF(x,y) (1.0*((x).gpsSeconds - (y).gpsSeconds) + ((x).gpsNanoSeconds - (y).gpsNanoSeconds)*1e-9)
 #define GPSGETREAL8(x) ( (x)->gpsSeconds + ( (x)->gpsNanoSeconds / XLAL_BILLION_REAL8 ) );
@@ -65,6 +75,9 @@
 
 // ----- local constants
 
+// number of templates whose {Fa,Fb} are Fourier-transformed together by XLALComputeFstatResampBatch()
+#define RESAMP_FFT_BATCH 4
+
 // ----- local types ----------
 
 // ---------- BEGIN: Resamp-specific timing model data ----------
@@ -79,6 +92,9 @@ typedef struct tagTimings_t
   REAL4 Fab2F;		// time to compute Fstat from {Fa,Fb}
   REAL4 Mem;		// time to realloc and Memset-0 arrays
   REAL4 SumFabX;	// time to sum_X Fab^X
+  REAL4 Sinc;		// time spent in windowed-sinc interpolation kernel (part of Bary)
+  REAL4 SinCos;		// time spent computing sin/cos of spindown phase (part of Spin)
+  REAL4 Rotate;		// time spent in spindown phase-rotation kernel (part of Spin)
   BOOLEAN BufferRecomputed; // did we need to recompute the buffer this time?
 } Timings_t;
 
@@ -93,6 +109,9 @@ typedef struct tagFstatTimingResamp
   REAL4 tau0_spin;      // timing coefficient for spindown-correction
   REAL4 tau0_FFT;       // timing coefficient for FFT-time
   REAL4 tau0_bary;      // timing coefficient for barycentering
+  REAL4 tau0_sinc;      // timing coefficient for windowed-sinc interpolation kernel (part of tau0_bary)
+  REAL4 tau0_sincos;    // timing coefficient for sin/cos of spindown phase (part of tau0_spin)
+  REAL4 tau0_rotate;    // timing coefficient for spindown phase-rotation kernel (part of tau0_spin)
 
   Timings_t Tau;
 
@@ -108,6 +127,9 @@ static const char FstatTimingResampHelp[] =
   "%%%% tau0_spin:      timing coefficient for spindown-correction\n"
   "%%%% tau0_FFT:       timing coefficient for FFT-time\n"
   "%%%% tau0_bary:      timing coefficient for barycentering\n"
+  "%%%% tau0_sinc:      timing coefficient for windowed-sinc interpolation kernel (part of tau0_bary)\n"
+  "%%%% tau0_sincos:    timing coefficient for sin/cos of spindown phase (part of tau0_spin)\n"
+  "%%%% tau0_rotate:    timing coefficient for spindown phase-rotation kernel (part of tau0_spin)\n"
   "%%%%\n"
   "%%%% Resampling F-statistic timing model:\n"
   "%%%% tauF_core       = tau0_Fbin + (NsampFFT/NFbin) * ( R * tau0_spin + 5 * log2(NsampFFT) * tau0_FFT )\n"
@@ -117,6 +139,8 @@ static const char FstatTimingResampHelp[] =
 // ---------- END: Resamp-specific timing model data ----------
 
 
+struct tagResampMethodData;
+
 // ----- workspace ----------
 typedef struct tagResampWorkspace
 {
@@ -124,6 +148,9 @@ typedef struct tagResampWorkspace
   COMPLEX8Vector *TStmp1_SRC;	// can hold a single-detector SRC-frame spindown-corrected timeseries [without zero-padding]
   COMPLEX8Vector *TStmp2_SRC;	// can hold a single-detector SRC-frame spindown-corrected timeseries [without zero-padding]
   REAL8Vector *SRCtimes_DET;	// holds uniformly-spaced SRC-frame timesteps translated into detector frame [for interpolation]
+  REAL4Vector *SpinPhase_SRC;	// holds the spindown phase (in cycles, modulo 1) of a single-detector SRC-frame timeseries
+  REAL4Vector *SpinSin_SRC;	// holds sin(2 pi phase) of the spindown phase
+  REAL4Vector *SpinCos_SRC;	// holds cos(2 pi phase) of the spindown phase
 
   // input padded timeseries ts(t) and output Fab(f) of length 'numSamplesFFT' and corresponding fftw plan
   UINT4 numSamplesFFTAlloc;	// allocated number of zero-padded SRC-frame time samples (related to dFreq)
@@ -137,11 +164,35 @@ typedef struct tagResampWorkspace
   COMPLEX8 *Fb_k;		// properly normalized F_b(f_k) over output bins
   UINT4 numFreqBinsAlloc;	// internal: keep track of allocated length of frequency-arrays
 
+  // batched FFTs, allocated on first call to XLALComputeFstatResampBatch()
+  UINT4 numSamplesFFTBatchAlloc;	// allocated number of zero-padded SRC-frame time samples per transform in the batch arrays
+  UINT4 numSamplesFFTBatchPlan;	// number of zero-padded SRC-frame time samples per transform of 'fftplan_batch'
+  COMPLEX8 *TS_FFT_batch;	// zero-padded, spindown-corr SRC-frame TS for a batch of templates
+  COMPLEX8 *FabX_Raw_batch;	// raw full-band FFT results Fa,Fb for a batch of templates
+  fftwf_plan fftplan_batch;	// FFT plan for the 2*RESAMP_FFT_BATCH transforms of {Fa,Fb} for a batch of templates
+  COMPLEX8 *Fab_k_batch;	// {FaX,FbX,Fa,Fb}(f_k) over output bins for a batch of templates
+  UINT4 numFreqBinsBatchAlloc;	// allocated number of output frequency bins in 'Fab_k_batch'
+
+  // pool of SRC-frame timeseries, shared by all inputs using this workspace with FstatOptionalArgs::resampSRCPoolMaxMB > 0
+  REAL8 SRCPoolMaxBytes;				// maximal memory of resident SRC-frame timeseries (may be exceeded by the timeseries of a single input)
+  REAL8 SRCPoolBytes;					// current memory of resident SRC-frame timeseries
+  REAL8 SRCPoolPeakBytes;				// peak memory of resident SRC-frame timeseries
+  UINT4 SRCPoolEvictions;				// number of times the SRC-frame timeseries of an input were freed to make room for another
+  struct tagResampMethodData *SRCPoolHead;		// input with most-recently used resident SRC-frame timeseries
+  struct tagResampMethodData *SRCPoolTail;		// input with least-recently used resident SRC-frame timeseries
+
 } ResampWorkspace;
 
-typedef struct
+// ----- SIMD kernels ----------
+typedef int (*ResampSincFunc) ( COMPLEX8Vector *, const REAL8Vector *, const COMPLEX8TimeSeries *, const REAL4 *, const UINT4 );
+typedef int (*ResampRotateFunc) ( COMPLEX8 *, const COMPLEX8 *, const REAL4 *, const REAL4 *, const UINT4 );
+
+typedef struct tagResampMethodData
 {
   UINT4 Dterms;						// Number of terms to use (on either side) in Windowed-Sinc interpolation kernel
+  REAL4 *sincWinDup;					// Hamming window of length 2*Dterms+1 for the windowed-sinc kernel, with alternating signs and each value repeated twice
+  ResampSincFunc sinc_func;				// windowed-sinc interpolation kernel
+  ResampRotateFunc rotate_func;				// spindown phase-rotation kernel
   MultiCOMPLEX8TimeSeries  *multiTimeSeries_DET;	// input SFTs converted into a heterodyned timeseries
   // ----- buffering -----
   PulsarDopplerParams prev_doppler;			// buffering: previous phase-evolution ("doppler") parameters
@@ -155,6 +206,14 @@ typedef struct
   MultiCOMPLEX8TimeSeries *multiTimeSeries_SRC_a;	// multi-detector SRC-frame timeseries, multiplied by AM function a(t)
   MultiCOMPLEX8TimeSeries *multiTimeSeries_SRC_b;	// multi-detector SRC-frame timeseries, multiplied by AM function b(t)
 
+  // ----- pooled SRC-frame timeseries -----
+  ResampWorkspace *SRCPool;				// workspace holding the pool of SRC-frame timeseries, or NULL if timeseries are allocated once at setup
+  BOOLEAN SRCResident;					// whether SRC-frame timeseries are currently allocated in the pool
+  struct tagResampMethodData *SRCPoolPrev;		// neighbour in the pool's least-recently-used list: more recently used
+  struct tagResampMethodData *SRCPoolNext;		// neighbour in the pool's least-recently-used list: less recently used
+  UINT4 numSamples_SRC[PULSAR_MAX_DETECTORS];		// number of samples in the SRC-frame timeseries of each detector
+  REAL8 SRCBytes;					// memory of the SRC-frame timeseries {a,b} of all detectors
+
   UINT4 numSamplesFFT;					// length of zero-padded SRC-frame timeseries (related to dFreq)
   UINT4 decimateFFT;					// output every n-th frequency bin, with n>1 iff (dFreq > 1/Tspan), and was internally decreased by n
   fftwf_plan fftplan;					// FFT plan
@@ -177,13 +236,48 @@ XLALComputeFstatResamp ( FstatResults* Fstats,
                          void *method_data
                        );
 
+static int
+XLALComputeFstatResampBatch ( FstatResults **Fstats,
+                              const UINT4 numTemplates,
+                              const FstatCommon *common,
+                              void *method_data
+                              );
+
 static int
 XLALApplySpindownAndFreqShift ( COMPLEX8 *xOut,
                                 const COMPLEX8TimeSeries *xIn,
                                 const PulsarDopplerParams *doppler,
-                                REAL8 freqShift
+                                REAL8 freqShift,
+                                ResampMethodData *resamp,
+                                ResampWorkspace *ws
                                 );
 
+static int
+XLALSincInterpolateCOMPLEX8_GEN ( COMPLEX8Vector *y_out,
+                                  const REAL8Vector *t_out,
+                                  const COMPLEX8TimeSeries *ts_in,
+                                  const REAL4 *winDup,
+                                  const UINT4 Dterms
+                                  );
+
+static int
+XLALRotateCOMPLEX8_GEN ( COMPLEX8 *xOut,
+                         const COMPLEX8 *xIn,
+                         const REAL4 *sinphase,
+                         const REAL4 *cosphase,
+                         const UINT4 len
+                         );
+
+#ifdef HAVE_SSE2_COMPILER
+int XLALSincInterpolateCOMPLEX8_SSE2 ( COMPLEX8Vector *y_out, const REAL8Vector *t_out, const COMPLEX8TimeSeries *ts_in, const REAL4 *winDup, const UINT4 Dterms );
+int XLALRotateCOMPLEX8_SSE2 ( COMPLEX8 *xOut, const COMPLEX8 *xIn, const REAL4 *sinphase, const REAL4 *cosphase, const UINT4 len );
+#endif
+
+#ifdef HAVE_AVX2_COMPILER
+int XLALSincInterpolateCOMPLEX8_AVX2 ( COMPLEX8Vector *y_out, const REAL8Vector *t_out, const COMPLEX8TimeSeries *ts_in, const REAL4 *winDup, const UINT4 Dterms );
+int XLALRotateCOMPLEX8_AVX2 ( COMPLEX8 *xOut, const COMPLEX8 *xIn, const REAL4 *sinphase, const REAL4 *cosphase, const UINT4 len );
+#endif
+
 static int
 XLALBarycentricResampleMultiCOMPLEX8TimeSeries ( ResampMethodData *resamp,
                                                  const PulsarDopplerParams *thisPoint,
@@ -205,6 +299,34 @@ XLALGetFFTPlanHints ( int * planMode,
                       double * planGenTimeoutSeconds
                       );
 
+static int
+XLALAcquireResampSRCPool ( ResampMethodData *resamp,
+                           BOOLEAN *reallocated
+                           );
+
+static void
+XLALReleaseResampSRCPool ( ResampMethodData *resamp );
+
+static int
+XLALFstatInputWorker_Resamp ( void **method_data,
+                              FstatCommon *common,
+                              const void *input_method_data
+                            );
+
+static void
+XLALDestroyFstatInputWorker_Resamp ( void *method_data );
+
+static int
+XLALPrepareResampWorkspace ( ResampWorkspace **workspace,
+                             const UINT4 numSamplesFFT,
+                             const UINT4 numSamplesMax_SRC
+                             );
+
+static int
+XLALPlanResampFFT ( ResampMethodData *resamp,
+                    const ResampWorkspace *ws
+                    );
+
 // ==================== function definitions ====================
 
 static void
@@ -212,9 +334,17 @@ XLALDestroyResampWorkspace ( void *workspace )
 {
   ResampWorkspace *ws = (ResampWorkspace*) workspace;
 
+  if ( ws->SRCPoolMaxBytes > 0 ) {
+    XLALPrintInfo ( "%s: pool of SRC-frame timeseries: limit %.1f MB, peak %.1f MB, %u evictions\n", __func__,
+                    ws->SRCPoolMaxBytes / 1048576.0, ws->SRCPoolPeakBytes / 1048576.0, ws->SRCPoolEvictions );
+  }
+
   XLALDestroyCOMPLEX8Vector ( ws->TStmp1_SRC );
   XLALDestroyCOMPLEX8Vector ( ws->TStmp2_SRC );
   XLALDestroyREAL8Vector ( ws->SRCtimes_DET );
+  XLALDestroyREAL4Vector ( ws->SpinPhase_SRC );
+  XLALDestroyREAL4Vector ( ws->SpinSin_SRC );
+  XLALDestroyREAL4Vector ( ws->SpinCos_SRC );
 
   fftw_free ( ws->FabX_Raw );
   fftw_free ( ws->TS_FFT );
@@ -224,6 +354,15 @@ XLALDestroyResampWorkspace ( void *workspace )
   XLALFree ( ws->Fa_k );
   XLALFree ( ws->Fb_k );
 
+  if ( ws->fftplan_batch != NULL ) {
+    LAL_FFTW_WISDOM_LOCK;
+    fftwf_destroy_plan ( ws->fftplan_batch );
+    LAL_FFTW_WISDOM_UNLOCK;
+  }
+  fftw_free ( ws->TS_FFT_batch );
+  fftw_free ( ws->FabX_Raw_batch );
+  XLALFree ( ws->Fab_k_batch );
+
   XLALFree ( ws );
   return;
 
@@ -239,6 +378,7 @@ XLALDestroyResampMethodData ( void* method_data )
   XLALDestroyMultiCOMPLEX8TimeSeries (resamp->multiTimeSeries_DET );
 
   // ----- free buffer
+  XLALReleaseResampSRCPool ( resamp );
   XLALDestroyMultiCOMPLEX8TimeSeries ( resamp->multiTimeSeries_SRC_a );
   XLALDestroyMultiCOMPLEX8TimeSeries ( resamp->multiTimeSeries_SRC_b );
   XLALDestroyMultiAMCoeffs ( resamp->multiAMcoef );
@@ -246,9 +386,13 @@ XLALDestroyResampMethodData ( void* method_data )
   XLALDestroyMultiSSBtimes ( resamp->multiBinaryTimes );
 
   LAL_FFTW_WISDOM_LOCK;
-  fftwf_destroy_plan ( resamp->fftplan );
+  if ( resamp->fftplan != NULL ) {
+    fftwf_destroy_plan ( resamp->fftplan );
+  }
   LAL_FFTW_WISDOM_UNLOCK;
 
+  XLALFree ( resamp->sincWinDup );
+
   XLALFree ( resamp );
 
 } // XLALDestroyResampMethodData()
@@ -274,10 +418,46 @@ XLALSetupFstatResamp ( void **method_data,
 
   resamp->Dterms = optArgs->Dterms;
 
+  // Precompute window for the windowed-sinc interpolation kernel
+  {
+    const UINT4 winLen = 2 * resamp->Dterms + 1;
+    REAL8Window *win = XLALCreateHammingREAL8Window ( winLen );
+    XLAL_CHECK ( win != NULL, XLAL_EFUNC );
+    XLAL_CHECK ( (resamp->sincWinDup = XLALMalloc ( 2 * winLen * sizeof(REAL4) )) != NULL, XLAL_ENOMEM );
+    for ( UINT4 i = 0; i < winLen; i ++ )
+      {
+        resamp->sincWinDup[2*i] = resamp->sincWinDup[2*i + 1] = ( i % 2 == 0 ) ? win->data->data[i] : -win->data->data[i];
+      }
+    XLALDestroyREAL8Window ( win );
+  }
+
+  // Select the fastest available SIMD kernels for sinc interpolation and phase rotation
+  const char *kernelISet = "GEN";
+  resamp->sinc_func = XLALSincInterpolateCOMPLEX8_GEN;
+  resamp->rotate_func = XLALRotateCOMPLEX8_GEN;
+#ifdef HAVE_SSE2_COMPILER
+  if ( LAL_HAVE_SSE2_RUNTIME() ) {
+    kernelISet = "SSE2";
+    resamp->sinc_func = XLALSincInterpolateCOMPLEX8_SSE2;
+    resamp->rotate_func = XLALRotateCOMPLEX8_SSE2;
+  }
+#endif
+#ifdef HAVE_AVX2_COMPILER
+  if ( LAL_HAVE_AVX2_RUNTIME() ) {
+    kernelISet = "AVX2";
+    resamp->sinc_func = XLALSincInterpolateCOMPLEX8_AVX2;
+    resamp->rotate_func = XLALRotateCOMPLEX8_AVX2;
+  }
+#endif
+  XLALPrintInfo ( "%s: using %s kernels for sinc interpolation and phase rotation\n", __func__, kernelISet );
+
   // Set method function pointers
   funcs->compute_func = XLALComputeFstatResamp;
+  funcs->compute_batch_func = XLALComputeFstatResampBatch;
   funcs->method_data_destroy_func = XLALDestroyResampMethodData;
   funcs->workspace_destroy_func = XLALDestroyResampWorkspace;
+  funcs->worker_func = XLALFstatInputWorker_Resamp;
+  funcs->worker_destroy_func = XLALDestroyFstatInputWorker_Resamp;
 
   // Extra band needed for resampling: Hamming-windowed sinc used for interpolation has a transition bandwith of
   // TB=(4/L)*fSamp, where L=2*Dterms+1 is the window-length, and here fSamp=Band (i.e. the full SFT frequency band)
@@ -331,6 +511,9 @@ XLALSetupFstatResamp ( void **method_data,
   resamp->numSamplesFFT = numSamplesFFT;
   // ----- allocate buffer Memory ----------
 
+  // if SRC-frame timeseries are pooled, their data are allocated on demand by XLALAcquireResampSRCPool()
+  const BOOLEAN useSRCPool = ( optArgs->resampSRCPoolMaxMB > 0 );
+
   // header for SRC-frame resampled timeseries buffer
   XLAL_CHECK ( (resamp->multiTimeSeries_SRC_a = XLALCalloc ( 1, sizeof(MultiCOMPLEX8TimeSeries)) ) != NULL, XLAL_ENOMEM );
   XLAL_CHECK ( (resamp->multiTimeSeries_SRC_a->data = XLALCalloc ( numDetectors, sizeof(COMPLEX8TimeSeries) )) != NULL, XLAL_ENOMEM );
@@ -359,8 +542,17 @@ XLALSetupFstatResamp ( void **method_data,
       UINT4 numSamples_DETX = resamp->multiTimeSeries_DET->data[X]->data->length;
       UINT4 numSamples_SRCX = (UINT4)ceil ( numSamples_DETX * dt_DET / dt_SRC );
 
-      XLAL_CHECK ( (resamp->multiTimeSeries_SRC_a->data[X] = XLALCreateCOMPLEX8TimeSeries ( nameX, &epoch0, fHet, dt_SRC, &lalDimensionlessUnit, numSamples_SRCX )) != NULL, XLAL_EFUNC );
-      XLAL_CHECK ( (resamp->multiTimeSeries_SRC_b->data[X] = XLALCreateCOMPLEX8TimeSeries ( nameX, &epoch0, fHet, dt_SRC, &lalDimensionlessUnit, numSamples_SRCX )) != NULL, XLAL_EFUNC );
+      const UINT4 numSamplesAlloc_SRCX = useSRCPool ? 0 : numSamples_SRCX;
+      XLAL_CHECK ( (resamp->multiTimeSeries_SRC_a->data[X] = XLALCreateCOMPLEX8TimeSeries ( nameX, &epoch0, fHet, dt_SRC, &lalDimensionlessUnit, numSamplesAlloc_SRCX )) != NULL, XLAL_EFUNC );
+      XLAL_CHECK ( (resamp->multiTimeSeries_SRC_b->data[X] = XLALCreateCOMPLEX8TimeSeries ( nameX, &epoch0, fHet, dt_SRC, &lalDimensionlessUnit, numSamplesAlloc_SRCX )) != NULL, XLAL_EFUNC );
+      resamp->numSamples_SRC[X] = numSamples_SRCX;
+      resamp->SRCBytes += 2.0 * numSamples_SRCX * sizeof(COMPLEX8);
+      if ( useSRCPool ) {
+        XLALDestroyCOMPLEX8Sequence ( resamp->multiTimeSeries_SRC_a->data[X]->data );
+        resamp->multiTimeSeries_SRC_a->data[X]->data = NULL;
+        XLALDestroyCOMPLEX8Sequence ( resamp->multiTimeSeries_SRC_b->data[X]->data );
+        resamp->multiTimeSeries_SRC_b->data[X]->data = NULL;
+      }
 
       numSamplesMax_SRC = MYMAX ( numSamplesMax_SRC, numSamples_SRCX );
     } // for X < numDetectors
@@ -369,6 +561,51 @@ XLALSetupFstatResamp ( void **method_data,
 
   // ---- re-use shared workspace, or allocate here ----------
   ResampWorkspace *ws = (ResampWorkspace*) common->workspace;
+  const int retn_ws = XLALPrepareResampWorkspace ( &ws, numSamplesFFT, numSamplesMax_SRC );
+  common->workspace = ws;
+  XLAL_CHECK ( retn_ws == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // ----- join the pool of SRC-frame timeseries in the (shared) workspace ----------
+  if ( useSRCPool )
+    {
+      ws->SRCPoolMaxBytes = optArgs->resampSRCPoolMaxMB * 1048576.0;
+      resamp->SRCPool = ws;
+    }
+
+  // ----- compute and buffer FFT plan ----------
+  XLAL_CHECK ( XLALPlanResampFFT ( resamp, ws ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // turn on timing collection if requested
+  resamp->collectTiming = optArgs->collectTiming;
+
+  // initialize struct for collecting timing data, store invariant 'meta' quantities about this setup
+  if ( resamp->collectTiming )
+    {
+      XLAL_INIT_MEM ( resamp->timingGeneric );
+      resamp->timingGeneric.Ndet = numDetectors;
+
+      XLAL_INIT_MEM ( resamp->timingResamp );
+      resamp->timingResamp.Resolution = TspanXMax / TspanFFT;
+      resamp->timingResamp.NsampFFT0  = numSamplesFFT0;
+      resamp->timingResamp.NsampFFT   = numSamplesFFT;
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALSetupFstatResamp()
+
+///
+/// Re-use the (shared) workspace '*workspace' if given, growing its buffers if necessary, or allocate a new one
+///
+static int
+XLALPrepareResampWorkspace ( ResampWorkspace **workspace,
+                             const UINT4 numSamplesFFT,
+                             const UINT4 numSamplesMax_SRC
+                             )
+{
+  XLAL_CHECK ( workspace != NULL, XLAL_EFAULT );
+
+  ResampWorkspace *ws = (*workspace);
   if ( ws != NULL )
     {
       if ( numSamplesFFT > ws->numSamplesFFTAlloc )
@@ -389,24 +626,43 @@ XLALSetupFstatResamp ( void **method_data,
         ws->TStmp2_SRC->length = numSamplesMax_SRC;
         XLAL_CHECK ( (ws->SRCtimes_DET->data = XLALRealloc ( ws->SRCtimes_DET->data, numSamplesMax_SRC * sizeof(REAL8) )) != NULL, XLAL_ENOMEM );
         ws->SRCtimes_DET->length = numSamplesMax_SRC;
+        XLAL_CHECK ( (ws->SpinPhase_SRC->data = XLALRealloc ( ws->SpinPhase_SRC->data, numSamplesMax_SRC * sizeof(REAL4) )) != NULL, XLAL_ENOMEM );
+        ws->SpinPhase_SRC->length = numSamplesMax_SRC;
+        XLAL_CHECK ( (ws->SpinSin_SRC->data = XLALRealloc ( ws->SpinSin_SRC->data, numSamplesMax_SRC * sizeof(REAL4) )) != NULL, XLAL_ENOMEM );
+        ws->SpinSin_SRC->length = numSamplesMax_SRC;
+        XLAL_CHECK ( (ws->SpinCos_SRC->data = XLALRealloc ( ws->SpinCos_SRC->data, numSamplesMax_SRC * sizeof(REAL4) )) != NULL, XLAL_ENOMEM );
+        ws->SpinCos_SRC->length = numSamplesMax_SRC;
       }
 
     } // end: if shared workspace given
   else
     {
       XLAL_CHECK ( (ws = XLALCalloc ( 1, sizeof(*ws))) != NULL, XLAL_ENOMEM );
+      (*workspace) = ws;
       XLAL_CHECK ( (ws->TStmp1_SRC   = XLALCreateCOMPLEX8Vector ( numSamplesMax_SRC )) != NULL, XLAL_EFUNC );
       XLAL_CHECK ( (ws->TStmp2_SRC   = XLALCreateCOMPLEX8Vector ( numSamplesMax_SRC )) != NULL, XLAL_EFUNC );
       XLAL_CHECK ( (ws->SRCtimes_DET = XLALCreateREAL8Vector ( numSamplesMax_SRC )) != NULL, XLAL_EFUNC );
+      XLAL_CHECK ( (ws->SpinPhase_SRC = XLALCreateREAL4Vector ( numSamplesMax_SRC )) != NULL, XLAL_EFUNC );
+      XLAL_CHECK ( (ws->SpinSin_SRC   = XLALCreateREAL4Vector ( numSamplesMax_SRC )) != NULL, XLAL_EFUNC );
+      XLAL_CHECK ( (ws->SpinCos_SRC   = XLALCreateREAL4Vector ( numSamplesMax_SRC )) != NULL, XLAL_EFUNC );
 
       XLAL_CHECK ( (ws->FabX_Raw = fftw_malloc ( numSamplesFFT * sizeof(COMPLEX8) )) != NULL, XLAL_ENOMEM );
       XLAL_CHECK ( (ws->TS_FFT   = fftw_malloc ( numSamplesFFT * sizeof(COMPLEX8) )) != NULL, XLAL_ENOMEM );
       ws->numSamplesFFTAlloc = numSamplesFFT;
-
-      common->workspace = ws;
     } // end: if we create our own workspace
 
-  // ----- compute and buffer FFT plan ----------
+  return XLAL_SUCCESS;
+
+} // XLALPrepareResampWorkspace()
+
+///
+/// Compute the FFT plan of 'resamp', for the buffers of the workspace 'ws'
+///
+static int
+XLALPlanResampFFT ( ResampMethodData *resamp,
+                    const ResampWorkspace *ws
+                    )
+{
   int fft_plan_flags=FFTW_MEASURE;
   double fft_plan_timeout= FFTW_NO_TIMELIMIT ;
   char *wisdom_filename;
@@ -430,27 +686,116 @@ XLALSetupFstatResamp ( void **method_data,
   }
   XLALGetFFTPlanHints (& fft_plan_flags , & fft_plan_timeout);
   fftw_set_timelimit( fft_plan_timeout );
-  XLAL_CHECK ( (resamp->fftplan = fftwf_plan_dft_1d ( resamp->numSamplesFFT, ws->TS_FFT, ws->FabX_Raw, FFTW_FORWARD, fft_plan_flags )) != NULL, XLAL_EFAILED, "fftwf_plan_dft_1d() failed\n");
+  resamp->fftplan = fftwf_plan_dft_1d ( resamp->numSamplesFFT, ws->TS_FFT, ws->FabX_Raw, FFTW_FORWARD, fft_plan_flags );
   LAL_FFTW_WISDOM_UNLOCK;
+  XLAL_CHECK ( resamp->fftplan != NULL, XLAL_EFAILED, "fftwf_plan_dft_1d() failed\n");
 
-  // turn on timing collection if requested
-  resamp->collectTiming = optArgs->collectTiming;
+  return XLAL_SUCCESS;
 
-  // initialize struct for collecting timing data, store invariant 'meta' quantities about this setup
-  if ( resamp->collectTiming )
+} // XLALPlanResampFFT()
+
+static int
+XLALFstatInputWorker_Resamp ( void **method_data,
+                              FstatCommon *common,
+                              const void *input_method_data
+                            )
+{
+  // Check input
+  XLAL_CHECK ( method_data != NULL && (*method_data) == NULL, XLAL_EFAULT );
+  XLAL_CHECK ( common != NULL, XLAL_EFAULT );
+  XLAL_CHECK ( input_method_data != NULL, XLAL_EFAULT );
+
+  const ResampMethodData *resamp_input = (const ResampMethodData *) input_method_data;
+
+  // allocate memory and copy the input method_data struct; detector-frame timeseries and sinc window are shared with the input
+  ResampMethodData *resamp = *method_data = XLALCalloc ( 1, sizeof(*resamp) );
+  XLAL_CHECK ( resamp != NULL, XLAL_ENOMEM );
+  memcpy ( resamp, resamp_input, sizeof(*resamp) );
+
+  // empty all buffering quantities, SRC-frame timeseries, and FFT plans and memory
+  XLAL_INIT_MEM ( resamp->prev_doppler );
+  resamp->multiAMcoef = NULL;
+  resamp->multiSSBtimes = NULL;
+  resamp->multiBinaryTimes = NULL;
+  resamp->multiTimeSeries_SRC_a = NULL;
+  resamp->multiTimeSeries_SRC_b = NULL;
+  resamp->SRCPool = NULL;
+  resamp->SRCResident = 0;
+  resamp->SRCPoolPrev = NULL;
+  resamp->SRCPoolNext = NULL;
+  resamp->fftplan = NULL;
+
+  // reset timing counters, keeping invariant 'meta' quantities about this setup
+  XLAL_INIT_MEM ( resamp->timingGeneric );
+  XLAL_INIT_MEM ( resamp->timingResamp );
+  resamp->timingGeneric.Ndet = resamp_input->timingGeneric.Ndet;
+  resamp->timingResamp.Resolution = resamp_input->timingResamp.Resolution;
+  resamp->timingResamp.NsampFFT0  = resamp_input->timingResamp.NsampFFT0;
+  resamp->timingResamp.NsampFFT   = resamp_input->timingResamp.NsampFFT;
+
+  // header for SRC-frame resampled timeseries buffer, with the same layout as the input
+  const MultiCOMPLEX8TimeSeries *multiTimeSeries_SRC_a = resamp_input->multiTimeSeries_SRC_a;
+  const UINT4 numDetectors = multiTimeSeries_SRC_a->length;
+  XLAL_CHECK ( (resamp->multiTimeSeries_SRC_a = XLALCalloc ( 1, sizeof(MultiCOMPLEX8TimeSeries)) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK ( (resamp->multiTimeSeries_SRC_a->data = XLALCalloc ( numDetectors, sizeof(COMPLEX8TimeSeries) )) != NULL, XLAL_ENOMEM );
+  resamp->multiTimeSeries_SRC_a->length = numDetectors;
+
+  XLAL_CHECK ( (resamp->multiTimeSeries_SRC_b = XLALCalloc ( 1, sizeof(MultiCOMPLEX8TimeSeries)) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK ( (resamp->multiTimeSeries_SRC_b->data = XLALCalloc ( numDetectors, sizeof(COMPLEX8TimeSeries) )) != NULL, XLAL_ENOMEM );
+  resamp->multiTimeSeries_SRC_b->length = numDetectors;
+
+  LIGOTimeGPS XLAL_INIT_DECL(epoch0);	// will be set to corresponding SRC-frame epoch when barycentering
+  const BOOLEAN useSRCPool = ( resamp_input->SRCPool != NULL );
+  UINT4 numSamplesMax_SRC = 0;
+  for ( UINT4 X = 0; X < numDetectors; X ++ )
     {
-      XLAL_INIT_MEM ( resamp->timingGeneric );
-      resamp->timingGeneric.Ndet = numDetectors;
+      const COMPLEX8TimeSeries *TimeSeries_SRCX = multiTimeSeries_SRC_a->data[X];
+      const UINT4 numSamples_SRCX = resamp_input->numSamples_SRC[X];
+      const UINT4 numSamplesAlloc_SRCX = useSRCPool ? 0 : numSamples_SRCX;
+      XLAL_CHECK ( (resamp->multiTimeSeries_SRC_a->data[X] = XLALCreateCOMPLEX8TimeSeries ( TimeSeries_SRCX->name, &epoch0, TimeSeries_SRCX->f0, TimeSeries_SRCX->deltaT, &lalDimensionlessUnit, numSamplesAlloc_SRCX )) != NULL, XLAL_EFUNC );
+      XLAL_CHECK ( (resamp->multiTimeSeries_SRC_b->data[X] = XLALCreateCOMPLEX8TimeSeries ( TimeSeries_SRCX->name, &epoch0, TimeSeries_SRCX->f0, TimeSeries_SRCX->deltaT, &lalDimensionlessUnit, numSamplesAlloc_SRCX )) != NULL, XLAL_EFUNC );
+      if ( useSRCPool ) {
+        XLALDestroyCOMPLEX8Sequence ( resamp->multiTimeSeries_SRC_a->data[X]->data );
+        resamp->multiTimeSeries_SRC_a->data[X]->data = NULL;
+        XLALDestroyCOMPLEX8Sequence ( resamp->multiTimeSeries_SRC_b->data[X]->data );
+        resamp->multiTimeSeries_SRC_b->data[X]->data = NULL;
+      }
+      numSamplesMax_SRC = MYMAX ( numSamplesMax_SRC, numSamples_SRCX );
+    } // for X < numDetectors
 
-      XLAL_INIT_MEM ( resamp->timingResamp );
-      resamp->timingResamp.Resolution = TspanXMax / TspanFFT;
-      resamp->timingResamp.NsampFFT0  = numSamplesFFT0;
-      resamp->timingResamp.NsampFFT   = numSamplesFFT;
+  // ---- re-use workspace of previous worker, or allocate here ----------
+  ResampWorkspace *ws = (ResampWorkspace*) common->workspace;
+  const int retn_ws = XLALPrepareResampWorkspace ( &ws, resamp->numSamplesFFT, numSamplesMax_SRC );
+  common->workspace = ws;
+  XLAL_CHECK ( retn_ws == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // ----- join the pool of SRC-frame timeseries in the worker workspace, with the same memory limit as the input ----------
+  if ( useSRCPool )
+    {
+      ws->SRCPoolMaxBytes = resamp_input->SRCPool->SRCPoolMaxBytes;
+      resamp->SRCPool = ws;
     }
 
+  // ----- compute FFT plan for the worker workspace ----------
+  XLAL_CHECK ( XLALPlanResampFFT ( resamp, ws ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   return XLAL_SUCCESS;
 
-} // XLALSetupFstatResamp()
+} // XLALFstatInputWorker_Resamp()
+
+static void
+XLALDestroyFstatInputWorker_Resamp ( void *method_data )
+{
+
+  ResampMethodData *resamp = (ResampMethodData*) method_data;
+
+  // do not free data shared with the input
+  resamp->multiTimeSeries_DET = NULL;
+  resamp->sincWinDup = NULL;
+
+  XLALDestroyResampMethodData ( resamp );
+
+} // XLALDestroyFstatInputWorker_Resamp()
 
 
 static int
@@ -681,6 +1026,9 @@ XLALComputeFstatResamp ( FstatResults* Fstats,
       Tau->FFT   /= numDetectors;
       Tau->Norm  /= numDetectors;
       Tau->Copy  /= numDetectors;
+      Tau->Sinc  /= numDetectors;
+      Tau->SinCos /= numDetectors;
+      Tau->Rotate /= numDetectors;
       REAL8 Tau_buffer = Tau->Bary;
       // compute generic F-stat timing model contributions
       UINT4 NFbin      = Fstats->numFreqBins;
@@ -691,6 +1039,8 @@ XLALComputeFstatResamp ( FstatResults* Fstats,
       REAL8 tau0_Fbin  = (Tau->Copy + Tau->Norm + Tau->SumFabX + Tau->Fab2F) / NFbin;
       REAL8 tau0_spin  = Tau->Spin / (tiRS->Resolution * tiRS->NsampFFT );
       REAL8 tau0_FFT   = Tau->FFT / (5.0 * tiRS->NsampFFT * log2(tiRS->NsampFFT));
+      REAL8 tau0_sincos = Tau->SinCos / (tiRS->Resolution * tiRS->NsampFFT );
+      REAL8 tau0_rotate = Tau->Rotate / (tiRS->Resolution * tiRS->NsampFFT );
 
       // update the averaged timing-model quantities
       tiGen->NCalls ++;	// keep track of number of Fstat-calls for timing
@@ -704,15 +1054,19 @@ XLALComputeFstatResamp ( FstatResults* Fstats,
       updateAvgRS(tau0_Fbin);
       updateAvgRS(tau0_spin);
       updateAvgRS(tau0_FFT);
+      updateAvgRS(tau0_sincos);
+      updateAvgRS(tau0_rotate);
 
       // buffer-quantities only updated if buffer was actually recomputed
       if ( Tau->BufferRecomputed )
         {
           REAL8 tau0_bary   = Tau_buffer / (tiRS->Resolution * tiRS->NsampFFT);
+          REAL8 tau0_sinc   = Tau->Sinc / (tiRS->Resolution * tiRS->NsampFFT);
           REAL8 tauF_buffer = Tau_buffer / NFbin;
 
           updateAvgF(tauF_buffer);
           updateAvgRS(tau0_bary);
+          updateAvgRS(tau0_sinc);
         } // if BufferRecomputed
 
     } // if collectTiming
@@ -722,6 +1076,64 @@ XLALComputeFstatResamp ( FstatResults* Fstats,
 } // XLALComputeFstatResamp()
 
 
+///
+/// Compute the frequency shift which aligns the heterodyne frequency with the output frequency bins,
+/// and the offset of the first output frequency bin in the FFT of the SRC-frame timeseries
+///
+static int
+XLALGetFFTOffset_Resamp ( REAL8 *freqShift,					//!< [out] frequency shift to closest bin
+                          UINT4 *offset_bins,					//!< [out] FFT bin of first output frequency bin
+                          const ResampMethodData *resamp,			//!< [in] buffered resampling data
+                          const PulsarDopplerParams *thisPoint,			//!< [in] Doppler point to compute {FaX,FbX} for
+                          REAL8 dFreq,						//!< [in] output frequency resolution
+                          UINT4 numFreqBins,					//!< [in] number of output frequency bins
+                          const COMPLEX8TimeSeries *TimeSeries_SRC_a		//!< [in] SRC-frame single-IFO timeseries * a(t)
+                          )
+{
+  REAL8 FreqOut0 = thisPoint->fkdot[0];
+  REAL8 fHet     = TimeSeries_SRC_a->f0;
+
+  REAL8 dFreqFFT = dFreq / resamp->decimateFFT;	// internally may be using higher frequency resolution dFreqFFT than requested
+  (*freqShift) = remainder ( FreqOut0 - fHet, dFreq ); // frequency shift to closest bin
+  REAL8 fMinFFT = fHet + (*freqShift) - dFreqFFT * (resamp->numSamplesFFT/2);	// we'll shift DC into the *middle bin* N/2  [N always even!]
+  XLAL_CHECK ( FreqOut0 >= fMinFFT, XLAL_EDOM, "Lowest output frequency outside the available frequency band: [FreqOut0 = %.16g] < [fMinFFT = %.16g]\n", FreqOut0, fMinFFT );
+  (*offset_bins) = (UINT4) lround ( ( FreqOut0 - fMinFFT ) / dFreqFFT );
+  UINT4 maxOutputBin = (*offset_bins) + (numFreqBins - 1) * resamp->decimateFFT;
+  XLAL_CHECK ( maxOutputBin < resamp->numSamplesFFT, XLAL_EDOM, "Highest output frequency bin outside available band: [maxOutputBin = %d] >= [numSamplesFFT = %d]\n", maxOutputBin, resamp->numSamplesFFT );
+
+  return XLAL_SUCCESS;
+
+} // XLALGetFFTOffset_Resamp()
+
+///
+/// Apply normalization factors to {FaX,FbX} computed from the FFT of the SRC-frame timeseries
+///
+static void
+XLALNormalizeFaFb_Resamp ( COMPLEX8 *FaX_k,					//!< [in,out] F_a^X(f_k) over output bins
+                           COMPLEX8 *FbX_k,					//!< [in,out] F_b^X(f_k) over output bins
+                           const PulsarDopplerParams *thisPoint,		//!< [in] Doppler point to compute {FaX,FbX} for
+                           REAL8 dFreq,						//!< [in] output frequency resolution
+                           UINT4 numFreqBins,					//!< [in] number of output frequency bins
+                           const COMPLEX8TimeSeries *TimeSeries_SRC_a		//!< [in] SRC-frame single-IFO timeseries * a(t)
+                           )
+{
+  REAL8 FreqOut0 = thisPoint->fkdot[0];
+  REAL8 dt_SRC   = TimeSeries_SRC_a->deltaT;
+
+  const REAL8 dtauX = GPSDIFF ( TimeSeries_SRC_a->epoch, thisPoint->refTime );
+  for ( UINT4 k = 0; k < numFreqBins; k++ )
+    {
+      REAL8 f_k = FreqOut0 + k * dFreq;
+      REAL8 cycles = - f_k * dtauX;
+      REAL4 sinphase, cosphase;
+      XLALSinCos2PiLUT ( &sinphase, &cosphase, cycles );
+      COMPLEX8 normX_k = dt_SRC * crectf ( cosphase, sinphase );
+      FaX_k[k] *= normX_k;
+      FbX_k[k] *= normX_k;
+    } // for k < numFreqBinsOut
+
+} // XLALNormalizeFaFb_Resamp()
+
 static int
 XLALComputeFaFb_Resamp ( ResampMethodData *resamp,				//!< [in,out] buffered resampling data and workspace
                          ResampWorkspace *ws,					//!< [in,out] resampling workspace (memory-sharing across segments)
@@ -736,19 +1148,10 @@ XLALComputeFaFb_Resamp ( ResampMethodData *resamp,				//!< [in,out] buffered res
   XLAL_CHECK ( dFreq > 0, XLAL_EINVAL );
   XLAL_CHECK ( numFreqBins <= ws->numFreqBinsAlloc, XLAL_EINVAL );
 
-  REAL8 FreqOut0 = thisPoint.fkdot[0];
-
   // compute frequency shift to align heterodyne frequency with output frequency bins
-  REAL8 fHet   = TimeSeries_SRC_a->f0;
-  REAL8 dt_SRC = TimeSeries_SRC_a->deltaT;
-
-  REAL8 dFreqFFT = dFreq / resamp->decimateFFT;	// internally may be using higher frequency resolution dFreqFFT than requested
-  REAL8 freqShift = remainder ( FreqOut0 - fHet, dFreq ); // frequency shift to closest bin
-  REAL8 fMinFFT = fHet + freqShift - dFreqFFT * (resamp->numSamplesFFT/2);	// we'll shift DC into the *middle bin* N/2  [N always even!]
-  XLAL_CHECK ( FreqOut0 >= fMinFFT, XLAL_EDOM, "Lowest output frequency outside the available frequency band: [FreqOut0 = %.16g] < [fMinFFT = %.16g]\n", FreqOut0, fMinFFT );
-  UINT4 offset_bins = (UINT4) lround ( ( FreqOut0 - fMinFFT ) / dFreqFFT );
-  UINT4 maxOutputBin = offset_bins + (numFreqBins - 1) * resamp->decimateFFT;
-  XLAL_CHECK ( maxOutputBin < resamp->numSamplesFFT, XLAL_EDOM, "Highest output frequency bin outside available band: [maxOutputBin = %d] >= [numSamplesFFT = %d]\n", maxOutputBin, resamp->numSamplesFFT );
+  REAL8 freqShift = 0;
+  UINT4 offset_bins = 0;
+  XLAL_CHECK ( XLALGetFFTOffset_Resamp ( &freqShift, &offset_bins, resamp, &thisPoint, dFreq, numFreqBins, TimeSeries_SRC_a ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   FstatTimingResamp *tiRS = &(resamp->timingResamp);
   BOOLEAN collectTiming = resamp->collectTiming;
@@ -763,7 +1166,7 @@ XLALComputeFaFb_Resamp ( ResampMethodData *resamp,				//!< [in,out] buffered res
   memset ( ws->TS_FFT, 0, resamp->numSamplesFFT * sizeof(ws->TS_FFT[0]) );
   // ----- compute FaX_k
   // apply spindown phase-factors, store result in zero-padded timeseries for 'FFT'ing
-  XLAL_CHECK ( XLALApplySpindownAndFreqShift ( ws->TS_FFT, TimeSeries_SRC_a, &thisPoint, freqShift ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK ( XLALApplySpindownAndFreqShift ( ws->TS_FFT, TimeSeries_SRC_a, &thisPoint, freqShift, resamp, ws ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   if ( collectTiming ) {
     toc = XLALGetCPUTime();
@@ -792,7 +1195,7 @@ XLALComputeFaFb_Resamp ( ResampMethodData *resamp,				//!< [in,out] buffered res
 
   // ----- compute FbX_k
   // apply spindown phase-factors, store result in zero-padded timeseries for 'FFT'ing
-  XLAL_CHECK ( XLALApplySpindownAndFreqShift ( ws->TS_FFT, TimeSeries_SRC_b, &thisPoint, freqShift ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK ( XLALApplySpindownAndFreqShift ( ws->TS_FFT, TimeSeries_SRC_b, &thisPoint, freqShift, resamp, ws ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   if ( collectTiming ) {
     toc = XLALGetCPUTime();
@@ -820,17 +1223,7 @@ XLALComputeFaFb_Resamp ( ResampMethodData *resamp,				//!< [in,out] buffered res
   }
 
   // ----- normalization factors to be applied to Fa and Fb:
-  const REAL8 dtauX = GPSDIFF ( TimeSeries_SRC_a->epoch, thisPoint.refTime );
-  for ( UINT4 k = 0; k < numFreqBins; k++ )
-    {
-      REAL8 f_k = FreqOut0 + k * dFreq;
-      REAL8 cycles = - f_k * dtauX;
-      REAL4 sinphase, cosphase;
-      XLALSinCos2PiLUT ( &sinphase, &cosphase, cycles );
-      COMPLEX8 normX_k = dt_SRC * crectf ( cosphase, sinphase );
-      ws->FaX_k[k] *= normX_k;
-      ws->FbX_k[k] *= normX_k;
-    } // for k < numFreqBinsOut
+  XLALNormalizeFaFb_Resamp ( ws->FaX_k, ws->FbX_k, &thisPoint, dFreq, numFreqBins, TimeSeries_SRC_a );
 
   if ( collectTiming ) {
     toc = XLALGetCPUTime();
@@ -842,17 +1235,228 @@ XLALComputeFaFb_Resamp ( ResampMethodData *resamp,				//!< [in,out] buffered res
 
 } // XLALComputeFaFb_Resamp()
 
+///
+/// Compute the F-statistic for a batch of templates with the same sky position and binary orbital
+/// parameters, which therefore share the same buffered SRC-frame timeseries. The {Fa,Fb} of each
+/// group of #RESAMP_FFT_BATCH templates are Fourier-transformed together with a single batched FFT;
+/// any remaining templates, and all templates if timing information is being collected, are
+/// computed individually by XLALComputeFstatResamp().
+///
+static int
+XLALComputeFstatResampBatch ( FstatResults **Fstats,
+                              const UINT4 numTemplates,
+                              const FstatCommon *common,
+                              void *method_data
+                              )
+{
+  // Check input
+  XLAL_CHECK ( Fstats != NULL, XLAL_EFAULT );
+  XLAL_CHECK ( numTemplates > 0, XLAL_EINVAL );
+  XLAL_CHECK ( common != NULL, XLAL_EFAULT );
+  XLAL_CHECK ( method_data != NULL, XLAL_EFAULT );
+
+  ResampMethodData *resamp = (ResampMethodData*) method_data;
+  ResampWorkspace *ws = (ResampWorkspace*) common->workspace;
+
+  const FstatQuantities whatToCompute = Fstats[0]->whatWasComputed;
+  XLAL_CHECK ( !(whatToCompute & FSTATQ_ATOMS_PER_DET), XLAL_EINVAL, "Resampling does not currently support atoms per detector" );
+  const UINT4 numFreqBins = Fstats[0]->numFreqBins;
+  for ( UINT4 t = 1; t < numTemplates; ++t ) {
+    XLAL_CHECK ( Fstats[t]->whatWasComputed == whatToCompute && Fstats[t]->numFreqBins == numFreqBins, XLAL_EINVAL );
+  }
+
+  // number of templates computed with batched FFTs
+  UINT4 numBatched = 0;
+  if ( !resamp->collectTiming && whatToCompute != FSTATQ_NONE ) {
+    numBatched = numTemplates - ( numTemplates % RESAMP_FFT_BATCH );
+  }
+
+  if ( numBatched > 0 )
+    {
+      // Note: all buffering is done within that function
+      XLAL_CHECK ( XLALBarycentricResampleMultiCOMPLEX8TimeSeries ( resamp, &Fstats[0]->doppler, common ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      const MultiCOMPLEX8TimeSeries *multiTimeSeries_SRC_a = resamp->multiTimeSeries_SRC_a;
+      const MultiCOMPLEX8TimeSeries *multiTimeSeries_SRC_b = resamp->multiTimeSeries_SRC_b;
+      const UINT4 numDetectors = multiTimeSeries_SRC_a->length;
+      const UINT4 numSamplesFFT = resamp->numSamplesFFT;
+
+      // ----- allocate (or grow) workspace memory for batched FFTs, if needed
+      // the FFT plan depends on the memory and on the FFT length, so is re-created if either changes
+      if ( numSamplesFFT > ws->numSamplesFFTBatchAlloc )
+        {
+          LAL_FFTW_WISDOM_LOCK;
+          if ( ws->fftplan_batch != NULL ) {
+            fftwf_destroy_plan ( ws->fftplan_batch );
+            ws->fftplan_batch = NULL;
+          }
+          LAL_FFTW_WISDOM_UNLOCK;
+          fftw_free ( ws->TS_FFT_batch );
+          XLAL_CHECK ( (ws->TS_FFT_batch   = fftw_malloc ( 2 * RESAMP_FFT_BATCH * numSamplesFFT * sizeof(COMPLEX8) )) != NULL, XLAL_ENOMEM );
+          fftw_free ( ws->FabX_Raw_batch );
+          XLAL_CHECK ( (ws->FabX_Raw_batch = fftw_malloc ( 2 * RESAMP_FFT_BATCH * numSamplesFFT * sizeof(COMPLEX8) )) != NULL, XLAL_ENOMEM );
+          ws->numSamplesFFTBatchAlloc = numSamplesFFT;
+        }
+      if ( ws->fftplan_batch == NULL || ws->numSamplesFFTBatchPlan != numSamplesFFT )
+        {
+          int fft_plan_flags = FFTW_MEASURE;
+          double fft_plan_timeout = FFTW_NO_TIMELIMIT;
+          const int n = numSamplesFFT;
+          LAL_FFTW_WISDOM_LOCK;
+          if ( ws->fftplan_batch != NULL ) {
+            fftwf_destroy_plan ( ws->fftplan_batch );
+          }
+          XLALGetFFTPlanHints ( &fft_plan_flags, &fft_plan_timeout );
+          fftw_set_timelimit( fft_plan_timeout );
+          ws->fftplan_batch = fftwf_plan_many_dft ( 1, &n, 2 * RESAMP_FFT_BATCH,
+                                                    ws->TS_FFT_batch, NULL, 1, n,
+                                                    ws->FabX_Raw_batch, NULL, 1, n,
+                                                    FFTW_FORWARD, fft_plan_flags );
+          LAL_FFTW_WISDOM_UNLOCK;
+          XLAL_CHECK ( ws->fftplan_batch != NULL, XLAL_EFAILED, "fftwf_plan_many_dft() failed\n" );
+          ws->numSamplesFFTBatchPlan = numSamplesFFT;
+        }
+      if ( numFreqBins > ws->numFreqBinsBatchAlloc )
+        {
+          XLAL_CHECK ( (ws->Fab_k_batch = XLALRealloc ( ws->Fab_k_batch, 4 * RESAMP_FFT_BATCH * numFreqBins * sizeof(COMPLEX8) )) != NULL, XLAL_ENOMEM );
+          ws->numFreqBinsBatchAlloc = numFreqBins;
+        }
+
+      for ( UINT4 t0 = 0; t0 < numBatched; t0 += RESAMP_FFT_BATCH )
+        {
+          FstatResults **FstatsB = &Fstats[t0];
+
+          // use return-struct memory for {Fa,Fb}, {FaX,FbX} if requested, otherwise batch memory
+          COMPLEX8 *Fa_k[RESAMP_FFT_BATCH], *Fb_k[RESAMP_FFT_BATCH], *FaX_k[RESAMP_FFT_BATCH], *FbX_k[RESAMP_FFT_BATCH];
+          for ( UINT4 t = 0; t < RESAMP_FFT_BATCH; ++t )
+            {
+              Fa_k[t] = ( whatToCompute & FSTATQ_FAFB ) ? FstatsB[t]->Fa : ws->Fab_k_batch + (4*t + 2) * numFreqBins;
+              Fb_k[t] = ( whatToCompute & FSTATQ_FAFB ) ? FstatsB[t]->Fb : ws->Fab_k_batch + (4*t + 3) * numFreqBins;
+            }
+
+          // loop over detectors
+          for ( UINT4 X = 0; X < numDetectors; X++ )
+            {
+              const COMPLEX8TimeSeries *TimeSeriesX_SRC_a = multiTimeSeries_SRC_a->data[X];
+              const COMPLEX8TimeSeries *TimeSeriesX_SRC_b = multiTimeSeries_SRC_b->data[X];
+              XLAL_CHECK ( numSamplesFFT >= TimeSeriesX_SRC_a->data->length, XLAL_EFAILED, "[numSamplesFFT = %d] < [len(TimeSeries_SRC_a) = %d]\n", numSamplesFFT, TimeSeriesX_SRC_a->data->length );
+              XLAL_CHECK ( numSamplesFFT >= TimeSeriesX_SRC_b->data->length, XLAL_EFAILED, "[numSamplesFFT = %d] < [len(TimeSeries_SRC_b) = %d]\n", numSamplesFFT, TimeSeriesX_SRC_b->data->length );
+
+              // apply spindown phase-factors for each template, store results in zero-padded timeseries for 'FFT'ing
+              UINT4 offset_bins[RESAMP_FFT_BATCH];
+              memset ( ws->TS_FFT_batch, 0, 2 * RESAMP_FFT_BATCH * numSamplesFFT * sizeof(ws->TS_FFT_batch[0]) );
+              for ( UINT4 t = 0; t < RESAMP_FFT_BATCH; ++t )
+                {
+                  REAL8 freqShift = 0;
+                  XLAL_CHECK ( XLALGetFFTOffset_Resamp ( &freqShift, &offset_bins[t], resamp, &FstatsB[t]->doppler, common->dFreq, numFreqBins, TimeSeriesX_SRC_a ) == XLAL_SUCCESS, XLAL_EFUNC );
+                  XLAL_CHECK ( XLALApplySpindownAndFreqShift ( ws->TS_FFT_batch + (2*t) * numSamplesFFT, TimeSeriesX_SRC_a, &FstatsB[t]->doppler, freqShift, resamp, ws ) == XLAL_SUCCESS, XLAL_EFUNC );
+                  XLAL_CHECK ( XLALApplySpindownAndFreqShift ( ws->TS_FFT_batch + (2*t + 1) * numSamplesFFT, TimeSeriesX_SRC_b, &FstatsB[t]->doppler, freqShift, resamp, ws ) == XLAL_SUCCESS, XLAL_EFUNC );
+                }
+
+              // Fourier transform the resampled Fa(t), Fb(t) of all templates
+              fftwf_execute ( ws->fftplan_batch );
+
+              for ( UINT4 t = 0; t < RESAMP_FFT_BATCH; ++t )
+                {
+                  FaX_k[t] = ( whatToCompute & FSTATQ_FAFB_PER_DET ) ? FstatsB[t]->FaPerDet[X] : ws->Fab_k_batch + (4*t + 0) * numFreqBins;
+                  FbX_k[t] = ( whatToCompute & FSTATQ_FAFB_PER_DET ) ? FstatsB[t]->FbPerDet[X] : ws->Fab_k_batch + (4*t + 1) * numFreqBins;
+
+                  // copy and normalize {FaX,FbX}
+                  const COMPLEX8 *FaX_Raw = ws->FabX_Raw_batch + (2*t) * numSamplesFFT;
+                  const COMPLEX8 *FbX_Raw = ws->FabX_Raw_batch + (2*t + 1) * numSamplesFFT;
+                  for ( UINT4 k = 0; k < numFreqBins; k++ )
+                    {
+                      FaX_k[t][k] = FaX_Raw [ offset_bins[t] + k * resamp->decimateFFT ];
+                      FbX_k[t][k] = FbX_Raw [ offset_bins[t] + k * resamp->decimateFFT ];
+                    }
+                  XLALNormalizeFaFb_Resamp ( FaX_k[t], FbX_k[t], &FstatsB[t]->doppler, common->dFreq, numFreqBins, TimeSeriesX_SRC_a );
+
+                  if ( X == 0 )
+                    { // for the first detector we *copy* results
+                      for ( UINT4 k = 0; k < numFreqBins; k++ )
+                        {
+                          Fa_k[t][k] = FaX_k[t][k];
+                          Fb_k[t][k] = FbX_k[t][k];
+                        }
+                    }
+                  else
+                    { // for subsequent detectors we *add to* them
+                      for ( UINT4 k = 0; k < numFreqBins; k++ )
+                        {
+                          Fa_k[t][k] += FaX_k[t][k];
+                          Fb_k[t][k] += FbX_k[t][k];
+                        }
+                    }
+
+                  // ----- if requested: compute per-detector Fstat_X_k
+                  if ( whatToCompute & FSTATQ_2F_PER_DET )
+                    {
+                      const REAL4 AdX = resamp->MmunuX[X].Ad;
+                      const REAL4 BdX = resamp->MmunuX[X].Bd;
+                      const REAL4 CdX = resamp->MmunuX[X].Cd;
+                      const REAL4 EdX = resamp->MmunuX[X].Ed;
+                      const REAL4 DdX_inv = 1.0f / resamp->MmunuX[X].Dd;
+                      for ( UINT4 k = 0; k < numFreqBins; k ++ )
+                        {
+                          FstatsB[t]->twoFPerDet[X][k] = compute_fstat_from_fa_fb ( FaX_k[t][k], FbX_k[t][k], AdX, BdX, CdX, EdX, DdX_inv );
+                        }
+                    }
+
+                } // for t < RESAMP_FFT_BATCH
+
+            } // for X < numDetectors
+
+          for ( UINT4 t = 0; t < RESAMP_FFT_BATCH; ++t )
+            {
+              if ( whatToCompute & FSTATQ_2F )
+                {
+                  const REAL4 Ad = resamp->Mmunu.Ad;
+                  const REAL4 Bd = resamp->Mmunu.Bd;
+                  const REAL4 Cd = resamp->Mmunu.Cd;
+                  const REAL4 Ed = resamp->Mmunu.Ed;
+                  const REAL4 Dd_inv = 1.0f / resamp->Mmunu.Dd;
+                  for ( UINT4 k = 0; k < numFreqBins; k++ )
+                    {
+                      FstatsB[t]->twoF[k] = compute_fstat_from_fa_fb ( Fa_k[t][k], Fb_k[t][k], Ad, Bd, Cd, Ed, Dd_inv );
+                    }
+                }
+
+              // Return antenna-pattern matrices
+              FstatsB[t]->Mmunu = resamp->Mmunu;
+              for ( UINT4 X = 0; X < numDetectors; X ++ )
+                {
+                  FstatsB[t]->MmunuX[X] = resamp->MmunuX[X];
+                }
+            }
+
+        } // for t0 < numBatched
+
+    } // if numBatched > 0
+
+  // compute remaining templates individually
+  for ( UINT4 t = numBatched; t < numTemplates; ++t )
+    {
+      XLAL_CHECK ( XLALComputeFstatResamp ( Fstats[t], common, method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALComputeFstatResampBatch()
+
 static int
 XLALApplySpindownAndFreqShift ( COMPLEX8 *restrict xOut,      			///< [out] the spindown-corrected SRC-frame timeseries
                                 const COMPLEX8TimeSeries *restrict xIn,		///< [in] the input SRC-frame timeseries
                                 const PulsarDopplerParams *restrict doppler,	///< [in] containing spindown parameters
-                                REAL8 freqShift					///< [in] frequency-shift to apply, sign is "new - old"
+                                REAL8 freqShift,				///< [in] frequency-shift to apply, sign is "new - old"
+                                ResampMethodData *resamp,			///< [in,out] resampling kernels and timing data
+                                ResampWorkspace *ws				///< [in,out] resampling workspace holding the phase buffers
                                 )
 {
   // input sanity checks
   XLAL_CHECK ( xOut != NULL, XLAL_EINVAL );
   XLAL_CHECK ( xIn != NULL, XLAL_EINVAL );
   XLAL_CHECK ( doppler != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( resamp != NULL && ws != NULL, XLAL_EINVAL );
 
   // determine number of spin downs to include
   UINT4 s_max = PULSAR_MAX_SPINS - 1;
@@ -862,11 +1466,13 @@ XLALApplySpindownAndFreqShift ( COMPLEX8 *restrict xOut,      			///< [out] the
 
   REAL8 dt = xIn->deltaT;
   UINT4 numSamplesIn  = xIn->data->length;
+  XLAL_CHECK ( numSamplesIn <= ws->SpinPhase_SRC->length, XLAL_EINVAL );
+  REAL4 *phase = ws->SpinPhase_SRC->data;
 
   LIGOTimeGPS epoch = xIn->epoch;
   REAL8 Dtau0 = GPSDIFF ( epoch, doppler->refTime );
 
-  // loop over time samples
+  // loop over time samples: compute phase in cycles, reduced to [0,1) in double precision
   for ( UINT4 j = 0; j < numSamplesIn; j ++ )
     {
       REAL8 taup_j = j * dt;
@@ -881,19 +1487,70 @@ XLALApplySpindownAndFreqShift ( COMPLEX8 *restrict xOut,      			///< [out] the
           cycles += - LAL_FACT_INV[k+1] * doppler->fkdot[k] * Dtau_pow_kp1;
         } // for k = 1 ... s_max
 
-      REAL4 cosphase, sinphase;
-      XLAL_CHECK( XLALSinCos2PiLUT ( &sinphase, &cosphase, cycles ) == XLAL_SUCCESS, XLAL_EFUNC );
-      COMPLEX8 em2piphase = crectf ( cosphase, sinphase );
-
-      // weight the complex timeseries by the antenna patterns
-      xOut[j] = em2piphase * xIn->data->data[j];
+      phase[j] = cycles - floor ( cycles );
 
     } // for j < numSamplesIn
 
+  BOOLEAN collectTiming = resamp->collectTiming;
+  Timings_t *Tau = &(resamp->timingResamp.Tau);
+  REAL8 tic = 0, toc = 0;
+  if ( collectTiming ) {
+    tic = XLALGetCPUTime();
+  }
+
+  // compute phase factors e^{i 2 pi phase}
+  XLAL_CHECK ( XLALVectorSinCos2PiREAL4 ( ws->SpinSin_SRC->data, ws->SpinCos_SRC->data, phase, numSamplesIn ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  if ( collectTiming ) {
+    toc = XLALGetCPUTime();
+    Tau->SinCos += ( toc - tic );
+    tic = toc;
+  }
+
+  // multiply the complex timeseries by the phase factors
+  XLAL_CHECK ( (resamp->rotate_func) ( xOut, xIn->data->data, ws->SpinSin_SRC->data, ws->SpinCos_SRC->data, numSamplesIn ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  if ( collectTiming ) {
+    toc = XLALGetCPUTime();
+    Tau->Rotate += ( toc - tic );
+  }
+
   return XLAL_SUCCESS;
 
 } // XLALApplySpindownAndFreqShift()
 
+///
+/// Generic windowed-sinc interpolation kernel: calls XLALSincInterpolateCOMPLEX8TimeSeries()
+///
+static int
+XLALSincInterpolateCOMPLEX8_GEN ( COMPLEX8Vector *y_out,		///< [out] output series of interpolated y-values [must be same size as t_out]
+                                  const REAL8Vector *t_out,		///< [in] output time-steps to interpolate input to
+                                  const COMPLEX8TimeSeries *ts_in,	///< [in] regularly-spaced input timeseries
+                                  const REAL4 UNUSED *winDup,		///< [in] duplicated, sign-alternating window [unused]
+                                  const UINT4 Dterms			///< [in] window sinc kernel sum to +-Dterms around max
+                                  )
+{
+  return XLALSincInterpolateCOMPLEX8TimeSeries ( y_out, t_out, ts_in, Dterms );
+} // XLALSincInterpolateCOMPLEX8_GEN()
+
+///
+/// Generic phase-rotation kernel: multiply a complex timeseries by the phase factors (cosphase + i sinphase)
+///
+static int
+XLALRotateCOMPLEX8_GEN ( COMPLEX8 *xOut,		///< [out] rotated timeseries (may be the same as xIn)
+                         const COMPLEX8 *xIn,		///< [in] timeseries to rotate
+                         const REAL4 *sinphase,		///< [in] sine of phase
+                         const REAL4 *cosphase,		///< [in] cosine of phase
+                         const UINT4 len		///< [in] number of samples
+                         )
+{
+  for ( UINT4 j = 0; j < len; j ++ )
+    {
+      xOut[j] = crectf ( cosphase[j], sinphase[j] ) * xIn[j];
+    }
+  return XLAL_SUCCESS;
+} // XLALRotateCOMPLEX8_GEN()
+
 ///
 /// Performs barycentric resampling on a multi-detector timeseries, updates resampling buffer with results
 ///
@@ -921,6 +1578,12 @@ XLALBarycentricResampleMultiCOMPLEX8TimeSeries ( ResampMethodData *resamp,		// [
   XLAL_CHECK ( resamp->multiTimeSeries_SRC_a->length == numDetectors, XLAL_EINVAL, "Inconsistent number of detectors tsDET(%d) != tsSRC(%d)\n", numDetectors, resamp->multiTimeSeries_SRC_a->length );
   XLAL_CHECK ( resamp->multiTimeSeries_SRC_b->length == numDetectors, XLAL_EINVAL, "Inconsistent number of detectors tsDET(%d) != tsSRC(%d)\n", numDetectors, resamp->multiTimeSeries_SRC_b->length );
 
+  // if SRC-frame timeseries are pooled, make sure they are allocated; if they were not, they need to be recomputed
+  BOOLEAN SRC_reallocated = 0;
+  if ( resamp->SRCPool != NULL ) {
+    XLAL_CHECK ( XLALAcquireResampSRCPool ( resamp, &SRC_reallocated ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
   // ============================== BEGIN: handle buffering =============================
   BOOLEAN same_skypos = (resamp->prev_doppler.Alpha == thisPoint->Alpha) && (resamp->prev_doppler.Delta == thisPoint->Delta);
   BOOLEAN same_refTime = ( GPSDIFF ( resamp->prev_doppler.refTime, thisPoint->refTime ) == 0 );
@@ -936,7 +1599,7 @@ XLALBarycentricResampleMultiCOMPLEX8TimeSeries ( ResampMethodData *resamp,		// [
   BOOLEAN collectTiming = resamp->collectTiming;
 
   // if same sky-position *and* same binary, we can simply return as there's nothing to be done here
-  if ( same_skypos && same_refTime && same_binary ) {
+  if ( same_skypos && same_refTime && same_binary && !SRC_reallocated ) {
     Tau->BufferRecomputed = 0;
     return XLAL_SUCCESS;
   }
@@ -1095,15 +1758,19 @@ XLALBarycentricResampleMultiCOMPLEX8TimeSeries ( ResampMethodData *resamp,		// [
       XLAL_CHECK ( ti_DET->length >= TimeSeries_SRCX_a->data->length, XLAL_EINVAL );
       UINT4 bak_length = ti_DET->length;
       ti_DET->length = TimeSeries_SRCX_a->data->length;
-      XLAL_CHECK ( XLALSincInterpolateCOMPLEX8TimeSeries ( TimeSeries_SRCX_a->data, ti_DET, TimeSeries_DETX, resamp->Dterms ) == XLAL_SUCCESS, XLAL_EFUNC );
+      REAL8 ticSinc = 0;
+      if ( collectTiming ) {
+        ticSinc = XLALGetCPUTime();
+      }
+      XLAL_CHECK ( (resamp->sinc_func) ( TimeSeries_SRCX_a->data, ti_DET, TimeSeries_DETX, resamp->sincWinDup, resamp->Dterms ) == XLAL_SUCCESS, XLAL_EFUNC );
+      if ( collectTiming ) {
+        Tau->Sinc += XLALGetCPUTime() - ticSinc;
+      }
       ti_DET->length = bak_length;
 
       // apply heterodyne correction and AM-functions a(t) and b(t) to interpolated timeseries
-      for ( UINT4 j = 0; j < numSamples_SRCX; j ++ )
-        {
-          TimeSeries_SRCX_b->data->data[j] = TimeSeries_SRCX_a->data->data[j] * ws->TStmp2_SRC->data[j];
-          TimeSeries_SRCX_a->data->data[j] *= ws->TStmp1_SRC->data[j];
-        } // for j < numSamples_SRCX
+      XLAL_CHECK ( XLALVectorMultiplyCOMPLEX8 ( TimeSeries_SRCX_b->data->data, TimeSeries_SRCX_a->data->data, ws->TStmp2_SRC->data, numSamples_SRCX ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK ( XLALVectorMultiplyCOMPLEX8 ( TimeSeries_SRCX_a->data->data, TimeSeries_SRCX_a->data->data, ws->TStmp1_SRC->data, numSamples_SRCX ) == XLAL_SUCCESS, XLAL_EFUNC );
 
     } // for X < numDetectors
 
@@ -1116,6 +1783,121 @@ XLALBarycentricResampleMultiCOMPLEX8TimeSeries ( ResampMethodData *resamp,		// [
 
 } // XLALBarycentricResampleMultiCOMPLEX8TimeSeries()
 
+///
+/// Make sure the SRC-frame timeseries of an input using the pool are allocated, and mark them as the most-recently used.
+/// If they need to be allocated, the least-recently used timeseries of other inputs are freed until the pool has room for them;
+/// the timeseries of the current input are always allocated, even if they alone exceed the pool limit.
+///
+static int
+XLALAcquireResampSRCPool ( ResampMethodData *resamp,	///< [in,out] resampling data using the pool
+                           BOOLEAN *reallocated		///< [out] whether timeseries were (re-)allocated, and so need to be recomputed
+                           )
+{
+  XLAL_CHECK ( resamp != NULL && resamp->SRCPool != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( reallocated != NULL, XLAL_EINVAL );
+
+  ResampWorkspace *pool = resamp->SRCPool;
+
+  if ( resamp->SRCResident )
+    {
+      (*reallocated) = 0;
+      if ( pool->SRCPoolHead == resamp ) {
+        return XLAL_SUCCESS;
+      }
+      // unlink from the least-recently-used list; re-inserted at the head below
+      resamp->SRCPoolPrev->SRCPoolNext = resamp->SRCPoolNext;
+      if ( resamp->SRCPoolNext != NULL ) {
+        resamp->SRCPoolNext->SRCPoolPrev = resamp->SRCPoolPrev;
+      } else {
+        pool->SRCPoolTail = resamp->SRCPoolPrev;
+      }
+    }
+  else
+    {
+      (*reallocated) = 1;
+
+      // free least-recently used timeseries until there is room for those of this input
+      while ( pool->SRCPoolTail != NULL && pool->SRCPoolBytes + resamp->SRCBytes > pool->SRCPoolMaxBytes ) {
+        XLALReleaseResampSRCPool ( pool->SRCPoolTail );
+        pool->SRCPoolEvictions ++;
+      }
+
+      // if any allocation fails, free those already made, so that the input is left non-resident and consistent
+      const UINT4 numDetectors = resamp->multiTimeSeries_SRC_a->length;
+      for ( UINT4 X = 0; X < numDetectors; X ++ )
+        {
+          resamp->multiTimeSeries_SRC_a->data[X]->data = XLALCreateCOMPLEX8Sequence ( resamp->numSamples_SRC[X] );
+          resamp->multiTimeSeries_SRC_b->data[X]->data = XLALCreateCOMPLEX8Sequence ( resamp->numSamples_SRC[X] );
+          if ( resamp->multiTimeSeries_SRC_a->data[X]->data == NULL || resamp->multiTimeSeries_SRC_b->data[X]->data == NULL )
+            {
+              for ( UINT4 Y = 0; Y <= X; Y ++ )
+                {
+                  XLALDestroyCOMPLEX8Sequence ( resamp->multiTimeSeries_SRC_a->data[Y]->data );
+                  resamp->multiTimeSeries_SRC_a->data[Y]->data = NULL;
+                  XLALDestroyCOMPLEX8Sequence ( resamp->multiTimeSeries_SRC_b->data[Y]->data );
+                  resamp->multiTimeSeries_SRC_b->data[Y]->data = NULL;
+                }
+              XLAL_ERROR ( XLAL_EFUNC );
+            }
+        }
+
+      pool->SRCPoolBytes += resamp->SRCBytes;
+      pool->SRCPoolPeakBytes = fmax ( pool->SRCPoolPeakBytes, pool->SRCPoolBytes );
+      resamp->SRCResident = 1;
+    }
+
+  // insert at the head of the least-recently-used list
+  resamp->SRCPoolPrev = NULL;
+  resamp->SRCPoolNext = pool->SRCPoolHead;
+  if ( pool->SRCPoolHead != NULL ) {
+    pool->SRCPoolHead->SRCPoolPrev = resamp;
+  } else {
+    pool->SRCPoolTail = resamp;
+  }
+  pool->SRCPoolHead = resamp;
+
+  return XLAL_SUCCESS;
+
+} // XLALAcquireResampSRCPool()
+
+///
+/// Free the SRC-frame timeseries of an input using the pool, if they are allocated, and remove it from the pool's least-recently-used list
+///
+static void
+XLALReleaseResampSRCPool ( ResampMethodData *resamp )
+{
+  if ( resamp->SRCPool == NULL || !resamp->SRCResident ) {
+    return;
+  }
+
+  ResampWorkspace *pool = resamp->SRCPool;
+
+  if ( resamp->SRCPoolPrev != NULL ) {
+    resamp->SRCPoolPrev->SRCPoolNext = resamp->SRCPoolNext;
+  } else {
+    pool->SRCPoolHead = resamp->SRCPoolNext;
+  }
+  if ( resamp->SRCPoolNext != NULL ) {
+    resamp->SRCPoolNext->SRCPoolPrev = resamp->SRCPoolPrev;
+  } else {
+    pool->SRCPoolTail = resamp->SRCPoolPrev;
+  }
+  resamp->SRCPoolPrev = resamp->SRCPoolNext = NULL;
+
+  const UINT4 numDetectors = resamp->multiTimeSeries_SRC_a->length;
+  for ( UINT4 X = 0; X < numDetectors; X ++ )
+    {
+      XLALDestroyCOMPLEX8Sequence ( resamp->multiTimeSeries_SRC_a->data[X]->data );
+      resamp->multiTimeSeries_SRC_a->data[X]->data = NULL;
+      XLALDestroyCOMPLEX8Sequence ( resamp->multiTimeSeries_SRC_b->data[X]->data );
+      resamp->multiTimeSeries_SRC_b->data[X]->data = NULL;
+    }
+
+  pool->SRCPoolBytes -= resamp->SRCBytes;
+  resamp->SRCResident = 0;
+
+} // XLALReleaseResampSRCPool()
+
 static void
 XLALGetFFTPlanHints ( int * planMode,
                       double * planGenTimeoutSeconds
@@ -1152,13 +1934,21 @@ XLALGetFFTPlanHints ( int * planMode,
 } // XLALGetFFTPlanHints
 
 int
-XLALExtractResampledTimeseries_intern ( MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_a, MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_b, const void* method_data )
+XLALExtractResampledTimeseries_intern ( MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_a, MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_b, const FstatCommon *common, void* method_data )
 {
-  XLAL_CHECK ( method_data != NULL, XLAL_EINVAL );
   XLAL_CHECK ( ( multiTimeSeries_SRC_a != NULL ) && ( multiTimeSeries_SRC_b != NULL ) , XLAL_EINVAL );
+  XLAL_CHECK ( common != NULL, XLAL_EINVAL );
   XLAL_CHECK ( method_data != NULL, XLAL_EINVAL );
 
-  const ResampMethodData *resamp = (const ResampMethodData *) method_data;
+  ResampMethodData *resamp = (ResampMethodData *) method_data;
+
+  // if pooled SRC-frame timeseries have been freed from the pool, re-acquire and recompute them
+  if ( resamp->SRCPool != NULL && !resamp->SRCResident )
+    {
+      XLAL_CHECK ( resamp->timingGeneric.NBufferMisses > 0, XLAL_EINVAL, "SRC-frame timeseries have not yet been computed; call XLALComputeFstat() first\n" );
+      const PulsarDopplerParams prev_doppler = resamp->prev_doppler;
+      XLAL_CHECK ( XLALBarycentricResampleMultiCOMPLEX8TimeSeries ( resamp, &prev_doppler, common ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
   *multiTimeSeries_SRC_a = resamp->multiTimeSeries_SRC_a;
   *multiTimeSeries_SRC_b = resamp->multiTimeSeries_SRC_b;
 
@@ -1211,6 +2001,18 @@ XLALGetFstatTiming_Resamp ( const void *method_data, FstatTimingGeneric *timingG
   timingModel->names[i]  = "tau0_bary";
   timingModel->values[i] = tiRS->tau0_bary;
 
+  i++;
+  timingModel->names[i]  = "tau0_sinc";
+  timingModel->values[i] = tiRS->tau0_sinc;
+
+  i++;
+  timingModel->names[i]  = "tau0_sincos";
+  timingModel->values[i] = tiRS->tau0_sincos;
+
+  i++;
+  timingModel->names[i]  = "tau0_rotate";
+  timingModel->values[i] = tiRS->tau0_rotate;
+
   timingModel->numVariables = i+1;
   timingModel->help      = FstatTimingResampHelp;
 
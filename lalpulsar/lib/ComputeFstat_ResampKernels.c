@@ -0,0 +1,129 @@
+//
+// Copyright (C) 2026
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+// MA  02111-1307  USA
+//
+
+// this function definition 'template' requires the following to be set:
+// SINC_FUNC: the name of the windowed-sinc interpolation function
+// ROTATE_FUNC: the name of the phase-rotation function
+// and the following static functions to be defined:
+// UINT4 sinc_window_sum ( REAL4 *realSum, REAL4 *imagSum, const REAL4 *winDup, const REAL4 *xa, const REAL4 delta0, const UINT4 winLen ):
+//   sum over whole vectors of window samples of winDup[2*i] * xa[2*i + {0,1}] / ( delta0 - i ), and return the index of the first window sample not summed
+// UINT4 rotate_vectors ( COMPLEX8 *xOut, const COMPLEX8 *xIn, const REAL4 *sinphase, const REAL4 *cosphase, const UINT4 len ):
+//   rotate whole vectors of samples, and return the number of samples rotated
+
+#define OOPI		(1.0 / LAL_PI)
+#define LD_SMALL4	(2.0e-4)
+
+int SINC_FUNC ( COMPLEX8Vector *y_out, const REAL8Vector *t_out, const COMPLEX8TimeSeries *ts_in, const REAL4 *winDup, const UINT4 Dterms );
+int ROTATE_FUNC ( COMPLEX8 *xOut, const COMPLEX8 *xIn, const REAL4 *sinphase, const REAL4 *cosphase, const UINT4 len );
+
+///
+/// Windowed-sinc interpolation, equivalent to XLALSincInterpolateCOMPLEX8TimeSeries().
+/// \p winDup holds the Hamming window of length 2*Dterms+1 with alternating signs, each value repeated twice
+/// to match interleaved {re,im} samples.
+///
+int
+SINC_FUNC ( COMPLEX8Vector *y_out,		///< [out] output series of interpolated y-values [must be same size as t_out]
+            const REAL8Vector *t_out,		///< [in] output time-steps to interpolate input to
+            const COMPLEX8TimeSeries *ts_in,	///< [in] regularly-spaced input timeseries
+            const REAL4 *winDup,		///< [in] duplicated, sign-alternating window
+            const UINT4 Dterms			///< [in] window sinc kernel sum to +-Dterms around max
+            )
+{
+  XLAL_CHECK ( y_out != NULL && t_out != NULL && ts_in != NULL && winDup != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( y_out->length == t_out->length, XLAL_EINVAL );
+
+  const UINT4 numSamplesOut = t_out->length;
+  const UINT4 numSamplesIn = ts_in->data->length;
+  const COMPLEX8 *x_in = ts_in->data->data;
+  const REAL8 dt = ts_in->deltaT;
+  const REAL8 oodt = 1.0 / dt;
+  const REAL8 tmin = XLALGPSGetREAL8 ( &(ts_in->epoch) );
+  const UINT4 winLen = 2 * Dterms + 1;
+
+  for ( UINT4 l = 0; l < numSamplesOut; l ++ )
+    {
+      REAL8 t = t_out->data[l] - tmin;
+
+      // samples outside of input timeseries are returned as 0
+      if ( (t < 0) || (t > (numSamplesIn-1)*dt) )
+        {
+          y_out->data[l] = 0;
+          continue;
+        }
+
+      REAL8 t_by_dt = t * oodt;
+      INT8 jstar = lround ( t_by_dt );
+
+      if ( fabs ( t_by_dt - jstar ) < LD_SMALL4 )
+        {
+          y_out->data[l] = x_in[jstar];
+          continue;
+        }
+
+      // sin(pi delta_j) and signs are taken relative to the first window sample j0 = j* - Dterms
+      INT8 jStart0 = jstar - Dterms;
+      REAL4 delta0 = (t_by_dt - jStart0);
+      REAL4 sin0, cos0;
+      XLALSinCosLUT ( &sin0, &cos0, LAL_PI * delta0 );
+
+      // window samples [iStart, iEnd) lie within the input timeseries; only a full window is vectorised
+      const UINT4 iStart = ( jStart0 < 0 ) ? (UINT4) ( -jStart0 ) : 0;
+      const INT8 iEnd0 = ( (INT8) numSamplesIn ) - jStart0;
+      const UINT4 iEnd = ( iEnd0 < winLen ) ? (UINT4) iEnd0 : winLen;
+      REAL4 realSum = 0, imagSum = 0;
+      UINT4 i = iStart;
+      if ( iStart == 0 && iEnd == winLen )
+        {
+          i = sinc_window_sum ( &realSum, &imagSum, winDup, (const REAL4 *) ( x_in + jStart0 ), delta0, winLen );
+        }
+      for ( ; i < iEnd; i ++ )
+        {
+          REAL4 w = winDup[2*i] / ( delta0 - i );
+          realSum += w * crealf ( x_in[jStart0 + i] );
+          imagSum += w * cimagf ( x_in[jStart0 + i] );
+        }
+
+      REAL4 sin0oopi = sin0 * OOPI;
+      y_out->data[l] = crectf ( sin0oopi * realSum, sin0oopi * imagSum );
+
+    } // for l < numSamplesOut
+
+  return XLAL_SUCCESS;
+
+} // SINC_FUNC()
+
+///
+/// Multiply a complex timeseries by the phase factors (cosphase + i sinphase)
+///
+int
+ROTATE_FUNC ( COMPLEX8 *xOut,		///< [out] rotated timeseries (may be the same as xIn)
+              const COMPLEX8 *xIn,	///< [in] timeseries to rotate
+              const REAL4 *sinphase,	///< [in] sine of phase
+              const REAL4 *cosphase,	///< [in] cosine of phase
+              const UINT4 len		///< [in] number of samples
+              )
+{
+  for ( UINT4 j = rotate_vectors ( xOut, xIn, sinphase, cosphase, len ); j < len; j ++ )
+    {
+      xOut[j] = crectf ( cosphase[j], sinphase[j] ) * xIn[j];
+    }
+
+  return XLAL_SUCCESS;
+
+} // ROTATE_FUNC()
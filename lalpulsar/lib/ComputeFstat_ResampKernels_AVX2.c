@@ -0,0 +1,77 @@
+//
+// Copyright (C) 2026
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+// MA  02111-1307  USA
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include <immintrin.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Date.h>
+#include <lal/SinCosLUT.h>
+#include <lal/TimeSeries.h>
+
+///
+/// \file ComputeFstat_ResampKernels_AVX2.c
+/// \ingroup ComputeFstat_Resamp_c
+/// \brief AVX2 kernels for windowed-sinc interpolation and phase rotation of SRC-frame timeseries,
+/// processing 4 complex samples per vector
+///
+
+static inline UINT4
+sinc_window_sum ( REAL4 *realSum, REAL4 *imagSum, const REAL4 *winDup, const REAL4 *xa, const REAL4 delta0, const UINT4 winLen )
+{
+  const __m256 four = _mm256_set1_ps ( 4.0f );
+  __m256 delta = _mm256_sub_ps ( _mm256_set1_ps ( delta0 ), _mm256_setr_ps ( 0.0f, 0.0f, 1.0f, 1.0f, 2.0f, 2.0f, 3.0f, 3.0f ) );
+  __m256 sum = _mm256_setzero_ps();
+  UINT4 i = 0;
+  for ( ; i + 4 <= winLen; i += 4 )
+    {
+      __m256 w = _mm256_div_ps ( _mm256_loadu_ps ( winDup + 2*i ), delta );
+      sum = _mm256_add_ps ( sum, _mm256_mul_ps ( w, _mm256_loadu_ps ( xa + 2*i ) ) );
+      delta = _mm256_sub_ps ( delta, four );
+    }
+  REAL4 sums[8] __attribute__ ((aligned (32)));
+  _mm256_store_ps ( sums, sum );
+  *realSum = ( sums[0] + sums[2] ) + ( sums[4] + sums[6] );
+  *imagSum = ( sums[1] + sums[3] ) + ( sums[5] + sums[7] );
+  return i;
+}
+
+static inline UINT4
+rotate_vectors ( COMPLEX8 *xOut, const COMPLEX8 *xIn, const REAL4 *sinphase, const REAL4 *cosphase, const UINT4 len )
+{
+  UINT4 j = 0;
+  for ( ; j + 4 <= len; j += 4 )
+    {
+      const __m128 c = _mm_loadu_ps ( cosphase + j );
+      const __m128 s = _mm_loadu_ps ( sinphase + j );
+      const __m256 cc = _mm256_insertf128_ps ( _mm256_castps128_ps256 ( _mm_unpacklo_ps ( c, c ) ), _mm_unpackhi_ps ( c, c ), 1 );
+      const __m256 ss = _mm256_insertf128_ps ( _mm256_castps128_ps256 ( _mm_unpacklo_ps ( s, s ) ), _mm_unpackhi_ps ( s, s ), 1 );
+      const __m256 x = _mm256_loadu_ps ( (const REAL4 *) ( xIn + j ) );
+      const __m256 xswap = _mm256_permute_ps ( x, 0xB1 );	// {im,re} pairs
+      // {c*re - s*im, c*im + s*re}
+      _mm256_storeu_ps ( (REAL4 *) ( xOut + j ), _mm256_addsub_ps ( _mm256_mul_ps ( cc, x ), _mm256_mul_ps ( ss, xswap ) ) );
+    }
+  return j;
+}
+
+#define SINC_FUNC XLALSincInterpolateCOMPLEX8_AVX2
+#define ROTATE_FUNC XLALRotateCOMPLEX8_AVX2
+#include "ComputeFstat_ResampKernels.c"
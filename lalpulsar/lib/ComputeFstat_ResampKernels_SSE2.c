@@ -0,0 +1,78 @@
+//
+// Copyright (C) 2026
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+// MA  02111-1307  USA
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include <emmintrin.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Date.h>
+#include <lal/SinCosLUT.h>
+#include <lal/TimeSeries.h>
+
+///
+/// \file ComputeFstat_ResampKernels_SSE2.c
+/// \ingroup ComputeFstat_Resamp_c
+/// \brief SSE2 kernels for windowed-sinc interpolation and phase rotation of SRC-frame timeseries,
+/// processing 2 complex samples per vector
+///
+
+static inline UINT4
+sinc_window_sum ( REAL4 *realSum, REAL4 *imagSum, const REAL4 *winDup, const REAL4 *xa, const REAL4 delta0, const UINT4 winLen )
+{
+  const __m128 two = _mm_set1_ps ( 2.0f );
+  __m128 delta = _mm_sub_ps ( _mm_set1_ps ( delta0 ), _mm_setr_ps ( 0.0f, 0.0f, 1.0f, 1.0f ) );
+  __m128 sum = _mm_setzero_ps();
+  UINT4 i = 0;
+  for ( ; i + 2 <= winLen; i += 2 )
+    {
+      __m128 w = _mm_div_ps ( _mm_loadu_ps ( winDup + 2*i ), delta );
+      sum = _mm_add_ps ( sum, _mm_mul_ps ( w, _mm_loadu_ps ( xa + 2*i ) ) );
+      delta = _mm_sub_ps ( delta, two );
+    }
+  REAL4 sums[4] __attribute__ ((aligned (16)));
+  _mm_store_ps ( sums, sum );
+  *realSum = sums[0] + sums[2];
+  *imagSum = sums[1] + sums[3];
+  return i;
+}
+
+static inline UINT4
+rotate_vectors ( COMPLEX8 *xOut, const COMPLEX8 *xIn, const REAL4 *sinphase, const REAL4 *cosphase, const UINT4 len )
+{
+  const __m128 signs = _mm_setr_ps ( -1.0f, 1.0f, -1.0f, 1.0f );
+  UINT4 j = 0;
+  for ( ; j + 2 <= len; j += 2 )
+    {
+      const __m128 c = _mm_castpd_ps ( _mm_load_sd ( (const double *) ( cosphase + j ) ) );
+      const __m128 s = _mm_castpd_ps ( _mm_load_sd ( (const double *) ( sinphase + j ) ) );
+      const __m128 cc = _mm_unpacklo_ps ( c, c );
+      const __m128 ss = _mm_mul_ps ( _mm_unpacklo_ps ( s, s ), signs );
+      const __m128 x = _mm_loadu_ps ( (const REAL4 *) ( xIn + j ) );
+      const __m128 xswap = _mm_shuffle_ps ( x, x, _MM_SHUFFLE ( 2, 3, 0, 1 ) );	// {im,re} pairs
+      // {c*re - s*im, c*im + s*re}
+      _mm_storeu_ps ( (REAL4 *) ( xOut + j ), _mm_add_ps ( _mm_mul_ps ( cc, x ), _mm_mul_ps ( ss, xswap ) ) );
+    }
+  return j;
+}
+
+#define SINC_FUNC XLALSincInterpolateCOMPLEX8_SSE2
+#define ROTATE_FUNC XLALRotateCOMPLEX8_SSE2
+#include "ComputeFstat_ResampKernels.c"
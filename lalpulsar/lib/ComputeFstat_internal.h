@@ -66,12 +66,19 @@ typedef struct {
   int (*compute_func) (					// F-statistic method computation function
     FstatResults *, const FstatCommon *, void *
     );
+  int (*compute_batch_func) (				// Optional F-statistic method function which computes a batch of
+    FstatResults **, const UINT4, const FstatCommon *, void *	// results with the same sky position and binary orbital parameters
+    );
   void (*method_data_destroy_func) ( void * );		// F-statistic method data destructor function
   void (*workspace_destroy_func) ( void * );		// Workspace destructor function
+  int (*worker_func) (					// Optional function which creates method data for a worker of an input,
+    void **, FstatCommon *, const void *		// see XLALFstatInputWorker()
+    );
+  void (*worker_destroy_func) ( void * );		// Worker method data destructor function
 } FstatMethodFuncs;
 
 // ---------- Shared internal functions ---------- //
-int XLALExtractResampledTimeseries_intern ( MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_a, MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_b, const void* method_data );
+int XLALExtractResampledTimeseries_intern ( MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_a, MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_b, const FstatCommon *common, void* method_data );
 int XLALGetFstatTiming_Demod  ( const void *method_data, FstatTimingGeneric *timingGeneric, FstatTimingModel *timingModel );
 int XLALGetFstatTiming_Resamp ( const void *method_data, FstatTimingGeneric *timingGeneric, FstatTimingModel *timingModel );
 void *XLALFstatInputTimeslice_Demod ( const void *method_data, const UINT4 iStart[PULSAR_MAX_DETECTORS], const UINT4 iEnd[PULSAR_MAX_DETECTORS] );
@@ -52,8 +52,11 @@
  */
 
 /*---------- INCLUDES ----------*/
+#include <config.h>
+
 #include <lal/LALComputeAM.h>
 #include <lal/SinCosLUT.h>
+#include <lal/LALSIMD.h>
 
 /*---------- local DEFINES and macros ----------*/
 
@@ -64,9 +67,28 @@ static REAL4 AntennaPatternIllCondDeterminant = INFINITY;
 
 /*---------- internal types ----------*/
 
+/* Detector-tensor components of a single detector, stored as structure-of-arrays in the order
+ * {d11, d12, d13, d22, d23, d33}. The antenna-pattern coefficients a(t_i), b(t_i) computed by
+ * XLALComputeAMCoeffs() are linear combinations of these components, with sky-dependent coefficients.
+ */
+typedef struct tagAMCoeffsPlanSeries {
+  UINT4 length;			/* number of timestamps */
+  REAL4 *block;			/* memory block holding all arrays below */
+  REAL4 *d[6];			/* detector-tensor components */
+} AMCoeffsPlanSeries;
+
+struct tagMultiAMCoeffsPlan {
+  UINT4 length;			/* number of detectors */
+  AMCoeffsPlanSeries *data;	/* detector-tensor components for each detector */
+};
+
 /*---------- internal prototypes ----------*/
 static inline REAL4 estimateAntennaPatternConditionNumber ( REAL4 A, REAL4 B, REAL4 C, REAL4 E );
 
+#ifdef HAVE_AVX2_COMPILER
+int XLALAMCoeffsBatchKernel_AVX2 ( REAL4 *a, REAL4 *b, const REAL4 qa[6], const REAL4 qb[6], REAL4 *const d[6], const UINT4 length );
+#endif
+
 /*==================== FUNCTION DEFINITIONS ====================*/
 
 /**
@@ -433,6 +455,185 @@ XLALComputeMultiAMCoeffs ( const MultiDetectorStateSeries *multiDetStates, 	/**<
 
 } /* XLALComputeMultiAMCoeffs() */
 
+/**
+ * Precompute the sky-independent quantities required to compute antenna-pattern coefficients
+ * for the given detector-states, for use with XLALComputeMultiAMCoeffsBatch().
+ *
+ * \note The plan is allocated here, use XLALDestroyMultiAMCoeffsPlan() to free this.
+ */
+MultiAMCoeffsPlan *
+XLALCreateMultiAMCoeffsPlan ( const MultiDetectorStateSeries *multiDetStates 	/**< [in] detector-states at timestamps t_i */
+                              )
+{
+  XLAL_CHECK_NULL ( multiDetStates != NULL, XLAL_EINVAL, "Invalid NULL input argument 'multiDetStates'\n" );
+
+  const UINT4 numDetectors = multiDetStates->length;
+
+  MultiAMCoeffsPlan *ret = XLALCalloc ( 1, sizeof( *ret ) );
+  XLAL_CHECK_NULL ( ret != NULL, XLAL_ENOMEM, "Failed to XLALCalloc( 1, %zu)\n", sizeof( *ret ) );
+  ret->length = numDetectors;
+  ret->data = XLALCalloc ( numDetectors, sizeof ( *ret->data ) );
+  if ( ret->data == NULL ) {
+    XLALFree ( ret );
+    XLAL_ERROR_NULL ( XLAL_ENOMEM, "Failed to XLALCalloc(%d, %zu)\n", numDetectors, sizeof ( *ret->data ) );
+  }
+
+  for ( UINT4 X = 0; X < numDetectors; X ++ )
+    {
+      const DetectorStateSeries *DetectorStates = multiDetStates->data[X];
+      AMCoeffsPlanSeries *series = &ret->data[X];
+      const UINT4 numSteps = DetectorStates->length;
+      series->length = numSteps;
+      if ( ( series->block = XLALCalloc ( 6 * numSteps + 1, sizeof ( series->block[0] ) ) ) == NULL ) {
+        XLALDestroyMultiAMCoeffsPlan ( ret );
+        XLAL_ERROR_NULL ( XLAL_ENOMEM, "Failed to XLALCalloc(%d, %zu)\n", 6 * numSteps + 1, sizeof ( series->block[0] ) );
+      }
+      for ( UINT4 k = 0; k < 6; k ++ )
+        {
+          series->d[k] = series->block + k * numSteps;
+        }
+      for ( UINT4 i = 0; i < numSteps; i ++ )
+        {
+          const SymmTensor3 *d = &(DetectorStates->data[i].detT);
+          series->d[0][i] = d->d11;
+          series->d[1][i] = d->d12;
+          series->d[2][i] = d->d13;
+          series->d[3][i] = d->d22;
+          series->d[4][i] = d->d23;
+          series->d[5][i] = d->d33;
+        }
+    } /* for X < numDetectors */
+
+  return ret;
+
+} /* XLALCreateMultiAMCoeffsPlan() */
+
+/* compute a(t_i) = sum_k qa[k] d[k][i] and b(t_i) = sum_k qb[k] d[k][i] for one sky-position */
+static int
+XLALAMCoeffsBatchKernel ( REAL4 *a, REAL4 *b, const REAL4 qa[6], const REAL4 qb[6], REAL4 *const d[6], const UINT4 length )
+{
+
+#ifdef HAVE_AVX2_COMPILER
+  if ( LAL_HAVE_AVX2_RUNTIME() )
+    {
+      XLAL_CHECK ( XLALAMCoeffsBatchKernel_AVX2 ( a, b, qa, qb, d, length ) == XLAL_SUCCESS, XLAL_EFUNC );
+      return XLAL_SUCCESS;
+    }
+#endif
+
+  for ( UINT4 i = 0; i < length; i ++ )
+    {
+      a[i] = qa[0] * d[0][i] + qa[1] * d[1][i] + qa[2] * d[2][i] + qa[3] * d[3][i] + qa[4] * d[4][i] + qa[5] * d[5][i];
+      b[i] = qb[0] * d[0][i] + qb[1] * d[1][i] + qb[2] * d[2][i] + qb[3] * d[3][i] + qb[4] * d[4][i];
+    }
+
+  return XLAL_SUCCESS;
+
+} /* XLALAMCoeffsBatchKernel() */
+
+/**
+ * Batched version of XLALComputeMultiAMCoeffs().
+ * Computes noise-weighted combined multi-IFO antenna pattern functions for each of many sky-positions,
+ * using the detector-tensor components precomputed by XLALCreateMultiAMCoeffsPlan(). For each sky-position,
+ * a(t) and b(t) are computed with vectorized loops over timestamps, and agree with those of
+ * XLALComputeMultiAMCoeffs() to within REAL4 rounding errors.
+ *
+ * \note The output-vector \a multiAMcoef has one element for each sky-position; NULL elements are allocated here,
+ * and non-NULL elements (e.g. from a previous call) are re-used. Use XLALDestroyMultiAMCoeffs() to free each element.
+ * An input of multiWeights = NULL corresponds to unit-weights.
+ */
+int
+XLALComputeMultiAMCoeffsBatch ( MultiAMCoeffs **multiAMcoef,			/**< [in/out] antenna-pattern coefficients for each sky-position */
+                                const MultiAMCoeffsPlan *plan,			/**< [in] sky-independent quantities from XLALCreateMultiAMCoeffsPlan() */
+                                const MultiNoiseWeights *multiWeights,		/**< [in] noise-weigths at timestamps t_i (can be NULL) */
+                                const SkyPosition *skypos,			/**< [in] source sky-positions [in equatorial coords!] */
+                                UINT4 numSkyPoints				/**< [in] number of sky-positions */
+                                )
+{
+  XLAL_CHECK ( multiAMcoef != NULL, XLAL_EINVAL, "Invalid NULL input argument 'multiAMcoef'\n" );
+  XLAL_CHECK ( plan != NULL, XLAL_EINVAL, "Invalid NULL input argument 'plan'\n" );
+  XLAL_CHECK ( skypos != NULL, XLAL_EINVAL, "Invalid NULL input argument 'skypos'\n" );
+
+  const UINT4 numDetectors = plan->length;
+
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      /* currently requires sky-pos to be in equatorial coordinates (FIXME) */
+      XLAL_CHECK ( skypos[s].system == COORDINATESYSTEM_EQUATORIAL, XLAL_EINVAL, "Only equatorial coordinates currently supported in 'skypos[%d]'\n", s );
+
+      /* allocate or check output */
+      if ( multiAMcoef[s] == NULL )
+        {
+          XLAL_CHECK ( ( multiAMcoef[s] = XLALCalloc ( 1, sizeof( *multiAMcoef[s] ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc( 1, %zu)\n", sizeof( *multiAMcoef[s] ) );
+          multiAMcoef[s]->length = numDetectors;
+          XLAL_CHECK ( ( multiAMcoef[s]->data = XLALCalloc ( numDetectors, sizeof ( *multiAMcoef[s]->data ) ) ) != NULL, XLAL_ENOMEM,
+                       "Failed to XLALCalloc(%d, %zu)\n", numDetectors, sizeof ( *multiAMcoef[s]->data ) );
+          for ( UINT4 X = 0; X < numDetectors; X ++ )
+            {
+              XLAL_CHECK ( ( multiAMcoef[s]->data[X] = XLALCreateAMCoeffs ( plan->data[X].length ) ) != NULL, XLAL_EFUNC );
+            }
+        }
+      else
+        {
+          XLAL_CHECK ( multiAMcoef[s]->length == numDetectors, XLAL_EINVAL, "Inconsistent number of detectors in multiAMcoef[%d]: %d != %d\n", s, multiAMcoef[s]->length, numDetectors );
+          for ( UINT4 X = 0; X < numDetectors; X ++ )
+            {
+              const AMCoeffs *coeffs = multiAMcoef[s]->data[X];
+              XLAL_CHECK ( coeffs != NULL && coeffs->a != NULL && coeffs->b != NULL, XLAL_EINVAL, "Invalid NULL AM-coeffs in multiAMcoef[%d]->data[%d]\n", s, X );
+              XLAL_CHECK ( coeffs->a->length == plan->data[X].length && coeffs->b->length == plan->data[X].length, XLAL_EINVAL,
+                           "Inconsistent number of timestamps in multiAMcoef[%d]->data[%d]\n", s, X );
+            }
+        }
+
+      /*---------- We write components of xi and eta vectors in SSB-fixed coords, as in XLALComputeAMCoeffs() */
+      REAL4 alpha = skypos[s].longitude;
+      REAL4 delta = skypos[s].latitude;
+
+      REAL4 sin1delta, cos1delta;
+      REAL4 sin1alpha, cos1alpha;
+      XLAL_CHECK( XLALSinCosLUT (&sin1delta, &cos1delta, delta ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK( XLALSinCosLUT (&sin1alpha, &cos1alpha, alpha ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      REAL4 xi1 = - sin1alpha;
+      REAL4 xi2 =  cos1alpha;
+      REAL4 eta1 = sin1delta * cos1alpha;
+      REAL4 eta2 = sin1delta * sin1alpha;
+      REAL4 eta3 = - cos1delta;
+
+      /* coefficients of {d11, d12, d13, d22, d23, d33} in a(t_i) and b(t_i) */
+      const REAL4 qa[6] = {
+        xi1 * xi1 - eta1 * eta1,
+        2 * ( xi1*xi2 - eta1*eta2 ),
+        - 2 * eta1 * eta3,
+        xi2*xi2 - eta2*eta2,
+        - 2 * eta2 * eta3,
+        - eta3*eta3
+      };
+      const REAL4 qb[6] = {
+        2 * xi1 * eta1,
+        2 * ( xi1 * eta2 + xi2 * eta1 ),
+        2 * xi1 * eta3,
+        2 * xi2 * eta2,
+        2 * xi2 * eta3,
+        0
+      };
+
+      /*---------- Compute the a(t_i) and b(t_i) ---------- */
+      for ( UINT4 X = 0; X < numDetectors; X ++ )
+        {
+          AMCoeffs *coeffs = multiAMcoef[s]->data[X];
+          XLAL_CHECK ( XLALAMCoeffsBatchKernel ( coeffs->a->data, coeffs->b->data, qa, qb, plan->data[X].d, plan->data[X].length ) == XLAL_SUCCESS, XLAL_EFUNC );
+        }
+
+      /* apply noise-weights and compute antenna-pattern matrix {A,B,C} */
+      XLAL_CHECK ( XLALWeightMultiAMCoeffs ( multiAMcoef[s], multiWeights ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    } /* for s < numSkyPoints */
+
+  return XLAL_SUCCESS;
+
+} /* XLALComputeMultiAMCoeffsBatch() */
+
 
 /* ---------- creators/destructors for AM-coeffs -------------------- */
 /**
@@ -518,6 +719,33 @@ XLALDestroyAMCoeffs ( AMCoeffs *amcoef )
 
 } /* XLALDestroyAMCoeffs() */
 
+/**
+ * Destroy a MultiAMCoeffsPlan structure.
+ *
+ * \note This function is "NULL-robust" in the sense that it will not crash
+ * on NULL-entries anywhere in this struct, so it can be used
+ * for failure-cleanup even on incomplete structs
+ */
+void
+XLALDestroyMultiAMCoeffsPlan ( MultiAMCoeffsPlan *plan )
+{
+  if ( ! plan )
+    return;
+
+  if ( plan->data )
+    {
+      for ( UINT4 X = 0; X < plan->length; X ++ )
+        {
+          XLALFree ( plan->data[X].block );
+        }
+      XLALFree ( plan->data );
+    }
+  XLALFree ( plan );
+
+  return;
+
+} /* XLALDestroyMultiAMCoeffsPlan() */
+
 /// estimate condition number for given antenna-pattern matrix
 static inline REAL4
 estimateAntennaPatternConditionNumber ( REAL4 A, REAL4 B, REAL4 C, REAL4 E )
@@ -141,6 +141,10 @@ typedef struct tagMultiAMCoeffs {
   AntennaPatternMatrix Mmunu;	/**< antenna-pattern matrix \f$\mathcal{M}_{\mu\nu}\f$ */
 } MultiAMCoeffs;
 
+/** Sky-independent quantities precomputed from a set of detector-states by XLALCreateMultiAMCoeffsPlan(),
+ * for computing the antenna-pattern coefficients of many sky-positions with XLALComputeMultiAMCoeffsBatch()
+ */
+typedef struct tagMultiAMCoeffsPlan MultiAMCoeffsPlan;
 
 /*---------- exported Global variables ----------*/
 
@@ -153,6 +157,12 @@ int XLALWeightMultiAMCoeffs (  MultiAMCoeffs *multiAMcoef, const MultiNoiseWeigh
 AMCoeffs *XLALComputeAMCoeffs ( const DetectorStateSeries *DetectorStates, SkyPosition skypos );
 MultiAMCoeffs *XLALComputeMultiAMCoeffs ( const MultiDetectorStateSeries *multiDetStates, const MultiNoiseWeights *multiWeights, SkyPosition skypos );
 
+MultiAMCoeffsPlan *XLALCreateMultiAMCoeffsPlan ( const MultiDetectorStateSeries *multiDetStates );
+#ifndef SWIG // exclude from SWIG interface
+int XLALComputeMultiAMCoeffsBatch ( MultiAMCoeffs **multiAMcoef, const MultiAMCoeffsPlan *plan, const MultiNoiseWeights *multiWeights, const SkyPosition *skypos, UINT4 numSkyPoints );
+#endif // SWIG
+void XLALDestroyMultiAMCoeffsPlan ( MultiAMCoeffsPlan *plan );
+
 AMCoeffs *XLALCreateAMCoeffs ( UINT4 numSteps );
 void XLALDestroyMultiAMCoeffs ( MultiAMCoeffs *multiAMcoef );
 void XLALDestroyAMCoeffs ( AMCoeffs *amcoef );
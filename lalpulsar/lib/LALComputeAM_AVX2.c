@@ -0,0 +1,80 @@
+//
+// Copyright (C) 2026
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+// MA  02111-1307  USA
+//
+
+#include <immintrin.h>
+
+#include <lal/LALStdlib.h>
+
+///
+/// \file LALComputeAM_AVX2.c
+/// \ingroup LALComputeAM_h
+/// \brief AVX2 kernel for computing antenna-pattern coefficients of a sky-position from precomputed detector-tensors
+///
+
+int XLALAMCoeffsBatchKernel_AVX2 ( REAL4 *a, REAL4 *b, const REAL4 qa[6], const REAL4 qb[6], REAL4 *const d[6], const UINT4 length );
+
+///
+/// Compute the antenna-pattern coefficients \f$a(t_i) = \sum_k q^a_k d_k(t_i)\f$ and \f$b(t_i) = \sum_k q^b_k d_k(t_i)\f$,
+/// where \f$d_k\f$ are the detector-tensor components, for 8 timestamps at a time, as in XLALComputeMultiAMCoeffsBatch().
+///
+int
+XLALAMCoeffsBatchKernel_AVX2 ( REAL4 *a,		///< [out] antenna-pattern coefficients a(t_i)
+                               REAL4 *b,		///< [out] antenna-pattern coefficients b(t_i)
+                               const REAL4 qa[6],	///< [in] sky-dependent coefficients of a(t_i)
+                               const REAL4 qb[6],	///< [in] sky-dependent coefficients of b(t_i); qb[5] must be zero
+                               REAL4 *const d[6],	///< [in] detector-tensor components {d11, d12, d13, d22, d23, d33}
+                               const UINT4 length	///< [in] number of timestamps
+                               )
+{
+  __m256 va[6], vb[5];
+  for ( UINT4 k = 0; k < 6; k ++ )
+    {
+      va[k] = _mm256_set1_ps ( qa[k] );
+    }
+  for ( UINT4 k = 0; k < 5; k ++ )
+    {
+      vb[k] = _mm256_set1_ps ( qb[k] );
+    }
+
+  UINT4 i = 0;
+  for ( ; i + 8 <= length; i += 8 )
+    {
+      __m256 sa = _mm256_mul_ps ( va[0], _mm256_loadu_ps ( d[0] + i ) );
+      __m256 sb = _mm256_mul_ps ( vb[0], _mm256_loadu_ps ( d[0] + i ) );
+      for ( UINT4 k = 1; k < 5; k ++ )
+        {
+          const __m256 dk = _mm256_loadu_ps ( d[k] + i );
+          sa = _mm256_add_ps ( sa, _mm256_mul_ps ( va[k], dk ) );
+          sb = _mm256_add_ps ( sb, _mm256_mul_ps ( vb[k], dk ) );
+        }
+      sa = _mm256_add_ps ( sa, _mm256_mul_ps ( va[5], _mm256_loadu_ps ( d[5] + i ) ) );
+      _mm256_storeu_ps ( a + i, sa );
+      _mm256_storeu_ps ( b + i, sb );
+    }
+
+  // take care of remaining timestamps, length modulo 8
+  for ( ; i < length; i ++ )
+    {
+      a[i] = qa[0] * d[0][i] + qa[1] * d[1][i] + qa[2] * d[2][i] + qa[3] * d[3][i] + qa[4] * d[4][i] + qa[5] * d[5][i];
+      b[i] = qb[0] * d[0][i] + qb[1] * d[1][i] + qb[2] * d[2][i] + qb[3] * d[3][i] + qb[4] * d[4][i];
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALAMCoeffsBatchKernel_AVX2()
@@ -30,6 +30,14 @@
 #include <lal/MetricUtils.h>
 #include <lal/GSLHelpers.h>
 
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#endif
+
 #ifdef __GNUC__
 #define UNUSED __attribute__ ((unused))
 #else
@@ -123,6 +131,8 @@ struct tagLatticeTilingIterator {
   INT4 *int_upper;                      ///< Current upper parameter-space bound in generating integers
   INT4 *direction;                      ///< Direction of iteration in each tiled parameter-space dimension
   UINT8 index;                          ///< Index of current lattice tiling point
+  UINT8 index_begin;                    ///< Index of first lattice tiling point in iterator range
+  UINT8 index_end;                      ///< Index of one past last lattice tiling point in iterator range
 };
 
 struct tagLatticeTilingLocator {
@@ -295,6 +305,190 @@ static void LT_FindBoundExtrema(
 
 }
 
+///
+/// Reset the parameter-space bounds of a lattice tiling iterator in dimensions 'reset_ti' and
+/// higher, and recompute its physical point in dimensions 'changed_ti' and higher.
+///
+static int LT_ResetIteratorPoint(
+  LatticeTilingIterator *itr,           ///< [in] Lattice tiling iterator
+  const size_t changed_ti,              ///< [in] Lowest tiled dimension in which the point has changed
+  const size_t reset_ti                 ///< [in] Lowest tiled dimension in which the bounds need to be reset
+  )
+{
+
+  const size_t n = itr->tiling->ndim;
+  const size_t tn = itr->tiling->tiled_ndim;
+
+  for ( size_t i = 0, ti = 0; i < n; ++i ) {
+
+    // Get bound information for this dimension
+    const LT_Bound *bound = &itr->tiling->bounds[i];
+
+    // Get physical parameter-space origin in the current dimension
+    const double phys_origin_i = gsl_vector_get( itr->tiling->phys_origin, i );
+
+    // If not tiled, set current physical point to non-tiled parameter-space bound
+    if ( !bound->is_tiled && ti >= reset_ti ) {
+      double phys_lower = 0, phys_upper = 0;
+      LT_CallBoundFunc( itr->tiling, i, itr->phys_point_cache, itr->phys_point, &phys_lower, &phys_upper );
+      LT_SetPhysPoint( itr->tiling, itr->phys_point_cache, itr->phys_point, i, phys_lower );
+    }
+
+    // If tiled, reset parameter-space bounds
+    if ( bound->is_tiled && ti >= reset_ti ) {
+
+      // Find the extrema of the parameter-space bounds on the current dimension
+      gsl_vector_memcpy( itr->phys_sampl, itr->phys_point );
+      double phys_lower = GSL_POSINF, phys_upper = GSL_NEGINF;
+      LT_FindBoundExtrema( itr->tiling, 0, i, itr->phys_sampl_cache, itr->phys_sampl, &phys_lower, &phys_upper );
+
+      // Add padding of half the extext of the metric ellipse bounding box, if requested
+      {
+        const double phys_hbbox_i = 0.5 * gsl_vector_get( itr->tiling->phys_bbox, i );
+        if ( bound->padf & LATTICE_TILING_PAD_LHBBX ) {
+          phys_lower -= phys_hbbox_i;
+        }
+        if ( bound->padf & LATTICE_TILING_PAD_UHBBX ) {
+          phys_upper += phys_hbbox_i;
+        }
+      }
+
+      // Transform physical point in lower dimensions to generating integer offset
+      double int_from_phys_point_i = 0;
+      for ( size_t j = 0; j < i; ++j ) {
+        const double int_from_phys_i_j = gsl_matrix_get( itr->tiling->int_from_phys, i, j );
+        const double phys_point_j = gsl_vector_get( itr->phys_point, j );
+        const double phys_origin_j = gsl_vector_get( itr->tiling->phys_origin, j );
+        int_from_phys_point_i += int_from_phys_i_j * ( phys_point_j - phys_origin_j );
+      }
+
+      {
+        // Transform physical bounds to generating integers
+        const double int_from_phys_i_i = gsl_matrix_get( itr->tiling->int_from_phys, i, i );
+        const double dbl_int_lower_i = int_from_phys_point_i + int_from_phys_i_i * ( phys_lower - phys_origin_i );
+        const double dbl_int_upper_i = int_from_phys_point_i + int_from_phys_i_i * ( phys_upper - phys_origin_i );
+
+        // Compute integer lower/upper bounds, rounded up/down to avoid extra boundary points
+        feclearexcept( FE_ALL_EXCEPT );
+        const INT4 int_lower_i = lround( ceil( dbl_int_lower_i ) );
+        const INT4 int_upper_i = lround( floor( dbl_int_upper_i ) );
+        XLAL_CHECK( fetestexcept( FE_INVALID ) == 0, XLAL_EFAILED, "Integer bounds on dimension #%zu are too large: %0.2e to %0.2e", i, dbl_int_lower_i, dbl_int_upper_i );
+
+        // Set integer lower/upper bounds
+        itr->int_lower[ti] = int_lower_i;
+        itr->int_upper[ti] = GSL_MAX( int_lower_i, int_upper_i );
+
+        // Add padding of one integer point, if requested
+        if ( bound->padf & LATTICE_TILING_PAD_LINTP ) {
+          itr->int_lower[ti] -= 1;
+        }
+        if ( bound->padf & LATTICE_TILING_PAD_UINTP ) {
+          itr->int_upper[ti] += 1;
+        }
+      }
+      const INT4 int_lower_i = itr->int_lower[ti];
+      const INT4 int_upper_i = itr->int_upper[ti];
+
+      // Get iteration direction
+      INT4 direction = itr->direction[ti];
+
+      // Only switch iteration direction:
+      // - if this is an alternating iterator
+      // - if iterator is in progress
+      // - for iterated-over dimensions
+      // - if there is more than one point in this dimension
+      if ( itr->alternating && ( itr->state > 0 ) && ( ti < itr->tiled_itr_ndim ) && ( int_lower_i < int_upper_i ) ) {
+        direction = -direction;
+        itr->direction[ti] = direction;
+      }
+
+      // Set integer point to:
+      // - lower or upper bound (depending on current direction) for iterated-over dimensions
+      // - mid-point of integer bounds for non-iterated dimensions
+      if ( ti < itr->tiled_itr_ndim ) {
+        itr->int_point[ti] = ( direction > 0 ) ? int_lower_i : int_upper_i;
+      } else {
+        itr->int_point[ti] = ( int_lower_i + int_upper_i ) / 2;
+      }
+
+    }
+
+    // If tiled, recompute current physical point from integer point
+    if ( bound->is_tiled && ti >= changed_ti ) {
+      double phys_point_i = phys_origin_i;
+      for ( size_t tj = 0; tj < tn; ++tj ) {
+        const size_t j = itr->tiling->tiled_idx[tj];
+        const double phys_from_int_i_j = gsl_matrix_get( itr->tiling->phys_from_int, i, j );
+        const INT4 int_point_tj = itr->int_point[tj];
+        phys_point_i += phys_from_int_i_j * int_point_tj;
+      }
+      LT_SetPhysPoint( itr->tiling, itr->phys_point_cache, itr->phys_point, i, phys_point_i );
+    }
+
+    // Increment tiled dimension index
+    if ( bound->is_tiled ) {
+      ++ti;
+    }
+
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Move a lattice tiling iterator, which must be at its first point and iterating from lower to
+/// upper bounds, forward to the point with the given index. The points are skipped one block of
+/// the highest iterated tiled dimension at a time. Returns 1 if the point was found, 0 if there
+/// are fewer points in the tiling than the given index, and XLAL_FAILURE on error.
+///
+static int LT_SeekIterator(
+  LatticeTilingIterator *itr,           ///< [in] Lattice tiling iterator
+  const UINT8 index                     ///< [in] Index of lattice tiling point to move to
+  )
+{
+
+  // If no tiled dimensions are iterated over, there is only one point
+  if ( itr->tiled_itr_ndim == 0 ) {
+    return ( index == itr->index ) ? 1 : 0;
+  }
+
+  const size_t tk = itr->tiled_itr_ndim - 1;
+
+  while ( true ) {
+
+    // If the point is in the current block of the highest iterated tiled dimension, move to it
+    const UINT8 block_remaining = itr->int_upper[tk] - itr->int_point[tk];
+    if ( index - itr->index <= block_remaining ) {
+      itr->int_point[tk] += index - itr->index;
+      itr->index = index;
+      XLAL_CHECK( LT_ResetIteratorPoint( itr, tk, tk + 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+      return 1;
+    }
+
+    // Otherwise, skip the rest of the block and find the first point of the next block
+    itr->index += block_remaining + 1;
+    size_t ti = tk;
+    do {
+
+      // If dimension index is now zero, there are no more points
+      if ( ti == 0 ) {
+        return 0;
+      }
+
+      // Decrement current dimension index, and increment integer point in this dimension
+      --ti;
+      ++itr->int_point[ti];
+
+    } while ( itr->int_point[ti] > itr->int_upper[ti] );
+
+    // Reset parameter-space bounds in higher dimensions and recompute physical point
+    XLAL_CHECK( LT_ResetIteratorPoint( itr, ti, ti + 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  }
+
+}
+
 ///
 /// Callback function for computing lattice tiling statistics
 ///
@@ -795,6 +989,30 @@ static int LT_FindNearestPoints(
 
 }
 
+///
+/// Block of points for which to find nearest points with LT_FindNearestPointsThread().
+///
+typedef struct {
+  const LatticeTilingLocator *loc;      ///< Lattice tiling locator
+  gsl_matrix_const_view points;         ///< Columns are set of points for which to find nearest points
+  gsl_matrix_view nearest_points;       ///< Columns are the corresponding nearest points
+  UINT8VectorSequence nearest_indexes;  ///< View of unique sequential indexes of the nearest points
+  UINT8VectorSequence *nearest_indexes_ptr;     ///< Pointer to 'nearest_indexes', or NULL if not required
+  int retn;                             ///< Return value of LT_FindNearestPoints()
+} LT_NearestPointsTask;
+
+///
+/// Call LT_FindNearestPoints() for a block of points; may be called from a helper thread.
+///
+static void *LT_FindNearestPointsThread(
+  void *arg                             ///< [in] Block of points, of type LT_NearestPointsTask
+  )
+{
+  LT_NearestPointsTask *task = ( LT_NearestPointsTask * ) arg;
+  task->retn = LT_FindNearestPoints( task->loc, &task->points.matrix, &task->nearest_points.matrix, task->nearest_indexes_ptr, NULL, NULL );
+  return NULL;
+}
+
 LatticeTiling *XLALCreateLatticeTiling(
   const size_t ndim
   )
@@ -1673,6 +1891,8 @@ LatticeTilingIterator *XLALCreateLatticeTilingIterator(
   itr->alternating = false;
   itr->state = 0;
   itr->index = 0;
+  itr->index_begin = 0;
+  itr->index_end = LAL_UINT8_MAX;
 
   // Determine the maximum tiled dimension to iterate over
   itr->tiled_itr_ndim = 0;
@@ -1734,6 +1954,7 @@ int XLALSetLatticeTilingAlternatingIterator(
   // Check input
   XLAL_CHECK( itr != NULL, XLAL_EFAULT );
   XLAL_CHECK( itr->state == 0, XLAL_EINVAL );
+  XLAL_CHECK( !alternating || ( itr->index_begin == 0 && itr->index_end == LAL_UINT8_MAX ), XLAL_EINVAL, "Partitioned iterators cannot alternate their iteration direction" );
 
   // Set alternating iterator
   itr->alternating = alternating;
@@ -1742,6 +1963,34 @@ int XLALSetLatticeTilingAlternatingIterator(
 
 }
 
+int XLALSetLatticeTilingIteratorPartition(
+  LatticeTilingIterator *itr,
+  const UINT4 num_parts,
+  const UINT4 part
+  )
+{
+
+  // Check input
+  XLAL_CHECK( itr != NULL, XLAL_EFAULT );
+  XLAL_CHECK( itr->state == 0, XLAL_EINVAL );
+  XLAL_CHECK( !itr->alternating, XLAL_EINVAL, "Alternating iterators cannot be partitioned" );
+  XLAL_CHECK( num_parts > 0, XLAL_EINVAL );
+  XLAL_CHECK( part < num_parts, XLAL_EINVAL );
+
+  // Get total number of points covered by the iterator
+  const UINT8 count = XLALTotalLatticeTilingPoints( itr );
+  XLAL_CHECK( count > 0, XLAL_EFUNC );
+
+  // Divide the points into contiguous ranges whose sizes differ by at most one point
+  const UINT8 part_count = count / num_parts;
+  const UINT8 part_extra = count % num_parts;
+  itr->index_begin = part * part_count + GSL_MIN( part, part_extra );
+  itr->index_end = itr->index_begin + part_count + ( part < part_extra ? 1 : 0 );
+
+  return XLAL_SUCCESS;
+
+}
+
 int XLALResetLatticeTilingIterator(
   LatticeTilingIterator *itr
   )
@@ -1767,7 +2016,6 @@ int XLALNextLatticeTilingPoint(
   XLAL_CHECK( itr != NULL, XLAL_EFAULT );
   XLAL_CHECK( point == NULL || point->size == itr->tiling->ndim, XLAL_EINVAL );
 
-  const size_t n = itr->tiling->ndim;
   const size_t tn = itr->tiling->tiled_ndim;
 
   // If iterator is finished, we're done
@@ -1783,6 +2031,16 @@ int XLALNextLatticeTilingPoint(
 
   if ( itr->state == 0 ) {      // Iterator has been initialised
 
+    // If iterator range is empty, we're done
+    if ( itr->index_begin >= itr->index_end ) {
+
+      // Iterator is now finished
+      itr->state = 2;
+
+      return 0;
+
+    }
+
     // Initialise lattice point
     gsl_vector_set_zero( itr->phys_point );
     for ( size_t ti = 0; ti < tn; ++ti ) {
@@ -1805,6 +2063,16 @@ int XLALNextLatticeTilingPoint(
 
   } else {                      // Iterator is in progress
 
+    // If the end of the iterator range has been reached, we're done
+    if ( itr->index + 1 >= itr->index_end ) {
+
+      // Iterator is now finished
+      itr->state = 2;
+
+      return 0;
+
+    }
+
     // Start iterating from the maximum tiled dimension specified at iterator creation
     size_t ti = itr->tiled_itr_ndim;
 
@@ -1858,117 +2126,20 @@ int XLALNextLatticeTilingPoint(
   }
 
   // Reset parameter-space bounds and recompute physical point
-  for ( size_t i = 0, ti = 0; i < n; ++i ) {
-
-    // Get bound information for this dimension
-    const LT_Bound *bound = &itr->tiling->bounds[i];
-
-    // Get physical parameter-space origin in the current dimension
-    const double phys_origin_i = gsl_vector_get( itr->tiling->phys_origin, i );
-
-    // If not tiled, set current physical point to non-tiled parameter-space bound
-    if ( !bound->is_tiled && ti >= reset_ti ) {
-      double phys_lower = 0, phys_upper = 0;
-      LT_CallBoundFunc( itr->tiling, i, itr->phys_point_cache, itr->phys_point, &phys_lower, &phys_upper );
-      LT_SetPhysPoint( itr->tiling, itr->phys_point_cache, itr->phys_point, i, phys_lower );
-    }
+  XLAL_CHECK( LT_ResetIteratorPoint( itr, changed_ti, reset_ti ) == XLAL_SUCCESS, XLAL_EFUNC );
 
-    // If tiled, reset parameter-space bounds
-    if ( bound->is_tiled && ti >= reset_ti ) {
-
-      // Find the extrema of the parameter-space bounds on the current dimension
-      gsl_vector_memcpy( itr->phys_sampl, itr->phys_point );
-      double phys_lower = GSL_POSINF, phys_upper = GSL_NEGINF;
-      LT_FindBoundExtrema( itr->tiling, 0, i, itr->phys_sampl_cache, itr->phys_sampl, &phys_lower, &phys_upper );
-
-      // Add padding of half the extext of the metric ellipse bounding box, if requested
-      {
-        const double phys_hbbox_i = 0.5 * gsl_vector_get( itr->tiling->phys_bbox, i );
-        if ( bound->padf & LATTICE_TILING_PAD_LHBBX ) {
-          phys_lower -= phys_hbbox_i;
-        }
-        if ( bound->padf & LATTICE_TILING_PAD_UHBBX ) {
-          phys_upper += phys_hbbox_i;
-        }
-      }
-
-      // Transform physical point in lower dimensions to generating integer offset
-      double int_from_phys_point_i = 0;
-      for ( size_t j = 0; j < i; ++j ) {
-        const double int_from_phys_i_j = gsl_matrix_get( itr->tiling->int_from_phys, i, j );
-        const double phys_point_j = gsl_vector_get( itr->phys_point, j );
-        const double phys_origin_j = gsl_vector_get( itr->tiling->phys_origin, j );
-        int_from_phys_point_i += int_from_phys_i_j * ( phys_point_j - phys_origin_j );
-      }
-
-      {
-        // Transform physical bounds to generating integers
-        const double int_from_phys_i_i = gsl_matrix_get( itr->tiling->int_from_phys, i, i );
-        const double dbl_int_lower_i = int_from_phys_point_i + int_from_phys_i_i * ( phys_lower - phys_origin_i );
-        const double dbl_int_upper_i = int_from_phys_point_i + int_from_phys_i_i * ( phys_upper - phys_origin_i );
-
-        // Compute integer lower/upper bounds, rounded up/down to avoid extra boundary points
-        feclearexcept( FE_ALL_EXCEPT );
-        const INT4 int_lower_i = lround( ceil( dbl_int_lower_i ) );
-        const INT4 int_upper_i = lround( floor( dbl_int_upper_i ) );
-        XLAL_CHECK( fetestexcept( FE_INVALID ) == 0, XLAL_EFAILED, "Integer bounds on dimension #%zu are too large: %0.2e to %0.2e", i, dbl_int_lower_i, dbl_int_upper_i );
-
-        // Set integer lower/upper bounds
-        itr->int_lower[ti] = int_lower_i;
-        itr->int_upper[ti] = GSL_MAX( int_lower_i, int_upper_i );
-
-        // Add padding of one integer point, if requested
-        if ( bound->padf & LATTICE_TILING_PAD_LINTP ) {
-          itr->int_lower[ti] -= 1;
-        }
-        if ( bound->padf & LATTICE_TILING_PAD_UINTP ) {
-          itr->int_upper[ti] += 1;
-        }
-      }
-      const INT4 int_lower_i = itr->int_lower[ti];
-      const INT4 int_upper_i = itr->int_upper[ti];
-
-      // Get iteration direction
-      INT4 direction = itr->direction[ti];
-
-      // Only switch iteration direction:
-      // - if this is an alternating iterator
-      // - if iterator is in progress
-      // - for iterated-over dimensions
-      // - if there is more than one point in this dimension
-      if ( itr->alternating && ( itr->state > 0 ) && ( ti < itr->tiled_itr_ndim ) && ( int_lower_i < int_upper_i ) ) {
-        direction = -direction;
-        itr->direction[ti] = direction;
-      }
-
-      // Set integer point to:
-      // - lower or upper bound (depending on current direction) for iterated-over dimensions
-      // - mid-point of integer bounds for non-iterated dimensions
-      if ( ti < itr->tiled_itr_ndim ) {
-        itr->int_point[ti] = ( direction > 0 ) ? int_lower_i : int_upper_i;
-      } else {
-        itr->int_point[ti] = ( int_lower_i + int_upper_i ) / 2;
-      }
+  // If iterator has been initialised, skip ahead to the beginning of the iterator range
+  if ( itr->state == 0 && itr->index_begin > 0 ) {
+    const int retn = LT_SeekIterator( itr, itr->index_begin );
+    XLAL_CHECK( retn >= 0, XLAL_EFUNC );
+    if ( retn == 0 ) {
 
-    }
+      // Iterator range is beyond the last lattice tiling point, so iterator is now finished
+      itr->state = 2;
 
-    // If tiled, recompute current physical point from integer point
-    if ( bound->is_tiled && ti >= changed_ti ) {
-      double phys_point_i = phys_origin_i;
-      for ( size_t tj = 0; tj < tn; ++tj ) {
-        const size_t j = itr->tiling->tiled_idx[tj];
-        const double phys_from_int_i_j = gsl_matrix_get( itr->tiling->phys_from_int, i, j );
-        const INT4 int_point_tj = itr->int_point[tj];
-        phys_point_i += phys_from_int_i_j * int_point_tj;
-      }
-      LT_SetPhysPoint( itr->tiling, itr->phys_point_cache, itr->phys_point, i, phys_point_i );
-    }
+      return 0;
 
-    // Increment tiled dimension index
-    if ( bound->is_tiled ) {
-      ++ti;
     }
-
   }
 
   // Iterator is in progress
@@ -2225,6 +2396,7 @@ int XLALRestoreLatticeTilingIterator(
     UINT8 indx;
     XLAL_CHECK( XLALFITSHeaderReadUINT8( file, "index", &indx ) == XLAL_SUCCESS, XLAL_EFUNC );
     XLAL_CHECK( indx < count_ref, XLAL_EIO, "Could not restore iterator; invalid HDU '%s'", name );
+    XLAL_CHECK( itr->index_begin <= indx && indx < itr->index_end, XLAL_EIO, "Could not restore iterator; index %" LAL_UINT8_FORMAT " is outside iterator range", indx );
     itr->index = indx;
   }
 
@@ -2449,6 +2621,22 @@ int XLALNearestLatticeTilingPoints(
   )
 {
 
+  // Call XLALNearestLatticeTilingPointsParallel() with a single thread
+  XLAL_CHECK( XLALNearestLatticeTilingPointsParallel( loc, points, nearest_points, nearest_indexes, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+}
+
+int XLALNearestLatticeTilingPointsParallel(
+  const LatticeTilingLocator *loc,
+  const gsl_matrix *points,
+  gsl_matrix **nearest_points,
+  UINT8VectorSequence **nearest_indexes,
+  UINT4 num_threads
+  )
+{
+
   // Check input
   XLAL_CHECK( loc != NULL, XLAL_EFAULT );
   XLAL_CHECK( points != NULL, XLAL_EFAULT );
@@ -2483,10 +2671,72 @@ int XLALNearestLatticeTilingPoints(
       XLAL_CHECK( *nearest_indexes != NULL, XLAL_ENOMEM );
     }
   }
-  UINT8VectorSequence *nearest_indexes_view = ( nearest_indexes != NULL ) ? *nearest_indexes : NULL;
 
-  // Call LT_FindNearestPoints()
-  XLAL_CHECK( LT_FindNearestPoints( loc, points, &nearest_points_view.matrix, nearest_indexes_view, NULL, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
+#ifdef LAL_PTHREAD_LOCK
+  if ( num_threads == 0 ) {
+#if defined(HAVE_UNISTD_H) && defined(_SC_NPROCESSORS_ONLN)
+    const long num_procs = sysconf( _SC_NPROCESSORS_ONLN );
+    num_threads = ( num_procs > 0 ) ? ( UINT4 ) num_procs : 1;
+#else
+    num_threads = 1;
+#endif
+  }
+#else
+  num_threads = 1;
+#endif
+  if ( num_threads > num_points ) {
+    num_threads = GSL_MAX( 1, num_points );
+  }
+
+  // Divide points into contiguous blocks, one per thread; LT_FindNearestPoints() only reads from
+  // the locator, so each thread can independently find the nearest points in its own block
+  LT_NearestPointsTask *tasks = XLALCalloc( num_threads, sizeof( *tasks ) );
+  XLAL_CHECK( tasks != NULL, XLAL_ENOMEM );
+  for ( size_t k = 0; k < num_threads; ++k ) {
+    const size_t j_begin = ( num_points * k ) / num_threads;
+    const size_t j_end = ( num_points * ( k + 1 ) ) / num_threads;
+    tasks[k].loc = loc;
+    tasks[k].points = gsl_matrix_const_submatrix( points, 0, j_begin, n, j_end - j_begin );
+    tasks[k].nearest_points = gsl_matrix_submatrix( &nearest_points_view.matrix, 0, j_begin, n, j_end - j_begin );
+    tasks[k].nearest_indexes_ptr = NULL;
+    if ( nearest_indexes != NULL ) {
+      tasks[k].nearest_indexes.vectorLength = n;
+      tasks[k].nearest_indexes.length = j_end - j_begin;
+      tasks[k].nearest_indexes.data = ( *nearest_indexes )->data + n * j_begin;
+      tasks[k].nearest_indexes_ptr = &tasks[k].nearest_indexes;
+    }
+    tasks[k].retn = XLAL_SUCCESS;
+  }
+
+  // Call LT_FindNearestPoints() for each block; blocks which cannot be given to a helper thread
+  // are handled by the calling thread
+  size_t num_started = 0;
+#ifdef LAL_PTHREAD_LOCK
+  pthread_t *threads = NULL;
+  if ( num_threads > 1 && ( threads = XLALCalloc( num_threads - 1, sizeof( *threads ) ) ) != NULL ) {
+    while ( num_started + 1 < num_threads && pthread_create( &threads[num_started], NULL, LT_FindNearestPointsThread, &tasks[num_started + 1] ) == 0 ) {
+      ++num_started;
+    }
+  }
+#endif
+  LT_FindNearestPointsThread( &tasks[0] );
+  for ( size_t k = num_started + 1; k < num_threads; ++k ) {
+    LT_FindNearestPointsThread( &tasks[k] );
+  }
+#ifdef LAL_PTHREAD_LOCK
+  for ( size_t k = 0; k < num_started; ++k ) {
+    pthread_join( threads[k], NULL );
+  }
+  XLALFree( threads );
+#endif
+  int retn = XLAL_SUCCESS;
+  for ( size_t k = 0; k < num_threads; ++k ) {
+    if ( tasks[k].retn != XLAL_SUCCESS ) {
+      retn = tasks[k].retn;
+    }
+  }
+  XLALFree( tasks );
+  XLAL_CHECK( retn == XLAL_SUCCESS, XLAL_EFUNC );
 
   return XLAL_SUCCESS;
 
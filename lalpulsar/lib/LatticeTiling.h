@@ -381,6 +381,27 @@ int XLALSetLatticeTilingAlternatingIterator(
   const bool alternating                ///< [in] If true, set alternating iterator
   );
 
+///
+/// Restrict a lattice tiling iterator to one of \c num_parts contiguous, non-overlapping ranges of
+/// lattice tiling points, which together cover all points covered by the iterator. The ranges are
+/// balanced, i.e. their numbers of points differ by at most one; the points are counted as in
+/// XLALTotalLatticeTilingPoints(). An iterator restricted to range \c part starts at the first
+/// point of that range, skipping over whole blocks of points to reach it, and finishes after the
+/// last point of that range; XLALCurrentLatticeTilingIndex() still returns the index of the
+/// current point in the whole lattice tiling.
+///
+/// To iterate over a lattice tiling with multiple threads, create one iterator per thread and
+/// restrict each to a different range. Since counting the lattice tiling points performs any
+/// registered callbacks on the lattice tiling, this function should be called for every iterator
+/// before the threads are started. The iterator must not have been advanced, and must not be
+/// an alternating iterator.
+///
+int XLALSetLatticeTilingIteratorPartition(
+  LatticeTilingIterator *itr,           ///< [in] Lattice tiling iterator
+  const UINT4 num_parts,                ///< [in] Number of ranges to divide lattice tiling points into
+  const UINT4 part                      ///< [in] Range of lattice tiling points to iterate over
+  );
+
 ///
 /// Reset an iterator to the beginning of a lattice tiling.
 ///
@@ -412,7 +433,8 @@ int XLALNextLatticeTilingPoints(
   );
 
 ///
-/// Return the total number of points covered by the lattice tiling iterator.
+/// Return the total number of points covered by the lattice tiling iterator. For an iterator
+/// restricted with XLALSetLatticeTilingIteratorPartition(), this includes points outside its range.
 ///
 UINT8 XLALTotalLatticeTilingPoints(
   const LatticeTilingIterator *itr      ///< [in] Lattice tiling iterator
@@ -488,6 +510,10 @@ int XLALNearestLatticeTilingPoint(
 /// points in \c nearest_points, and optionally sequential indexes, unique up to each dimension,
 /// to the nearest points in \c nearest_seqs_idxs. Outputs are dynamically resized as required.
 ///
+/// A lattice tiling locator is not modified by this function, or by XLALNearestLatticeTilingPoint()
+/// and XLALNearestLatticeTilingBlock(), so the same locator may be used to locate points in several
+/// threads at once, provided that each thread uses its own outputs.
+///
 #ifdef SWIG // SWIG interface directives
 SWIGLAL( INOUT_STRUCTS( gsl_matrix **, nearest_points ) );
 SWIGLAL( INOUT_STRUCTS( UINT8VectorSequence **, nearest_indexes ) );
@@ -499,6 +525,25 @@ int XLALNearestLatticeTilingPoints(
   UINT8VectorSequence **nearest_indexes ///< [out] Vectors are unique sequential indexes of the nearest points
   );
 
+///
+/// Locate the nearest points in a lattice tiling to a given set of points, like
+/// XLALNearestLatticeTilingPoints(), but divide the points between up to \c num_threads threads,
+/// including the calling thread. If \c num_threads is zero, one thread is used per online
+/// processor; if LAL was compiled without pthread support, all points are located by the calling
+/// thread. The outputs are identical to those of XLALNearestLatticeTilingPoints().
+///
+#ifdef SWIG // SWIG interface directives
+SWIGLAL( INOUT_STRUCTS( gsl_matrix **, nearest_points ) );
+SWIGLAL( INOUT_STRUCTS( UINT8VectorSequence **, nearest_indexes ) );
+#endif
+int XLALNearestLatticeTilingPointsParallel(
+  const LatticeTilingLocator *loc,      ///< [in] Lattice tiling locator
+  const gsl_matrix *points,             ///< [in] Columns are set of points for which to find nearest points
+  gsl_matrix **nearest_points,          ///< [out] Columns are the corresponding nearest points
+  UINT8VectorSequence **nearest_indexes,///< [out] Vectors are unique sequential indexes of the nearest points
+  UINT4 num_threads                     ///< [in] Maximum number of threads to use (0 = number of processors)
+  );
+
 ///
 /// Locate the nearest block in a lattice tiling to a given point. Return the nearest point in
 /// \c nearest_point, the unique sequential index in dimension <tt>dim-1</tt> to the nearest point in
@@ -18,7 +18,14 @@
 *  MA  02111-1307  USA
 */
 
+#include <config.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <lal/NormalizeSFTRngMed.h>
+#include <lal/LALSIMD.h>
 
 /**
  * \addtogroup NormalizeSFTRngMed_h
@@ -49,6 +56,7 @@
  * XLALNormalizeSFT ()
  * XLALNormalizeSFTVect ()
  * XLALNormalizeMultiSFTVect ()
+ * XLALNormalizeMultiSFTVectParallel ()
  * \endcode
  *
  * The function XLALNormalizeSFTVect() takes as input a vector of SFTs and normalizes
@@ -57,10 +65,15 @@
  * XLALPeriodoToRngmed () which applies the running median algorithm to find a vector
  * of medians.  The function XLALNormalizeMultiSFTVect() normalizes a multi-IFO collection
  * of SFT vectors and also returns a collection of power-estimates for these vectors using
- * the Running median method.
+ * the Running median method. The function XLALNormalizeMultiSFTVectParallel() does the same
+ * with several threads, each normalizing one SFT at a time, and returns identical results.
  *
  */
 
+#ifdef HAVE_AVX2_COMPILER
+int XLALPeriodogramCOMPLEX8_AVX2 ( REAL8 *out, const COMPLEX8 *in, const UINT4 length );
+#endif
+
 /**
  * Normalize an sft based on RngMed estimated PSD, and returns running-median.
  */
@@ -164,6 +177,30 @@ XLALNormalizeMultiSFTVect ( MultiSFTVector *multsft,		/**< [in/out] multi-vector
                             UINT4 blockSize,			/**< Running median window size */
                             const MultiNoiseFloor *assumeSqrtSX	/**< If !NULL, instead assume sqrt(S^X) values *instead* of calculating PSD from running median */
                             )
+{
+  MultiPSDVector *multiPSD;
+  XLAL_CHECK_NULL ( ( multiPSD = XLALNormalizeMultiSFTVectParallel ( multsft, blockSize, assumeSqrtSX, 1 ) ) != NULL, XLAL_EFUNC );
+  return multiPSD;
+
+} /* XLALNormalizeMultiSFTVect() */
+
+
+/**
+ * Function for normalizing a multi vector of SFTs in a multi IFO search and
+ * returns the running-median estimates of the power, like XLALNormalizeMultiSFTVect(),
+ * but normalize the SFTs with up to \a numThreads threads, including the calling thread.
+ *
+ * If \a numThreads is zero, the OpenMP default number of threads is used; if LALPulsar was
+ * compiled without OpenMP support, all SFTs are normalized by the calling thread.
+ * Each SFT is normalized independently by a single thread, so the returned running-median
+ * estimates, and the normalized SFTs, are identical to those of XLALNormalizeMultiSFTVect().
+ */
+MultiPSDVector *
+XLALNormalizeMultiSFTVectParallel ( MultiSFTVector *multsft,		/**< [in/out] multi-vector of SFTs which will be normalized */
+                                    UINT4 blockSize,			/**< Running median window size */
+                                    const MultiNoiseFloor *assumeSqrtSX,	/**< If !NULL, instead assume sqrt(S^X) values *instead* of calculating PSD from running median */
+                                    UINT4 numThreads			/**< Maximum number of threads to use (0 = OpenMP default) */
+                                    )
 {
   /* check input argments */
   XLAL_CHECK_NULL ( multsft && multsft->data && multsft->length > 0, XLAL_EINVAL, "Invalid NULL or zero-length input 'multsft'");
@@ -178,6 +215,7 @@ XLALNormalizeMultiSFTVect ( MultiSFTVector *multsft,		/**< [in/out] multi-vector
   XLAL_CHECK_NULL ( ( multiPSD->data = XLALCalloc ( numifo, sizeof(*multiPSD->data))) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc ( %d, %zu)", numifo, sizeof(*multiPSD->data) );
 
   /* loop over ifos */
+  UINT4 numSFTs = 0;
   for ( UINT4 X = 0; X < numifo; X++ )
     {
       UINT4 numsft = multsft->data[X]->length;
@@ -197,18 +235,54 @@ XLALNormalizeMultiSFTVect ( MultiSFTVector *multsft,		/**< [in/out] multi-vector
           UINT4 lengthsft = sft->data->length;
           XLAL_CHECK_NULL ( (multiPSD->data[X]->data[j].data = XLALCreateREAL8Vector ( lengthsft ) ) != NULL, XLAL_EFUNC, "XLALCreateREAL8Vector(%d) failed.", lengthsft );
 
-          /* if assumeSqrtSX is not given, pass 0.0 to calculate PSD from running median */
-          const REAL8 assumeSqrtS = (assumeSqrtSX != NULL) ? assumeSqrtSX->sqrtSn[X] : 0.0;
-
-          XLAL_CHECK_NULL( XLALNormalizeSFT ( &multiPSD->data[X]->data[j], sft, blockSize, assumeSqrtS ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALNormalizeSFT() failed");
-
         } /* for j < numsft */
 
+      numSFTs += numsft;
+
     } /* for X < numifo */
 
+  /* normalize all SFTs, with up to numThreads threads */
+#ifdef _OPENMP
+  if ( numThreads == 0 ) {
+    numThreads = omp_get_max_threads();
+  }
+#endif
+  if ( numThreads > numSFTs ) {
+    numThreads = numSFTs;
+  }
+  if ( numThreads == 0 ) {
+    numThreads = 1;
+  }
+  int failed = 0;
+#pragma omp parallel for schedule(dynamic) num_threads(numThreads) reduction(||:failed)
+  for ( UINT4 i = 0; i < numSFTs; i++ )
+    {
+      /* find detector X and SFT j of the i'th SFT */
+      UINT4 X = 0, j = i;
+      while ( j >= multsft->data[X]->length ) {
+        j -= multsft->data[X]->length;
+        X ++;
+      }
+
+      /* if assumeSqrtSX is not given, pass 0.0 to calculate PSD from running median */
+      const REAL8 assumeSqrtS = (assumeSqrtSX != NULL) ? assumeSqrtSX->sqrtSn[X] : 0.0;
+
+      if ( XLALNormalizeSFT ( &multiPSD->data[X]->data[j], &multsft->data[X]->data[j], blockSize, assumeSqrtS ) != XLAL_SUCCESS )
+        {
+          XLALPrintError ( "%s: XLALNormalizeSFT() failed for SFT %u of detector %u\n", __func__, j, X );
+          failed = 1;
+        }
+    }
+
+  if ( failed )
+    {
+      XLALDestroyMultiPSDVector ( multiPSD );
+      XLAL_ERROR_NULL ( XLAL_EFUNC, "XLALNormalizeSFT() failed" );
+    }
+
   return multiPSD;
 
-} /* XLALNormalizeMultiSFTVect() */
+} /* XLALNormalizeMultiSFTVectParallel() */
 
 
 /**
@@ -290,7 +364,16 @@ XLALSFTtoPeriodogram ( REAL8FrequencySeries    *periodo,	/**< [out] mod squares
   /* check lengths are same */
   UINT4 length = SFT->data->length;
   REAL8 *out = periodo->data->data;
-  COMPLEX8 *in = SFT->data->data;
+  const COMPLEX8 *in = SFT->data->data;
+
+#ifdef HAVE_AVX2_COMPILER
+  /* the AVX2 kernel computes exactly the same REAL8 mod-squares as the loop below, 4 bins at a time */
+  if ( LAL_HAVE_AVX2_RUNTIME() )
+    {
+      XLAL_CHECK ( XLALPeriodogramCOMPLEX8_AVX2 ( out, in, length ) == XLAL_SUCCESS, XLAL_EFUNC );
+      return XLAL_SUCCESS;
+    }
+#endif
 
   for (UINT4 j=0; j<length; j++)
     {
@@ -0,0 +1,62 @@
+//
+// Copyright (C) 2026
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+// MA  02111-1307  USA
+//
+
+#include <immintrin.h>
+
+#include <lal/LALStdlib.h>
+
+///
+/// \file NormalizeSFTRngMed_AVX2.c
+/// \ingroup NormalizeSFTRngMed_h
+/// \brief AVX2 kernel for computing the periodogram of an SFT
+///
+
+int XLALPeriodogramCOMPLEX8_AVX2 ( REAL8 *out, const COMPLEX8 *in, const UINT4 length );
+
+///
+/// Compute the REAL8 mod-squares of COMPLEX8 SFT bins, 4 bins at a time, as in XLALSFTtoPeriodogram().
+/// The squares of the real and imaginary parts are summed with a horizontal add, which cannot be
+/// contracted into a fused multiply-add, so the results are identical to those of the generic loop.
+///
+int
+XLALPeriodogramCOMPLEX8_AVX2 ( REAL8 *out,		///< [out] periodogram
+                               const COMPLEX8 *in,	///< [in] SFT bins
+                               const UINT4 length	///< [in] number of bins
+                               )
+{
+  const REAL4 *x = (const REAL4 *) in;
+  UINT4 j = 0;
+  for ( ; j + 4 <= length; j += 4 )
+    {
+      // {re0, im0, re1, im1} and {re2, im2, re3, im3} in double precision
+      const __m256d x01 = _mm256_cvtps_pd ( _mm_loadu_ps ( x + 2*j ) );
+      const __m256d x23 = _mm256_cvtps_pd ( _mm_loadu_ps ( x + 2*j + 4 ) );
+      // {|x0|^2, |x2|^2, |x1|^2, |x3|^2}
+      const __m256d p = _mm256_hadd_pd ( _mm256_mul_pd ( x01, x01 ), _mm256_mul_pd ( x23, x23 ) );
+      _mm256_storeu_pd ( out + j, _mm256_permute4x64_pd ( p, 0xD8 ) );
+    }
+  for ( ; j < length; j ++ )
+    {
+      const REAL8 re = x[2*j], im = x[2*j + 1];
+      out[j] = re * re + im * im;
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALPeriodogramCOMPLEX8_AVX2()
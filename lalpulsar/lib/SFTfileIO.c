@@ -35,6 +35,8 @@
  */
 
 /*---------- INCLUDES ----------*/
+#include <config.h>
+
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <errno.h>
@@ -48,6 +50,19 @@
 #include <io.h>
 #endif
 
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define USE_MMAP 1
+#else
+#define USE_MMAP 0
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
 #include <lal/LALStdio.h>
 #include <lal/LALString.h>
 #include <lal/FileIO.h>
@@ -59,6 +74,10 @@
 #include <lal/LogPrintf.h>
 #include <lal/SFTutils.h>
 
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#endif
+
 /*---------- DEFINES ----------*/
 
 #define MIN_SFT_VERSION 2
@@ -70,11 +89,28 @@
 /** blocksize used in SFT-reading for the CRC-checksum computation (has to be multiple of 8 !!) */
 #define BLOCKSIZE 8192 * 8
 
+/** default maximum number of SFT-files kept mapped by an SFTCatalogIndex while not in use;
+ * well below the default limit on the number of mappings of a process on Linux (vm.max_map_count = 65530) */
+#define SFT_INDEX_MAX_MAPPED 1024
+
+#ifdef LAL_PTHREAD_LOCK
+#define SFT_INDEX_LOCK(index)   pthread_mutex_lock ( &(index)->lock )
+#define SFT_INDEX_UNLOCK(index) pthread_mutex_unlock ( &(index)->lock )
+#else
+#define SFT_INDEX_LOCK(index)   do { } while (0)
+#define SFT_INDEX_UNLOCK(index) do { } while (0)
+#endif
+
 /** size of blocks allocated for SFT data. For Einstein\@home SFTs this should be set to 8000 (externally) */
 #ifndef SFTFILEIO_REALLOC_BLOCKSIZE
 #define SFTFILEIO_REALLOC_BLOCKSIZE 100
 #endif
 
+/** identifies an SFT catalog cache file written by XLALSFTdataFindParallel() */
+#define SFT_CATALOG_CACHE_MAGIC "LALSFTCatCache2"
+/** used to detect SFT catalog cache files written on machines with a different byte-order */
+#define SFT_CATALOG_CACHE_ENDIAN 0x01020304
+
 /*----- Macros ----- */
 
 #define GPS2REAL8(gps) (1.0 * (gps).gpsSeconds + 1.e-9 * (gps).gpsNanoSeconds )
@@ -117,6 +153,89 @@ typedef struct {
   struct tagSFTLocator *lastfrom;  /**< last bin read from this locator */
 } SFTReadSegment;
 
+/** a file containing SFTs, mapped into memory by an SFTCatalogIndex when needed */
+typedef struct {
+  CHAR *fname;                     /**< name of file */
+  const CHAR *addr;                /**< start of file contents in memory, or NULL if not mapped */
+  size_t len;                      /**< length of file contents */
+  UINT4 pins;                      /**< number of users of the mapped file contents, including SFT views */
+  UINT8 lastUse;                   /**< when the mapped file contents were last used */
+} SFTIndexFile;
+
+/** an SFT (segment) in an SFTCatalogIndex */
+typedef struct {
+  SFTtype header;                  /**< SFT-header info, without data */
+  UINT4 ifile;                     /**< index of file containing this SFT */
+  size_t offset;                   /**< offset of this SFT-block in file */
+  size_t dataoff;                  /**< offset of first frequency-bin in file */
+  UINT4 firstBin;                  /**< first frequency-bin in this SFT */
+  UINT4 numBins;                   /**< number of frequency-bins in this SFT */
+  UINT8 crc64;                     /**< crc64 checksum reported by this SFT */
+  BOOLEAN swapEndian;              /**< whether data must be endian-swapped */
+  INT4 crcStatus;                  /**< 0 = not yet checked, 1 = valid, -1 = invalid checksum */
+} SFTIndexEntry;
+
+/** the SFTs of one detector in an SFTCatalogIndex */
+typedef struct {
+  UINT4 first;                     /**< index of first entry of this detector */
+  UINT4 length;                    /**< number of entries of this detector */
+  UINT4 minBin;                    /**< lowest frequency-bin of all entries */
+  UINT4 maxBin;                    /**< highest frequency-bin of all entries */
+} SFTIndexDetector;
+
+struct tagSFTCatalogIndex
+{
+  UINT4 numFiles;                  /**< number of files */
+  SFTIndexFile *files;             /**< array of files */
+  UINT4 length;                    /**< number of SFTs (segments) */
+  SFTIndexEntry *entries;          /**< array of SFTs, sorted by detector, epoch and first frequency-bin */
+  UINT4 numDetectors;              /**< number of detectors */
+  SFTIndexDetector *detectors;     /**< entries of each detector, sorted alphabetically by detector-name */
+  UINT4 numMapped;                 /**< number of files currently mapped */
+  UINT4 maxMapped;                 /**< maximum number of files kept mapped while not in use */
+  UINT8 clock;                     /**< counter for SFTIndexFile.lastUse */
+#ifdef LAL_PTHREAD_LOCK
+  pthread_mutex_t lock;            /**< protects the mapping of files, so that SFTs may be loaded from several threads */
+#endif
+};
+
+/** the data of an SFT loaded by XLALLoadMultiSFTViewsFromIndex() */
+typedef struct {
+  COMPLEX8Sequence seq;            /**< data of the SFT; must be first */
+  SFTCatalogIndex *index;          /**< index of the mapped file the data points into, or NULL if the data follows */
+  UINT4 ifile;                     /**< index of the mapped file the data points into */
+} SFTIndexView;
+
+/** the headers of all SFT-blocks in one file, as read by XLALSFTdataFindParallel() or stored in its catalog cache */
+typedef struct {
+  CHAR *fname;                     /**< name of file */
+  INT8 mtime;                      /**< modification time of file, seconds */
+  INT4 mtime_ns;                   /**< modification time of file, nanoseconds (0 if not available) */
+  INT8 size;                       /**< size of file */
+  UINT8 inode;                     /**< inode number of file, so that replacing a file is noticed even within the same mtime */
+  UINT4 length;                    /**< number of SFT-blocks in file */
+  SFTDescriptor *data;             /**< descriptors of SFT-blocks, in order of position in file */
+  BOOLEAN cached;                  /**< whether the descriptors were taken from the catalog cache */
+  int errnum;                      /**< XLAL error code if reading the file failed, otherwise 0 */
+} SFTFileHeaders;
+
+/** an SFT catalog cache, as read from disk by XLALSFTdataFindParallel() */
+typedef struct {
+  UINT4 length;                    /**< number of files */
+  SFTFileHeaders *files;           /**< headers of each file, sorted by file name */
+} SFTCatalogCache;
+
+/** work shared by threads reading SFT-file headers */
+typedef struct {
+  SFTFileHeaders *files;           /**< files to read */
+  UINT4 numFiles;                  /**< number of files */
+  const SFTCatalogCache *cache;    /**< catalog cache to take headers from */
+  UINT4 next;                      /**< index of next file to read */
+#ifdef LAL_PTHREAD_LOCK
+  pthread_mutex_t lock;            /**< protects next */
+#endif
+} SFTFileHeadersQueue;
+
 /*---------- Global variables ----------*/
 static REAL8 fudge_up   = 1 + 10 * LAL_REAL8_EPS;	// about ~1 + 2e-15
 static REAL8 fudge_down = 1 - 10 * LAL_REAL8_EPS;	// about ~1 - 2e-15
@@ -145,6 +264,28 @@ static UINT8 calc_crc64(const CHAR *data, UINT4 length, UINT8 crc);
 static BOOLEAN has_valid_v2_crc64 (FILE *fp );
 
 static int read_SFTversion_from_fp ( UINT4 *version, BOOLEAN *need_swap, FILE *fp );
+
+static int map_SFT_file ( SFTIndexFile *file );
+static void unmap_SFT_file ( SFTIndexFile *file );
+static int acquire_SFT_file ( SFTCatalogIndex *index, UINT4 ifile );
+static void release_SFT_file ( SFTCatalogIndex *index, UINT4 ifile );
+static void unmap_idle_SFT_files ( SFTCatalogIndex *index, UINT4 maxMapped );
+static int read_v2_header_from_mem ( SFTIndexEntry *entry, const SFTIndexFile *file );
+static BOOLEAN has_valid_v2_crc64_in_mem ( const SFTIndexEntry *entry, const SFTIndexFile *file );
+static int compareSFTdescFile ( const void *ptr1, const void *ptr2 );
+static int compareSFTIndexEntry ( const void *ptr1, const void *ptr2 );
+static int fill_SFT_from_index ( SFTtype *sft, SFTCatalogIndex *index, const SFTIndexEntry *entries, UINT4 n, UINT4 firstbin, UINT4 lastbin );
+static SFTVector *load_SFTs_from_index ( SFTCatalogIndex *index, UINT4 X, REAL8 fMin, REAL8 fMax, BOOLEAN views );
+static void destroy_SFT_views ( SFTVector *views );
+static BOOLEAN SFT_block_wanted ( const SFTtype *header, const SFTConstraints *constraints );
+static void read_SFT_file_headers ( SFTFileHeaders *file, const SFTCatalogCache *cache );
+static void *read_SFT_file_headers_thread ( void *arg );
+static void read_all_SFT_file_headers ( SFTFileHeaders *files, UINT4 numFiles, const SFTCatalogCache *cache, UINT4 numThreads );
+static void destroy_SFT_file_headers ( SFTFileHeaders *files, UINT4 numFiles );
+static int compareSFTFileHeaders ( const void *ptr1, const void *ptr2 );
+static int read_SFT_catalog_cache ( SFTCatalogCache *cache, const CHAR *cache_fname );
+static int write_SFT_catalog_cache ( const CHAR *cache_fname, const SFTFileHeaders *files, UINT4 numFiles, const SFTCatalogCache *cache );
+static int write_SFT_file_headers_to_cache ( FILE *fp, const SFTFileHeaders *file );
 REAL8 TSFTfromDFreq ( REAL8 dFreq );
 
 /*==================== FUNCTION DEFINITIONS ====================*/
@@ -224,6 +365,40 @@ SFTCatalog *
 XLALSFTdataFind ( const CHAR *file_pattern,		/**< which SFT-files */
                   const SFTConstraints *constraints	/**< additional constraints for SFT-selection */
                   )
+{
+  SFTCatalog *ret;
+  XLAL_CHECK_NULL ( (ret = XLALSFTdataFindParallel ( file_pattern, constraints, 1, NULL )) != NULL, XLAL_EFUNC );
+  return ret;
+
+} /* XLALSFTdataFind() */
+
+
+/**
+ * Find the list of SFTs matching the \a file_pattern and satisfying the given \a constraints,
+ * like XLALSFTdataFind(), but read the headers of the matching SFT-files with \a numThreads
+ * threads, and optionally reuse the headers stored in an on-disk catalog cache.
+ *
+ * If \a numThreads is zero, one thread is used per online processor; if LAL was
+ * compiled without pthread support, the files are always read by the calling thread.
+ *
+ * If \a cache_fname is not NULL, the headers of any matching file found in the cache
+ * with the same path, modification time (to the nanosecond where available), size and inode
+ * are taken from the cache instead of the file, and the cache is rewritten with the headers
+ * of all other matching files.
+ * Entries for files not matched by \a file_pattern are kept, so one cache can be shared by
+ * searches over different subsets of the same data. A missing or unreadable cache is
+ * not an error: the SFT headers are then read from the files, and the cache is recreated.
+ * The cache stores numbers in the byte-order of the machine writing it, and caches
+ * written on a machine with a different byte-order are ignored.
+ *
+ * The returned catalog is identical to the one returned by XLALSFTdataFind().
+ */
+SFTCatalog *
+XLALSFTdataFindParallel ( const CHAR *file_pattern,		/**< which SFT-files */
+                          const SFTConstraints *constraints,	/**< additional constraints for SFT-selection */
+                          UINT4 numThreads,			/**< number of threads reading SFT-headers; 0 = number of processors */
+                          const CHAR *cache_fname		/**< name of catalog cache file, or NULL */
+                          )
 {
   /* ----- check input */
   XLAL_CHECK_NULL ( file_pattern != NULL, XLAL_EINVAL );
@@ -236,208 +411,99 @@ XLALSFTdataFind ( const CHAR *file_pattern,		/**< which SFT-files */
         }
     }
 
-  /* prepare return-catalog */
-  SFTCatalog *ret;
-  XLAL_CHECK_NULL ( (ret = LALCalloc ( 1, sizeof (*ret) )) != NULL, XLAL_ENOMEM );
-
   /* find matching filenames */
   LALStringVector *fnames;
   XLAL_CHECK_NULL ( (fnames = XLALFindFiles (file_pattern)) != NULL, XLAL_EFUNC, "Failed to find filelist matching pattern '%s'.\n\n", file_pattern );
-  UINT4 numFiles = fnames->length;
+  const UINT4 numFiles = fnames->length;
 
-  UINT4 numSFTs = 0;
-  /* ----- main loop: parse all matching files */
+  /* take ownership of the matched filenames */
+  SFTFileHeaders *files;
+  XLAL_CHECK_NULL ( (files = XLALCalloc ( numFiles, sizeof( *files ) )) != NULL, XLAL_ENOMEM );
   for ( UINT4 i = 0; i < numFiles; i ++ )
     {
-      const CHAR *fname = fnames->data[i];
-
-      /* merged SFTs need to satisfy stronger consistency-constraints (-> see spec) */
-      BOOLEAN mfirst_block = TRUE;
-      UINT4   mprev_version = 0;
-      SFTtype XLAL_INIT_DECL( mprev_header );
-      REAL8   mprev_nsamples = 0;
-
-      FILE *fp;
-      if ( ( fp = fopen( fname, "rb" ) ) == NULL )
-	{
-          XLALPrintError ("ERROR: Failed to open matched file '%s'\n\n", fname );
-	  XLALDestroyStringVector ( fnames );
-	  XLALDestroySFTCatalog ( ret );
-	  XLAL_ERROR_NULL ( XLAL_EIO );
-	}
-
-      long file_len;
-      if ( (file_len = get_file_len(fp)) == 0 )
-	{
-          XLALPrintError ("ERROR: got file-len == 0 for '%s'\n\n", fname );
-	  XLALDestroyStringVector ( fnames );
-	  XLALDestroySFTCatalog ( ret );
-	  fclose(fp);
-	  XLAL_ERROR_NULL ( XLAL_EIO );
-	}
-
-      /* go through SFT-blocks in fp */
-      while ( ftell(fp) < file_len )
-	{
-	  SFTtype this_header;
-	  UINT4 this_version;
-	  UINT4 this_nsamples;
-	  UINT8 this_crc;
-	  CHAR *this_comment = NULL;
-	  BOOLEAN endian;
-	  BOOLEAN want_this_block = FALSE;
-
-	  long this_filepos;
-	  if ( (this_filepos = ftell(fp)) == -1 )
-	    {
-              XLALPrintError ("ERROR: ftell() failed for '%s'\n\n", fname );
-	      XLALDestroyStringVector ( fnames );
-	      XLALDestroySFTCatalog ( ret );
-	      fclose (fp);
-	      XLAL_ERROR_NULL ( XLAL_EIO );
-	    }
-
-	  if ( read_sft_header_from_fp (fp, &this_header, &this_version, &this_crc, &endian, &this_comment, &this_nsamples ) != 0 )
-	    {
-              XLALPrintError ("ERROR: File-block '%s:%ld' is not a valid SFT!\n\n", fname, ftell(fp));
-	      XLALDestroyStringVector ( fnames );
-	      XLALFree ( this_comment );
-	      XLALDestroySFTCatalog ( ret );
-	      fclose(fp);
-	      XLAL_ERROR_NULL ( XLAL_EDATA );
-	    }
-
-	  /* if merged-SFT: check consistency constraints */
-	  if ( !mfirst_block )
-	    {
-	      if ( ! consistent_mSFT_header ( mprev_header, mprev_version, mprev_nsamples, this_header, this_version, this_nsamples ) )
-		{
-                  XLALPrintError ( "ERROR: merged SFT-file '%s' contains inconsistent SFT-blocks!\n\n", fname);
-		  XLALFree ( this_comment );
-		  XLALDestroyStringVector ( fnames );
-		  XLALDestroySFTCatalog ( ret );
-		  fclose(fp);
-		  XLAL_ERROR_NULL ( XLAL_EDATA );
-		}
-	    } /* if !mfirst_block */
-
-	  mprev_header = this_header;
-	  mprev_version = this_version;
-	  mprev_nsamples = this_nsamples;
-
-	  want_this_block = TRUE;	/* default */
-	  /* but does this SFT-block satisfy the user-constraints ? */
-	  if ( constraints )
-	    {
-	      if ( constraints->detector )
-		{
-                  if ( strncmp( constraints->detector, this_header.name, 2) ) {
-		    want_this_block = FALSE;
-                  }
-		}
-
-	      if ( XLALCWGPSinRange(this_header.epoch, constraints->minStartTime, constraints->maxStartTime) != 0 ) {
-		want_this_block = FALSE;
-              }
-
-	      if ( constraints->timestamps && !timestamp_in_list(this_header.epoch, constraints->timestamps) ) {
-		want_this_block = FALSE;
-              }
-
-	    } /* if constraints */
-
-	  if ( want_this_block )
-	    {
-	      numSFTs ++;
-
-	      /* do we need to alloc more memory for the SFTs? */
-	      if (  numSFTs > ret->length )
-		{
-		  /* we realloc SFT-memory blockwise in order to
-		   * improve speed in debug-mode (using LALMalloc/LALFree)
-		   */
-                  int len = (ret->length + SFTFILEIO_REALLOC_BLOCKSIZE) * sizeof( *(ret->data) );
-                  if ( (ret->data = LALRealloc ( ret->data, len )) == NULL )
-		    {
-                      XLALPrintError ("ERROR: SFT memory reallocation failed: nSFT:%d, len = %d\n", numSFTs, len );
-		      XLALDestroyStringVector ( fnames );
-		      XLALDestroySFTCatalog ( ret );
-		      XLALFree ( this_comment );
-		      fclose(fp);
-		      XLAL_ERROR_NULL ( XLAL_ENOMEM );
-		    }
-
-		  /* properly initialize data-fields pointers to NULL to avoid SegV when Freeing */
-		  for ( UINT4 j=0; j < SFTFILEIO_REALLOC_BLOCKSIZE; j ++ ) {
-		    memset ( &(ret->data[ret->length + j]), 0, sizeof( ret->data[0] ) );
-                  }
-
-		  ret->length += SFTFILEIO_REALLOC_BLOCKSIZE;
-		} // if numSFTs > ret->length
-
-	      SFTDescriptor *desc = &(ret->data[numSFTs - 1]);
-
-	      desc->locator = XLALCalloc ( 1, sizeof ( *(desc->locator) ) );
-	      if ( desc->locator ) {
-		desc->locator->fname = XLALCalloc( 1, strlen(fname) + 1 );
-              }
-	      if ( (desc->locator == NULL) || (desc->locator->fname == NULL ) )
-		{
-                  XLALPrintError ("ERROR: XLALCalloc() failed\n" );
-		  XLALDestroyStringVector ( fnames );
-		  XLALDestroySFTCatalog ( ret );
-		  fclose(fp);
-		  XLAL_ERROR_NULL ( XLAL_ENOMEM );
-		}
-	      strcpy ( desc->locator->fname, fname );
-	      desc->locator->offset = this_filepos;
-
-	      desc->header  = this_header;
-	      desc->comment = this_comment;
-	      desc->numBins = this_nsamples;
-	      desc->version = this_version;
-	      desc->crc64   = this_crc;
-
-	    } /* if want_this_block */
-	  else
-	    {
-	      XLALFree ( this_comment );
-	    }
-
-	  mfirst_block = FALSE;
-
-	  /* skip seeking if we know we would reach the end */
-	  if ( ftell ( fp ) + (long)this_nsamples * 8 >= file_len )
-	    break;
+      files[i].fname = fnames->data[i];
+      fnames->data[i] = NULL;
+    }
+  XLALDestroyStringVector ( fnames );
 
-	  /* seek to end of SFT data-entries in file  */
-	  if ( fseek ( fp, this_nsamples * 8 , SEEK_CUR ) == -1 )
-	    {
-              XLALPrintError ("ERROR: Failed to skip DATA field for SFT '%s': %s\n", fname, strerror(errno) );
-	      XLALFree ( this_comment );
-	      XLALDestroyStringVector ( fnames );
-	      XLALDestroySFTCatalog ( ret );
-	      fclose(fp);
-	      XLAL_ERROR_NULL ( XLAL_EIO );
-	    }
+  /* load catalog cache, if any */
+  SFTCatalogCache XLAL_INIT_DECL( cache );
+  if ( cache_fname != NULL )
+    {
+      if ( read_SFT_catalog_cache ( &cache, cache_fname ) != XLAL_SUCCESS )
+        {
+          destroy_SFT_file_headers ( files, numFiles );
+          XLAL_ERROR_NULL ( XLAL_EFUNC );
+        }
+    }
 
-	} /* while !feof */
+  /* ----- main loop: parse all matching files, or take their headers from the cache */
+  read_all_SFT_file_headers ( files, numFiles, &cache, numThreads );
 
-      fclose(fp);
+  /* report the first failure, in order of the matched files */
+  BOOLEAN cache_stale = FALSE;
+  for ( UINT4 i = 0; i < numFiles; i ++ )
+    {
+      if ( files[i].errnum != 0 )
+        {
+          const int errnum = files[i].errnum;
+          XLALPrintError ( "ERROR: Failed to read SFT-headers from matched file '%s'\n\n", files[i].fname );
+          destroy_SFT_file_headers ( files, numFiles );
+          destroy_SFT_file_headers ( cache.files, cache.length );
+          XLAL_ERROR_NULL ( errnum );
+        }
+      if ( !files[i].cached )
+        cache_stale = TRUE;
+    }
 
-    } /* for i < numFiles */
+  /* update catalog cache; failure to do so is not fatal */
+  if ( cache_fname != NULL && cache_stale )
+    {
+      int errnum;
+      XLAL_TRY_SILENT ( write_SFT_catalog_cache ( cache_fname, files, numFiles, &cache ), errnum );
+      if ( errnum != 0 )
+        XLALPrintWarning ( "%s: failed to write SFT catalog cache '%s': %s\n", __func__, cache_fname, XLALErrorString ( errnum ) );
+    }
+  destroy_SFT_file_headers ( cache.files, cache.length );
 
-  /* free matched filenames */
-  XLALDestroyStringVector ( fnames );
+  /* prepare return-catalog */
+  SFTCatalog *ret;
+  if ( (ret = XLALCalloc ( 1, sizeof (*ret) )) == NULL )
+    {
+      destroy_SFT_file_headers ( files, numFiles );
+      XLAL_ERROR_NULL ( XLAL_ENOMEM );
+    }
 
-  /* now realloc SFT-vector (alloc'ed blockwise) to its *actual size* */
-  int len;
-  if ( (ret->data = XLALRealloc ( ret->data, len = numSFTs * sizeof( *(ret->data) ))) == NULL )
+  /* ----- select the SFT-blocks which satisfy the user-constraints */
+  UINT4 numSFTs = 0;
+  for ( UINT4 i = 0; i < numFiles; i ++ )
     {
+      for ( UINT4 j = 0; j < files[i].length; j ++ )
+        {
+          if ( SFT_block_wanted ( &files[i].data[j].header, constraints ) )
+            numSFTs ++;
+        }
+    }
+  if ( numSFTs > 0 && (ret->data = XLALCalloc ( numSFTs, sizeof( *(ret->data) ) )) == NULL )
+    {
+      destroy_SFT_file_headers ( files, numFiles );
       XLALDestroySFTCatalog ( ret );
-      XLAL_ERROR_NULL ( XLAL_ENOMEM, "XLALRecalloc ( %d ) failed.\n", len );
+      XLAL_ERROR_NULL ( XLAL_ENOMEM );
+    }
+  for ( UINT4 i = 0; i < numFiles; i ++ )
+    {
+      for ( UINT4 j = 0; j < files[i].length; j ++ )
+        {
+          SFTDescriptor *desc = &(files[i].data[j]);
+          if ( SFT_block_wanted ( &desc->header, constraints ) )
+            {
+              /* move descriptor into the catalog */
+              ret->data[ret->length ++] = (*desc);
+              XLAL_INIT_MEM ( (*desc) );
+            }
+        }
     }
-  ret->length = numSFTs;
+  destroy_SFT_file_headers ( files, numFiles );
 
   /* ----- final consistency-checks: ----- */
 
@@ -493,7 +559,7 @@ XLALSFTdataFind ( const CHAR *file_pattern,		/**< which SFT-files */
   /* return result catalog (=sft-vect and locator-vect) */
   return ret;
 
-} /* XLALSFTdataFind() */
+} /* XLALSFTdataFindParallel() */
 
 
 /*
@@ -1186,6 +1252,279 @@ XLALCheckCRCSFTCatalog(
 } /* XLALCheckCRCSFTCatalog() */
 
 
+/**
+ * Create an index of the SFTs in an SFT-catalogue (returned by XLALSFTdataFind()) for
+ * fast repeated loading of frequency-bands with XLALLoadMultiSFTsFromIndex() and
+ * XLALLoadMultiSFTViewsFromIndex().
+ *
+ * Each SFT-file in the catalogue is mapped into memory (using mmap() where available,
+ * otherwise by reading the whole file), and the index records the file, offset, range
+ * of frequency-bins and checksum status of each SFT (segment). The catalogue is not
+ * needed after the index has been created. The SFT-files must not be modified while
+ * the index exists.
+ *
+ * Files are mapped when SFTs are loaded from them, and at most 1024 files (see
+ * XLALSetSFTCatalogIndexMaxMapped()) are kept mapped while no SFT views point into them;
+ * the least recently used files are unmapped first.
+ */
+SFTCatalogIndex *
+XLALCreateSFTCatalogIndex ( const SFTCatalog *catalog )	/**< The 'catalogue' of SFTs to index */
+{
+  XLAL_CHECK_NULL ( catalog != NULL && catalog->length > 0, XLAL_EINVAL );
+  for ( UINT4 i = 0; i < catalog->length; i ++ ) {
+    XLAL_CHECK_NULL ( catalog->data[i].locator != NULL && catalog->data[i].header.data == NULL, XLAL_EINVAL, "SFT #%u in catalog is not read from a file", i );
+    XLAL_CHECK_NULL ( catalog->data[i].version == 2, XLAL_EINVAL, "Illegal SFT-version encountered : %d\n", catalog->data[i].version );
+  }
+
+  SFTCatalogIndex *index = XLALCalloc ( 1, sizeof(*index) );
+  XLAL_CHECK_NULL ( index != NULL, XLAL_ENOMEM );
+#ifdef LAL_PTHREAD_LOCK
+  pthread_mutex_init ( &index->lock, NULL );
+#endif
+  index->length = catalog->length;
+  index->maxMapped = SFT_INDEX_MAX_MAPPED;
+
+  /* sort catalog entries by file and offset, so that each file is mapped only once */
+  const SFTDescriptor **byfile = XLALMalloc ( catalog->length * sizeof(*byfile) );
+  index->files = XLALCalloc ( catalog->length, sizeof(*index->files) );
+  index->entries = XLALCalloc ( catalog->length, sizeof(*index->entries) );
+  if ( byfile == NULL || index->files == NULL || index->entries == NULL ) {
+    XLALFree ( byfile );
+    XLALDestroySFTCatalogIndex ( index );
+    XLAL_ERROR_NULL ( XLAL_ENOMEM );
+  }
+  for ( UINT4 i = 0; i < catalog->length; i ++ ) {
+    byfile[i] = &catalog->data[i];
+  }
+  qsort ( byfile, catalog->length, sizeof(*byfile), compareSFTdescFile );
+
+  /* map files and read the location of each SFT from its header */
+  for ( UINT4 i = 0; i < catalog->length; i ++ ) {
+    const SFTDescriptor *desc = byfile[i];
+    SFTIndexEntry *entry = &index->entries[i];
+    if ( i == 0 || strcmp ( desc->locator->fname, byfile[i-1]->locator->fname ) != 0 ) {
+      if ( index->numFiles > 0 ) {
+        release_SFT_file ( index, index->numFiles - 1 );
+      }
+      index->files[index->numFiles].fname = XLALStringDuplicate ( desc->locator->fname );
+      if ( index->files[index->numFiles].fname == NULL || acquire_SFT_file ( index, index->numFiles ) != XLAL_SUCCESS ) {
+        XLALFree ( byfile );
+        XLALDestroySFTCatalogIndex ( index );
+        XLAL_ERROR_NULL ( XLAL_EFUNC );
+      }
+      ++index->numFiles;
+    }
+    entry->header = desc->header;
+    entry->ifile = index->numFiles - 1;
+    entry->offset = desc->locator->offset;
+    entry->crc64 = desc->crc64;
+    if ( read_v2_header_from_mem ( entry, &index->files[entry->ifile] ) != XLAL_SUCCESS
+         || entry->numBins != desc->numBins || !GPSEQUAL ( entry->header.epoch, desc->header.epoch ) ) {
+      XLALPrintError ( "ERROR: SFT '%s' does not match its catalog entry\n", XLALshowSFTLocator ( desc->locator ) );
+      XLALFree ( byfile );
+      XLALDestroySFTCatalogIndex ( index );
+      XLAL_ERROR_NULL ( XLAL_EIO );
+    }
+  }
+  release_SFT_file ( index, index->numFiles - 1 );
+  XLALFree ( byfile );
+
+  /* sort entries by detector, epoch and first frequency-bin, and find the entries of each detector */
+  qsort ( index->entries, index->length, sizeof(index->entries[0]), compareSFTIndexEntry );
+  for ( UINT4 i = 0; i < index->length; i ++ ) {
+    const SFTIndexEntry *entry = &index->entries[i];
+    const UINT4 lastBin = entry->firstBin + entry->numBins - 1;
+    if ( i == 0 || strncmp ( entry->header.name, index->entries[i-1].header.name, 2 ) != 0 ) {
+      SFTIndexDetector *detectors = XLALRealloc ( index->detectors, ( index->numDetectors + 1 ) * sizeof(*detectors) );
+      if ( detectors == NULL ) {
+        XLALDestroySFTCatalogIndex ( index );
+        XLAL_ERROR_NULL ( XLAL_ENOMEM );
+      }
+      index->detectors = detectors;
+      SFTIndexDetector *det = &index->detectors[index->numDetectors++];
+      det->first = i;
+      det->length = 0;
+      det->minBin = entry->firstBin;
+      det->maxBin = lastBin;
+    }
+    SFTIndexDetector *det = &index->detectors[index->numDetectors - 1];
+    ++det->length;
+    if ( entry->firstBin < det->minBin ) {
+      det->minBin = entry->firstBin;
+    }
+    if ( lastBin > det->maxBin ) {
+      det->maxBin = lastBin;
+    }
+  }
+
+  return index;
+
+} /* XLALCreateSFTCatalogIndex() */
+
+
+/** Free an SFT-catalogue index, and unmap its SFT-files */
+void
+XLALDestroySFTCatalogIndex ( SFTCatalogIndex *index )	/**< the index to free */
+{
+  if ( index == NULL ) {
+    return;
+  }
+  if ( index->files != NULL ) {
+    for ( UINT4 i = 0; i < index->length; i ++ ) {
+      unmap_SFT_file ( &index->files[i] );
+      XLALFree ( index->files[i].fname );
+    }
+    XLALFree ( index->files );
+  }
+  XLALFree ( index->entries );
+  XLALFree ( index->detectors );
+#ifdef LAL_PTHREAD_LOCK
+  pthread_mutex_destroy ( &index->lock );
+#endif
+  XLALFree ( index );
+} /* XLALDestroySFTCatalogIndex() */
+
+
+/**
+ * Set the maximum number of SFT-files which an SFT-catalogue index keeps mapped into memory
+ * while no SFT views point into them; files are mapped again when needed. Files into which
+ * SFT views point stay mapped until the views are freed.
+ */
+int
+XLALSetSFTCatalogIndexMaxMapped ( SFTCatalogIndex *index,	/**< the index */
+                                  UINT4 maxMapped		/**< maximum number of files kept mapped */
+                                  )
+{
+  XLAL_CHECK ( index != NULL, XLAL_EINVAL );
+  SFT_INDEX_LOCK ( index );
+  index->maxMapped = maxMapped;
+  unmap_idle_SFT_files ( index, index->maxMapped );
+  SFT_INDEX_UNLOCK ( index );
+  return XLAL_SUCCESS;
+} /* XLALSetSFTCatalogIndexMaxMapped() */
+
+
+/**
+ * Verify the CRC64 checksums of all SFTs in an SFT-catalogue index. The result for each SFT
+ * is recorded in the index, so that each SFT is checked only once. This is equivalent to
+ * XLALCheckCRCSFTCatalog(), except that all SFTs are checked even if one fails.
+ */
+int
+XLALCheckCRCSFTCatalogIndex (
+  BOOLEAN *crc_check,		/**< set to true if checksum validation passes */
+  SFTCatalogIndex *index	/**< index of SFTs to check */
+  )
+{
+  XLAL_CHECK ( crc_check != NULL, XLAL_EINVAL );
+  XLAL_CHECK ( index != NULL, XLAL_EINVAL );
+
+  *crc_check = 1;
+  for ( UINT4 i = 0; i < index->length; i ++ ) {
+    SFTIndexEntry *entry = &index->entries[i];
+    if ( entry->crcStatus == 0 ) {
+      XLAL_CHECK ( acquire_SFT_file ( index, entry->ifile ) == XLAL_SUCCESS, XLAL_EFUNC );
+      entry->crcStatus = has_valid_v2_crc64_in_mem ( entry, &index->files[entry->ifile] ) ? 1 : -1;
+      release_SFT_file ( index, entry->ifile );
+    }
+    if ( entry->crcStatus < 0 ) {
+      XLALPrintError ( "CRC64 checksum failure for SFT '%s : %zu'\n", index->files[entry->ifile].fname, entry->offset );
+      *crc_check = 0;
+    }
+  }
+
+  return XLAL_SUCCESS;
+
+} /* XLALCheckCRCSFTCatalogIndex() */
+
+
+/**
+ * Load the given frequency-band <tt>[fMin, fMax]</tt> (inclusively) from the SFTs in an
+ * SFT-catalogue index (returned by XLALCreateSFTCatalogIndex()), returning one SFTVector for
+ * each detector, sorted alphabetically by detector-name. Otherwise the documentation of
+ * XLALLoadSFTs() and XLALLoadMultiSFTs() applies, and the returned SFTs are identical.
+ */
+MultiSFTVector *
+XLALLoadMultiSFTsFromIndex ( SFTCatalogIndex *index,		/**< index of SFTs to load */
+                             REAL8 fMin,			/**< minumum requested frequency (-1 = read from lowest) */
+                             REAL8 fMax				/**< maximum requested frequency (-1 = read up to highest) */
+                             )
+{
+  XLAL_CHECK_NULL ( index != NULL, XLAL_EINVAL );
+
+  MultiSFTVector *multiSFTs;
+  XLAL_CHECK_NULL ( ( multiSFTs = XLALCalloc ( 1, sizeof(*multiSFTs) ) ) != NULL, XLAL_ENOMEM );
+  if ( ( multiSFTs->data = XLALCalloc ( index->numDetectors, sizeof(*multiSFTs->data) ) ) == NULL ) {
+    XLALFree ( multiSFTs );
+    XLAL_ERROR_NULL ( XLAL_ENOMEM );
+  }
+  multiSFTs->length = index->numDetectors;
+
+  for ( UINT4 X = 0; X < index->numDetectors; X ++ ) {
+    if ( ( multiSFTs->data[X] = load_SFTs_from_index ( index, X, fMin, fMax, 0 ) ) == NULL ) {
+      XLALDestroyMultiSFTVector ( multiSFTs );
+      XLAL_ERROR_NULL ( XLAL_EFUNC, "Failed to load SFTs from index for IFO X = %d\n", X );
+    }
+  }
+
+  return multiSFTs;
+
+} /* XLALLoadMultiSFTsFromIndex() */
+
+
+/**
+ * Load the given frequency-band <tt>[fMin, fMax]</tt> from the SFTs in an SFT-catalogue
+ * index as <em>read-only views</em>. Where the band of an SFT is contained in a single SFT
+ * (segment) which needs no endian-swapping, the data of the returned SFT points directly into
+ * the memory-mapped SFT-file, without copying; otherwise the data is copied as in
+ * XLALLoadMultiSFTsFromIndex().
+ *
+ * The returned views must be freed with XLALDestroyMultiSFTViews() before the index is
+ * destroyed, and their data must not be modified. The files into which the views point
+ * stay mapped until the views are freed.
+ */
+MultiSFTVector *
+XLALLoadMultiSFTViewsFromIndex ( SFTCatalogIndex *index,	/**< index of SFTs to load */
+                                 REAL8 fMin,			/**< minumum requested frequency (-1 = read from lowest) */
+                                 REAL8 fMax			/**< maximum requested frequency (-1 = read up to highest) */
+                                 )
+{
+  XLAL_CHECK_NULL ( index != NULL, XLAL_EINVAL );
+
+  MultiSFTVector *multiViews;
+  XLAL_CHECK_NULL ( ( multiViews = XLALCalloc ( 1, sizeof(*multiViews) ) ) != NULL, XLAL_ENOMEM );
+  if ( ( multiViews->data = XLALCalloc ( index->numDetectors, sizeof(*multiViews->data) ) ) == NULL ) {
+    XLALFree ( multiViews );
+    XLAL_ERROR_NULL ( XLAL_ENOMEM );
+  }
+  multiViews->length = index->numDetectors;
+
+  for ( UINT4 X = 0; X < index->numDetectors; X ++ ) {
+    if ( ( multiViews->data[X] = load_SFTs_from_index ( index, X, fMin, fMax, 1 ) ) == NULL ) {
+      XLALDestroyMultiSFTViews ( multiViews );
+      XLAL_ERROR_NULL ( XLAL_EFUNC, "Failed to load SFT views from index for IFO X = %d\n", X );
+    }
+  }
+
+  return multiViews;
+
+} /* XLALLoadMultiSFTViewsFromIndex() */
+
+
+/** Free SFT views returned by XLALLoadMultiSFTViewsFromIndex() */
+void
+XLALDestroyMultiSFTViews ( MultiSFTVector *multiViews )	/**< the SFT views to free */
+{
+  if ( multiViews == NULL ) {
+    return;
+  }
+  for ( UINT4 X = 0; X < multiViews->length; X ++ ) {
+    destroy_SFT_views ( multiViews->data[X] );
+  }
+  XLALFree ( multiViews->data );
+  XLALFree ( multiViews );
+} /* XLALDestroyMultiSFTViews() */
+
+
 /**
  * Simple creator function for MultiLIGOTimeGPSVector with numDetectors entries
  */
@@ -3035,6 +3374,997 @@ read_SFTversion_from_fp ( UINT4 *version, BOOLEAN *need_swap, FILE *fp )
 } /* read_SFTversion_from_fp() */
 
 
+/**
+ * Map an SFT-file into memory, using mmap() if available, otherwise reading the whole file.
+ * If the file has been mapped before, check that its length has not changed.
+ */
+static int
+map_SFT_file ( SFTIndexFile *file )
+{
+  const CHAR *fname = file->fname;
+
+#if USE_MMAP
+  int fd = open ( fname, O_RDONLY );
+  XLAL_CHECK ( fd >= 0, XLAL_EIO, "Failed to open SFT '%s' for reading: %s\n", fname, strerror(errno) );
+  struct stat st;
+  if ( fstat ( fd, &st ) != 0 || st.st_size <= 0 ) {
+    close ( fd );
+    XLAL_ERROR ( XLAL_EIO, "Failed to get length of SFT '%s'\n", fname );
+  }
+  if ( file->len > 0 && (size_t)st.st_size != file->len ) {
+    close ( fd );
+    XLAL_ERROR ( XLAL_EIO, "SFT '%s' has changed since it was indexed\n", fname );
+  }
+  void *addr = mmap ( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+  close ( fd );
+  XLAL_CHECK ( addr != MAP_FAILED, XLAL_EIO, "Failed to mmap() SFT '%s': %s\n", fname, strerror(errno) );
+  file->addr = addr;
+  file->len = st.st_size;
+#else
+  FILE *fp = fopen ( fname, "rb" );
+  XLAL_CHECK ( fp != NULL, XLAL_EIO, "Failed to open SFT '%s' for reading: %s\n", fname, strerror(errno) );
+  long len = get_file_len ( fp );
+  if ( file->len > 0 && (size_t)len != file->len ) {
+    fclose ( fp );
+    XLAL_ERROR ( XLAL_EIO, "SFT '%s' has changed since it was indexed\n", fname );
+  }
+  CHAR *addr = ( len > 0 ) ? XLALMalloc ( len ) : NULL;
+  if ( addr == NULL || fread ( addr, 1, len, fp ) != (size_t)len ) {
+    XLALFree ( addr );
+    fclose ( fp );
+    XLAL_ERROR ( XLAL_EIO, "Failed to read SFT '%s'\n", fname );
+  }
+  fclose ( fp );
+  file->addr = addr;
+  file->len = len;
+#endif
+
+  return XLAL_SUCCESS;
+
+} /* map_SFT_file() */
+
+
+/* unmap an SFT-file mapped with map_SFT_file() */
+static void
+unmap_SFT_file ( SFTIndexFile *file )
+{
+  if ( file->addr != NULL ) {
+#if USE_MMAP
+    munmap ( (void *) file->addr, file->len );
+#else
+    XLALFree ( (void *) file->addr );
+#endif
+    file->addr = NULL;
+  }
+} /* unmap_SFT_file() */
+
+
+/**
+ * Map file \c ifile of an index if it is not already mapped, and keep it mapped until
+ * a matching call to release_SFT_file().
+ */
+static int
+acquire_SFT_file ( SFTCatalogIndex *index, UINT4 ifile )
+{
+  SFTIndexFile *file = &index->files[ifile];
+  SFT_INDEX_LOCK ( index );
+  if ( file->addr == NULL ) {
+    unmap_idle_SFT_files ( index, ( index->maxMapped > 0 ) ? index->maxMapped - 1 : 0 );
+    if ( map_SFT_file ( file ) != XLAL_SUCCESS ) {
+      SFT_INDEX_UNLOCK ( index );
+      XLAL_ERROR ( XLAL_EFUNC );
+    }
+    ++index->numMapped;
+  }
+  ++file->pins;
+  file->lastUse = ++index->clock;
+  SFT_INDEX_UNLOCK ( index );
+  return XLAL_SUCCESS;
+} /* acquire_SFT_file() */
+
+
+/* release file \c ifile of an index acquired with acquire_SFT_file() */
+static void
+release_SFT_file ( SFTCatalogIndex *index, UINT4 ifile )
+{
+  SFTIndexFile *file = &index->files[ifile];
+  SFT_INDEX_LOCK ( index );
+  --file->pins;
+  unmap_idle_SFT_files ( index, index->maxMapped );
+  SFT_INDEX_UNLOCK ( index );
+} /* release_SFT_file() */
+
+
+/* unmap the least recently used files of an index not in use, until at most \c maxMapped files are mapped */
+static void
+unmap_idle_SFT_files ( SFTCatalogIndex *index, UINT4 maxMapped )
+{
+  while ( index->numMapped > maxMapped ) {
+    SFTIndexFile *lru = NULL;
+    for ( UINT4 i = 0; i < index->numFiles; i ++ ) {
+      SFTIndexFile *file = &index->files[i];
+      if ( file->addr != NULL && file->pins == 0 && ( lru == NULL || file->lastUse < lru->lastUse ) ) {
+        lru = file;
+      }
+    }
+    if ( lru == NULL ) {
+      break;
+    }
+    unmap_SFT_file ( lru );
+    --index->numMapped;
+  }
+} /* unmap_idle_SFT_files() */
+
+
+/**
+ * Read the location of the data of a v2-SFT-block in a mapped SFT-file, and fill in
+ * the entry's first frequency-bin, number of bins, data offset and endian-ness.
+ * The header itself has already been validated by XLALSFTdataFind().
+ */
+static int
+read_v2_header_from_mem ( SFTIndexEntry *entry, const SFTIndexFile *file )
+{
+  _SFT_header_v2_t rawheader;
+
+  XLAL_CHECK ( entry->offset + sizeof(rawheader) <= file->len, XLAL_EIO, "SFT-header beyond end of file '%s'\n", file->fname );
+  memcpy ( &rawheader, file->addr + entry->offset, sizeof(rawheader) );
+
+  /* figure out endian-ness from the version-number */
+  {
+    REAL8 vertest = 2;
+    if ( memcmp ( &rawheader.version, &vertest, sizeof(vertest) ) == 0 ) {
+      entry->swapEndian = FALSE;
+    } else {
+      endian_swap ( (CHAR*)(&vertest), sizeof(vertest), 1 );
+      XLAL_CHECK ( memcmp ( &rawheader.version, &vertest, sizeof(vertest) ) == 0, XLAL_EIO, "Illegal SFT-version in file '%s'\n", file->fname );
+      entry->swapEndian = TRUE;
+    }
+  }
+  if ( entry->swapEndian ) {
+    endian_swap((CHAR*)(&rawheader.gps_sec), 			sizeof(rawheader.gps_sec) 		, 1);
+    endian_swap((CHAR*)(&rawheader.gps_nsec), 			sizeof(rawheader.gps_nsec) 		, 1);
+    endian_swap((CHAR*)(&rawheader.first_frequency_index), 	sizeof(rawheader.first_frequency_index) , 1);
+    endian_swap((CHAR*)(&rawheader.nsamples), 			sizeof(rawheader.nsamples) 		, 1);
+    endian_swap((CHAR*)(&rawheader.comment_length),		sizeof(rawheader.comment_length)	, 1);
+  }
+  XLAL_CHECK ( rawheader.first_frequency_index >= 0 && rawheader.nsamples > 0 && rawheader.comment_length >= 0, XLAL_EIO, "Invalid SFT-header in file '%s'\n", file->fname );
+
+  entry->header.epoch.gpsSeconds = rawheader.gps_sec;
+  entry->header.epoch.gpsNanoSeconds = rawheader.gps_nsec;
+  entry->firstBin = rawheader.first_frequency_index;
+  entry->numBins = rawheader.nsamples;
+  entry->dataoff = entry->offset + sizeof(rawheader) + rawheader.comment_length;
+  XLAL_CHECK ( entry->dataoff + ((size_t)entry->numBins) * sizeof(COMPLEX8) <= file->len, XLAL_EIO, "SFT-data beyond end of file '%s'\n", file->fname );
+
+  return XLAL_SUCCESS;
+
+} /* read_v2_header_from_mem() */
+
+
+/**
+ * Check the v2-SFT-block of an index entry in a mapped SFT-file for valid crc64 checksum,
+ * as in has_valid_v2_crc64().
+ */
+static BOOLEAN
+has_valid_v2_crc64_in_mem ( const SFTIndexEntry *entry, const SFTIndexFile *file )
+{
+  _SFT_header_v2_t rawheader;
+  const CHAR *block = file->addr + entry->offset;
+  UINT8 crc;
+
+  /* compute CRC for the header, with the checksum-field set to zero */
+  memcpy ( &rawheader, block, sizeof(rawheader) );
+  rawheader.crc64 = 0;
+  crc = calc_crc64 ( (const CHAR*)&rawheader, sizeof(rawheader), ~(0ULL) );
+
+  /* add the comment, including its 0-terminator, padded to a multiple of 8 bytes */
+  {
+    const size_t comment_length = entry->dataoff - entry->offset - sizeof(rawheader);
+    if ( comment_length > 0 ) {
+      const CHAR *comm = block + sizeof(rawheader);
+      size_t comment_len = strnlen ( comm, comment_length ) + 1;
+      comment_len += (8 - (comment_len % 8)) % 8;
+      if ( comment_len > comment_length ) {
+        return FALSE;
+      }
+      crc = calc_crc64 ( comm, comment_len, crc );
+    }
+  }
+
+  /* add the data: don't endian-swap for that! */
+  crc = calc_crc64 ( file->addr + entry->dataoff, entry->numBins * sizeof(COMPLEX8), crc );
+
+  return ( crc == entry->crc64 );
+
+} /* has_valid_v2_crc64_in_mem() */
+
+
+/* compare two SFT-descriptor pointers by their file-name, then offset */
+static int
+compareSFTdescFile ( const void *ptr1, const void *ptr2 )
+{
+  const SFTDescriptor *desc1 = *(const SFTDescriptor * const *)ptr1;
+  const SFTDescriptor *desc2 = *(const SFTDescriptor * const *)ptr2;
+  int s = strcmp ( desc1->locator->fname, desc2->locator->fname );
+  if ( s != 0 )
+    return s;
+  if ( desc1->locator->offset < desc2->locator->offset )
+    return -1;
+  else if ( desc1->locator->offset > desc2->locator->offset )
+    return 1;
+  else
+    return 0;
+} /* compareSFTdescFile() */
+
+
+/* compare two SFT-index entries by detector name, then GPS-epoch, then first frequency-bin */
+static int
+compareSFTIndexEntry ( const void *ptr1, const void *ptr2 )
+{
+  const SFTIndexEntry *entry1 = ptr1;
+  const SFTIndexEntry *entry2 = ptr2;
+  int s = strncmp ( entry1->header.name, entry2->header.name, 2 );
+  if ( s != 0 )
+    return s;
+  s = XLALGPSCmp ( &entry1->header.epoch, &entry2->header.epoch );
+  if ( s != 0 )
+    return s;
+  if ( entry1->firstBin < entry2->firstBin )
+    return -1;
+  else if ( entry1->firstBin > entry2->firstBin )
+    return 1;
+  else
+    return 0;
+} /* compareSFTIndexEntry() */
+
+
+/**
+ * Copy the frequency-bins <tt>[firstbin, lastbin]</tt> of the SFT made up of the index entries
+ * <tt>entries[0..n-1]</tt> (all with the same epoch, sorted by first frequency-bin) into \c sft.
+ * If \c sft->data is NULL, a view into the mapped SFT-file is returned if possible, which keeps
+ * the file mapped until it is freed by destroy_SFT_views(); otherwise the data is allocated
+ * together with \c sft->data.
+ */
+static int
+fill_SFT_from_index ( SFTtype *sft, SFTCatalogIndex *index, const SFTIndexEntry *entries, UINT4 n, UINT4 firstbin, UINT4 lastbin )
+{
+  const UINT4 numBins = lastbin - firstbin + 1;
+  const REAL8 deltaF = entries[0].header.deltaF;
+
+  /* copy the SFT-header */
+  memcpy ( sft->name, entries[0].header.name, sizeof(sft->name) );
+  sft->epoch = entries[0].header.epoch;
+  sft->f0 = 1.0 * firstbin * deltaF;
+  sft->deltaF = deltaF;
+  sft->sampleUnits = entries[0].header.sampleUnits;
+
+  if ( sft->data == NULL ) {
+
+    /* return a view if a single segment contains the whole band and needs no endian-swapping */
+    for ( UINT4 k = 0; k < n; k ++ ) {
+      const SFTIndexEntry *entry = &entries[k];
+      if ( entry->firstBin <= firstbin && lastbin < entry->firstBin + entry->numBins && !entry->swapEndian && entry->header.deltaF == deltaF ) {
+        SFTIndexView *view = XLALMalloc ( sizeof(*view) );
+        XLAL_CHECK ( view != NULL, XLAL_ENOMEM );
+        if ( acquire_SFT_file ( index, entry->ifile ) != XLAL_SUCCESS ) {
+          XLALFree ( view );
+          XLAL_ERROR ( XLAL_EFUNC );
+        }
+        view->index = index;
+        view->ifile = entry->ifile;
+        view->seq.length = numBins;
+        view->seq.data = ( (COMPLEX8 *) ( index->files[entry->ifile].addr + entry->dataoff ) ) + ( firstbin - entry->firstBin );
+        sft->data = &view->seq;
+        return XLAL_SUCCESS;
+      }
+    }
+
+    /* otherwise allocate data together with the sequence */
+    SFTIndexView *view = XLALMalloc ( sizeof(*view) + numBins * sizeof(COMPLEX8) );
+    XLAL_CHECK ( view != NULL, XLAL_ENOMEM );
+    view->index = NULL;
+    view->ifile = 0;
+    view->seq.length = numBins;
+    view->seq.data = (COMPLEX8 *) ( view + 1 );
+    sft->data = &view->seq;
+
+  }
+  XLAL_CHECK ( sft->data->length == numBins, XLAL_EINVAL );
+
+  /* copy bins from each segment overlapping the band, checking for gaps and overlaps */
+  UINT4 next = firstbin;
+  for ( UINT4 k = 0; k < n && next <= lastbin; k ++ ) {
+    const SFTIndexEntry *entry = &entries[k];
+    const UINT4 lastSFTbin = entry->firstBin + entry->numBins - 1;
+    if ( lastSFTbin < firstbin || entry->firstBin > lastbin ) {
+      continue;
+    }
+    const SFTIndexFile *file = &index->files[entry->ifile];
+    XLAL_CHECK ( ( next == firstbin ) ? ( entry->firstBin <= firstbin ) : ( entry->firstBin == next ), XLAL_EIO,
+                 "ERROR: data gap or overlap in SFT (GPS %lf) at bin %u read from file '%s'\n", GPS2REAL8(sft->epoch), entry->firstBin, file->fname );
+    XLAL_CHECK ( entry->header.deltaF == deltaF, XLAL_EIO,
+                 "ERROR: deltaF mismatch (%f/%f) in SFT read from file '%s'\n", entry->header.deltaF, deltaF, file->fname );
+    const UINT4 last = ( lastSFTbin < lastbin ) ? lastSFTbin : lastbin;
+    COMPLEX8 *dest = sft->data->data + ( next - firstbin );
+    XLAL_CHECK ( acquire_SFT_file ( index, entry->ifile ) == XLAL_SUCCESS, XLAL_EFUNC );
+    memcpy ( dest, file->addr + entry->dataoff + ( next - entry->firstBin ) * sizeof(COMPLEX8), ( last - next + 1 ) * sizeof(COMPLEX8) );
+    release_SFT_file ( index, entry->ifile );
+    if ( entry->swapEndian ) {
+      endian_swap ( (CHAR *) dest, sizeof(REAL4), 2 * ( last - next + 1 ) );
+    }
+    next = last + 1;
+  }
+  XLAL_CHECK ( next > lastbin, XLAL_EIO, "ERROR: data missing in SFT (GPS %lf): expected bin %u, read up to bin %u\n", GPS2REAL8(sft->epoch), lastbin, next - 1 );
+
+  return XLAL_SUCCESS;
+
+} /* fill_SFT_from_index() */
+
+
+/**
+ * Load the frequency-band <tt>[fMin, fMax]</tt> of the SFTs of detector \c X from an index,
+ * either into a new SFTVector or (if \c views is true) as views to be freed with destroy_SFT_views().
+ */
+static SFTVector *
+load_SFTs_from_index ( SFTCatalogIndex *index, UINT4 X, REAL8 fMin, REAL8 fMax, BOOLEAN views )
+{
+  XLAL_CHECK_NULL ( X < index->numDetectors, XLAL_EINVAL );
+  const SFTIndexDetector *det = &index->detectors[X];
+  const SFTIndexEntry *entries = &index->entries[det->first];
+  const REAL8 deltaF = entries[0].header.deltaF;
+
+  /* calculate first and last frequency bin to read */
+  UINT4 firstbin, lastbin;
+  if ( fMin < 0 )
+    firstbin = det->minBin;
+  else
+    firstbin = XLALRoundFrequencyDownToSFTBin ( fMin, deltaF );
+  if ( fMax < 0 )
+    lastbin = det->maxBin;
+  else {
+    lastbin = XLALRoundFrequencyUpToSFTBin ( fMax, deltaF );
+    XLAL_CHECK_NULL ( ( lastbin != 0 ) || ( fMax == 0 ), XLAL_EINVAL, "ERROR: last bin to read is 0 (fMax: %f, deltaF: %f)\n", fMax, deltaF );
+  }
+  XLAL_CHECK_NULL ( firstbin <= lastbin, XLAL_EINVAL, "Empty frequency-interval requested [%u, %u] bins\n", firstbin, lastbin );
+
+  /* count SFTs, i.e. different GPS timestamps */
+  UINT4 nSFTs = 1;
+  for ( UINT4 i = 1; i < det->length; i ++ ) {
+    if ( !GPSEQUAL ( entries[i].header.epoch, entries[i-1].header.epoch ) ) {
+      ++nSFTs;
+    }
+  }
+
+  /* allocate the SFT vector to be returned */
+  SFTVector *sfts = NULL;
+  if ( views ) {
+    XLAL_CHECK_NULL ( ( sfts = XLALCalloc ( 1, sizeof(*sfts) ) ) != NULL, XLAL_ENOMEM );
+    if ( ( sfts->data = XLALCalloc ( nSFTs, sizeof(*sfts->data) ) ) == NULL ) {
+      XLALFree ( sfts );
+      XLAL_ERROR_NULL ( XLAL_ENOMEM );
+    }
+    sfts->length = nSFTs;
+  } else {
+    XLAL_CHECK_NULL ( ( sfts = XLALCreateSFTVector ( nSFTs, lastbin - firstbin + 1 ) ) != NULL, XLAL_EFUNC );
+  }
+
+  /* fill each SFT from its segments */
+  for ( UINT4 i = 0, isft = 0; i < det->length; ++isft ) {
+    UINT4 n = 1;
+    while ( i + n < det->length && GPSEQUAL ( entries[i + n].header.epoch, entries[i].header.epoch ) ) {
+      ++n;
+    }
+    if ( fill_SFT_from_index ( &sfts->data[isft], index, &entries[i], n, firstbin, lastbin ) != XLAL_SUCCESS ) {
+      if ( views ) {
+        destroy_SFT_views ( sfts );
+      } else {
+        XLALDestroySFTVector ( sfts );
+      }
+      XLAL_ERROR_NULL ( XLAL_EFUNC );
+    }
+    i += n;
+  }
+
+  return sfts;
+
+} /* load_SFTs_from_index() */
+
+
+/* free SFT views returned by load_SFTs_from_index() */
+static void
+destroy_SFT_views ( SFTVector *views )
+{
+  if ( views == NULL ) {
+    return;
+  }
+  for ( UINT4 i = 0; i < views->length; i ++ ) {
+    /* data either points into a mapped file, which is released, or is allocated together with the sequence */
+    SFTIndexView *view = (SFTIndexView *) views->data[i].data;
+    if ( view != NULL && view->index != NULL ) {
+      release_SFT_file ( view->index, view->ifile );
+    }
+    XLALFree ( view );
+  }
+  XLALFree ( views->data );
+  XLALFree ( views );
+} /* destroy_SFT_views() */
+
+
+/* does this SFT-block satisfy the user-constraints ? */
+static BOOLEAN
+SFT_block_wanted ( const SFTtype *header, const SFTConstraints *constraints )
+{
+  if ( constraints == NULL ) {
+    return TRUE;
+  }
+  if ( constraints->detector && strncmp ( constraints->detector, header->name, 2 ) ) {
+    return FALSE;
+  }
+  if ( XLALCWGPSinRange ( header->epoch, constraints->minStartTime, constraints->maxStartTime ) != 0 ) {
+    return FALSE;
+  }
+  if ( constraints->timestamps && !timestamp_in_list ( header->epoch, constraints->timestamps ) ) {
+    return FALSE;
+  }
+  return TRUE;
+} /* SFT_block_wanted() */
+
+
+/* Read the headers of all SFT-blocks in a file, or copy them from the catalog cache if the
+ * file's modification time (to the nanosecond, where available), size and inode match the cache entry. Errors are recorded in
+ * file->errnum rather than raised, so that this can be called from any thread.
+ */
+static void
+read_SFT_file_headers ( SFTFileHeaders *file, const SFTCatalogCache *cache )
+{
+  const CHAR *fname = file->fname;
+
+  /* get the modification time, size and inode of the file, which key the catalog cache */
+  struct stat st;
+  if ( stat ( fname, &st ) != 0 )
+    {
+      XLALPrintError ("ERROR: Failed to open matched file '%s'\n\n", fname );
+      file->errnum = XLAL_EIO;
+      return;
+    }
+  file->mtime = st.st_mtime;
+#ifdef HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC
+  file->mtime_ns = st.st_mtim.tv_nsec;
+#else
+  file->mtime_ns = 0;
+#endif
+  file->size = st.st_size;
+  file->inode = st.st_ino;
+
+  /* copy the headers from the catalog cache, if they are up to date */
+  const SFTFileHeaders *cached = NULL;
+  if ( cache->length > 0 ) {
+    cached = bsearch ( file, cache->files, cache->length, sizeof( cache->files[0] ), compareSFTFileHeaders );
+  }
+  if ( cached != NULL && cached->mtime == file->mtime && cached->mtime_ns == file->mtime_ns
+       && cached->size == file->size && cached->inode == file->inode )
+    {
+      if ( cached->length > 0 && (file->data = LALCalloc ( cached->length, sizeof( file->data[0] ) )) == NULL )
+        {
+          file->errnum = XLAL_ENOMEM;
+          return;
+        }
+      for ( UINT4 j = 0; j < cached->length; j ++ )
+        {
+          const SFTDescriptor *src = &(cached->data[j]);
+          SFTDescriptor *desc = &(file->data[file->length ++]);
+          (*desc) = (*src);
+          desc->locator = NULL;
+          desc->comment = NULL;
+          if ( (desc->locator = LALCalloc ( 1, sizeof( *(desc->locator) ) )) == NULL
+               || (desc->locator->fname = LALMalloc ( strlen(fname) + 1 )) == NULL
+               || ( src->comment != NULL && (desc->comment = LALMalloc ( strlen(src->comment) + 1 )) == NULL ) )
+            {
+              file->errnum = XLAL_ENOMEM;
+              return;
+            }
+          strcpy ( desc->locator->fname, fname );
+          desc->locator->offset = src->locator->offset;
+          if ( src->comment != NULL ) {
+            strcpy ( desc->comment, src->comment );
+          }
+        }
+      file->cached = TRUE;
+      return;
+    }
+
+  /* merged SFTs need to satisfy stronger consistency-constraints (-> see spec) */
+  BOOLEAN mfirst_block = TRUE;
+  UINT4   mprev_version = 0;
+  SFTtype XLAL_INIT_DECL( mprev_header );
+  REAL8   mprev_nsamples = 0;
+
+  FILE *fp;
+  if ( ( fp = fopen( fname, "rb" ) ) == NULL )
+    {
+      XLALPrintError ("ERROR: Failed to open matched file '%s'\n\n", fname );
+      file->errnum = XLAL_EIO;
+      return;
+    }
+
+  long file_len;
+  if ( (file_len = get_file_len(fp)) == 0 )
+    {
+      XLALPrintError ("ERROR: got file-len == 0 for '%s'\n\n", fname );
+      fclose(fp);
+      file->errnum = XLAL_EIO;
+      return;
+    }
+
+  /* go through SFT-blocks in fp */
+  UINT4 capacity = 0;
+  while ( ftell(fp) < file_len )
+    {
+      SFTtype this_header;
+      UINT4 this_version;
+      UINT4 this_nsamples;
+      UINT8 this_crc;
+      CHAR *this_comment = NULL;
+      BOOLEAN endian;
+
+      long this_filepos;
+      if ( (this_filepos = ftell(fp)) == -1 )
+        {
+          XLALPrintError ("ERROR: ftell() failed for '%s'\n\n", fname );
+          fclose (fp);
+          file->errnum = XLAL_EIO;
+          return;
+        }
+
+      if ( read_sft_header_from_fp (fp, &this_header, &this_version, &this_crc, &endian, &this_comment, &this_nsamples ) != 0 )
+        {
+          XLALPrintError ("ERROR: File-block '%s:%ld' is not a valid SFT!\n\n", fname, ftell(fp));
+          XLALFree ( this_comment );
+          fclose(fp);
+          file->errnum = XLAL_EDATA;
+          return;
+        }
+
+      /* if merged-SFT: check consistency constraints */
+      if ( !mfirst_block )
+        {
+          if ( ! consistent_mSFT_header ( mprev_header, mprev_version, mprev_nsamples, this_header, this_version, this_nsamples ) )
+            {
+              XLALPrintError ( "ERROR: merged SFT-file '%s' contains inconsistent SFT-blocks!\n\n", fname);
+              XLALFree ( this_comment );
+              fclose(fp);
+              file->errnum = XLAL_EDATA;
+              return;
+            }
+        } /* if !mfirst_block */
+
+      mprev_header = this_header;
+      mprev_version = this_version;
+      mprev_nsamples = this_nsamples;
+
+      /* do we need to alloc more memory for the SFT-blocks? */
+      if ( file->length == capacity )
+        {
+          capacity = ( capacity > 0 ) ? 2 * capacity : 1;
+          SFTDescriptor *data = LALRealloc ( file->data, capacity * sizeof( file->data[0] ) );
+          if ( data == NULL )
+            {
+              XLALFree ( this_comment );
+              fclose(fp);
+              file->errnum = XLAL_ENOMEM;
+              return;
+            }
+          file->data = data;
+        }
+
+      SFTDescriptor *desc = &(file->data[file->length ++]);
+      XLAL_INIT_MEM ( (*desc) );
+      desc->header  = this_header;
+      desc->comment = this_comment;
+      desc->numBins = this_nsamples;
+      desc->version = this_version;
+      desc->crc64   = this_crc;
+
+      if ( (desc->locator = LALCalloc ( 1, sizeof( *(desc->locator) ) )) == NULL
+           || (desc->locator->fname = LALMalloc ( strlen(fname) + 1 )) == NULL )
+        {
+          XLALPrintError ("ERROR: XLALCalloc() failed\n" );
+          fclose(fp);
+          file->errnum = XLAL_ENOMEM;
+          return;
+        }
+      strcpy ( desc->locator->fname, fname );
+      desc->locator->offset = this_filepos;
+
+      mfirst_block = FALSE;
+
+      /* skip seeking if we know we would reach the end */
+      if ( ftell ( fp ) + (long)this_nsamples * 8 >= file_len )
+        break;
+
+      /* seek to end of SFT data-entries in file  */
+      if ( fseek ( fp, this_nsamples * 8 , SEEK_CUR ) == -1 )
+        {
+          XLALPrintError ("ERROR: Failed to skip DATA field for SFT '%s': %s\n", fname, strerror(errno) );
+          fclose(fp);
+          file->errnum = XLAL_EIO;
+          return;
+        }
+
+    } /* while !feof */
+
+  fclose(fp);
+
+} /* read_SFT_file_headers() */
+
+
+/* read SFT-file headers from a shared queue until it is empty */
+static void *
+read_SFT_file_headers_thread ( void *arg )
+{
+  SFTFileHeadersQueue *queue = (SFTFileHeadersQueue *) arg;
+  while ( 1 )
+    {
+#ifdef LAL_PTHREAD_LOCK
+      pthread_mutex_lock ( &queue->lock );
+#endif
+      const UINT4 i = queue->next;
+      if ( i < queue->numFiles ) {
+        queue->next ++;
+      }
+#ifdef LAL_PTHREAD_LOCK
+      pthread_mutex_unlock ( &queue->lock );
+#endif
+      if ( i >= queue->numFiles ) {
+        break;
+      }
+      read_SFT_file_headers ( &queue->files[i], queue->cache );
+    }
+  return NULL;
+} /* read_SFT_file_headers_thread() */
+
+
+/* read the headers of all SFT-files with up to numThreads threads (0 = number of processors),
+ * including the calling thread */
+static void
+read_all_SFT_file_headers ( SFTFileHeaders *files, UINT4 numFiles, const SFTCatalogCache *cache, UINT4 numThreads )
+{
+  SFTFileHeadersQueue queue = { .files = files, .numFiles = numFiles, .cache = cache, .next = 0 };
+
+#ifdef LAL_PTHREAD_LOCK
+  pthread_mutex_init ( &queue.lock, NULL );
+  if ( numThreads == 0 )
+    {
+#if defined(HAVE_UNISTD_H) && defined(_SC_NPROCESSORS_ONLN)
+      const long numProcs = sysconf ( _SC_NPROCESSORS_ONLN );
+      numThreads = ( numProcs > 0 ) ? (UINT4) numProcs : 1;
+#else
+      numThreads = 1;
+#endif
+    }
+  if ( numThreads > numFiles ) {
+    numThreads = numFiles;
+  }
+
+  /* start helper threads; if some cannot be started, the others take over their share */
+  pthread_t *threads = NULL;
+  UINT4 numStarted = 0;
+  if ( numThreads > 1 && (threads = LALCalloc ( numThreads - 1, sizeof( threads[0] ) )) != NULL )
+    {
+      while ( numStarted < numThreads - 1 && pthread_create ( &threads[numStarted], NULL, read_SFT_file_headers_thread, &queue ) == 0 ) {
+        numStarted ++;
+      }
+    }
+  read_SFT_file_headers_thread ( &queue );
+  for ( UINT4 k = 0; k < numStarted; k ++ ) {
+    pthread_join ( threads[k], NULL );
+  }
+  XLALFree ( threads );
+  pthread_mutex_destroy ( &queue.lock );
+#else
+  (void) numThreads;
+  read_SFT_file_headers_thread ( &queue );
+#endif
+
+} /* read_all_SFT_file_headers() */
+
+
+/* free an array of SFT-file headers, including any descriptors left in it */
+static void
+destroy_SFT_file_headers ( SFTFileHeaders *files, UINT4 numFiles )
+{
+  if ( files == NULL ) {
+    return;
+  }
+  for ( UINT4 i = 0; i < numFiles; i ++ )
+    {
+      for ( UINT4 j = 0; j < files[i].length; j ++ )
+        {
+          SFTDescriptor *desc = &(files[i].data[j]);
+          if ( desc->locator ) {
+            XLALFree ( desc->locator->fname );
+            XLALFree ( desc->locator );
+          }
+          XLALFree ( desc->comment );
+        }
+      XLALFree ( files[i].data );
+      XLALFree ( files[i].fname );
+    }
+  XLALFree ( files );
+} /* destroy_SFT_file_headers() */
+
+
+/* comparison function for SFT-file headers: sort by file name */
+static int
+compareSFTFileHeaders ( const void *ptr1, const void *ptr2 )
+{
+  const SFTFileHeaders *file1 = (const SFTFileHeaders *) ptr1;
+  const SFTFileHeaders *file2 = (const SFTFileHeaders *) ptr2;
+  return strcmp ( file1->fname, file2->fname );
+} /* compareSFTFileHeaders() */
+
+
+/* Read an SFT catalog cache written by write_SFT_catalog_cache(). A missing, invalid,
+ * or truncated cache file results in an empty cache, and is not an error.
+ */
+static int
+read_SFT_catalog_cache ( SFTCatalogCache *cache, const CHAR *cache_fname )
+{
+  XLAL_INIT_MEM ( (*cache) );
+
+  FILE *fp;
+  if ( (fp = fopen ( cache_fname, "rb" )) == NULL )
+    {
+      XLALPrintInfo ( "%s: SFT catalog cache '%s' does not exist yet\n", __func__, cache_fname );
+      return XLAL_SUCCESS;
+    }
+
+#define READ_CACHE(ptr, n) if ( fread ( (ptr), sizeof( *(ptr) ), (n), fp ) != (size_t)(n) ) goto invalid
+
+  CHAR magic[sizeof(SFT_CATALOG_CACHE_MAGIC)];
+  UINT4 endian, numFiles;
+  READ_CACHE ( magic, sizeof(magic) );
+  READ_CACHE ( &endian, 1 );
+  READ_CACHE ( &numFiles, 1 );
+  if ( memcmp ( magic, SFT_CATALOG_CACHE_MAGIC, sizeof(magic) ) != 0 || endian != SFT_CATALOG_CACHE_ENDIAN ) {
+    goto invalid;
+  }
+
+  UINT4 capacity = 0;
+  for ( UINT4 i = 0; i < numFiles; i ++ )
+    {
+      if ( cache->length == capacity )
+        {
+          capacity = ( capacity > 0 ) ? 2 * capacity : 64;
+          SFTFileHeaders *files = LALRealloc ( cache->files, capacity * sizeof( cache->files[0] ) );
+          if ( files == NULL ) {
+            goto nomem;
+          }
+          cache->files = files;
+        }
+      SFTFileHeaders *file = &(cache->files[cache->length ++]);
+      XLAL_INIT_MEM ( (*file) );
+
+      UINT4 fname_len;
+      READ_CACHE ( &fname_len, 1 );
+      if ( fname_len == 0 || fname_len > 65536 ) {
+        goto invalid;
+      }
+      if ( (file->fname = LALCalloc ( 1, fname_len + 1 )) == NULL ) {
+        goto nomem;
+      }
+      READ_CACHE ( file->fname, fname_len );
+      UINT4 numSFTs;
+      READ_CACHE ( &file->mtime, 1 );
+      READ_CACHE ( &file->mtime_ns, 1 );
+      READ_CACHE ( &file->size, 1 );
+      READ_CACHE ( &file->inode, 1 );
+      READ_CACHE ( &numSFTs, 1 );
+      if ( numSFTs == 0 || file->size < 0 || numSFTs > (UINT8) file->size / sizeof(_SFT_header_v2_t) ) {
+        goto invalid;
+      }
+      if ( (file->data = LALCalloc ( numSFTs, sizeof( file->data[0] ) )) == NULL ) {
+        goto nomem;
+      }
+      file->length = numSFTs;
+
+      for ( UINT4 j = 0; j < numSFTs; j ++ )
+        {
+          SFTDescriptor *desc = &(file->data[j]);
+          INT8 offset;
+          UINT4 comment_len;
+          READ_CACHE ( &offset, 1 );
+          READ_CACHE ( desc->header.name, 2 );
+          READ_CACHE ( &desc->header.epoch.gpsSeconds, 1 );
+          READ_CACHE ( &desc->header.epoch.gpsNanoSeconds, 1 );
+          READ_CACHE ( &desc->header.f0, 1 );
+          READ_CACHE ( &desc->header.deltaF, 1 );
+          READ_CACHE ( &desc->numBins, 1 );
+          READ_CACHE ( &desc->version, 1 );
+          READ_CACHE ( &desc->crc64, 1 );
+          READ_CACHE ( &comment_len, 1 );
+          if ( comment_len > (UINT8) file->size ) {
+            goto invalid;
+          }
+          if ( (desc->locator = LALCalloc ( 1, sizeof( *(desc->locator) ) )) == NULL
+               || (desc->locator->fname = LALMalloc ( fname_len + 1 )) == NULL ) {
+            goto nomem;
+          }
+          strcpy ( desc->locator->fname, file->fname );
+          desc->locator->offset = offset;
+          if ( comment_len > 0 )
+            {
+              if ( (desc->comment = LALCalloc ( 1, comment_len )) == NULL ) {
+                goto nomem;
+              }
+              READ_CACHE ( desc->comment, comment_len );
+              if ( desc->comment[comment_len - 1] != 0 ) {
+                goto invalid;
+              }
+            }
+        }
+    }
+
+#undef READ_CACHE
+
+  if ( fgetc ( fp ) != EOF ) {
+    goto invalid;
+  }
+  fclose ( fp );
+
+  /* sort cache by file name for lookup */
+  qsort ( cache->files, cache->length, sizeof( cache->files[0] ), compareSFTFileHeaders );
+  for ( UINT4 i = 1; i < cache->length; i ++ )
+    {
+      if ( compareSFTFileHeaders ( &cache->files[i-1], &cache->files[i] ) == 0 )
+        {
+          fp = NULL;
+          goto invalid;
+        }
+    }
+
+  return XLAL_SUCCESS;
+
+ invalid:
+  XLALPrintWarning ( "%s: ignoring invalid SFT catalog cache '%s'\n", __func__, cache_fname );
+  if ( fp != NULL ) {
+    fclose ( fp );
+  }
+  destroy_SFT_file_headers ( cache->files, cache->length );
+  XLAL_INIT_MEM ( (*cache) );
+  return XLAL_SUCCESS;
+
+ nomem:
+  fclose ( fp );
+  destroy_SFT_file_headers ( cache->files, cache->length );
+  XLAL_INIT_MEM ( (*cache) );
+  XLAL_ERROR ( XLAL_ENOMEM );
+
+} /* read_SFT_catalog_cache() */
+
+
+/* Write the headers of all given SFT-files, and of all files in the previous cache which
+ * were not among them, to an SFT catalog cache. The cache is written to a temporary file
+ * which is then renamed, so that concurrent readers never see a partially-written cache.
+ * NOTE: numbers are written in the byte-order of this machine.
+ */
+static int
+write_SFT_catalog_cache ( const CHAR *cache_fname, const SFTFileHeaders *files, UINT4 numFiles, const SFTCatalogCache *cache )
+{
+  /* keep entries of the previous cache for files not given here */
+  BOOLEAN *keep = NULL;
+  UINT4 numCacheFiles = numFiles;
+  if ( cache->length > 0 )
+    {
+      XLAL_CHECK ( (keep = XLALMalloc ( cache->length * sizeof( keep[0] ) )) != NULL, XLAL_ENOMEM );
+      for ( UINT4 i = 0; i < cache->length; i ++ ) {
+        keep[i] = TRUE;
+      }
+      for ( UINT4 i = 0; i < numFiles; i ++ )
+        {
+          const SFTFileHeaders *cached = bsearch ( &files[i], cache->files, cache->length, sizeof( cache->files[0] ), compareSFTFileHeaders );
+          if ( cached != NULL ) {
+            keep[cached - cache->files] = FALSE;
+          }
+        }
+      for ( UINT4 i = 0; i < cache->length; i ++ ) {
+        numCacheFiles += keep[i];
+      }
+    }
+
+  /* write cache to a temporary file */
+  CHAR *tmp_fname;
+#ifdef HAVE_UNISTD_H
+  tmp_fname = XLALStringAppendFmt ( NULL, "%s.tmp.%ld", cache_fname, (long) getpid() );
+#else
+  tmp_fname = XLALStringAppendFmt ( NULL, "%s.tmp", cache_fname );
+#endif
+  if ( tmp_fname == NULL )
+    {
+      XLALFree ( keep );
+      XLAL_ERROR ( XLAL_EFUNC );
+    }
+  FILE *fp;
+  if ( (fp = fopen ( tmp_fname, "wb" )) == NULL )
+    {
+      XLALPrintError ( "ERROR: Failed to open '%s' for writing\n", tmp_fname );
+      XLALFree ( keep );
+      XLALFree ( tmp_fname );
+      XLAL_ERROR ( XLAL_EIO );
+    }
+
+  const UINT4 endian = SFT_CATALOG_CACHE_ENDIAN;
+  int failed = ( fwrite ( SFT_CATALOG_CACHE_MAGIC, sizeof(SFT_CATALOG_CACHE_MAGIC), 1, fp ) != 1
+                 || fwrite ( &endian, sizeof(endian), 1, fp ) != 1
+                 || fwrite ( &numCacheFiles, sizeof(numCacheFiles), 1, fp ) != 1 );
+  for ( UINT4 i = 0; i < numFiles && !failed; i ++ ) {
+    failed = ( write_SFT_file_headers_to_cache ( fp, &files[i] ) != XLAL_SUCCESS );
+  }
+  for ( UINT4 i = 0; i < cache->length && !failed; i ++ ) {
+    if ( keep[i] ) {
+      failed = ( write_SFT_file_headers_to_cache ( fp, &cache->files[i] ) != XLAL_SUCCESS );
+    }
+  }
+  failed = ( fclose ( fp ) != 0 ) || failed;
+  XLALFree ( keep );
+
+  /* replace cache with temporary file */
+  if ( failed || rename ( tmp_fname, cache_fname ) != 0 )
+    {
+      remove ( tmp_fname );
+      XLALFree ( tmp_fname );
+      XLAL_ERROR ( XLAL_EIO, "Failed to write SFT catalog cache '%s'\n", cache_fname );
+    }
+  XLALFree ( tmp_fname );
+
+  return XLAL_SUCCESS;
+
+} /* write_SFT_catalog_cache() */
+
+
+/* write the headers of one SFT-file to an SFT catalog cache */
+static int
+write_SFT_file_headers_to_cache ( FILE *fp, const SFTFileHeaders *file )
+{
+
+#define WRITE_CACHE(ptr, n) XLAL_CHECK ( fwrite ( (ptr), sizeof( *(ptr) ), (n), fp ) == (size_t)(n), XLAL_EIO )
+
+  const UINT4 fname_len = strlen ( file->fname );
+  WRITE_CACHE ( &fname_len, 1 );
+  WRITE_CACHE ( file->fname, fname_len );
+  WRITE_CACHE ( &file->mtime, 1 );
+  WRITE_CACHE ( &file->mtime_ns, 1 );
+  WRITE_CACHE ( &file->size, 1 );
+  WRITE_CACHE ( &file->inode, 1 );
+  WRITE_CACHE ( &file->length, 1 );
+
+  for ( UINT4 j = 0; j < file->length; j ++ )
+    {
+      const SFTDescriptor *desc = &(file->data[j]);
+      const INT8 offset = desc->locator->offset;
+      const UINT4 comment_len = ( desc->comment != NULL ) ? strlen ( desc->comment ) + 1 : 0;
+      WRITE_CACHE ( &offset, 1 );
+      WRITE_CACHE ( desc->header.name, 2 );
+      WRITE_CACHE ( &desc->header.epoch.gpsSeconds, 1 );
+      WRITE_CACHE ( &desc->header.epoch.gpsNanoSeconds, 1 );
+      WRITE_CACHE ( &desc->header.f0, 1 );
+      WRITE_CACHE ( &desc->header.deltaF, 1 );
+      WRITE_CACHE ( &desc->numBins, 1 );
+      WRITE_CACHE ( &desc->version, 1 );
+      WRITE_CACHE ( &desc->crc64, 1 );
+      WRITE_CACHE ( &comment_len, 1 );
+      if ( comment_len > 0 ) {
+        WRITE_CACHE ( desc->comment, comment_len );
+      }
+    }
+
+#undef WRITE_CACHE
+
+  return XLAL_SUCCESS;
+
+} /* write_SFT_file_headers_to_cache() */
+
+
 /* filename string is a glob-style pattern, i.e. it contains '*' or '?' or '[' */
 static BOOLEAN is_pattern(const char*c) {
   while((*c != '\0') && (*c != '*') && (*c != '?') && (*c != '['))
@@ -49,6 +49,8 @@ extern "C" {
  * - SFT-reading: XLALSFTdataFind(), XLALLoadSFTs(), XLALLoadMultiSFTs()
  * - SFT-writing: XLALWriteSFT2file(), XLALWriteSFTVector2File(), XLALWriteSFTVector2Dir()
  * - SFT-checking: XLALCheckCRCSFTCatalog(): complete check of SFT-validity including CRC64 checksum
+ * - memory-mapped SFT-reading: XLALCreateSFTCatalogIndex(), XLALLoadMultiSFTsFromIndex(), XLALLoadMultiSFTViewsFromIndex(),
+ * XLALCheckCRCSFTCatalogIndex()
  * - free SFT-catalog: XLALDestroySFTCatalog()
  * - general manipulation of SFTVectors:
  * - XLALDestroySFTVector(): free up a complete SFT-vector
@@ -97,6 +99,11 @@ extern "C" {
  * <b>Note 3:</b> XLALSFTdataFind() will refuse to return any SFTs without their detector-name
  * properly set.
  *
+ * <b>Note 4:</b> for large catalogs, XLALSFTdataFindParallel() returns the same catalog as
+ * XLALSFTdataFind(), but reads the SFT-headers with several threads, and can store them
+ * in an on-disk catalog cache, keyed by file path, modification time, size and inode, so that
+ * repeated searches over the same SFT-files do not need to read any SFT-headers.
+ *
  * The returned SFTCatalog is a vector of 'SFTDescriptor's describing one SFT, with the fields
  * - \c locator:  an opaque data-type describing where to read this SFT from.
  * - \c header:	the SFts header
@@ -129,6 +136,16 @@ extern "C" {
  * The function XLALLoadMultiSFTs() is similar to the above, except that it accepts an ::SFTCatalog with different detectors,
  * and returns corresponding multi-IFO vector of SFTVectors.
  *
+ * <h4>Repeated loading from memory-mapped SFTs</h4>
+ *
+ * Codes which load many frequency-bands from the same SFTs can instead create an ::SFTCatalogIndex
+ * from the catalogue with XLALCreateSFTCatalogIndex(). This maps each SFT-file into memory when needed, and
+ * records the file, offset, frequency-bin range and checksum status of each SFT; the number of files kept
+ * mapped is limited with XLALSetSFTCatalogIndexMaxMapped(). Frequency-bands are then
+ * loaded with XLALLoadMultiSFTsFromIndex(), which returns the same SFTs as XLALLoadMultiSFTs() without any
+ * further file I/O, or with XLALLoadMultiSFTViewsFromIndex(), which returns read-only SFTs pointing directly
+ * into the mapped SFT-files where possible. Checksums can be verified with XLALCheckCRCSFTCatalogIndex().
+ *
  * <p><h2>Usage: Writing of SFT-files</h2>
  *
  * For <b>writing SFTs</b>:
@@ -273,6 +290,9 @@ typedef struct tagMultiSFTCatalogView
 } MultiSFTCatalogView;
 
 
+/** An index of the SFTs in an SFT-catalogue, with the SFT-files mapped into memory [opaque] */
+typedef struct tagSFTCatalogIndex SFTCatalogIndex;
+
 /*---------- Global variables ----------*/
 
 /*
@@ -287,6 +307,7 @@ UINT4 XLALRoundFrequencyUpToSFTBin( const REAL8 freq, const REAL8 df );
 LALStringVector *XLALFindFiles (const CHAR *globstring);
 
 SFTCatalog *XLALSFTdataFind ( const CHAR *file_pattern, const SFTConstraints *constraints );
+SFTCatalog *XLALSFTdataFindParallel ( const CHAR *file_pattern, const SFTConstraints *constraints, UINT4 numThreads, const CHAR *cache_fname );
 
 int XLALWriteSFTVector2Dir  ( const SFTVector *sftVect, const CHAR *dirname, const CHAR *SFTcomment, const CHAR *Misc );
 int XLALWriteSFTVector2File ( const SFTVector *sftVect, const CHAR *dirname, const CHAR *SFTcomment, const CHAR *Misc );
@@ -308,6 +329,16 @@ MultiSFTVector *XLALLoadMultiSFTsFromView ( const MultiSFTCatalogView *multiCata
 
 int XLALCheckCRCSFTCatalog( BOOLEAN *crc_check, SFTCatalog *catalog );
 
+SFTCatalogIndex *XLALCreateSFTCatalogIndex ( const SFTCatalog *catalog );
+void XLALDestroySFTCatalogIndex ( SFTCatalogIndex *index );
+int XLALSetSFTCatalogIndexMaxMapped ( SFTCatalogIndex *index, UINT4 maxMapped );
+int XLALCheckCRCSFTCatalogIndex ( BOOLEAN *crc_check, SFTCatalogIndex *index );
+MultiSFTVector *XLALLoadMultiSFTsFromIndex ( SFTCatalogIndex *index, REAL8 fMin, REAL8 fMax );
+#ifndef SWIG /* exclude from SWIG interface: views point into read-only memory */
+MultiSFTVector *XLALLoadMultiSFTViewsFromIndex ( SFTCatalogIndex *index, REAL8 fMin, REAL8 fMax );
+void XLALDestroyMultiSFTViews ( MultiSFTVector *multiViews );
+#endif /* SWIG */
+
 void XLALDestroySFTCatalog ( SFTCatalog *catalog );
 LALStringVector *XLALListIFOsInCatalog( const SFTCatalog *catalog );
 INT4 XLALCountIFOsInCatalog( const SFTCatalog *catalog );
@@ -20,10 +20,13 @@
  */
 
 /*---------- INCLUDES ----------*/
+#include <config.h>
+
 #include <math.h>
 
 #include <lal/SSBtimes.h>
 #include <lal/AVFactories.h>
+#include <lal/LALSIMD.h>
 
 /* GSL includes */
 #include <lal/LALGSL.h>
@@ -31,6 +34,10 @@
 
 /*---------- local DEFINES ----------*/
 
+/* amplitude of the Shapiro delay and radius of the Sun in seconds, as used by XLALBarycenter() */
+#define SHAPIRO_AMPL	9.852e-6
+#define SHAPIRO_RSUN	2.322
+
 /*----- Macros ----- */
 
 /** Simple Euklidean scalar product for two 3-dim vectors in cartesian coords */
@@ -45,10 +52,44 @@ const UserChoices SSBprecisionChoices = {
   { SSBPREC_DMOFF,              "DMoff"},
 };
 
+/*---------- internal types ----------*/
+
+/* Sky-independent SSB-timing quantities of a single detector, stored as structure-of-arrays.
+ * For a source in direction n, the SSB timing at timestamp i is
+ *   DeltaT[i] = T0[i] + SCALAR(n, R[.][i]) - shapiro[i],
+ *   Tdot[i]   = Tdot0[i] + SCALAR(n, V[.][i]) - dshapiro[i],
+ * where the Shapiro delay depends on n only through SCALAR(n, se[.][i]) and SCALAR(n, dse[.][i]).
+ */
+typedef struct tagSSBtimesPlanSeries {
+  UINT4 length;			/* number of timestamps */
+  REAL8 *block;			/* memory block holding all arrays below */
+  REAL8 *T0;			/* sky-independent part of DeltaT: t_i - refTime, plus Einstein and observatory delays */
+  REAL8 *Tdot0;			/* sky-independent part of Tdot */
+  REAL8 *R[3];			/* Roemer and Earth-rotation delay is SCALAR(n, R) */
+  REAL8 *V[3];			/* ... and its time-derivative is SCALAR(n, V) */
+  REAL8 *se[3];			/* vector from Sun to Earth, for the Shapiro delay */
+  REAL8 *dse[3];		/* ... and its time-derivative */
+  REAL8 *rse;			/* length of vector from Sun to Earth */
+  REAL8 *drse;			/* ... and its time-derivative */
+} SSBtimesPlanSeries;
+
+struct tagMultiSSBtimesPlan {
+  LIGOTimeGPS refTime;		/* SSB reference-time T_0 for SSB-timing */
+  SSBprecision precision;	/* precision of the SSB transformation */
+  UINT4 length;			/* number of detectors */
+  SSBtimesPlanSeries *data;	/* sky-independent quantities for each detector */
+};
+
 /*---------- internal prototypes ----------*/
 
 static double gsl_E_solver ( double E, void *p );
 
+#ifdef HAVE_AVX2_COMPILER
+int XLALSSBtimesBatchKernel_AVX2 ( REAL8 *DeltaT, REAL8 *Tdot, REAL8 *seDotN, const REAL8 n[3], const UINT4 length,
+                                   const REAL8 *T0, const REAL8 *Tdot0, REAL8 *const R[3], REAL8 *const V[3],
+                                   REAL8 *const se[3], REAL8 *const dse[3], const REAL8 *rse, const REAL8 *drse );
+#endif
+
 struct E_solver_params {
   double A, B, x0;
 };
@@ -699,6 +740,343 @@ XLALGetMultiSSBtimes ( const MultiDetectorStateSeries *multiDetStates, /**< [in]
 
 } /* XLALGetMultiSSBtimes() */
 
+/* fill the sky-independent SSB-timing quantities of a single detector */
+static int
+XLALFillSSBtimesPlanSeries ( SSBtimesPlanSeries *series,			/* [out] sky-independent quantities */
+                             const DetectorStateSeries *DetectorStates,	/* [in] detector-states at timestamps t_i */
+                             LIGOTimeGPS refTime,				/* [in] SSB reference-time T_0 */
+                             SSBprecision precision				/* [in] precision of the SSB transformation */
+                             )
+{
+  const UINT4 numSteps = DetectorStates->length;
+  series->length = numSteps;
+
+  /* allocate all arrays in one block */
+  series->block = XLALCalloc ( 16 * numSteps + 1, sizeof ( series->block[0] ) );
+  XLAL_CHECK ( series->block != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(%d,%zu)\n", 16 * numSteps + 1, sizeof ( series->block[0] ) );
+  REAL8 *p = series->block;
+  series->T0 = p; p += numSteps;
+  series->Tdot0 = p; p += numSteps;
+  for ( UINT4 j = 0; j < 3; j++ )
+    {
+      series->R[j] = p; p += numSteps;
+      series->V[j] = p; p += numSteps;
+      series->se[j] = p; p += numSteps;
+      series->dse[j] = p; p += numSteps;
+    }
+  series->rse = p; p += numSteps;
+  series->drse = p;
+
+  BarycenterInput XLAL_INIT_DECL(baryinput);
+  BarycenterBuffer *bBuffer = NULL;
+
+  switch (precision)
+    {
+    case SSBPREC_NEWTONIAN:	/* DeltaT = SCALAR(n, rDetector), Tdot = 1 + SCALAR(n, vDetector) */
+
+      for ( UINT4 i = 0; i < numSteps; i++ )
+        {
+          const DetectorState *state = &(DetectorStates->data[i]);
+          series->T0[i] = XLALGPSDiff ( &state->tGPS, &refTime );
+          series->Tdot0[i] = 1.0;
+          for ( UINT4 j = 0; j < 3; j++ )
+            {
+              series->R[j][i] = state->rDetector[j];
+              series->V[j][i] = state->vDetector[j];
+            }
+        } /* for i < numSteps */
+
+      break;
+
+    case SSBPREC_RELATIVISTIC:
+    case SSBPREC_RELATIVISTICOPT:
+
+      baryinput.site = DetectorStates->detector;
+      baryinput.site.location[0] /= LAL_C_SI;
+      baryinput.site.location[1] /= LAL_C_SI;
+      baryinput.site.location[2] /= LAL_C_SI;
+      baryinput.dInv = 0;
+
+      /* The Roemer and Earth-rotation delays (including precession and nutation) computed by XLALBarycenter()
+       * are linear in the source unit-vector n, so we obtain R and V by evaluating them for sky-positions along
+       * each Cartesian axis. The remaining sky-independent delays are found by subtracting the sky-dependent
+       * delays from the total delay.
+       */
+      for ( UINT4 i = 0; i < numSteps; i++ )
+        {
+          const DetectorState *state = &(DetectorStates->data[i]);
+          baryinput.tgps = state->tGPS;
+
+          const REAL8 axes[3][2] = { { 0, 0 }, { LAL_PI_2, 0 }, { 0, LAL_PI_2 } };
+          for ( UINT4 j = 0; j < 3; j++ )
+            {
+              EmissionTime emit;
+              baryinput.alpha = axes[j][0];
+              baryinput.delta = axes[j][1];
+              XLAL_CHECK ( XLALBarycenterOpt ( &emit, &baryinput, &(state->earthState), &bBuffer ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+              series->R[j][i] = emit.roemer + emit.erot;
+              series->V[j][i] = emit.droemer + emit.derot;
+              if ( j == 0 )
+                {
+                  series->T0[i] = XLALGPSDiff ( &state->tGPS, &refTime ) + ( emit.deltaT - emit.roemer - emit.erot + emit.shapiro );
+                  series->Tdot0[i] = emit.tDot - emit.droemer - emit.derot + emit.dshapiro;
+                }
+            }
+
+          for ( UINT4 j = 0; j < 3; j++ )
+            {
+              series->se[j][i] = state->earthState.se[j];
+              series->dse[j][i] = state->earthState.dse[j];
+            }
+          series->rse[i] = state->earthState.rse;
+          series->drse[i] = state->earthState.drse;
+
+        } /* for i < numSteps */
+      XLALFree ( bBuffer );
+
+      break;
+
+    case SSBPREC_DMOFF:	/* switch off all demodulation terms */
+
+      for ( UINT4 i = 0; i < numSteps; i++ )
+        {
+          series->T0[i] = XLALGPSDiff ( &DetectorStates->data[i].tGPS, &refTime );
+          series->Tdot0[i] = 1.0;
+        } /* for i < numSteps */
+
+      break;
+
+    default:
+      XLAL_ERROR ( XLAL_EFAILED, "\n?? Something went wrong.. this should never be called!\n\n" );
+      break;
+    } /* switch precision */
+
+  return XLAL_SUCCESS;
+
+} /* XLALFillSSBtimesPlanSeries() */
+
+/** Precompute the sky-independent quantities required to compute SSB-timings for the given detector-states,
+ * for use with XLALGetMultiSSBtimesBatch().
+ *
+ * NOTE: this functions *allocates* the plan, use XLALDestroyMultiSSBtimesPlan() to free this.
+ */
+MultiSSBtimesPlan *
+XLALCreateMultiSSBtimesPlan ( const MultiDetectorStateSeries *multiDetStates, /**< [in] detector-states at timestamps t_i */
+                              LIGOTimeGPS refTime,		/**< SSB reference-time T_0 for SSB-timing */
+                              SSBprecision precision		/**< use relativistic or Newtonian SSB timing?  */
+                              )
+{
+  /* check input */
+  XLAL_CHECK_NULL ( multiDetStates != NULL, XLAL_EINVAL, "Invalid NULL input 'multiDetStates'\n");
+  XLAL_CHECK_NULL ( multiDetStates->length > 0, XLAL_EINVAL, "Invalid zero-length 'multiDetStates'\n");
+  XLAL_CHECK_NULL ( precision < SSBPREC_LAST, XLAL_EDOM, "Invalid value precision=%d, allowed are [0, %d]\n", precision, SSBPREC_LAST -1 );
+
+  UINT4 numDetectors = multiDetStates->length;
+
+  // prepare return struct
+  int len;
+  MultiSSBtimesPlan *ret = XLALCalloc ( 1, len = sizeof( *ret ) );
+  XLAL_CHECK_NULL ( ret != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(1,%d)\n", len );
+  ret->refTime = refTime;
+  ret->precision = precision;
+  ret->length = numDetectors;
+  ret->data = XLALCalloc ( numDetectors, len = sizeof ( *ret->data ) );
+  if ( ret->data == NULL )
+    {
+      XLALFree ( ret );
+      XLAL_ERROR_NULL ( XLAL_ENOMEM, "Failed to XLALCalloc(%d,%d)\n", numDetectors, len );
+    }
+
+  // loop over detectors
+  for ( UINT4 X = 0; X < numDetectors; X ++ )
+    {
+      if ( XLALFillSSBtimesPlanSeries ( &ret->data[X], multiDetStates->data[X], refTime, precision ) != XLAL_SUCCESS )
+        {
+          XLALDestroyMultiSSBtimesPlan ( ret );
+          XLAL_ERROR_NULL ( XLAL_EFUNC, "XLALFillSSBtimesPlanSeries() failed for detector X=%d\n", X );
+        }
+    } /* for X < numDet */
+
+  return ret;
+
+} /* XLALCreateMultiSSBtimesPlan() */
+
+/* compute DeltaT, Tdot, and (if se != NULL) SCALAR(n, se) for one sky-position, excluding the Shapiro delay in DeltaT */
+static int
+XLALSSBtimesBatchKernel ( REAL8 *DeltaT, REAL8 *Tdot, REAL8 *seDotN, const REAL8 n[3], const UINT4 length,
+                          const REAL8 *T0, const REAL8 *Tdot0, REAL8 *const R[3], REAL8 *const V[3],
+                          REAL8 *const se[3], REAL8 *const dse[3], const REAL8 *rse, const REAL8 *drse )
+{
+
+#ifdef HAVE_AVX2_COMPILER
+  if ( LAL_HAVE_AVX2_RUNTIME() )
+    {
+      XLAL_CHECK ( XLALSSBtimesBatchKernel_AVX2 ( DeltaT, Tdot, seDotN, n, length, T0, Tdot0, R, V, se, dse, rse, drse ) == XLAL_SUCCESS, XLAL_EFUNC );
+      return XLAL_SUCCESS;
+    }
+#endif
+
+  for ( UINT4 i = 0; i < length; i++ )
+    {
+      DeltaT[i] = T0[i] + ( n[0] * R[0][i] + n[1] * R[1][i] + n[2] * R[2][i] );
+      Tdot[i] = Tdot0[i] + ( n[0] * V[0][i] + n[1] * V[1][i] + n[2] * V[2][i] );
+    }
+  if ( se != NULL )
+    {
+      for ( UINT4 i = 0; i < length; i++ )
+        {
+          const REAL8 sN = n[0] * se[0][i] + n[1] * se[1][i] + n[2] * se[2][i];
+          const REAL8 dsN = n[0] * dse[0][i] + n[1] * dse[1][i] + n[2] * dse[2][i];
+          seDotN[i] = sN;
+          Tdot[i] += SHAPIRO_AMPL * ( drse[i] + dsN ) / ( rse[i] + sN );
+        }
+    }
+
+  return XLAL_SUCCESS;
+
+} /* XLALSSBtimesBatchKernel() */
+
+/** Batched version of XLALGetMultiSSBtimes().
+ * Get all SSB-timings for all detectors, for each of many sky-positions, using the sky-independent quantities
+ * precomputed by XLALCreateMultiSSBtimesPlan(). For each sky-position, the SSB-timings are computed with
+ * vectorized loops over timestamps, and agree with those of XLALGetMultiSSBtimes() to within the precision (~1e-7 s)
+ * with which XLALGetSSBtimes() subtracts the reference time from GPS times in REAL8.
+ *
+ * NOTE: the output-vector \a multiSSB has one element for each sky-position; NULL elements are allocated here,
+ * and non-NULL elements (e.g. from a previous call) are re-used. Use XLALDestroyMultiSSBtimes() to free each element.
+ */
+int
+XLALGetMultiSSBtimesBatch ( MultiSSBtimes **multiSSB,		/**< [in/out] SSB-timings for each sky-position */
+                            const MultiSSBtimesPlan *plan,	/**< [in] sky-independent quantities from XLALCreateMultiSSBtimesPlan() */
+                            const SkyPosition *skypos,		/**< [in] source sky-positions [in equatorial coords!] */
+                            UINT4 numSkyPoints			/**< [in] number of sky-positions */
+                            )
+{
+  /* check input */
+  XLAL_CHECK ( multiSSB != NULL, XLAL_EINVAL, "Invalid NULL input 'multiSSB'\n" );
+  XLAL_CHECK ( plan != NULL, XLAL_EINVAL, "Invalid NULL input 'plan'\n" );
+  XLAL_CHECK ( skypos != NULL, XLAL_EINVAL, "Invalid NULL input 'skypos'\n" );
+
+  const UINT4 numDetectors = plan->length;
+  const BOOLEAN relativistic = ( plan->precision == SSBPREC_RELATIVISTIC || plan->precision == SSBPREC_RELATIVISTICOPT );
+
+  /* check sky-positions, and allocate or check output */
+  UINT4 maxNumSteps = 0;
+  for ( UINT4 X = 0; X < numDetectors; X ++ )
+    {
+      maxNumSteps = ( plan->data[X].length > maxNumSteps ) ? plan->data[X].length : maxNumSteps;
+    }
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      XLAL_CHECK ( skypos[s].system == COORDINATESYSTEM_EQUATORIAL, XLAL_EDOM, "Only equatorial coordinate system (=%d) allowed, got %d\n", COORDINATESYSTEM_EQUATORIAL, skypos[s].system );
+      if ( relativistic )
+        {
+          XLAL_CHECK ( fabs(skypos[s].longitude) <= LAL_TWOPI, XLAL_EDOM, "alpha = %f outside of allowed range [-2pi,2pi]\n", skypos[s].longitude );
+          XLAL_CHECK ( fabs(skypos[s].latitude) <= LAL_PI_2,  XLAL_EDOM, "delta = %f outside of allowed range [-pi/2,pi/2]\n", skypos[s].latitude );
+        }
+      if ( multiSSB[s] == NULL )
+        {
+          int len;
+          XLAL_CHECK ( ( multiSSB[s] = XLALCalloc ( 1, len = sizeof( *multiSSB[s] ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(1,%d)\n", len );
+          multiSSB[s]->length = numDetectors;
+          XLAL_CHECK ( ( multiSSB[s]->data = XLALCalloc ( numDetectors, len = sizeof ( *multiSSB[s]->data ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(%d,%d)\n", numDetectors, len );
+          for ( UINT4 X = 0; X < numDetectors; X ++ )
+            {
+              const UINT4 numSteps = plan->data[X].length;
+              XLAL_CHECK ( ( multiSSB[s]->data[X] = XLALCalloc ( 1, len = sizeof( *multiSSB[s]->data[X] ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(1,%d)\n", len );
+              XLAL_CHECK ( ( multiSSB[s]->data[X]->DeltaT = XLALCreateREAL8Vector ( numSteps ) ) != NULL, XLAL_EFUNC, "XLALCreateREAL8Vector(%d) failed\n", numSteps );
+              XLAL_CHECK ( ( multiSSB[s]->data[X]->Tdot = XLALCreateREAL8Vector ( numSteps ) ) != NULL, XLAL_EFUNC, "XLALCreateREAL8Vector(%d) failed\n", numSteps );
+            }
+        }
+      else
+        {
+          XLAL_CHECK ( multiSSB[s]->length == numDetectors, XLAL_EINVAL, "Inconsistent number of detectors in multiSSB[%d]: %d != %d\n", s, multiSSB[s]->length, numDetectors );
+          for ( UINT4 X = 0; X < numDetectors; X ++ )
+            {
+              const SSBtimes *tSSB = multiSSB[s]->data[X];
+              XLAL_CHECK ( tSSB != NULL && tSSB->DeltaT != NULL && tSSB->Tdot != NULL, XLAL_EINVAL, "Invalid NULL SSB-timings in multiSSB[%d]->data[%d]\n", s, X );
+              XLAL_CHECK ( tSSB->DeltaT->length == plan->data[X].length && tSSB->Tdot->length == plan->data[X].length, XLAL_EINVAL,
+                           "Inconsistent number of timestamps in multiSSB[%d]->data[%d]\n", s, X );
+            }
+        }
+      for ( UINT4 X = 0; X < numDetectors; X ++ )
+        {
+          multiSSB[s]->data[X]->refTime = plan->refTime;
+        }
+    } /* for s < numSkyPoints */
+
+  /* workspace for Shapiro delay */
+  REAL8 *seDotN = NULL;
+  if ( relativistic )
+    {
+      XLAL_CHECK ( ( seDotN = XLALMalloc ( ( maxNumSteps + 1 ) * sizeof ( seDotN[0] ) ) ) != NULL, XLAL_ENOMEM );
+    }
+
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ )
+    {
+      const REAL8 alpha = skypos[s].longitude;
+      const REAL8 delta = skypos[s].latitude;
+
+      /*----- get the cartesian source unit-vector, as computed by XLALGetSSBtimes() and XLALBarycenterOpt() */
+      REAL8 n[3];
+      if ( relativistic )
+        {
+          const REAL8 sinDelta = cos ( LAL_PI/2.0 - delta );
+          const REAL8 cosDelta = sin ( LAL_PI/2.0 - delta );
+          n[0] = cosDelta * cos ( alpha );
+          n[1] = cosDelta * sin ( alpha );
+          n[2] = sinDelta;
+        }
+      else
+        {
+          n[0] = cos(alpha) * cos(delta);
+          n[1] = sin(alpha) * cos(delta);
+          n[2] = sin(delta);
+        }
+
+      for ( UINT4 X = 0; X < numDetectors; X ++ )
+        {
+          const SSBtimesPlanSeries *series = &plan->data[X];
+          REAL8 *DeltaT = multiSSB[s]->data[X]->DeltaT->data;
+          REAL8 *Tdot = multiSSB[s]->data[X]->Tdot->data;
+
+          XLAL_CHECK ( XLALSSBtimesBatchKernel ( DeltaT, Tdot, seDotN, n, series->length, series->T0, series->Tdot0, series->R, series->V,
+                                                 relativistic ? series->se : NULL, series->dse, series->rse, series->drse ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+          if ( relativistic )
+            {
+              /* add Shapiro delay, as computed by XLALBarycenter() */
+              for ( UINT4 i = 0; i < series->length; i++ )
+                {
+                  const REAL8 rse = series->rse[i];
+                  const REAL8 sN = seDotN[i];
+                  const REAL8 b = sqrt ( rse * rse - sN * sN );
+                  if ( ( b < SHAPIRO_RSUN ) && ( sN < 0 ) )
+                    {
+                      /* if gw travels thru interior of Sun: recompute Tdot without the Shapiro delay derivative added by kernel */
+                      const REAL8 dsN = n[0] * series->dse[0][i] + n[1] * series->dse[1][i] + n[2] * series->dse[2][i];
+                      const REAL8 db = ( rse * series->drse[i] - sN * dsN ) / b;
+                      DeltaT[i] -= SHAPIRO_AMPL * log ( (LAL_AU_SI/LAL_C_SI) / ( sN + sqrt ( SHAPIRO_RSUN*SHAPIRO_RSUN + sN*sN ) ) ) + 2.0 * SHAPIRO_AMPL * ( 1.0 - b / SHAPIRO_RSUN );
+                      Tdot[i] = series->Tdot0[i] + ( n[0] * series->V[0][i] + n[1] * series->V[1][i] + n[2] * series->V[2][i] ) + 2.0 * SHAPIRO_AMPL * db / SHAPIRO_RSUN;
+                    }
+                  else
+                    {
+                      DeltaT[i] -= SHAPIRO_AMPL * log ( (LAL_AU_SI/LAL_C_SI) / ( rse + sN ) );
+                    }
+                } /* for i < numSteps */
+            }
+
+        } /* for X < numDetectors */
+
+    } /* for s < numSkyPoints */
+
+  XLALFree ( seDotN );
+
+  return XLAL_SUCCESS;
+
+} /* XLALGetMultiSSBtimesBatch() */
+
 /** Find the earliest timestamp in a multi-SSB data structure
  *
 */
@@ -877,3 +1255,28 @@ XLALDestroyMultiSSBtimes ( MultiSSBtimes *multiSSB )
   return;
 
 } /* XLALDestroyMultiSSBtimes() */
+
+/** Destroy a MultiSSBtimesPlan structure.
+ * Note, this is "NULL-robust" in the sense that it will not crash
+ * on NULL-entries anywhere in this struct, so it can be used
+ * for failure-cleanup even on incomplete structs
+ */
+void
+XLALDestroyMultiSSBtimesPlan ( MultiSSBtimesPlan *plan )
+{
+  if ( ! plan )
+    return;
+
+  if ( plan->data )
+    {
+      for ( UINT4 X = 0; X < plan->length; X ++ )
+        {
+          XLALFree ( plan->data[X].block );
+        }
+      XLALFree ( plan->data );
+    }
+  XLALFree ( plan );
+
+  return;
+
+} /* XLALDestroyMultiSSBtimesPlan() */
@@ -69,6 +69,11 @@ typedef struct tagMultiSSBtimes {
   SSBtimes **data;	/**< array of SSBtimes (pointers) */
 } MultiSSBtimes;
 
+/** Sky-independent quantities precomputed from a set of detector-states by XLALCreateMultiSSBtimesPlan(),
+ * for computing the SSB-timings of many sky-positions with XLALGetMultiSSBtimesBatch()
+ */
+typedef struct tagMultiSSBtimesPlan MultiSSBtimesPlan;
+
 /*---------- exported Global variables ----------*/
 
 /*---------- exported prototypes [API] ----------*/
@@ -80,12 +85,18 @@ MultiSSBtimes *XLALDuplicateMultiSSBtimes ( const MultiSSBtimes *multiSSB );
 SSBtimes *XLALGetSSBtimes ( const DetectorStateSeries *DetectorStates, SkyPosition pos, LIGOTimeGPS refTime, SSBprecision precision );
 MultiSSBtimes *XLALGetMultiSSBtimes ( const MultiDetectorStateSeries *multiDetStates, SkyPosition skypos, LIGOTimeGPS refTime, SSBprecision precision);
 
+MultiSSBtimesPlan *XLALCreateMultiSSBtimesPlan ( const MultiDetectorStateSeries *multiDetStates, LIGOTimeGPS refTime, SSBprecision precision );
+#ifndef SWIG // exclude from SWIG interface
+int XLALGetMultiSSBtimesBatch ( MultiSSBtimes **multiSSB, const MultiSSBtimesPlan *plan, const SkyPosition *skypos, UINT4 numSkyPoints );
+#endif // SWIG
+
 int XLALEarliestMultiSSBtime ( LIGOTimeGPS *out, const MultiSSBtimes *multiSSB, const REAL8 Tsft );
 int XLALLatestMultiSSBtime ( LIGOTimeGPS *out, const MultiSSBtimes *multiSSB,  const REAL8 Tsft );
 
 /* destructors */
 void XLALDestroySSBtimes ( SSBtimes *multiSSB );
 void XLALDestroyMultiSSBtimes ( MultiSSBtimes *multiSSB );
+void XLALDestroyMultiSSBtimesPlan ( MultiSSBtimesPlan *plan );
 
 /** @} */
 
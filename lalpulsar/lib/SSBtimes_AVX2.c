@@ -0,0 +1,102 @@
+//
+// Copyright (C) 2026
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+// MA  02111-1307  USA
+//
+
+#include <immintrin.h>
+
+#include <lal/LALStdlib.h>
+
+///
+/// \file SSBtimes_AVX2.c
+/// \ingroup SSBtimes_h
+/// \brief AVX2 kernel for computing SSB-timings of a sky-position from precomputed sky-independent quantities
+///
+
+int XLALSSBtimesBatchKernel_AVX2 ( REAL8 *DeltaT, REAL8 *Tdot, REAL8 *seDotN, const REAL8 n[3], const UINT4 length,
+                                   const REAL8 *T0, const REAL8 *Tdot0, REAL8 *const R[3], REAL8 *const V[3],
+                                   REAL8 *const se[3], REAL8 *const dse[3], const REAL8 *rse, const REAL8 *drse );
+
+///
+/// Compute DeltaT (excluding the Shapiro delay), Tdot, and (if \c se is not \c NULL) the scalar product of the source
+/// unit-vector with the Sun-Earth vector, for 4 timestamps at a time, as in XLALGetMultiSSBtimesBatch().
+///
+int
+XLALSSBtimesBatchKernel_AVX2 ( REAL8 *DeltaT,		///< [out] SSB time offsets, excluding the Shapiro delay
+                               REAL8 *Tdot,		///< [out] SSB time derivatives
+                               REAL8 *seDotN,		///< [out] scalar product of source unit-vector with Sun-Earth vector
+                               const REAL8 n[3],	///< [in] source unit-vector
+                               const UINT4 length,	///< [in] number of timestamps
+                               const REAL8 *T0,		///< [in] sky-independent part of DeltaT
+                               const REAL8 *Tdot0,	///< [in] sky-independent part of Tdot
+                               REAL8 *const R[3],	///< [in] Roemer and Earth-rotation delay vectors
+                               REAL8 *const V[3],	///< [in] time-derivatives of R
+                               REAL8 *const se[3],	///< [in] Sun-Earth vectors, or \c NULL to omit the Shapiro delay
+                               REAL8 *const dse[3],	///< [in] time-derivatives of se
+                               const REAL8 *rse,	///< [in] lengths of Sun-Earth vectors
+                               const REAL8 *drse	///< [in] time-derivatives of rse
+                               )
+{
+  const __m256d n0 = _mm256_set1_pd ( n[0] );
+  const __m256d n1 = _mm256_set1_pd ( n[1] );
+  const __m256d n2 = _mm256_set1_pd ( n[2] );
+
+  UINT4 i = 0;
+  if ( se == NULL )
+    {
+      for ( ; i + 4 <= length; i += 4 )
+        {
+          const __m256d nR = _mm256_add_pd ( _mm256_add_pd ( _mm256_mul_pd ( n0, _mm256_loadu_pd ( R[0] + i ) ), _mm256_mul_pd ( n1, _mm256_loadu_pd ( R[1] + i ) ) ), _mm256_mul_pd ( n2, _mm256_loadu_pd ( R[2] + i ) ) );
+          const __m256d nV = _mm256_add_pd ( _mm256_add_pd ( _mm256_mul_pd ( n0, _mm256_loadu_pd ( V[0] + i ) ), _mm256_mul_pd ( n1, _mm256_loadu_pd ( V[1] + i ) ) ), _mm256_mul_pd ( n2, _mm256_loadu_pd ( V[2] + i ) ) );
+          _mm256_storeu_pd ( DeltaT + i, _mm256_add_pd ( _mm256_loadu_pd ( T0 + i ), nR ) );
+          _mm256_storeu_pd ( Tdot + i, _mm256_add_pd ( _mm256_loadu_pd ( Tdot0 + i ), nV ) );
+        }
+    }
+  else
+    {
+      const __m256d ampl = _mm256_set1_pd ( 9.852e-6 );
+      for ( ; i + 4 <= length; i += 4 )
+        {
+          const __m256d nR = _mm256_add_pd ( _mm256_add_pd ( _mm256_mul_pd ( n0, _mm256_loadu_pd ( R[0] + i ) ), _mm256_mul_pd ( n1, _mm256_loadu_pd ( R[1] + i ) ) ), _mm256_mul_pd ( n2, _mm256_loadu_pd ( R[2] + i ) ) );
+          const __m256d nV = _mm256_add_pd ( _mm256_add_pd ( _mm256_mul_pd ( n0, _mm256_loadu_pd ( V[0] + i ) ), _mm256_mul_pd ( n1, _mm256_loadu_pd ( V[1] + i ) ) ), _mm256_mul_pd ( n2, _mm256_loadu_pd ( V[2] + i ) ) );
+          const __m256d sN = _mm256_add_pd ( _mm256_add_pd ( _mm256_mul_pd ( n0, _mm256_loadu_pd ( se[0] + i ) ), _mm256_mul_pd ( n1, _mm256_loadu_pd ( se[1] + i ) ) ), _mm256_mul_pd ( n2, _mm256_loadu_pd ( se[2] + i ) ) );
+          const __m256d dsN = _mm256_add_pd ( _mm256_add_pd ( _mm256_mul_pd ( n0, _mm256_loadu_pd ( dse[0] + i ) ), _mm256_mul_pd ( n1, _mm256_loadu_pd ( dse[1] + i ) ) ), _mm256_mul_pd ( n2, _mm256_loadu_pd ( dse[2] + i ) ) );
+          // derivative of Shapiro delay, as computed by XLALBarycenter()
+          const __m256d dshapiro = _mm256_div_pd ( _mm256_mul_pd ( ampl, _mm256_add_pd ( _mm256_loadu_pd ( drse + i ), dsN ) ), _mm256_add_pd ( _mm256_loadu_pd ( rse + i ), sN ) );
+          _mm256_storeu_pd ( DeltaT + i, _mm256_add_pd ( _mm256_loadu_pd ( T0 + i ), nR ) );
+          _mm256_storeu_pd ( Tdot + i, _mm256_add_pd ( _mm256_add_pd ( _mm256_loadu_pd ( Tdot0 + i ), nV ), dshapiro ) );
+          _mm256_storeu_pd ( seDotN + i, sN );
+        }
+    }
+
+  // take care of remaining timestamps, length modulo 4
+  for ( ; i < length; i++ )
+    {
+      DeltaT[i] = T0[i] + ( n[0] * R[0][i] + n[1] * R[1][i] + n[2] * R[2][i] );
+      Tdot[i] = Tdot0[i] + ( n[0] * V[0][i] + n[1] * V[1][i] + n[2] * V[2][i] );
+      if ( se != NULL )
+        {
+          const REAL8 sN = n[0] * se[0][i] + n[1] * se[1][i] + n[2] * se[2][i];
+          const REAL8 dsN = n[0] * dse[0][i] + n[1] * dse[1][i] + n[2] * dse[2][i];
+          seDotN[i] = sN;
+          Tdot[i] += 9.852e-6 * ( drse[i] + dsN ) / ( rse[i] + sN );
+        }
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALSSBtimesBatchKernel_AVX2()
@@ -34,6 +34,7 @@
 // *available* Fstat methods against each other
 
 static int compareFstatResults ( const FstatResults *result1, const FstatResults *result2 );
+static int testComputeFstatBatch ( FstatInput *input, const PulsarDopplerParams *Doppler, const REAL8 dSky, const REAL8 df1dot, const UINT4 numFreqBins, const FstatQuantities whatToCompute );
 static int printFstatResults2File ( const FstatResults *results, const char * MethodName, const INT4 iSky, const INT4 if1dot, const INT4 iPeriod, FstatQuantities whatToCompute );
 // ---------- main ----------
 int
@@ -232,6 +233,42 @@ main ( int argc, char *argv[] )
 
     } // for iSky < numSkyPoints
 
+  // ----- test XLALComputeFstatBatch() against XLALComputeFstat() for all available methods
+  for ( UINT4 iMethod = FMETHOD_START; iMethod < FMETHOD_END; iMethod ++ )
+    {
+      if ( !XLALFstatMethodIsAvailable(iMethod) || (iMethod == FMETHOD_DEMOD_BEST) || (iMethod == FMETHOD_RESAMP_BEST) ) {
+        continue;
+      }
+      XLAL_CHECK ( testComputeFstatBatch ( input_seg1[iMethod], &Doppler, dSky, df1dot, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC,
+                   "XLALComputeFstatBatch() test failed for method '%s'", XLALGetFstatInputMethodName(input_seg1[iMethod]) );
+    }
+
+  // ----- test XLALFstatInputWorker() against the original input for all available methods
+  for ( UINT4 iMethod = FMETHOD_START; iMethod < FMETHOD_END; iMethod ++ )
+    {
+      if ( !XLALFstatMethodIsAvailable(iMethod) || (iMethod == FMETHOD_DEMOD_BEST) || (iMethod == FMETHOD_RESAMP_BEST) ) {
+        continue;
+      }
+      // workers of both segments share one workspace, as they would in one thread
+      FstatInput *worker_seg1 = NULL, *worker_seg2 = NULL;
+      XLAL_CHECK ( XLALFstatInputWorker ( &worker_seg1, input_seg1[iMethod], NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK ( XLALFstatInputWorker ( &worker_seg2, input_seg2[iMethod], worker_seg1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+      FstatResults *results_worker_seg1 = NULL, *results_worker_seg2 = NULL;
+      XLAL_CHECK ( XLALComputeFstat ( &results_seg1[iMethod], input_seg1[iMethod], &Doppler, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK ( XLALComputeFstat ( &results_seg2[iMethod], input_seg2[iMethod], &Doppler, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK ( XLALComputeFstat ( &results_worker_seg1, worker_seg1, &Doppler, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK ( XLALComputeFstat ( &results_worker_seg2, worker_seg2, &Doppler, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLALPrintInfo ( "Comparing results between input and worker for method '%s'\n", XLALGetFstatInputMethodName(input_seg1[iMethod]) );
+      XLAL_CHECK ( compareFstatResults ( results_seg1[iMethod], results_worker_seg1 ) == XLAL_SUCCESS, XLAL_EFUNC,
+                   "Comparison between input and worker failed on 'seg1' for method '%s'", XLALGetFstatInputMethodName(input_seg1[iMethod]) );
+      XLAL_CHECK ( compareFstatResults ( results_seg2[iMethod], results_worker_seg2 ) == XLAL_SUCCESS, XLAL_EFUNC,
+                   "Comparison between input and worker failed on 'seg2' for method '%s'", XLALGetFstatInputMethodName(input_seg1[iMethod]) );
+      XLALDestroyFstatResults ( results_worker_seg1 );
+      XLALDestroyFstatResults ( results_worker_seg2 );
+      XLALDestroyFstatInput ( worker_seg1 );
+      XLALDestroyFstatInput ( worker_seg2 );
+    }
+
   // ----- test XLALFstatInputTimeslice()
   // setup optional Fstat arguments
   optionalArgs.FstatMethod = FMETHOD_DEMOD_BEST; // only use demod best
@@ -309,6 +346,55 @@ main ( int argc, char *argv[] )
 
 } // main()
 
+// compute the F-statistic for a block of Doppler points, interleaved in sky position, with XLALComputeFstatBatch()
+// and by calling XLALComputeFstat() for each point, compare the results, and report the throughput of each
+static int
+testComputeFstatBatch ( FstatInput *input, const PulsarDopplerParams *Doppler, const REAL8 dSky, const REAL8 df1dot, const UINT4 numFreqBins, const FstatQuantities whatToCompute )
+{
+  const UINT4 numSkyPoints = 3, numf1dotPoints = 9, numDopplers = numSkyPoints * numf1dotPoints;
+
+  PulsarDopplerParams dopplers[numDopplers];
+  for ( UINT4 if1dot = 0; if1dot < numf1dotPoints; if1dot ++ )
+    {
+      for ( UINT4 iSky = 0; iSky < numSkyPoints; iSky ++ )
+        {
+          PulsarDopplerParams *dop = &dopplers[if1dot * numSkyPoints + iSky];
+          (*dop) = (*Doppler);
+          dop->Alpha += iSky * dSky;
+          dop->fkdot[1] += if1dot * df1dot / numf1dotPoints;
+        }
+    }
+
+  FstatResults *results_loop[numDopplers], *results_batch[numDopplers];
+  XLAL_INIT_MEM ( results_loop );
+  XLAL_INIT_MEM ( results_batch );
+
+  REAL8 tic = XLALGetCPUTime();
+  for ( UINT4 i = 0; i < numDopplers; i ++ )
+    {
+      XLAL_CHECK ( XLALComputeFstat ( &results_loop[i], input, &dopplers[i], numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+  const REAL8 time_loop = XLALGetCPUTime() - tic;
+
+  tic = XLALGetCPUTime();
+  XLAL_CHECK ( XLALComputeFstatBatch ( results_batch, input, dopplers, numDopplers, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+  const REAL8 time_batch = XLALGetCPUTime() - tic;
+
+  XLALPrintInfo ( "Method '%s': XLALComputeFstat() %.1f templates/s, XLALComputeFstatBatch() %.1f templates/s\n",
+                  XLALGetFstatInputMethodName ( input ), numDopplers / time_loop, numDopplers / time_batch );
+
+  for ( UINT4 i = 0; i < numDopplers; i ++ )
+    {
+      XLAL_CHECK ( memcmp ( &results_batch[i]->doppler, &dopplers[i], sizeof(dopplers[i]) ) == 0, XLAL_EFAILED, "Doppler point %u was not returned in order", i );
+      XLAL_CHECK ( compareFstatResults ( results_loop[i], results_batch[i] ) == XLAL_SUCCESS, XLAL_EFUNC, "Comparison failed for Doppler point %u", i );
+      XLALDestroyFstatResults ( results_loop[i] );
+      XLALDestroyFstatResults ( results_batch[i] );
+    }
+
+  return XLAL_SUCCESS;
+
+} // testComputeFstatBatch()
+
 static int
 compareFstatResults ( const FstatResults *result1, const FstatResults *result2 )
 {
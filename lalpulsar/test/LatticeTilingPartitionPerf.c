@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup LatticeTiling_h
+ *
+ * \brief Benchmark the throughput of generating the points of a 4-dimensional reduced supersky lattice
+ * tiling with one iterator per thread, each restricted to a different range of points with
+ * XLALSetLatticeTilingIteratorPartition(), and of locating nearest points with
+ * XLALNearestLatticeTilingPointsParallel(), versus the number of threads.
+ *
+ * The points generated by the partitioned iterators, and the nearest points located with several threads,
+ * are checked to be identical to those generated/located by a single thread.
+ *
+ * Usage: LatticeTilingPartitionPerf [maximum number of threads, default 4] [frequency band in Hz, default 0.05]
+ * [number of random points, default 2e5]
+ *
+ * Built by \c make \c bench, and not run by \c make \c check; LatticeTilingTest checks the same results
+ * on a smaller lattice tiling.
+ */
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LatticeTiling.h>
+#include <lal/SuperskyMetrics.h>
+#include <lal/LALInitBarycenter.h>
+#include <lal/LogPrintf.h>
+
+#include <lal/GSLHelpers.h>
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#endif
+
+/** \cond DONT_DOXYGEN */
+
+// Iterate over one range of lattice tiling points, storing each point in the column of 'points' given by its index
+typedef struct {
+  LatticeTilingIterator *itr;
+  gsl_matrix *points;
+  UINT8 count;
+  int retn;
+} IterateTask;
+
+static void *iterate_points( void *arg )
+{
+  IterateTask *task = ( IterateTask * ) arg;
+  const size_t n = task->points->size1;
+  double point_array[n];
+  gsl_vector_view point_view = gsl_vector_view_array( point_array, n );
+  int retn;
+  while ( ( retn = XLALNextLatticeTilingPoint( task->itr, &point_view.vector ) ) > 0 ) {
+    const UINT8 j = XLALCurrentLatticeTilingIndex( task->itr );
+    gsl_vector_view points_j = gsl_matrix_column( task->points, j );
+    gsl_vector_memcpy( &points_j.vector, &point_view.vector );
+    ++task->count;
+  }
+  task->retn = retn;
+  return NULL;
+}
+
+int main( int argc, char *argv[] )
+{
+
+  const UINT4 max_threads = ( argc > 1 ) ? ( UINT4 ) atoi( argv[1] ) : 4;
+  const double freq_band = ( argc > 2 ) ? atof( argv[2] ) : 0.05;
+  const UINT4 num_random_points = ( argc > 3 ) ? ( UINT4 ) atof( argv[3] ) : 200000;
+  XLAL_CHECK_MAIN( max_threads > 0, XLAL_EINVAL );
+  XLAL_CHECK_MAIN( freq_band > 0, XLAL_EINVAL );
+  XLAL_CHECK_MAIN( num_random_points > 0, XLAL_EINVAL );
+
+  // Compute reduced supersky metric of a single segment
+  const double Tspan = 90000;
+  LIGOTimeGPS ref_time;
+  XLALGPSSetREAL8( &ref_time, 900100100 );
+  LALSegList segments;
+  {
+    XLAL_CHECK_MAIN( XLALSegListInit( &segments ) == XLAL_SUCCESS, XLAL_EFUNC );
+    LALSeg segment;
+    LIGOTimeGPS start_time = ref_time, end_time = ref_time;
+    XLALGPSAdd( &start_time, -0.5 * Tspan );
+    XLALGPSAdd( &end_time, 0.5 * Tspan );
+    XLAL_CHECK_MAIN( XLALSegSet( &segment, &start_time, &end_time, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( XLALSegListAppend( &segments, &segment ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+  MultiLALDetector detectors = {
+    .length = 1,
+    .sites = { lalCachedDetectors[LAL_LLO_4K_DETECTOR] }
+  };
+  EphemerisData *edat = XLALInitBarycenter( TEST_PKG_DATA_DIR "earth00-19-DE405.dat.gz",
+                                            TEST_PKG_DATA_DIR "sun00-19-DE405.dat.gz" );
+  XLAL_CHECK_MAIN( edat != NULL, XLAL_EFUNC );
+  const double freq_max = 40.0;
+  SuperskyMetrics *metrics = XLALComputeSuperskyMetrics( SUPERSKY_METRIC_TYPE, 1, &ref_time, &segments, freq_max, &detectors, NULL, DETMOTION_SPIN | DETMOTION_PTOLEORBIT, edat );
+  XLAL_CHECK_MAIN( metrics != NULL, XLAL_EFUNC );
+
+  // Create 4-dimensional lattice tiling
+  const double max_mismatch = 1.4;
+  LatticeTiling *tiling = XLALCreateLatticeTiling( 4 );
+  XLAL_CHECK_MAIN( tiling != NULL, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( XLALSetSuperskyPhysicalSkyBounds( tiling, metrics->coh_rssky_metric[0], metrics->coh_rssky_transf[0], 0, LAL_PI, -LAL_PI_2, LAL_PI_2 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( XLALSetSuperskyPhysicalSpinBound( tiling, metrics->coh_rssky_transf[0], 0, freq_max - freq_band, freq_max ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( XLALSetSuperskyPhysicalSpinBound( tiling, metrics->coh_rssky_transf[0], 1, -3e-9, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( XLALSetTilingLatticeAndMetric( tiling, TILING_LATTICE_ANSTAR, metrics->coh_rssky_metric[0], max_mismatch ) == XLAL_SUCCESS, XLAL_EFUNC );
+  const size_t n = XLALTotalLatticeTilingDimensions( tiling );
+
+  // Generate all points with a single iterator
+  gsl_matrix *points_ref = NULL;
+  UINT8 total = 0;
+  {
+    LatticeTilingIterator *itr = XLALCreateLatticeTilingIterator( tiling, n );
+    XLAL_CHECK_MAIN( itr != NULL, XLAL_EFUNC );
+    total = XLALTotalLatticeTilingPoints( itr );
+    XLAL_CHECK_MAIN( total > 0, XLAL_EFUNC );
+    GAMAT_MAIN( points_ref, n, total );
+    IterateTask task = { itr, points_ref, 0, 0 };
+    const REAL8 tic = XLALGetTimeOfDay();
+    iterate_points( &task );
+    const REAL8 toc = XLALGetTimeOfDay();
+    XLAL_CHECK_MAIN( task.retn == 0, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( task.count == total, XLAL_EFAILED, "count = %" LAL_UINT8_FORMAT " != %" LAL_UINT8_FORMAT " = total", task.count, total );
+    printf( "%" LAL_UINT8_FORMAT " points: 1 unpartitioned iterator %8.3g s, %10.4g points/s\n", total, toc - tic, total / ( toc - tic ) );
+    XLALDestroyLatticeTilingIterator( itr );
+  }
+
+  // Generate all points with one partitioned iterator per thread, and check they are identical
+  gsl_matrix *GAMAT_MAIN( points, n, total );
+  for ( UINT4 num_threads = 1; num_threads <= max_threads; num_threads *= 2 ) {
+    gsl_matrix_set_all( points, GSL_NAN );
+    IterateTask tasks[num_threads];
+    for ( UINT4 k = 0; k < num_threads; ++k ) {
+      tasks[k].itr = XLALCreateLatticeTilingIterator( tiling, n );
+      XLAL_CHECK_MAIN( tasks[k].itr != NULL, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLALSetLatticeTilingIteratorPartition( tasks[k].itr, num_threads, k ) == XLAL_SUCCESS, XLAL_EFUNC );
+      tasks[k].points = points;
+      tasks[k].count = 0;
+      tasks[k].retn = 0;
+    }
+    const REAL8 tic = XLALGetTimeOfDay();
+#ifdef LAL_PTHREAD_LOCK
+    pthread_t threads[num_threads];
+    for ( UINT4 k = 1; k < num_threads; ++k ) {
+      XLAL_CHECK_MAIN( pthread_create( &threads[k], NULL, iterate_points, &tasks[k] ) == 0, XLAL_ESYS );
+    }
+    iterate_points( &tasks[0] );
+    for ( UINT4 k = 1; k < num_threads; ++k ) {
+      pthread_join( threads[k], NULL );
+    }
+#else
+    for ( UINT4 k = 0; k < num_threads; ++k ) {
+      iterate_points( &tasks[k] );
+    }
+#endif
+    const REAL8 toc = XLALGetTimeOfDay();
+    UINT8 count = 0;
+    for ( UINT4 k = 0; k < num_threads; ++k ) {
+      XLAL_CHECK_MAIN( tasks[k].retn == 0, XLAL_EFUNC, "iterator over range #%u failed", k );
+      XLAL_CHECK_MAIN( ( total / num_threads ) <= tasks[k].count && tasks[k].count <= ( total / num_threads ) + 1, XLAL_EFAILED,
+                       "range #%u of %u has %" LAL_UINT8_FORMAT " points", k, num_threads, tasks[k].count );
+      count += tasks[k].count;
+      XLALDestroyLatticeTilingIterator( tasks[k].itr );
+    }
+    XLAL_CHECK_MAIN( count == total, XLAL_EFAILED, "count = %" LAL_UINT8_FORMAT " != %" LAL_UINT8_FORMAT " = total", count, total );
+    XLAL_CHECK_MAIN( memcmp( points->data, points_ref->data, n * total * sizeof( points->data[0] ) ) == 0, XLAL_EFAILED,
+                     "points generated by %u partitioned iterators differ from those generated by a single iterator", num_threads );
+    printf( "%" LAL_UINT8_FORMAT " points: %u partitioned iterators %8.3g s, %10.4g points/s\n", total, num_threads, toc - tic, total / ( toc - tic ) );
+  }
+  GFMAT( points );
+
+  // Locate nearest points to random points, and check that they are identical for any number of threads
+  {
+    RandomParams *rng = XLALCreateRandomParams( 1 );
+    XLAL_CHECK_MAIN( rng != NULL, XLAL_EFUNC );
+    gsl_matrix *GAMAT_MAIN( random_points, n, num_random_points );
+    XLAL_CHECK_MAIN( XLALRandomLatticeTilingPoints( tiling, 0.0, rng, random_points ) == XLAL_SUCCESS, XLAL_EFUNC );
+    LatticeTilingLocator *loc = XLALCreateLatticeTilingLocator( tiling );
+    XLAL_CHECK_MAIN( loc != NULL, XLAL_EFUNC );
+    gsl_matrix *nearest_ref = NULL;
+    UINT8VectorSequence *nearest_indexes_ref = NULL;
+    {
+      const REAL8 tic = XLALGetTimeOfDay();
+      XLAL_CHECK_MAIN( XLALNearestLatticeTilingPoints( loc, random_points, &nearest_ref, &nearest_indexes_ref ) == XLAL_SUCCESS, XLAL_EFUNC );
+      const REAL8 toc = XLALGetTimeOfDay();
+      printf( "%u nearest points: XLALNearestLatticeTilingPoints() %8.3g s, %10.4g points/s\n", num_random_points, toc - tic, num_random_points / ( toc - tic ) );
+    }
+    for ( UINT4 num_threads = 1; num_threads <= max_threads; num_threads *= 2 ) {
+      gsl_matrix *nearest = NULL;
+      UINT8VectorSequence *nearest_indexes = NULL;
+      const REAL8 tic = XLALGetTimeOfDay();
+      XLAL_CHECK_MAIN( XLALNearestLatticeTilingPointsParallel( loc, random_points, &nearest, &nearest_indexes, num_threads ) == XLAL_SUCCESS, XLAL_EFUNC );
+      const REAL8 toc = XLALGetTimeOfDay();
+      XLAL_CHECK_MAIN( memcmp( nearest->data, nearest_ref->data, n * num_random_points * sizeof( nearest->data[0] ) ) == 0, XLAL_EFAILED,
+                       "nearest points located with %u threads differ from those located with a single thread", num_threads );
+      XLAL_CHECK_MAIN( memcmp( nearest_indexes->data, nearest_indexes_ref->data, n * num_random_points * sizeof( nearest_indexes->data[0] ) ) == 0, XLAL_EFAILED,
+                       "nearest indexes located with %u threads differ from those located with a single thread", num_threads );
+      printf( "%u nearest points: XLALNearestLatticeTilingPointsParallel() with %u threads %8.3g s, %10.4g points/s\n", num_random_points, num_threads, toc - tic, num_random_points / ( toc - tic ) );
+      GFMAT( nearest );
+      XLALDestroyUINT8VectorSequence( nearest_indexes );
+    }
+    GFMAT( random_points, nearest_ref );
+    XLALDestroyUINT8VectorSequence( nearest_indexes_ref );
+    XLALDestroyLatticeTilingLocator( loc );
+    XLALDestroyRandomParams( rng );
+  }
+
+  // Cleanup
+  GFMAT( points_ref );
+  XLALDestroyLatticeTiling( tiling );
+  XLALDestroySuperskyMetrics( metrics );
+  XLALSegListClear( &segments );
+  XLALDestroyEphemerisData( edat );
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
+
+/** \endcond */
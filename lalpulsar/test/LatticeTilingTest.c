@@ -625,6 +625,99 @@ static int MismatchAgeBrakeTest(
 
 }
 
+static int PartitionTest(
+  const size_t num_ranges,
+  const size_t num_threads
+  )
+{
+
+  // Create a 4-dimensional lattice tiling with the Lehmer matrix as metric, as in BasicTest()
+  const size_t n = 4;
+  LatticeTiling *tiling = XLALCreateLatticeTiling( n );
+  XLAL_CHECK( tiling != NULL, XLAL_EFUNC );
+  for ( size_t i = 0; i < n; ++i ) {
+    XLAL_CHECK( XLALSetLatticeTilingConstantBound( tiling, i, 0.0, pow( 100.0, 1.0/n ) ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+  {
+    gsl_matrix *GAMAT( metric, n, n );
+    for ( size_t i = 0; i < n; ++i ) {
+      for ( size_t j = 0; j < n; ++j ) {
+        const double ii = i+1, jj = j+1;
+        gsl_matrix_set( metric, i, j, jj >= ii ? ii/jj : jj/ii );
+      }
+    }
+    XLAL_CHECK( XLALSetTilingLatticeAndMetric( tiling, TILING_LATTICE_ANSTAR, metric, 0.3 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    GFMAT( metric );
+  }
+  printf( "Partition tests with %zu ranges and %zu threads\n", num_ranges, num_threads );
+
+  // Generate all points with a single iterator
+  LatticeTilingIterator *itr = XLALCreateLatticeTilingIterator( tiling, n );
+  XLAL_CHECK( itr != NULL, XLAL_EFUNC );
+  const UINT8 total = XLALTotalLatticeTilingPoints( itr );
+  XLAL_CHECK( total > 0, XLAL_EFUNC );
+  gsl_matrix *GAMAT( points, n, total );
+  XLAL_CHECK( XLALNextLatticeTilingPoints( itr, &points ) == ( int ) total, XLAL_EFUNC );
+  XLALDestroyLatticeTilingIterator( itr );
+
+  // Check that iterators restricted to each range generate balanced ranges of the same points, with the same indexes
+  UINT8 count = 0;
+  double point_array[n];
+  gsl_vector_view point_view = gsl_vector_view_array( point_array, n );
+  for ( size_t k = 0; k < num_ranges; ++k ) {
+    itr = XLALCreateLatticeTilingIterator( tiling, n );
+    XLAL_CHECK( itr != NULL, XLAL_EFUNC );
+    XLAL_CHECK( XLALSetLatticeTilingIteratorPartition( itr, num_ranges, k ) == XLAL_SUCCESS, XLAL_EFUNC );
+    UINT8 count_k = 0;
+    int retn;
+    while ( ( retn = XLALNextLatticeTilingPoint( itr, &point_view.vector ) ) > 0 ) {
+      const UINT8 j = XLALCurrentLatticeTilingIndex( itr );
+      XLAL_CHECK( j == count + count_k, XLAL_EFAILED, "range #%zu of %zu: point has index %" LAL_UINT8_FORMAT ", should be %" LAL_UINT8_FORMAT, k, num_ranges, j, count + count_k );
+      for ( size_t i = 0; i < n; ++i ) {
+        XLAL_CHECK( point_array[i] == gsl_matrix_get( points, i, j ), XLAL_EFAILED, "range #%zu of %zu: point #%" LAL_UINT8_FORMAT " differs from that of a single iterator", k, num_ranges, j );
+      }
+      ++count_k;
+    }
+    XLAL_CHECK( retn == 0, XLAL_EFUNC );
+    XLAL_CHECK( ( total / num_ranges ) <= count_k && count_k <= ( total / num_ranges ) + 1, XLAL_EFAILED, "range #%zu of %zu has %" LAL_UINT8_FORMAT " points", k, num_ranges, count_k );
+    count += count_k;
+    XLALDestroyLatticeTilingIterator( itr );
+  }
+  XLAL_CHECK( count == total, XLAL_EFAILED, "count = %" LAL_UINT8_FORMAT " != %" LAL_UINT8_FORMAT " = total", count, total );
+
+  // Check that the nearest points to random points are the same when located with several threads
+  RandomParams *rng = XLALCreateRandomParams( total );
+  XLAL_CHECK( rng != NULL, XLAL_EFUNC );
+  const UINT4 num_random_points = 1000;
+  gsl_matrix *GAMAT( random_points, n, num_random_points );
+  XLAL_CHECK( XLALRandomLatticeTilingPoints( tiling, 0.0, rng, random_points ) == XLAL_SUCCESS, XLAL_EFUNC );
+  LatticeTilingLocator *loc = XLALCreateLatticeTilingLocator( tiling );
+  XLAL_CHECK( loc != NULL, XLAL_EFUNC );
+  gsl_matrix *nearest_ref = NULL, *nearest = NULL;
+  UINT8VectorSequence *nearest_indexes_ref = NULL, *nearest_indexes = NULL;
+  XLAL_CHECK( XLALNearestLatticeTilingPoints( loc, random_points, &nearest_ref, &nearest_indexes_ref ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALNearestLatticeTilingPointsParallel( loc, random_points, &nearest, &nearest_indexes, num_threads ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( size_t j = 0; j < num_random_points; ++j ) {
+    for ( size_t i = 0; i < n; ++i ) {
+      XLAL_CHECK( gsl_matrix_get( nearest, i, j ) == gsl_matrix_get( nearest_ref, i, j ), XLAL_EFAILED, "nearest point #%zu located with %zu threads differs from that located with one thread", j, num_threads );
+      XLAL_CHECK( nearest_indexes->data[n*j + i] == nearest_indexes_ref->data[n*j + i], XLAL_EFAILED, "nearest index #%zu located with %zu threads differs from that located with one thread", j, num_threads );
+    }
+  }
+
+  // Cleanup
+  GFMAT( points, random_points, nearest_ref, nearest );
+  XLALDestroyUINT8VectorSequence( nearest_indexes_ref );
+  XLALDestroyUINT8VectorSequence( nearest_indexes );
+  XLALDestroyLatticeTilingLocator( loc );
+  XLALDestroyRandomParams( rng );
+  XLALDestroyLatticeTiling( tiling );
+  LALCheckMemoryLeaks();
+  printf( "\n" );
+
+  return XLAL_SUCCESS;
+
+}
+
 static int SuperskyTests(
   const UINT8 coh_total_ref_0,
   const UINT8 coh_total_ref_1,
@@ -815,6 +908,11 @@ int main( void )
   XLAL_CHECK_MAIN( MismatchAgeBrakeTest( TILING_LATTICE_ANSTAR, 200, 1.5e-5, 37230, A3s_mism_hist ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK_MAIN( MismatchAgeBrakeTest( TILING_LATTICE_ANSTAR, 300, 1.0e-5, 37022, A3s_mism_hist ) == XLAL_SUCCESS, XLAL_EFUNC );
 
+  // Perform tests of partitioned iterators and of locating nearest points with several threads
+  XLAL_CHECK_MAIN( PartitionTest( 1, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( PartitionTest( 2, 2 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( PartitionTest( 7, 4 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Perform a variety of tests with the reduced supersky parameter space and metric
   XLAL_CHECK_MAIN( SuperskyTests( 6886488, 1050134, 932765, 26063227993 ) == XLAL_SUCCESS, XLAL_EFUNC );
 
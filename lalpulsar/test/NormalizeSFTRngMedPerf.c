@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup NormalizeSFTRngMed_h
+ *
+ * \brief Compare the time taken to normalize many SFTs by their running median with
+ * XLALNormalizeMultiSFTVect(), and with XLALNormalizeMultiSFTVectParallel() with different numbers of threads.
+ *
+ * Usage: NormalizeSFTRngMedPerf [number of SFTs per detector, default 2000]
+ *
+ * Built by \c make \c bench, and not run by \c make \c check; NormalizeSFTRngMedTest checks that both
+ * functions return identical results.
+ */
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/SFTutils.h>
+#include <lal/NormalizeSFTRngMed.h>
+#include <lal/LogPrintf.h>
+
+/** \cond DONT_DOXYGEN */
+
+#define NUM_DETECTORS 2
+#define NUM_BINS 4003
+#define BLOCK_SIZE 101
+
+/* create a multi-vector of SFTs filled with (deterministic) random data of order 1e-20 */
+static MultiSFTVector *create_SFTs ( const UINT4 numSFTsPerDet )
+{
+  UINT4 numSFTs[NUM_DETECTORS];
+  UINT4Vector numSFTsVec = { NUM_DETECTORS, numSFTs };
+  for ( UINT4 X = 0; X < NUM_DETECTORS; X ++ ) {
+    numSFTs[X] = numSFTsPerDet + X;	/* different numbers of SFTs per detector */
+  }
+  MultiSFTVector *multiSFTs = XLALCreateMultiSFTVector ( NUM_BINS, &numSFTsVec );
+  XLAL_CHECK_NULL ( multiSFTs != NULL, XLAL_EFUNC );
+  srand ( 1 );
+  for ( UINT4 X = 0; X < NUM_DETECTORS; X ++ ) {
+    for ( UINT4 j = 0; j < multiSFTs->data[X]->length; j ++ ) {
+      SFTtype *sft = &multiSFTs->data[X]->data[j];
+      snprintf ( sft->name, sizeof ( sft->name ), "%c1", ( X == 0 ) ? 'H' : 'L' );
+      sft->deltaF = 1.0 / 1800;
+      sft->f0 = 100.0;
+      for ( UINT4 k = 0; k < NUM_BINS; k ++ ) {
+        const REAL4 re = 1e-20 * ( rand() / ( (REAL4) RAND_MAX ) - 0.5 );
+        const REAL4 im = 1e-20 * ( rand() / ( (REAL4) RAND_MAX ) - 0.5 );
+        sft->data->data[k] = crectf ( re, im );
+      }
+    }
+  }
+  return multiSFTs;
+}
+
+int main ( int argc, char *argv[] )
+{
+  const UINT4 numSFTsPerDet = ( argc > 1 ) ? (UINT4) atoi ( argv[1] ) : 2000;
+  XLAL_CHECK_MAIN ( numSFTsPerDet > 0, XLAL_EINVAL );
+
+  /* normalize identical SFTs serially, and with increasing numbers of threads */
+  const UINT4 numThreads[] = { 1, 2, 4, 8, 0 };
+  const UINT4 numRuns = XLAL_NUM_ELEM ( numThreads );
+  MultiSFTVector *multiSFTs[XLAL_NUM_ELEM ( numThreads ) + 1];
+  MultiPSDVector *multiPSDs[XLAL_NUM_ELEM ( numThreads ) + 1];
+  for ( UINT4 i = 0; i <= numRuns; i ++ ) {
+    XLAL_CHECK_MAIN ( ( multiSFTs[i] = create_SFTs ( numSFTsPerDet ) ) != NULL, XLAL_EFUNC );
+  }
+
+  REAL8 tic = XLALGetTimeOfDay();
+  XLAL_CHECK_MAIN ( ( multiPSDs[0] = XLALNormalizeMultiSFTVect ( multiSFTs[0], BLOCK_SIZE, NULL ) ) != NULL, XLAL_EFUNC );
+  REAL8 toc = XLALGetTimeOfDay();
+  const REAL8 timeSerial = toc - tic;
+  XLALPrintInfo ( "%u SFTs of %u bins: XLALNormalizeMultiSFTVect():                      %8.3g s\n", NUM_DETECTORS * numSFTsPerDet + 1, NUM_BINS, timeSerial );
+
+  for ( UINT4 i = 1; i <= numRuns; i ++ ) {
+    tic = XLALGetTimeOfDay();
+    XLAL_CHECK_MAIN ( ( multiPSDs[i] = XLALNormalizeMultiSFTVectParallel ( multiSFTs[i], BLOCK_SIZE, NULL, numThreads[i-1] ) ) != NULL, XLAL_EFUNC );
+    toc = XLALGetTimeOfDay();
+    XLALPrintInfo ( "%u SFTs of %u bins: XLALNormalizeMultiSFTVectParallel(), %u thread(s): %8.3g s, speedup %5.2f\n", NUM_DETECTORS * numSFTsPerDet + 1, NUM_BINS, numThreads[i-1], toc - tic, timeSerial / ( toc - tic ) );
+  }
+
+  /* check that running-median estimates and normalized SFTs are identical */
+  for ( UINT4 i = 1; i <= numRuns; i ++ ) {
+    XLAL_CHECK_MAIN ( multiPSDs[i]->length == multiPSDs[0]->length, XLAL_EFAILED );
+    for ( UINT4 X = 0; X < NUM_DETECTORS; X ++ ) {
+      XLAL_CHECK_MAIN ( multiPSDs[i]->data[X]->length == multiPSDs[0]->data[X]->length, XLAL_EFAILED );
+      for ( UINT4 j = 0; j < multiPSDs[0]->data[X]->length; j ++ ) {
+        XLAL_CHECK_MAIN ( memcmp ( multiPSDs[i]->data[X]->data[j].data->data, multiPSDs[0]->data[X]->data[j].data->data, NUM_BINS * sizeof ( REAL8 ) ) == 0, XLAL_EFAILED,
+                          "running median of SFT %u of detector %u with %u thread(s) differs from XLALNormalizeMultiSFTVect()", j, X, numThreads[i-1] );
+        XLAL_CHECK_MAIN ( memcmp ( multiSFTs[i]->data[X]->data[j].data->data, multiSFTs[0]->data[X]->data[j].data->data, NUM_BINS * sizeof ( COMPLEX8 ) ) == 0, XLAL_EFAILED,
+                          "normalized SFT %u of detector %u with %u thread(s) differs from XLALNormalizeMultiSFTVect()", j, X, numThreads[i-1] );
+      }
+    }
+  }
+
+  for ( UINT4 i = 0; i <= numRuns; i ++ ) {
+    XLALDestroyMultiPSDVector ( multiPSDs[i] );
+    XLALDestroyMultiSFTVector ( multiSFTs[i] );
+  }
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
+
+/** \endcond */
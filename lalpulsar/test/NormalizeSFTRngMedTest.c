@@ -18,8 +18,12 @@
 *  MA  02111-1307  USA
 */
 
+#include <string.h>
+
 #include <lal/FrequencySeries.h>
 #include <lal/NormalizeSFTRngMed.h>
+#include <lal/SFTutils.h>
+#include <lal/Random.h>
 #include <lal/Units.h>
 
 #define REL_ERR(x,y) ( fabs((x) - (y)) / fabs( (x) ) )
@@ -28,6 +32,30 @@
 
 REAL8 tol = LAL_REAL4_EPS;
 
+/* create a multi-vector of SFTs with different numbers of SFTs per detector, filled with (deterministic) random data of order 1e-20 */
+static MultiSFTVector *create_random_SFTs ( UINT4 numBins )
+{
+  RandomParams *rng = XLALCreateRandomParams ( 1 );
+  XLAL_CHECK_NULL ( rng != NULL, XLAL_EFUNC );
+  UINT4 numSFTs[] = { 5, 6 };
+  UINT4Vector numSFTsVec = { XLAL_NUM_ELEM ( numSFTs ), numSFTs };
+  MultiSFTVector *multiSFTs = XLALCreateMultiSFTVector ( numBins, &numSFTsVec );
+  XLAL_CHECK_NULL ( multiSFTs != NULL, XLAL_EFUNC );
+  for ( UINT4 X = 0; X < multiSFTs->length; X ++ ) {
+    for ( UINT4 j = 0; j < multiSFTs->data[X]->length; j ++ ) {
+      SFTtype *sft = &multiSFTs->data[X]->data[j];
+      snprintf ( sft->name, sizeof ( sft->name ), "%c1", ( X == 0 ) ? 'H' : 'L' );
+      sft->deltaF = 1.0 / 1800;
+      sft->f0 = 100.0;
+      for ( UINT4 k = 0; k < numBins; k ++ ) {
+        sft->data->data[k] = crectf ( 1e-20 * ( XLALUniformDeviate ( rng ) - 0.5 ), 1e-20 * ( XLALUniformDeviate ( rng ) - 0.5 ) );
+      }
+    }
+  }
+  XLALDestroyRandomParams ( rng );
+  return multiSFTs;
+}
+
 int main ( void )
 {
   const char *fn = __func__;
@@ -155,6 +183,60 @@ rngmedREF4[] = { 3.96013552804278e-42, 3.96013552804278e-42, 3.96013552804278e-4
 
     } /* for iBin < numBins */
 
+  // ------------------------------------------------------------
+  // TEST 3: periodogram agrees exactly with the REAL8 mod-squares of the SFT bins
+  // ------------------------------------------------------------
+  // use a number of bins which is not a whole number of SIMD vectors
+  const UINT4 numBinsRand = 4003;
+  {
+    MultiSFTVector *multiSFTs = create_random_SFTs ( numBinsRand );
+    XLAL_CHECK ( multiSFTs != NULL, XLAL_EFUNC );
+    const SFTtype *sft = &multiSFTs->data[0]->data[0];
+    REAL8FrequencySeries XLAL_INIT_DECL(periodo);
+    XLAL_CHECK ( (periodo.data = XLALCreateREAL8Vector ( numBinsRand )) != NULL, XLAL_EFUNC );
+    XLAL_CHECK ( XLALSFTtoPeriodogram ( &periodo, sft ) == XLAL_SUCCESS, XLAL_EFUNC );
+    for ( UINT4 k = 0; k < numBinsRand; k ++ ) {
+      const REAL8 re = crealf ( sft->data->data[k] ), im = cimagf ( sft->data->data[k] );
+      volatile REAL8 re2 = re * re, im2 = im * im;	/* prevent contraction into a fused multiply-add */
+      XLAL_CHECK ( periodo.data->data[k] == re2 + im2, XLAL_EFAILED, "periodogram bin %u = %.16g differs from %.16g", k, periodo.data->data[k], re2 + im2 );
+    }
+    XLALDestroyREAL8Vector ( periodo.data );
+    XLALDestroyMultiSFTVector ( multiSFTs );
+  }
+
+  // ------------------------------------------------------------
+  // TEST 4: XLALNormalizeMultiSFTVectParallel() returns running medians and normalized SFTs identical to XLALNormalizeMultiSFTVect()
+  // ------------------------------------------------------------
+  {
+    const UINT4 blockSize = 101;
+    MultiSFTVector *refSFTs = create_random_SFTs ( numBinsRand );
+    XLAL_CHECK ( refSFTs != NULL, XLAL_EFUNC );
+    MultiPSDVector *refPSDs = XLALNormalizeMultiSFTVect ( refSFTs, blockSize, NULL );
+    XLAL_CHECK ( refPSDs != NULL, XLAL_EFUNC );
+    const UINT4 numThreads[] = { 1, 2, 4, 0 };
+    for ( UINT4 i = 0; i < XLAL_NUM_ELEM ( numThreads ); i ++ ) {
+      MultiSFTVector *multiSFTs = create_random_SFTs ( numBinsRand );
+      XLAL_CHECK ( multiSFTs != NULL, XLAL_EFUNC );
+      MultiPSDVector *multiPSDs = XLALNormalizeMultiSFTVectParallel ( multiSFTs, blockSize, NULL, numThreads[i] );
+      XLAL_CHECK ( multiPSDs != NULL, XLAL_EFUNC );
+      XLAL_CHECK ( multiPSDs->length == refPSDs->length, XLAL_EFAILED );
+      for ( UINT4 X = 0; X < refPSDs->length; X ++ ) {
+        XLAL_CHECK ( multiPSDs->data[X]->length == refPSDs->data[X]->length, XLAL_EFAILED );
+        for ( UINT4 j = 0; j < refPSDs->data[X]->length; j ++ ) {
+          XLAL_CHECK ( memcmp ( multiPSDs->data[X]->data[j].data->data, refPSDs->data[X]->data[j].data->data, numBinsRand * sizeof ( REAL8 ) ) == 0, XLAL_EFAILED,
+                       "running median of SFT %u of detector %u with %u thread(s) differs from XLALNormalizeMultiSFTVect()", j, X, numThreads[i] );
+          XLAL_CHECK ( memcmp ( multiSFTs->data[X]->data[j].data->data, refSFTs->data[X]->data[j].data->data, numBinsRand * sizeof ( COMPLEX8 ) ) == 0, XLAL_EFAILED,
+                       "normalized SFT %u of detector %u with %u thread(s) differs from XLALNormalizeMultiSFTVect()", j, X, numThreads[i] );
+        }
+      }
+      XLALDestroyMultiPSDVector ( multiPSDs );
+      XLALDestroyMultiSFTVector ( multiSFTs );
+    }
+    printf ("XLALNormalizeMultiSFTVectParallel() agrees with XLALNormalizeMultiSFTVect().\n");
+    XLALDestroyMultiPSDVector ( refPSDs );
+    XLALDestroyMultiSFTVector ( refSFTs );
+  }
+
   /* free memory */
   XLALDestroyREAL8Vector ( rngmed.data );
   XLALDestroySFT ( mySFT );
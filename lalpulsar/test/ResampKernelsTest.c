@@ -0,0 +1,227 @@
+//
+// Copyright (C) 2026
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+// MA  02111-1307  USA
+//
+
+///
+/// \file
+/// \ingroup ComputeFstat_Resamp_c
+/// \brief Tests the SIMD kernels for windowed-sinc interpolation and phase rotation used by the
+/// resampling F-statistic, by comparing each available kernel in turn against the scalar
+/// XLALSincInterpolateCOMPLEX8TimeSeries() and a scalar phase rotation.
+///
+
+#include <config.h>
+
+#include <stdio.h>
+#include <math.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALSIMD.h>
+#include <lal/AVFactories.h>
+#include <lal/Date.h>
+#include <lal/Random.h>
+#include <lal/TimeSeries.h>
+#include <lal/Units.h>
+#include <lal/Window.h>
+#include <lal/LFTandTSutils.h>
+
+// kernels defined in ComputeFstat_ResampKernels_*.c
+#ifdef HAVE_SSE2_COMPILER
+int XLALSincInterpolateCOMPLEX8_SSE2 ( COMPLEX8Vector *y_out, const REAL8Vector *t_out, const COMPLEX8TimeSeries *ts_in, const REAL4 *winDup, const UINT4 Dterms );
+int XLALRotateCOMPLEX8_SSE2 ( COMPLEX8 *xOut, const COMPLEX8 *xIn, const REAL4 *sinphase, const REAL4 *cosphase, const UINT4 len );
+#endif
+#ifdef HAVE_AVX2_COMPILER
+int XLALSincInterpolateCOMPLEX8_AVX2 ( COMPLEX8Vector *y_out, const REAL8Vector *t_out, const COMPLEX8TimeSeries *ts_in, const REAL4 *winDup, const UINT4 Dterms );
+int XLALRotateCOMPLEX8_AVX2 ( COMPLEX8 *xOut, const COMPLEX8 *xIn, const REAL4 *sinphase, const REAL4 *cosphase, const UINT4 len );
+#endif
+
+typedef int (*SincFunc) ( COMPLEX8Vector *, const REAL8Vector *, const COMPLEX8TimeSeries *, const REAL4 *, const UINT4 );
+typedef int (*RotateFunc) ( COMPLEX8 *, const COMPLEX8 *, const REAL4 *, const REAL4 *, const UINT4 );
+
+typedef struct {
+  const char *name;
+  BOOLEAN available;
+  SincFunc sinc_func;
+  RotateFunc rotate_func;
+} Kernels;
+
+// maximum error of kernels relative to the largest scalar result
+#define SINC_TOLERANCE   1e-5
+#define ROTATE_TOLERANCE 1e-6
+
+static REAL4 max_rel_error ( const COMPLEX8 *y, const COMPLEX8 *y_ref, const UINT4 len )
+{
+  REAL4 max_err = 0, max_ref = 0;
+  for ( UINT4 i = 0; i < len; ++i ) {
+    max_err = fmaxf ( max_err, cabsf ( y[i] - y_ref[i] ) );
+    max_ref = fmaxf ( max_ref, cabsf ( y_ref[i] ) );
+  }
+  return max_err / max_ref;
+}
+
+static int test_sinc ( const Kernels *k, RandomParams *rng )
+{
+
+  // Create a random input timeseries
+  const UINT4 numSamplesIn = 1000;
+  const REAL8 dt = 0.5;
+  LIGOTimeGPS epoch = { 800000000, 0 };
+  COMPLEX8TimeSeries *ts_in = XLALCreateCOMPLEX8TimeSeries ( "x", &epoch, 0, dt, &lalDimensionlessUnit, numSamplesIn );
+  XLAL_CHECK ( ts_in != NULL, XLAL_EFUNC );
+  for ( UINT4 j = 0; j < numSamplesIn; ++j ) {
+    ts_in->data->data[j] = crectf ( 2 * XLALUniformDeviate ( rng ) - 1, 2 * XLALUniformDeviate ( rng ) - 1 );
+  }
+
+  // Create output times, which exercise every path of the kernels:
+  // - outside the input timeseries; on an input sample; within a window of either end (truncated window);
+  // - and in the middle (full window, summed over whole vectors and a scalar remainder)
+  const UINT4 numSamplesOut = 2000;
+  const REAL8 tmin = XLALGPSGetREAL8 ( &epoch );
+  REAL8Vector *t_out = XLALCreateREAL8Vector ( numSamplesOut );
+  XLAL_CHECK ( t_out != NULL, XLAL_EFUNC );
+  for ( UINT4 l = 0; l < numSamplesOut; ++l ) {
+    REAL8 j;
+    switch ( l % 4 ) {
+    case 0:   // anywhere, including slightly outside the input timeseries
+      j = -5 + ( numSamplesIn + 10 ) * XLALUniformDeviate ( rng );
+      break;
+    case 1:   // near the start
+      j = 20 * XLALUniformDeviate ( rng );
+      break;
+    case 2:   // near the end
+      j = numSamplesIn - 1 - 20 * XLALUniformDeviate ( rng );
+      break;
+    default:  // on an input sample
+      j = floor ( numSamplesIn * XLALUniformDeviate ( rng ) );
+      break;
+    }
+    t_out->data[l] = tmin + j * dt;
+  }
+
+  COMPLEX8Vector *y_ref = XLALCreateCOMPLEX8Vector ( numSamplesOut );
+  XLAL_CHECK ( y_ref != NULL, XLAL_EFUNC );
+  COMPLEX8Vector *y = XLALCreateCOMPLEX8Vector ( numSamplesOut );
+  XLAL_CHECK ( y != NULL, XLAL_EFUNC );
+
+  // Test window lengths which are and are not whole numbers of vectors
+  const UINT4 Dterms_list[] = { 1, 3, 4, 8, 13 };
+  for ( size_t d = 0; d < XLAL_NUM_ELEM ( Dterms_list ); ++d ) {
+    const UINT4 Dterms = Dterms_list[d];
+
+    // Create the duplicated, sign-alternating window used by the kernels, as done in XLALSetupFstatResamp()
+    const UINT4 winLen = 2 * Dterms + 1;
+    REAL8Window *win = XLALCreateHammingREAL8Window ( winLen );
+    XLAL_CHECK ( win != NULL, XLAL_EFUNC );
+    REAL4 *winDup = XLALMalloc ( 2 * winLen * sizeof ( *winDup ) );
+    XLAL_CHECK ( winDup != NULL, XLAL_ENOMEM );
+    for ( UINT4 i = 0; i < winLen; ++i ) {
+      winDup[2*i] = winDup[2*i + 1] = ( i % 2 == 0 ) ? win->data->data[i] : -win->data->data[i];
+    }
+    XLALDestroyREAL8Window ( win );
+
+    XLAL_CHECK ( XLALSincInterpolateCOMPLEX8TimeSeries ( y_ref, t_out, ts_in, Dterms ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK ( ( k->sinc_func ) ( y, t_out, ts_in, winDup, Dterms ) == XLAL_SUCCESS, XLAL_EFUNC );
+    const REAL4 err = max_rel_error ( y->data, y_ref->data, numSamplesOut );
+    printf ( "%s sinc interpolation, Dterms=%u: max relative error = %.3e\n", k->name, Dterms, err );
+    XLAL_CHECK ( err <= SINC_TOLERANCE, XLAL_ETOL, "%s sinc interpolation, Dterms=%u: max relative error %.3e exceeds tolerance %.3e", k->name, Dterms, err, SINC_TOLERANCE );
+
+    XLALFree ( winDup );
+
+  }
+
+  XLALDestroyCOMPLEX8Vector ( y );
+  XLALDestroyCOMPLEX8Vector ( y_ref );
+  XLALDestroyREAL8Vector ( t_out );
+  XLALDestroyCOMPLEX8TimeSeries ( ts_in );
+
+  return XLAL_SUCCESS;
+
+}
+
+static int test_rotate ( const Kernels *k, RandomParams *rng )
+{
+
+  // Length is not a whole number of vectors, to exercise the scalar remainder
+  const UINT4 len = 1003;
+  COMPLEX8 *x = XLALMalloc ( len * sizeof ( *x ) );
+  COMPLEX8 *y = XLALMalloc ( len * sizeof ( *y ) );
+  COMPLEX8 *y_ref = XLALMalloc ( len * sizeof ( *y_ref ) );
+  REAL4 *sinphase = XLALMalloc ( len * sizeof ( *sinphase ) );
+  REAL4 *cosphase = XLALMalloc ( len * sizeof ( *cosphase ) );
+  XLAL_CHECK ( x != NULL && y != NULL && y_ref != NULL && sinphase != NULL && cosphase != NULL, XLAL_ENOMEM );
+  for ( UINT4 j = 0; j < len; ++j ) {
+    x[j] = crectf ( 2 * XLALUniformDeviate ( rng ) - 1, 2 * XLALUniformDeviate ( rng ) - 1 );
+    const REAL4 phase = LAL_TWOPI * XLALUniformDeviate ( rng );
+    sinphase[j] = sinf ( phase );
+    cosphase[j] = cosf ( phase );
+    y_ref[j] = crectf ( cosphase[j], sinphase[j] ) * x[j];
+  }
+
+  // Rotate out of place, then in place
+  XLAL_CHECK ( ( k->rotate_func ) ( y, x, sinphase, cosphase, len ) == XLAL_SUCCESS, XLAL_EFUNC );
+  REAL4 err = max_rel_error ( y, y_ref, len );
+  printf ( "%s phase rotation: max relative error = %.3e\n", k->name, err );
+  XLAL_CHECK ( err <= ROTATE_TOLERANCE, XLAL_ETOL, "%s phase rotation: max relative error %.3e exceeds tolerance %.3e", k->name, err, ROTATE_TOLERANCE );
+  XLAL_CHECK ( ( k->rotate_func ) ( x, x, sinphase, cosphase, len ) == XLAL_SUCCESS, XLAL_EFUNC );
+  err = max_rel_error ( x, y_ref, len );
+  printf ( "%s phase rotation in place: max relative error = %.3e\n", k->name, err );
+  XLAL_CHECK ( err <= ROTATE_TOLERANCE, XLAL_ETOL, "%s phase rotation in place: max relative error %.3e exceeds tolerance %.3e", k->name, err, ROTATE_TOLERANCE );
+
+  XLALFree ( x );
+  XLALFree ( y );
+  XLALFree ( y_ref );
+  XLALFree ( sinphase );
+  XLALFree ( cosphase );
+
+  return XLAL_SUCCESS;
+
+}
+
+int main ( void )
+{
+
+  // All SIMD kernels which may have been compiled; each available kernel is tested in turn
+  const Kernels kernels[] = {
+#ifdef HAVE_SSE2_COMPILER
+    { "SSE2", LAL_HAVE_SSE2_RUNTIME(), XLALSincInterpolateCOMPLEX8_SSE2, XLALRotateCOMPLEX8_SSE2 },
+#endif
+#ifdef HAVE_AVX2_COMPILER
+    { "AVX2", LAL_HAVE_AVX2_RUNTIME(), XLALSincInterpolateCOMPLEX8_AVX2, XLALRotateCOMPLEX8_AVX2 },
+#endif
+    { NULL, 0, NULL, NULL }
+  };
+
+  RandomParams *rng = XLALCreateRandomParams ( 1234 );
+  XLAL_CHECK_MAIN ( rng != NULL, XLAL_EFUNC );
+
+  for ( size_t i = 0; kernels[i].name != NULL; ++i ) {
+    if ( !kernels[i].available ) {
+      printf ( "%s kernels are not supported by this machine; skipping\n", kernels[i].name );
+      continue;
+    }
+    XLAL_CHECK_MAIN ( test_sinc ( &kernels[i], rng ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( test_rotate ( &kernels[i], rng ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  XLALDestroyRandomParams ( rng );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+#include <config.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALString.h>
+#include <lal/SFTutils.h>
+#include <lal/ExtrapolatePulsarSpins.h>
+#include <lal/ComputeFstat.h>
+
+#include "ResampSRCPoolCommon.h"
+
+/** \cond DONT_DOXYGEN */
+
+/* create F-statistic inputs for 'numSegments' consecutive segments, sharing a workspace */
+int create_inputs ( FstatInput **inputs, const UINT4 numSegments, const REAL8 poolMaxMB, const EphemerisData *ephem )
+{
+  LALStringVector *detNames = XLALCreateStringVector ( "H1", "L1", NULL );
+  XLAL_CHECK ( detNames != NULL, XLAL_EFUNC );
+
+  MultiNoiseFloor XLAL_INIT_DECL(injectSqrtSX);
+  injectSqrtSX.length = detNames->length;
+  for ( UINT4 X = 0; X < detNames->length; X ++ ) {
+    injectSqrtSX.sqrtSn[X] = 1.0;
+  }
+
+  FstatOptionalArgs optionalArgs = FstatOptionalArgsDefaults;
+  optionalArgs.FstatMethod = FMETHOD_RESAMP_BEST;
+  optionalArgs.randSeed = 1;
+  optionalArgs.injectSqrtSX = &injectSqrtSX;
+  optionalArgs.resampSRCPoolMaxMB = poolMaxMB;
+
+  const REAL8 Tseg = NUM_SFTS_PER_SEG * TSFT;
+  const REAL8 dFreq = 1.0 / Tseg;
+
+  for ( UINT4 s = 0; s < numSegments; s ++ ) {
+    LIGOTimeGPS startTime = { 711595934 + (INT4) ( s * Tseg ), 0 };
+    LIGOTimeGPS endTime = startTime;
+    XLALGPSAdd ( &endTime, Tseg );
+
+    MultiLIGOTimeGPSVector *multiTimestamps = XLALMakeMultiTimestamps ( startTime, Tseg, TSFT, 0, detNames->length );
+    XLAL_CHECK ( multiTimestamps != NULL, XLAL_EFUNC );
+    SFTCatalog *catalog = XLALMultiAddToFakeSFTCatalog ( NULL, detNames, multiTimestamps );
+    XLAL_CHECK ( catalog != NULL, XLAL_EFUNC );
+
+    PulsarSpinRange XLAL_INIT_DECL(spinRange);
+    spinRange.refTime = startTime;
+    spinRange.fkdot[0] = 100.0;
+    spinRange.fkdotBand[0] = ( NUM_FREQ_BINS - 1 ) * dFreq;
+    REAL8 minCoverFreq, maxCoverFreq;
+    XLAL_CHECK ( XLALCWSignalCoveringBand ( &minCoverFreq, &maxCoverFreq, &startTime, &endTime, &spinRange, 0, 0, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    optionalArgs.prevInput = ( s > 0 ) ? inputs[0] : NULL;
+    XLAL_CHECK ( ( inputs[s] = XLALCreateFstatInput ( catalog, minCoverFreq, maxCoverFreq, dFreq, ephem, &optionalArgs ) ) != NULL, XLAL_EFUNC );
+
+    XLALDestroySFTCatalog ( catalog );
+    XLALDestroyMultiTimestamps ( multiTimestamps );
+  }
+
+  XLALDestroyStringVector ( detNames );
+
+  return XLAL_SUCCESS;
+}
+
+/* compute F-statistics over all segments, for each of a few sky points in turn, as in a semicoherent search */
+int compute_Fstats ( FstatResults **results, FstatInput **inputs, const UINT4 numSegments )
+{
+  const REAL8 Tseg = NUM_SFTS_PER_SEG * TSFT;
+  for ( UINT4 i = 0; i < NUM_SKY_POINTS; i ++ ) {
+    for ( UINT4 s = 0; s < numSegments; s ++ ) {
+      PulsarDopplerParams XLAL_INIT_DECL(Doppler);
+      Doppler.refTime.gpsSeconds = 711595934;
+      Doppler.Alpha = 0.5 + 0.1 * i;
+      Doppler.Delta = -0.5 + 0.1 * i;
+      Doppler.fkdot[0] = 100.0 + 10.0 / Tseg;
+      XLAL_CHECK ( XLALComputeFstat ( &results[i * numSegments + s], inputs[s], &Doppler, NUM_FREQ_BINS, FSTATQ_2F ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+  }
+  return XLAL_SUCCESS;
+}
+
+void destroy_all ( FstatResults **results, FstatInput **inputs, const UINT4 numSegments )
+{
+  for ( UINT4 i = 0; i < NUM_SKY_POINTS * numSegments; i ++ ) {
+    XLALDestroyFstatResults ( results[i] );
+  }
+  for ( UINT4 s = 0; s < numSegments; s ++ ) {
+    XLALDestroyFstatInput ( inputs[s] );
+  }
+}
+
+/** \endcond */
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+#ifndef _RESAMPSRCPOOLCOMMON_H
+#define _RESAMPSRCPOOLCOMMON_H
+
+#include <lal/LALStdlib.h>
+#include <lal/ComputeFstat.h>
+
+/** \cond DONT_DOXYGEN */
+
+/*
+ * Many-segment resampling searches shared by ResampSRCPoolTest and ResampSRCPoolPerf
+ */
+
+#define TSFT 1800
+#define NUM_SFTS_PER_SEG 10
+#define NUM_FREQ_BINS 20000
+#define NUM_SKY_POINTS 3
+
+int create_inputs ( FstatInput **inputs, const UINT4 numSegments, const REAL8 poolMaxMB, const EphemerisData *ephem );
+int compute_Fstats ( FstatResults **results, FstatInput **inputs, const UINT4 numSegments );
+void destroy_all ( FstatResults **results, FstatInput **inputs, const UINT4 numSegments );
+
+/** \endcond */
+
+#endif // _RESAMPSRCPOOLCOMMON_H
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup ComputeFstat_h
+ *
+ * \brief Compare the peak resident memory of a resampling search over many segments with and without
+ * a pool of SRC-frame timeseries shared between segments (FstatOptionalArgs::resampSRCPoolMaxMB).
+ *
+ * Each configuration of the peak resident memory comparison is run in a separate child process, so that
+ * its peak resident memory is not affected by the other.
+ *
+ * Usage: ResampSRCPoolPerf [number of segments, default 100]
+ *
+ * The pool is sized to hold the SRC-frame timeseries of a quarter of the segments, so that the pool evicts
+ * timeseries whatever the number of segments.
+ *
+ * Built by \c make \c bench, and not run by \c make \c check; ResampSRCPoolTest checks that the pool
+ * does not change the F-statistics.
+ */
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALInitBarycenter.h>
+#include <lal/ComputeFstat.h>
+#include <lal/LogPrintf.h>
+
+#include "ResampSRCPoolCommon.h"
+
+/** \cond DONT_DOXYGEN */
+
+#define POOL_SEGMENTS_FRACTION 4
+
+/* peak resident memory of this process in MB */
+static REAL8 peak_rss_MB ( void )
+{
+  struct rusage usage;
+  if ( getrusage ( RUSAGE_SELF, &usage ) != 0 ) {
+    return 0;
+  }
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1048576.0;	/* bytes */
+#else
+  return usage.ru_maxrss / 1024.0;	/* kilobytes */
+#endif
+}
+
+/* return the memory (in MB) of the SRC-frame timeseries of an F-statistic input */
+static REAL8 SRC_MB ( FstatInput *input )
+{
+  MultiCOMPLEX8TimeSeries *a = NULL, *b = NULL;
+  XLAL_CHECK_REAL8 ( XLALExtractResampledTimeseries ( &a, &b, input ) == XLAL_SUCCESS, XLAL_EFUNC );
+  REAL8 bytes = 0;
+  for ( UINT4 X = 0; X < a->length; X ++ ) {
+    bytes += ( a->data[X]->data->length + b->data[X]->data->length ) * sizeof ( a->data[X]->data->data[0] );
+  }
+  return bytes / ( 1024.0 * 1024.0 );
+}
+
+/* run a search over 'numSegments' segments, with or without the pool, and report its peak resident memory */
+static int run_search ( const UINT4 numSegments, const REAL8 poolMaxMB, const EphemerisData *ephem )
+{
+  FstatInput **inputs = XLALCalloc ( numSegments, sizeof ( inputs[0] ) );
+  FstatResults **results = XLALCalloc ( NUM_SKY_POINTS * numSegments, sizeof ( results[0] ) );
+  XLAL_CHECK ( inputs != NULL && results != NULL, XLAL_ENOMEM );
+
+  const REAL8 tic = XLALGetTimeOfDay();
+  XLAL_CHECK ( create_inputs ( inputs, numSegments, poolMaxMB, ephem ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK ( compute_Fstats ( results, inputs, numSegments ) == XLAL_SUCCESS, XLAL_EFUNC );
+  const REAL8 toc = XLALGetTimeOfDay();
+
+  if ( poolMaxMB > 0 ) {
+    XLALPrintInfo ( "%u segments, pool of %g MB: peak resident memory %8.1f MB, time %8.3g s\n", numSegments, poolMaxMB, peak_rss_MB(), toc - tic );
+  } else {
+    XLALPrintInfo ( "%u segments, no pool:      peak resident memory %8.1f MB, time %8.3g s\n", numSegments, peak_rss_MB(), toc - tic );
+  }
+
+  destroy_all ( results, inputs, numSegments );
+  XLALFree ( inputs );
+  XLALFree ( results );
+
+  return XLAL_SUCCESS;
+}
+
+int main ( int argc, char *argv[] )
+{
+  const UINT4 numSegments = ( argc > 1 ) ? (UINT4) atoi ( argv[1] ) : 100;
+  XLAL_CHECK_MAIN ( numSegments > 1, XLAL_EINVAL );
+
+  EphemerisData *ephem = XLALInitBarycenter ( TEST_PKG_DATA_DIR "earth00-19-DE405.dat.gz", TEST_PKG_DATA_DIR "sun00-19-DE405.dat.gz" );
+  XLAL_CHECK_MAIN ( ephem != NULL, XLAL_EFUNC );
+
+  /* size the pool from the memory of the SRC-frame timeseries of one segment, so that it holds a fraction of the segments */
+  REAL8 segmentMB = 0;
+  {
+    FstatInput *input = NULL;
+    FstatResults *results[NUM_SKY_POINTS] = { NULL };
+    XLAL_CHECK_MAIN ( create_inputs ( &input, 1, 0, ephem ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( compute_Fstats ( results, &input, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    segmentMB = SRC_MB ( input );
+    XLAL_CHECK_MAIN ( xlalErrno == 0, XLAL_EFUNC );
+    destroy_all ( results, &input, 1 );
+  }
+  const UINT4 poolSegments = ( numSegments > POOL_SEGMENTS_FRACTION ) ? numSegments / POOL_SEGMENTS_FRACTION : 1;
+  XLALPrintInfo ( "SRC-frame timeseries per segment: %.2f MB; %u segments: %.1f MB without pool, %.1f MB with pool of %u segments\n",
+                  segmentMB, numSegments, numSegments * segmentMB, poolSegments * segmentMB, poolSegments );
+
+  /* compare peak resident memory without and with the pool, each in a child process */
+  const REAL8 poolMaxMB[2] = { 0, poolSegments * segmentMB };
+  for ( int i = 0; i < 2; i ++ ) {
+    fflush ( NULL );
+    pid_t pid = fork();
+    XLAL_CHECK_MAIN ( pid >= 0, XLAL_ESYS, "fork() failed" );
+    if ( pid == 0 ) {
+      _exit ( run_search ( numSegments, poolMaxMB[i], ephem ) == XLAL_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE );
+    }
+    int status = 0;
+    XLAL_CHECK_MAIN ( waitpid ( pid, &status, 0 ) == pid, XLAL_ESYS, "waitpid() failed" );
+    XLAL_CHECK_MAIN ( WIFEXITED ( status ) && WEXITSTATUS ( status ) == EXIT_SUCCESS, XLAL_EFAILED, "search with pool of %g MB failed", poolMaxMB[i] );
+  }
+
+  XLALDestroyEphemerisData ( ephem );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
+
+/** \endcond */
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup ComputeFstat_h
+ *
+ * \brief Check that F-statistics computed by resampling over many segments sharing a pool of SRC-frame
+ * timeseries (FstatOptionalArgs::resampSRCPoolMaxMB) are identical to those computed without the pool,
+ * and that SRC-frame timeseries evicted from the pool are recomputed when extracted.
+ */
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALInitBarycenter.h>
+#include <lal/ComputeFstat.h>
+
+#include "ResampSRCPoolCommon.h"
+
+/** \cond DONT_DOXYGEN */
+
+#define NUM_SEGMENTS 4
+
+int main ( void )
+{
+  EphemerisData *ephem = XLALInitBarycenter ( TEST_PKG_DATA_DIR "earth00-19-DE405.dat.gz", TEST_PKG_DATA_DIR "sun00-19-DE405.dat.gz" );
+  XLAL_CHECK_MAIN ( ephem != NULL, XLAL_EFUNC );
+
+  /* compute F-statistics without a pool, and with a pool small enough that SRC-frame timeseries are recomputed for every segment */
+  FstatInput *inputs[2][NUM_SEGMENTS] = { { NULL } };
+  FstatResults *results[2][NUM_SKY_POINTS * NUM_SEGMENTS] = { { NULL } };
+  XLAL_CHECK_MAIN ( create_inputs ( inputs[0], NUM_SEGMENTS, 0, ephem ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN ( create_inputs ( inputs[1], NUM_SEGMENTS, 1e-3, ephem ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN ( compute_Fstats ( results[0], inputs[0], NUM_SEGMENTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN ( compute_Fstats ( results[1], inputs[1], NUM_SEGMENTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( UINT4 i = 0; i < NUM_SKY_POINTS * NUM_SEGMENTS; i ++ ) {
+    XLAL_CHECK_MAIN ( memcmp ( results[0][i]->twoF, results[1][i]->twoF, NUM_FREQ_BINS * sizeof ( results[0][i]->twoF[0] ) ) == 0, XLAL_EFAILED,
+                      "F-statistics #%u computed with pool differ from those computed without pool", i );
+  }
+
+  /* check that SRC-frame timeseries evicted from the pool are recomputed when extracted */
+  for ( UINT4 n = 0; n < NUM_SEGMENTS; n ++ ) {
+    MultiCOMPLEX8TimeSeries *a[2], *b[2];
+    for ( int j = 0; j < 2; j ++ ) {
+      XLAL_CHECK_MAIN ( XLALExtractResampledTimeseries ( &a[j], &b[j], inputs[j][n] ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    for ( UINT4 X = 0; X < a[0]->length; X ++ ) {
+      const size_t size = a[0]->data[X]->data->length * sizeof ( a[0]->data[X]->data->data[0] );
+      XLAL_CHECK_MAIN ( a[1]->data[X]->data != NULL && b[1]->data[X]->data != NULL, XLAL_EFAILED, "SRC-frame timeseries of segment %u were not recomputed", n );
+      XLAL_CHECK_MAIN ( memcmp ( a[0]->data[X]->data->data, a[1]->data[X]->data->data, size ) == 0 && memcmp ( b[0]->data[X]->data->data, b[1]->data[X]->data->data, size ) == 0,
+                        XLAL_EFAILED, "SRC-frame timeseries of segment %u extracted with pool differ from those extracted without pool", n );
+    }
+  }
+
+  destroy_all ( results[0], inputs[0], NUM_SEGMENTS );
+  destroy_all ( results[1], inputs[1], NUM_SEGMENTS );
+
+  XLALDestroyEphemerisData ( ephem );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
+
+/** \endcond */
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup SFTfileIO_h
+ *
+ * \brief Benchmark finding many SFT-files with XLALSFTdataFind() and XLALSFTdataFindParallel(),
+ * without ('cold') and with ('warm') a catalog cache, and loading narrow frequency-bands from them
+ * with XLALLoadMultiSFTs(), and from a memory-mapped ::SFTCatalogIndex, on the first ('cold') and
+ * subsequent ('warm') loads.
+ *
+ * Usage: SFTCatalogIndexPerf [number of SFTs, default 1000]
+ *
+ * Built by \c make \c bench, and not run by \c make \c check; SFTfileIOTest checks the same results.
+ */
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/SFTfileIO.h>
+#include <lal/SFTutils.h>
+#include <lal/LogPrintf.h>
+
+/** \cond DONT_DOXYGEN */
+
+#define NUM_BINS 2000
+#define NUM_BANDS 10
+#define BAND_BINS 50
+#define TSFT 1800
+
+/* check that two SFT vectors are identical */
+static int compare_SFTs ( const SFTVector *sfts1, const SFTVector *sfts2 )
+{
+  XLAL_CHECK ( sfts1->length == sfts2->length, XLAL_EFAILED );
+  for ( UINT4 i = 0; i < sfts1->length; i ++ ) {
+    const SFTtype *sft1 = &sfts1->data[i], *sft2 = &sfts2->data[i];
+    XLAL_CHECK ( XLALGPSCmp ( &sft1->epoch, &sft2->epoch ) == 0 && sft1->f0 == sft2->f0 && sft1->deltaF == sft2->deltaF, XLAL_EFAILED );
+    XLAL_CHECK ( sft1->data->length == sft2->data->length, XLAL_EFAILED );
+    XLAL_CHECK ( memcmp ( sft1->data->data, sft2->data->data, sft1->data->length * sizeof(COMPLEX8) ) == 0, XLAL_EFAILED, "SFT #%u differs", i );
+  }
+  return XLAL_SUCCESS;
+}
+
+int main ( int argc, char *argv[] )
+{
+  const UINT4 numSFTs = ( argc > 1 ) ? (UINT4) atoi ( argv[1] ) : 1000;
+  XLAL_CHECK_MAIN ( numSFTs > 0, XLAL_EINVAL );
+  REAL8 tic, toc;
+
+  /* write SFTs to individual files */
+  {
+    SFTVector *sfts = XLALCreateSFTVector ( numSFTs, NUM_BINS );
+    XLAL_CHECK_MAIN ( sfts != NULL, XLAL_EFUNC );
+    srand ( 1 );
+    for ( UINT4 i = 0; i < numSFTs; i ++ ) {
+      SFTtype *sft = &sfts->data[i];
+      strcpy ( sft->name, "H1" );
+      sft->epoch.gpsSeconds = 800000000 + i * TSFT;
+      sft->deltaF = 1.0 / TSFT;
+      sft->f0 = 100.0;
+      for ( UINT4 k = 0; k < NUM_BINS; k ++ ) {
+        sft->data->data[k] = crectf ( rand() / (REAL4) RAND_MAX, rand() / (REAL4) RAND_MAX );
+      }
+    }
+    XLAL_CHECK_MAIN ( XLALWriteSFTVector2Dir ( sfts, ".", "SFTCatalogIndexPerf", "idxperf" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLALDestroySFTVector ( sfts );
+  }
+
+  /* find SFTs */
+  const CHAR *pattern = "./H-1_H1_1800SFT_idxperf-*.sft";
+  tic = XLALGetTimeOfDay();
+  SFTCatalog *catalog = XLALSFTdataFind ( pattern, NULL );
+  XLAL_CHECK_MAIN ( catalog != NULL && catalog->length == numSFTs, XLAL_EFUNC );
+  toc = XLALGetTimeOfDay();
+  XLALPrintInfo ( "%u SFTs: XLALSFTdataFind() %8.3g s\n", numSFTs, toc - tic );
+
+  /* find SFTs with several threads, first without ('cold') and then with ('warm') a catalog cache */
+  {
+    const CHAR *cache_fname = "SFTCatalogIndexPerf.sftcache";
+    remove ( cache_fname );
+    for ( int pass = 0; pass < 2; pass ++ ) {
+      tic = XLALGetTimeOfDay();
+      SFTCatalog *catalog2 = XLALSFTdataFindParallel ( pattern, NULL, 4, cache_fname );
+      XLAL_CHECK_MAIN ( catalog2 != NULL && catalog2->length == numSFTs, XLAL_EFUNC );
+      toc = XLALGetTimeOfDay();
+      XLALPrintInfo ( "%u SFTs, %s: XLALSFTdataFindParallel() with 4 threads %8.3g s\n", numSFTs, pass == 0 ? "cold" : "warm", toc - tic );
+      XLALDestroySFTCatalog ( catalog2 );
+    }
+    remove ( cache_fname );
+  }
+
+  /* create index; this maps all SFT-files */
+  tic = XLALGetTimeOfDay();
+  SFTCatalogIndex *index = XLALCreateSFTCatalogIndex ( catalog );
+  XLAL_CHECK_MAIN ( index != NULL, XLAL_EFUNC );
+  toc = XLALGetTimeOfDay();
+  XLALPrintInfo ( "%u SFTs: XLALCreateSFTCatalogIndex() %8.3g s\n", numSFTs, toc - tic );
+
+  /* load a series of narrow bands, twice: first 'cold' (first access to each band), then 'warm' */
+  for ( int pass = 0; pass < 2; pass ++ ) {
+    REAL8 tload = 0, tindex = 0, tviews = 0;
+    for ( UINT4 b = 0; b < NUM_BANDS; b ++ ) {
+      const REAL8 fMin = 100.0 + ( 10 + b * ( NUM_BINS - 20 ) / NUM_BANDS ) / ( (REAL8) TSFT );
+      const REAL8 fMax = fMin + ( BAND_BINS - 1 ) / ( (REAL8) TSFT );
+
+      tic = XLALGetTimeOfDay();
+      MultiSFTVector *sfts = XLALLoadMultiSFTs ( catalog, fMin, fMax );
+      XLAL_CHECK_MAIN ( sfts != NULL, XLAL_EFUNC );
+      toc = XLALGetTimeOfDay();
+      tload += toc - tic;
+
+      tic = XLALGetTimeOfDay();
+      MultiSFTVector *isfts = XLALLoadMultiSFTsFromIndex ( index, fMin, fMax );
+      XLAL_CHECK_MAIN ( isfts != NULL, XLAL_EFUNC );
+      toc = XLALGetTimeOfDay();
+      tindex += toc - tic;
+
+      tic = XLALGetTimeOfDay();
+      MultiSFTVector *views = XLALLoadMultiSFTViewsFromIndex ( index, fMin, fMax );
+      XLAL_CHECK_MAIN ( views != NULL, XLAL_EFUNC );
+      toc = XLALGetTimeOfDay();
+      tviews += toc - tic;
+
+      XLAL_CHECK_MAIN ( compare_SFTs ( sfts->data[0], isfts->data[0] ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN ( compare_SFTs ( sfts->data[0], views->data[0] ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      XLALDestroyMultiSFTVector ( sfts );
+      XLALDestroyMultiSFTVector ( isfts );
+      XLALDestroyMultiSFTViews ( views );
+    }
+    XLALPrintInfo ( "%u SFTs, %s: per band XLALLoadMultiSFTs() %8.3g s, XLALLoadMultiSFTsFromIndex() %8.3g s (speedup %6.1f), XLALLoadMultiSFTViewsFromIndex() %8.3g s (speedup %6.1f)\n",
+                    numSFTs, pass == 0 ? "cold" : "warm", tload / NUM_BANDS, tindex / NUM_BANDS, tload / tindex, tviews / NUM_BANDS, tload / tviews );
+  }
+
+  /* check checksums */
+  {
+    BOOLEAN crc_check = 0;
+    tic = XLALGetTimeOfDay();
+    XLAL_CHECK_MAIN ( XLALCheckCRCSFTCatalog ( &crc_check, catalog ) == XLAL_SUCCESS && crc_check, XLAL_EFUNC );
+    toc = XLALGetTimeOfDay();
+    const REAL8 tcrc = toc - tic;
+    tic = XLALGetTimeOfDay();
+    XLAL_CHECK_MAIN ( XLALCheckCRCSFTCatalogIndex ( &crc_check, index ) == XLAL_SUCCESS && crc_check, XLAL_EFUNC );
+    toc = XLALGetTimeOfDay();
+    XLALPrintInfo ( "%u SFTs: XLALCheckCRCSFTCatalog() %8.3g s, XLALCheckCRCSFTCatalogIndex() %8.3g s\n", numSFTs, tcrc, toc - tic );
+  }
+
+  /* cleanup */
+  for ( UINT4 i = 0; i < catalog->length; i ++ ) {
+    char fname[512];
+    snprintf ( fname, sizeof(fname), "%s", XLALshowSFTLocator ( catalog->data[i].locator ) );
+    char *sep = strstr ( fname, " : " );
+    if ( sep != NULL ) {
+      *sep = '\0';
+    }
+    remove ( fname );
+  }
+  XLALDestroySFTCatalogIndex ( index );
+  XLALDestroySFTCatalog ( catalog );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
+
+/** \endcond */
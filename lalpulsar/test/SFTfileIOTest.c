@@ -100,6 +100,25 @@ static int CompareSFTVectors(SFTVector *sft_vect, SFTVector *sft_vect2)
   return(0);
 }
 
+static int CompareSFTCatalogs(const SFTCatalog *catalog, const SFTCatalog *catalog2);
+static int CompareSFTCatalogs(const SFTCatalog *catalog, const SFTCatalog *catalog2)
+{
+  XLAL_CHECK ( catalog->length == catalog2->length, XLAL_EFAILED, "CompareSFTCatalogs(): catalog lengths differ!\n" );
+  for ( UINT4 i = 0; i < catalog->length; i ++ ) {
+    const SFTDescriptor *desc = &catalog->data[i], *desc2 = &catalog2->data[i];
+    CHAR loc[512];
+    XLAL_CHECK ( strlen ( XLALshowSFTLocator ( desc->locator ) ) < sizeof(loc), XLAL_EFAILED );
+    strcpy ( loc, XLALshowSFTLocator ( desc->locator ) );
+    XLAL_CHECK ( strcmp ( loc, XLALshowSFTLocator ( desc2->locator ) ) == 0, XLAL_EFAILED, "CompareSFTCatalogs(): locators of SFT#%u differ!\n", i );
+    XLAL_CHECK ( XLALGPSCmp ( &desc->header.epoch, &desc2->header.epoch ) == 0 && strcmp ( desc->header.name, desc2->header.name ) == 0
+                 && desc->header.f0 == desc2->header.f0 && desc->header.deltaF == desc2->header.deltaF, XLAL_EFAILED, "CompareSFTCatalogs(): headers of SFT#%u differ!\n", i );
+    XLAL_CHECK ( desc->numBins == desc2->numBins && desc->version == desc2->version && desc->crc64 == desc2->crc64, XLAL_EFAILED, "CompareSFTCatalogs(): SFT#%u differ!\n", i );
+    XLAL_CHECK ( ( desc->comment == NULL && desc2->comment == NULL ) || ( desc->comment != NULL && desc2->comment != NULL && strcmp ( desc->comment, desc2->comment ) == 0 ),
+                 XLAL_EFAILED, "CompareSFTCatalogs(): comments of SFT#%u differ!\n", i );
+  }
+  return XLAL_SUCCESS;
+}
+
 int main( void )
 {
   const char *fn = __func__;
@@ -152,6 +171,23 @@ int main( void )
       return EXIT_FAILURE;
     }
 
+  /* check crc-checksums from a memory-mapped index */
+  {
+    SFTCatalogIndex *index = NULL;
+    XLAL_CHECK_MAIN ( ( catalog = XLALSFTdataFind ( TEST_DATA_DIR "SFT-test1", NULL ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( ( index = XLALCreateSFTCatalogIndex ( catalog ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( XLALCheckCRCSFTCatalogIndex ( &crc_check, index ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( crc_check, XLAL_EFAILED, "XLALCheckCRCSFTCatalogIndex(): SFT-test1 has correct checksum but was claimed not to\n" );
+    XLALDestroySFTCatalogIndex ( index );
+    XLALDestroySFTCatalog(catalog);
+    XLAL_CHECK_MAIN ( ( catalog = XLALSFTdataFind ( TEST_DATA_DIR "SFT-bad6", NULL ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( ( index = XLALCreateSFTCatalogIndex ( catalog ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( XLALCheckCRCSFTCatalogIndex ( &crc_check, index ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( !crc_check, XLAL_EFAILED, "XLALCheckCRCSFTCatalogIndex() failed to catch invalid CRC checksum in SFT-bad6\n" );
+    XLALDestroySFTCatalogIndex ( index );
+    XLALDestroySFTCatalog(catalog);
+  }
+
   /* check that proper v2-SFTs are read-in properly */
   XLAL_CHECK_MAIN ( ( catalog = XLALSFTdataFind ( TEST_DATA_DIR "SFT-test1", NULL ) ) != NULL, XLAL_EFUNC ); XLALClearErrno();
   XLALDestroySFTCatalog(catalog);
@@ -184,6 +220,30 @@ int main( void )
   XLALDestroySFTCatalog(catalog);
   XLAL_CHECK_MAIN ( ( catalog = XLALSFTdataFind ( TEST_DATA_DIR "SFT-test[123]*;" TEST_DATA_DIR "SFT-test[5]*", NULL ) ) != NULL, XLAL_EFUNC );
 
+  /* find the same SFTs with several threads, first creating and then reading a catalog cache */
+  {
+    const char *cache_fname = "SFTfileIOTest.sftcache";
+    SFTCatalog *catalog2 = NULL;
+    remove ( cache_fname );
+    for ( int pass = 0; pass < 2; pass ++ ) {
+      XLAL_CHECK_MAIN ( ( catalog2 = XLALSFTdataFindParallel ( TEST_DATA_DIR "SFT-test[123]*;" TEST_DATA_DIR "SFT-test[5]*", NULL, 4, cache_fname ) ) != NULL, XLAL_EFUNC );
+      XLAL_CHECK_MAIN ( CompareSFTCatalogs ( catalog, catalog2 ) == XLAL_SUCCESS, XLAL_EFUNC, "SFT catalogs differ in pass %d", pass );
+      XLALDestroySFTCatalog ( catalog2 );
+    }
+    /* the cache is shared by different patterns, and can be combined with constraints */
+    constraints.detector = detector;
+    XLAL_CHECK_MAIN ( ( catalog2 = XLALSFTdataFindParallel ( TEST_DATA_DIR "SFT-test[12]*", &constraints, 2, cache_fname ) ) != NULL, XLAL_EFUNC );
+    SFTCatalog *catalog3 = NULL;
+    XLAL_CHECK_MAIN ( ( catalog3 = XLALSFTdataFind ( TEST_DATA_DIR "SFT-test[12]*", &constraints ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( CompareSFTCatalogs ( catalog3, catalog2 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLALDestroySFTCatalog ( catalog2 );
+    XLALDestroySFTCatalog ( catalog3 );
+    constraints.detector = NULL;
+    /* invalid SFTs are still detected */
+    XLAL_CHECK_MAIN ( XLALSFTdataFindParallel ( TEST_DATA_DIR "SFT-test1;" TEST_DATA_DIR "SFT-bad1", NULL, 2, cache_fname ) == NULL, XLAL_EFUNC ); XLALClearErrno();
+    remove ( cache_fname );
+  }
+
   /* load once as a single SFT-vector (mix of detectors) */
   XLAL_CHECK_MAIN ( ( sft_vect = XLALLoadSFTs ( catalog, -1, -1 ) ) != NULL, XLAL_EFUNC );
 
@@ -194,6 +254,52 @@ int main( void )
     XLALPrintError ("%s: XLALLoadMultiSFTs (cat, -1, -1) failed with xlalErrno = %d\n", fn, xlalErrno );
     return EXIT_FAILURE;
   }
+
+  /* load again from a memory-mapped index, both as copies and as views */
+  {
+    SFTCatalogIndex *index = NULL;
+    MultiSFTVector *multsft_idx = NULL, *multsft_views = NULL;
+    XLAL_CHECK_MAIN ( ( index = XLALCreateSFTCatalogIndex ( catalog ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( ( multsft_idx = XLALLoadMultiSFTsFromIndex ( index, -1, -1 ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( ( multsft_views = XLALLoadMultiSFTViewsFromIndex ( index, -1, -1 ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( multsft_idx->length == multsft_vect2->length && multsft_views->length == multsft_vect2->length, XLAL_EFAILED );
+    for ( UINT4 X = 0; X < multsft_vect2->length; X ++ ) {
+      XLAL_CHECK_MAIN ( CompareSFTVectors ( multsft_vect2->data[X], multsft_idx->data[X] ) == 0, XLAL_EFAILED, "SFTs loaded from index differ for X=%d\n", X );
+      XLAL_CHECK_MAIN ( CompareSFTVectors ( multsft_vect2->data[X], multsft_views->data[X] ) == 0, XLAL_EFAILED, "SFT views loaded from index differ for X=%d\n", X );
+    }
+    XLALDestroyMultiSFTVector ( multsft_idx );
+    XLALDestroyMultiSFTViews ( multsft_views );
+
+    /* load a narrow band from the middle of the SFTs */
+    MultiSFTVector *multsft_band = NULL;
+    const REAL8 fMin = multsft_vect2->data[0]->data[0].f0 + 1 * multsft_vect2->data[0]->data[0].deltaF;
+    const REAL8 fMax = fMin + 1 * multsft_vect2->data[0]->data[0].deltaF;
+    XLAL_CHECK_MAIN ( ( multsft_band = XLALLoadMultiSFTs ( catalog, fMin, fMax ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( ( multsft_idx = XLALLoadMultiSFTsFromIndex ( index, fMin, fMax ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( ( multsft_views = XLALLoadMultiSFTViewsFromIndex ( index, fMin, fMax ) ) != NULL, XLAL_EFUNC );
+    for ( UINT4 X = 0; X < multsft_band->length; X ++ ) {
+      XLAL_CHECK_MAIN ( CompareSFTVectors ( multsft_band->data[X], multsft_idx->data[X] ) == 0, XLAL_EFAILED, "SFTs of band [%g, %g] loaded from index differ for X=%d\n", fMin, fMax, X );
+      XLAL_CHECK_MAIN ( CompareSFTVectors ( multsft_band->data[X], multsft_views->data[X] ) == 0, XLAL_EFAILED, "SFT views of band [%g, %g] differ for X=%d\n", fMin, fMax, X );
+    }
+    XLALDestroyMultiSFTVector ( multsft_band );
+    XLALDestroyMultiSFTVector ( multsft_idx );
+    XLALDestroyMultiSFTViews ( multsft_views );
+
+    /* load again while keeping no files mapped, except those into which views point */
+    XLAL_CHECK_MAIN ( XLALSetSFTCatalogIndexMaxMapped ( index, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( ( multsft_views = XLALLoadMultiSFTViewsFromIndex ( index, -1, -1 ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( ( multsft_idx = XLALLoadMultiSFTsFromIndex ( index, -1, -1 ) ) != NULL, XLAL_EFUNC );
+    for ( UINT4 X = 0; X < multsft_vect2->length; X ++ ) {
+      XLAL_CHECK_MAIN ( CompareSFTVectors ( multsft_vect2->data[X], multsft_idx->data[X] ) == 0, XLAL_EFAILED, "SFTs loaded from unmapped index differ for X=%d\n", X );
+      XLAL_CHECK_MAIN ( CompareSFTVectors ( multsft_vect2->data[X], multsft_views->data[X] ) == 0, XLAL_EFAILED, "SFT views loaded from unmapped index differ for X=%d\n", X );
+    }
+    XLALDestroyMultiSFTVector ( multsft_idx );
+    XLALDestroyMultiSFTViews ( multsft_views );
+
+    XLAL_CHECK_MAIN ( XLALCheckCRCSFTCatalogIndex ( &crc_check, index ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN ( crc_check, XLAL_EFAILED, "XLALCheckCRCSFTCatalogIndex() failed on SFTs with correct checksums\n" );
+    XLALDestroySFTCatalogIndex ( index );
+  }
   XLALDestroySFTCatalog(catalog);
 
   /* 6 SFTs from 2 IFOs should have been read */
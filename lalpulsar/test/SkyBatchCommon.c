@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <math.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALInitBarycenter.h>
+#include <lal/DetectorStates.h>
+
+#include "SkyBatchCommon.h"
+
+/** \cond DONT_DOXYGEN */
+
+/* compute the states of 2 detectors, with different numbers of timestamps around 'numSteps' */
+MultiDetectorStateSeries *create_detector_states ( const UINT4 numSteps )
+{
+  XLAL_CHECK_NULL ( numSteps > 7 * ( NUM_DETECTORS - 1 ), XLAL_EINVAL );
+  EphemerisData *edat = XLALInitBarycenter ( TEST_PKG_DATA_DIR "earth00-19-DE405.dat.gz", TEST_PKG_DATA_DIR "sun00-19-DE405.dat.gz" );
+  XLAL_CHECK_NULL ( edat != NULL, XLAL_EFUNC );
+  const CHAR *sites[NUM_DETECTORS] = { "H1", "L1" };
+  MultiLALDetector multiDet;
+  multiDet.length = NUM_DETECTORS;
+  MultiLIGOTimeGPSVector *multiTS = XLALCalloc ( 1, sizeof ( *multiTS ) );
+  XLAL_CHECK_NULL ( multiTS != NULL, XLAL_ENOMEM );
+  multiTS->length = NUM_DETECTORS;
+  XLAL_CHECK_NULL ( ( multiTS->data = XLALCalloc ( NUM_DETECTORS, sizeof ( multiTS->data[0] ) ) ) != NULL, XLAL_ENOMEM );
+  for ( UINT4 X = 0; X < NUM_DETECTORS; X ++ ) {
+    LALDetector *site = XLALGetSiteInfo ( sites[X] );
+    XLAL_CHECK_NULL ( site != NULL, XLAL_EFUNC );
+    multiDet.sites[X] = *site;
+    XLALFree ( site );
+    const UINT4 numStepsX = numSteps - 7 * X;	/* different numbers of timestamps per detector */
+    XLAL_CHECK_NULL ( ( multiTS->data[X] = XLALCreateTimestampVector ( numStepsX ) ) != NULL, XLAL_EFUNC );
+    multiTS->data[X]->deltaT = TSFT;
+    for ( UINT4 i = 0; i < numStepsX; i ++ ) {
+      multiTS->data[X]->data[i].gpsSeconds = START_TIME + i * TSFT + 100 * X;
+      multiTS->data[X]->data[i].gpsNanoSeconds = 0;
+    }
+  }
+  MultiDetectorStateSeries *multiDetStates = XLALGetMultiDetectorStates ( multiTS, &multiDet, edat, 0.5 * TSFT );
+  XLAL_CHECK_NULL ( multiDetStates != NULL, XLAL_EFUNC );
+  XLALDestroyMultiTimestamps ( multiTS );
+  XLALDestroyEphemerisData ( edat );
+  return multiDetStates;
+}
+
+/* pick sky-positions at random */
+SkyPosition *create_sky_positions ( const UINT4 numSkyPoints )
+{
+  SkyPosition *skypos = XLALCalloc ( numSkyPoints, sizeof ( skypos[0] ) );
+  XLAL_CHECK_NULL ( skypos != NULL, XLAL_ENOMEM );
+  srand ( 1 );
+  for ( UINT4 s = 0; s < numSkyPoints; s ++ ) {
+    skypos[s].longitude = LAL_TWOPI * ( 1.0 * rand() / ( RAND_MAX + 1.0 ) );	/* uniform in [0, 2pi) */
+    skypos[s].latitude = LAL_PI_2 - acos ( 1 - 2.0 * rand() / RAND_MAX );	/* sin(delta) uniform in [-1,1] */
+    skypos[s].system = COORDINATESYSTEM_EQUATORIAL;
+  }
+  return skypos;
+}
+
+/** \endcond */
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+
+#ifndef _SKYBATCHCOMMON_H
+#define _SKYBATCHCOMMON_H
+
+#include <lal/LALStdlib.h>
+#include <lal/DetectorStates.h>
+
+/** \cond DONT_DOXYGEN */
+
+/*
+ * Detector states and sky-positions shared by SkyBatchTest and SkyBatchPerf
+ */
+
+#define NUM_DETECTORS 2
+#define TSFT 1800
+#define START_TIME 714180733
+
+MultiDetectorStateSeries *create_detector_states ( const UINT4 numSteps );
+SkyPosition *create_sky_positions ( const UINT4 numSkyPoints );
+
+/** \endcond */
+
+#endif // _SKYBATCHCOMMON_H
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ * \ingroup SSBtimes_h
+ *
+ * \brief Compare the time taken to compute the SSB-timings and antenna-pattern coefficients of many
+ * sky-positions with XLALGetMultiSSBtimesBatch() and XLALComputeMultiAMCoeffsBatch(), and with
+ * XLALGetMultiSSBtimes() and XLALComputeMultiAMCoeffs().
+ *
+ * Usage: SkyBatchPerf [number of sky-positions, default 500] [number of timestamps per detector, default 4000]
+ *
+ * Built by \c make \c bench, and not run by \c make \c check; SkyBatchTest checks that both methods agree.
+ */
+
+#include <config.h>
+
+#include <stdlib.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/DetectorStates.h>
+#include <lal/SSBtimes.h>
+#include <lal/LALComputeAM.h>
+#include <lal/LogPrintf.h>
+
+#include "SkyBatchCommon.h"
+
+/** \cond DONT_DOXYGEN */
+
+int main ( int argc, char *argv[] )
+{
+  const UINT4 numSkyPoints = ( argc > 1 ) ? (UINT4) atoi ( argv[1] ) : 500;
+  const UINT4 numSteps = ( argc > 2 ) ? (UINT4) atoi ( argv[2] ) : 4000;
+  XLAL_CHECK_MAIN ( numSkyPoints > 0 && numSteps > 7 * ( NUM_DETECTORS - 1 ), XLAL_EINVAL );
+
+  MultiDetectorStateSeries *multiDetStates = create_detector_states ( numSteps );
+  XLAL_CHECK_MAIN ( multiDetStates != NULL, XLAL_EFUNC );
+  SkyPosition *skypos = create_sky_positions ( numSkyPoints );
+  XLAL_CHECK_MAIN ( skypos != NULL, XLAL_EFUNC );
+  LIGOTimeGPS refTime = { START_TIME + 1000000, 500000000 };
+
+  /* compare SSB-timings, for each precision */
+  const SSBprecision precisions[] = { SSBPREC_NEWTONIAN, SSBPREC_RELATIVISTICOPT, SSBPREC_DMOFF };
+  for ( UINT4 p = 0; p < XLAL_NUM_ELEM ( precisions ); p ++ ) {
+    const SSBprecision precision = precisions[p];
+    MultiSSBtimes **refSSB = XLALCalloc ( numSkyPoints, sizeof ( refSSB[0] ) );
+    MultiSSBtimes **multiSSB = XLALCalloc ( numSkyPoints, sizeof ( multiSSB[0] ) );
+    XLAL_CHECK_MAIN ( refSSB != NULL && multiSSB != NULL, XLAL_ENOMEM );
+
+    REAL8 tic = XLALGetTimeOfDay();
+    for ( UINT4 s = 0; s < numSkyPoints; s ++ ) {
+      XLAL_CHECK_MAIN ( ( refSSB[s] = XLALGetMultiSSBtimes ( multiDetStates, skypos[s], refTime, precision ) ) != NULL, XLAL_EFUNC );
+    }
+    const REAL8 timeRef = XLALGetTimeOfDay() - tic;
+
+    tic = XLALGetTimeOfDay();
+    MultiSSBtimesPlan *plan = XLALCreateMultiSSBtimesPlan ( multiDetStates, refTime, precision );
+    XLAL_CHECK_MAIN ( plan != NULL, XLAL_EFUNC );
+    const REAL8 timePlan = XLALGetTimeOfDay() - tic;
+    tic = XLALGetTimeOfDay();
+    XLAL_CHECK_MAIN ( XLALGetMultiSSBtimesBatch ( multiSSB, plan, skypos, numSkyPoints ) == XLAL_SUCCESS, XLAL_EFUNC );
+    const REAL8 timeBatch = XLALGetTimeOfDay() - tic;
+
+    /* second call re-uses the output */
+    tic = XLALGetTimeOfDay();
+    XLAL_CHECK_MAIN ( XLALGetMultiSSBtimesBatch ( multiSSB, plan, skypos, numSkyPoints ) == XLAL_SUCCESS, XLAL_EFUNC );
+    const REAL8 timeReuse = XLALGetTimeOfDay() - tic;
+
+    XLALPrintInfo ( "%u sky-positions, %u timestamps, %-16s: XLALGetMultiSSBtimes(): %8.3g s, XLALGetMultiSSBtimesBatch(): %8.3g s + %8.3g s plan, speedup %6.2f, re-using output %6.2f\n",
+                    numSkyPoints, numSteps, SSBprecisionChoices[precision].name, timeRef, timeBatch, timePlan, timeRef / ( timeBatch + timePlan ), timeRef / ( timeReuse + timePlan ) );
+
+    XLALDestroyMultiSSBtimesPlan ( plan );
+    for ( UINT4 s = 0; s < numSkyPoints; s ++ ) {
+      XLALDestroyMultiSSBtimes ( refSSB[s] );
+      XLALDestroyMultiSSBtimes ( multiSSB[s] );
+    }
+    XLALFree ( refSSB );
+    XLALFree ( multiSSB );
+  }
+
+  /* compare antenna-pattern coefficients */
+  {
+    MultiAMCoeffs **refAM = XLALCalloc ( numSkyPoints, sizeof ( refAM[0] ) );
+    MultiAMCoeffs **multiAM = XLALCalloc ( numSkyPoints, sizeof ( multiAM[0] ) );
+    XLAL_CHECK_MAIN ( refAM != NULL && multiAM != NULL, XLAL_ENOMEM );
+
+    REAL8 tic = XLALGetTimeOfDay();
+    for ( UINT4 s = 0; s < numSkyPoints; s ++ ) {
+      XLAL_CHECK_MAIN ( ( refAM[s] = XLALComputeMultiAMCoeffs ( multiDetStates, NULL, skypos[s] ) ) != NULL, XLAL_EFUNC );
+    }
+    const REAL8 timeRef = XLALGetTimeOfDay() - tic;
+
+    tic = XLALGetTimeOfDay();
+    MultiAMCoeffsPlan *plan = XLALCreateMultiAMCoeffsPlan ( multiDetStates );
+    XLAL_CHECK_MAIN ( plan != NULL, XLAL_EFUNC );
+    const REAL8 timePlan = XLALGetTimeOfDay() - tic;
+    tic = XLALGetTimeOfDay();
+    XLAL_CHECK_MAIN ( XLALComputeMultiAMCoeffsBatch ( multiAM, plan, NULL, skypos, numSkyPoints ) == XLAL_SUCCESS, XLAL_EFUNC );
+    const REAL8 timeBatch = XLALGetTimeOfDay() - tic;
+
+    /* second call re-uses the output */
+    tic = XLALGetTimeOfDay();
+    XLAL_CHECK_MAIN ( XLALComputeMultiAMCoeffsBatch ( multiAM, plan, NULL, skypos, numSkyPoints ) == XLAL_SUCCESS, XLAL_EFUNC );
+    const REAL8 timeReuse = XLALGetTimeOfDay() - tic;
+
+    XLALPrintInfo ( "%u sky-positions, %u timestamps: XLALComputeMultiAMCoeffs(): %8.3g s, XLALComputeMultiAMCoeffsBatch(): %8.3g s + %8.3g s plan, speedup %6.2f, re-using output %6.2f\n",
+                    numSkyPoints, numSteps, timeRef, timeBatch, timePlan, timeRef / ( timeBatch + timePlan ), timeRef / ( timeReuse + timePlan ) );
+
+    XLALDestroyMultiAMCoeffsPlan ( plan );
+    for ( UINT4 s = 0; s < numSkyPoints; s ++ ) {
+      XLALDestroyMultiAMCoeffs ( refAM[s] );
+      XLALDestroyMultiAMCoeffs ( multiAM[s] );
+    }
+    XLALFree ( refAM );
+    XLALFree ( multiAM );
+  }
+
+  XLALFree ( skypos );
+  XLALDestroyMultiDetectorStateSeries ( multiDetStates );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
+
+/** \endcond */
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+
+/**
+ * \file
+ * \ingroup SSBtimes_h
+ *
+ * \brief Check that XLALGetMultiSSBtimesBatch() and XLALComputeMultiAMCoeffsBatch() agree with
+ * XLALGetMultiSSBtimes() and XLALComputeMultiAMCoeffs() for many sky-positions, both when they allocate
+ * their output and when they re-use it.
+ */
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <math.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/DetectorStates.h>
+#include <lal/SSBtimes.h>
+#include <lal/LALComputeAM.h>
+
+#include "SkyBatchCommon.h"
+
+/** \cond DONT_DOXYGEN */
+
+#define NUM_SKY_POINTS 50
+#define NUM_STEPS 200
+
+/* agreement required between SSB-timings: XLALGetSSBtimes() subtracts GPS times of ~1e9 s in REAL8 */
+#define TOL_DELTAT 2.5e-7
+#define TOL_TDOT 1e-14
+
+/* agreement required between antenna-pattern coefficients: both are computed in REAL4 */
+#define TOL_AB 1e-6
+#define TOL_ABC 1e-5
+
+int main ( void )
+{
+  MultiDetectorStateSeries *multiDetStates = create_detector_states ( NUM_STEPS );
+  XLAL_CHECK_MAIN ( multiDetStates != NULL, XLAL_EFUNC );
+  SkyPosition *skypos = create_sky_positions ( NUM_SKY_POINTS );
+  XLAL_CHECK_MAIN ( skypos != NULL, XLAL_EFUNC );
+  LIGOTimeGPS refTime = { START_TIME + 1000000, 500000000 };
+
+  /* compare SSB-timings, for each precision */
+  const SSBprecision precisions[] = { SSBPREC_NEWTONIAN, SSBPREC_RELATIVISTICOPT, SSBPREC_DMOFF };
+  for ( UINT4 p = 0; p < XLAL_NUM_ELEM ( precisions ); p ++ ) {
+    const SSBprecision precision = precisions[p];
+    MultiSSBtimes *refSSB[NUM_SKY_POINTS], *multiSSB[NUM_SKY_POINTS];
+    for ( UINT4 s = 0; s < NUM_SKY_POINTS; s ++ ) {
+      XLAL_CHECK_MAIN ( ( refSSB[s] = XLALGetMultiSSBtimes ( multiDetStates, skypos[s], refTime, precision ) ) != NULL, XLAL_EFUNC );
+      multiSSB[s] = NULL;
+    }
+    MultiSSBtimesPlan *plan = XLALCreateMultiSSBtimesPlan ( multiDetStates, refTime, precision );
+    XLAL_CHECK_MAIN ( plan != NULL, XLAL_EFUNC );
+
+    /* first call allocates the output, second call re-uses it */
+    for ( int call = 0; call < 2; call ++ ) {
+      XLAL_CHECK_MAIN ( XLALGetMultiSSBtimesBatch ( multiSSB, plan, skypos, NUM_SKY_POINTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+      REAL8 maxErrDeltaT = 0, maxErrTdot = 0;
+      for ( UINT4 s = 0; s < NUM_SKY_POINTS; s ++ ) {
+        XLAL_CHECK_MAIN ( multiSSB[s]->length == NUM_DETECTORS, XLAL_EFAILED );
+        for ( UINT4 X = 0; X < NUM_DETECTORS; X ++ ) {
+          const SSBtimes *ref = refSSB[s]->data[X], *tSSB = multiSSB[s]->data[X];
+          XLAL_CHECK_MAIN ( XLALGPSCmp ( &tSSB->refTime, &ref->refTime ) == 0, XLAL_EFAILED );
+          XLAL_CHECK_MAIN ( tSSB->DeltaT->length == ref->DeltaT->length && tSSB->Tdot->length == ref->Tdot->length, XLAL_EFAILED );
+          for ( UINT4 i = 0; i < ref->DeltaT->length; i ++ ) {
+            maxErrDeltaT = fmax ( maxErrDeltaT, fabs ( tSSB->DeltaT->data[i] - ref->DeltaT->data[i] ) );
+            maxErrTdot = fmax ( maxErrTdot, fabs ( tSSB->Tdot->data[i] - ref->Tdot->data[i] ) );
+          }
+        }
+      }
+      XLALPrintInfo ( "%-16s call %d: maximum errors: DeltaT %.3g s, Tdot %.3g\n", SSBprecisionChoices[precision].name, call + 1, maxErrDeltaT, maxErrTdot );
+      XLAL_CHECK_MAIN ( maxErrDeltaT <= TOL_DELTAT, XLAL_ETOL, "DeltaT differs from XLALGetMultiSSBtimes() by %g > %g s", maxErrDeltaT, TOL_DELTAT );
+      XLAL_CHECK_MAIN ( maxErrTdot <= TOL_TDOT, XLAL_ETOL, "Tdot differs from XLALGetMultiSSBtimes() by %g > %g", maxErrTdot, TOL_TDOT );
+    }
+
+    XLALDestroyMultiSSBtimesPlan ( plan );
+    for ( UINT4 s = 0; s < NUM_SKY_POINTS; s ++ ) {
+      XLALDestroyMultiSSBtimes ( refSSB[s] );
+      XLALDestroyMultiSSBtimes ( multiSSB[s] );
+    }
+  }
+
+  /* compare antenna-pattern coefficients */
+  {
+    MultiAMCoeffs *refAM[NUM_SKY_POINTS], *multiAM[NUM_SKY_POINTS];
+    for ( UINT4 s = 0; s < NUM_SKY_POINTS; s ++ ) {
+      XLAL_CHECK_MAIN ( ( refAM[s] = XLALComputeMultiAMCoeffs ( multiDetStates, NULL, skypos[s] ) ) != NULL, XLAL_EFUNC );
+      multiAM[s] = NULL;
+    }
+    MultiAMCoeffsPlan *plan = XLALCreateMultiAMCoeffsPlan ( multiDetStates );
+    XLAL_CHECK_MAIN ( plan != NULL, XLAL_EFUNC );
+
+    /* first call allocates the output, second call re-uses it */
+    for ( int call = 0; call < 2; call ++ ) {
+      XLAL_CHECK_MAIN ( XLALComputeMultiAMCoeffsBatch ( multiAM, plan, NULL, skypos, NUM_SKY_POINTS ) == XLAL_SUCCESS, XLAL_EFUNC );
+      REAL8 maxErrAB = 0, maxErrABC = 0;
+      for ( UINT4 s = 0; s < NUM_SKY_POINTS; s ++ ) {
+        XLAL_CHECK_MAIN ( multiAM[s]->length == NUM_DETECTORS, XLAL_EFAILED );
+        for ( UINT4 X = 0; X < NUM_DETECTORS; X ++ ) {
+          const AMCoeffs *ref = refAM[s]->data[X], *coeffs = multiAM[s]->data[X];
+          XLAL_CHECK_MAIN ( coeffs->a->length == ref->a->length && coeffs->b->length == ref->b->length, XLAL_EFAILED );
+          for ( UINT4 i = 0; i < ref->a->length; i ++ ) {
+            maxErrAB = fmax ( maxErrAB, fabs ( coeffs->a->data[i] - ref->a->data[i] ) );
+            maxErrAB = fmax ( maxErrAB, fabs ( coeffs->b->data[i] - ref->b->data[i] ) );
+          }
+          maxErrABC = fmax ( maxErrABC, fabs ( coeffs->A - ref->A ) / ref->A );
+          maxErrABC = fmax ( maxErrABC, fabs ( coeffs->B - ref->B ) / ref->B );
+          maxErrABC = fmax ( maxErrABC, fabs ( coeffs->C - ref->C ) / sqrt ( ref->A * ref->B ) );
+        }
+        const AntennaPatternMatrix *M = &multiAM[s]->Mmunu, *Mref = &refAM[s]->Mmunu;
+        maxErrABC = fmax ( maxErrABC, fabs ( M->Ad - Mref->Ad ) / Mref->Ad );
+        maxErrABC = fmax ( maxErrABC, fabs ( M->Bd - Mref->Bd ) / Mref->Bd );
+        maxErrABC = fmax ( maxErrABC, fabs ( M->Cd - Mref->Cd ) / sqrt ( Mref->Ad * Mref->Bd ) );
+      }
+      XLALPrintInfo ( "antenna patterns call %d: maximum errors: a,b %.3g, A,B,C %.3g\n", call + 1, maxErrAB, maxErrABC );
+      XLAL_CHECK_MAIN ( maxErrAB <= TOL_AB, XLAL_ETOL, "a,b differ from XLALComputeMultiAMCoeffs() by %g > %g", maxErrAB, TOL_AB );
+      XLAL_CHECK_MAIN ( maxErrABC <= TOL_ABC, XLAL_ETOL, "A,B,C differ from XLALComputeMultiAMCoeffs() by %g > %g", maxErrABC, TOL_ABC );
+    }
+
+    XLALDestroyMultiAMCoeffsPlan ( plan );
+    for ( UINT4 s = 0; s < NUM_SKY_POINTS; s ++ ) {
+      XLALDestroyMultiAMCoeffs ( refAM[s] );
+      XLALDestroyMultiAMCoeffs ( multiAM[s] );
+    }
+  }
+
+  XLALFree ( skypos );
+  XLALDestroyMultiDetectorStateSeries ( multiDetStates );
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
+
+/** \endcond */
@@ -42,6 +42,19 @@ typedef enum {
     INCLINATION = 8
 } CacheVariableDiffersBitmask;
 
+/**
+ * Less recently used waveforms in a cache which holds more than one waveform.
+ * The most recently used waveform is stored in the cache structure itself;
+ * the others are stored in entries[], most recently used first. When the
+ * cache is full, the least recently used waveform is evicted.
+ */
+struct tagLALSimInspiralWaveformCacheLRU {
+    UINT4 maxLength;                        /**< maximum number of less recently used waveforms */
+    UINT4 length;                           /**< number of less recently used waveforms */
+    size_t maxBytes;                        /**< memory budget for all cached waveforms in bytes; 0 means no limit */
+    LALSimInspiralWaveformCache **entries;  /**< less recently used waveforms */
+};
+
 static CacheVariableDiffersBitmask CacheArgsDifferenceBitmask(
         LALSimInspiralWaveformCache *cache,
         REAL8 phiRef,
@@ -61,6 +74,28 @@ static int FrequenciesAreDifferent(
         REAL8Sequence *newFrequencies,
         REAL8Sequence *cachedFrequencies);
 
+static CacheVariableDiffersBitmask FindCacheEntry(
+        LALSimInspiralWaveformCache *cache,
+        CacheVariableDiffersBitmask changedParams,
+        REAL8 phiRef,
+        REAL8 deltaTF,
+        REAL8 m1,
+        REAL8 m2,
+        REAL8 S1x, REAL8 S1y, REAL8 S1z,
+        REAL8 S2x, REAL8 S2y, REAL8 S2z,
+        REAL8 f_min, REAL8 f_ref, REAL8 f_max,
+        REAL8 r,
+        REAL8 i,
+        LALDict *LALpars,
+        Approximant approximant,
+        REAL8Sequence *frequencies);
+
+static int PushCacheEntry(LALSimInspiralWaveformCache *cache);
+
+static void TrimCacheEntries(LALSimInspiralWaveformCache *cache);
+
+static void ClearCacheEntry(LALSimInspiralWaveformCache *entry);
+
 static int StoreTDHCache(LALSimInspiralWaveformCache *cache,
         REAL8TimeSeries *hplus,
         REAL8TimeSeries *hcross,
@@ -105,6 +140,8 @@ static int StoreFDHCache(LALSimInspiralWaveformCache *cache,
  * waveform and its parameters are stored. If the next call requests a waveform
  * that can be obtained by a simple transformation, then it is done.
  * This bypasses the waveform generation and speeds up the code.
+ * A cache created by XLALCreateSimInspiralWaveformCacheLRU() also stores
+ * less recently used waveforms, any of which may be transformed.
  */
 int XLALSimInspiralChooseTDWaveformFromCache(
         REAL8TimeSeries **hplus,                /**< +-polarization waveform */
@@ -146,8 +183,14 @@ int XLALSimInspiralChooseTDWaveformFromCache(
             m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, 0., r, i,
             LALpars, approximant, NULL);
 
+    // Look for the intrinsic parameters among less recently used waveforms
+    changedParams = FindCacheEntry(cache, changedParams, phiRef, deltaT,
+            m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, 0., r, i,
+            LALpars, approximant, NULL);
+
     // No parameters have changed! Copy the cached polarizations
     if( changedParams == NO_DIFFERENCE ) {
+        cache->hits++;
         *hplus = XLALCutREAL8TimeSeries(cache->hplus, 0,
                 cache->hplus->data->length);
         if (*hplus == NULL) return XLAL_ENOMEM;
@@ -164,15 +207,22 @@ int XLALSimInspiralChooseTDWaveformFromCache(
 
     // Intrinsic parameters have changed. We must generate a new waveform
     if( (changedParams & INTRINSIC) != 0 ) {
+        cache->misses++;
 
         status = XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2, S1x, S1y, S1z, S2x, S2y, S2z,
 						 r, i, phiRef, 0., 0., 0., deltaT, f_min, f_ref, LALpars,
 						 approximant);
         if (status == XLAL_FAILURE) return status;
 
+        // Keep the previous waveform as less recently used, if there is room
+        status = PushCacheEntry(cache);
+        if (status != XLAL_SUCCESS) return status;
+
         // FIXME: Need to add hlms, dynamic variables, etc. in cache
-        return StoreTDHCache(cache, *hplus, *hcross, phiRef, deltaT, m1, m2,
+        status = StoreTDHCache(cache, *hplus, *hcross, phiRef, deltaT, m1, m2,
 			     S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, r, i, LALpars, approximant);
+        TrimCacheEntries(cache);
+        return status;
     }
 
     INT4 ampO=XLALSimInspiralWaveformParamsLookupPNAmplitudeOrder(LALpars);
@@ -181,6 +231,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
         // If polarizations are not cached we must generate a fresh waveform
         // FIXME: Will need to check hlms and/or dynamical variables as well
         if( cache->hplus == NULL || cache->hcross == NULL) {
+            cache->misses++;
             status = XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2,
 						     S1x, S1y, S1z, S2x, S2y, S2z, r, i,
 						     phiRef, 0., 0., 0., deltaT, f_min, f_ref, LALpars,
@@ -196,6 +247,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
         if( changedParams & INCLINATION ) {
             // FIXME: For now just treat as intrinsic parameter.
             // Will come back and put in transformation
+            cache->misses++;
             status = XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2,
 						     S1x, S1y, S1z, S2x, S2y, S2z, r, i,
 						     phiRef, 0., 0., 0., deltaT, f_min, f_ref,
@@ -210,6 +262,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
         if( changedParams & PHI_REF ) {
             // FIXME: For now just treat as intrinsic parameter.
             // Will come back and put in transformation
+            cache->misses++;
             status = XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2,
 						     S1x, S1y, S1z, S2x, S2y, S2z, r, i,
 						     phiRef, 0., 0., 0., deltaT, f_min, f_ref,
@@ -248,6 +301,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
             }
         }
 
+        cache->hits++;
         return XLAL_SUCCESS;
     }
 
@@ -257,6 +311,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
                 || approximant==EOBNRv2 || approximant==SEOBNRv1) ) {
         // If polarizations are not cached we must generate a fresh waveform
         if( cache->hplus == NULL || cache->hcross == NULL) {
+            cache->misses++;
             status = XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2,
 						     S1x, S1y, S1z, S2x, S2y, S2z, r, i,
 						     phiRef, 0., 0., 0., deltaT, f_min, f_ref, LALpars, approximant);
@@ -319,6 +374,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
                     + cosrot*cache->hcross->data->data[j]);
         }
 
+        cache->hits++;
         return XLAL_SUCCESS;
     }
     // case 3: Non-precessing, ampO > 0
@@ -331,6 +387,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
         // FIXME: Add in check that hlms non-NULL
         if( cache->hplus == NULL || cache->hcross == NULL) {
             // FIXME: This will change to a code-path: inputs->hlms->{h+,hx}
+            cache->misses++;
             status = XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2,
 						     S1x, S1y, S1z, S2x, S2y, S2z, r, i,
 						     phiRef, 0., 0., 0., deltaT, f_min, f_ref, LALpars, approximant);
@@ -345,6 +402,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
         if( changedParams & INCLINATION) {
             // FIXME: For now just treat as intrinsic parameter.
             // Will come back and put in transformation
+            cache->misses++;
             status = XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2,
 						     S1x, S1y, S1z, S2x, S2y, S2z, r, i,
 						     phiRef, 0., 0., 0., deltaT, f_min, f_ref, LALpars, approximant);
@@ -359,6 +417,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
         if( changedParams & PHI_REF ) {
             // FIXME: For now just treat as intrinsic parameter.
             // Will come back and put in transformation
+            cache->misses++;
             status = XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2,
 						     S1x, S1y, S1z, S2x, S2y, S2z, r, i,
 						     phiRef, 0., 0., 0., deltaT, f_min, f_ref, LALpars,
@@ -398,6 +457,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
             }
         }
 
+        cache->hits++;
         return XLAL_SUCCESS;
     }
 
@@ -405,6 +465,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
     // Basically, you requested a waveform type which is not setup for caching
     // b/c of lack of interest or it's unclear what/how to cache for that model
     else {
+        cache->misses++;
         return XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2,
 					       S1x, S1y, S1z, S2x, S2y, S2z, r, i,
 					       phiRef, 0., 0., 0., deltaT, f_min, f_ref, LALpars, approximant);
@@ -420,6 +481,8 @@ int XLALSimInspiralChooseTDWaveformFromCache(
  * waveform and its parameters are stored. If the next call requests a waveform
  * that can be obtained by a simple transformation, then it is done.
  * This bypasses the waveform generation and speeds up the code.
+ * A cache created by XLALCreateSimInspiralWaveformCacheLRU() also stores
+ * less recently used waveforms, any of which may be transformed.
  */
 int XLALSimInspiralChooseFDWaveformFromCache(
         COMPLEX16FrequencySeries **hptilde,     /**< +-polarization waveform */
@@ -472,8 +535,14 @@ int XLALSimInspiralChooseFDWaveformFromCache(
             m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, f_max, r, i,
 	    LALpars, approximant, frequencies);
 
+    // Look for the intrinsic parameters among less recently used waveforms
+    changedParams = FindCacheEntry(cache, changedParams, phiRef, deltaF,
+            m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, f_max, r, i,
+            LALpars, approximant, frequencies);
+
     // No parameters have changed! Copy the cached polarizations
     if( changedParams == NO_DIFFERENCE ) {
+        cache->hits++;
         *hptilde = XLALCutCOMPLEX16FrequencySeries(cache->hptilde, 0,
                 cache->hptilde->data->length);
         if (*hptilde == NULL) return XLAL_ENOMEM;
@@ -490,6 +559,7 @@ int XLALSimInspiralChooseFDWaveformFromCache(
 
     // Intrinsic parameters have changed. We must generate a new waveform
     if( (changedParams & INTRINSIC) != 0 ) {
+        cache->misses++;
         if ( frequencies != NULL ){
             status =  XLALSimInspiralChooseFDWaveformSequence(hptilde, hctilde, phiRef,
                 m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_ref,
@@ -504,8 +574,14 @@ int XLALSimInspiralChooseFDWaveformFromCache(
         }
         if (status == XLAL_FAILURE) return status;
 
-        return StoreFDHCache(cache, *hptilde, *hctilde, phiRef, deltaF, m1, m2,
+        // Keep the previous waveform as less recently used, if there is room
+        status = PushCacheEntry(cache);
+        if (status != XLAL_SUCCESS) return status;
+
+        status = StoreFDHCache(cache, *hptilde, *hctilde, phiRef, deltaF, m1, m2,
 			     S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, f_max, r, i, LALpars, approximant, frequencies);
+        TrimCacheEntries(cache);
+        return status;
     }
 
     // case 1: Non-precessing, 2nd harmonic only
@@ -516,6 +592,7 @@ int XLALSimInspiralChooseFDWaveformFromCache(
         // If polarizations are not cached we must generate a fresh waveform
         // FIXME: Will need to check hlms and/or dynamical variables as well
         if( cache->hptilde == NULL || cache->hctilde == NULL) {
+            cache->misses++;
             if ( frequencies != NULL ){
                 status =  XLALSimInspiralChooseFDWaveformSequence(hptilde, hctilde, phiRef,
                     m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_ref,
@@ -583,6 +660,7 @@ int XLALSimInspiralChooseFDWaveformFromCache(
                     * cache->hctilde->data->data[j];
         }
 
+        cache->hits++;
         return XLAL_SUCCESS;
     }
 
@@ -595,6 +673,7 @@ int XLALSimInspiralChooseFDWaveformFromCache(
     // Basically, you requested a waveform type which is not setup for caching
     // b/c of lack of interest or it's unclear what/how to cache for that model
     else {
+        cache->misses++;
         if ( frequencies != NULL ){
             return XLALSimInspiralChooseFDWaveformSequence(hptilde, hctilde, phiRef,
                     m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_ref,
@@ -624,17 +703,57 @@ LALSimInspiralWaveformCache *XLALCreateSimInspiralWaveformCache()
     return cache;
 }
 
+/**
+ * Construct and initialize a waveform cache which stores up to
+ * maxEntries of the most recently used waveforms. When the cache is full,
+ * or when the waveforms it stores use more than maxBytes of memory,
+ * the least recently used waveforms are evicted; the most recently
+ * used waveform is always kept. A cache with maxEntries <= 1 behaves
+ * like one constructed by XLALCreateSimInspiralWaveformCache().
+ */
+LALSimInspiralWaveformCache *XLALCreateSimInspiralWaveformCacheLRU(
+        UINT4 maxEntries,       /**< maximum number of waveforms to store */
+        size_t maxBytes         /**< memory budget for stored waveforms in bytes; 0 means no limit */
+        )
+{
+    LALSimInspiralWaveformCache *cache = XLALCreateSimInspiralWaveformCache();
+    if (cache == NULL) XLAL_ERROR_NULL(XLAL_ENOMEM);
+    if (maxEntries <= 1) return cache;
+
+    cache->lru = XLALCalloc(1, sizeof(*cache->lru));
+    if (cache->lru == NULL) {
+        XLALDestroySimInspiralWaveformCache(cache);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+    cache->lru->maxLength = maxEntries - 1;
+    cache->lru->maxBytes = maxBytes;
+    cache->lru->entries = XLALCalloc(cache->lru->maxLength,
+            sizeof(*cache->lru->entries));
+    if (cache->lru->entries == NULL) {
+        XLALDestroySimInspiralWaveformCache(cache);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+
+    return cache;
+}
+
 /**
  * Destroy a waveform cache.
  */
 void XLALDestroySimInspiralWaveformCache(LALSimInspiralWaveformCache *cache)
 {
+    UINT4 j;
+
     if (cache != NULL) {
-        XLALDestroyREAL8TimeSeries(cache->hplus);
-        XLALDestroyREAL8TimeSeries(cache->hcross);
-        XLALDestroyCOMPLEX16FrequencySeries(cache->hptilde);
-        XLALDestroyCOMPLEX16FrequencySeries(cache->hctilde);
-        if(cache->LALpars) XLALDestroyDict(cache->LALpars);
+        ClearCacheEntry(cache);
+        if (cache->lru != NULL) {
+            for (j = 0; j < cache->lru->length; j++) {
+                ClearCacheEntry(cache->lru->entries[j]);
+                XLALFree(cache->lru->entries[j]);
+            }
+            XLALFree(cache->lru->entries);
+            XLALFree(cache->lru);
+        }
         XLALFree(cache);
     }
 }
@@ -715,6 +834,160 @@ static int FrequenciesAreDifferent(
     return 0;
 }
 
+/**
+ * Exchange the waveforms and parameters stored in the cache with those
+ * stored in one of its entries; the list of entries and the statistics
+ * belong to the cache itself, and are not exchanged.
+ */
+static void SwapCacheEntry(LALSimInspiralWaveformCache *cache,
+        LALSimInspiralWaveformCache *entry)
+{
+    LALSimInspiralWaveformCache tmp = *entry;
+    tmp.lru = cache->lru;
+    tmp.hits = cache->hits;
+    tmp.misses = cache->misses;
+    *entry = *cache;
+    entry->lru = NULL;
+    entry->hits = entry->misses = 0;
+    *cache = tmp;
+}
+
+/**
+ * Search the less recently used waveforms in the cache for the requested
+ * intrinsic parameters, if they differ from those of the most recently used
+ * waveform. If found, the waveform becomes the most recently used one.
+ * Returns the bitmask of changed parameters relative to the most recently
+ * used waveform.
+ */
+static CacheVariableDiffersBitmask FindCacheEntry(
+        LALSimInspiralWaveformCache *cache,
+        CacheVariableDiffersBitmask changedParams,
+        REAL8 phiRef,
+        REAL8 deltaTF,
+        REAL8 m1,
+        REAL8 m2,
+        REAL8 S1x, REAL8 S1y, REAL8 S1z,
+        REAL8 S2x, REAL8 S2y, REAL8 S2z,
+        REAL8 f_min, REAL8 f_ref, REAL8 f_max,
+        REAL8 r,
+        REAL8 i,
+        LALDict *LALpars,
+        Approximant approximant,
+        REAL8Sequence *frequencies
+        )
+{
+    LALSimInspiralWaveformCache *entry;
+    CacheVariableDiffersBitmask difference;
+    UINT4 j, k;
+
+    if ( (changedParams & INTRINSIC) == 0 || cache->lru == NULL )
+        return changedParams;
+
+    for (j = 0; j < cache->lru->length; j++) {
+        entry = cache->lru->entries[j];
+        difference = CacheArgsDifferenceBitmask(entry, phiRef, deltaTF,
+                m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, f_max,
+                r, i, LALpars, approximant, frequencies);
+        if ( (difference & INTRINSIC) != 0 ) continue;
+
+        // Move the more recently used entries down by one, and
+        // exchange the found waveform with the most recently used one
+        for (k = j; k > 0; k--)
+            cache->lru->entries[k] = cache->lru->entries[k-1];
+        cache->lru->entries[0] = entry;
+        SwapCacheEntry(cache, entry);
+
+        return difference;
+    }
+
+    return changedParams;
+}
+
+/**
+ * Make the most recently used waveform in the cache the first of the less
+ * recently used waveforms, evicting the least recently used waveform if
+ * the cache is full. The fields of the most recently used waveform are then
+ * either empty or those of the evicted waveform, to be overwritten by
+ * StoreTDHCache() or StoreFDHCache().
+ */
+static int PushCacheEntry(LALSimInspiralWaveformCache *cache)
+{
+    LALSimInspiralWaveformCache *entry;
+    UINT4 k;
+
+    if (cache->lru == NULL) return XLAL_SUCCESS;
+    if (cache->hplus == NULL && cache->hptilde == NULL) return XLAL_SUCCESS;
+
+    if (cache->lru->length < cache->lru->maxLength) {
+        entry = XLALCalloc(1, sizeof(*entry));
+        if (entry == NULL) return XLAL_ENOMEM;
+        cache->lru->length++;
+    }
+    else {
+        entry = cache->lru->entries[cache->lru->length - 1];
+    }
+
+    for (k = cache->lru->length - 1; k > 0; k--)
+        cache->lru->entries[k] = cache->lru->entries[k-1];
+    cache->lru->entries[0] = entry;
+    SwapCacheEntry(cache, entry);
+
+    return XLAL_SUCCESS;
+}
+
+/** Return the memory used by a waveform stored in the cache, in bytes. */
+static size_t CacheEntryBytes(LALSimInspiralWaveformCache *entry)
+{
+    size_t bytes = 0;
+    if (entry->hplus) bytes += entry->hplus->data->length * sizeof(REAL8);
+    if (entry->hcross) bytes += entry->hcross->data->length * sizeof(REAL8);
+    if (entry->hptilde) bytes += entry->hptilde->data->length * sizeof(COMPLEX16);
+    if (entry->hctilde) bytes += entry->hctilde->data->length * sizeof(COMPLEX16);
+    if (entry->frequencies) bytes += entry->frequencies->length * sizeof(REAL8);
+    return bytes;
+}
+
+/**
+ * Evict the least recently used waveforms from the cache until
+ * the waveforms it stores are within its memory budget.
+ */
+static void TrimCacheEntries(LALSimInspiralWaveformCache *cache)
+{
+    size_t bytes;
+    UINT4 j, k;
+
+    if (cache->lru == NULL || cache->lru->maxBytes == 0) return;
+
+    bytes = CacheEntryBytes(cache);
+    for (j = 0; j < cache->lru->length; j++) {
+        bytes += CacheEntryBytes(cache->lru->entries[j]);
+        if (bytes > cache->lru->maxBytes) {
+            for (k = j; k < cache->lru->length; k++) {
+                ClearCacheEntry(cache->lru->entries[k]);
+                XLALFree(cache->lru->entries[k]);
+                cache->lru->entries[k] = NULL;
+            }
+            cache->lru->length = j;
+            break;
+        }
+    }
+}
+
+/** Free the waveforms and parameters stored in a cache entry. */
+static void ClearCacheEntry(LALSimInspiralWaveformCache *entry)
+{
+    XLALDestroyREAL8TimeSeries(entry->hplus);
+    XLALDestroyREAL8TimeSeries(entry->hcross);
+    XLALDestroyCOMPLEX16FrequencySeries(entry->hptilde);
+    XLALDestroyCOMPLEX16FrequencySeries(entry->hctilde);
+    if(entry->LALpars) XLALDestroyDict(entry->LALpars);
+    XLALDestroyREAL8Sequence(entry->frequencies);
+    entry->hplus = entry->hcross = NULL;
+    entry->hptilde = entry->hctilde = NULL;
+    entry->LALpars = NULL;
+    entry->frequencies = NULL;
+}
+
 /** Store the output TD hplus and hcross in the cache. */
 static int StoreTDHCache(LALSimInspiralWaveformCache *cache,
         REAL8TimeSeries *hplus,
@@ -760,6 +1033,7 @@ static int StoreTDHCache(LALSimInspiralWaveformCache *cache,
     if(cache->LALpars) XLALDestroyDict(cache->LALpars);
     cache->LALpars = XLALDictDuplicate(LALpars);
     cache->approximant = approximant;
+    XLALDestroyREAL8Sequence(cache->frequencies);
     cache->frequencies = NULL;
 
     // Copy over the waveforms
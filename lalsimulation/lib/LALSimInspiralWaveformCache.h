@@ -97,12 +97,17 @@ tagLALSimInspiralWaveformCache {
     LALDict *LALpars;
     Approximant approximant;
     REAL8Sequence *frequencies;
+    struct tagLALSimInspiralWaveformCacheLRU *lru; /**< less recently used waveforms, if the cache holds more than one waveform */
+    UINT8 hits;                 /**< number of waveforms obtained from the cache */
+    UINT8 misses;               /**< number of waveforms which had to be generated */
 } LALSimInspiralWaveformCache;
 
 /** @} */
 
 LALSimInspiralWaveformCache *XLALCreateSimInspiralWaveformCache(void);
 
+LALSimInspiralWaveformCache *XLALCreateSimInspiralWaveformCacheLRU(UINT4 maxEntries, size_t maxBytes);
+
 void XLALDestroySimInspiralWaveformCache(LALSimInspiralWaveformCache *cache);
 
 int XLALSimInspiralChooseTDWaveformFromCache(REAL8TimeSeries **hplus, REAL8TimeSeries **hcross, REAL8 phiRef, REAL8 deltaT, REAL8 m1, REAL8 m2, REAL8 s1x, REAL8 s1y, REAL8 s1z, REAL8 s2x, REAL8 s2y, REAL8 s2z, REAL8 f_min, REAL8 f_ref, REAL8 r, REAL8 i, LALDict *LALpars, Approximant approximant, LALSimInspiralWaveformCache *cache);
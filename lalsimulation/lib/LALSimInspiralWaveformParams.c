@@ -1,3 +1,4 @@
+#include <lal/LALConfig.h>
 #include <lal/LALStdio.h>
 #include <lal/LALDict.h>
 #include <lal/LALSimInspiral.h>
@@ -11,12 +12,40 @@
 		return XLALDictInsert ## TYPE ## Value(params, KEY, value); \
 	}
 
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#define LOOKUP_ONCE_TYPE pthread_once_t
+#define LOOKUP_ONCE_INIT PTHREAD_ONCE_INIT
+#define LOOKUP_ONCE(once, init) (void) pthread_once(once, init)
+#else
+#define LOOKUP_ONCE_TYPE int
+#define LOOKUP_ONCE_INIT 1
+#define LOOKUP_ONCE(once, init) (*(once) ? (init)(), *(once) = 0 : 0)
+#endif
+
+/*
+ * The key handle is interned once, on the first lookup; if interning
+ * fails, lookups fall back to finding the key by name.
+ */
 #define DEFINE_LOOKUP_FUNC(NAME, TYPE, KEY, DEFAULT) \
+	static const LALDictKeyHandle *lookup_key_ ## NAME = NULL; \
+	static LOOKUP_ONCE_TYPE lookup_key_once_ ## NAME = LOOKUP_ONCE_INIT; \
+	static void lookup_key_init_ ## NAME(void) \
+	{ \
+		lookup_key_ ## NAME = XLALDictInternKey(KEY); \
+	} \
 	TYPE XLALSimInspiralWaveformParamsLookup ## NAME(LALDict *params) \
 	{ \
 		TYPE value = DEFAULT; \
-		if (params && XLALDictContains(params, KEY)) \
-			value = XLALDictLookup ## TYPE ## Value(params, KEY); \
+		if (params) { \
+			LOOKUP_ONCE(&lookup_key_once_ ## NAME, lookup_key_init_ ## NAME); \
+			const LALDictKeyHandle *key = lookup_key_ ## NAME; \
+			if (key == NULL) { \
+				if (XLALDictContains(params, KEY)) \
+					value = XLALDictLookup ## TYPE ## Value(params, KEY); \
+			} else if (XLALDictContainsKeyHandle(params, key)) \
+				value = XLALDictLookup ## TYPE ## ValueByKeyHandle(params, key); \
+		} \
 		return value; \
 	}
 
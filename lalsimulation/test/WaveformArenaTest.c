@@ -0,0 +1,125 @@
+/*
+ *  Copyright (C) 2026
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+ *  MA  02111-1307  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check that frequency-domain waveforms generated with a thread arena
+ * pushed are identical to those generated on the heap, and compare the number
+ * of LALMalloc() calls and the time taken per waveform.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALArena.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDict.h>
+#include <lal/FrequencySeries.h>
+#include <lal/LogPrintf.h>
+#include <lal/LALSimInspiral.h>
+
+#define NWAVEFORMS 50
+
+/* generate NWAVEFORMS waveforms over a range of masses, optionally from an arena */
+static int generate(Approximant approx, LALArena *arena, COMPLEX16FrequencySeries **hptilde0, size_t *nmalloc, REAL8 *t)
+{
+  const REAL8 f_min = 20., f_max = 1024., df = 1. / 8.;
+  const size_t nmalloc0 = lalMallocCount;
+  const REAL8 tic = XLALGetCPUTime();
+
+  for (int k = 0; k < NWAVEFORMS; ++k) {
+    COMPLEX16FrequencySeries *hptilde = NULL, *hctilde = NULL;
+    const REAL8 m1 = (20. + 0.2 * k) * LAL_MSUN_SI, m2 = (15. - 0.1 * k) * LAL_MSUN_SI;
+    if (arena) {
+      XLAL_CHECK(XLALArenaPush(arena) == XLAL_SUCCESS, XLAL_EFUNC);
+    }
+    XLAL_CHECK(XLALSimInspiralChooseFDWaveform(&hptilde, &hctilde, m1, m2, 0., 0., 0.3, 0., 0., -0.2,
+                                               100. * 1e6 * LAL_PC_SI, 0.4, 0.7, 0., 0., 0., df, f_min, f_max, f_min,
+                                               NULL, approx) == XLAL_SUCCESS, XLAL_EFUNC);
+
+    /* compare the first waveform against the reference, or keep it as the reference */
+    if (k == 0) {
+      if (*hptilde0 == NULL) {
+        XLAL_CHECK(arena == NULL, XLAL_EINVAL);
+        *hptilde0 = hptilde;
+        hptilde = NULL;
+      } else {
+        XLAL_CHECK(hptilde->data->length == (*hptilde0)->data->length, XLAL_EFAILED);
+        XLAL_CHECK(memcmp(hptilde->data->data, (*hptilde0)->data->data, hptilde->data->length * sizeof(COMPLEX16)) == 0, XLAL_EFAILED,
+                   "%s waveform generated from an arena differs from waveform generated on the heap", XLALSimInspiralGetStringFromApproximant(approx));
+      }
+    }
+
+    XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+    XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+    if (arena) {
+      XLAL_CHECK(XLALArenaPop(arena) == XLAL_SUCCESS, XLAL_EFUNC);
+      XLALArenaReset(arena);
+    }
+  }
+
+  *t = (XLALGetCPUTime() - tic) / NWAVEFORMS;
+  *nmalloc = (lalMallocCount - nmalloc0) / NWAVEFORMS;
+
+  return XLAL_SUCCESS;
+}
+
+static int test_approximant(Approximant approx)
+{
+  const char *name = XLALSimInspiralGetStringFromApproximant(approx);
+  COMPLEX16FrequencySeries *hptilde0 = NULL;
+  size_t nmalloc_heap = 0, nmalloc_arena = 0;
+  REAL8 t_heap = 0, t_arena = 0;
+
+  LALArena *arena = XLALGetThreadArena();
+  XLAL_CHECK(arena != NULL, XLAL_EFUNC);
+
+  XLAL_CHECK(generate(approx, NULL, &hptilde0, &nmalloc_heap, &t_heap) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  /* warm up the arena, after which it should not need to allocate any more blocks */
+  XLAL_CHECK(generate(approx, arena, &hptilde0, &nmalloc_arena, &t_arena) == XLAL_SUCCESS, XLAL_EFUNC);
+  const size_t nblockallocs = XLALArenaGetNumBlockAllocs(arena);
+  XLAL_CHECK(generate(approx, arena, &hptilde0, &nmalloc_arena, &t_arena) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK(XLALArenaGetNumBlockAllocs(arena) == nblockallocs, XLAL_EFAILED,
+             "%s: arena allocated %zu blocks after warm-up", name, XLALArenaGetNumBlockAllocs(arena) - nblockallocs);
+
+  /* LALMalloc() is only counted when memory debugging is enabled */
+  if (lalMallocCount > 0) {
+    XLAL_CHECK(nmalloc_arena < nmalloc_heap, XLAL_EFAILED, "%s: arena did not reduce the number of LALMalloc() calls", name);
+  }
+
+  XLALPrintInfo("%-14s: heap %6zu LALMalloc() calls %8.3g s, arena %6zu LALMalloc() calls %8.3g s per waveform\n",
+                name, nmalloc_heap, t_heap, nmalloc_arena, t_arena);
+
+  XLALDestroyCOMPLEX16FrequencySeries(hptilde0);
+
+  return XLAL_SUCCESS;
+}
+
+int main(void)
+{
+  XLAL_CHECK_MAIN(test_approximant(IMRPhenomD) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(test_approximant(IMRPhenomXAS) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+}
@@ -30,12 +30,16 @@
 #include <lal/FrequencySeries.h>
 #include <time.h>
 #include <lal/LALConstants.h>
+#include <lal/LALStdio.h>
+
+// Maximum difference of a waveform transformed from the LRU cache, relative to the largest amplitude
+#define LRU_TOLERANCE 1e-10
 
 int main(void) {
     clock_t s1, e1, s2, e2;
     double diff1, diff2;
     unsigned int i;
-    REAL8 plusdiff, crossdiff, temp;
+    REAL8 plusdiff, crossdiff, maxabs, temp;
     REAL8TimeSeries *hplus = NULL;
     REAL8TimeSeries *hcross = NULL;
     REAL8TimeSeries *hplusC = NULL;
@@ -54,7 +58,9 @@ int main(void) {
     REAL8 phiref1 = 0., phiref2 = 0.3;
     REAL8 inc1 = 0.2, inc2 = 1.3;
     REAL8 dist1 = 1.e6 * LAL_PC_SI, dist2 = 2.e6 * LAL_PC_SI;
+    REAL8 m1b = 12. * LAL_MSUN_SI, m2b = 8. * LAL_MSUN_SI;
     LALSimInspiralWaveformCache *cache = XLALCreateSimInspiralWaveformCache();
+    LALSimInspiralWaveformCache *cacheLRU = NULL;
     LALDict *LALpars=XLALCreateDict();
     XLALSimInspiralWaveformParamsInsertTidalLambda1(LALpars,lambda1);
     XLALSimInspiralWaveformParamsInsertTidalLambda1(LALpars,lambda2);
@@ -221,7 +227,6 @@ int main(void) {
     ret = XLALSimInspiralChooseFDWaveformFromCache(&hptildeC, &hctildeC,
             phiref2, df, m1, m2, s1x, s1y, s1z, s2x, s2y, s2z, f_min, f_max,
             f_ref, dist2, inc2, LALpars, approxFD, cache, NULL);
-    XLALDestroyDict(LALpars);
     e2 = clock();
     diff2 = (double) (e2 - s2) / CLOCKS_PER_SEC;
     if( ret == XLAL_FAILURE )
@@ -249,6 +254,74 @@ int main(void) {
     XLALDestroyCOMPLEX16FrequencySeries(hctildeC);
     hptilde = hctilde = hptildeC = hctildeC = NULL;
 
+    //
+    // Test FD path with TaylorF2 and a cache of more than one waveform
+    //
+
+    // Alternate between two sets of intrinsic parameters; after the first
+    // waveform of each set is generated, both are found in the cache
+    cacheLRU = XLALCreateSimInspiralWaveformCacheLRU(2, 0);
+    if( cacheLRU == NULL )
+        XLAL_ERROR(XLAL_EFUNC);
+    for(i=0; i < 6; i++)
+    {
+        ret = XLALSimInspiralChooseFDWaveformFromCache(&hptildeC, &hctildeC,
+                (i/2) % 2 ? phiref2 : phiref1, df,
+                i % 2 ? m1b : m1, i % 2 ? m2b : m2,
+                s1x, s1y, s1z, s2x, s2y, s2z, f_min, f_max, f_ref,
+                (i/2) % 2 ? dist2 : dist1, (i/2) % 2 ? inc2 : inc1,
+                LALpars, approxFD, cacheLRU, NULL);
+        if( ret == XLAL_FAILURE )
+            XLAL_ERROR(XLAL_EFUNC);
+        if( i < 5 ) {
+            XLALDestroyCOMPLEX16FrequencySeries(hptildeC);
+            XLALDestroyCOMPLEX16FrequencySeries(hctildeC);
+            hptildeC = hctildeC = NULL;
+        }
+    }
+
+    // The last waveform was transformed from the least recently used one
+    ret = XLALSimInspiralChooseFDWaveform(&hptilde, &hctilde,
+					  m1b, m2b, s1x, s1y, s1z, s2x, s2y, s2z,
+					  dist2, inc2,
+					  phiref2, 0., 0., 0.,
+					  df, f_min, f_max, f_ref,
+					  LALpars, approxFD);
+    if( ret == XLAL_FAILURE )
+        XLAL_ERROR(XLAL_EFUNC);
+    XLALDestroyDict(LALpars);
+
+    // Find level of agreement, relative to the largest amplitude
+    if( hptildeC->data->length != hptilde->data->length || hctildeC->data->length != hctilde->data->length )
+        XLAL_ERROR(XLAL_EFAILED, "Waveform transformed from the cache has the wrong length");
+    plusdiff = crossdiff = maxabs = 0.;
+    for(i=0; i < hptilde->data->length; i++)
+    {
+        temp = cabs(hptilde->data->data[i] - hptildeC->data->data[i]);
+        if(temp > plusdiff) plusdiff = temp;
+        temp = cabs(hctilde->data->data[i] - hctildeC->data->data[i]);
+        if(temp > crossdiff) crossdiff = temp;
+        temp = fmax(cabs(hptilde->data->data[i]), cabs(hctilde->data->data[i]));
+        if(temp > maxabs) maxabs = temp;
+    }
+    printf("Comparing waveforms from ChooseFDWaveform and ChooseFDWaveformFromCache\n");
+    printf("when the latter is cached with another waveform and transformed...\n");
+    printf("Cache hits: %" LAL_UINT8_FORMAT ", misses: %" LAL_UINT8_FORMAT "\n",
+            cacheLRU->hits, cacheLRU->misses);
+    printf("Largest difference in plus polarization is: %.16g\n", plusdiff);
+    printf("Largest difference in cross polarization is: %.16g\n\n", crossdiff);
+    if( cacheLRU->hits != 4 || cacheLRU->misses != 2 )
+        XLAL_ERROR(XLAL_EFAILED, "Expected 4 cache hits and 2 misses");
+    if( plusdiff > LRU_TOLERANCE * maxabs || crossdiff > LRU_TOLERANCE * maxabs )
+        XLAL_ERROR(XLAL_ETOL, "Waveform transformed from the cache differs by more than %g relative to the largest amplitude %g", LRU_TOLERANCE, maxabs);
+
+    XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+    XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+    XLALDestroyCOMPLEX16FrequencySeries(hptildeC);
+    XLALDestroyCOMPLEX16FrequencySeries(hctildeC);
+    hptilde = hctilde = hptildeC = hctildeC = NULL;
+
+    XLALDestroySimInspiralWaveformCache(cacheLRU);
     XLALDestroySimInspiralWaveformCache(cache);
     LALCheckMemoryLeaks();
 